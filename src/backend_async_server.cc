@@ -0,0 +1,1299 @@
+#include "backend_async_server.h"
+
+#include <pthread.h>
+#include <sched.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <set>
+#include <string>
+#include <vector>
+
+#include <grpc/grpc.h>
+#include <grpc/support/time.h>
+#include <grpcpp/alarm.h>
+#include <grpcpp/completion_queue.h>
+#include <grpcpp/impl/codegen/async_stream.h>
+#include <grpcpp/impl/codegen/async_unary_call.h>
+#include <grpcpp/security/server_credentials.h>
+#include <grpcpp/server_context.h>
+#include <grpcpp/support/byte_buffer.h>
+
+#include "backend_value_buffer.h"
+#include "spsc_queue.h"
+
+namespace {
+// How long the calls in flight get to finish once shutdown starts
+const std::chrono::milliseconds kShutdownGracePeriod(500);
+
+// A call in progress
+// The address of the call is the tag of its pending operation, and every
+// call has at most one pending operation at a time.
+class Call {
+ public:
+  virtual ~Call() {}
+
+  // Moves the call to its next state
+  // `ok` is the result of the operation that just completed.
+  virtual void Proceed(bool ok) = 0;
+
+  // Does the operation of a call handed over by `CoreRouter`
+  virtual void Serve() {}
+
+  // Finishes a write handed over to `DurabilityWaiter`, once its log record
+  // is durable or, if `ok` is false, once the log failed
+  virtual void Durable(bool ok) {}
+};
+}  // Anonymous namespace
+
+// Hands single-key calls to the completion queue that owns the key
+// There is one queue of calls from every core to every core, so each has a
+// single producer and a single consumer and needs no lock. A core that gets
+// calls is woken up by its `Doorbell`, an alarm on its completion queue.
+class CoreRouter {
+ public:
+  // The number of calls one core can have waiting for another; a call that
+  // does not fit is served where it arrived
+  static const size_t kQueueCapacity = 1024;
+
+  // Constructor that takes the data structure whose shards are split among
+  // the completion queues
+  CoreRouter(BackendDataStructure *backend_data,
+             const std::vector<grpc::ServerCompletionQueue *> &cqs);
+  ~CoreRouter();
+
+  CoreRouter(const CoreRouter &) = delete;
+  CoreRouter &operator=(const CoreRouter &) = delete;
+
+  // returns the core that owns `key`
+  inline size_t CoreOf(const std::string &key) const {
+    return backend_data_->ShardIndexOf(key) % num_of_cores_;
+  }
+
+  // Hands `call` from the poller of `from` to the poller of `to`, which
+  // calls its `Serve()`
+  // returns true if this operation succeeds
+  // returns false if the queue is full or the router is stopped, in which
+  // case the caller serves `call` itself
+  bool Send(size_t from, size_t to, Call *call);
+
+  // Serves every call waiting for `core`; only its poller calls this
+  void Drain(size_t core);
+
+  // Turns down new calls and waits for the waiting ones to be taken
+  // This is called before the server shuts down, while the pollers run.
+  void Stop();
+
+ private:
+  class Doorbell;
+
+  // Set while a poller is in `Send()`, which `Stop()` waits out
+  struct Sender {
+    std::atomic<bool> sending;
+    char padding[64 - sizeof(std::atomic<bool>)];
+  };
+
+  inline SpscQueue<Call *> &QueueOf(size_t from, size_t to) {
+    return *queues_[from * num_of_cores_ + to];
+  }
+
+  BackendDataStructure *backend_data_;
+  size_t num_of_cores_;
+  std::vector<std::unique_ptr<SpscQueue<Call *>>> queues_;
+  std::vector<std::unique_ptr<Doorbell>> doorbells_;
+  std::unique_ptr<Sender[]> senders_;
+  std::atomic<bool> stopped_;
+};
+
+const size_t CoreRouter::kQueueCapacity;
+
+// Wakes up the poller of one core when calls are sent to it
+// The alarm is only set by the sender that finds the bell quiet, so there is
+// at most one wake-up pending however many calls are sent.
+class CoreRouter::Doorbell final : public Call {
+ public:
+  Doorbell(CoreRouter *router, size_t core, grpc::ServerCompletionQueue *cq)
+      : router_(router), core_(core), cq_(cq), rung_(false) {}
+
+  // Called by a sender after it pushes a call
+  void Ring() {
+    if (!rung_.exchange(true)) {
+      alarm_.Set(cq_, gpr_now(GPR_CLOCK_MONOTONIC), this);
+    }
+  }
+
+  // The alarm went off on the poller of `core_`
+  void Proceed(bool ok) override {
+    // A call pushed after this finds the bell quiet and rings it again. The
+    // exchange reads the flag of every earlier sender, so their calls are
+    // seen by the drain.
+    rung_.exchange(false);
+    if (ok) {
+      router_->Drain(core_);
+    }
+  }
+
+ private:
+  CoreRouter *router_;
+  size_t core_;
+  grpc::ServerCompletionQueue *cq_;
+  grpc::Alarm alarm_;
+  std::atomic<bool> rung_;
+};
+
+CoreRouter::CoreRouter(BackendDataStructure *backend_data,
+                       const std::vector<grpc::ServerCompletionQueue *> &cqs)
+    : backend_data_(backend_data),
+      num_of_cores_(cqs.size()),
+      senders_(new Sender[cqs.size()]),
+      stopped_(false) {
+  for (size_t i = 0; i < num_of_cores_ * num_of_cores_; ++i) {
+    queues_.emplace_back(new SpscQueue<Call *>(kQueueCapacity));
+  }
+  for (size_t i = 0; i < num_of_cores_; ++i) {
+    doorbells_.emplace_back(new Doorbell(this, i, cqs[i]));
+    senders_[i].sending.store(false);
+  }
+}
+
+CoreRouter::~CoreRouter() {}
+
+// `sending` and `stopped_` are stored before they are loaded on both sides,
+// sequentially consistent, so either the sender sees the stop or `Stop()`
+// sees the sender. Each flag has its own cache line and is only written by
+// its poller, so this stays off other cores.
+bool CoreRouter::Send(size_t from, size_t to, Call *call) {
+  Sender &sender = senders_[from];
+  sender.sending.store(true);
+  bool sent = !stopped_.load() && QueueOf(from, to).Push(call);
+  if (sent) {
+    doorbells_[to]->Ring();
+  }
+  sender.sending.store(false, std::memory_order_release);
+  return sent;
+}
+
+void CoreRouter::Drain(size_t core) {
+  Call *call;
+  for (size_t from = 0; from < num_of_cores_; ++from) {
+    SpscQueue<Call *> &queue = QueueOf(from, core);
+    while (queue.Pop(&call)) {
+      call->Serve();
+    }
+  }
+}
+
+void CoreRouter::Stop() {
+  stopped_.store(true);
+  for (size_t i = 0; i < num_of_cores_; ++i) {
+    while (senders_[i].sending.load()) {
+      std::this_thread::yield();
+    }
+  }
+  // Every call sent has rung its doorbell, so the pollers take them
+  for (auto &queue : queues_) {
+    while (!queue->Empty()) {
+      std::this_thread::yield();
+    }
+  }
+}
+
+namespace {
+class ChangesCall;
+}  // Anonymous namespace
+
+// Wakes up the changes streams that wait for changes
+// It is the one listener of the change log for all the streams, so once it
+// is stopped no stream is woken up again, which lets the completion queues
+// shut down.
+class ChangeDispatcher {
+ public:
+  // Constructor that starts listening to `log`
+  explicit ChangeDispatcher(ChangeLog *log);
+  ~ChangeDispatcher();
+
+  ChangeDispatcher(const ChangeDispatcher &) = delete;
+  ChangeDispatcher &operator=(const ChangeDispatcher &) = delete;
+
+  // Wakes up `call` after every change from now on
+  void Add(ChangesCall *call);
+
+  // Stops waking up `call`
+  // It is not woken up again once this returns.
+  void Remove(ChangesCall *call);
+
+  // Stops listening to the change log
+  void Stop();
+
+ private:
+  // Called by the change log after every change
+  void Dispatch();
+
+  ChangeLog *log_;
+  size_t listener_id_;
+  bool stopped_;
+  // Guards `calls_`. The change log's lock is taken before this one.
+  std::mutex mutex_;
+  std::set<ChangesCall *> calls_;
+};
+
+// Finishes the writes the pollers hand over once their log records are
+// durable
+// One thread waits for the latest record handed over. Records become
+// durable in LSN order, so that covers every call handed over before it,
+// and the calls handed over in the meantime make up the next group commit.
+class DurabilityWaiter {
+ public:
+  // Constructor that starts the thread waiting for `log`
+  explicit DurabilityWaiter(WriteAheadLog *log);
+  ~DurabilityWaiter();
+
+  DurabilityWaiter(const DurabilityWaiter &) = delete;
+  DurabilityWaiter &operator=(const DurabilityWaiter &) = delete;
+
+  // Calls `call->Durable()` from the waiting thread once the record with
+  // `lsn` is durable
+  void Add(uint64_t lsn, Call *call);
+
+  // Finishes the calls handed over so far and stops the thread
+  // This is called while the completion queues still take operations.
+  void Stop();
+
+ private:
+  // The loop run by `thread_`
+  void Wait();
+
+  WriteAheadLog *log_;
+  // Guards every member below
+  std::mutex mutex_;
+  // Signaled when a call is handed over or the waiter stops
+  std::condition_variable cv_;
+  std::vector<Call *> calls_;
+  uint64_t lsn_;
+  bool stopping_;
+  std::thread thread_;
+};
+
+DurabilityWaiter::DurabilityWaiter(WriteAheadLog *log)
+    : log_(log), calls_(), lsn_(0), stopping_(false) {
+  thread_ = std::thread(&DurabilityWaiter::Wait, this);
+}
+
+DurabilityWaiter::~DurabilityWaiter() { Stop(); }
+
+void DurabilityWaiter::Add(uint64_t lsn, Call *call) {
+  std::lock_guard<std::mutex> guard(mutex_);
+  calls_.push_back(call);
+  lsn_ = std::max(lsn_, lsn);
+  cv_.notify_one();
+}
+
+void DurabilityWaiter::Stop() {
+  {
+    std::lock_guard<std::mutex> guard(mutex_);
+    stopping_ = true;
+  }
+  cv_.notify_one();
+  if (thread_.joinable()) {
+    thread_.join();
+  }
+}
+
+void DurabilityWaiter::Wait() {
+  std::vector<Call *> calls;
+  std::unique_lock<std::mutex> lock(mutex_);
+  while (true) {
+    cv_.wait(lock, [this]() { return !calls_.empty() || stopping_; });
+    if (calls_.empty()) {
+      return;
+    }
+    calls.swap(calls_);
+    uint64_t lsn = lsn_;
+    lock.unlock();
+
+    bool ok = log_->WaitForDurable(lsn);
+    for (Call *call : calls) {
+      call->Durable(ok);
+    }
+    calls.clear();
+    lock.lock();
+  }
+}
+
+namespace {
+// returns the key of a single-key request, which picks the core serving it
+template <typename Request>
+const std::string &KeyOfRequest(const Request &request) {
+  return request.key();
+}
+
+// A unary call served by one of the synchronous handlers of
+// `KeyValueStoreImpl`
+template <typename Request, typename Reply>
+class UnaryCall final : public Call {
+ public:
+  typedef void (chirp::KeyValueStore::AsyncService::*RequestMethod)(
+      grpc::ServerContext *, Request *,
+      grpc::ServerAsyncResponseWriter<Reply> *, grpc::CompletionQueue *,
+      grpc::ServerCompletionQueue *, void *);
+  typedef grpc::Status (KeyValueStoreImpl::*Handler)(grpc::ServerContext *,
+                                                     const Request *, Reply *);
+  typedef const std::string &(*KeyOf)(const Request &);
+
+  // Constructor that asks grpc for the next call of the method
+  // If `router` is not nullptr, calls are served by the core owning the key
+  // returned by `key_of`, or where they arrive if `key_of` is nullptr.
+  // `core` is the index of `cq`. If `waiter` is not nullptr, a call that
+  // writes is finished by it once the write is durable.
+  UnaryCall(chirp::KeyValueStore::AsyncService *async_service,
+            KeyValueStoreImpl *service, grpc::ServerCompletionQueue *cq,
+            CoreRouter *router, size_t core, DurabilityWaiter *waiter,
+            RequestMethod request_method, Handler handler,
+            KeyOf key_of = nullptr)
+      : async_service_(async_service),
+        service_(service),
+        cq_(cq),
+        router_(router),
+        core_(core),
+        waiter_(waiter),
+        request_method_(request_method),
+        handler_(handler),
+        key_of_(key_of),
+        responder_(&context_),
+        finished_(false) {
+    (async_service_->*request_method_)(&context_, &request_, &responder_, cq_,
+                                       cq_, this);
+  }
+
+  void Proceed(bool ok) override {
+    if (!ok || finished_) {
+      delete this;
+      return;
+    }
+
+    // Wait for the next call of the same method before serving this one
+    new UnaryCall(async_service_, service_, cq_, router_, core_, waiter_,
+                  request_method_, handler_, key_of_);
+
+    if (router_ != nullptr && key_of_ != nullptr) {
+      size_t owner = router_->CoreOf(key_of_(request_));
+      if (owner != core_ && router_->Send(core_, owner, this)) {
+        return;
+      }
+    }
+    Serve();
+  }
+
+  // The reply is still sent through `cq_`, which finishes the call there
+  void Serve() override {
+    if (waiter_ == nullptr) {
+      Finish((service_->*handler_)(&context_, &request_, &reply_));
+      return;
+    }
+
+    uint64_t lsn;
+    {
+      BackendDataStructure::DeferredDurability deferred;
+      status_ = (service_->*handler_)(&context_, &request_, &reply_);
+      lsn = deferred.get_lsn();
+    }
+    if (lsn == 0) {
+      Finish(status_);
+      return;
+    }
+    waiter_->Add(lsn, this);
+  }
+
+  void Durable(bool ok) override {
+    Finish(ok ? status_ : service_->ReadOnly());
+  }
+
+ private:
+  void Finish(const grpc::Status &status) {
+    finished_ = true;
+    responder_.Finish(reply_, status, this);
+  }
+
+  chirp::KeyValueStore::AsyncService *async_service_;
+  KeyValueStoreImpl *service_;
+  grpc::ServerCompletionQueue *cq_;
+  CoreRouter *router_;
+  size_t core_;
+  DurabilityWaiter *waiter_;
+  RequestMethod request_method_;
+  Handler handler_;
+  KeyOf key_of_;
+
+  grpc::ServerContext context_;
+  Request request_;
+  Reply reply_;
+  // The status of a write waiting to be durable
+  grpc::Status status_;
+  grpc::ServerAsyncResponseWriter<Reply> responder_;
+  bool finished_;
+};
+
+// A put whose value is moved to the data structure instead of copied
+// The request is read as bytes and parsed into a message the call owns, so
+// its value can be taken. With a router, it is served by the core owning its
+// key. With a waiter, it is finished once it is durable, like a `UnaryCall`.
+class PutCall final : public Call {
+ public:
+  // Constructor that asks grpc for the next put
+  PutCall(AsyncKeyValueStoreServer::AsyncService *async_service,
+          KeyValueStoreImpl *service, grpc::ServerCompletionQueue *cq,
+          CoreRouter *router, size_t core, DurabilityWaiter *waiter)
+      : async_service_(async_service),
+        service_(service),
+        cq_(cq),
+        router_(router),
+        core_(core),
+        waiter_(waiter),
+        responder_(&context_),
+        finished_(false) {
+    async_service_->Requestput(&context_, &request_buffer_, &responder_, cq_,
+                               cq_, this);
+  }
+
+  void Proceed(bool ok) override {
+    if (!ok || finished_) {
+      delete this;
+      return;
+    }
+
+    new PutCall(async_service_, service_, cq_, router_, core_, waiter_);
+
+    grpc::Status status =
+        grpc::SerializationTraits<chirp::PutRequest>::Deserialize(
+            &request_buffer_, &request_);
+    if (!status.ok()) {
+      Finish(status);
+      return;
+    }
+    if (router_ != nullptr) {
+      size_t owner = router_->CoreOf(request_.key());
+      if (owner != core_ && router_->Send(core_, owner, this)) {
+        return;
+      }
+    }
+    Serve();
+  }
+
+  // The reply is still sent through `cq_`, which finishes the call there
+  void Serve() override {
+    if (waiter_ == nullptr) {
+      Finish(service_->PutTakingValue(&request_));
+      return;
+    }
+
+    uint64_t lsn;
+    {
+      BackendDataStructure::DeferredDurability deferred;
+      status_ = service_->PutTakingValue(&request_);
+      lsn = deferred.get_lsn();
+    }
+    if (lsn == 0) {
+      Finish(status_);
+      return;
+    }
+    waiter_->Add(lsn, this);
+  }
+
+  void Durable(bool ok) override {
+    Finish(ok ? status_ : service_->ReadOnly());
+  }
+
+ private:
+  void Finish(const grpc::Status &status) {
+    bool own_buffer;
+    grpc::SerializationTraits<chirp::PutReply>::Serialize(
+        chirp::PutReply(), &reply_buffer_, &own_buffer);
+    finished_ = true;
+    responder_.Finish(reply_buffer_, status, this);
+  }
+
+  AsyncKeyValueStoreServer::AsyncService *async_service_;
+  KeyValueStoreImpl *service_;
+  grpc::ServerCompletionQueue *cq_;
+  CoreRouter *router_;
+  size_t core_;
+  DurabilityWaiter *waiter_;
+
+  grpc::ServerContext context_;
+  grpc::ByteBuffer request_buffer_;
+  chirp::PutRequest request_;
+  // The status of a put waiting to be durable
+  grpc::Status status_;
+  grpc::ByteBuffer reply_buffer_;
+  grpc::ServerAsyncResponseWriter<grpc::ByteBuffer> responder_;
+  bool finished_;
+};
+
+// A get stream
+// Requests are read one at a time. The replies of a request are written
+// before the next request is read, which keeps them in order and leaves at
+// most one operation pending.
+// A reply is written as bytes pointing at the value the storage holds, see
+// `KeyValueStoreImpl::EncodeGetReply()`, so the value is not copied.
+// With a router, a request for a single key is looked up by the core owning
+// the key. Batches are looked up where the stream arrived.
+class GetCall final : public Call {
+ public:
+  // Constructor that asks grpc for the next get stream
+  GetCall(AsyncKeyValueStoreServer::AsyncService *async_service,
+          KeyValueStoreImpl *service, grpc::ServerCompletionQueue *cq,
+          CoreRouter *router, size_t core)
+      : async_service_(async_service),
+        service_(service),
+        cq_(cq),
+        router_(router),
+        core_(core),
+        stream_(&context_),
+        state_(REQUESTED),
+        next_reply_(0) {
+    async_service_->Requestget(&context_, &stream_, cq_, cq_, this);
+  }
+
+  void Proceed(bool ok) override {
+    switch (state_) {
+      case REQUESTED:
+        if (!ok) {
+          delete this;
+          return;
+        }
+        new GetCall(async_service_, service_, cq_, router_, core_);
+        Read();
+        break;
+      case READING: {
+        // The client is done sending requests
+        if (!ok) {
+          Finish();
+          break;
+        }
+        grpc::Status status =
+            grpc::SerializationTraits<chirp::GetRequest>::Deserialize(
+                &request_buffer_, &request_);
+        if (!status.ok()) {
+          Finish(status);
+          break;
+        }
+        if (router_ != nullptr && request_.keys_size() == 0) {
+          size_t owner = router_->CoreOf(request_.key());
+          if (owner != core_ && router_->Send(core_, owner, this)) {
+            break;
+          }
+        }
+        Serve();
+        break;
+      }
+      case WRITING:
+        if (!ok) {
+          Finish();
+          break;
+        }
+        WriteNextReply();
+        break;
+      case FINISHING:
+        delete this;
+        break;
+    }
+  }
+
+  // Looks up the request that was just read and writes its first reply
+  void Serve() override {
+    values_.clear();
+    if (!service_->LookUpShared(request_, &values_)) {
+      Finish(service_->SnapshotNotReadable());
+      return;
+    }
+    next_reply_ = 0;
+    WriteNextReply();
+  }
+
+ private:
+  enum States { REQUESTED, READING, WRITING, FINISHING };
+
+  void Read() {
+    state_ = READING;
+    stream_.Read(&request_buffer_, this);
+  }
+
+  // Writes the next reply of the current request, or reads the next request
+  // if all of them are written
+  void WriteNextReply() {
+    if (next_reply_ == values_.size()) {
+      Read();
+      return;
+    }
+
+    // The reply holds its own reference to the value
+    grpc::ByteBuffer reply;
+    KeyValueStoreImpl::EncodeGetReply(values_[next_reply_], &reply);
+    values_[next_reply_] = ValueBuffer();
+    ++next_reply_;
+
+    // No buffer hint: a buffered write may not complete before the next
+    // write flushes it, and the next write waits for this one to complete
+    state_ = WRITING;
+    stream_.Write(reply, this);
+  }
+
+  void Finish(const grpc::Status &status = grpc::Status::OK) {
+    state_ = FINISHING;
+    stream_.Finish(status, this);
+  }
+
+  AsyncKeyValueStoreServer::AsyncService *async_service_;
+  KeyValueStoreImpl *service_;
+  grpc::ServerCompletionQueue *cq_;
+  CoreRouter *router_;
+  size_t core_;
+
+  grpc::ServerContext context_;
+  grpc::ServerAsyncReaderWriter<grpc::ByteBuffer, grpc::ByteBuffer> stream_;
+  States state_;
+  grpc::ByteBuffer request_buffer_;
+  chirp::GetRequest request_;
+  // Values of `request_` that are not written yet
+  std::vector<ValueBuffer> values_;
+  size_t next_reply_;
+};
+
+// A scan stream
+// One chunk is written at a time, and the next one is only read from the
+// data structure once the previous one is taken by grpc, which is how the
+// scan follows the flow control of the client.
+class ScanCall final : public Call {
+ public:
+  // Constructor that asks grpc for the next scan call
+  ScanCall(chirp::KeyValueStore::AsyncService *async_service,
+           KeyValueStoreImpl *service, grpc::ServerCompletionQueue *cq)
+      : async_service_(async_service),
+        service_(service),
+        cq_(cq),
+        writer_(&context_),
+        state_(REQUESTED) {
+    async_service_->Requestscan(&context_, &request_, &writer_, cq_, cq_,
+                                this);
+  }
+
+  void Proceed(bool ok) override {
+    switch (state_) {
+      case REQUESTED:
+        if (!ok) {
+          delete this;
+          return;
+        }
+        new ScanCall(async_service_, service_, cq_);
+        service_->StartScan(request_, &cursor_);
+        WriteNextChunk();
+        break;
+      case WRITING:
+        // The client is gone
+        if (!ok) {
+          Finish();
+          break;
+        }
+        WriteNextChunk();
+        break;
+      case FINISHING:
+        delete this;
+        break;
+    }
+  }
+
+ private:
+  enum States { REQUESTED, WRITING, FINISHING };
+
+  // Writes the next chunk, or finishes if the range is done
+  void WriteNextChunk() {
+    chirp::ScanReply reply;
+    if (!service_->NextScanChunk(&cursor_, &reply)) {
+      Finish();
+      return;
+    }
+
+    state_ = WRITING;
+    writer_.Write(reply, this);
+  }
+
+  void Finish() {
+    state_ = FINISHING;
+    writer_.Finish(grpc::Status::OK, this);
+  }
+
+  chirp::KeyValueStore::AsyncService *async_service_;
+  KeyValueStoreImpl *service_;
+  grpc::ServerCompletionQueue *cq_;
+
+  grpc::ServerContext context_;
+  chirp::ScanRequest request_;
+  grpc::ServerAsyncWriter<chirp::ScanReply> writer_;
+  States state_;
+  // Where the stream is in the range
+  KeyValueStoreImpl::ScanCursor cursor_;
+};
+
+// Brings a waiting stream call back to its completion queue through an alarm
+// Any thread may ring it, and at most one alarm is pending however many times
+// it is rung.
+template <class StreamCall>
+class Waker final : public Call {
+ public:
+  Waker(StreamCall *call, grpc::ServerCompletionQueue *cq)
+      : call_(call), cq_(cq), rung_(false) {}
+
+  void Ring() {
+    if (!rung_.exchange(true)) {
+      alarm_.Set(cq_, gpr_now(GPR_CLOCK_MONOTONIC), this);
+    }
+  }
+
+  // A ring after this sets the alarm again
+  void Proceed(bool ok) override {
+    rung_.exchange(false);
+    call_->Woken();
+  }
+
+  inline bool is_rung() const { return rung_; }
+
+ private:
+  StreamCall *call_;
+  grpc::ServerCompletionQueue *cq_;
+  grpc::Alarm alarm_;
+  std::atomic<bool> rung_;
+};
+
+// Tells a stream call that grpc is done with it
+template <class StreamCall>
+class DoneTag final : public Call {
+ public:
+  explicit DoneTag(StreamCall *call) : call_(call) {}
+
+  void Proceed(bool ok) override { call_->Done(); }
+
+ private:
+  StreamCall *call_;
+};
+
+// A changes stream
+// Once every change is sent, the call waits with no operation pending. The
+// dispatcher rings its waker from the thread that appends the next change,
+// which brings the call back to its completion queue. A call is deleted once
+// its stream is finished, grpc reports it done, and its waker is quiet.
+class ChangesCall final : public Call {
+ public:
+  // Constructor that asks grpc for the next changes stream
+  ChangesCall(chirp::KeyValueStore::AsyncService *async_service,
+              KeyValueStoreImpl *service, grpc::ServerCompletionQueue *cq,
+              ChangeDispatcher *dispatcher)
+      : async_service_(async_service),
+        service_(service),
+        cq_(cq),
+        dispatcher_(dispatcher),
+        writer_(&context_),
+        state_(REQUESTED),
+        waker_(this, cq),
+        done_(this),
+        is_done_(false),
+        next_seq_(0),
+        last_write_() {
+    context_.AsyncNotifyWhenDone(&done_);
+    async_service_->Requestchanges(&context_, &request_, &writer_, cq_, cq_,
+                                   this);
+  }
+
+  void Proceed(bool ok) override {
+    switch (state_) {
+      case REQUESTED: {
+        // grpc never reports a call that did not start as done
+        if (!ok) {
+          delete this;
+          return;
+        }
+        new ChangesCall(async_service_, service_, cq_, dispatcher_);
+        grpc::Status status = service_->StartChanges(request_, &next_seq_);
+        if (!status.ok()) {
+          Finish(status);
+          break;
+        }
+        if (dispatcher_ != nullptr) {
+          dispatcher_->Add(this);
+        }
+        WriteNextReply(true);
+        break;
+      }
+      case WRITING:
+        // The stream was cancelled while the write was pending
+        if (is_done_) {
+          Close();
+          break;
+        }
+        // The client is gone
+        if (!ok) {
+          Finish(grpc::Status::OK);
+          break;
+        }
+        WriteNextReply(false);
+        break;
+      case FINISHING:
+        Close();
+        break;
+      case WAITING:
+      case FINISHED:
+        break;
+    }
+  }
+
+  // Brings the call back to its completion queue; any thread may call this
+  void Ring() { waker_.Ring(); }
+
+ private:
+  friend class Waker<ChangesCall>;
+  friend class DoneTag<ChangesCall>;
+
+  enum States { REQUESTED, WRITING, WAITING, FINISHING, FINISHED };
+
+  // Writes the changes from `next_seq_` on, or waits for the next change if
+  // there is none to send
+  // Changes that are all filtered out are only reported once in a while.
+  void WriteNextReply(bool first) {
+    chirp::ChangesReply reply;
+    grpc::Status status = service_->NextChanges(
+        request_, &next_seq_, std::chrono::milliseconds(0), &reply);
+    if (!status.ok()) {
+      Finish(status);
+      return;
+    }
+
+    auto now = std::chrono::steady_clock::now();
+    if (!first && reply.changes_size() == 0 &&
+        now - last_write_ < std::chrono::milliseconds(
+                                KeyValueStoreImpl::kChangesHeartbeatMs)) {
+      state_ = WAITING;
+      return;
+    }
+    last_write_ = now;
+    state_ = WRITING;
+    writer_.Write(reply, this);
+  }
+
+  // A change was appended, or the waker went off while the call was busy
+  void Woken() {
+    if (state_ == WAITING) {
+      WriteNextReply(false);
+    } else {
+      DeleteIfDone();
+    }
+  }
+
+  // The stream is finished or cancelled
+  // A waiting stream can only have been cancelled, and is not finished,
+  // since the completion queue may already be shut down.
+  void Done() {
+    is_done_ = true;
+    if (state_ == WAITING) {
+      Close();
+    } else {
+      DeleteIfDone();
+    }
+  }
+
+  void Finish(const grpc::Status &status) {
+    if (dispatcher_ != nullptr) {
+      dispatcher_->Remove(this);
+    }
+    state_ = FINISHING;
+    writer_.Finish(status, this);
+  }
+
+  // Starts no more operations
+  void Close() {
+    if (dispatcher_ != nullptr) {
+      dispatcher_->Remove(this);
+    }
+    state_ = FINISHED;
+    DeleteIfDone();
+  }
+
+  void DeleteIfDone() {
+    if (state_ == FINISHED && is_done_ && !waker_.is_rung()) {
+      delete this;
+    }
+  }
+
+  chirp::KeyValueStore::AsyncService *async_service_;
+  KeyValueStoreImpl *service_;
+  grpc::ServerCompletionQueue *cq_;
+  ChangeDispatcher *dispatcher_;
+
+  grpc::ServerContext context_;
+  chirp::ChangesRequest request_;
+  grpc::ServerAsyncWriter<chirp::ChangesReply> writer_;
+  States state_;
+  Waker<ChangesCall> waker_;
+  DoneTag<ChangesCall> done_;
+  bool is_done_;
+  uint64_t next_seq_;
+  std::chrono::steady_clock::time_point last_write_;
+};
+
+// A watch stream
+// It waits with no operation pending like a changes stream, and its watcher
+// rings its waker from the thread that writes a watched key.
+class WatchCall final : public Call {
+ public:
+  // Constructor that asks grpc for the next watch stream
+  WatchCall(chirp::KeyValueStore::AsyncService *async_service,
+            KeyValueStoreImpl *service, grpc::ServerCompletionQueue *cq)
+      : async_service_(async_service),
+        service_(service),
+        cq_(cq),
+        writer_(&context_),
+        state_(REQUESTED),
+        waker_(this, cq),
+        done_(this),
+        is_done_(false),
+        watcher_() {
+    context_.AsyncNotifyWhenDone(&done_);
+    async_service_->Requestwatch(&context_, &request_, &writer_, cq_, cq_,
+                                 this);
+  }
+
+  void Proceed(bool ok) override {
+    switch (state_) {
+      case REQUESTED: {
+        // grpc never reports a call that did not start as done
+        if (!ok) {
+          delete this;
+          return;
+        }
+        new WatchCall(async_service_, service_, cq_);
+        grpc::Status status = service_->StartWatch(
+            request_, [this]() { waker_.Ring(); }, &watcher_);
+        if (!status.ok()) {
+          Finish(status);
+          break;
+        }
+        // The prefixes are watched from now on
+        state_ = WRITING;
+        writer_.Write(chirp::WatchReply(), this);
+        break;
+      }
+      case WRITING:
+        // The stream was cancelled while the write was pending
+        if (is_done_) {
+          Close();
+          break;
+        }
+        // The client is gone
+        if (!ok) {
+          Finish(grpc::Status::OK);
+          break;
+        }
+        WriteNextReply();
+        break;
+      case FINISHING:
+        Close();
+        break;
+      case WAITING:
+      case FINISHED:
+        break;
+    }
+  }
+
+ private:
+  friend class Waker<WatchCall>;
+  friend class DoneTag<WatchCall>;
+
+  enum States { REQUESTED, WRITING, WAITING, FINISHING, FINISHED };
+
+  // Writes the events so far, or waits for the next one if there is none
+  void WriteNextReply() {
+    chirp::WatchReply reply;
+    if (!service_->NextWatchEvents(watcher_.get(),
+                                   std::chrono::milliseconds(0), &reply)) {
+      state_ = WAITING;
+      return;
+    }
+    state_ = WRITING;
+    writer_.Write(reply, this);
+  }
+
+  // A watched key was written, or the waker went off while the call was busy
+  void Woken() {
+    if (state_ == WAITING) {
+      WriteNextReply();
+    } else {
+      DeleteIfDone();
+    }
+  }
+
+  // The stream is finished or cancelled
+  void Done() {
+    is_done_ = true;
+    if (state_ == WAITING) {
+      Close();
+    } else {
+      DeleteIfDone();
+    }
+  }
+
+  void Finish(const grpc::Status &status) {
+    StopWatching();
+    state_ = FINISHING;
+    writer_.Finish(status, this);
+  }
+
+  // Starts no more operations
+  void Close() {
+    StopWatching();
+    state_ = FINISHED;
+    DeleteIfDone();
+  }
+
+  // The waker is not rung again once this returns
+  void StopWatching() {
+    if (watcher_ != nullptr) {
+      service_->StopWatch(watcher_.get());
+    }
+  }
+
+  void DeleteIfDone() {
+    if (state_ == FINISHED && is_done_ && !waker_.is_rung()) {
+      delete this;
+    }
+  }
+
+  chirp::KeyValueStore::AsyncService *async_service_;
+  KeyValueStoreImpl *service_;
+  grpc::ServerCompletionQueue *cq_;
+
+  grpc::ServerContext context_;
+  chirp::WatchRequest request_;
+  grpc::ServerAsyncWriter<chirp::WatchReply> writer_;
+  States state_;
+  Waker<WatchCall> waker_;
+  DoneTag<WatchCall> done_;
+  bool is_done_;
+  std::unique_ptr<WatchTable::Watcher> watcher_;
+};
+}  // Anonymous namespace
+
+ChangeDispatcher::ChangeDispatcher(ChangeLog *log)
+    : log_(log), listener_id_(0), stopped_(false), calls_() {
+  listener_id_ = log_->AddListener([this]() { Dispatch(); });
+}
+
+ChangeDispatcher::~ChangeDispatcher() { Stop(); }
+
+void ChangeDispatcher::Add(ChangesCall *call) {
+  std::lock_guard<std::mutex> guard(mutex_);
+  calls_.insert(call);
+}
+
+void ChangeDispatcher::Remove(ChangesCall *call) {
+  std::lock_guard<std::mutex> guard(mutex_);
+  calls_.erase(call);
+}
+
+void ChangeDispatcher::Stop() {
+  if (!stopped_) {
+    stopped_ = true;
+    log_->RemoveListener(listener_id_);
+  }
+}
+
+void ChangeDispatcher::Dispatch() {
+  std::lock_guard<std::mutex> guard(mutex_);
+  for (ChangesCall *call : calls_) {
+    call->Ring();
+  }
+}
+
+AsyncKeyValueStoreServer::AsyncKeyValueStoreServer(
+    KeyValueStoreImpl *service, size_t num_of_completion_queues,
+    bool shared_nothing)
+    : service_(service),
+      num_of_completion_queues_(num_of_completion_queues),
+      shared_nothing_(shared_nothing),
+      shut_down_(false) {
+  if (num_of_completion_queues_ == 0) {
+    num_of_completion_queues_ = std::thread::hardware_concurrency();
+  }
+  if (num_of_completion_queues_ == 0) {
+    num_of_completion_queues_ = 1;
+  }
+}
+
+AsyncKeyValueStoreServer::~AsyncKeyValueStoreServer() { Shutdown(); }
+
+void AsyncKeyValueStoreServer::RegisterService(grpc::Service *service) {
+  other_services_.push_back(service);
+}
+
+bool AsyncKeyValueStoreServer::Start(const std::string &address) {
+  grpc::ServerBuilder builder;
+  builder.AddListeningPort(address, grpc::InsecureServerCredentials());
+  builder.RegisterService(&async_service_);
+  for (grpc::Service *service : other_services_) {
+    builder.RegisterService(service);
+  }
+  for (size_t i = 0; i < num_of_completion_queues_; ++i) {
+    cqs_.push_back(builder.AddCompletionQueue());
+  }
+  server_ = builder.BuildAndStart();
+  if (server_ == nullptr) {
+    return false;
+  }
+
+  if (shared_nothing_) {
+    std::vector<grpc::ServerCompletionQueue *> cqs;
+    for (auto &cq : cqs_) {
+      cqs.push_back(cq.get());
+    }
+    router_.reset(new CoreRouter(service_->get_backend_data(), cqs));
+  }
+
+  if (service_->get_change_log() != nullptr) {
+    change_dispatcher_.reset(new ChangeDispatcher(service_->get_change_log()));
+  }
+
+  WriteAheadLog *log = service_->get_backend_data()->get_write_ahead_log();
+  if (log != nullptr) {
+    durability_waiter_.reset(new DurabilityWaiter(log));
+  }
+
+  // Every completion queue waits for calls of every method. A call asks for
+  // its successor as soon as it arrives, so each queue always has one
+  // pending request per method.
+  for (size_t i = 0; i < cqs_.size(); ++i) {
+    grpc::ServerCompletionQueue *cq = cqs_[i].get();
+    CoreRouter *router = router_.get();
+    DurabilityWaiter *waiter = durability_waiter_.get();
+    new PutCall(&async_service_, service_, cq, router, i, waiter);
+    new GetCall(&async_service_, service_, cq, router, i);
+    new ScanCall(&async_service_, service_, cq);
+    new ChangesCall(&async_service_, service_, cq, change_dispatcher_.get());
+    new WatchCall(&async_service_, service_, cq);
+    new UnaryCall<chirp::DeleteRequest, chirp::DeleteReply>(
+        &async_service_, service_, cq, router, i, waiter,
+        &chirp::KeyValueStore::AsyncService::Requestdeletekey,
+        &KeyValueStoreImpl::deletekey, &KeyOfRequest<chirp::DeleteRequest>);
+    new UnaryCall<chirp::MultiPutRequest, chirp::MultiPutReply>(
+        &async_service_, service_, cq, router, i, waiter,
+        &chirp::KeyValueStore::AsyncService::Requestmultiput,
+        &KeyValueStoreImpl::multiput);
+    new UnaryCall<chirp::MultiDeleteRequest, chirp::MultiDeleteReply>(
+        &async_service_, service_, cq, router, i, waiter,
+        &chirp::KeyValueStore::AsyncService::Requestmultidelete,
+        &KeyValueStoreImpl::multidelete);
+    new UnaryCall<chirp::FetchAddRequest, chirp::FetchAddReply>(
+        &async_service_, service_, cq, router, i, waiter,
+        &chirp::KeyValueStore::AsyncService::Requestfetch_add,
+        &KeyValueStoreImpl::fetch_add, &KeyOfRequest<chirp::FetchAddRequest>);
+    new UnaryCall<chirp::CompareAndSwapRequest, chirp::CompareAndSwapReply>(
+        &async_service_, service_, cq, router, i, waiter,
+        &chirp::KeyValueStore::AsyncService::Requestcompare_and_swap,
+        &KeyValueStoreImpl::compare_and_swap,
+        &KeyOfRequest<chirp::CompareAndSwapRequest>);
+    new UnaryCall<chirp::WriteBatchRequest, chirp::WriteBatchReply>(
+        &async_service_, service_, cq, router, i, waiter,
+        &chirp::KeyValueStore::AsyncService::Requestwrite_batch,
+        &KeyValueStoreImpl::write_batch);
+    new UnaryCall<chirp::ListElementRequest, chirp::ListElementReply>(
+        &async_service_, service_, cq, router, i, waiter,
+        &chirp::KeyValueStore::AsyncService::Requestlist_append,
+        &KeyValueStoreImpl::list_append,
+        &KeyOfRequest<chirp::ListElementRequest>);
+    new UnaryCall<chirp::ListElementRequest, chirp::ListElementReply>(
+        &async_service_, service_, cq, router, i, waiter,
+        &chirp::KeyValueStore::AsyncService::Requestlist_remove,
+        &KeyValueStoreImpl::list_remove,
+        &KeyOfRequest<chirp::ListElementRequest>);
+    new UnaryCall<chirp::MemoryUsageRequest, chirp::MemoryUsageReply>(
+        &async_service_, service_, cq, router, i, waiter,
+        &chirp::KeyValueStore::AsyncService::Requestmemory_usage,
+        &KeyValueStoreImpl::memory_usage);
+    new UnaryCall<chirp::StatsRequest, chirp::StatsReply>(
+        &async_service_, service_, cq, router, i, waiter,
+        &chirp::KeyValueStore::AsyncService::Requeststats,
+        &KeyValueStoreImpl::stats);
+    new UnaryCall<chirp::ExistsRequest, chirp::ExistsReply>(
+        &async_service_, service_, cq, router, i, waiter,
+        &chirp::KeyValueStore::AsyncService::Requestexists,
+        &KeyValueStoreImpl::exists);
+    new UnaryCall<chirp::CreateSnapshotRequest, chirp::CreateSnapshotReply>(
+        &async_service_, service_, cq, router, i, waiter,
+        &chirp::KeyValueStore::AsyncService::Requestcreate_snapshot,
+        &KeyValueStoreImpl::create_snapshot);
+    new UnaryCall<chirp::ReleaseSnapshotRequest, chirp::ReleaseSnapshotReply>(
+        &async_service_, service_, cq, router, i, waiter,
+        &chirp::KeyValueStore::AsyncService::Requestrelease_snapshot,
+        &KeyValueStoreImpl::release_snapshot);
+  }
+
+  for (auto &cq : cqs_) {
+    pollers_.emplace_back(&AsyncKeyValueStoreServer::Poll, cq.get());
+  }
+  if (shared_nothing_) {
+    // Keep each poller, and the shards it owns, on one core
+    size_t num_of_cores = std::thread::hardware_concurrency();
+    for (size_t i = 0; num_of_cores > 0 && i < pollers_.size(); ++i) {
+      cpu_set_t cpus;
+      CPU_ZERO(&cpus);
+      CPU_SET(i % num_of_cores, &cpus);
+      pthread_setaffinity_np(pollers_[i].native_handle(), sizeof(cpus),
+                             &cpus);
+    }
+  }
+  return true;
+}
+
+void AsyncKeyValueStoreServer::Wait() {
+  for (auto &poller : pollers_) {
+    if (poller.joinable()) {
+      poller.join();
+    }
+  }
+}
+
+void AsyncKeyValueStoreServer::Shutdown() {
+  if (server_ == nullptr || shut_down_) {
+    return;
+  }
+  shut_down_ = true;
+
+  // Calls waiting for another core are served before the server stops
+  // taking operations; later ones are served where they arrive
+  if (router_ != nullptr) {
+    router_->Stop();
+  }
+  // The pollers keep running until the calls in flight are cancelled and
+  // their tags are drained
+  server_->Shutdown(std::chrono::system_clock::now() + kShutdownGracePeriod);
+  // Writes still waiting for the log are finished while their queues take
+  // operations
+  if (durability_waiter_ != nullptr) {
+    durability_waiter_->Stop();
+  }
+  // No alarm is set on a completion queue once it is shut down
+  if (change_dispatcher_ != nullptr) {
+    change_dispatcher_->Stop();
+  }
+  for (auto &cq : cqs_) {
+    cq->Shutdown();
+  }
+  Wait();
+}
+
+void AsyncKeyValueStoreServer::Poll(grpc::ServerCompletionQueue *cq) {
+  void *tag;
+  bool ok;
+  while (cq->Next(&tag, &ok)) {
+    static_cast<Call *>(tag)->Proceed(ok);
+  }
+}
@@ -0,0 +1,110 @@
+#ifndef CHIRP_SRC_BACKEND_ASYNC_SERVER_H_
+#define CHIRP_SRC_BACKEND_ASYNC_SERVER_H_
+
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <grpcpp/server.h>
+#include <grpcpp/server_builder.h>
+
+#include "backend_server.h"
+#include "key_value.grpc.pb.h"
+
+class ChangeDispatcher;
+class CoreRouter;
+class DurabilityWaiter;
+
+// Serves the `chirp::KeyValueStore` service through the asynchronous grpc API.
+// The synchronous server ties a thread to every in-flight call, including
+// every open get stream. Here the calls are state machines driven by a fixed
+// number of completion queues, each polled by one thread, so the number of
+// threads does not grow with the number of connected clients.
+// The operations themselves are done by a `KeyValueStoreImpl`, so both
+// servers behave the same.
+// In shared-nothing mode every completion queue owns the keys of the shards
+// `i`, `i + n`, `i + 2n`, ... and its poller is pinned to one core. A
+// single-key call that arrives on another queue is handed to the owner
+// through a lock-free single-producer single-consumer queue, so the pairs and
+// shard locks of a key are only ever touched by one thread. Calls on several
+// keys are served where they arrive.
+// A changes or watch stream that has sent everything waits without a pending
+// operation; the thread that makes the next change wakes it up through an
+// alarm on its completion queue.
+// `get` and `put` are raw methods: their messages are read and written as
+// byte buffers, so a value goes from a put request to the storage and from
+// the storage to a get reply without being copied on the way.
+// With a write-ahead log, a poller applies a write without waiting for its
+// record to be durable, and hands the call to one waiter thread that
+// finishes it once the record is. A poller never blocks on an fsync, and
+// the writes of every queue can join the same group commit.
+class AsyncKeyValueStoreServer {
+ public:
+  // The service the calls are asked for, with `get` and `put` as raw methods
+  typedef chirp::KeyValueStore::WithRawMethod_get<
+      chirp::KeyValueStore::WithRawMethod_put<
+          chirp::KeyValueStore::AsyncService>>
+      AsyncService;
+
+  // Constructor that takes the service doing the operations, the number of
+  // completion queues, and whether calls are routed to the queue owning
+  // their key. 0 queues means one completion queue per core.
+  AsyncKeyValueStoreServer(KeyValueStoreImpl *service,
+                           size_t num_of_completion_queues = 0,
+                           bool shared_nothing = false);
+
+  // Shuts the server down if it is still running
+  ~AsyncKeyValueStoreServer();
+
+  AsyncKeyValueStoreServer(const AsyncKeyValueStoreServer &) = delete;
+  AsyncKeyValueStoreServer &operator=(const AsyncKeyValueStoreServer &) =
+      delete;
+
+  // Serves `service` as well, with gRPC's own threads
+  // This should be called before `Start()`. `service` is not owned and should
+  // outlive the server.
+  void RegisterService(grpc::Service *service);
+
+  // Starts listening on `address` and starts the poller threads
+  // returns true if this operation succeeds
+  // returns false otherwise
+  bool Start(const std::string &address);
+
+  // Blocks until the poller threads exit
+  void Wait();
+
+  // Stops taking calls, cancels the ones in flight and joins the pollers
+  void Shutdown();
+
+  inline size_t get_num_of_completion_queues() const {
+    return num_of_completion_queues_;
+  }
+
+  inline bool is_shared_nothing() const { return shared_nothing_; }
+
+ private:
+  // Drains `cq` until it is shut down
+  static void Poll(grpc::ServerCompletionQueue *cq);
+
+  KeyValueStoreImpl *service_;
+  size_t num_of_completion_queues_;
+  bool shared_nothing_;
+  AsyncService async_service_;
+  std::vector<grpc::Service *> other_services_;
+  std::unique_ptr<grpc::Server> server_;
+  std::vector<std::unique_ptr<grpc::ServerCompletionQueue>> cqs_;
+  // Hands calls to the queue owning their key, or nullptr if calls are served
+  // where they arrive
+  std::unique_ptr<CoreRouter> router_;
+  // Wakes up the changes streams, or nullptr if the changes are not kept
+  std::unique_ptr<ChangeDispatcher> change_dispatcher_;
+  // Finishes the writes once they are durable, or nullptr if the writes are
+  // not logged
+  std::unique_ptr<DurabilityWaiter> durability_waiter_;
+  std::vector<std::thread> pollers_;
+  bool shut_down_;
+};
+
+#endif /* CHIRP_SRC_BACKEND_ASYNC_SERVER_H_ */
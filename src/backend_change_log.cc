@@ -0,0 +1,86 @@
+#include "backend_change_log.h"
+
+#include <algorithm>
+
+const size_t ChangeLog::kDefaultCapacity;
+
+ChangeLog::ChangeLog(size_t capacity, uint64_t first_seq)
+    : capacity_(std::max<size_t>(capacity, 1)),
+      changes_(),
+      first_seq_(first_seq),
+      next_seq_(first_seq),
+      listeners_(),
+      next_listener_id_(0) {}
+
+uint64_t ChangeLog::Append(Operations operation, const std::string &key,
+                           const std::string &value) {
+  uint64_t seq;
+  {
+    std::lock_guard<std::mutex> guard(mutex_);
+    seq = next_seq_++;
+    changes_.push_back(Change{seq, operation, key, value});
+    if (changes_.size() > capacity_) {
+      changes_.pop_front();
+      ++first_seq_;
+    }
+    for (const auto &listener : listeners_) {
+      listener.second();
+    }
+  }
+  appended_cv_.notify_all();
+  return seq;
+}
+
+bool ChangeLog::Read(uint64_t *from_seq, const std::string &prefix,
+                     size_t max_changes, std::chrono::milliseconds timeout,
+                     std::vector<Change> *changes) {
+  auto deadline = std::chrono::steady_clock::now() + timeout;
+  std::unique_lock<std::mutex> lock(mutex_);
+  size_t num_of_copied = 0;
+  while (true) {
+    // Changes may also be dropped while waiting
+    if (*from_seq < first_seq_ || *from_seq > next_seq_) {
+      return false;
+    }
+
+    size_t end = changes_.size();
+    for (size_t i = *from_seq - first_seq_;
+         i < end && num_of_copied < max_changes; ++i) {
+      const Change &change = changes_[i];
+      *from_seq = change.seq + 1;
+      if (change.key.compare(0, prefix.size(), prefix) == 0) {
+        changes->push_back(change);
+        ++num_of_copied;
+      }
+    }
+
+    if (num_of_copied > 0 ||
+        appended_cv_.wait_until(lock, deadline) == std::cv_status::timeout) {
+      break;
+    }
+  }
+  // The changes appended while the wait timed out are left to the next read
+  return true;
+}
+
+size_t ChangeLog::AddListener(const std::function<void()> &listener) {
+  std::lock_guard<std::mutex> guard(mutex_);
+  size_t id = next_listener_id_++;
+  listeners_[id] = listener;
+  return id;
+}
+
+void ChangeLog::RemoveListener(size_t id) {
+  std::lock_guard<std::mutex> guard(mutex_);
+  listeners_.erase(id);
+}
+
+uint64_t ChangeLog::get_next_seq() {
+  std::lock_guard<std::mutex> guard(mutex_);
+  return next_seq_;
+}
+
+uint64_t ChangeLog::get_first_seq() {
+  std::lock_guard<std::mutex> guard(mutex_);
+  return first_seq_;
+}
@@ -0,0 +1,91 @@
+#ifndef CHIRP_SRC_BACKEND_CHANGE_LOG_H_
+#define CHIRP_SRC_BACKEND_CHANGE_LOG_H_
+
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <map>
+#include <mutex>
+#include <string>
+#include <vector>
+
+// The latest puts and deletes committed to a data structure, for consumers
+// that follow the changes instead of polling
+// Every change gets the next sequence number when it is appended, which the
+// data structure does while the shard of the key is locked, so the changes
+// of one key are numbered in the order they are applied. The last `capacity`
+// changes are kept, so a consumer that reconnects resumes from the sequence
+// number after the last change it saw as long as that change is still kept.
+class ChangeLog {
+ public:
+  // What a change did to its key
+  enum Operations : int { PUT = 0, DELETE };
+
+  struct Change {
+    uint64_t seq;
+    Operations operation;
+    std::string key;
+    // Empty for a delete
+    std::string value;
+  };
+
+  // The number of changes kept by default
+  static const size_t kDefaultCapacity = 65536;
+
+  // Constructor that takes the number of changes kept and the sequence
+  // number of the first change
+  // Starting from a number no earlier run of the server has reached makes
+  // the offsets consumers kept from before a restart fall out of range.
+  ChangeLog(size_t capacity, uint64_t first_seq);
+
+  ChangeLog(const ChangeLog &) = delete;
+  ChangeLog &operator=(const ChangeLog &) = delete;
+
+  // Keeps the change and tells every listener about it
+  // returns the sequence number of the change
+  uint64_t Append(Operations operation, const std::string &key,
+                  const std::string &value);
+
+  // Copies at most `max_changes` changes from `*from_seq` on whose keys start
+  // with `prefix` to `changes`, waiting up to `timeout` for one, and moves
+  // `*from_seq` past every change looked at, including the ones filtered out
+  // returns true if this operation succeeds, even if no change came
+  // returns false if the changes from `*from_seq` are no longer kept, or
+  // were never appended here
+  bool Read(uint64_t *from_seq, const std::string &prefix, size_t max_changes,
+            std::chrono::milliseconds timeout, std::vector<Change> *changes);
+
+  // Calls `listener` after every change from now on, while the log is
+  // locked, so it should only wake something up
+  // returns the id of the listener
+  size_t AddListener(const std::function<void()> &listener);
+
+  // Removes the listener with `id`
+  // It is not called again once this returns.
+  void RemoveListener(size_t id);
+
+  // returns the sequence number the next change gets
+  uint64_t get_next_seq();
+
+  // returns the sequence number of the oldest change kept
+  uint64_t get_first_seq();
+
+ private:
+  const size_t capacity_;
+
+  // Guards every member below
+  std::mutex mutex_;
+  // The change with sequence number `first_seq_ + i` is `changes_[i]`
+  std::deque<Change> changes_;
+  uint64_t first_seq_;
+  uint64_t next_seq_;
+  std::map<size_t, std::function<void()>> listeners_;
+  size_t next_listener_id_;
+  // Signaled when a change is appended
+  std::condition_variable appended_cv_;
+};
+
+#endif /* CHIRP_SRC_BACKEND_CHANGE_LOG_H_ */
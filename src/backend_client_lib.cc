@@ -1,6 +1,14 @@
 #include "backend_client_lib.h"
 
+#include <algorithm>
+#include <condition_variable>
+#include <cstring>
+#include <future>
+#include <iterator>
+#include <mutex>
+#include <set>
 #include <thread>
+#include <utility>
 
 #include <grpc/grpc.h>
 #include <grpcpp/channel.h>
@@ -8,12 +16,40 @@
 #include <grpcpp/create_channel.h>
 #include <grpcpp/security/credentials.h>
 
+#include "backend_list_value.h"
 #include "grpc_client_lib.h"
 #include "key_value.grpc.pb.h"
 
 namespace {
 const char *kDefaultHostname = "localhost";
 const char *kDefaultPort = "50000";
+
+// returns the host of a "host:port" endpoint
+std::string HostOf(const std::string &endpoint) {
+  return endpoint.substr(0, endpoint.rfind(':'));
+}
+
+// returns the port of a "host:port" endpoint, or the default port if there
+// is none
+std::string PortOf(const std::string &endpoint) {
+  size_t colon = endpoint.rfind(':');
+  return colon == std::string::npos ? kDefaultPort
+                                    : endpoint.substr(colon + 1);
+}
+
+// returns the key `write` writes
+const std::string &KeyOfWrite(const chirp::BatchWrite &write) {
+  switch (write.write_case()) {
+    case chirp::BatchWrite::kPut:
+      return write.put().key();
+    case chirp::BatchWrite::kDeleteKey:
+      return write.delete_key().key();
+    case chirp::BatchWrite::kListAppend:
+      return write.list_append().key();
+    default:
+      return write.list_remove().key();
+  }
+}
 }  // Anonymous namespace
 
 // Start of `BackendClient` definitions
@@ -22,19 +58,139 @@ BackendClient::BackendClient()
 
 BackendClient::BackendClient(const std::string &host)
     : GrpcClient<chirp::KeyValueStore::Stub>(host.c_str(), kDefaultPort) {}
+
+BackendClient::BackendClient(const std::string &host, const std::string &port)
+    : GrpcClient<chirp::KeyValueStore::Stub>(host.c_str(), port.c_str()) {}
+
+std::string BackendClient::PrefixEnd(const std::string &prefix) {
+  std::string end(prefix);
+  // Drop the trailing 0xff bytes, which cannot be incremented, then
+  // increment the last byte left
+  while (!end.empty() && static_cast<unsigned char>(end.back()) == 0xff) {
+    end.pop_back();
+  }
+  if (!end.empty()) {
+    end.back() = static_cast<char>(static_cast<unsigned char>(end.back()) + 1);
+  }
+  return end;
+}
+
+bool BackendClient::IsOnOneServer(const chirp::WriteBatchRequest &) const {
+  return true;
+}
 // End of `BackendClient` definitions
 
 // Start of `BackendClientStandard` definitions
+BackendClientStandard::BackendClientStandard()
+    : BackendClient(), next_snapshot_(1) {
+  AddServer(std::string(kDefaultHostname) + ":" + kDefaultPort, stub_.get());
+}
+
+BackendClientStandard::BackendClientStandard(const std::string &host)
+    : BackendClient(host), next_snapshot_(1) {
+  AddServer(host + ":" + kDefaultPort, stub_.get());
+}
+
+BackendClientStandard::BackendClientStandard(const std::string &host,
+                                             const std::string &port)
+    : BackendClient(host, port), next_snapshot_(1) {
+  AddServer(host + ":" + port, stub_.get());
+}
+
+BackendClientStandard::BackendClientStandard(
+    const std::vector<std::string> &endpoints)
+    : BackendClient(HostOf(endpoints.front()), PortOf(endpoints.front())),
+      next_snapshot_(1) {
+  AddServer(endpoints.front(), stub_.get());
+  for (size_t i = 1; i < endpoints.size(); ++i) {
+    AddServer(endpoints[i], nullptr);
+  }
+}
+
+void BackendClientStandard::AddServer(const std::string &endpoint,
+                                      chirp::KeyValueStore::Stub *stub) {
+  std::unique_ptr<Server> server(new Server());
+  if (stub == nullptr) {
+    server->owned_stub = chirp::KeyValueStore::NewStub(
+        grpc::CreateChannel(endpoint, grpc::InsecureChannelCredentials()));
+    stub = server->owned_stub.get();
+  }
+  server->stub = stub;
+  servers_.push_back(std::move(server));
+  ring_.AddNode(endpoint);
+}
+
+bool BackendClientStandard::SendToEachServer(
+    const std::vector<std::string> &keys,
+    const std::function<bool(size_t server,
+                             const std::vector<std::string> &server_keys,
+                             const std::vector<size_t> &positions)> &send) {
+  if (servers_.size() == 1) {
+    std::vector<size_t> positions(keys.size());
+    for (size_t i = 0; i < keys.size(); ++i) {
+      positions[i] = i;
+    }
+    return send(0, keys, positions);
+  }
+
+  std::vector<std::vector<std::string>> server_keys(servers_.size());
+  std::vector<std::vector<size_t>> positions(servers_.size());
+  for (size_t i = 0; i < keys.size(); ++i) {
+    size_t server = ServerOf(keys[i]);
+    server_keys[server].push_back(keys[i]);
+    positions[server].push_back(i);
+  }
+
+  std::vector<std::future<bool>> results;
+  for (size_t server = 0; server < servers_.size(); ++server) {
+    if (!server_keys[server].empty()) {
+      results.push_back(std::async(std::launch::async, [&, server]() {
+        return send(server, server_keys[server], positions[server]);
+      }));
+    }
+  }
+  bool ok = true;
+  for (auto &result : results) {
+    ok &= result.get();
+  }
+  return ok;
+}
+
+bool BackendClientStandard::SendToAllServers(
+    const std::function<bool(size_t server)> &send) {
+  if (servers_.size() == 1) {
+    return send(0);
+  }
+
+  std::vector<std::future<bool>> results;
+  for (size_t server = 0; server < servers_.size(); ++server) {
+    results.push_back(std::async(std::launch::async, send, server));
+  }
+  bool ok = true;
+  for (auto &result : results) {
+    ok &= result.get();
+  }
+  return ok;
+}
+
 bool BackendClientStandard::SendPutRequest(const std::string &key,
                                            const std::string &value) {
+  return SendPutRequest(key, value, 0);
+}
+
+bool BackendClientStandard::SendPutRequest(const std::string &key,
+                                           const std::string &value,
+                                           uint64_t ttl_ms) {
   grpc::ClientContext context;
 
   chirp::PutRequest request;
   request.set_key(key);
   request.set_value(value);
+  request.set_ttl_ms(ttl_ms);
   chirp::PutReply reply;
 
-  grpc::Status status = stub_->put(&context, request, &reply);
+  grpc::Status status = servers_[ServerOf(key)]->stub->put(&context, request,
+                                                           &reply);
 
   return status.ok();
 }
@@ -42,18 +198,57 @@ bool BackendClientStandard::SendPutRequest(const std::string &key,
 bool BackendClientStandard::SendGetRequest(
     const std::vector<std::string> &keys,
     std::vector<std::string> *reply_values) {
+  if (servers_.size() == 1) {
+    return SendGetRequestTo(NextReadStub(0), keys, reply_values);
+  }
+
+  // Every server fills in the values of its own keys
+  std::vector<std::string> values(keys.size());
+  bool ok = SendToEachServer(
+      keys, [this, &values](size_t server,
+                            const std::vector<std::string> &server_keys,
+                            const std::vector<size_t> &positions) {
+        std::vector<std::string> server_values;
+        if (!SendGetRequestTo(NextReadStub(server), server_keys,
+                              &server_values) ||
+            server_values.size() != positions.size()) {
+          return false;
+        }
+        for (size_t i = 0; i < positions.size(); ++i) {
+          values[positions[i]].swap(server_values[i]);
+        }
+        return true;
+      });
+  if (!ok) {
+    return false;
+  }
+  reply_values->insert(reply_values->end(),
+                       std::make_move_iterator(values.begin()),
+                       std::make_move_iterator(values.end()));
+  return true;
+}
+
+bool BackendClientStandard::SendGetRequestTo(
+    chirp::KeyValueStore::Stub *stub, const std::vector<std::string> &keys,
+    std::vector<std::string> *reply_values, uint64_t snapshot) {
   grpc::ClientContext context;
   std::shared_ptr<grpc::ClientReaderWriter<chirp::GetRequest, chirp::GetReply>>
-      stream(stub_->get(&context));
+      stream(stub->get(&context));
 
   // this lambda function takes `stream` and `keys` from this
   // `BackendClient::SendGetRequest` scope and takes them by reference.
   // This thread runner fills in the get requests and writes them to the
-  // `stream`.
-  std::thread writer([&stream, &keys]() {
-    for (const std::string &key : keys) {
+  // `stream`. Keys are sent in batches of at most `kMaxKeysPerGetRequest` so
+  // the server looks them up together.
+  std::thread writer([&stream, &keys, snapshot]() {
+    for (size_t begin = 0; begin < keys.size();
+         begin += kMaxKeysPerGetRequest) {
+      size_t end = std::min(keys.size(), begin + kMaxKeysPerGetRequest);
       chirp::GetRequest request;
-      request.set_key(key);
+      request.set_snapshot(snapshot);
+      for (size_t i = begin; i < end; ++i) {
+        request.add_keys(keys[i]);
+      }
       stream->Write(request);
     }
 
@@ -78,29 +273,866 @@ bool BackendClientStandard::SendDeleteKeyRequest(const std::string &key) {
   request.set_key(key);
   chirp::DeleteReply reply;
 
-  grpc::Status status = stub_->deletekey(&context, request, &reply);
+  grpc::Status status = servers_[ServerOf(key)]->stub->deletekey(
+      &context, request, &reply);
 
   return status.ok();
 }
+
+bool BackendClientStandard::SendMultiPutRequest(
+    const std::vector<std::string> &keys,
+    const std::vector<std::string> &values) {
+  if (keys.size() != values.size()) {
+    return false;
+  }
+
+  return SendToEachServer(
+      keys, [this, &values](size_t server,
+                            const std::vector<std::string> &server_keys,
+                            const std::vector<size_t> &positions) {
+        grpc::ClientContext context;
+
+        chirp::MultiPutRequest request;
+        for (size_t i = 0; i < server_keys.size(); ++i) {
+          chirp::PutRequest *pair = request.add_pairs();
+          pair->set_key(server_keys[i]);
+          pair->set_value(values[positions[i]]);
+        }
+        chirp::MultiPutReply reply;
+
+        grpc::Status status =
+            servers_[server]->stub->multiput(&context, request, &reply);
+
+        return status.ok();
+      });
+}
+
+bool BackendClientStandard::SendMultiDeleteRequest(
+    const std::vector<std::string> &keys) {
+  std::atomic<size_t> num_of_deleted(0);
+  bool ok = SendToEachServer(
+      keys, [this, &num_of_deleted](size_t server,
+                                    const std::vector<std::string> &server_keys,
+                                    const std::vector<size_t> &positions) {
+        grpc::ClientContext context;
+
+        chirp::MultiDeleteRequest request;
+        for (const std::string &key : server_keys) {
+          request.add_keys(key);
+        }
+        chirp::MultiDeleteReply reply;
+
+        grpc::Status status =
+            servers_[server]->stub->multidelete(&context, request, &reply);
+
+        num_of_deleted += reply.num_of_deleted();
+        return status.ok();
+      });
+
+  return ok && num_of_deleted == keys.size();
+}
+
+bool BackendClientStandard::SendExistsRequest(
+    const std::vector<std::string> &keys, std::vector<bool> *exists) {
+  // `std::vector<bool>` packs its elements, so the servers could not fill in
+  // theirs at the same time
+  std::vector<char> found(keys.size(), false);
+  bool ok = SendToEachServer(
+      keys, [this, &found](size_t server,
+                           const std::vector<std::string> &server_keys,
+                           const std::vector<size_t> &positions) {
+        grpc::ClientContext context;
+
+        chirp::ExistsRequest request;
+        for (const std::string &key : server_keys) {
+          request.add_keys(key);
+        }
+        chirp::ExistsReply reply;
+
+        grpc::Status status =
+            NextReadStub(server)->exists(&context, request, &reply);
+
+        if (!status.ok() ||
+            reply.exists_size() != static_cast<int>(positions.size())) {
+          return false;
+        }
+        for (size_t i = 0; i < positions.size(); ++i) {
+          found[positions[i]] = reply.exists(i);
+        }
+        return true;
+      });
+
+  if (!ok) {
+    return false;
+  }
+  exists->insert(exists->end(), found.begin(), found.end());
+  return true;
+}
+
+bool BackendClientStandard::SendFetchAddRequest(const std::string &key,
+                                                uint64_t delta,
+                                                uint64_t *previous) {
+  grpc::ClientContext context;
+
+  chirp::FetchAddRequest request;
+  request.set_key(key);
+  request.set_delta(delta);
+  chirp::FetchAddReply reply;
+
+  grpc::Status status = servers_[ServerOf(key)]->stub->fetch_add(
+      &context, request, &reply);
+
+  if (status.ok() && previous != nullptr) {
+    *previous = reply.previous();
+  }
+  return status.ok();
+}
+
+bool BackendClientStandard::SendCompareAndSwapRequest(
+    const std::string &key, const std::string &expected,
+    const std::string &desired, std::string *actual) {
+  grpc::ClientContext context;
+
+  chirp::CompareAndSwapRequest request;
+  request.set_key(key);
+  request.set_expected(expected);
+  request.set_desired(desired);
+  chirp::CompareAndSwapReply reply;
+
+  grpc::Status status = servers_[ServerOf(key)]->stub->compare_and_swap(
+      &context, request, &reply);
+
+  if (status.ok() && !reply.swapped() && actual != nullptr) {
+    actual->swap(*reply.mutable_actual());
+  }
+  return status.ok() && reply.swapped();
+}
+
+bool BackendClientStandard::SendWriteBatchRequest(
+    const chirp::WriteBatchRequest &batch, bool *applied,
+    size_t *failed_condition) {
+  // The conditions on one server cannot hold back the writes on another, so
+  // a batch with conditions is refused unless all its keys are on one server
+  if (batch.conditions_size() > 0 && !IsOnOneServer(batch)) {
+    return false;
+  }
+  bool split = servers_.size() > 1;
+
+  // The part of the batch of every server, and the positions of its
+  // conditions in `batch`, unless there is only one server
+  std::vector<chirp::WriteBatchRequest> parts(servers_.size());
+  std::vector<std::vector<size_t>> positions(servers_.size());
+  std::vector<char> has_part(servers_.size(), !split);
+  for (int i = 0; split && i < batch.conditions_size(); ++i) {
+    size_t server = ServerOf(batch.conditions(i).key());
+    *parts[server].add_conditions() = batch.conditions(i);
+    positions[server].push_back(i);
+    has_part[server] = 1;
+  }
+  for (int i = 0; split && i < batch.writes_size(); ++i) {
+    size_t server = ServerOf(KeyOfWrite(batch.writes(i)));
+    *parts[server].add_writes() = batch.writes(i);
+    has_part[server] = 1;
+  }
+
+  std::vector<chirp::WriteBatchReply> replies(servers_.size());
+  bool ok = SendToAllServers([&](size_t server) {
+    if (!has_part[server]) {
+      replies[server].set_applied(true);
+      return true;
+    }
+
+    grpc::ClientContext context;
+    grpc::Status status = servers_[server]->stub->write_batch(
+        &context, split ? parts[server] : batch, &replies[server]);
+    return status.ok();
+  });
+  if (!ok) {
+    return false;
+  }
+
+  *applied = true;
+  size_t first_failed = batch.conditions_size();
+  for (size_t server = 0; server < servers_.size(); ++server) {
+    if (!replies[server].applied()) {
+      size_t failed = replies[server].failed_condition();
+      *applied = false;
+      first_failed =
+          std::min(first_failed, split ? positions[server][failed] : failed);
+    }
+  }
+  if (!*applied && failed_condition != nullptr) {
+    *failed_condition = first_failed;
+  }
+  return true;
+}
+
+bool BackendClientStandard::IsOnOneServer(
+    const chirp::WriteBatchRequest &batch) const {
+  if (servers_.size() == 1) {
+    return true;
+  }
+
+  std::set<size_t> servers;
+  for (const auto &condition : batch.conditions()) {
+    servers.insert(ServerOf(condition.key()));
+  }
+  for (const auto &write : batch.writes()) {
+    servers.insert(ServerOf(KeyOfWrite(write)));
+  }
+  return servers.size() <= 1;
+}
+
+bool BackendClientStandard::SendScanRequest(
+    const std::string &start, const std::string &end, uint64_t limit,
+    std::vector<std::pair<std::string, std::string>> *pairs) {
+  chirp::ScanRequest request;
+  request.set_start(start);
+  request.set_end(end);
+  request.set_limit(limit);
+
+  // Every server has some of the keys of the range, so each is scanned with
+  // the whole limit, in parallel, and the sorted results are merged
+  std::vector<std::vector<std::pair<std::string, std::string>>> server_pairs(
+      servers_.size());
+  auto scan = [this, &request, &server_pairs](size_t server) {
+    grpc::ClientContext context;
+    std::unique_ptr<grpc::ClientReader<chirp::ScanReply>> reader(
+        NextReadStub(server)->scan(&context, request));
+    chirp::ScanReply reply;
+    while (reader->Read(&reply)) {
+      for (chirp::PutRequest &pair : *reply.mutable_pairs()) {
+        server_pairs[server].emplace_back(std::move(*pair.mutable_key()),
+                                          std::move(*pair.mutable_value()));
+      }
+    }
+
+    grpc::Status status = reader->Finish();
+
+    return status.ok();
+  };
+
+  bool ok = true;
+  if (servers_.size() == 1) {
+    ok = scan(0);
+  } else {
+    std::vector<std::future<bool>> results;
+    for (size_t server = 0; server < servers_.size(); ++server) {
+      results.push_back(std::async(std::launch::async, scan, server));
+    }
+    for (auto &result : results) {
+      ok &= result.get();
+    }
+  }
+  if (!ok) {
+    return false;
+  }
+
+  std::vector<std::pair<std::string, std::string>> merged;
+  for (auto &one_server : server_pairs) {
+    size_t middle = merged.size();
+    merged.insert(merged.end(), std::make_move_iterator(one_server.begin()),
+                  std::make_move_iterator(one_server.end()));
+    std::inplace_merge(merged.begin(), merged.begin() + middle, merged.end());
+  }
+  if (limit > 0 && merged.size() > limit) {
+    merged.resize(limit);
+  }
+  pairs->insert(pairs->end(), std::make_move_iterator(merged.begin()),
+                std::make_move_iterator(merged.end()));
+  return true;
+}
+
+bool BackendClientStandard::SendCreateSnapshotRequest(uint64_t lease_ms,
+                                                      uint64_t *snapshot) {
+  std::vector<uint64_t> handles(servers_.size(), 0);
+  bool ok = SendToAllServers([this, lease_ms, &handles](size_t server) {
+    grpc::ClientContext context;
+
+    chirp::CreateSnapshotRequest request;
+    request.set_lease_ms(lease_ms);
+    chirp::CreateSnapshotReply reply;
+
+    grpc::Status status =
+        servers_[server]->stub->create_snapshot(&context, request, &reply);
+
+    if (status.ok()) {
+      handles[server] = reply.snapshot();
+    }
+    return status.ok();
+  });
+
+  if (!ok) {
+    // The snapshots that were opened are left to their leases
+    return false;
+  }
+
+  std::lock_guard<std::mutex> guard(snapshots_mutex_);
+  *snapshot = next_snapshot_++;
+  snapshots_.emplace(*snapshot, std::move(handles));
+  return true;
+}
+
+bool BackendClientStandard::SendReleaseSnapshotRequest(uint64_t snapshot) {
+  std::vector<uint64_t> handles;
+  {
+    std::lock_guard<std::mutex> guard(snapshots_mutex_);
+    auto it = snapshots_.find(snapshot);
+    if (it == snapshots_.end()) {
+      return false;
+    }
+    handles.swap(it->second);
+    snapshots_.erase(it);
+  }
+
+  return SendToAllServers([this, &handles](size_t server) {
+    grpc::ClientContext context;
+
+    chirp::ReleaseSnapshotRequest request;
+    request.set_snapshot(handles[server]);
+    chirp::ReleaseSnapshotReply reply;
+
+    grpc::Status status =
+        servers_[server]->stub->release_snapshot(&context, request, &reply);
+
+    return status.ok();
+  });
+}
+
+bool BackendClientStandard::SendGetAtSnapshotRequest(
+    uint64_t snapshot, const std::vector<std::string> &keys,
+    std::vector<std::string> *reply_values) {
+  std::vector<uint64_t> handles;
+  {
+    std::lock_guard<std::mutex> guard(snapshots_mutex_);
+    auto it = snapshots_.find(snapshot);
+    if (it == snapshots_.end()) {
+      return false;
+    }
+    handles = it->second;
+  }
+
+  if (servers_.size() == 1) {
+    return SendGetRequestTo(servers_[0]->stub, keys, reply_values,
+                            handles[0]);
+  }
+
+  std::vector<std::string> values(keys.size());
+  bool ok = SendToEachServer(
+      keys, [this, &values, &handles](
+                size_t server, const std::vector<std::string> &server_keys,
+                const std::vector<size_t> &positions) {
+        std::vector<std::string> server_values;
+        if (!SendGetRequestTo(servers_[server]->stub, server_keys,
+                              &server_values, handles[server]) ||
+            server_values.size() != positions.size()) {
+          return false;
+        }
+        for (size_t i = 0; i < positions.size(); ++i) {
+          values[positions[i]].swap(server_values[i]);
+        }
+        return true;
+      });
+  if (!ok) {
+    return false;
+  }
+  reply_values->insert(reply_values->end(),
+                       std::make_move_iterator(values.begin()),
+                       std::make_move_iterator(values.end()));
+  return true;
+}
+
+bool BackendClientStandard::SendWatchRequest(
+    const std::vector<std::string> &prefixes, bool with_values,
+    std::chrono::milliseconds tick,
+    const std::function<bool(const std::vector<WatchEvent> &events,
+                             bool overflowed)> &on_events) {
+  chirp::WatchRequest request;
+  for (const auto &prefix : prefixes) {
+    request.add_prefixes(prefix);
+  }
+  request.set_with_values(with_values);
+
+  // One thread per server reads its stream into `events`, which this thread
+  // hands to `on_events`
+  std::mutex mutex;
+  std::condition_variable cv;
+  std::vector<WatchEvent> events;
+  bool overflowed = false;
+  size_t num_of_watching = 0;
+  bool ended = false;
+
+  std::vector<std::unique_ptr<grpc::ClientContext>> contexts;
+  std::vector<std::thread> readers;
+  for (size_t server = 0; server < servers_.size(); ++server) {
+    contexts.emplace_back(new grpc::ClientContext());
+    grpc::ClientContext *context = contexts.back().get();
+    chirp::KeyValueStore::Stub *stub = servers_[server]->stub;
+    readers.emplace_back([&, context, stub]() {
+      std::unique_ptr<grpc::ClientReader<chirp::WatchReply>> reader(
+          stub->watch(context, request));
+      chirp::WatchReply reply;
+      bool first = true;
+      while (reader->Read(&reply)) {
+        std::lock_guard<std::mutex> guard(mutex);
+        if (first) {
+          ++num_of_watching;
+          first = false;
+        }
+        for (chirp::WatchEvent &event : *reply.mutable_events()) {
+          events.push_back(WatchEvent{std::move(*event.mutable_key()),
+                                      event.deleted(),
+                                      std::move(*event.mutable_value())});
+        }
+        overflowed |= reply.overflowed();
+        cv.notify_all();
+      }
+      reader->Finish();
+
+      std::lock_guard<std::mutex> guard(mutex);
+      ended = true;
+      cv.notify_all();
+    });
+  }
+
+  bool ok = true;
+  {
+    std::unique_lock<std::mutex> lock(mutex);
+    cv.wait(lock, [&]() {
+      return num_of_watching == servers_.size() || ended;
+    });
+    bool first = true;
+    while (true) {
+      if (!first) {
+        cv.wait_for(lock, tick,
+                    [&]() { return !events.empty() || overflowed || ended; });
+      }
+      first = false;
+      // A stream only ends if its server fails or shuts down
+      if (ended) {
+        ok = false;
+        break;
+      }
+
+      std::vector<WatchEvent> taken;
+      taken.swap(events);
+      bool taken_overflowed = overflowed;
+      overflowed = false;
+      lock.unlock();
+      bool go_on = on_events(taken, taken_overflowed);
+      lock.lock();
+      if (!go_on) {
+        break;
+      }
+    }
+  }
+
+  for (auto &context : contexts) {
+    context->TryCancel();
+  }
+  for (auto &reader : readers) {
+    reader.join();
+  }
+  return ok;
+}
+
+void BackendClientStandard::AddReadReplica(const std::string &host,
+                                           const std::string &port,
+                                           size_t server) {
+  servers_[server]->read_replicas.emplace_back(
+      chirp::KeyValueStore::NewStub(grpc::CreateChannel(
+          host + ":" + port, grpc::InsecureChannelCredentials())));
+}
+
+chirp::KeyValueStore::Stub *BackendClientStandard::NextReadStub(
+    size_t server) {
+  Server &owner = *servers_[server];
+  if (owner.read_replicas.empty()) {
+    return owner.stub;
+  }
+  size_t i = owner.next_read.fetch_add(1, std::memory_order_relaxed) %
+             (owner.read_replicas.size() + 1);
+  return i == 0 ? owner.stub : owner.read_replicas[i - 1].get();
+}
+
+bool BackendClientStandard::SendListAppendRequest(const std::string &key,
+                                                  uint32_t field,
+                                                  uint64_t element,
+                                                  bool if_absent,
+                                                  bool if_exists,
+                                                  bool *changed) {
+  chirp::ListElementRequest request;
+  request.set_key(key);
+  request.set_field(field);
+  request.set_uint64_element(element);
+  request.set_if_absent(if_absent);
+  request.set_if_exists(if_exists);
+  return SendListElementRequest(request, true, changed);
+}
+
+bool BackendClientStandard::SendListAppendRequest(const std::string &key,
+                                                  uint32_t field,
+                                                  const std::string &element,
+                                                  bool if_absent,
+                                                  bool if_exists,
+                                                  bool *changed) {
+  chirp::ListElementRequest request;
+  request.set_key(key);
+  request.set_field(field);
+  request.set_string_element(element);
+  request.set_if_absent(if_absent);
+  request.set_if_exists(if_exists);
+  return SendListElementRequest(request, true, changed);
+}
+
+bool BackendClientStandard::SendListRemoveRequest(const std::string &key,
+                                                  uint32_t field,
+                                                  uint64_t element,
+                                                  bool *changed) {
+  chirp::ListElementRequest request;
+  request.set_key(key);
+  request.set_field(field);
+  request.set_uint64_element(element);
+  return SendListElementRequest(request, false, changed);
+}
+
+bool BackendClientStandard::SendListRemoveRequest(const std::string &key,
+                                                  uint32_t field,
+                                                  const std::string &element,
+                                                  bool *changed) {
+  chirp::ListElementRequest request;
+  request.set_key(key);
+  request.set_field(field);
+  request.set_string_element(element);
+  return SendListElementRequest(request, false, changed);
+}
+
+bool BackendClientStandard::SendListElementRequest(
+    const chirp::ListElementRequest &request, bool append, bool *changed) {
+  grpc::ClientContext context;
+  chirp::ListElementReply reply;
+  chirp::KeyValueStore::Stub *stub = servers_[ServerOf(request.key())]->stub;
+
+  grpc::Status status =
+      append ? stub->list_append(&context, request, &reply)
+             : stub->list_remove(&context, request, &reply);
+
+  if (status.ok() && changed != nullptr) {
+    *changed = reply.changed();
+  }
+  return status.ok();
+}
 // End of `BackendClientStandard` definitions
 
 // Start of `BackendClientDebug` definitions
 bool BackendClientDebug::SendPutRequest(const std::string &key,
                                         const std::string &value) {
+  return SendPutRequest(key, value, 0);
+}
+
+bool BackendClientDebug::SendPutRequest(const std::string &key,
+                                        const std::string &value,
+                                        uint64_t ttl_ms) {
   key_value_[key] = value;
+  if (ttl_ms > 0) {
+    deadlines_[key] =
+        std::chrono::steady_clock::now() + std::chrono::milliseconds(ttl_ms);
+  } else {
+    deadlines_.erase(key);
+  }
   return true;
 }
 
 bool BackendClientDebug::SendGetRequest(
     const std::vector<std::string> &keys,
     std::vector<std::string> *reply_values) {
+  ExpireKeys();
   for (const auto &key : keys) {
-    reply_values->push_back(key_value_[key]);
+    auto it = key_value_.find(key);
+    reply_values->push_back(it == key_value_.end() ? "" : it->second);
   }
   return true;
 }
 
 bool BackendClientDebug::SendDeleteKeyRequest(const std::string &key) {
+  ExpireKeys();
+  deadlines_.erase(key);
   return key_value_.erase(key);
 }
+
+bool BackendClientDebug::SendMultiPutRequest(
+    const std::vector<std::string> &keys,
+    const std::vector<std::string> &values) {
+  if (keys.size() != values.size()) {
+    return false;
+  }
+
+  for (size_t i = 0; i < keys.size(); ++i) {
+    key_value_[keys[i]] = values[i];
+    deadlines_.erase(keys[i]);
+  }
+  return true;
+}
+
+bool BackendClientDebug::SendMultiDeleteRequest(
+    const std::vector<std::string> &keys) {
+  ExpireKeys();
+  size_t num_of_deleted = 0;
+  for (const auto &key : keys) {
+    deadlines_.erase(key);
+    num_of_deleted += key_value_.erase(key);
+  }
+  return num_of_deleted == keys.size();
+}
+
+bool BackendClientDebug::SendExistsRequest(
+    const std::vector<std::string> &keys, std::vector<bool> *exists) {
+  ExpireKeys();
+  for (const auto &key : keys) {
+    exists->push_back(key_value_.count(key) > 0);
+  }
+  return true;
+}
+
+bool BackendClientDebug::SendCreateSnapshotRequest(uint64_t lease_ms,
+                                                   uint64_t *snapshot) {
+  ExpireKeys();
+  uint64_t handle = snapshots_.empty() ? 1 : snapshots_.rbegin()->first + 1;
+  snapshots_.emplace(handle, key_value_);
+  *snapshot = handle;
+  return true;
+}
+
+bool BackendClientDebug::SendReleaseSnapshotRequest(uint64_t snapshot) {
+  return snapshots_.erase(snapshot) > 0;
+}
+
+bool BackendClientDebug::SendGetAtSnapshotRequest(
+    uint64_t snapshot, const std::vector<std::string> &keys,
+    std::vector<std::string> *reply_values) {
+  auto snapshot_it = snapshots_.find(snapshot);
+  if (snapshot_it == snapshots_.end()) {
+    return false;
+  }
+  for (const auto &key : keys) {
+    auto it = snapshot_it->second.find(key);
+    reply_values->push_back(it == snapshot_it->second.end() ? "" : it->second);
+  }
+  return true;
+}
+
+bool BackendClientDebug::SendWatchRequest(
+    const std::vector<std::string> &prefixes, bool with_values,
+    std::chrono::milliseconds tick,
+    const std::function<bool(const std::vector<WatchEvent> &events,
+                             bool overflowed)> &on_events) {
+  return false;
+}
+
+bool BackendClientDebug::SendFetchAddRequest(const std::string &key,
+                                             uint64_t delta,
+                                             uint64_t *previous) {
+  ExpireKeys();
+  std::string &value = key_value_[key];
+  uint64_t counter = 0;
+  if (value.size() == sizeof(counter)) {
+    std::memcpy(&counter, value.data(), sizeof(counter));
+  } else if (!value.empty()) {
+    return false;
+  }
+
+  if (previous != nullptr) {
+    *previous = counter;
+  }
+  counter += delta;
+  value.assign(reinterpret_cast<const char *>(&counter), sizeof(counter));
+  return true;
+}
+
+bool BackendClientDebug::SendWriteBatchRequest(
+    const chirp::WriteBatchRequest &batch, bool *applied,
+    size_t *failed_condition) {
+  ExpireKeys();
+  *applied = false;
+  for (int i = 0; i < batch.conditions_size(); ++i) {
+    const chirp::BatchCondition &condition = batch.conditions(i);
+    auto it = key_value_.find(condition.key());
+    bool holds = condition.exists()
+                     ? it != key_value_.end()
+                     : (it == key_value_.end() ? "" : it->second) ==
+                           condition.expected();
+    if (!holds) {
+      if (failed_condition != nullptr) {
+        *failed_condition = i;
+      }
+      return true;
+    }
+  }
+
+  // The writes go to a copy, so that a list write that fails leaves nothing
+  // half done
+  std::map<std::string, std::string> key_value(key_value_);
+  for (const auto &write : batch.writes()) {
+    bool ok = true, modified;
+    switch (write.write_case()) {
+      case chirp::BatchWrite::kPut:
+        key_value[write.put().key()] = write.put().value();
+        break;
+      case chirp::BatchWrite::kDeleteKey:
+        key_value.erase(write.delete_key().key());
+        break;
+      case chirp::BatchWrite::kListAppend: {
+        const chirp::ListElementRequest &list = write.list_append();
+        std::string *value = &key_value[list.key()];
+        ok = list.element_case() == chirp::ListElementRequest::kUint64Element
+                 ? ListValue::Append(value, list.field(),
+                                     list.uint64_element(), list.if_absent(),
+                                     &modified)
+                 : ListValue::Append(value, list.field(),
+                                     list.string_element(), list.if_absent(),
+                                     &modified);
+        break;
+      }
+      case chirp::BatchWrite::kListRemove: {
+        const chirp::ListElementRequest &list = write.list_remove();
+        auto it = key_value.find(list.key());
+        if (it == key_value.end()) {
+          break;
+        }
+        ok = list.element_case() == chirp::ListElementRequest::kUint64Element
+                 ? ListValue::Remove(&it->second, list.field(),
+                                     list.uint64_element(), &modified)
+                 : ListValue::Remove(&it->second, list.field(),
+                                     list.string_element(), &modified);
+        break;
+      }
+      default:
+        ok = false;
+    }
+    if (!ok) {
+      return false;
+    }
+  }
+
+  key_value_.swap(key_value);
+  for (const auto &write : batch.writes()) {
+    if (write.has_put()) {
+      deadlines_.erase(write.put().key());
+    } else if (write.has_delete_key()) {
+      deadlines_.erase(write.delete_key().key());
+    }
+  }
+  *applied = true;
+  return true;
+}
+
+bool BackendClientDebug::SendScanRequest(
+    const std::string &start, const std::string &end, uint64_t limit,
+    std::vector<std::pair<std::string, std::string>> *pairs) {
+  ExpireKeys();
+  uint64_t count = 0;
+  for (auto it = key_value_.lower_bound(start);
+       it != key_value_.end() && (end.empty() || it->first < end) &&
+       (limit == 0 || count < limit);
+       ++it, ++count) {
+    pairs->push_back(*it);
+  }
+  return true;
+}
+
+bool BackendClientDebug::SendCompareAndSwapRequest(const std::string &key,
+                                                   const std::string &expected,
+                                                   const std::string &desired,
+                                                   std::string *actual) {
+  ExpireKeys();
+  auto it = key_value_.find(key);
+  const std::string value = it == key_value_.end() ? "" : it->second;
+  if (value != expected) {
+    if (actual != nullptr) {
+      *actual = value;
+    }
+    return false;
+  }
+
+  key_value_[key] = desired;
+  return true;
+}
+
+bool BackendClientDebug::SendListAppendRequest(const std::string &key,
+                                               uint32_t field,
+                                               uint64_t element,
+                                               bool if_absent, bool if_exists,
+                                               bool *changed) {
+  ExpireKeys();
+  if (if_exists && key_value_.find(key) == key_value_.end()) {
+    return false;
+  }
+  bool modified;
+  bool ok = ListValue::Append(&key_value_[key], field, element, if_absent,
+                              &modified);
+  if (ok && changed != nullptr) {
+    *changed = modified;
+  }
+  return ok;
+}
+
+bool BackendClientDebug::SendListAppendRequest(const std::string &key,
+                                               uint32_t field,
+                                               const std::string &element,
+                                               bool if_absent, bool if_exists,
+                                               bool *changed) {
+  ExpireKeys();
+  if (if_exists && key_value_.find(key) == key_value_.end()) {
+    return false;
+  }
+  bool modified;
+  bool ok = ListValue::Append(&key_value_[key], field, element, if_absent,
+                              &modified);
+  if (ok && changed != nullptr) {
+    *changed = modified;
+  }
+  return ok;
+}
+
+bool BackendClientDebug::SendListRemoveRequest(const std::string &key,
+                                               uint32_t field,
+                                               uint64_t element,
+                                               bool *changed) {
+  ExpireKeys();
+  bool modified = false;
+  auto it = key_value_.find(key);
+  bool ok = it == key_value_.end() ||
+            ListValue::Remove(&it->second, field, element, &modified);
+  if (ok && changed != nullptr) {
+    *changed = modified;
+  }
+  return ok;
+}
+
+bool BackendClientDebug::SendListRemoveRequest(const std::string &key,
+                                               uint32_t field,
+                                               const std::string &element,
+                                               bool *changed) {
+  ExpireKeys();
+  bool modified = false;
+  auto it = key_value_.find(key);
+  bool ok = it == key_value_.end() ||
+            ListValue::Remove(&it->second, field, element, &modified);
+  if (ok && changed != nullptr) {
+    *changed = modified;
+  }
+  return ok;
+}
+
+void BackendClientDebug::ExpireKeys() {
+  auto now = std::chrono::steady_clock::now();
+  for (auto it = deadlines_.begin(); it != deadlines_.end();) {
+    if (it->second <= now) {
+      key_value_.erase(it->first);
+      it = deadlines_.erase(it);
+    } else {
+      ++it;
+    }
+  }
+}
 // End of `BackendClientDebug` definitions
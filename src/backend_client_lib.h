@@ -1,21 +1,43 @@
 #ifndef CHIRP_SRC_BACKEND_CLIENT_LIB_H_
 #define CHIRP_SRC_BACKEND_CLIENT_LIB_H_
 
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
 #include <map>
 #include <memory>
+#include <mutex>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include <grpcpp/channel.h>
 
+#include "consistent_hash_ring.h"
 #include "grpc_client_lib.h"
 #include "key_value.grpc.pb.h"
 
 // This is an abstract class for backend clients.
-// Those who are going to inherit this should implement the three interfaces
-// which are `SendPutRequest`, `SendGetRequest`, and `SendDeleteKeyRequest`
+// Those who are going to inherit this should implement the interfaces
+// which are `SendPutRequest`, `SendGetRequest`, `SendDeleteKeyRequest`,
+// `SendMultiPutRequest`, `SendMultiDeleteRequest`, `SendFetchAddRequest`,
+// `SendCompareAndSwapRequest`, `SendWriteBatchRequest`, `SendScanRequest`,
+// `SendListAppendRequest`,
+// `SendListRemoveRequest`, `SendExistsRequest`,
+// `SendCreateSnapshotRequest`, `SendReleaseSnapshotRequest`,
+// `SendGetAtSnapshotRequest`, and `SendWatchRequest`
 class BackendClient : public GrpcClient<chirp::KeyValueStore::Stub> {
  public:
+  // A write of a watched key
+  struct WatchEvent {
+    std::string key;
+    bool deleted;
+    // Empty for a delete, or if the values are not asked for
+    std::string value;
+  };
+
   // Constructor that doesn't take any argument
   // hostname will be "localhost" and port number will be "50000"
   BackendClient();
@@ -24,12 +46,21 @@ class BackendClient : public GrpcClient<chirp::KeyValueStore::Stub> {
   // hostname is specified in the argument and port number will be "50000"
   BackendClient(const std::string &host);
 
+  // Constructor that takes two arguments which are hostname and port number
+  BackendClient(const std::string &host, const std::string &port);
+
   // Send a put request to the server
   // returns true if this operation succeeds
   // returns false otherwise
   virtual bool SendPutRequest(const std::string &key,
                               const std::string &value) = 0;
 
+  // Same as above, but the pair expires `ttl_ms` milliseconds from now if
+  // `ttl_ms` is greater than 0. Otherwise it never expires, even if it had a
+  // deadline.
+  virtual bool SendPutRequest(const std::string &key, const std::string &value,
+                              uint64_t ttl_ms) = 0;
+
   // Send a get request to the server
   // This member function will change the vector that `reply_values` points to.
   // It will not change anything if `reply_values` is nullptr
@@ -42,31 +73,369 @@ class BackendClient : public GrpcClient<chirp::KeyValueStore::Stub> {
   // returns true if this operation succeeds
   // returns false otherwise
   virtual bool SendDeleteKeyRequest(const std::string &key) = 0;
+
+  // Send one request putting every `keys[i]` to `values[i]`
+  // returns true if this operation succeeds
+  // returns false otherwise
+  virtual bool SendMultiPutRequest(const std::vector<std::string> &keys,
+                                   const std::vector<std::string> &values) = 0;
+
+  // Send one request deleting every key in `keys`
+  // Keys that are not found do not stop the others from being deleted.
+  // returns true if every key is found and deleted
+  // returns false otherwise
+  virtual bool SendMultiDeleteRequest(const std::vector<std::string> &keys) = 0;
+
+  // Send a request adding `delta` to the counter at `key` on the server
+  // The value before the addition is stored in `previous`.
+  // returns true if this operation succeeds
+  // returns false otherwise, e.g. if the value is not a counter
+  virtual bool SendFetchAddRequest(const std::string &key, uint64_t delta,
+                                   uint64_t *previous) = 0;
+
+  // Send a request replacing the value of `key` with `desired` if it is
+  // `expected`. A missing key is the same as an empty value.
+  // If it is not swapped, the current value is stored in `actual` unless
+  // `actual` is nullptr.
+  // returns true if the value is swapped
+  // returns false otherwise
+  virtual bool SendCompareAndSwapRequest(const std::string &key,
+                                         const std::string &expected,
+                                         const std::string &desired,
+                                         std::string *actual) = 0;
+
+  // Send a request applying the writes of `batch` in order, all together,
+  // if every condition of it holds
+  // `applied` tells whether the writes are applied. Otherwise the index of
+  // the first condition that does not hold is stored in `failed_condition`
+  // unless it is nullptr.
+  // returns true if this operation succeeds, even if a condition does not
+  // hold
+  // returns false otherwise, e.g. if a list write finds a value that is not
+  // a protobuf message, in which case nothing is written
+  virtual bool SendWriteBatchRequest(const chirp::WriteBatchRequest &batch,
+                                     bool *applied,
+                                     size_t *failed_condition) = 0;
+
+  // Send a request for the pairs whose keys are in [`start`, `end`)
+  // An empty `end` means there is no upper bound, and a `limit` of 0 means
+  // there is no limit. The pairs are appended to `pairs` in ascending key
+  // order.
+  // returns true if this operation succeeds
+  // returns false otherwise
+  virtual bool SendScanRequest(
+      const std::string &start, const std::string &end, uint64_t limit,
+      std::vector<std::pair<std::string, std::string>> *pairs) = 0;
+
+  // Send a request appending `element` to the uint64 list `field` of the
+  // protobuf message stored at `key` (see `ListValue`). If `if_absent` is
+  // true, nothing is appended when the list already has `element`. If
+  // `if_exists` is true, a missing `key` is left missing and the request
+  // fails, so that a deleted object does not come back as an empty list.
+  // `changed` tells whether the value is modified unless it is nullptr.
+  // returns true if this operation succeeds
+  // returns false otherwise
+  virtual bool SendListAppendRequest(const std::string &key, uint32_t field,
+                                     uint64_t element, bool if_absent,
+                                     bool if_exists, bool *changed) = 0;
+
+  // Same as above for a string list
+  virtual bool SendListAppendRequest(const std::string &key, uint32_t field,
+                                     const std::string &element,
+                                     bool if_absent, bool if_exists,
+                                     bool *changed) = 0;
+
+  // Send a request removing every `element` from the uint64 list `field` of
+  // the protobuf message stored at `key`
+  // `changed` tells whether the value is modified unless it is nullptr.
+  // returns true if this operation succeeds
+  // returns false otherwise
+  virtual bool SendListRemoveRequest(const std::string &key, uint32_t field,
+                                     uint64_t element, bool *changed) = 0;
+
+  // Same as above for a string list
+  virtual bool SendListRemoveRequest(const std::string &key, uint32_t field,
+                                     const std::string &element,
+                                     bool *changed) = 0;
+
+  // Send one request checking which of `keys` exist
+  // One entry per key is appended to `exists`, in the same order as `keys`.
+  // This is cheaper than a get request, since no value is sent back and
+  // most missing keys are answered by a filter on the server.
+  // returns true if this operation succeeds
+  // returns false otherwise
+  virtual bool SendExistsRequest(const std::vector<std::string> &keys,
+                                 std::vector<bool> *exists) = 0;
+
+  // Send a request opening a snapshot of every key as it is now
+  // `snapshot` is set to its handle. The snapshot is released by the server
+  // once its lease of `lease_ms` milliseconds runs out, or after the
+  // server's default lease if `lease_ms` is 0.
+  // returns true if this operation succeeds
+  // returns false otherwise
+  virtual bool SendCreateSnapshotRequest(uint64_t lease_ms,
+                                         uint64_t *snapshot) = 0;
+
+  // Send a request releasing `snapshot`
+  // returns true if this operation succeeds
+  // returns false otherwise
+  virtual bool SendReleaseSnapshotRequest(uint64_t snapshot) = 0;
+
+  // Send a get request reading `keys` as they were at `snapshot`
+  // The values are appended to `reply_values` like `SendGetRequest`.
+  // returns true if this operation succeeds
+  // returns false otherwise, including when the snapshot is released or its
+  // lease has run out
+  virtual bool SendGetAtSnapshotRequest(
+      uint64_t snapshot, const std::vector<std::string> &keys,
+      std::vector<std::string> *reply_values) = 0;
+
+  // Send a watch request for the keys starting with any of `prefixes`, and
+  // call `on_events` in this thread until it returns false
+  // `on_events` is first called with no events once the prefixes are
+  // watched, so that every write from then on is reported. Then it is called
+  // with the writes as they are applied, and with no events every `tick`
+  // that passes without any. `overflowed` is true if some writes were
+  // dropped since they were not read in time.
+  // returns true if `on_events` ends the watch
+  // returns false otherwise, e.g. if the server cannot be reached
+  virtual bool SendWatchRequest(
+      const std::vector<std::string> &prefixes, bool with_values,
+      std::chrono::milliseconds tick,
+      const std::function<bool(const std::vector<WatchEvent> &events,
+                               bool overflowed)> &on_events) = 0;
+
+  // returns true if every key `batch` checks or writes is on one server, so
+  // that its conditions hold back all its writes
+  // returns false otherwise
+  virtual bool IsOnOneServer(const chirp::WriteBatchRequest &batch) const;
+
+  // returns the smallest key greater than every key starting with `prefix`,
+  // to be used as the end of a scan over the prefix
+  // returns an empty string if there is none, i.e. the scan has no upper
+  // bound
+  static std::string PrefixEnd(const std::string &prefix);
 };
 
 // This is the standard version of backend client
 // which will complete the requests through grpc
+// The keys may be spread over several backend servers, which are picked by
+// consistent hashing. Requests on several keys are split by server and sent
+// to the servers in parallel.
 class BackendClientStandard : public BackendClient {
  public:
+  // The maximum number of keys sent in one `GetRequest`
+  static const int kMaxKeysPerGetRequest = 128;
+
+  // Constructors that take one server, the same as `BackendClient`'s
+  BackendClientStandard();
+  BackendClientStandard(const std::string &host);
+  BackendClientStandard(const std::string &host, const std::string &port);
+
+  // Constructor that takes the "host:port" of every server
+  // Adding a server to N servers moves about 1/(N+1) of the keys, all to the
+  // new server. Clients that take the same servers in any order agree on
+  // where every key is. `endpoints` should not be empty.
+  explicit BackendClientStandard(const std::vector<std::string> &endpoints);
+
   bool SendPutRequest(const std::string &key,
                       const std::string &value) override;
+  bool SendPutRequest(const std::string &key, const std::string &value,
+                      uint64_t ttl_ms) override;
   bool SendGetRequest(const std::vector<std::string> &keys,
                       std::vector<std::string> *reply_values) override;
   bool SendDeleteKeyRequest(const std::string &key) override;
+  // Each server applies its own keys atomically, but not all servers at once
+  bool SendMultiPutRequest(const std::vector<std::string> &keys,
+                           const std::vector<std::string> &values) override;
+  bool SendMultiDeleteRequest(const std::vector<std::string> &keys) override;
+  bool SendFetchAddRequest(const std::string &key, uint64_t delta,
+                           uint64_t *previous) override;
+  bool SendCompareAndSwapRequest(const std::string &key,
+                                 const std::string &expected,
+                                 const std::string &desired,
+                                 std::string *actual) override;
+  // A batch is atomic if all its keys are on one server. A batch without
+  // conditions whose keys are on several servers is split by server like
+  // `SendMultiPutRequest`: each server applies its own writes atomically,
+  // whatever the others do.
+  // returns false without writing anything if the batch has conditions and
+  // its keys are on several servers
+  bool SendWriteBatchRequest(const chirp::WriteBatchRequest &batch,
+                             bool *applied, size_t *failed_condition) override;
+  bool IsOnOneServer(const chirp::WriteBatchRequest &batch) const override;
+  bool SendScanRequest(
+      const std::string &start, const std::string &end, uint64_t limit,
+      std::vector<std::pair<std::string, std::string>> *pairs) override;
+  bool SendListAppendRequest(const std::string &key, uint32_t field,
+                             uint64_t element, bool if_absent, bool if_exists,
+                             bool *changed) override;
+  bool SendListAppendRequest(const std::string &key, uint32_t field,
+                             const std::string &element, bool if_absent,
+                             bool if_exists, bool *changed) override;
+  bool SendListRemoveRequest(const std::string &key, uint32_t field,
+                             uint64_t element, bool *changed) override;
+  bool SendListRemoveRequest(const std::string &key, uint32_t field,
+                             const std::string &element,
+                             bool *changed) override;
+  bool SendExistsRequest(const std::vector<std::string> &keys,
+                         std::vector<bool> *exists) override;
+  // A snapshot is opened on every server, each one when its request gets
+  // there, so it is only consistent across the keys of one server
+  bool SendCreateSnapshotRequest(uint64_t lease_ms,
+                                 uint64_t *snapshot) override;
+  bool SendReleaseSnapshotRequest(uint64_t snapshot) override;
+  // Snapshots only live on the servers they are opened on, so these gets
+  // never go to read replicas
+  bool SendGetAtSnapshotRequest(
+      uint64_t snapshot, const std::vector<std::string> &keys,
+      std::vector<std::string> *reply_values) override;
+  // Every server is watched, and `on_events` first called once all of them
+  // watch the prefixes. The writes of one key keep their order, but not the
+  // writes of keys on different servers.
+  bool SendWatchRequest(
+      const std::vector<std::string> &prefixes, bool with_values,
+      std::chrono::milliseconds tick,
+      const std::function<bool(const std::vector<WatchEvent> &events,
+                               bool overflowed)> &on_events) override;
+
+  // Spreads the get, scan and exists requests of the server at index
+  // `server` over `host:port` as well, which should be a backup of it
+  // Reads go to the server and its replicas in turn. A backup may not have
+  // applied the latest writes yet unless its primary is in sync mode.
+  void AddReadReplica(const std::string &host, const std::string &port,
+                      size_t server = 0);
+
+  inline size_t get_num_of_servers() const { return servers_.size(); }
+
+  // returns the index of the server owning `key`, in the order the servers
+  // are given to the constructor
+  inline size_t ServerOf(const std::string &key) const {
+    return servers_.size() == 1 ? 0 : ring_.NodeOf(key);
+  }
+
+ private:
+  // One of the servers the keys are spread over
+  struct Server {
+    // Points to `stub_` for the first server
+    chirp::KeyValueStore::Stub *stub;
+    std::unique_ptr<chirp::KeyValueStore::Stub> owned_stub;
+    std::vector<std::unique_ptr<chirp::KeyValueStore::Stub>> read_replicas;
+    // Counts the read requests, to pick the stub of the next one
+    std::atomic<size_t> next_read{0};
+  };
+
+  // Adds the server at `endpoint`, whose stub is `stub`
+  void AddServer(const std::string &endpoint, chirp::KeyValueStore::Stub *stub);
+
+  // returns the stub the next read request of `server` goes to
+  chirp::KeyValueStore::Stub *NextReadStub(size_t server);
+
+  // Splits `keys` by server and calls `send` once per server with its keys
+  // and their positions in `keys`, each server in its own thread
+  // returns true if every call returns true
+  // returns false otherwise
+  bool SendToEachServer(
+      const std::vector<std::string> &keys,
+      const std::function<bool(size_t server,
+                               const std::vector<std::string> &server_keys,
+                               const std::vector<size_t> &positions)> &send);
+
+  // Sends the get requests of `keys` to `stub`, appending the values to
+  // `reply_values`
+  // The keys are read at `snapshot`, the handle of the server, unless it is
+  // 0.
+  // returns true if this operation succeeds
+  // returns false otherwise
+  bool SendGetRequestTo(chirp::KeyValueStore::Stub *stub,
+                        const std::vector<std::string> &keys,
+                        std::vector<std::string> *reply_values,
+                        uint64_t snapshot = 0);
+
+  // Runs `send` once per server, each server in its own thread
+  // returns true if every call returns true
+  // returns false otherwise
+  bool SendToAllServers(const std::function<bool(size_t server)> &send);
+
+  // Sends a list_append (`append` is true) or list_remove request
+  // returns true if this operation succeeds
+  // returns false otherwise
+  bool SendListElementRequest(const chirp::ListElementRequest &request,
+                              bool append, bool *changed);
+
+  std::vector<std::unique_ptr<Server>> servers_;
+  ConsistentHashRing ring_;
+
+  // The handles of every open snapshot on the servers, by the handle given
+  // out for it
+  std::mutex snapshots_mutex_;
+  std::map<uint64_t, std::vector<uint64_t>> snapshots_;
+  uint64_t next_snapshot_;
 };
 
 // This is the debug version of backend client
 // which will complete the requests locally without going through grpc
 class BackendClientDebug : public BackendClient {
  public:
+  using BackendClient::BackendClient;
+
   bool SendPutRequest(const std::string &key,
                       const std::string &value) override;
+  bool SendPutRequest(const std::string &key, const std::string &value,
+                      uint64_t ttl_ms) override;
   bool SendGetRequest(const std::vector<std::string> &keys,
                       std::vector<std::string> *reply_values) override;
   bool SendDeleteKeyRequest(const std::string &key) override;
+  bool SendMultiPutRequest(const std::vector<std::string> &keys,
+                           const std::vector<std::string> &values) override;
+  bool SendMultiDeleteRequest(const std::vector<std::string> &keys) override;
+  bool SendFetchAddRequest(const std::string &key, uint64_t delta,
+                           uint64_t *previous) override;
+  bool SendCompareAndSwapRequest(const std::string &key,
+                                 const std::string &expected,
+                                 const std::string &desired,
+                                 std::string *actual) override;
+  bool SendWriteBatchRequest(const chirp::WriteBatchRequest &batch,
+                             bool *applied, size_t *failed_condition) override;
+  bool SendScanRequest(
+      const std::string &start, const std::string &end, uint64_t limit,
+      std::vector<std::pair<std::string, std::string>> *pairs) override;
+  bool SendListAppendRequest(const std::string &key, uint32_t field,
+                             uint64_t element, bool if_absent, bool if_exists,
+                             bool *changed) override;
+  bool SendListAppendRequest(const std::string &key, uint32_t field,
+                             const std::string &element, bool if_absent,
+                             bool if_exists, bool *changed) override;
+  bool SendListRemoveRequest(const std::string &key, uint32_t field,
+                             uint64_t element, bool *changed) override;
+  bool SendListRemoveRequest(const std::string &key, uint32_t field,
+                             const std::string &element,
+                             bool *changed) override;
+  bool SendExistsRequest(const std::vector<std::string> &keys,
+                         std::vector<bool> *exists) override;
+  // A snapshot is a copy of every pair, and never expires, nor do its pairs
+  bool SendCreateSnapshotRequest(uint64_t lease_ms,
+                                 uint64_t *snapshot) override;
+  bool SendReleaseSnapshotRequest(uint64_t snapshot) override;
+  bool SendGetAtSnapshotRequest(
+      uint64_t snapshot, const std::vector<std::string> &keys,
+      std::vector<std::string> *reply_values) override;
+  // Nobody else writes to this client, so there is nothing to watch and this
+  // always fails
+  bool SendWatchRequest(
+      const std::vector<std::string> &prefixes, bool with_values,
+      std::chrono::milliseconds tick,
+      const std::function<bool(const std::vector<WatchEvent> &events,
+                               bool overflowed)> &on_events) override;
 
  private:
+  // Deletes the pairs whose deadlines have passed
+  void ExpireKeys();
+
   std::map<std::string, std::string> key_value_;
+  // The deadlines of the pairs put with a ttl
+  std::map<std::string, std::chrono::steady_clock::time_point> deadlines_;
+  std::map<uint64_t, std::map<std::string, std::string>> snapshots_;
 };
 
 #endif  // CHIRP_TEST_BACKEND_CLIENT_LIB_H_
@@ -0,0 +1,106 @@
+#include "backend_cuckoo_filter.h"
+
+#include <functional>
+#include <initializer_list>
+#include <utility>
+
+#include "hash.h"
+
+const size_t CuckooFilter::kSlotsPerBucket;
+const size_t CuckooFilter::kKeysPerBucketAfterBuild;
+const int CuckooFilter::kMaxKicks;
+
+CuckooFilter::CuckooFilter(size_t num_of_keys)
+    : buckets_(), size_(0), random_(0x9E3779B97F4A7C15ULL) {
+  size_t num_of_buckets = 1;
+  while (num_of_buckets * kKeysPerBucketAfterBuild < num_of_keys) {
+    num_of_buckets *= 2;
+  }
+  buckets_.resize(num_of_buckets, Bucket());
+}
+
+bool CuckooFilter::Insert(const std::string &key) {
+  uint16_t fingerprint;
+  size_t index;
+  Locate(key, &fingerprint, &index);
+  ++size_;
+  if (Place(index, fingerprint)) {
+    return true;
+  }
+  index = AlternateIndexOf(index, fingerprint);
+  if (Place(index, fingerprint)) {
+    return true;
+  }
+
+  // Move a random fingerprint of a full bucket to its other bucket until
+  // one has room
+  for (int kick = 0; kick < kMaxKicks; ++kick) {
+    random_ = random_ * 6364136223846793005ULL + 1442695040888963407ULL;
+    uint16_t &slot = buckets_[index].slots[(random_ >> 33) % kSlotsPerBucket];
+    std::swap(fingerprint, slot);
+    index = AlternateIndexOf(index, fingerprint);
+    if (Place(index, fingerprint)) {
+      return true;
+    }
+  }
+  return false;
+}
+
+void CuckooFilter::Erase(const std::string &key) {
+  uint16_t fingerprint;
+  size_t index;
+  Locate(key, &fingerprint, &index);
+  for (size_t candidate : {index, AlternateIndexOf(index, fingerprint)}) {
+    for (uint16_t &slot : buckets_[candidate].slots) {
+      if (slot == fingerprint) {
+        slot = 0;
+        --size_;
+        return;
+      }
+    }
+  }
+}
+
+bool CuckooFilter::MayContain(const std::string &key) const {
+  uint16_t fingerprint;
+  size_t index;
+  Locate(key, &fingerprint, &index);
+  const Bucket &first = buckets_[index];
+  const Bucket &second = buckets_[AlternateIndexOf(index, fingerprint)];
+  for (size_t i = 0; i < kSlotsPerBucket; ++i) {
+    if (first.slots[i] == fingerprint || second.slots[i] == fingerprint) {
+      return true;
+    }
+  }
+  return false;
+}
+
+void CuckooFilter::Locate(const std::string &key, uint16_t *fingerprint,
+                          size_t *index) const {
+  // `std::hash` also picks the shard of a key, so its bits are mixed before
+  // they pick a bucket within the shard
+  uint64_t hash = MixHash(std::hash<std::string>()(key));
+  // 0 marks an empty slot
+  *fingerprint = static_cast<uint16_t>(hash >> 48);
+  if (*fingerprint == 0) {
+    *fingerprint = 1;
+  }
+  *index = static_cast<size_t>(hash) & (buckets_.size() - 1);
+}
+
+size_t CuckooFilter::AlternateIndexOf(size_t index,
+                                      uint16_t fingerprint) const {
+  // XOR makes this its own inverse, so either bucket gives the other
+  return (index ^ static_cast<size_t>(MixHash(fingerprint))) &
+         (buckets_.size() - 1);
+}
+
+bool CuckooFilter::Place(size_t index, uint16_t fingerprint) {
+  for (uint16_t &slot : buckets_[index].slots) {
+    if (slot == 0) {
+      slot = fingerprint;
+      return true;
+    }
+  }
+  return false;
+}
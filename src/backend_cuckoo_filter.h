@@ -0,0 +1,80 @@
+#ifndef CHIRP_SRC_BACKEND_CUCKOO_FILTER_H_
+#define CHIRP_SRC_BACKEND_CUCKOO_FILTER_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// A cuckoo filter of the keys of one shard
+// It answers whether a key may be in the shard with no false negatives and
+// at most about 0.01% false positives, and unlike a bloom filter it supports
+// deletes.
+// Every key is a 16-bit fingerprint stored in one of two buckets of
+// `kSlotsPerBucket` slots. The second bucket is derived from the first one and
+// the fingerprint alone, so a fingerprint can be moved between its buckets
+// without the key.
+// Since the key is not kept, the filter cannot grow by itself: `Insert()`
+// fails once the filter is too full, and the owner builds a larger filter
+// from its keys.
+// This class is not thread-safe. The shard's lock is held around every call,
+// as a reader for `MayContain()` and as a writer for the others.
+class CuckooFilter {
+ public:
+  static const size_t kSlotsPerBucket = 4;
+  // A filter is built with about this many keys per bucket, so half full
+  static const size_t kKeysPerBucketAfterBuild = kSlotsPerBucket / 2;
+  // `Insert()` fails once this many fingerprints have been moved
+  static const int kMaxKicks = 500;
+
+  // Constructor that takes the number of keys the filter is built for
+  explicit CuckooFilter(size_t num_of_keys = 0);
+
+  // Adds `key`
+  // A key inserted twice needs to be erased twice.
+  // returns true if this operation succeeds
+  // returns false if the filter is too full. One of its keys may have been
+  // dropped then, so it should be rebuilt larger before it is used again.
+  bool Insert(const std::string &key);
+
+  // Removes one insertion of `key`, which must have been inserted
+  void Erase(const std::string &key);
+
+  // returns false if `key` is definitely not inserted
+  // returns true otherwise
+  bool MayContain(const std::string &key) const;
+
+  // returns the number of keys the filter holds
+  inline size_t size() const { return size_; }
+
+  // returns the number of slots
+  inline size_t get_capacity() const {
+    return buckets_.size() * kSlotsPerBucket;
+  }
+
+ private:
+  // An empty slot is a 0 fingerprint
+  struct Bucket {
+    uint16_t slots[kSlotsPerBucket];
+  };
+
+  // Computes the fingerprint of `key` and its first bucket
+  void Locate(const std::string &key, uint16_t *fingerprint,
+              size_t *index) const;
+
+  // returns the other bucket `fingerprint` can be in
+  size_t AlternateIndexOf(size_t index, uint16_t fingerprint) const;
+
+  // Puts `fingerprint` in an empty slot of the bucket `index`
+  // returns true if this operation succeeds
+  // returns false if the bucket is full
+  bool Place(size_t index, uint16_t fingerprint);
+
+  // The number of buckets is a power of 2
+  std::vector<Bucket> buckets_;
+  size_t size_;
+  // The state of the pseudo-random victim choice
+  uint64_t random_;
+};
+
+#endif /* CHIRP_SRC_BACKEND_CUCKOO_FILTER_H_ */
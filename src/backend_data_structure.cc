@@ -1,27 +1,1171 @@
 #include "backend_data_structure.h"
 
-BackendDataStructure::BackendDataStructure() : key_value_map_() {}
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <functional>
+#include <thread>
+#include <utility>
+
+namespace {
+// Splits the value of a `PUT_WITH_DEADLINE` record
+// returns true if this operation succeeds
+// returns false if the value is too short
+bool DecodeDeadline(const std::string &record_value, uint64_t *deadline,
+                    std::string *value) {
+  if (record_value.size() < sizeof(*deadline)) {
+    return false;
+  }
+  std::memcpy(deadline, record_value.data(), sizeof(*deadline));
+  value->assign(record_value, sizeof(*deadline), std::string::npos);
+  return true;
+}
+}  // Anonymous namespace
+
+const size_t BackendDataStructure::kAccountingPrefixSize;
+const size_t BackendDataStructure::kMaxExpiredKeysPerShard;
+
+thread_local BackendDataStructure::DeferredDurability
+    *BackendDataStructure::deferred_durability_ = nullptr;
+
+BackendDataStructure::DeferredDurability::DeferredDurability()
+    : lsn_(0), previous_(deferred_durability_) {
+  deferred_durability_ = this;
+}
+
+BackendDataStructure::DeferredDurability::~DeferredDurability() {
+  deferred_durability_ = previous_;
+}
+
+BackendDataStructure::BackendDataStructure(
+    size_t num_of_shards, const ShardStorage::Options &storage_options)
+    : epochs_(nullptr),
+      shards_(),
+      storage_options_(storage_options),
+      bytes_used_(0),
+      memory_limit_(0),
+      num_of_expiring_keys_(0),
+      write_ahead_log_(nullptr),
+      change_log_(nullptr),
+      watch_table_(),
+      next_version_(NowMilliseconds() << 16),
+      oldest_readable_snapshot_(next_version_.load()),
+      num_of_snapshots_(0),
+      num_of_versions_(0),
+      snapshots_mutex_(),
+      snapshots_() {
+  if (num_of_shards == 0) {
+    num_of_shards = 1;
+  }
+
+  for (size_t i = 0; i < num_of_shards; ++i) {
+    shards_.emplace_back(new Shard());
+    shards_.back()->storage = ShardStorage::Create(storage_options_, i);
+  }
+}
+
+bool BackendDataStructure::OpenStorage() {
+  for (auto &shard_pointer : shards_) {
+    Shard &shard = *shard_pointer;
+    WriterLockGuard guard(&shard.lock);
+    if (!shard.storage->Open()) {
+      return false;
+    }
+    shard.storage->ForEach([this, &shard](const char *key, size_t key_size,
+                                          const char *value,
+                                          size_t value_size) {
+      size_t bytes = shard.storage->BytesOf(key_size, value_size);
+      if (shard.read_index != nullptr) {
+        shard.read_index->Put(std::string(key, key_size),
+                              std::string(value, value_size), 0);
+        bytes += ReadIndex::BytesOf(key_size, value_size);
+      }
+      Account(&shard, std::string(key, key_size), 0, bytes);
+    });
+    RebuildFilterLocked(&shard);
+  }
+  return true;
+}
+
+void BackendDataStructure::EnableLockFreeReads() {
+  epochs_.reset(new EpochManager());
+  for (auto &shard_pointer : shards_) {
+    WriterLockGuard guard(&shard_pointer->lock);
+    shard_pointer->read_index.reset(new ReadIndex(epochs_.get()));
+  }
+}
+
+bool BackendDataStructure::FlushStorage() {
+  for (auto &shard_pointer : shards_) {
+    WriterLockGuard guard(&shard_pointer->lock);
+    shard_pointer->storage->SealMemtable();
+  }
+
+  bool ok = true;
+  for (auto &shard_pointer : shards_) {
+    ok &= shard_pointer->storage->WaitForFlushes();
+  }
+  return ok;
+}
+
+bool BackendDataStructure::Put(const std::string &key,
+                               const std::string &value, uint64_t ttl_ms) {
+  return PutValue(key, value, nullptr, ttl_ms);
+}
 
 bool BackendDataStructure::Put(const std::string &key,
-                               const std::string &value) {
-  key_value_map_[key] = value;
+                               const ValueBuffer &value, uint64_t ttl_ms) {
+  return PutValue(key, value.str(), &value, ttl_ms);
+}
+
+bool BackendDataStructure::PutValue(const std::string &key,
+                                    const std::string &value,
+                                    const ValueBuffer *shared,
+                                    uint64_t ttl_ms) {
+  if (IsReadOnly() || IsOverMemoryLimit()) {
+    return false;
+  }
+
+  uint64_t deadline = ttl_ms > 0 ? NowMilliseconds() + ttl_ms : 0;
+  uint64_t lsn = 0;
+  {
+    Shard &shard = ShardOf(key);
+    WriterLockGuard guard(&shard.lock);
+    lsn = LogPut(key, value, deadline);
+    PutLocked(&shard, key, value, deadline, 0, shared);
+  }
+
+  // Wait for the log outside the lock so that other writers can share the
+  // same fsync
+  if (write_ahead_log_ != nullptr) {
+    return WaitForLog(lsn);
+  }
   return true;
 }
 
 bool BackendDataStructure::Get(const std::string &key,
                                std::string *output_value) {
-  auto it = key_value_map_.find(key);
-  if (it == key_value_map_.end()) {
+  return GetFromShard(&ShardOf(key), key, output_value);
+}
+
+bool BackendDataStructure::MultiGetAtSnapshot(
+    uint64_t snapshot, const std::vector<std::string> &keys,
+    std::vector<std::string> *output_values) {
+  if (snapshot < oldest_readable_snapshot_ || snapshot >= next_version_) {
     return false;
   }
 
-  if (output_value != nullptr) {
-    *output_value = it->second;
+  std::vector<std::pair<size_t, size_t>> order = GroupByShard(keys);
+  std::vector<std::string> values(keys.size());
+  for (size_t begin = 0; begin < order.size();) {
+    Shard &shard = *shards_[order[begin].first];
+    // The versions are only kept in order under the lock, even for shards
+    // with a read index
+    ReaderLockGuard guard(&shard.lock);
+
+    size_t end = begin;
+    for (; end < order.size() && order[end].first == order[begin].first;
+         ++end) {
+      GetAtSnapshotLocked(shard, keys[order[end].second], snapshot,
+                          &values[order[end].second]);
+    }
+    begin = end;
+  }
+
+  // The versions read may have been collected while they were read
+  if (snapshot < oldest_readable_snapshot_) {
+    return false;
+  }
+  if (output_values != nullptr) {
+    for (std::string &value : values) {
+      output_values->push_back(std::move(value));
+    }
   }
   return true;
 }
 
+uint64_t BackendDataStructure::CreateSnapshot(uint64_t lease_ms) {
+  // Under the mutex, so that `CollectVersions()` either sees the snapshot or
+  // moves the horizon before the snapshot is taken
+  std::lock_guard<std::mutex> guard(snapshots_mutex_);
+  // Counted before the handle is taken, so every write that does not take a
+  // version is seen by the snapshot. The handle is a version of its own, so
+  // once the snapshot is released the horizon moves past it even if nothing
+  // is written.
+  ++num_of_snapshots_;
+  uint64_t snapshot = next_version_++;
+  snapshots_.emplace(snapshot, lease_ms > 0 ? NowMilliseconds() + lease_ms : 0);
+  return snapshot;
+}
+
+bool BackendDataStructure::ReleaseSnapshot(uint64_t snapshot) {
+  std::lock_guard<std::mutex> guard(snapshots_mutex_);
+  auto it = snapshots_.find(snapshot);
+  if (it == snapshots_.end()) {
+    return false;
+  }
+  snapshots_.erase(it);
+  --num_of_snapshots_;
+  return true;
+}
+
+size_t BackendDataStructure::CollectVersions() {
+  uint64_t horizon;
+  {
+    std::lock_guard<std::mutex> guard(snapshots_mutex_);
+    uint64_t now = NowMilliseconds();
+    for (auto it = snapshots_.begin(); it != snapshots_.end();) {
+      if (it->second != 0 && it->second <= now) {
+        it = snapshots_.erase(it);
+        --num_of_snapshots_;
+      } else {
+        ++it;
+      }
+    }
+    horizon = snapshots_.empty() ? next_version_.load()
+                                 : snapshots_.begin()->first;
+    oldest_readable_snapshot_ = horizon;
+  }
+
+  // A snapshot reads the first version at or after its handle, so the
+  // versions before the horizon are never read again
+  size_t num_of_collected = 0;
+  for (auto &shard_pointer : shards_) {
+    Shard &shard = *shard_pointer;
+    WriterLockGuard guard(&shard.lock);
+    for (auto it = shard.versions.begin(); it != shard.versions.end();) {
+      std::vector<Version> &versions = it->second;
+      auto first_kept = std::lower_bound(
+          versions.begin(), versions.end(), horizon,
+          [](const Version &version, uint64_t horizon) {
+            return version.version < horizon;
+          });
+      num_of_collected += first_kept - versions.begin();
+      versions.erase(versions.begin(), first_kept);
+      if (versions.empty()) {
+        it = shard.versions.erase(it);
+      } else {
+        ++it;
+      }
+    }
+  }
+  num_of_versions_ -= num_of_collected;
+  return num_of_collected;
+}
+
+bool BackendDataStructure::MultiGet(const std::vector<std::string> &keys,
+                                    std::vector<std::string> *output_values) {
+  return MultiGetValues(keys, output_values);
+}
+
+bool BackendDataStructure::MultiGetShared(
+    const std::vector<std::string> &keys,
+    std::vector<ValueBuffer> *output_values) {
+  return MultiGetValues(keys, output_values);
+}
+
+template <typename Value>
+bool BackendDataStructure::MultiGetValues(
+    const std::vector<std::string> &keys, std::vector<Value> *output_values) {
+  std::vector<std::pair<size_t, size_t>> order = GroupByShard(keys);
+
+  std::vector<Value> values(keys.size());
+  bool all_found = true;
+  for (size_t begin = 0; begin < order.size();) {
+    Shard &shard = *shards_[order[begin].first];
+    // Reads that take no lock do not hold it for the group either
+    std::unique_ptr<ReaderLockGuard> guard;
+    if (shard.read_index == nullptr) {
+      guard.reset(new ReaderLockGuard(&shard.lock));
+    }
+
+    size_t end = begin;
+    for (; end < order.size() && order[end].first == order[begin].first;
+         ++end) {
+      if (!GetLocked(shard, keys[order[end].second],
+                     &values[order[end].second])) {
+        all_found = false;
+      }
+    }
+    begin = end;
+  }
+
+  if (output_values != nullptr) {
+    for (Value &value : values) {
+      output_values->push_back(std::move(value));
+    }
+  }
+  return all_found;
+}
+
+void BackendDataStructure::MultiGetFound(
+    const std::vector<std::string> &keys,
+    std::vector<std::pair<std::string, std::string>> *output) {
+  std::vector<std::pair<size_t, size_t>> order = GroupByShard(keys);
+
+  // Values by position in `keys`, and whether they are found
+  std::vector<std::string> values(keys.size());
+  std::vector<char> found(keys.size(), false);
+  for (size_t begin = 0; begin < order.size();) {
+    Shard &shard = *shards_[order[begin].first];
+    std::unique_ptr<ReaderLockGuard> guard;
+    if (shard.read_index == nullptr) {
+      guard.reset(new ReaderLockGuard(&shard.lock));
+    }
+
+    size_t end = begin;
+    for (; end < order.size() && order[end].first == order[begin].first;
+         ++end) {
+      found[order[end].second] = GetLocked(shard, keys[order[end].second],
+                                           &values[order[end].second]);
+    }
+    begin = end;
+  }
+
+  for (size_t i = 0; i < keys.size(); ++i) {
+    if (found[i]) {
+      output->emplace_back(keys[i], std::move(values[i]));
+    }
+  }
+}
+
+void BackendDataStructure::Exists(const std::vector<std::string> &keys,
+                                  std::vector<bool> *output) {
+  std::vector<std::pair<size_t, size_t>> order = GroupByShard(keys);
+
+  std::vector<bool> found(keys.size(), false);
+  for (size_t begin = 0; begin < order.size();) {
+    Shard &shard = *shards_[order[begin].first];
+    ReaderLockGuard guard(&shard.lock);
+
+    size_t end = begin;
+    for (; end < order.size() && order[end].first == order[begin].first;
+         ++end) {
+      const std::string &key = keys[order[end].second];
+      found[order[end].second] =
+          shard.filter.MayContain(key) &&
+          GetLocked(shard, key, static_cast<std::string *>(nullptr));
+    }
+    begin = end;
+  }
+
+  output->insert(output->end(), found.begin(), found.end());
+}
+
+void BackendDataStructure::ScanKeys(const std::string &start,
+                                    const std::string &end, size_t limit,
+                                    std::vector<std::string> *output) {
+  // With a limit, only the smallest `limit` keys seen so far are kept, in a
+  // max-heap, so the keys held never outnumber `limit`
+  std::vector<std::string> keys;
+  auto keep = [&](std::string &&key) {
+    if (limit == 0) {
+      keys.push_back(std::move(key));
+    } else if (keys.size() < limit) {
+      keys.push_back(std::move(key));
+      std::push_heap(keys.begin(), keys.end());
+    } else if (key < keys.front()) {
+      std::pop_heap(keys.begin(), keys.end());
+      keys.back() = std::move(key);
+      std::push_heap(keys.begin(), keys.end());
+    }
+  };
+
+  for (auto &shard_pointer : shards_) {
+    Shard &shard = *shard_pointer;
+    ReaderLockGuard guard(&shard.lock);
+    // Expired keys are dropped after the storage counts them, so a shard
+    // with deadlines is scanned without a limit
+    bool expiring = !shard.deadlines.empty();
+    uint64_t now = expiring ? NowMilliseconds() : 0;
+    shard.storage->Scan(
+        start, end, expiring ? 0 : limit,
+        [&](const char *key, size_t key_size, const char *value,
+            size_t value_size) {
+          std::string scanned(key, key_size);
+          if (expiring) {
+            auto it = shard.deadlines.find(scanned);
+            if (it != shard.deadlines.end() && it->second <= now) {
+              return;
+            }
+          }
+          keep(std::move(scanned));
+        });
+  }
+
+  std::sort(keys.begin(), keys.end());
+  for (std::string &key : keys) {
+    output->push_back(std::move(key));
+  }
+}
+
 bool BackendDataStructure::DeleteKey(const std::string &key) {
-  bool ok = key_value_map_.erase(key);
-  return ok;
+  if (IsReadOnly()) {
+    return false;
+  }
+
+  uint64_t lsn = 0;
+  {
+    Shard &shard = ShardOf(key);
+    WriterLockGuard guard(&shard.lock);
+    bool ok = EraseLocked(&shard, key);
+    if (!ok) {
+      return false;
+    }
+    if (write_ahead_log_ != nullptr) {
+      lsn = write_ahead_log_->Append(WriteAheadLog::DELETE_KEY, key,
+                                     std::string());
+    }
+  }
+
+  if (write_ahead_log_ != nullptr) {
+    return WaitForLog(lsn);
+  }
+  return true;
+}
+
+bool BackendDataStructure::MultiPut(const std::vector<std::string> &keys,
+                                    const std::vector<std::string> &values) {
+  if (keys.size() != values.size() || IsReadOnly() || IsOverMemoryLimit()) {
+    return false;
+  }
+
+  std::vector<std::pair<size_t, size_t>> order = GroupByShard(keys);
+  uint64_t lsn = 0;
+  for (size_t begin = 0; begin < order.size();) {
+    Shard &shard = *shards_[order[begin].first];
+    WriterLockGuard guard(&shard.lock);
+
+    size_t end = begin;
+    for (; end < order.size() && order[end].first == order[begin].first;
+         ++end) {
+      const std::string &key = keys[order[end].second];
+      const std::string &value = values[order[end].second];
+      if (write_ahead_log_ != nullptr) {
+        lsn = write_ahead_log_->Append(WriteAheadLog::PUT, key, value);
+      }
+      PutLocked(&shard, key, value);
+    }
+    begin = end;
+  }
+
+  // The last record is durable only after every record before it is
+  if (write_ahead_log_ != nullptr && lsn > 0) {
+    return WaitForLog(lsn);
+  }
+  return true;
+}
+
+bool BackendDataStructure::MultiDelete(const std::vector<std::string> &keys,
+                                       size_t *num_of_deleted) {
+  if (IsReadOnly()) {
+    return false;
+  }
+
+  std::vector<std::pair<size_t, size_t>> order = GroupByShard(keys);
+  uint64_t lsn = 0;
+  size_t deleted = 0;
+  for (size_t begin = 0; begin < order.size();) {
+    Shard &shard = *shards_[order[begin].first];
+    WriterLockGuard guard(&shard.lock);
+
+    size_t end = begin;
+    for (; end < order.size() && order[end].first == order[begin].first;
+         ++end) {
+      const std::string &key = keys[order[end].second];
+      if (!EraseLocked(&shard, key)) {
+        continue;
+      }
+      ++deleted;
+      if (write_ahead_log_ != nullptr) {
+        lsn = write_ahead_log_->Append(WriteAheadLog::DELETE_KEY, key,
+                                       std::string());
+      }
+    }
+    begin = end;
+  }
+
+  if (num_of_deleted != nullptr) {
+    *num_of_deleted = deleted;
+  }
+  if (write_ahead_log_ != nullptr && lsn > 0) {
+    return WaitForLog(lsn);
+  }
+  return true;
+}
+
+bool BackendDataStructure::FetchAdd(const std::string &key, uint64_t delta,
+                                    uint64_t *previous) {
+  if (IsReadOnly() || IsOverMemoryLimit()) {
+    return false;
+  }
+
+  uint64_t lsn = 0;
+  {
+    Shard &shard = ShardOf(key);
+    WriterLockGuard guard(&shard.lock);
+    std::string value;
+    bool found = GetLocked(shard, key, &value);
+    uint64_t deadline = found ? DeadlineOfLocked(shard, key) : 0;
+    uint64_t counter = 0;
+    if (value.size() == sizeof(counter)) {
+      std::memcpy(&counter, value.data(), sizeof(counter));
+    } else if (!value.empty()) {
+      return false;
+    }
+
+    *previous = counter;
+    counter += delta;
+    value.assign(reinterpret_cast<const char *>(&counter), sizeof(counter));
+    // The new value is logged rather than the addition, so replaying the log
+    // does not depend on the value before it
+    lsn = LogPut(key, value, deadline);
+    PutLocked(&shard, key, value, deadline);
+  }
+
+  if (write_ahead_log_ != nullptr) {
+    return WaitForLog(lsn);
+  }
+  return true;
+}
+
+bool BackendDataStructure::CompareAndSwap(const std::string &key,
+                                          const std::string &expected,
+                                          const std::string &desired,
+                                          bool *swapped, std::string *actual) {
+  if (IsReadOnly()) {
+    *swapped = false;
+    return false;
+  }
+
+  uint64_t lsn = 0;
+  {
+    Shard &shard = ShardOf(key);
+    WriterLockGuard guard(&shard.lock);
+    std::string current;
+    bool found = GetLocked(shard, key, &current);
+    *swapped = current == expected;
+    if (!*swapped) {
+      if (actual != nullptr) {
+        actual->swap(current);
+      }
+      return true;
+    }
+
+    // Only a swap can add memory, so a mismatch is still reported
+    if (IsOverMemoryLimit()) {
+      *swapped = false;
+      return false;
+    }
+    uint64_t deadline = found ? DeadlineOfLocked(shard, key) : 0;
+    PutLocked(&shard, key, desired, deadline);
+    lsn = LogPut(key, desired, deadline);
+  }
+
+  if (write_ahead_log_ != nullptr) {
+    return WaitForLog(lsn);
+  }
+  return true;
+}
+
+bool BackendDataStructure::Update(const std::string &key,
+                                  const Updater &updater, bool *changed) {
+  *changed = false;
+  if (IsReadOnly()) {
+    return false;
+  }
+
+  uint64_t lsn = 0;
+  {
+    Shard &shard = ShardOf(key);
+    WriterLockGuard guard(&shard.lock);
+    std::string value;
+    bool found = GetLocked(shard, key, &value);
+    size_t previous_size = value.size();
+
+    UpdateResults result = updater(&value);
+    if (result == INVALID) {
+      return false;
+    } else if (result == UNCHANGED) {
+      return true;
+    }
+
+    // A value that shrinks is let through so that memory can be given back
+    if ((!found || value.size() > previous_size) && IsOverMemoryLimit()) {
+      return false;
+    }
+
+    *changed = true;
+    uint64_t deadline = found ? DeadlineOfLocked(shard, key) : 0;
+    lsn = LogPut(key, value, deadline);
+    PutLocked(&shard, key, value, deadline);
+  }
+
+  if (write_ahead_log_ != nullptr) {
+    return WaitForLog(lsn);
+  }
+  return true;
+}
+
+bool BackendDataStructure::ApplyBatch(
+    const std::vector<BatchCondition> &conditions,
+    const std::vector<BatchWrite> &writes, bool *applied,
+    size_t *failed_condition, std::string *actual) {
+  *applied = false;
+  if (IsReadOnly()) {
+    return false;
+  }
+
+  // Every shard is locked once and in index order, so two batches never wait
+  // for each other
+  std::vector<size_t> shard_indexes;
+  for (const auto &condition : conditions) {
+    shard_indexes.push_back(ShardIndexOf(condition.key));
+  }
+  for (const auto &write : writes) {
+    shard_indexes.push_back(ShardIndexOf(write.key));
+  }
+  std::sort(shard_indexes.begin(), shard_indexes.end());
+  shard_indexes.erase(std::unique(shard_indexes.begin(), shard_indexes.end()),
+                      shard_indexes.end());
+
+  uint64_t lsn = 0;
+  {
+    std::vector<std::unique_ptr<WriterLockGuard>> guards;
+    for (size_t index : shard_indexes) {
+      guards.emplace_back(new WriterLockGuard(&shards_[index]->lock));
+    }
+
+    for (size_t i = 0; i < conditions.size(); ++i) {
+      std::string current;
+      bool found =
+          GetLocked(ShardOf(conditions[i].key), conditions[i].key, &current);
+      if (conditions[i].exists ? !found
+                               : current != conditions[i].expected) {
+        if (failed_condition != nullptr) {
+          *failed_condition = i;
+        }
+        if (actual != nullptr) {
+          actual->swap(current);
+        }
+        return true;
+      }
+    }
+
+    // The final state of every key written, worked out before anything is
+    // written so that an invalid update leaves nothing half done
+    struct Pending {
+      bool found;
+      std::string value;
+      uint64_t deadline;
+      bool changed;
+    };
+    std::unordered_map<std::string, Pending> pending;
+    // The keys in the order they are first written
+    std::vector<const std::string *> keys;
+    bool puts = false;
+    for (const auto &write : writes) {
+      auto it = pending.find(write.key);
+      if (it == pending.end()) {
+        const Shard &shard = ShardOf(write.key);
+        Pending state;
+        state.found = GetLocked(shard, write.key, &state.value);
+        state.deadline = state.found ? DeadlineOfLocked(shard, write.key) : 0;
+        state.changed = false;
+        it = pending.emplace(write.key, std::move(state)).first;
+        keys.push_back(&it->first);
+      }
+
+      Pending &state = it->second;
+      switch (write.operation) {
+        case BatchWrite::PUT:
+          state.found = true;
+          state.value = write.value;
+          state.deadline = 0;
+          state.changed = true;
+          puts = true;
+          break;
+        case BatchWrite::DELETE:
+          if (state.found) {
+            state.found = false;
+            state.value.clear();
+            state.deadline = 0;
+            state.changed = true;
+          }
+          break;
+        case BatchWrite::UPDATE: {
+          UpdateResults result = write.updater(&state.value);
+          if (result == INVALID) {
+            return false;
+          } else if (result == CHANGED) {
+            state.found = true;
+            state.changed = true;
+            puts = true;
+          }
+          break;
+        }
+      }
+    }
+    if (puts && IsOverMemoryLimit()) {
+      return false;
+    }
+
+    // One version for the whole batch, taken while every shard is locked
+    uint64_t version = next_version_++;
+    std::vector<WriteAheadLog::Record> records;
+    for (const std::string *key : keys) {
+      const Pending &state = pending[*key];
+      if (!state.changed) {
+        continue;
+      }
+      Shard &shard = ShardOf(*key);
+      if (state.found) {
+        PutLocked(&shard, *key, state.value, state.deadline, version);
+        if (write_ahead_log_ != nullptr) {
+          records.push_back(PutRecordOf(*key, state.value, state.deadline));
+        }
+      } else if (EraseLocked(&shard, *key, version) &&
+                 write_ahead_log_ != nullptr) {
+        records.push_back(WriteAheadLog::Record{
+            0, WriteAheadLog::DELETE_KEY, *key, std::string()});
+      }
+    }
+    if (write_ahead_log_ != nullptr) {
+      lsn = write_ahead_log_->AppendBatch(records);
+    }
+    *applied = true;
+  }
+
+  if (write_ahead_log_ != nullptr && lsn > 0) {
+    return WaitForLog(lsn);
+  }
+  return true;
+}
+
+void BackendDataStructure::Replay(
+    const std::vector<WriteAheadLog::Record> &records, size_t num_of_threads) {
+  if (num_of_threads == 0) {
+    num_of_threads = 1;
+  }
+
+  // Find the shard of every record, one contiguous chunk per thread
+  std::vector<size_t> shard_indexes(records.size());
+  size_t per_thread = (records.size() + num_of_threads - 1) / num_of_threads;
+  std::vector<std::thread> threads;
+  for (size_t t = 0; t < num_of_threads; ++t) {
+    threads.emplace_back([this, t, per_thread, &records, &shard_indexes]() {
+      size_t begin = std::min(records.size(), t * per_thread);
+      size_t end = std::min(records.size(), begin + per_thread);
+      for (size_t i = begin; i < end; ++i) {
+        shard_indexes[i] = ShardIndexOf(records[i].key);
+      }
+    });
+  }
+  for (auto &thread : threads) {
+    thread.join();
+  }
+  threads.clear();
+
+  // Thread `t` owns the shards whose index % `num_of_threads` is `t`
+  for (size_t t = 0; t < num_of_threads; ++t) {
+    threads.emplace_back([this, t, num_of_threads, &records,
+                          &shard_indexes]() {
+      for (size_t i = 0; i < records.size(); ++i) {
+        if (shard_indexes[i] % num_of_threads != t) {
+          continue;
+        }
+
+        const WriteAheadLog::Record &record = records[i];
+        Shard &shard = *shards_[shard_indexes[i]];
+        WriterLockGuard guard(&shard.lock);
+        uint64_t deadline;
+        std::string value;
+        if (record.operation == WriteAheadLog::PUT) {
+          PutLocked(&shard, record.key, record.value);
+        } else if (record.operation == WriteAheadLog::PUT_WITH_DEADLINE) {
+          // A deadline that has passed is still set, so that the key is
+          // hidden and then reclaimed like any other expired key
+          if (DecodeDeadline(record.value, &deadline, &value)) {
+            PutLocked(&shard, record.key, value, deadline);
+          }
+        } else {
+          EraseLocked(&shard, record.key);
+        }
+      }
+    });
+  }
+  for (auto &thread : threads) {
+    thread.join();
+  }
+}
+
+void BackendDataStructure::CopyShard(
+    size_t index, std::vector<std::pair<std::string, std::string>> *output) {
+  Shard &shard = *shards_[index];
+  ReaderLockGuard guard(&shard.lock);
+  output->reserve(output->size() + shard.storage->size());
+  shard.storage->ForEach([output](const char *key, size_t key_size,
+                                  const char *value, size_t value_size) {
+    output->emplace_back(std::string(key, key_size),
+                         std::string(value, value_size));
+  });
+}
+
+void BackendDataStructure::Restore(const std::string &key,
+                                   const std::string &value) {
+  Shard &shard = ShardOf(key);
+  WriterLockGuard guard(&shard.lock);
+  PutLocked(&shard, key, value);
+}
+
+size_t BackendDataStructure::ExpireKeys() {
+  if (num_of_expiring_keys_ == 0) {
+    return 0;
+  }
+
+  size_t num_of_expired = 0;
+  uint64_t now = NowMilliseconds();
+  std::vector<std::string> due;
+  for (auto &shard_pointer : shards_) {
+    Shard &shard = *shard_pointer;
+    WriterLockGuard guard(&shard.lock);
+    due.clear();
+    shard.expiry_wheel.Collect(now, kMaxExpiredKeysPerShard, &due);
+    for (const std::string &key : due) {
+      // The key may have been deleted or put again since it was added
+      auto it = shard.deadlines.find(key);
+      if (it == shard.deadlines.end() || it->second > now) {
+        continue;
+      }
+      EraseLocked(&shard, key);
+      ++num_of_expired;
+      // A lost delete only brings the key back with its deadline passed, so
+      // the delete is not waited for
+      if (write_ahead_log_ != nullptr) {
+        write_ahead_log_->Append(WriteAheadLog::DELETE_KEY, key,
+                                 std::string());
+      }
+    }
+  }
+  return num_of_expired;
+}
+
+bool BackendDataStructure::LogExpiringKeys() {
+  if (write_ahead_log_ == nullptr || num_of_expiring_keys_ == 0) {
+    return true;
+  }
+
+  uint64_t lsn = 0;
+  for (auto &shard_pointer : shards_) {
+    Shard &shard = *shard_pointer;
+    WriterLockGuard guard(&shard.lock);
+    std::string value;
+    for (const auto &pair : shard.deadlines) {
+      if (shard.storage->Get(pair.first, &value)) {
+        lsn = LogPut(pair.first, value, pair.second);
+      }
+    }
+  }
+  return lsn == 0 || WaitForLog(lsn);
+}
+
+uint64_t BackendDataStructure::NowMilliseconds() {
+  return std::chrono::duration_cast<std::chrono::milliseconds>(
+             std::chrono::system_clock::now().time_since_epoch())
+      .count();
+}
+
+void BackendDataStructure::GetMemoryUsage(
+    std::map<std::string, PrefixUsage> *output) {
+  for (auto &shard_pointer : shards_) {
+    Shard &shard = *shard_pointer;
+    ReaderLockGuard guard(&shard.lock);
+    for (const auto &pair : shard.usage_by_prefix) {
+      PrefixUsage &usage = (*output)[pair.first];
+      usage.num_of_keys += pair.second.num_of_keys;
+      usage.bytes += pair.second.bytes;
+    }
+  }
+}
+
+BackendDataStructure::LockContention BackendDataStructure::GetLockContention()
+    const {
+  LockContention contention = {0, 0};
+  for (const auto &shard : shards_) {
+    contention.num_of_contended += shard->lock.get_num_of_contended();
+    contention.wait_nanoseconds += shard->lock.get_wait_nanoseconds();
+  }
+  return contention;
+}
+
+bool BackendDataStructure::GetLocked(const Shard &shard,
+                                     const std::string &key,
+                                     std::string *value) const {
+  if (shard.read_index != nullptr) {
+    return shard.read_index->Get(key, NowMilliseconds, value);
+  }
+
+  // The deadline is checked first so that an expired value is not copied
+  if (!shard.deadlines.empty()) {
+    auto it = shard.deadlines.find(key);
+    if (it != shard.deadlines.end() && it->second <= NowMilliseconds()) {
+      return false;
+    }
+  }
+  return shard.storage->Get(key, value);
+}
+
+bool BackendDataStructure::GetLocked(const Shard &shard,
+                                     const std::string &key,
+                                     ValueBuffer *value) const {
+  if (shard.read_index != nullptr) {
+    std::string copy;
+    if (!shard.read_index->Get(key, NowMilliseconds, &copy)) {
+      return false;
+    }
+    *value = ValueBuffer(std::move(copy));
+    return true;
+  }
+
+  if (!shard.deadlines.empty()) {
+    auto it = shard.deadlines.find(key);
+    if (it != shard.deadlines.end() && it->second <= NowMilliseconds()) {
+      return false;
+    }
+  }
+  return shard.storage->GetShared(key, value);
+}
+
+bool BackendDataStructure::GetAtSnapshotLocked(const Shard &shard,
+                                               const std::string &key,
+                                               uint64_t snapshot,
+                                               std::string *value) const {
+  if (!shard.versions.empty()) {
+    auto it = shard.versions.find(key);
+    if (it != shard.versions.end()) {
+      // The value before the first write the snapshot does not see
+      for (const Version &version : it->second) {
+        if (version.version < snapshot) {
+          continue;
+        }
+        if (!version.found ||
+            (version.deadline > 0 && version.deadline <= NowMilliseconds())) {
+          return false;
+        }
+        if (value != nullptr) {
+          *value = version.value;
+        }
+        return true;
+      }
+    }
+  }
+  return GetLocked(shard, key, value);
+}
+
+void BackendDataStructure::KeepVersionLocked(Shard *shard,
+                                             const std::string &key,
+                                             bool keep_missing,
+                                             uint64_t version_taken) {
+  if (num_of_snapshots_ == 0) {
+    return;
+  }
+
+  Version version;
+  version.found = shard->storage->Get(key, &version.value);
+  if (!version.found && !keep_missing) {
+    return;
+  }
+  version.deadline = DeadlineOfLocked(*shard, key);
+  // Taken under the writer lock, so the versions of a key are in order
+  version.version = version_taken > 0 ? version_taken : next_version_++;
+  shard->versions[key].push_back(std::move(version));
+  ++num_of_versions_;
+}
+
+bool BackendDataStructure::GetFromShard(Shard *shard, const std::string &key,
+                                        std::string *value) {
+  if (shard->read_index != nullptr) {
+    return shard->read_index->Get(key, NowMilliseconds, value);
+  }
+  ReaderLockGuard guard(&shard->lock);
+  return GetLocked(*shard, key, value);
+}
+
+uint64_t BackendDataStructure::DeadlineOfLocked(const Shard &shard,
+                                                const std::string &key) const {
+  if (shard.deadlines.empty()) {
+    return 0;
+  }
+  auto it = shard.deadlines.find(key);
+  return it == shard.deadlines.end() ? 0 : it->second;
+}
+
+void BackendDataStructure::PutLocked(Shard *shard, const std::string &key,
+                                     const std::string &value,
+                                     uint64_t deadline, uint64_t version,
+                                     const ValueBuffer *shared) {
+  KeepVersionLocked(shard, key, true, version);
+  size_t previous_bytes = shared != nullptr
+                              ? shard->storage->PutShared(key, *shared)
+                              : shard->storage->Put(key, value);
+  size_t bytes = shard->storage->BytesOf(key.size(), value.size());
+  if (shard->read_index != nullptr) {
+    // The index holds a second copy of the pair
+    previous_bytes += shard->read_index->Put(key, value, deadline);
+    bytes += ReadIndex::BytesOf(key.size(), value.size());
+  }
+  Account(shard, key, previous_bytes, bytes);
+  if (previous_bytes == 0) {
+    AddToFilterLocked(shard, key);
+  }
+  if (change_log_ != nullptr) {
+    change_log_->Append(ChangeLog::PUT, key, value);
+  }
+  watch_table_.Notify(key, value, false);
+
+  if (deadline > 0) {
+    auto result = shard->deadlines.emplace(key, deadline);
+    if (result.second) {
+      ++num_of_expiring_keys_;
+    } else if (result.first->second == deadline) {
+      // The wheel already has this deadline
+      return;
+    }
+    result.first->second = deadline;
+    shard->expiry_wheel.Add(key, deadline);
+  } else if (!shard->deadlines.empty() && shard->deadlines.erase(key) > 0) {
+    --num_of_expiring_keys_;
+  }
+}
+
+uint64_t BackendDataStructure::LogPut(const std::string &key,
+                                      const std::string &value,
+                                      uint64_t deadline) {
+  if (write_ahead_log_ == nullptr) {
+    return 0;
+  }
+  if (deadline == 0) {
+    return write_ahead_log_->Append(WriteAheadLog::PUT, key, value);
+  }
+
+  std::string record_value(reinterpret_cast<const char *>(&deadline),
+                           sizeof(deadline));
+  record_value.append(value);
+  return write_ahead_log_->Append(WriteAheadLog::PUT_WITH_DEADLINE, key,
+                                  record_value);
+}
+
+bool BackendDataStructure::WaitForLog(uint64_t lsn) {
+  DeferredDurability *deferred = deferred_durability_;
+  if (deferred == nullptr) {
+    return write_ahead_log_->WaitForDurable(lsn);
+  }
+  deferred->lsn_ = std::max(deferred->lsn_, lsn);
+  return !write_ahead_log_->has_failed();
+}
+
+WriteAheadLog::Record BackendDataStructure::PutRecordOf(
+    const std::string &key, const std::string &value, uint64_t deadline) {
+  if (deadline == 0) {
+    return WriteAheadLog::Record{0, WriteAheadLog::PUT, key, value};
+  }
+
+  std::string record_value(reinterpret_cast<const char *>(&deadline),
+                           sizeof(deadline));
+  record_value.append(value);
+  return WriteAheadLog::Record{0, WriteAheadLog::PUT_WITH_DEADLINE, key,
+                               std::move(record_value)};
+}
+
+bool BackendDataStructure::EraseLocked(Shard *shard, const std::string &key,
+                                       uint64_t version) {
+  KeepVersionLocked(shard, key, false, version);
+  bool expired = false;
+  if (!shard->deadlines.empty()) {
+    auto it = shard->deadlines.find(key);
+    if (it != shard->deadlines.end()) {
+      expired = it->second <= NowMilliseconds();
+      shard->deadlines.erase(it);
+      --num_of_expiring_keys_;
+    }
+  }
+
+  size_t previous_bytes = shard->storage->Erase(key);
+  if (previous_bytes == 0) {
+    return false;
+  }
+  if (shard->read_index != nullptr) {
+    previous_bytes += shard->read_index->Erase(key);
+  }
+  Account(shard, key, previous_bytes, 0);
+  shard->filter.Erase(key);
+  if (change_log_ != nullptr) {
+    change_log_->Append(ChangeLog::DELETE, key, std::string());
+  }
+  watch_table_.Notify(key, std::string(), true);
+  return !expired;
+}
+
+void BackendDataStructure::AddToFilterLocked(Shard *shard,
+                                             const std::string &key) {
+  // Keep the filter at most about 90% full, past which inserts start to fail
+  CuckooFilter &filter = shard->filter;
+  if ((filter.size() + 1) * 10 > filter.get_capacity() * 9 ||
+      !filter.Insert(key)) {
+    RebuildFilterLocked(shard);
+  }
+}
+
+void BackendDataStructure::RebuildFilterLocked(Shard *shard) {
+  // Built half full, so it doubles every time it fills up
+  CuckooFilter filter(shard->storage->size());
+  shard->storage->ForEach([&filter](const char *key, size_t key_size,
+                                    const char *value, size_t value_size) {
+    filter.Insert(std::string(key, key_size));
+  });
+  shard->filter = std::move(filter);
+}
+
+void BackendDataStructure::Account(Shard *shard, const std::string &key,
+                                   size_t previous_bytes, size_t bytes) {
+  if (previous_bytes == bytes) {
+    return;
+  }
+
+  std::string prefix = key.substr(0, kAccountingPrefixSize);
+  PrefixUsage &usage = shard->usage_by_prefix[prefix];
+  usage.bytes += bytes;
+  usage.bytes -= previous_bytes;
+  if (previous_bytes == 0) {
+    ++usage.num_of_keys;
+  } else if (bytes == 0) {
+    --usage.num_of_keys;
+  }
+  if (usage.num_of_keys == 0) {
+    shard->usage_by_prefix.erase(prefix);
+  }
+
+  bytes_used_ += bytes;
+  bytes_used_ -= previous_bytes;
+}
+
+std::vector<std::pair<size_t, size_t>> BackendDataStructure::GroupByShard(
+    const std::vector<std::string> &keys) const {
+  std::vector<std::pair<size_t, size_t>> order;
+  order.reserve(keys.size());
+  for (size_t i = 0; i < keys.size(); ++i) {
+    order.emplace_back(ShardIndexOf(keys[i]), i);
+  }
+  // Keys of one shard stay in the order they are given, so a key put twice
+  // in one batch ends up with its last value
+  std::sort(order.begin(), order.end());
+  return order;
+}
+
+size_t BackendDataStructure::ShardIndexOf(const std::string &key) const {
+  size_t hash = std::hash<std::string>()(key);
+  // Fold the high bits in so that the shard index does not line up with the
+  // bucket index inside the shard's own hash table
+  hash ^= (hash >> 32);
+  return hash % shards_.size();
 }
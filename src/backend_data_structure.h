@@ -1,20 +1,148 @@
 #ifndef CHIRP_SRC_BACKEND_DATA_STRUCTURE_H_
 #define CHIRP_SRC_BACKEND_DATA_STRUCTURE_H_
 
+#include <cstddef>
+#include <cstdint>
+#include <atomic>
+#include <functional>
 #include <map>
+#include <memory>
+#include <mutex>
 #include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "backend_change_log.h"
+#include "backend_cuckoo_filter.h"
+#include "backend_epoch.h"
+#include "backend_expiry_wheel.h"
+#include "backend_read_index.h"
+#include "backend_shard_storage.h"
+#include "backend_value_buffer.h"
+#include "backend_watch_table.h"
+#include "backend_write_ahead_log.h"
+#include "read_write_lock.h"
 
 // This is the backend data structure.
 // It stores the key-value mapping
 // It takes [get, put, deletekey] operations
+// The mapping is split into shards by the hash of the key. Each shard is a
+// `ShardStorage`, the storage engine picked by the storage options, guarded
+// by its own reader/writer lock, so this data structure can be used by
+// multiple threads at the same time without any outer lock.
+// The memory taken by the pairs is accounted per key prefix. Once it reaches
+// the memory limit, writes that can add memory fail until deletes make room.
+// Every shard keeps a cuckoo filter of its keys, so that `Exists()` answers
+// most missing keys without looking them up in the storage.
+// A pair can be put with a time to live. It is hidden from every read once
+// its deadline passes, and its memory is reclaimed later by `ExpireKeys()`.
+// With lock-free reads, every shard also keeps its pairs in a `ReadIndex`,
+// so that gets never wait for the shard's lock and never write to the cache
+// line of the lock. That second copy counts toward the memory limit.
+// Reads can be made at a snapshot, which sees every key as it was when the
+// snapshot was created. While a snapshot is open, every write takes a
+// version and the shard keeps the value it replaces, tagged with that
+// version. Versions are taken under the shard's writer lock, so a snapshot
+// read only needs the reader lock of each shard it reads. The old values no
+// open snapshot can read are dropped by `CollectVersions()`.
 class BackendDataStructure {
  public:
-  BackendDataStructure();
+  // The number of shards used by the default constructor
+  static const size_t kDefaultNumOfShards = 64;
 
-  // Put operation
+  // Memory is accounted by the first bytes of a key, which is the type
+  // prefix of the keys of the service
+  static const size_t kAccountingPrefixSize = 4;
+
+  // `ExpireKeys()` removes at most this many keys of a shard per call, so a
+  // shard is never locked for long
+  static const size_t kMaxExpiredKeysPerShard = 256;
+
+  // The memory taken by the keys sharing one prefix
+  struct PrefixUsage {
+    uint64_t num_of_keys;
+    uint64_t bytes;
+  };
+
+  // How often the shard locks were found taken, and how long they were
+  // waited for, in nanoseconds
+  struct LockContention {
+    uint64_t num_of_contended;
+    uint64_t wait_nanoseconds;
+  };
+
+  // Lets the writes of the calling thread return before their log records
+  // are durable, for as long as it is in scope
+  // The writes skip `WriteAheadLog::WaitForDurable()` and keep the LSN of
+  // their latest record here instead. The owner then waits for that LSN
+  // itself, or hands it to a thread that does, before it tells anyone the
+  // writes are done. The writes return false only if the log has already
+  // failed.
+  class DeferredDurability {
+   public:
+    DeferredDurability();
+    ~DeferredDurability();
+
+    DeferredDurability(const DeferredDurability &) = delete;
+    DeferredDurability &operator=(const DeferredDurability &) = delete;
+
+    // returns the LSN to wait for, or 0 if nothing was logged
+    inline uint64_t get_lsn() const { return lsn_; }
+
+   private:
+    friend class BackendDataStructure;
+
+    uint64_t lsn_;
+    // The scope this one hides, if any
+    DeferredDurability *previous_;
+  };
+
+  // Constructor that takes the number of shards and how the pairs are
+  // stored
+  // `num_of_shards` should be greater than 0. Storage kept on disk is only
+  // read once `OpenStorage()` is called.
+  explicit BackendDataStructure(
+      size_t num_of_shards = kDefaultNumOfShards,
+      const ShardStorage::Options &storage_options = ShardStorage::Options());
+
+  // Loads the pairs the storage keeps on disk and accounts for them
+  // This should be called before any other operation.
+  // returns true if this operation succeeds
+  // returns false otherwise
+  bool OpenStorage();
+
+  // Makes `Get()`, `MultiGet()` and `MultiGetFound()` read without taking
+  // any lock
+  // Every shard keeps a second copy of its pairs that readers reach through
+  // epoch-protected pointers, so writes copy every value once more and the
+  // pairs take about twice the memory, all of it counted toward the memory
+  // limit. This should be called before `OpenStorage()`.
+  void EnableLockFreeReads();
+
+  // returns true if gets take no locks
+  inline bool has_lock_free_reads() const { return epochs_ != nullptr; }
+
+  // Makes every pair put so far durable in storage kept on disk
+  // Every shard is locked as a writer only while its memtable is sealed;
+  // the flushes are waited for without any lock.
   // returns true if this operation succeeds
   // returns false otherwise
-  bool Put(const std::string &key, const std::string &value);
+  bool FlushStorage();
+
+  // Put operation
+  // A `ttl_ms` greater than 0 makes the pair expire that many milliseconds
+  // from now. Otherwise the pair never expires, even if it had a deadline.
+  // returns true if this operation succeeds
+  // returns false otherwise, including when the memory limit is reached
+  bool Put(const std::string &key, const std::string &value,
+           uint64_t ttl_ms = 0);
+
+  // Put operation that hands `value` to the storage as it is
+  // A storage that keeps `ValueBuffer`s shares `value` instead of copying
+  // it. Otherwise this is the same as the put above.
+  bool Put(const std::string &key, const ValueBuffer &value,
+           uint64_t ttl_ms = 0);
 
   // Get operation
   // This is a single get operation instead of a stream of get operations
@@ -22,14 +150,482 @@ class BackendDataStructure {
   // returns false otherwise
   bool Get(const std::string &key, std::string *output_value);
 
+  // Multi-key get operation
+  // The values are appended to `output_values` in the same order as `keys`.
+  // A key that is not found gets an empty string.
+  // Keys are grouped by shard so each shard is locked once, and only one shard
+  // is locked at a time.
+  // returns true if every key is found
+  // returns false otherwise
+  bool MultiGet(const std::vector<std::string> &keys,
+                std::vector<std::string> *output_values);
+
+  // Multi-key get operation that shares the values instead of copying them
+  // This is `MultiGet()` with the values as `ValueBuffer`s. A storage that
+  // keeps `ValueBuffer`s hands out its own; the values of the other storages
+  // and of a read index are copied once, to new buffers.
+  bool MultiGetShared(const std::vector<std::string> &keys,
+                      std::vector<ValueBuffer> *output_values);
+
+  // Multi-key get operation that skips missing keys
+  // The pairs found are appended to `output` in the same order as `keys`.
+  // Keys are grouped by shard the same way as `MultiGet()`.
+  void MultiGetFound(const std::vector<std::string> &keys,
+                     std::vector<std::pair<std::string, std::string>> *output);
+
+  // Multi-key get operation at `snapshot`, a handle from `CreateSnapshot()`
+  // The values are appended to `output_values` like `MultiGet()`, as they
+  // were when the snapshot was created. Writes made since then, including
+  // the rest of a multi-key write that was only partly applied, are not
+  // seen. Only one shard is locked at a time, as a reader.
+  // returns true if this operation succeeds
+  // returns false if the snapshot can no longer be read, because it was
+  // released or its lease ran out and its versions were collected, or it is
+  // from before a restart
+  bool MultiGetAtSnapshot(uint64_t snapshot,
+                          const std::vector<std::string> &keys,
+                          std::vector<std::string> *output_values);
+
+  // Existence check of many keys
+  // `output` is given one entry per key, in the same order as `keys`. Keys
+  // are grouped by shard the same way as `MultiGet()`, and a key the shard's
+  // filter rules out is never looked up in the storage.
+  void Exists(const std::vector<std::string> &keys, std::vector<bool> *output);
+
+  // Collects the keys in [`start`, `end`) in ascending byte order
+  // An empty `end` means there is no upper bound, and a `limit` of 0 means
+  // there is no limit. The shards are hash-partitioned, so every shard is
+  // scanned under its reader lock, one at a time, and the results are merged.
+  // An ordered storage only reads the first `limit` keys of the range in
+  // every shard; the others walk the whole shard. Only the smallest `limit`
+  // keys seen are kept along the way.
+  // Keys put after their shard is scanned may be missed.
+  void ScanKeys(const std::string &start, const std::string &end,
+                size_t limit, std::vector<std::string> *output);
+
   // Delete key operation
   // returns true if this operation succeeds
   // returns false otherwise
   bool DeleteKey(const std::string &key);
 
+  // Multi-key put operation
+  // `keys[i]` is set to `values[i]`. Keys are grouped by shard so each shard
+  // is locked once for the whole batch, and the batch waits for the
+  // write-ahead log once.
+  // returns true if this operation succeeds
+  // returns false otherwise, including when the memory limit is reached
+  bool MultiPut(const std::vector<std::string> &keys,
+                const std::vector<std::string> &values);
+
+  // Multi-key delete operation
+  // Keys are grouped by shard the same way as `MultiPut()`. Keys that are
+  // not found are skipped, and the number of keys deleted is stored in
+  // `num_of_deleted` if it is not nullptr.
+  // returns true if this operation succeeds
+  // returns false otherwise
+  bool MultiDelete(const std::vector<std::string> &keys,
+                   size_t *num_of_deleted);
+
+  // The read-modify-write operations below keep the deadline of the key they
+  // modify, and treat an expired key as missing.
+
+  // Atomically adds `delta` to the counter stored at `key`
+  // A counter is a 64-bit unsigned integer stored as 8 bytes in host byte
+  // order, the same as `Uint64ToBinary()`. A missing key is a counter of 0.
+  // The value before the addition is stored in `previous`.
+  // returns true if this operation succeeds
+  // returns false if the value is not a counter, cannot be logged, or the
+  // memory limit is reached
+  bool FetchAdd(const std::string &key, uint64_t delta, uint64_t *previous);
+
+  // Atomically replaces the value of `key` with `desired` if it is
+  // `expected`. A missing key is the same as an empty value.
+  // `swapped` tells whether the value was replaced. Otherwise the current
+  // value is stored in `actual` if it is not nullptr.
+  // returns true if this operation succeeds
+  // returns false if the write cannot be logged or the memory limit is
+  // reached
+  bool CompareAndSwap(const std::string &key, const std::string &expected,
+                      const std::string &desired, bool *swapped,
+                      std::string *actual);
+
+  // What the function given to `Update()` did to the value
+  enum UpdateResults : int { UNCHANGED = 0, CHANGED, INVALID };
+
+  // Modifies the value of one key in place
+  // The function is given the value, or an empty string if the key is
+  // missing, and returns `UNCHANGED`, `CHANGED`, or `INVALID` if the value
+  // cannot be modified.
+  typedef std::function<UpdateResults(std::string *value)> Updater;
+
+  // Runs `updater` on the value of `key` while holding the shard's writer
+  // lock, so that the read-modify-write is atomic. A changed value is logged
+  // as a put. `changed` tells whether the value is changed.
+  // returns true if this operation succeeds
+  // returns false if `updater` returns `INVALID`, the write cannot be
+  // logged, or the value grows while the memory limit is reached
+  bool Update(const std::string &key, const Updater &updater, bool *changed);
+
+  // A condition of `ApplyBatch()`: `key` should hold `expected`, or only
+  // exist if `exists` is true
+  // A missing key is the same as an empty value, like `CompareAndSwap()`.
+  struct BatchCondition {
+    std::string key;
+    std::string expected;
+    bool exists;
+  };
+
+  // One write of `ApplyBatch()`
+  struct BatchWrite {
+    enum Operations : int { PUT = 0, DELETE, UPDATE };
+
+    Operations operation;
+    std::string key;
+    // The value of a `PUT`
+    std::string value;
+    // The function an `UPDATE` runs, as in `Update()`
+    Updater updater;
+  };
+
+  // Applies `writes` in order as one transaction if every condition holds
+  // Every shard the batch touches is locked as a writer at once, in shard
+  // order, and the final value of every key is worked out before anything
+  // is written. All the writes take one version, so a snapshot sees either
+  // all of them or none, and they are logged as one batch, so they are
+  // replayed together or not at all. Reads that are not at a snapshot lock
+  // one shard at a time, and may see the batch on one shard before another.
+  // `applied` tells whether the batch is written. Otherwise the index of the
+  // first condition that does not hold is stored in `failed_condition`, and
+  // the current value of its key in `actual`, if they are not nullptr.
+  // returns true if this operation succeeds, even if a condition does not
+  // hold
+  // returns false if an update returns `INVALID`, the writes cannot be
+  // logged, or the batch puts a value while the memory limit is reached;
+  // nothing is written in the first and last cases
+  bool ApplyBatch(const std::vector<BatchCondition> &conditions,
+                  const std::vector<BatchWrite> &writes, bool *applied,
+                  size_t *failed_condition, std::string *actual);
+
+  // Opens a snapshot of every key as it is now
+  // The snapshot is released by `ReleaseSnapshot()`, or by
+  // `CollectVersions()` once `lease_ms` milliseconds have passed if
+  // `lease_ms` is greater than 0.
+  // returns the handle of the snapshot
+  uint64_t CreateSnapshot(uint64_t lease_ms = 0);
+
+  // Releases `snapshot`
+  // Its versions are dropped by the next `CollectVersions()` unless an older
+  // snapshot still needs them.
+  // returns true if this operation succeeds
+  // returns false if `snapshot` is not open
+  bool ReleaseSnapshot(uint64_t snapshot);
+
+  // Releases the snapshots whose leases have run out, then drops the old
+  // values no open snapshot can read
+  // The shards with old values are locked one at a time, as a writer.
+  // returns the number of old values dropped
+  size_t CollectVersions();
+
+  // returns the number of snapshots open
+  inline size_t get_num_of_snapshots() const { return num_of_snapshots_; }
+
+  // returns the number of old values kept for the snapshots
+  inline size_t get_num_of_versions() const { return num_of_versions_; }
+
+  // returns the number of shards
+  inline size_t get_num_of_shards() const { return shards_.size(); }
+
+  // returns the index of the shard that `key` belongs to
+  // Keys of one shard are always served by the same thread of a
+  // shared-nothing server, which routes requests with this.
+  size_t ShardIndexOf(const std::string &key) const;
+
+  // returns how the pairs are stored
+  inline ShardStorage::Modes get_storage_mode() const {
+    return storage_options_.mode;
+  }
+
+  // returns true if the pairs are kept on disk by the storage itself, so
+  // they can be made durable with `FlushStorage()` instead of a snapshot
+  inline bool is_storage_persistent() const {
+    return shards_.front()->storage->is_persistent();
+  }
+
+  // Sets the number of bytes the pairs may take before writes fail
+  // 0 means there is no limit. The limit is checked before a write, so it
+  // can be exceeded by the writes in flight.
+  inline void set_memory_limit(uint64_t bytes) { memory_limit_ = bytes; }
+
+  // returns the memory limit, or 0 if there is none
+  inline uint64_t get_memory_limit() const { return memory_limit_; }
+
+  // returns the number of bytes the pairs take, in the storages and in the
+  // read indexes
+  inline uint64_t get_bytes_used() const { return bytes_used_; }
+
+  // returns true if writes that can add memory are turned down
+  inline bool IsOverMemoryLimit() const {
+    return memory_limit_ > 0 && bytes_used_ >= memory_limit_;
+  }
+
+  // returns true if every write is turned down because the write-ahead log
+  // cannot be written
+  inline bool IsReadOnly() const {
+    return write_ahead_log_ != nullptr && write_ahead_log_->has_failed();
+  }
+
+  // Removes the keys whose deadlines have passed, at most
+  // `kMaxExpiredKeysPerShard` per shard, and logs their deletes
+  // The shards are locked one at a time.
+  // returns the number of keys removed
+  size_t ExpireKeys();
+
+  // returns the number of keys that have a deadline
+  inline size_t get_num_of_expiring_keys() const {
+    return num_of_expiring_keys_;
+  }
+
+  // Logs every key that has a deadline again, with its value and deadline
+  // Snapshots and storage kept on disk do not keep deadlines, so this is
+  // called once the log has been rotated for a snapshot: replaying the
+  // records after the snapshot gives the deadlines back.
+  // returns true if this operation succeeds
+  // returns false if the records cannot be made durable
+  bool LogExpiringKeys();
+
+  // returns the current time in milliseconds, which deadlines are given in
+  // This is the wall clock rather than a steady one so that deadlines in the
+  // write-ahead log still hold after a restart.
+  static uint64_t NowMilliseconds();
+
+  // Adds up the memory taken per key prefix into `output`
+  // Keys shorter than `kAccountingPrefixSize` are their own prefix.
+  void GetMemoryUsage(std::map<std::string, PrefixUsage> *output);
+
+  // returns the contention of every shard lock since this data structure was
+  // created, added up
+  LockContention GetLockContention() const;
+
+  // Makes every put and deletekey from now on append a record to `log`
+  // before it returns. The record is appended while the shard is locked, so
+  // the order of the records of one key is the order they are applied in.
+  // A write is applied, and seen by readers, before its record is durable.
+  // If the log then fails, the write returns false but its value is still
+  // served until a restart drops it, and every write after that is turned
+  // down (see `IsReadOnly()`) so that memory does not drift further from the
+  // log.
+  // `log` is not owned and should outlive this data structure's writers.
+  inline void SetWriteAheadLog(WriteAheadLog *log) { write_ahead_log_ = log; }
+
+  // returns the log the writes are appended to, or nullptr if they are not
+  // logged
+  inline WriteAheadLog *get_write_ahead_log() const { return write_ahead_log_; }
+
+  // Makes every change applied from now on, by any operation including
+  // replays, restores and expiry, append a change to `log`
+  // The change is appended while the shard is locked, so the changes of one
+  // key are numbered in the order they are applied. `log` is not owned and
+  // should outlive this data structure's writers.
+  inline void SetChangeLog(ChangeLog *log) { change_log_ = log; }
+
+  // returns the watchers of key prefixes, which every change applied is
+  // pushed to like it is appended to the change log
+  inline WatchTable *get_watch_table() { return &watch_table_; }
+
+  // Applies `records` read from a write-ahead log without logging them again
+  // Keys are split by shard across `num_of_threads` threads, and each thread
+  // applies the records of its shards in LSN order.
+  void Replay(const std::vector<WriteAheadLog::Record> &records,
+              size_t num_of_threads);
+
+  // Copies every key-value pair of the shard `index` to `output`
+  // Only this shard is locked, as a reader, while it is copied. Taking the
+  // shards one by one lets a snapshot run without stopping the writers of the
+  // other shards.
+  void CopyShard(size_t index,
+                 std::vector<std::pair<std::string, std::string>> *output);
+
+  // Put operation that is never logged
+  // This is used to load snapshots.
+  void Restore(const std::string &key, const std::string &value);
+
  private:
+  // The value a key had before the write that took `version`
+  // A snapshot reads the value before the first write it does not see.
+  struct Version {
+    uint64_t version;
+    // false if the key was missing
+    bool found;
+    std::string value;
+    uint64_t deadline;
+  };
+
+  // One partition of the key-value mapping
+  struct Shard {
+    ReadWriteLock lock;
+    std::unique_ptr<ShardStorage> storage;
+    // The memory of the pairs of this shard by key prefix
+    std::unordered_map<std::string, PrefixUsage> usage_by_prefix;
+    // The deadline of every key of this shard that has one, and the wheel
+    // that finds the keys whose deadlines pass
+    std::unordered_map<std::string, uint64_t> deadlines;
+    ExpiryWheel expiry_wheel;
+    // Every key of the storage of this shard
+    CuckooFilter filter;
+    // The pairs of the storage again, readable without the lock, or nullptr
+    // if lock-free reads are not enabled
+    std::unique_ptr<ReadIndex> read_index;
+    // The values replaced while snapshots were open, by key, oldest first
+    std::unordered_map<std::string, std::vector<Version>> versions;
+    // Keep neighbouring shards on different cache lines
+    char padding[64];
+  };
+
+  // Looks up `key` in `shard` like `ShardStorage::Get()`, treating an
+  // expired key as missing
+  // The shard's lock should be held, unless the shard has a read index.
+  bool GetLocked(const Shard &shard, const std::string &key,
+                 std::string *value) const;
+
+  // Looks up `key` in `shard` like the lookup above, sharing the value
+  // through `ShardStorage::GetShared()`
+  bool GetLocked(const Shard &shard, const std::string &key,
+                 ValueBuffer *value) const;
+
+  // Does `MultiGet()` with either strings or buffers as values
+  template <typename Value>
+  bool MultiGetValues(const std::vector<std::string> &keys,
+                      std::vector<Value> *output_values);
+
+  // Does the puts of both value types
+  // `shared` is `value` as a buffer to hand to the storage, or nullptr if
+  // the storage copies `value`.
+  bool PutValue(const std::string &key, const std::string &value,
+                const ValueBuffer *shared, uint64_t ttl_ms);
+
+  // Looks up `key` in `shard` as it was at `snapshot`
+  // The shard's lock should be held.
+  bool GetAtSnapshotLocked(const Shard &shard, const std::string &key,
+                           uint64_t snapshot, std::string *value) const;
+
+  // Keeps the value `key` has in `shard` for the open snapshots, before a
+  // write replaces it
+  // A missing key is only kept if `keep_missing` is true, since deleting it
+  // changes nothing. This does nothing while there are no snapshots. The
+  // shard's writer lock should be held. The write takes `version_taken`, or
+  // the next version if it is 0.
+  void KeepVersionLocked(Shard *shard, const std::string &key,
+                         bool keep_missing, uint64_t version_taken = 0);
+
+  // Looks up `key` in `shard` like `GetLocked()`, from its read index if it
+  // has one, so no lock is needed, or under its reader lock otherwise
+  bool GetFromShard(Shard *shard, const std::string &key,
+                    std::string *value);
+
+  // Adds `key`, which was just put to the storage, to the shard's filter
+  // The filter is rebuilt larger from the storage if it is too full.
+  // The shard's writer lock should be held.
+  void AddToFilterLocked(Shard *shard, const std::string &key);
+
+  // Builds the shard's filter again from the keys of its storage
+  // The shard's writer lock should be held.
+  void RebuildFilterLocked(Shard *shard);
+
+  // returns the deadline of `key` in `shard`, or 0 if it has none
+  // The shard's lock should be held.
+  uint64_t DeadlineOfLocked(const Shard &shard, const std::string &key) const;
+
+  // Sets `key` to `value` in `shard` and accounts for the change
+  // `deadline` is when the pair expires, or 0 if it never does. `version`
+  // is given to `KeepVersionLocked()`. If `shared` is not nullptr, it is
+  // `value` as a buffer, which is handed to the storage instead.
+  // The shard's writer lock should be held.
+  void PutLocked(Shard *shard, const std::string &key,
+                 const std::string &value, uint64_t deadline = 0,
+                 uint64_t version = 0, const ValueBuffer *shared = nullptr);
+
+  // Appends the put of `key` to the write-ahead log, along with `deadline`
+  // if it is not 0
+  // returns the LSN of the record, or 0 if the operations are not logged
+  uint64_t LogPut(const std::string &key, const std::string &value,
+                  uint64_t deadline);
+
+  // Blocks until the record with `lsn` is durable, or only remembers `lsn`
+  // if a `DeferredDurability` is in scope on this thread
+  // returns true if this operation succeeds
+  // returns false if the log cannot be written
+  bool WaitForLog(uint64_t lsn);
+
+  // returns the log record of the put of `key`, the same as `LogPut()`
+  // appends
+  static WriteAheadLog::Record PutRecordOf(const std::string &key,
+                                           const std::string &value,
+                                           uint64_t deadline);
+
+  // Removes `key` from `shard` and accounts for the change
+  // `version` is given to `KeepVersionLocked()`.
+  // The shard's writer lock should be held.
+  // returns true if `key` is found and not expired
+  // returns false otherwise
+  bool EraseLocked(Shard *shard, const std::string &key,
+                   uint64_t version = 0);
+
+  // Moves the memory of the pair of `key` from `previous_bytes` to `bytes`
+  // 0 bytes means there is no pair. The shard's writer lock should be held.
+  void Account(Shard *shard, const std::string &key, size_t previous_bytes,
+               size_t bytes);
+
+  // returns (shard index, position in `keys`) of every key, sorted so that
+  // keys of the same shard are next to each other
+  std::vector<std::pair<size_t, size_t>> GroupByShard(
+      const std::vector<std::string> &keys) const;
+
+  // returns the shard that `key` belongs to
+  inline Shard &ShardOf(const std::string &key) {
+    return *shards_[ShardIndexOf(key)];
+  }
+
+  // The epochs of the readers of every read index, or nullptr if lock-free
+  // reads are not enabled
+  // This is declared first so that it outlives the shards.
+  std::unique_ptr<EpochManager> epochs_;
+
   // This is where the data store
-  std::map<std::string, std::string> key_value_map_;
+  // `Shard` is neither copyable nor movable so it is kept by pointer
+  std::vector<std::unique_ptr<Shard>> shards_;
+  const ShardStorage::Options storage_options_;
+
+  // The memory taken by the pairs of all shards, and the limit
+  std::atomic<uint64_t> bytes_used_;
+  std::atomic<uint64_t> memory_limit_;
+
+  // The number of deadlines of all shards, so that `ExpireKeys()` does not
+  // lock any shard while there are none
+  std::atomic<size_t> num_of_expiring_keys_;
+
+  // nullptr if the operations are not logged
+  WriteAheadLog *write_ahead_log_;
+  // The innermost `DeferredDurability` in scope on this thread, or nullptr
+  static thread_local DeferredDurability *deferred_durability_;
+  // nullptr if the changes are not followed
+  ChangeLog *change_log_;
+  WatchTable watch_table_;
+
+  // The version the next write takes while snapshots are open
+  // A snapshot sees the writes whose versions are lower than its handle,
+  // which is this counter when it is created. The counter starts at the
+  // time of construction, so handles from before a restart are older than
+  // any this data structure can read.
+  std::atomic<uint64_t> next_version_;
+  // The oldest snapshot that can still be read
+  std::atomic<uint64_t> oldest_readable_snapshot_;
+  // Writers only keep old values while this is not 0
+  std::atomic<size_t> num_of_snapshots_;
+  std::atomic<size_t> num_of_versions_;
+  // The open snapshots and the deadlines of their leases, or 0 if they have
+  // none. Guards the creation of snapshots as well.
+  std::mutex snapshots_mutex_;
+  std::multimap<uint64_t, uint64_t> snapshots_;
 };
 
 #endif /* CHIRP_SRC_BACKEND_DATA_STRUCTURE_H_ */
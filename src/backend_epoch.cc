@@ -0,0 +1,52 @@
+#include "backend_epoch.h"
+
+#include <functional>
+#include <limits>
+#include <thread>
+
+namespace {
+// The slot this thread took last time, so that a thread keeps using the same
+// cache line
+thread_local size_t slot_hint =
+    std::hash<std::thread::id>()(std::this_thread::get_id());
+}  // Anonymous namespace
+
+const size_t EpochManager::kNumOfSlots;
+
+EpochManager::EpochManager() : epoch_(1) {
+  for (Slot &slot : slots_) {
+    slot.epoch.store(0);
+  }
+}
+
+// Every access to the epochs is sequentially consistent. A guard's pin and
+// a writer's check of the pins then happen in one order, so either the
+// writer sees the pin, or the reader sees every unlink made before the check.
+EpochManager::Guard::Guard(EpochManager *manager) : manager_(manager) {
+  uint64_t epoch = manager_->epoch_.load();
+  for (size_t i = slot_hint;; ++i) {
+    Slot &slot = manager_->slots_[i % kNumOfSlots];
+    uint64_t free = 0;
+    if (slot.epoch.load(std::memory_order_relaxed) == 0 &&
+        slot.epoch.compare_exchange_strong(free, epoch)) {
+      slot_ = i % kNumOfSlots;
+      slot_hint = slot_;
+      return;
+    }
+  }
+}
+
+EpochManager::Guard::~Guard() { manager_->slots_[slot_].epoch.store(0); }
+
+uint64_t EpochManager::Retire() { return epoch_.fetch_add(1); }
+
+uint64_t EpochManager::OldestPinnedEpoch() const {
+  uint64_t oldest = std::numeric_limits<uint64_t>::max();
+  for (const Slot &slot : slots_) {
+    uint64_t epoch = slot.epoch.load();
+    if (epoch != 0 && epoch < oldest) {
+      oldest = epoch;
+    }
+  }
+  return oldest;
+}
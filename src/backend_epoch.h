@@ -0,0 +1,64 @@
+#ifndef CHIRP_SRC_BACKEND_EPOCH_H_
+#define CHIRP_SRC_BACKEND_EPOCH_H_
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+// Epoch-based reclamation for data read without locks
+// A reader holds a `Guard` while it follows pointers to shared objects. A
+// writer unlinks an object so that new readers cannot reach it, then tags it
+// with `Retire()`. The object can be freed once `OldestPinnedEpoch()` is past
+// its tag, since every reader that could still hold it has left.
+// Readers announce themselves in one of `kNumOfSlots` slots, each on its own
+// cache line, so readers on different cores never write to the same line.
+// Any number of threads can use one manager. Writers are expected to be
+// serialized by the owner of the objects.
+class EpochManager {
+ public:
+  // At most this many guards are held at once; more wait for a free slot
+  static const size_t kNumOfSlots = 256;
+
+  EpochManager();
+
+  EpochManager(const EpochManager &) = delete;
+  EpochManager &operator=(const EpochManager &) = delete;
+
+  // Pins the current epoch in this scope
+  // Objects unlinked after the guard is taken are not freed before it is
+  // released.
+  class Guard {
+   public:
+    explicit Guard(EpochManager *manager);
+    ~Guard();
+
+    Guard(const Guard &) = delete;
+    Guard &operator=(const Guard &) = delete;
+
+   private:
+    EpochManager *manager_;
+    size_t slot_;
+  };
+
+  // Starts a new epoch
+  // This is called once objects have been unlinked.
+  // returns the tag of the objects, which is the epoch that just ended
+  uint64_t Retire();
+
+  // returns the oldest epoch pinned by a guard, or UINT64_MAX if there is
+  // none
+  // Objects whose tags are smaller than this can be freed.
+  uint64_t OldestPinnedEpoch() const;
+
+ private:
+  // 0 means the slot is free
+  struct Slot {
+    std::atomic<uint64_t> epoch;
+    char padding[64 - sizeof(std::atomic<uint64_t>)];
+  };
+
+  Slot slots_[kNumOfSlots];
+  std::atomic<uint64_t> epoch_;
+};
+
+#endif /* CHIRP_SRC_BACKEND_EPOCH_H_ */
@@ -0,0 +1,59 @@
+#include "backend_expiry_wheel.h"
+
+#include <algorithm>
+#include <utility>
+
+const size_t ExpiryWheel::kNumOfSlots;
+const uint64_t ExpiryWheel::kTickMilliseconds;
+
+ExpiryWheel::ExpiryWheel() : slots_(kNumOfSlots), next_tick_(0), size_(0) {}
+
+void ExpiryWheel::Add(const std::string &key, uint64_t deadline) {
+  // A deadline already passed goes to a slot that is not walked yet, so it is
+  // collected next time instead of one turn later
+  uint64_t tick = std::max(deadline / kTickMilliseconds, next_tick_);
+  Timer timer;
+  timer.key = key;
+  timer.deadline = deadline;
+  slots_[tick % kNumOfSlots].push_back(std::move(timer));
+  ++size_;
+}
+
+void ExpiryWheel::Collect(uint64_t now, size_t max_keys,
+                          std::vector<std::string> *keys) {
+  if (size_ == 0) {
+    next_tick_ = now / kTickMilliseconds;
+    return;
+  }
+
+  // Every slot is walked at most once, however long ago the previous
+  // collection was
+  uint64_t now_tick = now / kTickMilliseconds;
+  uint64_t tick = next_tick_;
+  if (now_tick >= kNumOfSlots && tick < now_tick - kNumOfSlots + 1) {
+    tick = now_tick - kNumOfSlots + 1;
+  }
+
+  size_t num_of_collected = 0;
+  for (; tick <= now_tick; ++tick) {
+    std::vector<Timer> &slot = slots_[tick % kNumOfSlots];
+    for (size_t i = 0; i < slot.size();) {
+      if (slot[i].deadline > now) {
+        ++i;
+        continue;
+      }
+      if (num_of_collected == max_keys) {
+        next_tick_ = tick;
+        return;
+      }
+      keys->push_back(std::move(slot[i].key));
+      ++num_of_collected;
+      --size_;
+      // The order within a slot does not matter
+      slot[i] = std::move(slot.back());
+      slot.pop_back();
+    }
+  }
+  // Keys can still be added to the current tick
+  next_tick_ = now_tick;
+}
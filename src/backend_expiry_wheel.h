@@ -0,0 +1,51 @@
+#ifndef CHIRP_SRC_BACKEND_EXPIRY_WHEEL_H_
+#define CHIRP_SRC_BACKEND_EXPIRY_WHEEL_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// A hashed timer wheel of the keys of one shard that have a deadline
+// Deadlines are in milliseconds. Time is cut into ticks of
+// `kTickMilliseconds`, and a key goes to the slot of the tick of its
+// deadline, modulo `kNumOfSlots`. Collecting walks only the slots of the
+// ticks since the previous collection, so the work is spread over time
+// instead of scanning every key. A slot also holds keys due in later turns of
+// the wheel, which are kept until their turn comes.
+// A key is never removed when its deadline changes: the owner checks the
+// current deadline of every key collected and skips the stale ones.
+// This class is not thread-safe. The shard's writer lock is held around every
+// call.
+class ExpiryWheel {
+ public:
+  // One turn of the wheel covers about 10 seconds
+  static const size_t kNumOfSlots = 1024;
+  static const uint64_t kTickMilliseconds = 10;
+
+  ExpiryWheel();
+
+  // Adds `key` to expire at `deadline`
+  void Add(const std::string &key, uint64_t deadline);
+
+  // Moves the keys whose deadlines are not after `now` to `keys`, at most
+  // `max_keys` of them
+  // A collection that stops at `max_keys` is picked up by the next one.
+  void Collect(uint64_t now, size_t max_keys, std::vector<std::string> *keys);
+
+  // returns the number of keys in the wheel, including stale ones
+  inline size_t size() const { return size_; }
+
+ private:
+  struct Timer {
+    std::string key;
+    uint64_t deadline;
+  };
+
+  std::vector<std::vector<Timer>> slots_;
+  // The first tick whose slot may still hold keys due before now
+  uint64_t next_tick_;
+  size_t size_;
+};
+
+#endif /* CHIRP_SRC_BACKEND_EXPIRY_WHEEL_H_ */
@@ -0,0 +1,77 @@
+#include "backend_latency_histogram.h"
+
+const int LatencyHistogram::kSubBucketBits;
+const size_t LatencyHistogram::kNumOfSubBuckets;
+const size_t LatencyHistogram::kNumOfBuckets;
+
+LatencyHistogram::LatencyHistogram()
+    : counts_(new std::atomic<uint64_t>[kNumOfBuckets]) {
+  for (size_t i = 0; i < kNumOfBuckets; ++i) {
+    counts_[i].store(0, std::memory_order_relaxed);
+  }
+}
+
+void LatencyHistogram::Read(Counts *counts) const {
+  counts->resize(kNumOfBuckets);
+  for (size_t i = 0; i < kNumOfBuckets; ++i) {
+    (*counts)[i] = counts_[i].load(std::memory_order_relaxed);
+  }
+}
+
+LatencyHistogram::Summary LatencyHistogram::Summarize(const Counts &counts) {
+  Summary summary = {0, 0, 0, 0, 0, 0, 0};
+  // The sum of the middles would overflow a `uint64_t` on long tails
+  double sum = 0;
+  for (size_t i = 0; i < counts.size(); ++i) {
+    if (counts[i] == 0) {
+      continue;
+    }
+    summary.count += counts[i];
+    sum += counts[i] * (LowestOf(i) / 2.0 + HighestOf(i) / 2.0);
+    summary.max = HighestOf(i);
+  }
+  if (summary.count == 0) {
+    return summary;
+  }
+  summary.mean = static_cast<uint64_t>(sum / summary.count);
+
+  // The rank of a percentile is the number of values at or below it
+  struct Percentile {
+    double fraction;
+    uint64_t *value;
+  };
+  Percentile percentiles[] = {{0.5, &summary.p50},
+                              {0.9, &summary.p90},
+                              {0.99, &summary.p99},
+                              {0.999, &summary.p999}};
+  const size_t num_of_percentiles =
+      sizeof(percentiles) / sizeof(percentiles[0]);
+  uint64_t seen = 0;
+  size_t next = 0;
+  for (size_t i = 0; i < counts.size() && next < num_of_percentiles; ++i) {
+    seen += counts[i];
+    while (next < num_of_percentiles &&
+           seen >= percentiles[next].fraction * summary.count) {
+      *percentiles[next].value = HighestOf(i);
+      ++next;
+    }
+  }
+  return summary;
+}
+
+uint64_t LatencyHistogram::LowestOf(size_t bucket) {
+  if (bucket < kNumOfSubBuckets) {
+    return bucket;
+  }
+  size_t shift = bucket / kNumOfSubBuckets - 1;
+  return static_cast<uint64_t>(bucket % kNumOfSubBuckets + kNumOfSubBuckets)
+         << shift;
+}
+
+uint64_t LatencyHistogram::HighestOf(size_t bucket) {
+  if (bucket < kNumOfSubBuckets) {
+    return bucket;
+  }
+  size_t shift = bucket / kNumOfSubBuckets - 1;
+  return LowestOf(bucket) + ((static_cast<uint64_t>(1) << shift) - 1);
+}
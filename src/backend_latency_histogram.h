@@ -0,0 +1,102 @@
+#ifndef CHIRP_SRC_BACKEND_LATENCY_HISTOGRAM_H_
+#define CHIRP_SRC_BACKEND_LATENCY_HISTOGRAM_H_
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+// A histogram of latencies in nanoseconds, with buckets laid out the way
+// HdrHistogram does
+// Values below `kNumOfSubBuckets` get a bucket each. Above that, every power
+// of two is cut into `kNumOfSubBuckets` buckets of the same width, so a value
+// is known within 1 / `kNumOfSubBuckets` of itself whatever its magnitude.
+// Recording a value is one relaxed atomic increment of its bucket, with no
+// lock and nothing else shared between the recording threads, so it can stay
+// on for every request. The count, mean and maximum are worked out from the
+// buckets when the histogram is read.
+class LatencyHistogram {
+ public:
+  // Every power of two is cut into 2^`kSubBucketBits` buckets
+  static const int kSubBucketBits = 5;
+  static const size_t kNumOfSubBuckets = static_cast<size_t>(1)
+                                         << kSubBucketBits;
+  // Enough buckets for any `uint64_t`
+  static const size_t kNumOfBuckets = (64 - kSubBucketBits + 1) *
+                                      kNumOfSubBuckets;
+
+  // The count of every bucket at one point
+  typedef std::vector<uint64_t> Counts;
+
+  // What the counts of a histogram add up to
+  // Percentiles and the maximum are the highest value of the bucket they fall
+  // in, and the mean takes every value as the middle of its bucket. All of
+  // them are 0 if nothing is counted.
+  struct Summary {
+    uint64_t count;
+    uint64_t mean;
+    uint64_t p50;
+    uint64_t p90;
+    uint64_t p99;
+    uint64_t p999;
+    uint64_t max;
+  };
+
+  LatencyHistogram();
+
+  LatencyHistogram(const LatencyHistogram &) = delete;
+  LatencyHistogram &operator=(const LatencyHistogram &) = delete;
+
+  // Counts `value`; any thread may call this
+  inline void Record(uint64_t value) {
+    counts_[BucketOf(value)].fetch_add(1, std::memory_order_relaxed);
+  }
+
+  // Copies the count of every bucket to `counts`
+  // Values recorded while this runs may or may not be copied.
+  void Read(Counts *counts) const;
+
+  // returns what `counts` add up to
+  static Summary Summarize(const Counts &counts);
+
+  // returns the bucket `value` falls in
+  static inline size_t BucketOf(uint64_t value) {
+    if (value < kNumOfSubBuckets) {
+      return value;
+    }
+    int shift = 63 - __builtin_clzll(value) - kSubBucketBits;
+    return (shift + 1) * kNumOfSubBuckets +
+           ((value >> shift) - kNumOfSubBuckets);
+  }
+
+  // returns the lowest and the highest value of `bucket`
+  static uint64_t LowestOf(size_t bucket);
+  static uint64_t HighestOf(size_t bucket);
+
+ private:
+  std::unique_ptr<std::atomic<uint64_t>[]> counts_;
+};
+
+// Records the time from its construction to its destruction in a histogram
+class LatencyRecorder {
+ public:
+  explicit LatencyRecorder(LatencyHistogram *histogram)
+      : histogram_(histogram), begin_(std::chrono::steady_clock::now()) {}
+
+  ~LatencyRecorder() {
+    histogram_->Record(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                           std::chrono::steady_clock::now() - begin_)
+                           .count());
+  }
+
+  LatencyRecorder(const LatencyRecorder &) = delete;
+  LatencyRecorder &operator=(const LatencyRecorder &) = delete;
+
+ private:
+  LatencyHistogram *histogram_;
+  std::chrono::steady_clock::time_point begin_;
+};
+
+#endif /* CHIRP_SRC_BACKEND_LATENCY_HISTOGRAM_H_ */
@@ -0,0 +1,270 @@
+#include "backend_list_value.h"
+
+#include <vector>
+
+namespace {
+// Protobuf wire types
+const int kVarint = 0;
+const int kFixed64 = 1;
+const int kLengthDelimited = 2;
+const int kFixed32 = 5;
+
+// One top-level field of a serialized message
+struct Field {
+  uint32_t number;
+  int wire_type;
+  // Where the field starts (its tag) and ends in the message
+  size_t begin;
+  size_t end;
+  // Where the payload of a length-delimited field starts
+  size_t payload_begin;
+  // The value of a varint field
+  uint64_t varint;
+};
+
+// Reads a varint starting at `*offset` and moves `*offset` past it
+// returns true if this operation succeeds
+// returns false otherwise
+bool ReadVarint(const std::string &data, size_t end, size_t *offset,
+                uint64_t *value) {
+  *value = 0;
+  for (int shift = 0; shift < 64 && *offset < end; shift += 7) {
+    uint8_t byte = static_cast<uint8_t>(data[(*offset)++]);
+    *value |= static_cast<uint64_t>(byte & 0x7F) << shift;
+    if ((byte & 0x80) == 0) {
+      return true;
+    }
+  }
+  return false;
+}
+
+void AppendVarint(std::string *output, uint64_t value) {
+  while (value >= 0x80) {
+    output->push_back(static_cast<char>((value & 0x7F) | 0x80));
+    value >>= 7;
+  }
+  output->push_back(static_cast<char>(value));
+}
+
+// Splits `message` into its top-level fields
+// returns true if this operation succeeds
+// returns false if `message` is not a valid protobuf message
+bool ParseFields(const std::string &message, std::vector<Field> *fields) {
+  size_t offset = 0;
+  while (offset < message.size()) {
+    Field field;
+    field.begin = offset;
+    uint64_t tag;
+    if (!ReadVarint(message, message.size(), &offset, &tag) || tag >> 3 == 0) {
+      return false;
+    }
+    field.number = static_cast<uint32_t>(tag >> 3);
+    field.wire_type = static_cast<int>(tag & 7);
+    field.varint = 0;
+
+    uint64_t length;
+    switch (field.wire_type) {
+      case kVarint:
+        if (!ReadVarint(message, message.size(), &offset, &field.varint)) {
+          return false;
+        }
+        break;
+      case kFixed64:
+        offset += 8;
+        break;
+      case kLengthDelimited:
+        if (!ReadVarint(message, message.size(), &offset, &length) ||
+            length > message.size() - offset) {
+          return false;
+        }
+        field.payload_begin = offset;
+        offset += length;
+        break;
+      case kFixed32:
+        offset += 4;
+        break;
+      default:
+        // Groups are not supported
+        return false;
+    }
+    if (offset > message.size()) {
+      return false;
+    }
+    field.end = offset;
+    fields->push_back(field);
+  }
+  return true;
+}
+
+// Decodes the elements of a packed uint64 list
+// returns true if this operation succeeds
+// returns false otherwise
+bool ParsePacked(const std::string &message, const Field &field,
+                 std::vector<uint64_t> *elements) {
+  size_t offset = field.payload_begin;
+  while (offset < field.end) {
+    uint64_t element;
+    if (!ReadVarint(message, field.end, &offset, &element)) {
+      return false;
+    }
+    elements->push_back(element);
+  }
+  return true;
+}
+
+// returns true if the length-delimited `field` holds exactly `element`
+inline bool PayloadEquals(const std::string &message, const Field &field,
+                          const std::string &element) {
+  return field.end - field.payload_begin == element.size() &&
+         message.compare(field.payload_begin, element.size(), element) == 0;
+}
+
+// Stores in `found` whether the uint64 list `number` has `element`
+// returns true if this operation succeeds
+// returns false if a packed list is not valid
+bool Contains(const std::string &message, const std::vector<Field> &fields,
+              uint32_t number, uint64_t element, bool *found) {
+  *found = false;
+  for (const Field &field : fields) {
+    if (field.number != number) {
+      continue;
+    }
+    if (field.wire_type == kVarint && field.varint == element) {
+      *found = true;
+    } else if (field.wire_type == kLengthDelimited) {
+      std::vector<uint64_t> elements;
+      if (!ParsePacked(message, field, &elements)) {
+        return false;
+      }
+      for (uint64_t packed : elements) {
+        *found |= packed == element;
+      }
+    }
+  }
+  return true;
+}
+}  // Anonymous namespace
+
+bool ListValue::Append(std::string *message, uint32_t field, uint64_t element,
+                       bool if_absent, bool *changed) {
+  std::vector<Field> fields;
+  if (!ParseFields(*message, &fields)) {
+    return false;
+  }
+
+  bool found = false;
+  if (if_absent && !Contains(*message, fields, field, element, &found)) {
+    return false;
+  }
+  *changed = !found;
+  if (found) {
+    return true;
+  }
+
+  AppendVarint(message, (static_cast<uint64_t>(field) << 3) | kVarint);
+  AppendVarint(message, element);
+  return true;
+}
+
+bool ListValue::Append(std::string *message, uint32_t field,
+                       const std::string &element, bool if_absent,
+                       bool *changed) {
+  std::vector<Field> fields;
+  if (!ParseFields(*message, &fields)) {
+    return false;
+  }
+
+  *changed = true;
+  if (if_absent) {
+    for (const Field &existing : fields) {
+      if (existing.number == field &&
+          existing.wire_type == kLengthDelimited &&
+          PayloadEquals(*message, existing, element)) {
+        *changed = false;
+        return true;
+      }
+    }
+  }
+
+  AppendVarint(message,
+               (static_cast<uint64_t>(field) << 3) | kLengthDelimited);
+  AppendVarint(message, element.size());
+  message->append(element);
+  return true;
+}
+
+bool ListValue::Remove(std::string *message, uint32_t field, uint64_t element,
+                       bool *changed) {
+  std::vector<Field> fields;
+  if (!ParseFields(*message, &fields)) {
+    return false;
+  }
+
+  *changed = false;
+  std::string output;
+  for (const Field &existing : fields) {
+    if (existing.number == field && existing.wire_type == kVarint &&
+        existing.varint == element) {
+      *changed = true;
+      continue;
+    }
+
+    if (existing.number == field &&
+        existing.wire_type == kLengthDelimited) {
+      std::vector<uint64_t> elements;
+      if (!ParsePacked(*message, existing, &elements)) {
+        return false;
+      }
+      std::string payload;
+      bool removed = false;
+      for (uint64_t packed : elements) {
+        if (packed == element) {
+          removed = true;
+        } else {
+          AppendVarint(&payload, packed);
+        }
+      }
+      if (removed) {
+        *changed = true;
+        if (!payload.empty()) {
+          AppendVarint(&output,
+                       (static_cast<uint64_t>(field) << 3) | kLengthDelimited);
+          AppendVarint(&output, payload.size());
+          output.append(payload);
+        }
+        continue;
+      }
+    }
+
+    output.append(*message, existing.begin, existing.end - existing.begin);
+  }
+
+  if (*changed) {
+    message->swap(output);
+  }
+  return true;
+}
+
+bool ListValue::Remove(std::string *message, uint32_t field,
+                       const std::string &element, bool *changed) {
+  std::vector<Field> fields;
+  if (!ParseFields(*message, &fields)) {
+    return false;
+  }
+
+  *changed = false;
+  std::string output;
+  for (const Field &existing : fields) {
+    if (existing.number == field && existing.wire_type == kLengthDelimited &&
+        PayloadEquals(*message, existing, element)) {
+      *changed = true;
+      continue;
+    }
+    output.append(*message, existing.begin, existing.end - existing.begin);
+  }
+
+  if (*changed) {
+    message->swap(output);
+  }
+  return true;
+}
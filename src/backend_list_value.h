@@ -0,0 +1,48 @@
+#ifndef CHIRP_SRC_BACKEND_LIST_VALUE_H_
+#define CHIRP_SRC_BACKEND_LIST_VALUE_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+// Edits one repeated field of a serialized protobuf message in place, without
+// knowing the message type. This lets the backend append an element to a
+// list-valued key, or remove one from it, without the whole value being sent
+// back and forth.
+//
+// `field` is the field number of a `repeated uint64` or `repeated string`
+// (or `bytes`) field at the top level of the message. Elements are appended
+// at the end of the message, which protobuf parses as if they were at the end
+// of the list. Removing an element rewrites only the fields holding it;
+// packed uint64 lists are repacked without it.
+// An empty value is an empty message.
+class ListValue {
+ public:
+  // Appends `element` to the uint64 list `field` of `message`
+  // If `if_absent` is true, nothing is appended when the list has `element`.
+  // `changed` tells whether `message` is modified.
+  // returns true if this operation succeeds
+  // returns false if `message` is not a valid protobuf message
+  static bool Append(std::string *message, uint32_t field, uint64_t element,
+                     bool if_absent, bool *changed);
+
+  // Appends `element` to the string list `field` of `message`
+  // Behaves the same as the uint64 version.
+  static bool Append(std::string *message, uint32_t field,
+                     const std::string &element, bool if_absent,
+                     bool *changed);
+
+  // Removes every `element` from the uint64 list `field` of `message`
+  // `changed` tells whether `message` is modified.
+  // returns true if this operation succeeds
+  // returns false if `message` is not a valid protobuf message
+  static bool Remove(std::string *message, uint32_t field, uint64_t element,
+                     bool *changed);
+
+  // Removes every `element` from the string list `field` of `message`
+  // Behaves the same as the uint64 version.
+  static bool Remove(std::string *message, uint32_t field,
+                     const std::string &element, bool *changed);
+};
+
+#endif /* CHIRP_SRC_BACKEND_LIST_VALUE_H_ */
@@ -0,0 +1,1022 @@
+#include "backend_lsm_storage.h"
+
+#include <dirent.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <stdio.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <algorithm>
+#include <atomic>
+#include <cstdlib>
+#include <cstring>
+#include <deque>
+#include <functional>
+#include <thread>
+#include <utility>
+
+#include "hash.h"
+
+namespace {
+const char kRunMagic[8] = {'C', 'H', 'I', 'R', 'P', 'R', 'U', 'N'};
+const char kManifestMagic[8] = {'C', 'H', 'I', 'R', 'P', 'M', 'A', 'N'};
+// u32 key size, u32 value size, u8 deleted
+const size_t kEntryHeaderSize = 2 * sizeof(uint32_t) + 1;
+const size_t kFooterSize = 5 * sizeof(uint64_t) + sizeof(kRunMagic);
+// Every run file is written through a buffer of this size
+const size_t kWriteBufferSize = 64 << 10;
+// What a memtable entry is charged on top of its key and value
+const size_t kMemtableEntryOverhead = 64;
+// The number of background threads shared by every shard
+const size_t kNumOfWorkerThreads = 2;
+
+template <typename T>
+inline void AppendFixed(std::string *output, const T &input) {
+  output->append(reinterpret_cast<const char *>(&input), sizeof(T));
+}
+
+template <typename T>
+inline T ReadFixed(const char *input) {
+  T ret;
+  std::memcpy(&ret, input, sizeof(T));
+  return ret;
+}
+
+// Writes all of `data` to the end of `fd`
+// returns true if this operation succeeds
+// returns false otherwise
+bool WriteAll(int fd, const std::string &data) {
+  size_t written = 0;
+  while (written < data.size()) {
+    ssize_t ret = write(fd, data.data() + written, data.size() - written);
+    if (ret < 0) {
+      if (errno == EINTR) {
+        continue;
+      }
+      return false;
+    }
+    written += ret;
+  }
+  return true;
+}
+
+// fsyncs `directory` so that the files created and renamed in it are durable
+bool SyncDirectory(const std::string &directory) {
+  int fd = open(directory.c_str(), O_RDONLY);
+  if (fd < 0) {
+    return false;
+  }
+  bool ok = fsync(fd) == 0;
+  close(fd);
+  return ok;
+}
+
+// The hash of the bloom filters
+// It is written to disk with the filters, so it cannot depend on the
+// standard library.
+inline uint64_t BloomHash(const char *data, size_t size) {
+  return HashBytes(data, size);
+}
+
+// Calls `visit` with the bit index of every probe of `hash` in a filter of
+// `num_of_bits` bits
+template <typename Visit>
+inline void ForEachBloomProbe(uint64_t hash, uint64_t num_of_bits,
+                              uint64_t num_of_hashes, Visit visit) {
+  // Double hashing, as in LevelDB
+  uint64_t delta = (hash >> 17) | (hash << 47);
+  for (uint64_t i = 0; i < num_of_hashes; ++i) {
+    visit(hash % num_of_bits);
+    hash += delta;
+  }
+}
+
+// Compares two byte strings the way `std::string` does
+inline int CompareKeys(const char *a, size_t a_size, const char *b,
+                       size_t b_size) {
+  int ret = std::memcmp(a, b, std::min(a_size, b_size));
+  if (ret != 0) {
+    return ret;
+  }
+  return a_size < b_size ? -1 : (a_size > b_size ? 1 : 0);
+}
+}  // Anonymous namespace
+
+// Runs the flushes and compactions of every LSM shard of the process
+// The threads are shared so that their number does not grow with the number
+// of shards.
+class LsmWorker {
+ public:
+  // returns the worker of the process, started when it is first needed and
+  // stopped once no shard holds it
+  static std::shared_ptr<LsmWorker> Shared() {
+    static std::mutex mutex;
+    static std::weak_ptr<LsmWorker> shared;
+    std::lock_guard<std::mutex> guard(mutex);
+    std::shared_ptr<LsmWorker> worker = shared.lock();
+    if (worker == nullptr) {
+      worker = std::make_shared<LsmWorker>();
+      shared = worker;
+    }
+    return worker;
+  }
+
+  LsmWorker() : stopping_(false) {
+    for (size_t i = 0; i < kNumOfWorkerThreads; ++i) {
+      threads_.emplace_back(&LsmWorker::Run, this);
+    }
+  }
+
+  // Runs the jobs left and joins the threads
+  ~LsmWorker() {
+    {
+      std::lock_guard<std::mutex> guard(mutex_);
+      stopping_ = true;
+    }
+    cv_.notify_all();
+    for (auto &thread : threads_) {
+      thread.join();
+    }
+  }
+
+  void Schedule(std::function<void()> job) {
+    {
+      std::lock_guard<std::mutex> guard(mutex_);
+      jobs_.push_back(std::move(job));
+    }
+    cv_.notify_one();
+  }
+
+ private:
+  void Run() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    while (true) {
+      cv_.wait(lock, [this]() { return stopping_ || !jobs_.empty(); });
+      if (jobs_.empty()) {
+        return;
+      }
+      std::function<void()> job = std::move(jobs_.front());
+      jobs_.pop_front();
+      lock.unlock();
+      job();
+      lock.lock();
+    }
+  }
+
+  std::mutex mutex_;
+  std::condition_variable cv_;
+  std::deque<std::function<void()>> jobs_;
+  bool stopping_;
+  std::vector<std::thread> threads_;
+};
+
+// One immutable run file, memory-mapped
+class LsmRun {
+ public:
+  // returns the run at `path`, or nullptr if it cannot be opened
+  static std::shared_ptr<LsmRun> Open(const std::string &path,
+                                      uint64_t number) {
+    int fd = open(path.c_str(), O_RDONLY);
+    if (fd < 0) {
+      return nullptr;
+    }
+    struct stat file_stat;
+    if (fstat(fd, &file_stat) != 0 ||
+        static_cast<size_t>(file_stat.st_size) < kFooterSize) {
+      close(fd);
+      return nullptr;
+    }
+    size_t file_size = file_stat.st_size;
+    void *mapped = mmap(nullptr, file_size, PROT_READ, MAP_SHARED, fd, 0);
+    close(fd);
+    if (mapped == MAP_FAILED) {
+      return nullptr;
+    }
+
+    std::shared_ptr<LsmRun> run(new LsmRun(path, number, mapped, file_size));
+    if (!run->LoadFooter()) {
+      return nullptr;
+    }
+    return run;
+  }
+
+  // Unmaps the file, and removes it if it is obsolete
+  ~LsmRun() {
+    munmap(const_cast<char *>(base_), file_size_);
+    if (obsolete_) {
+      unlink(path_.c_str());
+    }
+  }
+
+  LsmRun(const LsmRun &) = delete;
+  LsmRun &operator=(const LsmRun &) = delete;
+
+  inline uint64_t get_number() const { return number_; }
+
+  // Makes the file go away once the run is no longer used
+  inline void MarkObsolete() { obsolete_ = true; }
+
+  // returns the end of the entries
+  inline size_t get_entries_end() const { return index_offset_; }
+
+  // Decodes the entry at `offset`
+  // returns the offset of the next entry
+  inline size_t ReadEntry(size_t offset, const char **key, size_t *key_size,
+                          const char **value, size_t *value_size,
+                          bool *deleted) const {
+    *key_size = ReadFixed<uint32_t>(base_ + offset);
+    *value_size = ReadFixed<uint32_t>(base_ + offset + sizeof(uint32_t));
+    *deleted = base_[offset + 2 * sizeof(uint32_t)] != 0;
+    *key = base_ + offset + kEntryHeaderSize;
+    *value = *key + *key_size;
+    return offset + kEntryHeaderSize + *key_size + *value_size;
+  }
+
+  // returns the offset of the last indexed entry not after `key`, from
+  // which the entries are read to find `key` or the first one after it
+  size_t SeekOffset(const std::string &key) const {
+    auto it = std::upper_bound(
+        index_.begin(), index_.end(), key,
+        [](const std::string &target,
+           const std::pair<std::string, uint64_t> &entry) {
+          return target < entry.first;
+        });
+    return it == index_.begin() ? 0 : (it - 1)->second;
+  }
+
+  // Looks `key` up
+  // returns true if the run has a version of `key`, which is stored in
+  // `deleted`, `value` and `value_size`
+  // returns false otherwise
+  bool Find(const std::string &key, bool *deleted, const char **value,
+            size_t *value_size) const {
+    bool maybe = true;
+    ForEachBloomProbe(BloomHash(key.data(), key.size()), bloom_size_ * 8,
+                      num_of_hashes_, [this, &maybe](uint64_t bit) {
+                        maybe &= (bloom_[bit / 8] >> (bit % 8)) & 1;
+                      });
+    if (!maybe) {
+      return false;
+    }
+
+    // The last indexed entry not after `key`
+    auto it = std::upper_bound(
+        index_.begin(), index_.end(), key,
+        [](const std::string &target,
+           const std::pair<std::string, uint64_t> &entry) {
+          return target < entry.first;
+        });
+    if (it == index_.begin()) {
+      return false;
+    }
+    size_t offset = (it - 1)->second;
+    size_t end = it == index_.end() ? index_offset_ : it->second;
+    while (offset < end) {
+      const char *entry_key;
+      size_t key_size;
+      offset = ReadEntry(offset, &entry_key, &key_size, value, value_size,
+                         deleted);
+      int order = CompareKeys(entry_key, key_size, key.data(), key.size());
+      if (order == 0) {
+        return true;
+      } else if (order > 0) {
+        return false;
+      }
+    }
+    return false;
+  }
+
+ private:
+  LsmRun(const std::string &path, uint64_t number, void *mapped,
+         size_t file_size)
+      : path_(path),
+        number_(number),
+        base_(static_cast<const char *>(mapped)),
+        file_size_(file_size),
+        obsolete_(false) {}
+
+  // Checks the footer and loads the index
+  // returns true if this operation succeeds
+  // returns false if the file is not a valid run
+  bool LoadFooter() {
+    const char *footer = base_ + file_size_ - kFooterSize;
+    if (std::memcmp(footer + 5 * sizeof(uint64_t), kRunMagic,
+                    sizeof(kRunMagic)) != 0) {
+      return false;
+    }
+    index_offset_ = ReadFixed<uint64_t>(footer);
+    uint64_t num_of_index_entries = ReadFixed<uint64_t>(footer + 8);
+    uint64_t bloom_offset = ReadFixed<uint64_t>(footer + 16);
+    bloom_size_ = ReadFixed<uint64_t>(footer + 24);
+    num_of_hashes_ = ReadFixed<uint64_t>(footer + 32);
+    size_t footer_offset = file_size_ - kFooterSize;
+    if (index_offset_ > bloom_offset || bloom_offset > footer_offset ||
+        bloom_size_ != footer_offset - bloom_offset || bloom_size_ == 0) {
+      return false;
+    }
+    bloom_ = reinterpret_cast<const uint8_t *>(base_ + bloom_offset);
+
+    size_t offset = index_offset_;
+    for (uint64_t i = 0; i < num_of_index_entries; ++i) {
+      if (offset + sizeof(uint32_t) > bloom_offset) {
+        return false;
+      }
+      uint32_t key_size = ReadFixed<uint32_t>(base_ + offset);
+      offset += sizeof(uint32_t);
+      if (offset + key_size + sizeof(uint64_t) > bloom_offset) {
+        return false;
+      }
+      std::string key(base_ + offset, key_size);
+      offset += key_size;
+      uint64_t entry_offset = ReadFixed<uint64_t>(base_ + offset);
+      offset += sizeof(uint64_t);
+      if (entry_offset >= index_offset_) {
+        return false;
+      }
+      index_.emplace_back(std::move(key), entry_offset);
+    }
+    return true;
+  }
+
+  const std::string path_;
+  const uint64_t number_;
+  const char *base_;
+  const size_t file_size_;
+  std::atomic<bool> obsolete_;
+
+  size_t index_offset_;
+  // The key and the offset of every `kIndexInterval`th entry
+  std::vector<std::pair<std::string, uint64_t>> index_;
+  const uint8_t *bloom_;
+  uint64_t bloom_size_;
+  uint64_t num_of_hashes_;
+};
+
+namespace {
+// Writes a run file, entry by entry in ascending key order
+class LsmRunWriter {
+ public:
+  explicit LsmRunWriter(const std::string &path)
+      : path_(path),
+        fd_(open(path.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644)),
+        ok_(fd_ >= 0),
+        offset_(0),
+        num_of_entries_(0),
+        finished_(false) {}
+
+  // Removes the file if it is not finished
+  ~LsmRunWriter() {
+    if (fd_ >= 0) {
+      close(fd_);
+    }
+    if (!finished_) {
+      unlink(path_.c_str());
+    }
+  }
+
+  LsmRunWriter(const LsmRunWriter &) = delete;
+  LsmRunWriter &operator=(const LsmRunWriter &) = delete;
+
+  inline uint64_t get_num_of_entries() const { return num_of_entries_; }
+
+  void Add(const char *key, size_t key_size, const char *value,
+           size_t value_size, bool deleted) {
+    if (num_of_entries_ % LsmShardStorage::kIndexInterval == 0) {
+      AppendFixed<uint32_t>(&index_, key_size);
+      index_.append(key, key_size);
+      AppendFixed<uint64_t>(&index_, offset_ + buffer_.size());
+    }
+    hashes_.push_back(BloomHash(key, key_size));
+    ++num_of_entries_;
+
+    AppendFixed<uint32_t>(&buffer_, key_size);
+    AppendFixed<uint32_t>(&buffer_, value_size);
+    buffer_.push_back(deleted ? 1 : 0);
+    buffer_.append(key, key_size);
+    buffer_.append(value, value_size);
+    if (buffer_.size() >= kWriteBufferSize) {
+      FlushBuffer();
+    }
+  }
+
+  // Writes the index, the bloom filter and the footer, and fsyncs the file
+  // returns true if this operation succeeds
+  // returns false otherwise
+  bool Finish() {
+    uint64_t index_offset = offset_ + buffer_.size();
+    uint64_t num_of_index_entries =
+        (num_of_entries_ + LsmShardStorage::kIndexInterval - 1) /
+        LsmShardStorage::kIndexInterval;
+    buffer_.append(index_);
+
+    uint64_t bloom_offset = offset_ + buffer_.size();
+    uint64_t num_of_bits =
+        std::max<uint64_t>(64, hashes_.size() *
+                                   LsmShardStorage::kBloomBitsPerKey);
+    uint64_t bloom_size = (num_of_bits + 7) / 8;
+    // About ln(2) hashes per bit per key
+    uint64_t num_of_hashes = LsmShardStorage::kBloomBitsPerKey * 69 / 100;
+    std::string bloom(bloom_size, '\0');
+    for (uint64_t hash : hashes_) {
+      ForEachBloomProbe(hash, bloom_size * 8, num_of_hashes,
+                        [&bloom](uint64_t bit) {
+                          bloom[bit / 8] |= static_cast<char>(1 << (bit % 8));
+                        });
+    }
+    buffer_.append(bloom);
+
+    AppendFixed<uint64_t>(&buffer_, index_offset);
+    AppendFixed<uint64_t>(&buffer_, num_of_index_entries);
+    AppendFixed<uint64_t>(&buffer_, bloom_offset);
+    AppendFixed<uint64_t>(&buffer_, bloom_size);
+    AppendFixed<uint64_t>(&buffer_, num_of_hashes);
+    buffer_.append(kRunMagic, sizeof(kRunMagic));
+    FlushBuffer();
+
+    finished_ = ok_ && fsync(fd_) == 0;
+    return finished_;
+  }
+
+ private:
+  void FlushBuffer() {
+    ok_ = ok_ && WriteAll(fd_, buffer_);
+    offset_ += buffer_.size();
+    buffer_.clear();
+  }
+
+  const std::string path_;
+  int fd_;
+  bool ok_;
+  uint64_t offset_;
+  std::string buffer_;
+  std::string index_;
+  std::vector<uint64_t> hashes_;
+  uint64_t num_of_entries_;
+  bool finished_;
+};
+
+// Walks the versions of one source in ascending key order
+class LsmCursor {
+ public:
+  virtual ~LsmCursor() {}
+  virtual bool Valid() const = 0;
+  virtual void Next() = 0;
+  virtual const char *key() const = 0;
+  virtual size_t key_size() const = 0;
+  virtual const char *value() const = 0;
+  virtual size_t value_size() const = 0;
+  virtual bool deleted() const = 0;
+};
+
+// Walks a memtable from the first key not before `start`
+template <typename Memtable>
+class MemtableCursor final : public LsmCursor {
+ public:
+  explicit MemtableCursor(const Memtable &memtable,
+                          const std::string &start = "")
+      : it_(memtable.lower_bound(start)), end_(memtable.end()) {}
+
+  bool Valid() const override { return it_ != end_; }
+  void Next() override { ++it_; }
+  const char *key() const override { return it_->first.data(); }
+  size_t key_size() const override { return it_->first.size(); }
+  const char *value() const override { return it_->second.value.data(); }
+  size_t value_size() const override { return it_->second.value.size(); }
+  bool deleted() const override { return it_->second.deleted; }
+
+ private:
+  typename Memtable::const_iterator it_;
+  typename Memtable::const_iterator end_;
+};
+
+// Walks a run from the first key not before `start`
+class RunCursor final : public LsmCursor {
+ public:
+  explicit RunCursor(const LsmRun &run, const std::string &start = "")
+      : run_(run), next_(run.SeekOffset(start)) {
+    Next();
+    while (valid_ && CompareKeys(key_, key_size_, start.data(),
+                                 start.size()) < 0) {
+      Next();
+    }
+  }
+
+  bool Valid() const override { return valid_; }
+  void Next() override {
+    valid_ = next_ < run_.get_entries_end();
+    if (valid_) {
+      next_ = run_.ReadEntry(next_, &key_, &key_size_, &value_, &value_size_,
+                             &deleted_);
+    }
+  }
+  const char *key() const override { return key_; }
+  size_t key_size() const override { return key_size_; }
+  const char *value() const override { return value_; }
+  size_t value_size() const override { return value_size_; }
+  bool deleted() const override { return deleted_; }
+
+ private:
+  const LsmRun &run_;
+  size_t next_;
+  bool valid_;
+  const char *key_;
+  size_t key_size_;
+  const char *value_;
+  size_t value_size_;
+  bool deleted_;
+};
+
+// Walks `cursors`, given newest first, in ascending key order and calls
+// `visit` with the newest version of every key until it returns false
+void Merge(const std::vector<std::unique_ptr<LsmCursor>> &cursors,
+           const std::function<bool(const LsmCursor &)> &visit) {
+  while (true) {
+    LsmCursor *newest = nullptr;
+    for (const auto &cursor : cursors) {
+      // On a tie the newer cursor, which comes first, is kept
+      if (cursor->Valid() &&
+          (newest == nullptr ||
+           CompareKeys(cursor->key(), cursor->key_size(), newest->key(),
+                       newest->key_size()) < 0)) {
+        newest = cursor.get();
+      }
+    }
+    if (newest == nullptr) {
+      return;
+    }
+
+    if (!visit(*newest)) {
+      return;
+    }
+    // Skip the older versions of the key before moving past it
+    for (const auto &cursor : cursors) {
+      if (cursor.get() != newest && cursor->Valid() &&
+          CompareKeys(cursor->key(), cursor->key_size(), newest->key(),
+                      newest->key_size()) == 0) {
+        cursor->Next();
+      }
+    }
+    newest->Next();
+  }
+}
+}  // Anonymous namespace
+
+const size_t LsmShardStorage::kMaxRunsPerShard;
+const size_t LsmShardStorage::kMaxSealedMemtables;
+const size_t LsmShardStorage::kIndexInterval;
+const size_t LsmShardStorage::kBloomBitsPerKey;
+
+LsmShardStorage::LsmShardStorage(const std::string &directory, size_t index,
+                                 size_t memtable_size)
+    : directory_(directory),
+      index_(index),
+      memtable_size_(memtable_size),
+      memtable_(),
+      memtable_bytes_(0),
+      size_(0),
+      version_(std::make_shared<Version>()),
+      next_run_number_(1),
+      opened_(false),
+      flush_scheduled_(false),
+      compaction_scheduled_(false),
+      flush_failed_(false),
+      worker_(LsmWorker::Shared()) {}
+
+LsmShardStorage::~LsmShardStorage() {
+  // Whatever is in the memtable is written out so that a clean shutdown
+  // does not depend on the write-ahead log
+  Seal();
+  std::unique_lock<std::mutex> lock(mutex_);
+  cv_.wait(lock,
+           [this]() { return !flush_scheduled_ && !compaction_scheduled_; });
+}
+
+bool LsmShardStorage::Open() {
+  if (mkdir(directory_.c_str(), 0755) != 0 && errno != EEXIST) {
+    return false;
+  }
+
+  // The manifest is the live runs, newest first, after the next run number
+  std::vector<uint64_t> run_numbers;
+  uint64_t next_run_number = 1;
+  int fd = open(ManifestPath().c_str(), O_RDONLY);
+  if (fd >= 0) {
+    std::string content;
+    char buffer[4096];
+    ssize_t ret;
+    while ((ret = read(fd, buffer, sizeof(buffer))) > 0) {
+      content.append(buffer, ret);
+    }
+    close(fd);
+    if (ret < 0 || content.size() < sizeof(kManifestMagic) + 16 ||
+        std::memcmp(content.data(), kManifestMagic, sizeof(kManifestMagic)) !=
+            0) {
+      return false;
+    }
+    const char *data = content.data() + sizeof(kManifestMagic);
+    next_run_number = ReadFixed<uint64_t>(data);
+    uint64_t num_of_runs = ReadFixed<uint64_t>(data + 8);
+    if (content.size() !=
+        sizeof(kManifestMagic) + (2 + num_of_runs) * sizeof(uint64_t)) {
+      return false;
+    }
+    for (uint64_t i = 0; i < num_of_runs; ++i) {
+      run_numbers.push_back(ReadFixed<uint64_t>(data + (2 + i) * 8));
+    }
+  } else if (errno != ENOENT) {
+    return false;
+  }
+
+  std::shared_ptr<Version> version = std::make_shared<Version>();
+  for (uint64_t number : run_numbers) {
+    std::shared_ptr<LsmRun> run = LsmRun::Open(RunPath(number), number);
+    if (run == nullptr) {
+      return false;
+    }
+    version->runs.push_back(run);
+  }
+
+  // Runs written after the last manifest, or replaced by a compaction just
+  // before a crash
+  DIR *dir = opendir(directory_.c_str());
+  if (dir == nullptr) {
+    return false;
+  }
+  std::string prefix = std::to_string(index_) + "-";
+  while (struct dirent *entry = readdir(dir)) {
+    std::string name(entry->d_name);
+    if (name.compare(0, prefix.size(), prefix) != 0) {
+      continue;
+    }
+    uint64_t number = std::strtoull(name.c_str() + prefix.size(), nullptr, 10);
+    if (name != prefix + std::to_string(number) + ".run" ||
+        std::find(run_numbers.begin(), run_numbers.end(), number) ==
+            run_numbers.end()) {
+      unlink((directory_ + "/" + name).c_str());
+    }
+  }
+  closedir(dir);
+
+  {
+    std::lock_guard<std::mutex> guard(mutex_);
+    version_ = version;
+    next_run_number_ = next_run_number;
+    opened_ = true;
+  }
+
+  size_ = 0;
+  ForEach([this](const char *, size_t, const char *, size_t) { ++size_; });
+  return true;
+}
+
+bool LsmShardStorage::Get(const std::string &key, std::string *value) const {
+  size_t value_size;
+  return LookUp(key, value, &value_size) == FOUND;
+}
+
+size_t LsmShardStorage::Put(const std::string &key, const std::string &value) {
+  size_t previous = 0;
+  auto it = memtable_.find(key);
+  if (it != memtable_.end()) {
+    if (!it->second.deleted) {
+      previous = BytesOf(key.size(), it->second.value.size());
+    }
+    memtable_bytes_ += value.size();
+    memtable_bytes_ -= it->second.value.size();
+    it->second.value = value;
+    it->second.deleted = false;
+  } else {
+    size_t value_size;
+    if (LookUp(key, nullptr, &value_size) == FOUND) {
+      previous = BytesOf(key.size(), value_size);
+    }
+    memtable_.emplace(key, Entry{value, false});
+    memtable_bytes_ += key.size() + value.size() + kMemtableEntryOverhead;
+  }
+
+  if (previous == 0) {
+    ++size_;
+  }
+  if (memtable_bytes_ >= memtable_size_) {
+    Seal();
+  }
+  return previous;
+}
+
+size_t LsmShardStorage::Erase(const std::string &key) {
+  size_t value_size;
+  if (LookUp(key, nullptr, &value_size) != FOUND) {
+    return 0;
+  }
+
+  // The tombstone hides the versions in the sealed memtables and the runs
+  auto it = memtable_.find(key);
+  if (it != memtable_.end()) {
+    memtable_bytes_ -= it->second.value.size();
+    it->second.value.clear();
+    it->second.deleted = true;
+  } else {
+    memtable_.emplace(key, Entry{std::string(), true});
+    memtable_bytes_ += key.size() + kMemtableEntryOverhead;
+  }
+
+  --size_;
+  if (memtable_bytes_ >= memtable_size_) {
+    Seal();
+  }
+  return BytesOf(key.size(), value_size);
+}
+
+void LsmShardStorage::ForEach(const Visitor &visitor) const {
+  Scan("", "", 0, visitor);
+}
+
+void LsmShardStorage::Scan(const std::string &start, const std::string &end,
+                           size_t limit, const Visitor &visitor) const {
+  std::shared_ptr<const Version> version = CurrentVersion();
+  std::vector<std::unique_ptr<LsmCursor>> cursors;
+  cursors.emplace_back(new MemtableCursor<Memtable>(memtable_, start));
+  for (const auto &sealed : version->sealed) {
+    cursors.emplace_back(new MemtableCursor<Memtable>(*sealed, start));
+  }
+  for (const auto &run : version->runs) {
+    cursors.emplace_back(new RunCursor(*run, start));
+  }
+
+  size_t num_of_visited = 0;
+  Merge(cursors, [&](const LsmCursor &cursor) {
+    if (!end.empty() && CompareKeys(cursor.key(), cursor.key_size(),
+                                    end.data(), end.size()) >= 0) {
+      return false;
+    }
+    if (!cursor.deleted()) {
+      visitor(cursor.key(), cursor.key_size(), cursor.value(),
+              cursor.value_size());
+      ++num_of_visited;
+    }
+    return limit == 0 || num_of_visited < limit;
+  });
+}
+
+void LsmShardStorage::SealMemtable() { Seal(); }
+
+bool LsmShardStorage::WaitForFlushes() {
+  std::unique_lock<std::mutex> lock(mutex_);
+  cv_.wait(lock, [this]() { return !flush_scheduled_; });
+  return opened_ && !flush_failed_ && version_->sealed.empty();
+}
+
+size_t LsmShardStorage::get_num_of_runs() const {
+  return CurrentVersion()->runs.size();
+}
+
+LsmShardStorage::LookUpResults LsmShardStorage::LookUp(
+    const std::string &key, std::string *value, size_t *value_size) const {
+  // Looks `key` up in one memtable
+  auto look_up_memtable = [&key, value, value_size](
+                              const Memtable &memtable,
+                              LookUpResults *result) {
+    auto it = memtable.find(key);
+    if (it == memtable.end()) {
+      return false;
+    }
+    *result = it->second.deleted ? DELETED : FOUND;
+    *value_size = it->second.value.size();
+    if (value != nullptr && *result == FOUND) {
+      *value = it->second.value;
+    }
+    return true;
+  };
+
+  LookUpResults result;
+  if (look_up_memtable(memtable_, &result)) {
+    return result;
+  }
+
+  std::shared_ptr<const Version> version = CurrentVersion();
+  for (const auto &sealed : version->sealed) {
+    if (look_up_memtable(*sealed, &result)) {
+      return result;
+    }
+  }
+  for (const auto &run : version->runs) {
+    bool deleted;
+    const char *run_value;
+    if (run->Find(key, &deleted, &run_value, value_size)) {
+      if (deleted) {
+        return DELETED;
+      }
+      if (value != nullptr) {
+        value->assign(run_value, *value_size);
+      }
+      return FOUND;
+    }
+  }
+  return MISSING;
+}
+
+std::shared_ptr<const LsmShardStorage::Version>
+LsmShardStorage::CurrentVersion() const {
+  std::lock_guard<std::mutex> guard(mutex_);
+  return version_;
+}
+
+void LsmShardStorage::Seal() {
+  if (memtable_.empty()) {
+    return;
+  }
+
+  std::unique_lock<std::mutex> lock(mutex_);
+  // Writers are held back while the background thread catches up, so that
+  // the sealed memtables do not pile up in memory. They are let through if
+  // flushes keep failing.
+  cv_.wait(lock, [this]() {
+    return version_->sealed.size() < kMaxSealedMemtables || flush_failed_ ||
+           !opened_;
+  });
+
+  std::shared_ptr<Version> version = std::make_shared<Version>(*version_);
+  version->sealed.insert(version->sealed.begin(),
+                         std::make_shared<const Memtable>(std::move(memtable_)));
+  version_ = version;
+  memtable_.clear();
+  memtable_bytes_ = 0;
+
+  if (opened_ && !flush_scheduled_) {
+    flush_scheduled_ = true;
+    worker_->Schedule([this]() { FlushSealed(); });
+  }
+}
+
+void LsmShardStorage::FlushSealed() {
+  while (true) {
+    std::shared_ptr<const Memtable> memtable;
+    uint64_t number;
+    {
+      std::lock_guard<std::mutex> guard(mutex_);
+      if (version_->sealed.empty()) {
+        flush_scheduled_ = false;
+        if (version_->runs.size() > kMaxRunsPerShard &&
+            !compaction_scheduled_) {
+          compaction_scheduled_ = true;
+          worker_->Schedule([this]() { Compact(); });
+        }
+        cv_.notify_all();
+        return;
+      }
+      memtable = version_->sealed.back();
+      number = next_run_number_++;
+    }
+
+    std::shared_ptr<LsmRun> run;
+    {
+      LsmRunWriter writer(RunPath(number));
+      for (const auto &pair : *memtable) {
+        writer.Add(pair.first.data(), pair.first.size(),
+                   pair.second.value.data(), pair.second.value.size(),
+                   pair.second.deleted);
+      }
+      if (writer.Finish()) {
+        run = LsmRun::Open(RunPath(number), number);
+      }
+    }
+
+    bool ok = run != nullptr;
+    if (ok) {
+      std::lock_guard<std::mutex> manifest_guard(manifest_mutex_);
+      std::vector<uint64_t> run_numbers;
+      uint64_t next_run_number;
+      {
+        std::lock_guard<std::mutex> guard(mutex_);
+        std::shared_ptr<Version> version =
+            std::make_shared<Version>(*version_);
+        version->sealed.pop_back();
+        version->runs.insert(version->runs.begin(), run);
+        version_ = version;
+        for (const auto &live : version->runs) {
+          run_numbers.push_back(live->get_number());
+        }
+        next_run_number = next_run_number_;
+      }
+      ok = WriteManifest(run_numbers, next_run_number);
+    }
+
+    std::lock_guard<std::mutex> guard(mutex_);
+    flush_failed_ = !ok;
+    if (!ok) {
+      // The sealed memtables stay readable, and are written again on the
+      // next seal
+      flush_scheduled_ = false;
+      cv_.notify_all();
+      return;
+    }
+    cv_.notify_all();
+  }
+}
+
+void LsmShardStorage::Compact() {
+  std::vector<std::shared_ptr<LsmRun>> inputs = CurrentVersion()->runs;
+  uint64_t number;
+  {
+    std::lock_guard<std::mutex> guard(mutex_);
+    number = next_run_number_++;
+  }
+
+  // The output holds the oldest data of the shard, so the tombstones have
+  // nothing left to hide and are dropped
+  std::shared_ptr<LsmRun> output;
+  bool ok;
+  {
+    LsmRunWriter writer(RunPath(number));
+    std::vector<std::unique_ptr<LsmCursor>> cursors;
+    for (const auto &run : inputs) {
+      cursors.emplace_back(new RunCursor(*run));
+    }
+    Merge(cursors, [&writer](const LsmCursor &cursor) {
+      if (!cursor.deleted()) {
+        writer.Add(cursor.key(), cursor.key_size(), cursor.value(),
+                   cursor.value_size(), false);
+      }
+      return true;
+    });
+    bool empty = writer.get_num_of_entries() == 0;
+    ok = writer.Finish();
+    if (ok && empty) {
+      unlink(RunPath(number).c_str());
+    } else if (ok) {
+      output = LsmRun::Open(RunPath(number), number);
+      ok = output != nullptr;
+    }
+  }
+
+  if (ok) {
+    std::lock_guard<std::mutex> manifest_guard(manifest_mutex_);
+    std::vector<uint64_t> run_numbers;
+    uint64_t next_run_number;
+    {
+      std::lock_guard<std::mutex> guard(mutex_);
+      // Runs flushed during the compaction are newer than the inputs, which
+      // are still the oldest runs
+      std::shared_ptr<Version> version = std::make_shared<Version>(*version_);
+      version->runs.resize(version->runs.size() - inputs.size());
+      if (output != nullptr) {
+        version->runs.push_back(output);
+      }
+      version_ = version;
+      for (const auto &live : version->runs) {
+        run_numbers.push_back(live->get_number());
+      }
+      next_run_number = next_run_number_;
+    }
+    ok = WriteManifest(run_numbers, next_run_number);
+  }
+
+  if (ok) {
+    // The files go away once the readers still using them are done
+    for (const auto &run : inputs) {
+      run->MarkObsolete();
+    }
+  } else if (output != nullptr) {
+    output->MarkObsolete();
+  }
+
+  std::lock_guard<std::mutex> guard(mutex_);
+  compaction_scheduled_ = false;
+  cv_.notify_all();
+}
+
+bool LsmShardStorage::WriteManifest(const std::vector<uint64_t> &run_numbers,
+                                    uint64_t next_run_number) {
+  std::string content(kManifestMagic, sizeof(kManifestMagic));
+  AppendFixed<uint64_t>(&content, next_run_number);
+  AppendFixed<uint64_t>(&content, run_numbers.size());
+  for (uint64_t number : run_numbers) {
+    AppendFixed<uint64_t>(&content, number);
+  }
+
+  std::string temporary_path = ManifestPath() + ".tmp";
+  int fd = open(temporary_path.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+  if (fd < 0) {
+    return false;
+  }
+  bool ok = WriteAll(fd, content) && fsync(fd) == 0;
+  close(fd);
+
+  // Syncing the directory also makes the new runs' entries durable
+  ok = ok && rename(temporary_path.c_str(), ManifestPath().c_str()) == 0 &&
+       SyncDirectory(directory_);
+  if (!ok) {
+    unlink(temporary_path.c_str());
+  }
+  return ok;
+}
+
+std::string LsmShardStorage::RunPath(uint64_t number) const {
+  return directory_ + "/" + std::to_string(index_) + "-" +
+         std::to_string(number) + ".run";
+}
+
+std::string LsmShardStorage::ManifestPath() const {
+  return directory_ + "/" + std::to_string(index_) + ".manifest";
+}
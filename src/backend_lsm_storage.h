@@ -0,0 +1,165 @@
+#ifndef CHIRP_SRC_BACKEND_LSM_STORAGE_H_
+#define CHIRP_SRC_BACKEND_LSM_STORAGE_H_
+
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "backend_shard_storage.h"
+
+class LsmRun;
+class LsmWorker;
+
+// One shard of a log-structured merge tree
+// Writes go to a sorted in-memory memtable. A full memtable is sealed and
+// written by a background thread to a sorted run file on disk, so the pairs
+// of a shard are the memtable, the sealed memtables not written yet, and the
+// runs, newest first. A delete is a tombstone that hides the older versions
+// of its key until a compaction drops them.
+// Once a shard has more than `kMaxRunsPerShard` runs, the background thread
+// merges all of them into one. Lookups never wait for flushes or compactions:
+// they take the current list of runs under a short lock and search it
+// without any lock.
+//
+// A run file is memory-mapped and laid out as:
+//   entries: u32 key size, u32 value size, u8 deleted, key bytes, value bytes
+//            in ascending key order
+//   index:   u32 key size, key bytes, u64 file offset of every
+//            `kIndexInterval`th entry
+//   bloom:   the bits of the bloom filter of every key
+//   footer:  u64 index offset, u64 number of index entries, u64 bloom offset,
+//            u64 number of bloom bytes, u64 number of hashes, char[8] magic
+// Which runs are live, newest first, is in the shard's manifest file, which
+// is replaced atomically. Files not in the manifest are left over from a
+// crash and are removed when the shard is opened.
+//
+// Recently written pairs are served from the memtables and recently read
+// ones from the page cache, so hot keys stay in memory while cold ones only
+// take disk space. `BytesOf()` is the logical size of a pair, wherever it is.
+class LsmShardStorage final : public ShardStorage {
+ public:
+  // A shard compacts its runs once it has more than this many
+  static const size_t kMaxRunsPerShard = 4;
+  // Writers wait once this many sealed memtables are not written yet
+  static const size_t kMaxSealedMemtables = 2;
+  // One entry of every this many is in the index of a run
+  static const size_t kIndexInterval = 16;
+  // The size of the bloom filters
+  static const size_t kBloomBitsPerKey = 10;
+
+  // Constructor that takes the directory of the files, the index of the shard
+  // and the number of bytes a memtable holds before it is sealed
+  LsmShardStorage(const std::string &directory, size_t index,
+                  size_t memtable_size);
+
+  // Waits for the background work of this shard
+  ~LsmShardStorage();
+
+  LsmShardStorage(const LsmShardStorage &) = delete;
+  LsmShardStorage &operator=(const LsmShardStorage &) = delete;
+
+  bool Get(const std::string &key, std::string *value) const override;
+  size_t Put(const std::string &key, const std::string &value) override;
+  size_t Erase(const std::string &key) override;
+  void ForEach(const Visitor &visitor) const override;
+  void Scan(const std::string &start, const std::string &end, size_t limit,
+            const Visitor &visitor) const override;
+  inline size_t size() const override { return size_; }
+  inline size_t BytesOf(size_t key_size, size_t value_size) const override {
+    return key_size + value_size;
+  }
+
+  // Opens the runs in the manifest and removes the files left over
+  bool Open() override;
+  inline bool is_persistent() const override { return true; }
+  inline bool is_ordered() const override { return true; }
+  void SealMemtable() override;
+  bool WaitForFlushes() override;
+
+  // returns the number of runs on disk
+  size_t get_num_of_runs() const;
+
+ private:
+  // A version of a key in a memtable
+  struct Entry {
+    std::string value;
+    bool deleted;
+  };
+  typedef std::map<std::string, Entry> Memtable;
+
+  // What the shard holds besides the memtable
+  // A version is never modified once it is published, so readers can keep
+  // using one while the background thread replaces it.
+  struct Version {
+    // Both newest first
+    std::vector<std::shared_ptr<const Memtable>> sealed;
+    std::vector<std::shared_ptr<LsmRun>> runs;
+  };
+
+  // Where `key` is found
+  enum LookUpResults { MISSING = 0, FOUND, DELETED };
+
+  // Looks `key` up from the newest version to the oldest
+  // The value is stored in `value` if it is not nullptr, and its size in
+  // `value_size`.
+  LookUpResults LookUp(const std::string &key, std::string *value,
+                       size_t *value_size) const;
+
+  // returns the current version
+  std::shared_ptr<const Version> CurrentVersion() const;
+
+  // Seals the memtable if it is not empty and schedules its flush
+  void Seal();
+
+  // Writes the sealed memtables to runs, oldest first
+  // This is run by the background thread.
+  void FlushSealed();
+
+  // Merges every run into one
+  // This is run by the background thread.
+  void Compact();
+
+  // Writes the manifest listing `run_numbers`, newest first, and the number
+  // of the next run
+  // returns true if this operation succeeds
+  // returns false otherwise
+  bool WriteManifest(const std::vector<uint64_t> &run_numbers,
+                     uint64_t next_run_number);
+
+  // returns the path of the run `number` and of the manifest
+  std::string RunPath(uint64_t number) const;
+  std::string ManifestPath() const;
+
+  const std::string directory_;
+  const size_t index_;
+  const size_t memtable_size_;
+
+  // Guarded by the shard's lock
+  Memtable memtable_;
+  size_t memtable_bytes_;
+  size_t size_;
+
+  // Guards the members below it
+  mutable std::mutex mutex_;
+  std::condition_variable cv_;
+  std::shared_ptr<const Version> version_;
+  uint64_t next_run_number_;
+  // Nothing is written to disk before `Open()` succeeds
+  bool opened_;
+  bool flush_scheduled_;
+  bool compaction_scheduled_;
+  // Whether the last flush failed
+  bool flush_failed_;
+
+  // Only one manifest is written at a time, in the order of the versions
+  std::mutex manifest_mutex_;
+
+  std::shared_ptr<LsmWorker> worker_;
+};
+
+#endif /* CHIRP_SRC_BACKEND_LSM_STORAGE_H_ */
@@ -0,0 +1,180 @@
+#include "backend_read_index.h"
+
+#include <algorithm>
+#include <functional>
+
+#include "backend_shard_storage.h"
+
+namespace {
+// The number of buckets of a new index
+const size_t kMinNumOfBuckets = 16;
+
+// Multiplier of Fibonacci hashing
+// The shard of a key is picked from the low bits of the same hash, so the
+// bucket is taken from the high bits of a scrambled hash instead.
+const uint64_t kHashMultiplier = 0x9E3779B97F4A7C15ULL;
+
+inline size_t BucketOf(uint64_t hash, size_t mask) {
+  return static_cast<size_t>((hash * kHashMultiplier) >> 32) & mask;
+}
+}  // Anonymous namespace
+
+const size_t ReadIndex::kMinNumOfRetiredToReclaim;
+
+ReadIndex::Table::Table(size_t num_of_buckets)
+    : mask(num_of_buckets - 1),
+      buckets(new std::atomic<Node *>[num_of_buckets]) {
+  for (size_t i = 0; i < num_of_buckets; ++i) {
+    buckets[i].store(nullptr, std::memory_order_relaxed);
+  }
+}
+
+ReadIndex::ReadIndex(EpochManager *epochs)
+    : epochs_(epochs),
+      table_(new Table(kMinNumOfBuckets)),
+      size_(0),
+      retired_(),
+      num_of_retired_to_reclaim_(kMinNumOfRetiredToReclaim) {}
+
+ReadIndex::~ReadIndex() {
+  // There are no readers left, so everything can go
+  Table *table = table_.load();
+  for (size_t i = 0; i <= table->mask; ++i) {
+    Node *node = table->buckets[i].load();
+    while (node != nullptr) {
+      Node *next = node->next.load();
+      delete node;
+      node = next;
+    }
+  }
+  delete table;
+  for (const Retired &retired : retired_) {
+    delete retired.node;
+    delete retired.table;
+  }
+}
+
+// The links are loaded and stored sequentially consistent, which
+// `EpochManager` relies on to order the unlinks before its check of the
+// readers. These are plain loads on x86, and stores only happen in writers.
+bool ReadIndex::Get(const std::string &key, uint64_t (*clock)(),
+                    std::string *value) const {
+  EpochManager::Guard guard(epochs_);
+  std::atomic<Node *> *link;
+  const Node *node = Find(key, std::hash<std::string>()(key), &link);
+  if (node == nullptr || (node->deadline != 0 && node->deadline <= clock())) {
+    return false;
+  }
+
+  if (value != nullptr) {
+    *value = node->value;
+  }
+  return true;
+}
+
+size_t ReadIndex::Put(const std::string &key, const std::string &value,
+                      uint64_t deadline) {
+  uint64_t hash = std::hash<std::string>()(key);
+  std::atomic<Node *> *link;
+  Node *previous = Find(key, hash, &link);
+  Node *node = new Node(key, value, hash, deadline);
+  if (previous != nullptr) {
+    node->next.store(previous->next.load());
+    link->store(node);
+    size_t previous_bytes =
+        BytesOf(previous->key.size(), previous->value.size());
+    retired_.push_back(Retired{epochs_->Retire(), previous, nullptr});
+    Reclaim();
+    return previous_bytes;
+  }
+
+  // A new key goes to the end of its bucket, which `Find()` returned
+  link->store(node);
+  ++size_;
+  if (size_ > table_.load()->mask + 1) {
+    Grow();
+  }
+  return 0;
+}
+
+size_t ReadIndex::Erase(const std::string &key) {
+  std::atomic<Node *> *link;
+  Node *node = Find(key, std::hash<std::string>()(key), &link);
+  if (node == nullptr) {
+    return 0;
+  }
+
+  link->store(node->next.load());
+  --size_;
+  size_t bytes = BytesOf(node->key.size(), node->value.size());
+  retired_.push_back(Retired{epochs_->Retire(), node, nullptr});
+  Reclaim();
+  return bytes;
+}
+
+size_t ReadIndex::BytesOf(size_t key_size, size_t value_size) {
+  // A node holds the pair, and the bucket array about one pointer per node
+  return ShardStorage::MallocChunkSizeOf(sizeof(Node)) + sizeof(void *) +
+         ShardStorage::StringHeapSizeOf(key_size) +
+         ShardStorage::StringHeapSizeOf(value_size);
+}
+
+ReadIndex::Node *ReadIndex::Find(const std::string &key, uint64_t hash,
+                                 std::atomic<Node *> **link) const {
+  Table *table = table_.load();
+  *link = &table->buckets[BucketOf(hash, table->mask)];
+  // Every link is loaded once: a writer may change it after it is read
+  Node *node = (*link)->load();
+  while (node != nullptr && (node->hash != hash || node->key != key)) {
+    *link = &node->next;
+    node = (*link)->load();
+  }
+  return node;
+}
+
+void ReadIndex::Grow() {
+  // Nodes cannot be in two tables at once, so they are copied
+  Table *previous = table_.load();
+  Table *table = new Table((previous->mask + 1) * 2);
+  for (size_t i = 0; i <= previous->mask; ++i) {
+    for (Node *node = previous->buckets[i].load(); node != nullptr;
+         node = node->next.load()) {
+      Node *copy = new Node(node->key, node->value, node->hash,
+                            node->deadline);
+      std::atomic<Node *> &bucket =
+          table->buckets[BucketOf(node->hash, table->mask)];
+      copy->next.store(bucket.load(std::memory_order_relaxed),
+                       std::memory_order_relaxed);
+      bucket.store(copy, std::memory_order_relaxed);
+    }
+  }
+  table_.store(table);
+
+  uint64_t epoch = epochs_->Retire();
+  for (size_t i = 0; i <= previous->mask; ++i) {
+    for (Node *node = previous->buckets[i].load(); node != nullptr;
+         node = node->next.load()) {
+      retired_.push_back(Retired{epoch, node, nullptr});
+    }
+  }
+  retired_.push_back(Retired{epoch, nullptr, previous});
+  Reclaim();
+}
+
+void ReadIndex::Reclaim() {
+  if (retired_.size() < num_of_retired_to_reclaim_) {
+    return;
+  }
+
+  uint64_t oldest = epochs_->OldestPinnedEpoch();
+  auto freeable = std::partition(
+      retired_.begin(), retired_.end(),
+      [oldest](const Retired &retired) { return retired.epoch >= oldest; });
+  for (auto it = freeable; it != retired_.end(); ++it) {
+    delete it->node;
+    delete it->table;
+  }
+  retired_.erase(freeable, retired_.end());
+  num_of_retired_to_reclaim_ =
+      std::max(kMinNumOfRetiredToReclaim, retired_.size() * 2);
+}
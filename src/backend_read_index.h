@@ -0,0 +1,110 @@
+#ifndef CHIRP_SRC_BACKEND_READ_INDEX_H_
+#define CHIRP_SRC_BACKEND_READ_INDEX_H_
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "backend_epoch.h"
+
+// A copy of the pairs of one shard that can be read without any lock
+// This is a chained hash table of immutable nodes. A write never changes a
+// node that readers can see: it links a new node in place of the old one
+// with a single atomic store, so a reader finds either the old or the new
+// pair and never a partial one. Unlinked nodes are freed through the
+// `EpochManager` once no reader can hold them. Growing the table builds a
+// new one next to the old one and swaps the pointer to it.
+// `Get()` can be called by any number of threads without a lock. The other
+// methods need the shard's writer lock, so there is one writer at a time.
+class ReadIndex {
+ public:
+  // Unlinked nodes are freed once there are this many, or twice as many as
+  // were left the previous time
+  static const size_t kMinNumOfRetiredToReclaim = 64;
+
+  // Constructor that takes the epochs shared by the readers of every shard
+  // `epochs` is not owned and should outlive this index.
+  explicit ReadIndex(EpochManager *epochs);
+  ~ReadIndex();
+
+  ReadIndex(const ReadIndex &) = delete;
+  ReadIndex &operator=(const ReadIndex &) = delete;
+
+  // Looks up `key` and copies its value to `value` if it is not nullptr
+  // A key with a deadline is treated as missing once `clock()` reaches it.
+  // `clock` is only called for keys that have a deadline.
+  // returns true if `key` is found and not expired
+  // returns false otherwise
+  bool Get(const std::string &key, uint64_t (*clock)(),
+           std::string *value) const;
+
+  // Sets `key` to `value`, expiring at `deadline` or never if it is 0
+  // returns the number of bytes the previous pair of `key` took, or 0 if
+  // `key` is new
+  size_t Put(const std::string &key, const std::string &value,
+             uint64_t deadline);
+
+  // Removes `key` if it is there
+  // returns the number of bytes the pair took, or 0 if `key` is not found
+  size_t Erase(const std::string &key);
+
+  // returns the number of bytes a pair of these sizes takes in an index,
+  // estimated the same way as by the shard storages
+  static size_t BytesOf(size_t key_size, size_t value_size);
+
+  // returns the number of pairs
+  inline size_t size() const { return size_; }
+
+ private:
+  // Everything but `next` is written before the node is linked
+  struct Node {
+    Node(const std::string &key, const std::string &value, uint64_t hash,
+         uint64_t deadline)
+        : key(key), value(value), hash(hash), deadline(deadline),
+          next(nullptr) {}
+
+    const std::string key;
+    const std::string value;
+    const uint64_t hash;
+    const uint64_t deadline;
+    std::atomic<Node *> next;
+  };
+
+  struct Table {
+    explicit Table(size_t num_of_buckets);
+
+    // The number of buckets is a power of 2
+    size_t mask;
+    std::unique_ptr<std::atomic<Node *>[]> buckets;
+  };
+
+  // A node or a table that may still be read
+  struct Retired {
+    uint64_t epoch;
+    Node *node;
+    Table *table;
+  };
+
+  // Points `link` to the link to the node of `key`, or to the null link at
+  // the end of its bucket
+  // returns the node of `key`, or nullptr if it is not found
+  Node *Find(const std::string &key, uint64_t hash,
+             std::atomic<Node *> **link) const;
+
+  // Moves every pair to a table with twice as many buckets
+  void Grow();
+
+  // Frees the retired nodes and tables no reader can hold anymore
+  void Reclaim();
+
+  EpochManager *epochs_;
+  std::atomic<Table *> table_;
+  size_t size_;
+  std::vector<Retired> retired_;
+  size_t num_of_retired_to_reclaim_;
+};
+
+#endif /* CHIRP_SRC_BACKEND_READ_INDEX_H_ */
@@ -0,0 +1,244 @@
+#include "backend_replication.h"
+
+#include <algorithm>
+#include <utility>
+
+#include <grpcpp/channel.h>
+#include <grpcpp/create_channel.h>
+#include <grpcpp/security/credentials.h>
+
+const size_t ReplicationServiceImpl::kMaxRecordsPerBatch;
+const uint64_t ReplicationServiceImpl::kPollIntervalMs;
+const uint64_t BackupReplicator::kReconnectIntervalMs;
+
+// Start of `ReplicationServiceImpl` definitions
+ReplicationServiceImpl::ReplicationServiceImpl(BackendDataStructure *data,
+                                               WriteAheadLog *log,
+                                               ReplicationLog *replication_log)
+    : data_(data), log_(log), replication_log_(replication_log) {}
+
+grpc::Status ReplicationServiceImpl::replicate(
+    grpc::ServerContext *context,
+    grpc::ServerReaderWriter<chirp::ReplicationBatch, chirp::ReplicationAck>
+        *stream) {
+  chirp::ReplicationAck first_ack;
+  if (!stream->Read(&first_ack)) {
+    return grpc::Status::OK;
+  }
+
+  // The acks are read in their own thread while this one writes
+  size_t id = replication_log_->AddBackup();
+  // A backup that has every record already is in sync at once
+  replication_log_->Acknowledge(id, first_ack.applied_lsn());
+  std::thread ack_reader([this, stream, id]() {
+    chirp::ReplicationAck ack;
+    while (stream->Read(&ack)) {
+      replication_log_->Acknowledge(id, ack.applied_lsn());
+    }
+  });
+
+  uint64_t next_lsn = first_ack.applied_lsn() + 1;
+  std::vector<WriteAheadLog::Record> records;
+  bool ok = true;
+  while (ok && !context->IsCancelled()) {
+    records.clear();
+    if (!replication_log_->Read(next_lsn, kMaxRecordsPerBatch,
+                                std::chrono::milliseconds(kPollIntervalMs),
+                                &records)) {
+      uint64_t lsn;
+      ok = SendCopy(stream, &lsn);
+      next_lsn = lsn + 1;
+      continue;
+    }
+    if (records.empty()) {
+      continue;
+    }
+
+    chirp::ReplicationBatch batch;
+    for (WriteAheadLog::Record &record : records) {
+      chirp::ReplicationRecord *shipped = batch.add_records();
+      shipped->set_lsn(record.lsn);
+      shipped->set_operation(record.operation);
+      shipped->mutable_key()->swap(record.key);
+      shipped->mutable_value()->swap(record.value);
+    }
+    batch.set_lsn(records.back().lsn);
+    ok = stream->Write(batch);
+    next_lsn = records.back().lsn + 1;
+  }
+
+  // Unblocks the reader if the backup is still there
+  context->TryCancel();
+  ack_reader.join();
+  replication_log_->RemoveBackup(id);
+  return grpc::Status::OK;
+}
+
+bool ReplicationServiceImpl::SendCopy(
+    grpc::ServerReaderWriter<chirp::ReplicationBatch, chirp::ReplicationAck>
+        *stream,
+    uint64_t *lsn) {
+  // Records are appended and applied under the same shard lock, so every
+  // record up to `lsn` is in the shards by now. Records after it may be in
+  // the copy as well; applying them again gives the same pairs.
+  *lsn = log_->get_last_lsn();
+  // The copy has no deadlines, which are sent again as records after `lsn`
+  data_->LogExpiringKeys();
+
+  chirp::ReplicationBatch batch;
+  batch.set_reset(true);
+  if (!stream->Write(batch)) {
+    return false;
+  }
+
+  std::vector<std::pair<std::string, std::string>> pairs;
+  for (size_t i = 0; i < data_->get_num_of_shards(); ++i) {
+    pairs.clear();
+    data_->CopyShard(i, &pairs);
+    for (size_t begin = 0; begin < pairs.size();
+         begin += kMaxRecordsPerBatch) {
+      size_t end = std::min(pairs.size(), begin + kMaxRecordsPerBatch);
+      batch.Clear();
+      for (size_t j = begin; j < end; ++j) {
+        chirp::PutRequest *pair = batch.add_pairs();
+        pair->mutable_key()->swap(pairs[j].first);
+        pair->mutable_value()->swap(pairs[j].second);
+      }
+      if (!stream->Write(batch)) {
+        return false;
+      }
+    }
+  }
+
+  batch.Clear();
+  batch.set_lsn(*lsn);
+  return stream->Write(batch);
+}
+// End of `ReplicationServiceImpl` definitions
+
+// Start of `BackupReplicator` definitions
+BackupReplicator::BackupReplicator(const std::string &primary_address,
+                                   BackendDataStructure *data)
+    : primary_address_(primary_address),
+      data_(data),
+      applied_lsn_(0),
+      stopping_(false),
+      context_(nullptr) {}
+
+BackupReplicator::~BackupReplicator() { Stop(); }
+
+void BackupReplicator::Start() {
+  thread_ = std::thread([this]() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    while (!stopping_) {
+      lock.unlock();
+      Follow();
+      lock.lock();
+      cv_.wait_for(lock, std::chrono::milliseconds(kReconnectIntervalMs),
+                   [this]() { return stopping_; });
+    }
+  });
+}
+
+void BackupReplicator::Stop() {
+  {
+    std::lock_guard<std::mutex> guard(mutex_);
+    stopping_ = true;
+    if (context_ != nullptr) {
+      context_->TryCancel();
+    }
+  }
+  cv_.notify_all();
+  if (thread_.joinable()) {
+    thread_.join();
+  }
+}
+
+bool BackupReplicator::WaitForLsn(uint64_t lsn,
+                                  std::chrono::milliseconds timeout) {
+  std::unique_lock<std::mutex> lock(mutex_);
+  return cv_.wait_for(lock, timeout,
+                      [this, lsn]() { return applied_lsn_ >= lsn; });
+}
+
+uint64_t BackupReplicator::get_applied_lsn() {
+  std::lock_guard<std::mutex> guard(mutex_);
+  return applied_lsn_;
+}
+
+void BackupReplicator::Follow() {
+  std::unique_ptr<chirp::Replication::Stub> stub(chirp::Replication::NewStub(
+      grpc::CreateChannel(primary_address_,
+                          grpc::InsecureChannelCredentials())));
+  grpc::ClientContext context;
+  chirp::ReplicationAck ack;
+  {
+    std::lock_guard<std::mutex> guard(mutex_);
+    if (stopping_) {
+      return;
+    }
+    context_ = &context;
+    ack.set_applied_lsn(applied_lsn_);
+  }
+
+  std::unique_ptr<
+      grpc::ClientReaderWriter<chirp::ReplicationAck, chirp::ReplicationBatch>>
+      stream(stub->replicate(&context));
+  chirp::ReplicationBatch batch;
+  if (stream->Write(ack)) {
+    while (stream->Read(&batch)) {
+      Apply(batch);
+      // Only batches that end at a record are acknowledged. The pairs of a
+      // copy are not consistent until the copy is done.
+      if (batch.lsn() > 0) {
+        ack.set_applied_lsn(batch.lsn());
+        if (!stream->Write(ack)) {
+          break;
+        }
+      }
+    }
+  }
+  stream->WritesDone();
+  stream->Finish();
+
+  std::lock_guard<std::mutex> guard(mutex_);
+  context_ = nullptr;
+}
+
+void BackupReplicator::Apply(const chirp::ReplicationBatch &batch) {
+  if (batch.reset()) {
+    // A copy follows, so a stream broken halfway has to start over
+    {
+      std::lock_guard<std::mutex> guard(mutex_);
+      applied_lsn_ = 0;
+    }
+    std::vector<std::string> keys;
+    data_->ScanKeys("", "", 0, &keys);
+    data_->MultiDelete(keys, nullptr);
+  }
+
+  for (const chirp::PutRequest &pair : batch.pairs()) {
+    data_->Restore(pair.key(), pair.value());
+  }
+
+  if (batch.records_size() > 0) {
+    std::vector<WriteAheadLog::Record> records;
+    records.reserve(batch.records_size());
+    for (const chirp::ReplicationRecord &record : batch.records()) {
+      records.push_back(WriteAheadLog::Record{
+          record.lsn(),
+          static_cast<WriteAheadLog::Operations>(record.operation()),
+          record.key(), record.value()});
+    }
+    data_->Replay(records, 1);
+  }
+
+  if (batch.lsn() > 0) {
+    {
+      std::lock_guard<std::mutex> guard(mutex_);
+      applied_lsn_ = batch.lsn();
+    }
+    cv_.notify_all();
+  }
+}
+// End of `BackupReplicator` definitions
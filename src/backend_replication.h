@@ -0,0 +1,123 @@
+#ifndef CHIRP_SRC_BACKEND_REPLICATION_H_
+#define CHIRP_SRC_BACKEND_REPLICATION_H_
+
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <grpcpp/client_context.h>
+#include <grpcpp/server_context.h>
+
+#include "backend_data_structure.h"
+#include "backend_replication_log.h"
+#include "backend_write_ahead_log.h"
+#include "key_value.grpc.pb.h"
+
+// Primary/backup replication by shipping the write-ahead log
+// A primary keeps its latest log records in a `ReplicationLog`. Every backup
+// runs a `BackupReplicator`, which opens a `replicate` stream to the
+// primary's `ReplicationServiceImpl`, applies the records it is sent, and
+// acknowledges the LSN it has applied. A backup that is too far behind, or
+// new, is first sent a full copy of the pairs.
+// Backups only serve reads. There is no failover: a backup does not take
+// writes when the primary is gone, it keeps trying to reconnect.
+
+// The `chirp::Replication` service of a primary
+class ReplicationServiceImpl final : public chirp::Replication::Service {
+ public:
+  // The maximum number of records or pairs sent in one `ReplicationBatch`
+  static const size_t kMaxRecordsPerBatch = 1024;
+  // How long a stream waits for records before it checks whether it is
+  // cancelled
+  static const uint64_t kPollIntervalMs = 100;
+
+  // Constructor that takes the data structure, its write-ahead log, and the
+  // replication log fed by that write-ahead log
+  // None of them are owned, and they should outlive the service.
+  ReplicationServiceImpl(BackendDataStructure *data, WriteAheadLog *log,
+                         ReplicationLog *replication_log);
+
+  // Streams the records after the LSN of the first `ReplicationAck` and
+  // takes the acks that follow
+  grpc::Status replicate(
+      grpc::ServerContext *context,
+      grpc::ServerReaderWriter<chirp::ReplicationBatch, chirp::ReplicationAck>
+          *stream) override;
+
+ private:
+  // Sends a reset, then every pair, then an empty batch with the LSN the
+  // copy is as of. That LSN is stored in `lsn`.
+  // returns true if this operation succeeds
+  // returns false if the backup is gone
+  bool SendCopy(
+      grpc::ServerReaderWriter<chirp::ReplicationBatch, chirp::ReplicationAck>
+          *stream,
+      uint64_t *lsn);
+
+  BackendDataStructure *data_;
+  WriteAheadLog *log_;
+  ReplicationLog *replication_log_;
+};
+
+// Keeps the data structure of a backup in step with its primary
+// A thread follows the primary's `replicate` stream and reconnects when the
+// stream breaks.
+class BackupReplicator {
+ public:
+  // How long to wait before connecting again
+  static const uint64_t kReconnectIntervalMs = 200;
+
+  // Constructor that takes the address of the primary and the data
+  // structure the records are applied to
+  // `data` is not owned and should outlive the replicator.
+  BackupReplicator(const std::string &primary_address,
+                   BackendDataStructure *data);
+
+  // Stops following the primary
+  ~BackupReplicator();
+
+  BackupReplicator(const BackupReplicator &) = delete;
+  BackupReplicator &operator=(const BackupReplicator &) = delete;
+
+  // Starts following the primary in a background thread
+  void Start();
+
+  // Closes the stream and joins the thread
+  void Stop();
+
+  // Blocks until every record up to `lsn` is applied
+  // returns true if this operation succeeds
+  // returns false if `timeout` passes first
+  bool WaitForLsn(uint64_t lsn, std::chrono::milliseconds timeout);
+
+  // returns the LSN of the last record applied, or 0 if a copy is being
+  // applied
+  uint64_t get_applied_lsn();
+
+ private:
+  // Follows one stream until it breaks
+  void Follow();
+
+  // Applies one batch
+  void Apply(const chirp::ReplicationBatch &batch);
+
+  const std::string primary_address_;
+  BackendDataStructure *data_;
+  std::thread thread_;
+
+  // Guards every member below
+  std::mutex mutex_;
+  uint64_t applied_lsn_;
+  bool stopping_;
+  // The context of the open stream, so that `Stop()` can cancel it
+  grpc::ClientContext *context_;
+  // Signaled when `applied_lsn_` moves or the replicator stops
+  std::condition_variable cv_;
+};
+
+#endif /* CHIRP_SRC_BACKEND_REPLICATION_H_ */
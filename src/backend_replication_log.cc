@@ -0,0 +1,144 @@
+#include "backend_replication_log.h"
+
+#include <algorithm>
+
+const uint64_t ReplicationLog::kSyncAckTimeoutMs;
+
+ReplicationLog::ReplicationLog(size_t capacity, AckModes mode,
+                               uint64_t next_lsn)
+    : capacity_(std::max<size_t>(capacity, 1)),
+      mode_(mode),
+      records_(),
+      first_lsn_(next_lsn),
+      last_lsn_(next_lsn - 1),
+      backups_(),
+      next_backup_id_(0),
+      num_of_sync_timeouts_(0) {}
+
+void ReplicationLog::Append(uint64_t lsn, WriteAheadLog::Operations operation,
+                            const std::string &key, const std::string &value) {
+  {
+    std::lock_guard<std::mutex> guard(mutex_);
+    records_.push_back(WriteAheadLog::Record{lsn, operation, key, value});
+    last_lsn_ = lsn;
+    if (records_.size() > capacity_) {
+      records_.pop_front();
+      ++first_lsn_;
+    }
+  }
+  appended_cv_.notify_all();
+}
+
+bool ReplicationLog::Read(uint64_t from_lsn, size_t max_records,
+                          std::chrono::milliseconds timeout,
+                          std::vector<WriteAheadLog::Record> *records) {
+  std::unique_lock<std::mutex> lock(mutex_);
+  if (from_lsn < first_lsn_ || from_lsn > last_lsn_ + 1) {
+    return false;
+  }
+  appended_cv_.wait_for(lock, timeout,
+                        [this, from_lsn]() { return last_lsn_ >= from_lsn; });
+  // Records may have been dropped while waiting
+  if (from_lsn < first_lsn_) {
+    return false;
+  }
+
+  size_t begin = from_lsn - first_lsn_;
+  size_t end = std::min(records_.size(), begin + max_records);
+  for (size_t i = begin; i < end; ++i) {
+    records->push_back(records_[i]);
+  }
+  return true;
+}
+
+size_t ReplicationLog::AddBackup() {
+  std::lock_guard<std::mutex> guard(mutex_);
+  size_t id = next_backup_id_++;
+  backups_[id] = Backup{0, false, last_lsn_};
+  return id;
+}
+
+void ReplicationLog::RemoveBackup(size_t id) {
+  {
+    std::lock_guard<std::mutex> guard(mutex_);
+    backups_.erase(id);
+  }
+  acknowledged_cv_.notify_all();
+}
+
+void ReplicationLog::Acknowledge(size_t id, uint64_t lsn) {
+  {
+    std::lock_guard<std::mutex> guard(mutex_);
+    auto it = backups_.find(id);
+    if (it == backups_.end()) {
+      return;
+    }
+    it->second.applied_lsn = lsn;
+    if (lsn >= it->second.catch_up_lsn) {
+      it->second.in_sync = true;
+    }
+  }
+  acknowledged_cv_.notify_all();
+}
+
+void ReplicationLog::WaitForBackups(uint64_t lsn) {
+  if (mode_ == ASYNC) {
+    return;
+  }
+
+  std::unique_lock<std::mutex> lock(mutex_);
+  auto applied = [this, lsn]() {
+    for (const auto &backup : backups_) {
+      if (backup.second.in_sync && backup.second.applied_lsn < lsn) {
+        return false;
+      }
+    }
+    return true;
+  };
+  if (acknowledged_cv_.wait_for(
+          lock, std::chrono::milliseconds(kSyncAckTimeoutMs), applied)) {
+    return;
+  }
+
+  // The write is durable here already. The backups that are behind are
+  // left to catch up without holding up the writers.
+  for (auto &backup : backups_) {
+    if (backup.second.in_sync && backup.second.applied_lsn < lsn) {
+      backup.second.in_sync = false;
+      backup.second.catch_up_lsn = last_lsn_;
+      ++num_of_sync_timeouts_;
+    }
+  }
+}
+
+size_t ReplicationLog::get_num_of_backups() {
+  std::lock_guard<std::mutex> guard(mutex_);
+  return backups_.size();
+}
+
+size_t ReplicationLog::get_num_of_backups_in_sync() {
+  std::lock_guard<std::mutex> guard(mutex_);
+  size_t num_of_backups_in_sync = 0;
+  for (const auto &backup : backups_) {
+    if (backup.second.in_sync) {
+      ++num_of_backups_in_sync;
+    }
+  }
+  return num_of_backups_in_sync;
+}
+
+uint64_t ReplicationLog::get_num_of_sync_timeouts() {
+  std::lock_guard<std::mutex> guard(mutex_);
+  return num_of_sync_timeouts_;
+}
+
+bool ReplicationLog::ParseAckMode(const std::string &name, AckModes *mode) {
+  if (name == "async") {
+    *mode = ASYNC;
+  } else if (name == "sync") {
+    *mode = SYNC;
+  } else {
+    return false;
+  }
+  return true;
+}
@@ -0,0 +1,118 @@
+#ifndef CHIRP_SRC_BACKEND_REPLICATION_LOG_H_
+#define CHIRP_SRC_BACKEND_REPLICATION_LOG_H_
+
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <map>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "backend_write_ahead_log.h"
+
+// The latest write-ahead log records of a primary, and the backups following
+// them
+// The write-ahead log copies every record it appends here. The streams to the
+// backups read the records from here, so a backup that reconnects gets the
+// records it missed as long as they are still kept. Writers wait here for the
+// backups in `SYNC` mode.
+class ReplicationLog {
+ public:
+  // When a write returns on the primary
+  enum AckModes : int {
+    // Once it is durable on the primary. Backups catch up on their own.
+    ASYNC = 0,
+    // Once every backup in sync has applied it as well
+    SYNC
+  };
+
+  // A backup that takes longer than this to apply a write is dropped from
+  // the backups writes wait for, until it catches up again
+  // Catching up means applying every record appended by the time the backup
+  // was added or dropped. That target does not move with later writes, so a
+  // backup that applies records as fast as they come gets there.
+  static const uint64_t kSyncAckTimeoutMs = 1000;
+
+  // Constructor that takes the number of records kept, the ack mode, and
+  // the LSN the next record appended gets
+  ReplicationLog(size_t capacity, AckModes mode, uint64_t next_lsn);
+
+  ReplicationLog(const ReplicationLog &) = delete;
+  ReplicationLog &operator=(const ReplicationLog &) = delete;
+
+  // Keeps a copy of the record with `lsn`
+  // The write-ahead log calls this for every record it appends, in LSN
+  // order.
+  void Append(uint64_t lsn, WriteAheadLog::Operations operation,
+              const std::string &key, const std::string &value);
+
+  // Copies at most `max_records` records starting at `from_lsn` to
+  // `records`, waiting up to `timeout` for the first one
+  // returns true if this operation succeeds, even if no record came
+  // returns false if the records from `from_lsn` are no longer kept, or
+  // were never logged here
+  bool Read(uint64_t from_lsn, size_t max_records,
+            std::chrono::milliseconds timeout,
+            std::vector<WriteAheadLog::Record> *records);
+
+  // Adds a backup that is not in sync yet
+  // returns the id of the backup
+  size_t AddBackup();
+
+  // Removes the backup with `id`
+  void RemoveBackup(size_t id);
+
+  // Records that the backup with `id` has applied every record up to `lsn`
+  // A backup is in sync once it has caught up.
+  void Acknowledge(size_t id, uint64_t lsn);
+
+  // Blocks until every backup in sync has applied the record with `lsn`
+  // This returns at once in `ASYNC` mode. Backups that take longer than
+  // `kSyncAckTimeoutMs` are no longer waited for.
+  void WaitForBackups(uint64_t lsn);
+
+  // returns the number of backups following this log
+  size_t get_num_of_backups();
+
+  // returns the number of backups writes wait for
+  size_t get_num_of_backups_in_sync();
+
+  // returns the number of times a backup was dropped for being too slow
+  uint64_t get_num_of_sync_timeouts();
+
+  inline AckModes get_mode() const { return mode_; }
+
+  // returns the ack mode named by `name` ("async", "sync")
+  // returns false if `name` is not an ack mode
+  static bool ParseAckMode(const std::string &name, AckModes *mode);
+
+ private:
+  struct Backup {
+    uint64_t applied_lsn;
+    bool in_sync;
+    // The LSN to apply to be in sync again
+    uint64_t catch_up_lsn;
+  };
+
+  const size_t capacity_;
+  const AckModes mode_;
+
+  // Guards every member below
+  std::mutex mutex_;
+  // The record with LSN `first_lsn_ + i` is `records_[i]`
+  std::deque<WriteAheadLog::Record> records_;
+  uint64_t first_lsn_;
+  uint64_t last_lsn_;
+  std::map<size_t, Backup> backups_;
+  size_t next_backup_id_;
+  uint64_t num_of_sync_timeouts_;
+  // Signaled when a record is appended
+  std::condition_variable appended_cv_;
+  // Signaled when a backup acknowledges records or goes away
+  std::condition_variable acknowledged_cv_;
+};
+
+#endif /* CHIRP_SRC_BACKEND_REPLICATION_LOG_H_ */
@@ -1,23 +1,620 @@
 #include "backend_server.h"
 
+#include <time.h>
+#include <unistd.h>
+#include <algorithm>
+#include <cstring>
+#include <ctime>
+#include <iomanip>
 #include <map>
+#include <memory>
 #include <string>
 #include <utility>
+#include <vector>
 
 #include <grpc/grpc.h>
+#include <grpc/slice.h>
 #include <grpcpp/impl/codegen/status.h>
 #include <grpcpp/security/server_credentials.h>
 #include <grpcpp/server.h>
 #include <grpcpp/server_builder.h>
 #include <grpcpp/server_context.h>
+#include <grpcpp/support/slice.h>
 
 #include "backend_data_structure.h"
+#include "backend_list_value.h"
+#include "backend_snapshot.h"
 #include "key_value.grpc.pb.h"
 
-#define DEFAULT_HOST_AND_PORT "0.0.0.0:50000"
+const size_t KeyValueStoreImpl::kMaxKeysPerScanBatch;
+const size_t KeyValueStoreImpl::kMaxChangesPerReply;
+const uint64_t KeyValueStoreImpl::kChangesHeartbeatMs;
+const uint64_t KeyValueStoreImpl::kWatchIdleCheckMs;
+const size_t KeyValueStoreImpl::kMinSharedReplySize;
 
-KeyValueStoreImpl::KeyValueStoreImpl()
-    : backend_data_(), lock_(ATOMIC_FLAG_INIT) {}
+namespace {
+// The tag of field 1 of `chirp::GetReply`, the value, which is
+// length-delimited
+const char kGetReplyValueTag = 0x0A;
+
+// returns the keys of a get request, in its order
+std::vector<std::string> KeysOf(const chirp::GetRequest &request) {
+  if (request.keys_size() > 0) {
+    return std::vector<std::string>(request.keys().begin(),
+                                    request.keys().end());
+  }
+  return std::vector<std::string>(1, request.key());
+}
+
+// Drops the reference to a value that a reply slice held
+void DropValue(void *value) {
+  delete static_cast<std::shared_ptr<const std::string> *>(value);
+}
+}  // Anonymous namespace
+
+KeyValueStoreImpl::KeyValueStoreImpl(
+    size_t num_of_shards, const ShardStorage::Options &storage_options)
+    : backend_data_(num_of_shards, storage_options),
+      replication_log_(),
+      change_log_(),
+      write_ahead_log_(),
+      write_ahead_log_path_(),
+      replication_service_(),
+      backup_replicator_(),
+      snapshot_path_(),
+      stopping_(false) {}
+
+KeyValueStoreImpl::~KeyValueStoreImpl() {
+  if (backup_replicator_ != nullptr) {
+    backup_replicator_->Stop();
+  }
+  {
+    std::lock_guard<std::mutex> guard(background_thread_mutex_);
+    stopping_ = true;
+  }
+  background_thread_cv_.notify_all();
+  if (snapshot_thread_.joinable()) {
+    snapshot_thread_.join();
+  }
+  if (expiry_thread_.joinable()) {
+    expiry_thread_.join();
+  }
+  if (version_thread_.joinable()) {
+    version_thread_.join();
+  }
+  if (stats_thread_.joinable()) {
+    stats_thread_.join();
+  }
+}
+
+bool KeyValueStoreImpl::EnableWriteAheadLog(
+    const std::string &path, WriteAheadLog::DurabilityModes mode,
+    size_t num_of_recovery_threads, const std::string &snapshot_path) {
+  write_ahead_log_path_ = path;
+  snapshot_path_ = snapshot_path;
+
+  uint64_t snapshot_lsn = 0;
+  if (!snapshot_path_.empty() &&
+      !BackendSnapshot::Load(snapshot_path_, num_of_recovery_threads,
+                             &backend_data_, &snapshot_lsn)) {
+    return false;
+  }
+
+  // The records moved away by an unfinished snapshot come before the ones in
+  // the current log
+  std::vector<WriteAheadLog::Record> records;
+  uint64_t valid_length;
+  if (!WriteAheadLog::ReadRecords(OldWriteAheadLogPath(),
+                                  num_of_recovery_threads, &records,
+                                  &valid_length) ||
+      !WriteAheadLog::ReadRecords(path, num_of_recovery_threads, &records,
+                                  &valid_length)) {
+    return false;
+  }
+
+  // Only the records after the snapshot are replayed
+  uint64_t last_lsn = snapshot_lsn;
+  std::vector<WriteAheadLog::Record> tail;
+  for (WriteAheadLog::Record &record : records) {
+    if (record.lsn > snapshot_lsn) {
+      last_lsn = record.lsn;
+      tail.push_back(std::move(record));
+    }
+  }
+  backend_data_.Replay(tail, num_of_recovery_threads);
+
+  write_ahead_log_.reset(new WriteAheadLog(path, mode));
+  if (!write_ahead_log_->Open(valid_length, last_lsn)) {
+    write_ahead_log_.reset();
+    return false;
+  }
+
+  backend_data_.SetWriteAheadLog(write_ahead_log_.get());
+  return true;
+}
+
+bool KeyValueStoreImpl::TakeSnapshot() {
+  bool persistent = backend_data_.is_storage_persistent();
+  if (write_ahead_log_ == nullptr || (snapshot_path_.empty() && !persistent)) {
+    return false;
+  }
+  std::lock_guard<std::mutex> guard(snapshot_mutex_);
+
+  // If the previous snapshot failed, the old log still holds records the
+  // latest snapshot does not cover. Keep it and leave the records appended
+  // since then in the current log; both are covered by this snapshot.
+  uint64_t lsn;
+  if (access(OldWriteAheadLogPath().c_str(), F_OK) == 0) {
+    lsn = write_ahead_log_->get_last_lsn();
+  } else if (!write_ahead_log_->Rotate(OldWriteAheadLogPath(), &lsn)) {
+    return false;
+  }
+
+  // Neither kind of snapshot keeps deadlines, so they go to the log after
+  // `lsn` before the records before it are dropped
+  if (!backend_data_.LogExpiringKeys()) {
+    return false;
+  }
+
+  // Storage kept on disk only needs its memtables flushed. Every record up
+  // to `lsn` is applied by then, since records are appended and applied
+  // under the same shard lock.
+  bool ok = persistent
+                ? backend_data_.FlushStorage()
+                : BackendSnapshot::Write(snapshot_path_, lsn, &backend_data_);
+  if (!ok) {
+    return false;
+  }
+  return unlink(OldWriteAheadLogPath().c_str()) == 0;
+}
+
+bool KeyValueStoreImpl::EnableReplication(ReplicationLog::AckModes mode,
+                                          size_t log_capacity) {
+  if (write_ahead_log_ == nullptr || backup_replicator_ != nullptr) {
+    return false;
+  }
+
+  replication_log_.reset(new ReplicationLog(
+      log_capacity, mode, write_ahead_log_->get_last_lsn() + 1));
+  write_ahead_log_->SetReplicationLog(replication_log_.get());
+  replication_service_.reset(new ReplicationServiceImpl(
+      &backend_data_, write_ahead_log_.get(), replication_log_.get()));
+  return true;
+}
+
+void KeyValueStoreImpl::FollowPrimary(const std::string &primary_address) {
+  backup_replicator_.reset(
+      new BackupReplicator(primary_address, &backend_data_));
+  backup_replicator_->Start();
+}
+
+void KeyValueStoreImpl::EnableChangeLog(size_t capacity) {
+  change_log_.reset(
+      new ChangeLog(capacity, BackendDataStructure::NowMilliseconds() << 16));
+  backend_data_.SetChangeLog(change_log_.get());
+}
+
+grpc::Status KeyValueStoreImpl::StartChanges(
+    const chirp::ChangesRequest &request, uint64_t *next_seq) {
+  if (change_log_ == nullptr) {
+    return grpc::Status(grpc::FAILED_PRECONDITION,
+                        "The changes are not kept by this server.");
+  }
+
+  *next_seq = request.from_seq() == 0 ? change_log_->get_next_seq()
+                                      : request.from_seq();
+  if (*next_seq < change_log_->get_first_seq() ||
+      *next_seq > change_log_->get_next_seq()) {
+    return grpc::Status(grpc::OUT_OF_RANGE,
+                        "The changes from `from_seq` are no longer kept.");
+  }
+  return grpc::Status::OK;
+}
+
+grpc::Status KeyValueStoreImpl::NextChanges(
+    const chirp::ChangesRequest &request, uint64_t *next_seq,
+    std::chrono::milliseconds timeout, chirp::ChangesReply *reply) {
+  std::vector<ChangeLog::Change> changes;
+  if (!change_log_->Read(next_seq, request.prefix_filter(),
+                         kMaxChangesPerReply, timeout, &changes)) {
+    return grpc::Status(grpc::OUT_OF_RANGE,
+                        "The changes from `from_seq` are no longer kept.");
+  }
+
+  reply->clear_changes();
+  for (ChangeLog::Change &change : changes) {
+    chirp::Change *added = reply->add_changes();
+    added->set_seq(change.seq);
+    added->set_deleted(change.operation == ChangeLog::DELETE);
+    added->mutable_key()->swap(change.key);
+    added->mutable_value()->swap(change.value);
+  }
+  reply->set_next_seq(*next_seq);
+  return grpc::Status::OK;
+}
+
+grpc::Status KeyValueStoreImpl::StartWatch(
+    const chirp::WatchRequest &request, const std::function<void()> &on_event,
+    std::unique_ptr<WatchTable::Watcher> *watcher) {
+  if (request.prefixes_size() == 0) {
+    return grpc::Status(grpc::INVALID_ARGUMENT, "No prefix is watched.");
+  }
+
+  watcher->reset(new WatchTable::Watcher(WatchTable::kDefaultCapacity,
+                                         request.with_values(), on_event));
+  std::vector<std::string> prefixes(request.prefixes().begin(),
+                                    request.prefixes().end());
+  backend_data_.get_watch_table()->Add(prefixes, watcher->get());
+  return grpc::Status::OK;
+}
+
+bool KeyValueStoreImpl::NextWatchEvents(WatchTable::Watcher *watcher,
+                                        std::chrono::milliseconds timeout,
+                                        chirp::WatchReply *reply) {
+  std::vector<WatchTable::Event> events;
+  bool complete = watcher->Take(timeout, &events);
+
+  reply->Clear();
+  for (WatchTable::Event &event : events) {
+    chirp::WatchEvent *added = reply->add_events();
+    added->mutable_key()->swap(event.key);
+    added->set_deleted(event.deleted);
+    added->mutable_value()->swap(event.value);
+  }
+  reply->set_overflowed(!complete);
+  return !events.empty() || !complete;
+}
+
+void KeyValueStoreImpl::StopWatch(WatchTable::Watcher *watcher) {
+  backend_data_.get_watch_table()->Remove(watcher);
+}
+
+void KeyValueStoreImpl::StartTakingSnapshots(std::chrono::seconds interval) {
+  snapshot_thread_ = std::thread([this, interval]() {
+    std::unique_lock<std::mutex> lock(background_thread_mutex_);
+    while (!background_thread_cv_.wait_for(lock, interval,
+                                           [this]() { return stopping_; })) {
+      lock.unlock();
+      TakeSnapshot();
+      lock.lock();
+    }
+  });
+}
+
+void KeyValueStoreImpl::StartExpiringKeys(std::chrono::milliseconds interval) {
+  expiry_thread_ = std::thread([this, interval]() {
+    std::unique_lock<std::mutex> lock(background_thread_mutex_);
+    while (!background_thread_cv_.wait_for(lock, interval,
+                                           [this]() { return stopping_; })) {
+      lock.unlock();
+      // A backlog larger than one call can take is worked off without
+      // waiting for the next interval
+      size_t num_of_expired;
+      do {
+        num_of_expired = backend_data_.ExpireKeys();
+      } while (num_of_expired > 0);
+      lock.lock();
+    }
+  });
+}
+
+void KeyValueStoreImpl::StartCollectingVersions(
+    std::chrono::milliseconds interval) {
+  version_thread_ = std::thread([this, interval]() {
+    std::unique_lock<std::mutex> lock(background_thread_mutex_);
+    while (!background_thread_cv_.wait_for(lock, interval,
+                                           [this]() { return stopping_; })) {
+      lock.unlock();
+      backend_data_.CollectVersions();
+      lock.lock();
+    }
+  });
+}
+
+bool KeyValueStoreImpl::StartDumpingStats(const std::string &path,
+                                          std::chrono::milliseconds interval) {
+  stats_file_.open(path, std::ios::app);
+  if (!stats_file_) {
+    return false;
+  }
+
+  stats_thread_ = std::thread([this, interval]() {
+    std::vector<LatencyHistogram::Counts> counts(NUM_OF_OPERATIONS);
+    BackendDataStructure::LockContention contention = {0, 0};
+    std::unique_lock<std::mutex> lock(background_thread_mutex_);
+    while (!background_thread_cv_.wait_for(lock, interval,
+                                           [this]() { return stopping_; })) {
+      lock.unlock();
+      DumpStats(&counts, &contention);
+      lock.lock();
+    }
+  });
+  return true;
+}
+
+void KeyValueStoreImpl::DumpStats(
+    std::vector<LatencyHistogram::Counts> *counts,
+    BackendDataStructure::LockContention *contention) {
+  char now[32];
+  std::time_t seconds = std::time(nullptr);
+  struct tm local;
+  std::strftime(now, sizeof(now), "%Y-%m-%d %H:%M:%S",
+                localtime_r(&seconds, &local));
+  stats_file_ << "[" << now << "]" << std::endl;
+
+  // Latencies in microseconds, of the requests since the previous dump
+  stats_file_ << std::fixed << std::setprecision(1);
+  LatencyHistogram::Counts current;
+  for (int i = 0; i < NUM_OF_OPERATIONS; ++i) {
+    latencies_[i].Read(&current);
+    LatencyHistogram::Counts interval(current);
+    if (!(*counts)[i].empty()) {
+      for (size_t bucket = 0; bucket < interval.size(); ++bucket) {
+        interval[bucket] -= (*counts)[i][bucket];
+      }
+    }
+    (*counts)[i].swap(current);
+
+    LatencyHistogram::Summary summary =
+        LatencyHistogram::Summarize(interval);
+    if (summary.count == 0) {
+      continue;
+    }
+    stats_file_ << OperationName(static_cast<Operations>(i)) << ": "
+                << summary.count << " requests, mean "
+                << summary.mean / 1000.0 << " us, p50 " << summary.p50 / 1000.0
+                << " us, p90 " << summary.p90 / 1000.0 << " us, p99 "
+                << summary.p99 / 1000.0 << " us, p99.9 "
+                << summary.p999 / 1000.0 << " us, max " << summary.max / 1000.0
+                << " us" << std::endl;
+  }
+
+  BackendDataStructure::LockContention now_contention =
+      backend_data_.GetLockContention();
+  stats_file_ << "shard locks: "
+              << now_contention.num_of_contended - contention->num_of_contended
+              << " contended, "
+              << (now_contention.wait_nanoseconds -
+                  contention->wait_nanoseconds) /
+                     1000.0
+              << " us waited" << std::endl;
+  *contention = now_contention;
+
+  std::map<std::string, BackendDataStructure::PrefixUsage> usage;
+  backend_data_.GetMemoryUsage(&usage);
+  stats_file_ << "bytes used: " << backend_data_.get_bytes_used()
+              << std::endl;
+  for (const auto &pair : usage) {
+    stats_file_ << "prefix \"" << pair.first
+                << "\": " << pair.second.num_of_keys << " keys, "
+                << pair.second.bytes << " bytes" << std::endl;
+  }
+  if (replication_log_ != nullptr) {
+    stats_file_ << "backups: " << replication_log_->get_num_of_backups()
+                << ", " << replication_log_->get_num_of_backups_in_sync()
+                << " in sync, "
+                << replication_log_->get_num_of_sync_timeouts()
+                << " dropped for being too slow" << std::endl;
+  }
+  stats_file_.flush();
+}
+
+const char *KeyValueStoreImpl::OperationName(Operations operation) {
+  switch (operation) {
+    case PUT:
+      return "put";
+    case GET:
+      return "get";
+    case DELETEKEY:
+      return "deletekey";
+    case MULTIPUT:
+      return "multiput";
+    case MULTIDELETE:
+      return "multidelete";
+    case FETCH_ADD:
+      return "fetch_add";
+    case COMPARE_AND_SWAP:
+      return "compare_and_swap";
+    case WRITE_BATCH:
+      return "write_batch";
+    case SCAN:
+      return "scan";
+    case LIST_APPEND:
+      return "list_append";
+    case LIST_REMOVE:
+      return "list_remove";
+    case EXISTS:
+      return "exists";
+    default:
+      return "unknown";
+  }
+}
+
+void KeyValueStoreImpl::GetStats(chirp::StatsReply *reply) {
+  LatencyHistogram::Counts counts;
+  for (int i = 0; i < NUM_OF_OPERATIONS; ++i) {
+    latencies_[i].Read(&counts);
+    LatencyHistogram::Summary summary = LatencyHistogram::Summarize(counts);
+    chirp::OperationStats *operation = reply->add_operations();
+    operation->set_operation(OperationName(static_cast<Operations>(i)));
+    operation->set_count(summary.count);
+    operation->set_mean_ns(summary.mean);
+    operation->set_p50_ns(summary.p50);
+    operation->set_p90_ns(summary.p90);
+    operation->set_p99_ns(summary.p99);
+    operation->set_p999_ns(summary.p999);
+    operation->set_max_ns(summary.max);
+  }
+
+  BackendDataStructure::LockContention contention =
+      backend_data_.GetLockContention();
+  reply->set_lock_contentions(contention.num_of_contended);
+  reply->set_lock_wait_ns(contention.wait_nanoseconds);
+
+  std::map<std::string, BackendDataStructure::PrefixUsage> usage;
+  backend_data_.GetMemoryUsage(&usage);
+  reply->set_bytes_used(backend_data_.get_bytes_used());
+  for (const auto &pair : usage) {
+    chirp::PrefixUsage *prefix = reply->add_prefixes();
+    prefix->set_prefix(pair.first);
+    prefix->set_num_of_keys(pair.second.num_of_keys);
+    prefix->set_bytes(pair.second.bytes);
+  }
+
+  if (replication_log_ != nullptr) {
+    reply->set_num_of_backups(replication_log_->get_num_of_backups());
+    reply->set_num_of_backups_in_sync(
+        replication_log_->get_num_of_backups_in_sync());
+    reply->set_num_of_sync_timeouts(
+        replication_log_->get_num_of_sync_timeouts());
+  }
+}
+
+bool KeyValueStoreImpl::LookUp(const chirp::GetRequest &request,
+                               std::vector<std::string> *values) {
+  LatencyRecorder recorder(&latencies_[GET]);
+  std::vector<std::string> keys = KeysOf(request);
+  if (request.snapshot() != 0) {
+    return backend_data_.MultiGetAtSnapshot(request.snapshot(), keys, values);
+  }
+  backend_data_.MultiGet(keys, values);
+  return true;
+}
+
+bool KeyValueStoreImpl::LookUpShared(const chirp::GetRequest &request,
+                                     std::vector<ValueBuffer> *values) {
+  LatencyRecorder recorder(&latencies_[GET]);
+  if (request.snapshot() != 0) {
+    // The old versions are kept as strings; they are moved, not copied
+    std::vector<std::string> versions;
+    if (!backend_data_.MultiGetAtSnapshot(request.snapshot(), KeysOf(request),
+                                          &versions)) {
+      return false;
+    }
+    for (std::string &version : versions) {
+      values->emplace_back(std::move(version));
+    }
+    return true;
+  }
+  backend_data_.MultiGetShared(KeysOf(request), values);
+  return true;
+}
+
+void KeyValueStoreImpl::EncodeGetReply(const ValueBuffer &value,
+                                       grpc::ByteBuffer *reply) {
+  // An empty value is the default, which is not serialized at all
+  if (value.size() == 0) {
+    grpc::Slice empty;
+    *reply = grpc::ByteBuffer(&empty, 1);
+    return;
+  }
+
+  // The tag, then the size of the value as a varint
+  char header[1 + 10];
+  size_t header_size = 0;
+  header[header_size++] = kGetReplyValueTag;
+  size_t size = value.size();
+  for (; size >= 0x80; size >>= 7) {
+    header[header_size++] = static_cast<char>((size & 0x7F) | 0x80);
+  }
+  header[header_size++] = static_cast<char>(size);
+
+  if (value.size() < kMinSharedReplySize) {
+    grpc_slice bytes = grpc_slice_malloc(header_size + value.size());
+    std::memcpy(GRPC_SLICE_START_PTR(bytes), header, header_size);
+    std::memcpy(GRPC_SLICE_START_PTR(bytes) + header_size, value.data(),
+                value.size());
+    grpc::Slice slice(bytes, grpc::Slice::STEAL_REF);
+    *reply = grpc::ByteBuffer(&slice, 1);
+    return;
+  }
+
+  // The slice holds its own reference, so the value outlives an overwrite
+  // of its key until grpc has sent it
+  grpc::Slice slices[2] = {
+      grpc::Slice(header, header_size),
+      grpc::Slice(const_cast<char *>(value.data()), value.size(), DropValue,
+                  new std::shared_ptr<const std::string>(value.share()))};
+  *reply = grpc::ByteBuffer(slices, 2);
+}
+
+grpc::Status KeyValueStoreImpl::SnapshotNotReadable() const {
+  return grpc::Status(grpc::FAILED_PRECONDITION,
+                      "The snapshot is released or has expired.");
+}
+
+void KeyValueStoreImpl::StartScan(const chirp::ScanRequest &request,
+                                  ScanCursor *cursor) {
+  *cursor = ScanCursor();
+  cursor->request = request;
+  cursor->start = request.start();
+}
+
+bool KeyValueStoreImpl::NextScanChunk(ScanCursor *cursor,
+                                      chirp::ScanReply *reply) {
+  reply->clear_pairs();
+  size_t num_of_bytes = 0;
+  while (reply->pairs_size() == 0) {
+    if (cursor->next == cursor->keys.size()) {
+      if (cursor->exhausted) {
+        break;
+      }
+
+      // Collects the next batch of keys
+      uint64_t limit = cursor->request.limit();
+      size_t batch_size = kMaxKeysPerScanBatch;
+      if (limit > 0) {
+        batch_size = std::min<uint64_t>(batch_size, limit - cursor->collected);
+      }
+      cursor->keys.clear();
+      cursor->next = 0;
+      {
+        LatencyRecorder recorder(&latencies_[SCAN]);
+        backend_data_.ScanKeys(cursor->start, cursor->request.end(),
+                               batch_size, &cursor->keys);
+      }
+      cursor->collected += cursor->keys.size();
+      if (cursor->keys.size() < batch_size ||
+          (limit > 0 && cursor->collected >= limit)) {
+        cursor->exhausted = true;
+      } else {
+        // The smallest key after the last one collected
+        cursor->start = cursor->keys.back();
+        cursor->start.push_back('\0');
+      }
+      continue;
+    }
+
+    // Values are read a batch of keys at a time
+    size_t end =
+        std::min(cursor->keys.size(), cursor->next + kMaxPairsPerScanChunk);
+    std::vector<std::string> batch(cursor->keys.begin() + cursor->next,
+                                   cursor->keys.begin() + end);
+    std::vector<std::pair<std::string, std::string>> pairs;
+    backend_data_.MultiGetFound(batch, &pairs);
+
+    size_t consumed = 0;
+    for (size_t i = 0;
+         i < pairs.size() && num_of_bytes < kMaxBytesPerScanChunk; ++i) {
+      num_of_bytes += pairs[i].first.size() + pairs[i].second.size();
+      chirp::PutRequest *pair = reply->add_pairs();
+      pair->mutable_key()->swap(pairs[i].first);
+      pair->mutable_value()->swap(pairs[i].second);
+      consumed = i + 1;
+    }
+
+    if (consumed == pairs.size()) {
+      cursor->next = end;
+    } else {
+      // The chunk is full. Continue from the first key not written.
+      cursor->next =
+          std::lower_bound(cursor->keys.begin() + cursor->next,
+                           cursor->keys.begin() + end, pairs[consumed].first) -
+          cursor->keys.begin();
+    }
+  }
+  return reply->pairs_size() > 0;
+}
 
 grpc::Status KeyValueStoreImpl::put(grpc::ServerContext *context,
                                     const chirp::PutRequest *request,
@@ -26,16 +623,33 @@ grpc::Status KeyValueStoreImpl::put(grpc::ServerContext *context,
     return grpc::Status(grpc::FAILED_PRECONDITION,
                         "`ServerContext` or `PutRequest` is nullptr.");
   }
+  if (backup_replicator_ != nullptr) {
+    return WriteToBackup();
+  }
+  LatencyRecorder recorder(&latencies_[PUT]);
+
+  bool ok =
+      backend_data_.Put(request->key(), request->value(), request->ttl_ms());
+
+  if (!ok) {
+    return WriteFailed(grpc::UNKNOWN, "Unknown error happened.");
+  }
+
+  return grpc::Status::OK;
+}
+
+grpc::Status KeyValueStoreImpl::PutTakingValue(chirp::PutRequest *request) {
+  if (backup_replicator_ != nullptr) {
+    return WriteToBackup();
+  }
+  LatencyRecorder recorder(&latencies_[PUT]);
 
-  // acquire lock
-  while (lock_.test_and_set(std::memory_order_acquire))
-    ;  // spin
-  bool ok = backend_data_.Put(request->key(), request->value());
-  // release lock
-  lock_.clear(std::memory_order_release);
+  bool ok = backend_data_.Put(request->key(),
+                              ValueBuffer(std::move(*request->mutable_value())),
+                              request->ttl_ms());
 
   if (!ok) {
-    return grpc::Status(grpc::UNKNOWN, "Unknown error happened.");
+    return WriteFailed(grpc::UNKNOWN, "Unknown error happened.");
   }
 
   return grpc::Status::OK;
@@ -51,24 +665,25 @@ grpc::Status KeyValueStoreImpl::get(
 
   chirp::GetRequest request;
 
-  // acquire lock
-  while (lock_.test_and_set(std::memory_order_acquire))
-    ;  // spin
+  // No lock is held across `Read()` or `Write()`. Each request is looked up
+  // on its own, so a slow client only slows down its own stream.
   while (stream->Read(&request)) {
-    chirp::GetReply reply;
-    std::string value;
-
-    bool ok = backend_data_.Get(request.key(), &value);
-    if (ok) {
-      reply.set_value(value);
-    } else {
-      reply.set_value(std::string());
+    std::vector<std::string> values;
+    if (!LookUp(request, &values)) {
+      return SnapshotNotReadable();
     }
 
-    stream->Write(reply);
+    // A write with a buffer hint is not done until something flushes it,
+    // which a blocking `Write()` would wait for, so every reply is sent as
+    // it is
+    for (size_t i = 0; i < values.size(); ++i) {
+      chirp::GetReply reply;
+      reply.mutable_value()->swap(values[i]);
+      if (!stream->Write(reply)) {
+        return grpc::Status::OK;
+      }
+    }
   }
-  // release lock
-  lock_.clear(std::memory_order_release);
 
   return grpc::Status::OK;
 }
@@ -80,35 +695,492 @@ grpc::Status KeyValueStoreImpl::deletekey(grpc::ServerContext *context,
     return grpc::Status(grpc::FAILED_PRECONDITION,
                         "`ServerContext` or `PutRequest` is nullptr.");
   }
+  if (backup_replicator_ != nullptr) {
+    return WriteToBackup();
+  }
+  LatencyRecorder recorder(&latencies_[DELETEKEY]);
 
-  // acquire lock
-  while (lock_.test_and_set(std::memory_order_acquire))
-    ;  // spin
   bool ok = backend_data_.DeleteKey(request->key());
-  // release lock
-  lock_.clear(std::memory_order_release);
 
   if (!ok) {
-    return grpc::Status(grpc::UNKNOWN, "Unknown error happened.", "");
+    return backend_data_.IsReadOnly()
+               ? ReadOnly()
+               : grpc::Status(grpc::UNKNOWN, "Unknown error happened.", "");
   }
 
   return grpc::Status::OK;
 }
 
-void run_server() {
-  std::string server_address(DEFAULT_HOST_AND_PORT);
-  KeyValueStoreImpl service;
+grpc::Status KeyValueStoreImpl::multiput(grpc::ServerContext *context,
+                                         const chirp::MultiPutRequest *request,
+                                         chirp::MultiPutReply *reply) {
+  if (context == nullptr || request == nullptr) {
+    return grpc::Status(grpc::FAILED_PRECONDITION,
+                        "`ServerContext` or `MultiPutRequest` is nullptr.");
+  }
+  if (backup_replicator_ != nullptr) {
+    return WriteToBackup();
+  }
+  LatencyRecorder recorder(&latencies_[MULTIPUT]);
+
+  std::vector<std::string> keys, values;
+  keys.reserve(request->pairs_size());
+  values.reserve(request->pairs_size());
+  for (const chirp::PutRequest &pair : request->pairs()) {
+    keys.push_back(pair.key());
+    values.push_back(pair.value());
+  }
+
+  bool ok = backend_data_.MultiPut(keys, values);
+
+  if (!ok) {
+    return WriteFailed(grpc::UNKNOWN, "Unknown error happened.");
+  }
+
+  return grpc::Status::OK;
+}
+
+grpc::Status KeyValueStoreImpl::multidelete(
+    grpc::ServerContext *context, const chirp::MultiDeleteRequest *request,
+    chirp::MultiDeleteReply *reply) {
+  if (context == nullptr || request == nullptr || reply == nullptr) {
+    return grpc::Status(
+        grpc::FAILED_PRECONDITION,
+        "`ServerContext`, `MultiDeleteRequest` or `MultiDeleteReply` is "
+        "nullptr.");
+  }
+  if (backup_replicator_ != nullptr) {
+    return WriteToBackup();
+  }
+  LatencyRecorder recorder(&latencies_[MULTIDELETE]);
+
+  std::vector<std::string> keys(request->keys().begin(),
+                                request->keys().end());
+  size_t num_of_deleted = 0;
+  bool ok = backend_data_.MultiDelete(keys, &num_of_deleted);
+
+  if (!ok) {
+    return backend_data_.IsReadOnly()
+               ? ReadOnly()
+               : grpc::Status(grpc::UNKNOWN, "Unknown error happened.");
+  }
+
+  reply->set_num_of_deleted(num_of_deleted);
+  return grpc::Status::OK;
+}
+
+grpc::Status KeyValueStoreImpl::fetch_add(grpc::ServerContext *context,
+                                          const chirp::FetchAddRequest *request,
+                                          chirp::FetchAddReply *reply) {
+  if (context == nullptr || request == nullptr || reply == nullptr) {
+    return grpc::Status(grpc::FAILED_PRECONDITION,
+                        "`ServerContext`, `FetchAddRequest` or "
+                        "`FetchAddReply` is nullptr.");
+  }
+  if (backup_replicator_ != nullptr) {
+    return WriteToBackup();
+  }
+  LatencyRecorder recorder(&latencies_[FETCH_ADD]);
+
+  uint64_t previous;
+  bool ok = backend_data_.FetchAdd(request->key(), request->delta(), &previous);
+
+  if (!ok) {
+    return WriteFailed(grpc::FAILED_PRECONDITION,
+                       "The value is not a counter or cannot be logged.");
+  }
+
+  reply->set_previous(previous);
+  return grpc::Status::OK;
+}
+
+grpc::Status KeyValueStoreImpl::compare_and_swap(
+    grpc::ServerContext *context, const chirp::CompareAndSwapRequest *request,
+    chirp::CompareAndSwapReply *reply) {
+  if (context == nullptr || request == nullptr || reply == nullptr) {
+    return grpc::Status(grpc::FAILED_PRECONDITION,
+                        "`ServerContext`, `CompareAndSwapRequest` or "
+                        "`CompareAndSwapReply` is nullptr.");
+  }
+  if (backup_replicator_ != nullptr) {
+    return WriteToBackup();
+  }
+  LatencyRecorder recorder(&latencies_[COMPARE_AND_SWAP]);
+
+  bool swapped;
+  bool ok = backend_data_.CompareAndSwap(request->key(), request->expected(),
+                                         request->desired(), &swapped,
+                                         reply->mutable_actual());
+
+  if (!ok) {
+    return WriteFailed(grpc::UNKNOWN, "Unknown error happened.");
+  }
+
+  reply->set_swapped(swapped);
+  return grpc::Status::OK;
+}
+
+grpc::Status KeyValueStoreImpl::write_batch(
+    grpc::ServerContext *context, const chirp::WriteBatchRequest *request,
+    chirp::WriteBatchReply *reply) {
+  if (context == nullptr || request == nullptr || reply == nullptr) {
+    return grpc::Status(grpc::FAILED_PRECONDITION,
+                        "`ServerContext`, `WriteBatchRequest` or "
+                        "`WriteBatchReply` is nullptr.");
+  }
+  if (backup_replicator_ != nullptr) {
+    return WriteToBackup();
+  }
+  LatencyRecorder recorder(&latencies_[WRITE_BATCH]);
+
+  std::vector<BackendDataStructure::BatchCondition> conditions;
+  for (const auto &condition : request->conditions()) {
+    conditions.push_back(BackendDataStructure::BatchCondition{
+        condition.key(), condition.expected(), condition.exists()});
+  }
+
+  std::vector<BackendDataStructure::BatchWrite> writes;
+  for (const auto &write : request->writes()) {
+    BackendDataStructure::BatchWrite batch_write;
+    switch (write.write_case()) {
+      case chirp::BatchWrite::kPut:
+        batch_write.operation = BackendDataStructure::BatchWrite::PUT;
+        batch_write.key = write.put().key();
+        batch_write.value = write.put().value();
+        break;
+      case chirp::BatchWrite::kDeleteKey:
+        batch_write.operation = BackendDataStructure::BatchWrite::DELETE;
+        batch_write.key = write.delete_key().key();
+        break;
+      case chirp::BatchWrite::kListAppend:
+      case chirp::BatchWrite::kListRemove: {
+        bool append = write.write_case() == chirp::BatchWrite::kListAppend;
+        const chirp::ListElementRequest &list =
+            append ? write.list_append() : write.list_remove();
+        if (!IsValidListRequest(list)) {
+          return grpc::Status(grpc::INVALID_ARGUMENT,
+                              "The field number or the element of a list "
+                              "write is missing.");
+        }
+        batch_write.operation = BackendDataStructure::BatchWrite::UPDATE;
+        batch_write.key = list.key();
+        batch_write.updater = ListUpdater(&list, append);
+        break;
+      }
+      default:
+        return grpc::Status(grpc::INVALID_ARGUMENT,
+                            "A write of the batch is empty.");
+    }
+    writes.push_back(std::move(batch_write));
+  }
+
+  bool applied;
+  size_t failed_condition = 0;
+  bool ok = backend_data_.ApplyBatch(conditions, writes, &applied,
+                                     &failed_condition,
+                                     reply->mutable_actual());
+
+  if (!ok) {
+    return WriteFailed(grpc::FAILED_PRECONDITION,
+                       "A list value is not a protobuf message or the batch "
+                       "cannot be logged.");
+  }
+
+  reply->set_applied(applied);
+  if (!applied) {
+    reply->set_failed_condition(failed_condition);
+  }
+  return grpc::Status::OK;
+}
+
+grpc::Status KeyValueStoreImpl::scan(
+    grpc::ServerContext *context, const chirp::ScanRequest *request,
+    grpc::ServerWriter<chirp::ScanReply> *writer) {
+  if (context == nullptr || request == nullptr || writer == nullptr) {
+    return grpc::Status(grpc::FAILED_PRECONDITION,
+                        "`ServerContext`, `ScanRequest` or `ServerWriter` is "
+                        "nullptr.");
+  }
+
+  ScanCursor cursor;
+  StartScan(*request, &cursor);
+
+  chirp::ScanReply reply;
+  while (NextScanChunk(&cursor, &reply)) {
+    if (!writer->Write(reply)) {
+      // The client is gone
+      return grpc::Status::OK;
+    }
+  }
+
+  return grpc::Status::OK;
+}
+
+grpc::Status KeyValueStoreImpl::list_append(
+    grpc::ServerContext *context, const chirp::ListElementRequest *request,
+    chirp::ListElementReply *reply) {
+  return UpdateList(context, request, reply, true);
+}
+
+grpc::Status KeyValueStoreImpl::list_remove(
+    grpc::ServerContext *context, const chirp::ListElementRequest *request,
+    chirp::ListElementReply *reply) {
+  return UpdateList(context, request, reply, false);
+}
+
+grpc::Status KeyValueStoreImpl::ReadOnly() const {
+  return grpc::Status(grpc::UNAVAILABLE,
+                      "The write-ahead log cannot be written. The backend "
+                      "only serves reads until it is restarted.");
+}
+
+grpc::Status KeyValueStoreImpl::WriteToBackup() const {
+  return grpc::Status(grpc::FAILED_PRECONDITION,
+                      "This server is a backup. Send writes to the primary.");
+}
+
+grpc::Status KeyValueStoreImpl::UpdateList(
+    grpc::ServerContext *context, const chirp::ListElementRequest *request,
+    chirp::ListElementReply *reply, bool append) {
+  if (context == nullptr || request == nullptr || reply == nullptr) {
+    return grpc::Status(grpc::FAILED_PRECONDITION,
+                        "`ServerContext`, `ListElementRequest` or "
+                        "`ListElementReply` is nullptr.");
+  }
+  if (backup_replicator_ != nullptr) {
+    return WriteToBackup();
+  }
+  LatencyRecorder recorder(&latencies_[append ? LIST_APPEND : LIST_REMOVE]);
+  if (!IsValidListRequest(*request)) {
+    return grpc::Status(grpc::INVALID_ARGUMENT,
+                        "The field number or the element is missing.");
+  }
+
+  bool changed = false, ok;
+  if (append && request->if_exists()) {
+    // The key has to exist when the element is appended, so it is a batch
+    // of one update under one condition
+    BackendDataStructure::BatchCondition condition;
+    condition.key = request->key();
+    condition.exists = true;
+    BackendDataStructure::BatchWrite write;
+    write.operation = BackendDataStructure::BatchWrite::UPDATE;
+    write.key = request->key();
+    BackendDataStructure::Updater updater = ListUpdater(request, append);
+    write.updater = [&updater, &changed](std::string *value) {
+      BackendDataStructure::UpdateResults result = updater(value);
+      changed = result == BackendDataStructure::CHANGED;
+      return result;
+    };
+    bool applied;
+    ok = backend_data_.ApplyBatch({condition}, {write}, &applied, nullptr,
+                                  nullptr);
+    if (ok && !applied) {
+      return grpc::Status(grpc::NOT_FOUND, "The key is missing.");
+    }
+  } else {
+    ok = backend_data_.Update(request->key(), ListUpdater(request, append),
+                              &changed);
+  }
+
+  if (!ok) {
+    return WriteFailed(grpc::FAILED_PRECONDITION,
+                       "The value is not a protobuf message or cannot be "
+                       "logged.");
+  }
+
+  reply->set_changed(changed);
+  return grpc::Status::OK;
+}
+
+BackendDataStructure::Updater KeyValueStoreImpl::ListUpdater(
+    const chirp::ListElementRequest *request, bool append) {
+  return [request, append](std::string *value) {
+    bool ok, changed = false;
+    if (request->element_case() ==
+        chirp::ListElementRequest::kUint64Element) {
+      ok = append ? ListValue::Append(value, request->field(),
+                                      request->uint64_element(),
+                                      request->if_absent(), &changed)
+                  : ListValue::Remove(value, request->field(),
+                                      request->uint64_element(), &changed);
+    } else {
+      ok = append ? ListValue::Append(value, request->field(),
+                                      request->string_element(),
+                                      request->if_absent(), &changed)
+                  : ListValue::Remove(value, request->field(),
+                                      request->string_element(), &changed);
+    }
 
-  grpc::ServerBuilder builder;
-  builder.AddListeningPort(server_address, grpc::InsecureServerCredentials());
-  builder.RegisterService(&service);
-  std::unique_ptr<grpc::Server> server(builder.BuildAndStart());
-  std::cout << "Server is listening on " << server_address << std::endl;
-  server->Wait();
+    if (!ok) {
+      return BackendDataStructure::INVALID;
+    }
+    return changed ? BackendDataStructure::CHANGED
+                   : BackendDataStructure::UNCHANGED;
+  };
 }
 
-int main(int argc, char **argv) {
-  run_server();
+bool KeyValueStoreImpl::IsValidListRequest(
+    const chirp::ListElementRequest &request) {
+  return request.field() != 0 &&
+         request.element_case() != chirp::ListElementRequest::ELEMENT_NOT_SET;
+}
+
+grpc::Status KeyValueStoreImpl::memory_usage(
+    grpc::ServerContext *context, const chirp::MemoryUsageRequest *request,
+    chirp::MemoryUsageReply *reply) {
+  if (context == nullptr || request == nullptr || reply == nullptr) {
+    return grpc::Status(grpc::FAILED_PRECONDITION,
+                        "`ServerContext`, `MemoryUsageRequest` or "
+                        "`MemoryUsageReply` is nullptr.");
+  }
+
+  std::map<std::string, BackendDataStructure::PrefixUsage> usage;
+  backend_data_.GetMemoryUsage(&usage);
 
-  return 0;
+  reply->set_bytes_used(backend_data_.get_bytes_used());
+  reply->set_memory_limit(backend_data_.get_memory_limit());
+  reply->set_storage(
+      ShardStorage::ModeName(backend_data_.get_storage_mode()));
+  for (const auto &pair : usage) {
+    chirp::PrefixUsage *prefix = reply->add_prefixes();
+    prefix->set_prefix(pair.first);
+    prefix->set_num_of_keys(pair.second.num_of_keys);
+    prefix->set_bytes(pair.second.bytes);
+  }
+  return grpc::Status::OK;
+}
+
+grpc::Status KeyValueStoreImpl::stats(grpc::ServerContext *context,
+                                      const chirp::StatsRequest *request,
+                                      chirp::StatsReply *reply) {
+  if (context == nullptr || request == nullptr || reply == nullptr) {
+    return grpc::Status(
+        grpc::FAILED_PRECONDITION,
+        "`ServerContext`, `StatsRequest` or `StatsReply` is nullptr.");
+  }
+
+  GetStats(reply);
+  return grpc::Status::OK;
+}
+
+grpc::Status KeyValueStoreImpl::exists(grpc::ServerContext *context,
+                                       const chirp::ExistsRequest *request,
+                                       chirp::ExistsReply *reply) {
+  if (context == nullptr || request == nullptr || reply == nullptr) {
+    return grpc::Status(
+        grpc::FAILED_PRECONDITION,
+        "`ServerContext`, `ExistsRequest` or `ExistsReply` is nullptr.");
+  }
+
+  LatencyRecorder recorder(&latencies_[EXISTS]);
+  std::vector<std::string> keys(request->keys().begin(),
+                                request->keys().end());
+  std::vector<bool> exists;
+  backend_data_.Exists(keys, &exists);
+  for (bool found : exists) {
+    reply->add_exists(found);
+  }
+  return grpc::Status::OK;
+}
+
+grpc::Status KeyValueStoreImpl::create_snapshot(
+    grpc::ServerContext *context, const chirp::CreateSnapshotRequest *request,
+    chirp::CreateSnapshotReply *reply) {
+  if (context == nullptr || request == nullptr || reply == nullptr) {
+    return grpc::Status(grpc::FAILED_PRECONDITION,
+                        "`ServerContext`, `CreateSnapshotRequest` or "
+                        "`CreateSnapshotReply` is nullptr.");
+  }
+
+  uint64_t lease_ms =
+      request->lease_ms() > 0 ? request->lease_ms() : kDefaultSnapshotLeaseMs;
+  reply->set_snapshot(backend_data_.CreateSnapshot(lease_ms));
+  return grpc::Status::OK;
+}
+
+grpc::Status KeyValueStoreImpl::release_snapshot(
+    grpc::ServerContext *context, const chirp::ReleaseSnapshotRequest *request,
+    chirp::ReleaseSnapshotReply *reply) {
+  if (context == nullptr || request == nullptr) {
+    return grpc::Status(
+        grpc::FAILED_PRECONDITION,
+        "`ServerContext` or `ReleaseSnapshotRequest` is nullptr.");
+  }
+
+  if (!backend_data_.ReleaseSnapshot(request->snapshot())) {
+    return grpc::Status(grpc::NOT_FOUND, "The snapshot is not open.");
+  }
+  return grpc::Status::OK;
+}
+
+grpc::Status KeyValueStoreImpl::changes(
+    grpc::ServerContext *context, const chirp::ChangesRequest *request,
+    grpc::ServerWriter<chirp::ChangesReply> *writer) {
+  if (context == nullptr || request == nullptr || writer == nullptr) {
+    return grpc::Status(
+        grpc::FAILED_PRECONDITION,
+        "`ServerContext`, `ChangesRequest` or `ServerWriter` is nullptr.");
+  }
+
+  uint64_t next_seq;
+  grpc::Status status = StartChanges(*request, &next_seq);
+  if (!status.ok()) {
+    return status;
+  }
+
+  // The first reply is sent at once, so the client learns where the stream
+  // starts even if nothing changes
+  std::chrono::milliseconds timeout(0);
+  chirp::ChangesReply reply;
+  while (!context->IsCancelled()) {
+    status = NextChanges(*request, &next_seq, timeout, &reply);
+    if (!status.ok()) {
+      return status;
+    }
+    if (!writer->Write(reply)) {
+      break;
+    }
+    timeout = std::chrono::milliseconds(kChangesHeartbeatMs);
+  }
+  return grpc::Status::OK;
+}
+
+grpc::Status KeyValueStoreImpl::watch(
+    grpc::ServerContext *context, const chirp::WatchRequest *request,
+    grpc::ServerWriter<chirp::WatchReply> *writer) {
+  if (context == nullptr || request == nullptr || writer == nullptr) {
+    return grpc::Status(
+        grpc::FAILED_PRECONDITION,
+        "`ServerContext`, `WatchRequest` or `ServerWriter` is nullptr.");
+  }
+
+  std::unique_ptr<WatchTable::Watcher> watcher;
+  grpc::Status status = StartWatch(*request, nullptr, &watcher);
+  if (!status.ok()) {
+    return status;
+  }
+
+  chirp::WatchReply reply;
+  bool ok = writer->Write(reply);
+  while (ok && !context->IsCancelled()) {
+    if (NextWatchEvents(watcher.get(),
+                        std::chrono::milliseconds(kWatchIdleCheckMs), &reply)) {
+      ok = writer->Write(reply);
+    }
+  }
+  StopWatch(watcher.get());
+  return grpc::Status::OK;
+}
+
+grpc::Status KeyValueStoreImpl::WriteFailed(grpc::StatusCode code,
+                                            const std::string &message) const {
+  if (backend_data_.IsReadOnly()) {
+    return ReadOnly();
+  }
+  if (backend_data_.IsOverMemoryLimit()) {
+    return grpc::Status(grpc::RESOURCE_EXHAUSTED,
+                        "The memory limit of the backend is reached.");
+  }
+  return grpc::Status(code, message);
 }
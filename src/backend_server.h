@@ -1,25 +1,297 @@
 #ifndef CHIRP_SRC_BACKEND_SERVER_H_
 #define CHIRP_SRC_BACKEND_SERVER_H_
 
-#include <atomic>
+#include <cstddef>
+#include <chrono>
+#include <condition_variable>
+#include <fstream>
+#include <functional>
 #include <map>
+#include <memory>
+#include <mutex>
 #include <string>
+#include <thread>
+#include <vector>
 
 #include <grpc/grpc.h>
 #include <grpcpp/security/server_credentials.h>
 #include <grpcpp/server.h>
 #include <grpcpp/server_builder.h>
 #include <grpcpp/server_context.h>
+#include <grpcpp/support/byte_buffer.h>
 
+#include "backend_change_log.h"
 #include "backend_data_structure.h"
+#include "backend_latency_histogram.h"
+#include "backend_replication.h"
+#include "backend_value_buffer.h"
+#include "backend_watch_table.h"
+#include "backend_write_ahead_log.h"
 #include "key_value.grpc.pb.h"
 
 // Key-value store implementation inherits from the
-// `chirp::KeyValueStore::Service` which implements the `put`, `get`, and
-// `deletekey` operations
+// `chirp::KeyValueStore::Service` which implements the `put`, `get`,
+// `deletekey`, `multiput`, `multidelete`, `fetch_add`, `compare_and_swap`,
+// `write_batch`, `scan`, `list_append`, `list_remove`, `memory_usage`, `exists`,
+// `create_snapshot`, `release_snapshot`, `changes`, `watch` and `stats`
+// operations
+// A server can also be a primary that backups follow, or a backup that only
+// serves reads.
 class KeyValueStoreImpl final : public chirp::KeyValueStore::Service {
  public:
-  explicit KeyValueStoreImpl();
+  // The maximum number of pairs in one `ScanReply`
+  static const size_t kMaxPairsPerScanChunk = 256;
+  // A `ScanReply` stops taking pairs once it is this large
+  static const size_t kMaxBytesPerScanChunk = 1 << 20;
+  // The maximum number of keys a scan collects at a time
+  static const size_t kMaxKeysPerScanBatch = 4096;
+  // The lease of a read snapshot whose request does not give one
+  static const uint64_t kDefaultSnapshotLeaseMs = 60000;
+  // The maximum number of changes in one `ChangesReply`
+  static const size_t kMaxChangesPerReply = 256;
+  // A changes stream that has nothing to send for this long sends its
+  // `next_seq` anyway
+  static const uint64_t kChangesHeartbeatMs = 1000;
+  // A watch stream that has nothing to send checks this often whether its
+  // client is gone, on the synchronous server
+  static const uint64_t kWatchIdleCheckMs = 1000;
+  // A get reply with a smaller value is copied into one slice by
+  // `EncodeGetReply()`, since that costs less than sharing the value
+  static const size_t kMinSharedReplySize = 1024;
+
+  // The operations whose latencies are recorded
+  // A latency is the time a request takes from when it is parsed to when its
+  // reply is ready, waiting for the write-ahead log included, except on the
+  // asynchronous server, which waits for the log after the handler. A get
+  // is timed per request of its stream, and a scan per batch of keys it
+  // collects.
+  enum Operations : int {
+    PUT = 0,
+    GET,
+    DELETEKEY,
+    MULTIPUT,
+    MULTIDELETE,
+    FETCH_ADD,
+    COMPARE_AND_SWAP,
+    WRITE_BATCH,
+    SCAN,
+    LIST_APPEND,
+    LIST_REMOVE,
+    EXISTS,
+    NUM_OF_OPERATIONS
+  };
+
+  // Constructor that takes the number of shards of the backend data structure
+  // and how it stores the pairs
+  // The backend data structure does its own locking, so requests from
+  // different threads are served concurrently.
+  explicit KeyValueStoreImpl(
+      size_t num_of_shards = BackendDataStructure::kDefaultNumOfShards,
+      const ShardStorage::Options &storage_options = ShardStorage::Options());
+
+  // Stops taking snapshots, expiring keys and collecting versions
+  ~KeyValueStoreImpl();
+
+  // Loads the snapshot at `snapshot_path` if there is one, replays the
+  // write-ahead log records after it, then logs every put and deletekey to
+  // the log at `path` from now on. Loading and replaying both use
+  // `num_of_recovery_threads` threads.
+  // An empty `snapshot_path` disables snapshots.
+  // This should be called before the service starts taking requests.
+  // returns true if this operation succeeds
+  // returns false otherwise
+  bool EnableWriteAheadLog(const std::string &path,
+                           WriteAheadLog::DurabilityModes mode,
+                           size_t num_of_recovery_threads,
+                           const std::string &snapshot_path = "");
+
+  // Writes a snapshot and drops the log records it covers
+  // This requires both the write-ahead log and snapshots to be enabled.
+  // If the storage keeps the pairs on disk, it is flushed instead and no
+  // snapshot file is needed. The deadlines of the keys that have a time to
+  // live are logged again after the snapshot.
+  // Writers keep running while the snapshot is taken.
+  // returns true if this operation succeeds
+  // returns false otherwise
+  bool TakeSnapshot();
+
+  // Makes this server a primary that backups can follow
+  // Every record of the write-ahead log is shipped to the backups, and the
+  // last `log_capacity` records are kept for backups that reconnect. In
+  // `SYNC` mode a write returns once the backups in sync have applied it.
+  // This requires the write-ahead log, and should be called after it is
+  // enabled and before the service starts taking requests.
+  // returns true if this operation succeeds
+  // returns false otherwise
+  bool EnableReplication(ReplicationLog::AckModes mode, size_t log_capacity);
+
+  // returns the service backups follow this server through, to be
+  // registered with the grpc server, or nullptr if this is not a primary
+  inline grpc::Service *get_replication_service() {
+    return replication_service_.get();
+  }
+
+  // returns the records kept for the backups, or nullptr if this is not a
+  // primary
+  inline ReplicationLog *get_replication_log() {
+    return replication_log_.get();
+  }
+
+  // Makes this server a backup of the primary at `primary_address`
+  // The pairs are copied from the primary and kept up to date in a
+  // background thread. Writes are turned down from now on; reads are served
+  // from the pairs applied so far. This should be called before the service
+  // starts taking requests.
+  void FollowPrimary(const std::string &primary_address);
+
+  // returns what keeps this backup up to date, or nullptr if this is not a
+  // backup
+  inline BackupReplicator *get_backup_replicator() {
+    return backup_replicator_.get();
+  }
+
+  // Numbers every change from now on and keeps the last `capacity` of them
+  // for the `changes` streams
+  // This should be called before the service starts taking requests.
+  void EnableChangeLog(size_t capacity);
+
+  // returns the changes the `changes` streams read, or nullptr if they are
+  // not kept
+  inline ChangeLog *get_change_log() { return change_log_.get(); }
+
+  // Checks a changes request and sets `*next_seq` to the sequence number of
+  // the first change the stream sends
+  // returns OK if the stream can start
+  // returns FAILED_PRECONDITION if the changes are not kept, or
+  // OUT_OF_RANGE if the changes from `from_seq` are no longer kept
+  grpc::Status StartChanges(const chirp::ChangesRequest &request,
+                            uint64_t *next_seq);
+
+  // Fills `reply` with the next changes of the stream of `request` from
+  // `*next_seq` on, waiting up to `timeout` for one, and moves `*next_seq`
+  // past them
+  // returns OK if this operation succeeds, even if no change came
+  // returns OUT_OF_RANGE if the changes from `*next_seq` are no longer kept
+  grpc::Status NextChanges(const chirp::ChangesRequest &request,
+                           uint64_t *next_seq,
+                           std::chrono::milliseconds timeout,
+                           chirp::ChangesReply *reply);
+
+  // Checks a watch request and sets `*watcher` to a watcher of its prefixes
+  // that calls `on_event`, which may be empty, after every event
+  // The watcher should be stopped with `StopWatch()` before it is destroyed.
+  // returns OK if the watch starts
+  // returns INVALID_ARGUMENT if no prefix is given
+  grpc::Status StartWatch(const chirp::WatchRequest &request,
+                          const std::function<void()> &on_event,
+                          std::unique_ptr<WatchTable::Watcher> *watcher);
+
+  // Fills `reply` with the events of `watcher`, waiting up to `timeout` for
+  // one
+  // returns true if `reply` has anything to send
+  // returns false otherwise
+  bool NextWatchEvents(WatchTable::Watcher *watcher,
+                       std::chrono::milliseconds timeout,
+                       chirp::WatchReply *reply);
+
+  // Stops telling `watcher` about writes
+  void StopWatch(WatchTable::Watcher *watcher);
+
+  // Takes a snapshot every `interval` in a background thread
+  void StartTakingSnapshots(std::chrono::seconds interval);
+
+  // Removes expired keys every `interval` in a background thread
+  // Expired keys are hidden from reads as soon as they expire; this only
+  // gives their memory back.
+  void StartExpiringKeys(std::chrono::milliseconds interval);
+
+  // Drops the old values read snapshots no longer need every `interval` in
+  // a background thread
+  // This also releases the read snapshots whose leases have run out.
+  void StartCollectingVersions(std::chrono::milliseconds interval);
+
+  // Looks up the keys of one get request, in the order of the request
+  // Missing keys get empty values.
+  // returns true if this operation succeeds
+  // returns false if the request reads at a snapshot that can no longer be
+  // read
+  bool LookUp(const chirp::GetRequest &request,
+              std::vector<std::string> *values);
+
+  // Looks up the keys of one get request like `LookUp()`, sharing the
+  // values the storage holds instead of copying them
+  bool LookUpShared(const chirp::GetRequest &request,
+                    std::vector<ValueBuffer> *values);
+
+  // Serializes the `chirp::GetReply` of `value` to `reply` without copying
+  // the value
+  // `reply` is a slice with the tag and length of the field and a slice
+  // pointing at the bytes of `value`, which keeps them alive until grpc is
+  // done with it. A value smaller than `kMinSharedReplySize` is copied into
+  // a single slice instead.
+  static void EncodeGetReply(const ValueBuffer &value,
+                             grpc::ByteBuffer *reply);
+
+  // Does the put of `request` like `put()`, taking its value instead of
+  // copying it
+  grpc::Status PutTakingValue(chirp::PutRequest *request);
+
+  // returns the status of a get at a snapshot that can no longer be read
+  grpc::Status SnapshotNotReadable() const;
+
+  // returns the status of a write turned down, or not made durable, because
+  // the write-ahead log failed
+  grpc::Status ReadOnly() const;
+
+  // Where a scan stream is in its range
+  // Keys are collected `kMaxKeysPerScanBatch` at a time, and the next batch
+  // starts after the last key of the previous one, so a scan holds one batch
+  // however large its range. An unordered storage walks every shard once per
+  // batch.
+  struct ScanCursor {
+    ScanCursor() : next(0), collected(0), exhausted(false) {}
+
+    // The request being served
+    chirp::ScanRequest request;
+    // The keys of the current batch and the first one not written yet
+    std::vector<std::string> keys;
+    size_t next;
+    // The next batch starts at this key
+    std::string start;
+    // The number of keys collected so far, which the limit counts
+    uint64_t collected;
+    // true once no key of the range is left to collect
+    bool exhausted;
+  };
+
+  // Sets `cursor` to the start of the range of `request`
+  void StartScan(const chirp::ScanRequest &request, ScanCursor *cursor);
+
+  // Fills `reply` with the pairs of the next chunk of the range and moves
+  // `cursor` past them. Keys deleted since they were collected are skipped.
+  // returns true if `reply` holds at least one pair
+  // returns false if there are no more pairs
+  bool NextScanChunk(ScanCursor *cursor, chirp::ScanReply *reply);
+
+  // returns the backend data structure serving the requests
+  inline BackendDataStructure *get_backend_data() { return &backend_data_; }
+
+  // returns the name of the RPC of `operation`
+  static const char *OperationName(Operations operation);
+
+  // Fills `reply` with the latencies of every operation since the server
+  // started, the contention of the shard locks, the keys and bytes per key
+  // prefix, and on a primary, how many backups are in sync
+  void GetStats(chirp::StatsReply *reply);
+
+  // Appends the stats of every `interval` to the file at `path`, at the end
+  // of the interval, in a background thread
+  // Unlike `GetStats()`, the latencies and lock contention are those of the
+  // interval alone.
+  // returns true if this operation succeeds
+  // returns false if the file cannot be opened
+  bool StartDumpingStats(const std::string &path,
+                         std::chrono::milliseconds interval);
 
   // Accepts put requests
   grpc::Status put(grpc::ServerContext *context,
@@ -36,11 +308,167 @@ class KeyValueStoreImpl final : public chirp::KeyValueStore::Service {
                          const chirp::DeleteRequest *request,
                          chirp::DeleteReply *reply) override;
 
+  // Accepts multiput requests
+  grpc::Status multiput(grpc::ServerContext *context,
+                        const chirp::MultiPutRequest *request,
+                        chirp::MultiPutReply *reply) override;
+
+  // Accepts multidelete requests
+  grpc::Status multidelete(grpc::ServerContext *context,
+                           const chirp::MultiDeleteRequest *request,
+                           chirp::MultiDeleteReply *reply) override;
+
+  // Accepts fetch_add requests
+  grpc::Status fetch_add(grpc::ServerContext *context,
+                         const chirp::FetchAddRequest *request,
+                         chirp::FetchAddReply *reply) override;
+
+  // Accepts compare_and_swap requests
+  grpc::Status compare_and_swap(grpc::ServerContext *context,
+                                const chirp::CompareAndSwapRequest *request,
+                                chirp::CompareAndSwapReply *reply) override;
+
+  // Accepts write_batch requests
+  // The writes become visible together, see
+  // `BackendDataStructure::ApplyBatch()`.
+  grpc::Status write_batch(grpc::ServerContext *context,
+                           const chirp::WriteBatchRequest *request,
+                           chirp::WriteBatchReply *reply) override;
+
+  // Accepts scan requests
+  // The range is written in chunks. `Write()` blocks while the client is
+  // not reading, so a slow client holds back only its own scan.
+  grpc::Status scan(grpc::ServerContext *context,
+                    const chirp::ScanRequest *request,
+                    grpc::ServerWriter<chirp::ScanReply> *writer) override;
+
+  // Accepts list_append requests
+  grpc::Status list_append(grpc::ServerContext *context,
+                           const chirp::ListElementRequest *request,
+                           chirp::ListElementReply *reply) override;
+
+  // Accepts list_remove requests
+  grpc::Status list_remove(grpc::ServerContext *context,
+                           const chirp::ListElementRequest *request,
+                           chirp::ListElementReply *reply) override;
+
+  // Accepts memory_usage requests
+  grpc::Status memory_usage(grpc::ServerContext *context,
+                            const chirp::MemoryUsageRequest *request,
+                            chirp::MemoryUsageReply *reply) override;
+
+  // Accepts stats requests
+  grpc::Status stats(grpc::ServerContext *context,
+                     const chirp::StatsRequest *request,
+                     chirp::StatsReply *reply) override;
+
+  // Accepts exists requests
+  grpc::Status exists(grpc::ServerContext *context,
+                      const chirp::ExistsRequest *request,
+                      chirp::ExistsReply *reply) override;
+
+  // Accepts create_snapshot requests
+  // The snapshot only lives on this server, so backups and other servers do
+  // not know its handle.
+  grpc::Status create_snapshot(grpc::ServerContext *context,
+                               const chirp::CreateSnapshotRequest *request,
+                               chirp::CreateSnapshotReply *reply) override;
+
+  // Accepts release_snapshot requests
+  grpc::Status release_snapshot(grpc::ServerContext *context,
+                                const chirp::ReleaseSnapshotRequest *request,
+                                chirp::ReleaseSnapshotReply *reply) override;
+
+  // Accepts changes requests
+  // The changes kept from `from_seq` on are sent first, then every change as
+  // it is committed, until the client cancels the stream. The stream ends
+  // with OUT_OF_RANGE if the client falls so far behind that the changes it
+  // needs are dropped, in which case it should read the keys again.
+  grpc::Status changes(grpc::ServerContext *context,
+                       const chirp::ChangesRequest *request,
+                       grpc::ServerWriter<chirp::ChangesReply> *writer) override;
+
+  // Accepts watch requests
+  // An empty reply is sent once the prefixes are watched, so the client
+  // knows every write from then on is sent. Then the writes of the watched
+  // keys are sent as they are applied, until the client cancels the stream.
+  grpc::Status watch(grpc::ServerContext *context,
+                     const chirp::WatchRequest *request,
+                     grpc::ServerWriter<chirp::WatchReply> *writer) override;
+
  private:
+  // returns the status of a write the backend data structure turned down
+  // It is `ReadOnly()` if the write-ahead log failed, `RESOURCE_EXHAUSTED`
+  // if the memory limit is reached, and `code` with `message` otherwise.
+  grpc::Status WriteFailed(grpc::StatusCode code,
+                           const std::string &message) const;
+
+  // returns the status of a write sent to a backup, which only its primary
+  // takes
+  grpc::Status WriteToBackup() const;
+
+  // returns the function that applies a list_append (`append` is true) or
+  // list_remove request to a value
+  // `request` should outlive the function.
+  static BackendDataStructure::Updater ListUpdater(
+      const chirp::ListElementRequest *request, bool append);
+
+  // returns true if `request` has a field number and an element
+  static bool IsValidListRequest(const chirp::ListElementRequest &request);
+
+  // Applies a list_append (`append` is true) or list_remove request
+  grpc::Status UpdateList(grpc::ServerContext *context,
+                          const chirp::ListElementRequest *request,
+                          chirp::ListElementReply *reply, bool append);
+
+  // Appends the stats since the previous dump to `stats_file_`
+  // `counts` and `contention` are what the histograms and shard locks held at
+  // the previous dump, and are moved to what they hold now.
+  void DumpStats(std::vector<LatencyHistogram::Counts> *counts,
+                 BackendDataStructure::LockContention *contention);
+
   BackendDataStructure backend_data_;
 
-  // spinlock
-  std::atomic_flag lock_;
+  // returns where the log records are moved to while a snapshot is taken
+  inline std::string OldWriteAheadLogPath() const {
+    return write_ahead_log_path_ + ".old";
+  }
+
+  // nullptr if this is not a primary. The write-ahead log appends to it, so
+  // it is destroyed after the log.
+  std::unique_ptr<ReplicationLog> replication_log_;
+
+  // nullptr if the changes are not kept. The data structure appends to it,
+  // so it is destroyed after the data structure's writers stop.
+  std::unique_ptr<ChangeLog> change_log_;
+
+  // nullptr if the write-ahead log is not enabled
+  std::unique_ptr<WriteAheadLog> write_ahead_log_;
+  std::string write_ahead_log_path_;
+
+  std::unique_ptr<ReplicationServiceImpl> replication_service_;
+  // nullptr if this is not a backup
+  std::unique_ptr<BackupReplicator> backup_replicator_;
+
+  // Empty if snapshots are not enabled
+  std::string snapshot_path_;
+  // Only one snapshot is taken at a time
+  std::mutex snapshot_mutex_;
+
+  // The latencies of every operation, recorded without a lock
+  LatencyHistogram latencies_[NUM_OF_OPERATIONS];
+  // Where the stats are dumped, only written by `stats_thread_`
+  std::ofstream stats_file_;
+
+  // The threads taking snapshots, expiring keys, collecting versions and
+  // dumping stats periodically, and how they are stopped
+  std::thread snapshot_thread_;
+  std::thread expiry_thread_;
+  std::thread version_thread_;
+  std::thread stats_thread_;
+  std::mutex background_thread_mutex_;
+  std::condition_variable background_thread_cv_;
+  bool stopping_;
 };
 
 #endif /* CHIRP_SRC_BACKEND_SERVER_H_ */
@@ -0,0 +1,250 @@
+#include <chrono>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <thread>
+
+#include <grpc/grpc.h>
+#include <grpcpp/security/server_credentials.h>
+#include <grpcpp/server.h>
+#include <grpcpp/server_builder.h>
+
+#include <gflags/gflags.h>
+
+#include "backend_async_server.h"
+#include "backend_data_structure.h"
+#include "backend_server.h"
+
+#define DEFAULT_HOST_AND_PORT "0.0.0.0:50000"
+
+DEFINE_string(address, DEFAULT_HOST_AND_PORT,
+              "The host and port the server listens on.");
+DEFINE_uint64(num_of_shards, BackendDataStructure::kDefaultNumOfShards,
+              "The number of shards the key-value mapping is split into.");
+DEFINE_string(storage, "heap",
+              "How the key-value pairs are stored: \"heap\" keeps every key "
+              "and value in its own allocation, \"arena\" packs them into "
+              "per-shard slabs, \"lsm\" keeps recent writes in memory and "
+              "older pairs in sorted files under --storage_path, "
+              "\"ordered\" keeps every shard sorted for faster scans, "
+              "\"swiss\" keeps the pairs in a SIMD-probed hash table for "
+              "faster lookups.");
+DEFINE_string(storage_path, "",
+              "The directory of the files of the \"lsm\" storage.");
+DEFINE_uint64(memtable_size, ShardStorage::kDefaultMemtableSize,
+              "The number of bytes a shard of the \"lsm\" storage keeps in "
+              "memory before it writes them to a file.");
+DEFINE_uint64(memory_limit_bytes, 0,
+              "The number of bytes the key-value pairs may take before writes "
+              "fail with RESOURCE_EXHAUSTED. 0 means there is no limit.");
+DEFINE_bool(lock_free_reads, false,
+            "Serve gets without taking any lock, from a second copy of the "
+            "key-value pairs that takes about as much memory again. Not "
+            "available with the \"lsm\" storage.");
+DEFINE_uint64(expiry_interval_ms, 100,
+              "The number of milliseconds between the passes that remove "
+              "expired keys. 0 leaves expired keys in memory, hidden from "
+              "reads.");
+DEFINE_uint64(version_gc_interval_ms, 1000,
+              "The number of milliseconds between the passes that drop the "
+              "old values read snapshots no longer need and release the "
+              "snapshots whose leases have run out. 0 keeps them until the "
+              "server stops.");
+DEFINE_string(wal_path, "",
+              "The path of the write-ahead log. Leave it empty to keep the "
+              "data in memory only.");
+DEFINE_string(durability, "batch",
+              "How the write-ahead log is synced to disk: \"sync\" fsyncs "
+              "every write, \"batch\" fsyncs groups of concurrent writes, "
+              "\"none\" never fsyncs.");
+DEFINE_uint64(num_of_recovery_threads, 0,
+              "The number of threads loading the snapshot and replaying the "
+              "write-ahead log on startup. 0 means one per core.");
+DEFINE_string(snapshot_path, "",
+              "The path of the snapshot file. Snapshots need the write-ahead "
+              "log. Leave it empty to disable snapshots.");
+DEFINE_uint64(snapshot_interval, 600,
+              "The number of seconds between two snapshots. 0 disables "
+              "periodic snapshots.");
+DEFINE_bool(async, false,
+            "Serve the requests with the asynchronous completion-queue server "
+            "instead of one thread per call.");
+DEFINE_uint64(num_of_completion_queues, 0,
+              "The number of completion queues of the asynchronous server, "
+              "each polled by one thread. 0 means one per core.");
+DEFINE_bool(shared_nothing, false,
+            "Give every completion queue of the asynchronous server its own "
+            "share of the shards, and hand single-key calls to the queue "
+            "owning the key.");
+DEFINE_string(replication, "",
+              "Make this server a primary that ships its write-ahead log to "
+              "backups: \"async\" returns writes once they are durable here, "
+              "\"sync\" also waits for every backup in sync to apply them. "
+              "Needs --wal_path. Leave it empty to disable replication.");
+DEFINE_uint64(replication_log_size, 100000,
+              "The number of latest records a primary keeps for its backups. "
+              "A backup further behind is sent a full copy instead.");
+DEFINE_string(primary, "",
+              "The host and port of the primary to follow. A backup serves "
+              "reads only and keeps its data in memory.");
+DEFINE_uint64(change_log_size, 0,
+              "The number of latest changes kept for the `changes` streams. "
+              "Every put and delete is then numbered under one lock shared by "
+              "all shards. 0 disables the streams.");
+DEFINE_string(stats_path, "./log/backend_stats.log",
+              "The file the latencies, lock contention and key counts are "
+              "appended to every --stats_interval_ms.");
+DEFINE_uint64(stats_interval_ms, 60000,
+              "Milliseconds between two dumps of the stats. 0 disables the "
+              "dumps; the `stats` RPC is always served.");
+
+void run_server() {
+  std::string server_address(FLAGS_address);
+  ShardStorage::Options storage_options;
+  if (!ShardStorage::ParseMode(FLAGS_storage, &storage_options.mode)) {
+    std::cerr << "Unknown storage mode: " << FLAGS_storage << std::endl;
+    return;
+  }
+  if (storage_options.mode == ShardStorage::LSM &&
+      FLAGS_storage_path.empty()) {
+    std::cerr << "The lsm storage needs --storage_path" << std::endl;
+    return;
+  }
+  if (storage_options.mode == ShardStorage::LSM && FLAGS_lock_free_reads) {
+    std::cerr << "The lsm storage cannot be read without locks" << std::endl;
+    return;
+  }
+  if (FLAGS_shared_nothing && !FLAGS_async) {
+    std::cerr << "--shared_nothing needs --async" << std::endl;
+    return;
+  }
+  ReplicationLog::AckModes ack_mode = ReplicationLog::ASYNC;
+  if (!FLAGS_replication.empty()) {
+    if (!ReplicationLog::ParseAckMode(FLAGS_replication, &ack_mode)) {
+      std::cerr << "Unknown replication mode: " << FLAGS_replication
+                << std::endl;
+      return;
+    }
+    if (FLAGS_wal_path.empty()) {
+      std::cerr << "--replication needs --wal_path" << std::endl;
+      return;
+    }
+  }
+  if (!FLAGS_primary.empty() &&
+      (!FLAGS_replication.empty() || !FLAGS_wal_path.empty())) {
+    std::cerr << "A backup takes neither --replication nor --wal_path"
+              << std::endl;
+    return;
+  }
+  storage_options.directory = FLAGS_storage_path;
+  storage_options.memtable_size = FLAGS_memtable_size;
+
+  KeyValueStoreImpl service(FLAGS_num_of_shards, storage_options);
+  if (FLAGS_lock_free_reads) {
+    service.get_backend_data()->EnableLockFreeReads();
+  }
+  if (!service.get_backend_data()->OpenStorage()) {
+    std::cerr << "Failed to open the storage at " << FLAGS_storage_path
+              << std::endl;
+    return;
+  }
+  service.get_backend_data()->set_memory_limit(FLAGS_memory_limit_bytes);
+
+  if (!FLAGS_wal_path.empty()) {
+    WriteAheadLog::DurabilityModes mode;
+    if (!WriteAheadLog::ParseDurabilityMode(FLAGS_durability, &mode)) {
+      std::cerr << "Unknown durability mode: " << FLAGS_durability
+                << std::endl;
+      return;
+    }
+
+    size_t num_of_recovery_threads = FLAGS_num_of_recovery_threads;
+    if (num_of_recovery_threads == 0) {
+      num_of_recovery_threads = std::thread::hardware_concurrency();
+    }
+    if (!service.EnableWriteAheadLog(FLAGS_wal_path, mode,
+                                     num_of_recovery_threads,
+                                     FLAGS_snapshot_path)) {
+      std::cerr << "Failed to recover from the write-ahead log "
+                << FLAGS_wal_path << std::endl;
+      return;
+    }
+
+    // Storage kept on disk truncates the log without a snapshot file
+    if ((!FLAGS_snapshot_path.empty() ||
+         service.get_backend_data()->is_storage_persistent()) &&
+        FLAGS_snapshot_interval > 0) {
+      service.StartTakingSnapshots(
+          std::chrono::seconds(FLAGS_snapshot_interval));
+    }
+  }
+
+  // Changes are numbered from here on, not while the log is replayed
+  if (FLAGS_change_log_size > 0) {
+    service.EnableChangeLog(FLAGS_change_log_size);
+  }
+
+  if (!FLAGS_replication.empty() &&
+      !service.EnableReplication(ack_mode, FLAGS_replication_log_size)) {
+    std::cerr << "Failed to enable replication" << std::endl;
+    return;
+  }
+  if (!FLAGS_primary.empty()) {
+    service.FollowPrimary(FLAGS_primary);
+  }
+
+  // Deadlines come with the records on a backup, which drops expired keys on
+  // its own
+  if (FLAGS_expiry_interval_ms > 0) {
+    service.StartExpiringKeys(
+        std::chrono::milliseconds(FLAGS_expiry_interval_ms));
+  }
+  if (FLAGS_version_gc_interval_ms > 0) {
+    service.StartCollectingVersions(
+        std::chrono::milliseconds(FLAGS_version_gc_interval_ms));
+  }
+  // The stats are only diagnostics, so the server still starts without them
+  if (FLAGS_stats_interval_ms > 0 &&
+      !service.StartDumpingStats(
+          FLAGS_stats_path,
+          std::chrono::milliseconds(FLAGS_stats_interval_ms))) {
+    std::cerr << "Failed to open the stats file " << FLAGS_stats_path
+              << "; the stats are not dumped" << std::endl;
+  }
+
+  if (FLAGS_async) {
+    AsyncKeyValueStoreServer server(&service, FLAGS_num_of_completion_queues,
+                                    FLAGS_shared_nothing);
+    if (service.get_replication_service() != nullptr) {
+      server.RegisterService(service.get_replication_service());
+    }
+    if (!server.Start(server_address)) {
+      std::cerr << "Failed to listen on " << server_address << std::endl;
+      return;
+    }
+    std::cout << "Server is listening on " << server_address << " with "
+              << server.get_num_of_completion_queues()
+              << " completion queues"
+              << (server.is_shared_nothing() ? ", shared nothing" : "")
+              << std::endl;
+    server.Wait();
+    return;
+  }
+
+  grpc::ServerBuilder builder;
+  builder.AddListeningPort(server_address, grpc::InsecureServerCredentials());
+  builder.RegisterService(&service);
+  if (service.get_replication_service() != nullptr) {
+    builder.RegisterService(service.get_replication_service());
+  }
+  std::unique_ptr<grpc::Server> server(builder.BuildAndStart());
+  std::cout << "Server is listening on " << server_address << std::endl;
+  server->Wait();
+}
+
+int main(int argc, char **argv) {
+  gflags::ParseCommandLineFlags(&argc, &argv, true);
+  run_server();
+
+  return 0;
+}
@@ -0,0 +1,735 @@
+#include "backend_shard_storage.h"
+
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
+#include <cstring>
+#include <utility>
+
+#include "backend_lsm_storage.h"
+#include "hash.h"
+
+namespace {
+// Size of the key size and value size at the start of an arena record
+const size_t kRecordHeaderSize = 2 * sizeof(uint32_t);
+
+// The index is grown once it is more than 4/5 full
+const size_t kMaxLoadNumerator = 4;
+const size_t kMaxLoadDenominator = 5;
+
+// The number of slots of the first index
+const int kMinSlotBits = 4;
+
+// Multiplier of Fibonacci hashing
+// The shard of a key is picked from the low bits of the same hash, so the
+// slot index is taken from the high bits of a scrambled hash instead.
+const uint64_t kHashMultiplier = 0x9E3779B97F4A7C15ULL;
+
+// Size of a libstdc++ `std::string` that fits in the string itself
+const size_t kMaxInlineStringSize = 15;
+
+// returns the heap memory a `ValueBuffer` of `size` bytes holds: one block
+// with the reference counts and the string, and the bytes of the string
+inline size_t ValueBufferHeapSizeOf(size_t size) {
+  size_t block_size = sizeof(void *) + 2 * sizeof(int) + sizeof(std::string);
+  return ShardStorage::MallocChunkSizeOf(block_size) +
+         ShardStorage::StringHeapSizeOf(size);
+}
+
+inline uint32_t KeySizeOf(const char *record) {
+  uint32_t size;
+  std::memcpy(&size, record, sizeof(size));
+  return size;
+}
+
+inline uint32_t ValueSizeOf(const char *record) {
+  uint32_t size;
+  std::memcpy(&size, record + sizeof(uint32_t), sizeof(size));
+  return size;
+}
+
+inline const char *KeyOf(const char *record) {
+  return record + kRecordHeaderSize;
+}
+
+inline const char *ValueOf(const char *record) {
+  return record + kRecordHeaderSize + KeySizeOf(record);
+}
+
+// Fills `record` with the pair
+inline void WriteRecord(char *record, const std::string &key,
+                        const std::string &value) {
+  uint32_t key_size = static_cast<uint32_t>(key.size());
+  uint32_t value_size = static_cast<uint32_t>(value.size());
+  std::memcpy(record, &key_size, sizeof(key_size));
+  std::memcpy(record + sizeof(key_size), &value_size, sizeof(value_size));
+  std::memcpy(record + kRecordHeaderSize, key.data(), key.size());
+  std::memcpy(record + kRecordHeaderSize + key.size(), value.data(),
+              value.size());
+}
+
+// returns the slot index of `hash` in a table of 2^`bits` slots
+inline size_t SlotIndexOf(uint64_t hash, int bits) {
+  return static_cast<size_t>((hash * kHashMultiplier) >> (64 - bits));
+}
+
+// Control bytes of the swiss mode's slots that are not full
+// A full slot holds 7 bits of its hash, so only these are negative.
+const int8_t kEmptyControl = -128;
+const int8_t kDeletedControl = -2;
+
+// The swiss table is rebuilt once more than 7/8 of its slots are full or
+// deleted
+const size_t kSwissMaxLoadNumerator = 7;
+const size_t kSwissMaxLoadDenominator = 8;
+
+// returns the control byte of a full slot of `hash`
+// The swiss mode takes its control bytes from the low bits of the hash and
+// the slot from the others, so every bit needs to depend on the whole key:
+// `std::hash` is mixed by `MixHash()` first.
+inline int8_t ControlOf(uint64_t hash) {
+  return static_cast<int8_t>(hash & 0x7F);
+}
+
+// returns a mask with bit i set if the i-th control byte of the group at
+// `controls` is `control`
+inline uint32_t MatchControl(const int8_t *controls, int8_t control) {
+#ifdef __SSE2__
+  __m128i group =
+      _mm_loadu_si128(reinterpret_cast<const __m128i *>(controls));
+  return static_cast<uint32_t>(
+      _mm_movemask_epi8(_mm_cmpeq_epi8(group, _mm_set1_epi8(control))));
+#else
+  uint32_t mask = 0;
+  for (size_t i = 0; i < SwissShardStorage::kGroupSize; ++i) {
+    mask |= static_cast<uint32_t>(controls[i] == control) << i;
+  }
+  return mask;
+#endif
+}
+
+// returns a mask with bit i set if the i-th slot of the group at `controls`
+// is empty or deleted
+inline uint32_t MatchFree(const int8_t *controls) {
+#ifdef __SSE2__
+  // These are the control bytes with the sign bit set
+  return static_cast<uint32_t>(_mm_movemask_epi8(
+      _mm_loadu_si128(reinterpret_cast<const __m128i *>(controls))));
+#else
+  uint32_t mask = 0;
+  for (size_t i = 0; i < SwissShardStorage::kGroupSize; ++i) {
+    mask |= static_cast<uint32_t>(controls[i] < 0) << i;
+  }
+  return mask;
+#endif
+}
+}  // Anonymous namespace
+
+const size_t ArenaShardStorage::kSizeClassGranularity;
+const size_t ArenaShardStorage::kMaxSlabRecordSize;
+const size_t ArenaShardStorage::kMinSlabSize;
+const size_t ArenaShardStorage::kMaxSlabSize;
+
+const size_t SwissShardStorage::kGroupSize;
+const size_t SwissShardStorage::kMaxInlineKeySize;
+
+const size_t ShardStorage::kDefaultMemtableSize;
+
+std::unique_ptr<ShardStorage> ShardStorage::Create(const Options &options,
+                                                   size_t index) {
+  if (options.mode == ARENA) {
+    return std::unique_ptr<ShardStorage>(new ArenaShardStorage());
+  } else if (options.mode == LSM) {
+    return std::unique_ptr<ShardStorage>(new LsmShardStorage(
+        options.directory, index, options.memtable_size));
+  } else if (options.mode == ORDERED) {
+    return std::unique_ptr<ShardStorage>(new OrderedShardStorage());
+  } else if (options.mode == SWISS) {
+    return std::unique_ptr<ShardStorage>(new SwissShardStorage());
+  }
+  return std::unique_ptr<ShardStorage>(new HeapShardStorage());
+}
+
+bool ShardStorage::ParseMode(const std::string &name, Modes *mode) {
+  if (name == "heap") {
+    *mode = HEAP;
+  } else if (name == "arena") {
+    *mode = ARENA;
+  } else if (name == "lsm") {
+    *mode = LSM;
+  } else if (name == "ordered") {
+    *mode = ORDERED;
+  } else if (name == "swiss") {
+    *mode = SWISS;
+  } else {
+    return false;
+  }
+  return true;
+}
+
+const char *ShardStorage::ModeName(Modes mode) {
+  switch (mode) {
+    case ARENA:
+      return "arena";
+    case LSM:
+      return "lsm";
+    case ORDERED:
+      return "ordered";
+    case SWISS:
+      return "swiss";
+    default:
+      return "heap";
+  }
+}
+
+size_t ShardStorage::MallocChunkSizeOf(size_t size) {
+  size_t chunk = (size + sizeof(size_t) + 15) & ~static_cast<size_t>(15);
+  return chunk < 32 ? 32 : chunk;
+}
+
+size_t ShardStorage::StringHeapSizeOf(size_t size) {
+  return size > kMaxInlineStringSize ? MallocChunkSizeOf(size + 1) : 0;
+}
+
+bool ShardStorage::GetShared(const std::string &key,
+                             ValueBuffer *value) const {
+  std::string copy;
+  if (!Get(key, value != nullptr ? &copy : nullptr)) {
+    return false;
+  }
+
+  if (value != nullptr) {
+    *value = ValueBuffer(std::move(copy));
+  }
+  return true;
+}
+
+void ShardStorage::Scan(const std::string &start, const std::string &end,
+                        size_t limit, const Visitor &visitor) const {
+  ForEach([&](const char *key, size_t key_size, const char *value,
+              size_t value_size) {
+    if (start.compare(0, start.size(), key, key_size) <= 0 &&
+        (end.empty() || end.compare(0, end.size(), key, key_size) > 0)) {
+      visitor(key, key_size, value, value_size);
+    }
+  });
+}
+
+bool HeapShardStorage::Get(const std::string &key, std::string *value) const {
+  auto it = key_value_map_.find(key);
+  if (it == key_value_map_.end()) {
+    return false;
+  }
+
+  if (value != nullptr) {
+    *value = it->second.str();
+  }
+  return true;
+}
+
+size_t HeapShardStorage::Put(const std::string &key,
+                             const std::string &value) {
+  return PutShared(key, ValueBuffer(value));
+}
+
+bool HeapShardStorage::GetShared(const std::string &key,
+                                 ValueBuffer *value) const {
+  auto it = key_value_map_.find(key);
+  if (it == key_value_map_.end()) {
+    return false;
+  }
+
+  if (value != nullptr) {
+    *value = it->second;
+  }
+  return true;
+}
+
+size_t HeapShardStorage::PutShared(const std::string &key,
+                                   const ValueBuffer &value) {
+  auto it = key_value_map_.find(key);
+  if (it == key_value_map_.end()) {
+    key_value_map_.emplace(key, value);
+    return 0;
+  }
+
+  size_t previous = BytesOf(key.size(), it->second.size());
+  it->second = value;
+  return previous;
+}
+
+size_t HeapShardStorage::Erase(const std::string &key) {
+  auto it = key_value_map_.find(key);
+  if (it == key_value_map_.end()) {
+    return 0;
+  }
+
+  size_t bytes = BytesOf(key.size(), it->second.size());
+  key_value_map_.erase(it);
+  return bytes;
+}
+
+void HeapShardStorage::ForEach(const Visitor &visitor) const {
+  for (const auto &pair : key_value_map_) {
+    visitor(pair.first.data(), pair.first.size(), pair.second.data(),
+            pair.second.size());
+  }
+}
+
+size_t HeapShardStorage::BytesOf(size_t key_size, size_t value_size) const {
+  // A node is the next pointer, the pair and the cached hash, and the bucket
+  // array holds about one pointer per node
+  size_t node_size = sizeof(void *) +
+                     sizeof(std::pair<const std::string, ValueBuffer>) +
+                     sizeof(size_t);
+  return MallocChunkSizeOf(node_size) + sizeof(void *) +
+         StringHeapSizeOf(key_size) + ValueBufferHeapSizeOf(value_size);
+}
+
+bool OrderedShardStorage::Get(const std::string &key,
+                              std::string *value) const {
+  auto it = key_value_map_.find(key);
+  if (it == key_value_map_.end()) {
+    return false;
+  }
+
+  if (value != nullptr) {
+    *value = it->second.str();
+  }
+  return true;
+}
+
+size_t OrderedShardStorage::Put(const std::string &key,
+                                const std::string &value) {
+  return PutShared(key, ValueBuffer(value));
+}
+
+bool OrderedShardStorage::GetShared(const std::string &key,
+                                    ValueBuffer *value) const {
+  auto it = key_value_map_.find(key);
+  if (it == key_value_map_.end()) {
+    return false;
+  }
+
+  if (value != nullptr) {
+    *value = it->second;
+  }
+  return true;
+}
+
+size_t OrderedShardStorage::PutShared(const std::string &key,
+                                      const ValueBuffer &value) {
+  auto it = key_value_map_.lower_bound(key);
+  if (it == key_value_map_.end() || it->first != key) {
+    key_value_map_.emplace_hint(it, key, value);
+    return 0;
+  }
+
+  size_t previous = BytesOf(key.size(), it->second.size());
+  it->second = value;
+  return previous;
+}
+
+size_t OrderedShardStorage::Erase(const std::string &key) {
+  auto it = key_value_map_.find(key);
+  if (it == key_value_map_.end()) {
+    return 0;
+  }
+
+  size_t bytes = BytesOf(key.size(), it->second.size());
+  key_value_map_.erase(it);
+  return bytes;
+}
+
+void OrderedShardStorage::ForEach(const Visitor &visitor) const {
+  for (const auto &pair : key_value_map_) {
+    visitor(pair.first.data(), pair.first.size(), pair.second.data(),
+            pair.second.size());
+  }
+}
+
+void OrderedShardStorage::Scan(const std::string &start,
+                               const std::string &end, size_t limit,
+                               const Visitor &visitor) const {
+  size_t num_of_visited = 0;
+  for (auto it = key_value_map_.lower_bound(start);
+       it != key_value_map_.end() && (end.empty() || it->first < end) &&
+       (limit == 0 || num_of_visited < limit);
+       ++it, ++num_of_visited) {
+    visitor(it->first.data(), it->first.size(), it->second.data(),
+            it->second.size());
+  }
+}
+
+size_t OrderedShardStorage::BytesOf(size_t key_size, size_t value_size) const {
+  // A node is the color, the parent, left and right pointers and the pair
+  size_t node_size = 4 * sizeof(void *) +
+                     sizeof(std::pair<const std::string, ValueBuffer>);
+  return MallocChunkSizeOf(node_size) + StringHeapSizeOf(key_size) +
+         ValueBufferHeapSizeOf(value_size);
+}
+
+ArenaShardStorage::ArenaShardStorage()
+    : slots_(static_cast<size_t>(1) << kMinSlotBits),
+      slot_bits_(kMinSlotBits),
+      size_(0),
+      slabs_(),
+      slab_next_(nullptr),
+      slab_left_(0),
+      next_slab_size_(kMinSlabSize),
+      free_lists_(kMaxSlabRecordSize / kSizeClassGranularity + 1, nullptr) {}
+
+ArenaShardStorage::~ArenaShardStorage() {
+  // Slab records go away with their slabs
+  for (const Slot &slot : slots_) {
+    if (slot.record == nullptr) {
+      continue;
+    }
+    size_t size = RecordSizeOf(KeySizeOf(slot.record),
+                               ValueSizeOf(slot.record));
+    if (size > kMaxSlabRecordSize) {
+      delete[] slot.record;
+    }
+  }
+}
+
+bool ArenaShardStorage::Get(const std::string &key,
+                            std::string *value) const {
+  const Slot &slot = slots_[Find(key, std::hash<std::string>()(key))];
+  if (slot.record == nullptr) {
+    return false;
+  }
+
+  if (value != nullptr) {
+    value->assign(ValueOf(slot.record), ValueSizeOf(slot.record));
+  }
+  return true;
+}
+
+size_t ArenaShardStorage::Put(const std::string &key,
+                              const std::string &value) {
+  uint64_t hash = std::hash<std::string>()(key);
+  size_t index = Find(key, hash);
+  size_t size = RecordSizeOf(key.size(), value.size());
+
+  Slot &slot = slots_[index];
+  if (slot.record != nullptr) {
+    size_t previous_size =
+        RecordSizeOf(KeySizeOf(slot.record), ValueSizeOf(slot.record));
+    // A record of the same class is rewritten in place
+    if (previous_size != size) {
+      Free(slot.record, previous_size);
+      slot.record = Allocate(size);
+    }
+    WriteRecord(slot.record, key, value);
+    return previous_size + sizeof(Slot);
+  }
+
+  slot.record = Allocate(size);
+  slot.hash = hash;
+  WriteRecord(slot.record, key, value);
+  ++size_;
+  if (size_ * kMaxLoadDenominator > slots_.size() * kMaxLoadNumerator) {
+    Grow();
+  }
+  return 0;
+}
+
+size_t ArenaShardStorage::Erase(const std::string &key) {
+  size_t index = Find(key, std::hash<std::string>()(key));
+  if (slots_[index].record == nullptr) {
+    return 0;
+  }
+
+  char *record = slots_[index].record;
+  size_t size = RecordSizeOf(KeySizeOf(record), ValueSizeOf(record));
+  Free(record, size);
+  slots_[index].record = nullptr;
+  --size_;
+
+  // Shift the records after the hole back so that no probe sequence has a
+  // gap, which is what lets linear probing go without tombstones
+  size_t mask = slots_.size() - 1;
+  size_t hole = index;
+  for (size_t next = (hole + 1) & mask; slots_[next].record != nullptr;
+       next = (next + 1) & mask) {
+    size_t home = SlotIndexOf(slots_[next].hash, slot_bits_);
+    // The record can fill the hole if its home is not in (hole, next]
+    if (((next - home) & mask) >= ((next - hole) & mask)) {
+      slots_[hole] = slots_[next];
+      slots_[next].record = nullptr;
+      hole = next;
+    }
+  }
+  return size + sizeof(Slot);
+}
+
+void ArenaShardStorage::ForEach(const Visitor &visitor) const {
+  for (const Slot &slot : slots_) {
+    if (slot.record != nullptr) {
+      visitor(KeyOf(slot.record), KeySizeOf(slot.record),
+              ValueOf(slot.record), ValueSizeOf(slot.record));
+    }
+  }
+}
+
+size_t ArenaShardStorage::BytesOf(size_t key_size, size_t value_size) const {
+  return RecordSizeOf(key_size, value_size) + sizeof(Slot);
+}
+
+size_t ArenaShardStorage::RecordSizeOf(size_t key_size, size_t value_size) {
+  size_t size = kRecordHeaderSize + key_size + value_size;
+  return (size + kSizeClassGranularity - 1) / kSizeClassGranularity *
+         kSizeClassGranularity;
+}
+
+size_t ArenaShardStorage::Find(const std::string &key, uint64_t hash) const {
+  size_t mask = slots_.size() - 1;
+  for (size_t index = SlotIndexOf(hash, slot_bits_);;
+       index = (index + 1) & mask) {
+    const Slot &slot = slots_[index];
+    if (slot.record == nullptr ||
+        (slot.hash == hash && KeySizeOf(slot.record) == key.size() &&
+         std::memcmp(KeyOf(slot.record), key.data(), key.size()) == 0)) {
+      return index;
+    }
+  }
+}
+
+char *ArenaShardStorage::Allocate(size_t size) {
+  if (size > kMaxSlabRecordSize) {
+    return new char[size];
+  }
+
+  char *&free_list = free_lists_[size / kSizeClassGranularity];
+  if (free_list != nullptr) {
+    char *record = free_list;
+    std::memcpy(&free_list, record, sizeof(free_list));
+    return record;
+  }
+
+  // The unused end of the last slab is given up if the record does not fit
+  if (slab_left_ < size) {
+    slabs_.emplace_back(new char[next_slab_size_]);
+    slab_next_ = slabs_.back().get();
+    slab_left_ = next_slab_size_;
+    if (next_slab_size_ < kMaxSlabSize) {
+      next_slab_size_ *= 2;
+    }
+  }
+  char *record = slab_next_;
+  slab_next_ += size;
+  slab_left_ -= size;
+  return record;
+}
+
+void ArenaShardStorage::Free(char *record, size_t size) {
+  if (size > kMaxSlabRecordSize) {
+    delete[] record;
+    return;
+  }
+
+  char *&free_list = free_lists_[size / kSizeClassGranularity];
+  std::memcpy(record, &free_list, sizeof(free_list));
+  free_list = record;
+}
+
+void ArenaShardStorage::Grow() {
+  std::vector<Slot> slots(slots_.size() * 2);
+  slots_.swap(slots);
+  ++slot_bits_;
+
+  size_t mask = slots_.size() - 1;
+  for (const Slot &slot : slots) {
+    if (slot.record == nullptr) {
+      continue;
+    }
+    size_t index = SlotIndexOf(slot.hash, slot_bits_);
+    while (slots_[index].record != nullptr) {
+      index = (index + 1) & mask;
+    }
+    slots_[index] = slot;
+  }
+}
+
+SwissShardStorage::SwissShardStorage()
+    : controls_(2 * kGroupSize, kEmptyControl),
+      slots_(kGroupSize),
+      capacity_(kGroupSize),
+      size_(0),
+      num_of_deleted_(0) {}
+
+SwissShardStorage::~SwissShardStorage() {
+  for (size_t i = 0; i < capacity_; ++i) {
+    if (controls_[i] >= 0 && slots_[i].key_size > kMaxInlineKeySize) {
+      delete[] KeyOf(slots_[i]);
+    }
+  }
+}
+
+bool SwissShardStorage::Get(const std::string &key,
+                            std::string *value) const {
+  size_t index = Find(key, MixHash(std::hash<std::string>()(key)));
+  if (index == capacity_) {
+    return false;
+  }
+
+  if (value != nullptr) {
+    *value = slots_[index].value;
+  }
+  return true;
+}
+
+size_t SwissShardStorage::Put(const std::string &key,
+                              const std::string &value) {
+  uint64_t hash = MixHash(std::hash<std::string>()(key));
+  size_t index = Find(key, hash);
+  if (index != capacity_) {
+    Slot &slot = slots_[index];
+    size_t previous = BytesOf(slot.key_size, slot.value.size());
+    slot.value = value;
+    return previous;
+  }
+
+  if ((size_ + num_of_deleted_ + 1) * kSwissMaxLoadDenominator >
+      capacity_ * kSwissMaxLoadNumerator) {
+    // The table only grows if it would still be more than half of the
+    // maximum load without its tombstones
+    bool grow = (size_ + 1) * 2 * kSwissMaxLoadDenominator >
+                capacity_ * kSwissMaxLoadNumerator;
+    Rehash(grow ? capacity_ * 2 : capacity_);
+  }
+
+  index = FindFreeSlot(hash);
+  if (controls_[index] == kDeletedControl) {
+    --num_of_deleted_;
+  }
+  Slot &slot = slots_[index];
+  slot.hash = hash;
+  slot.key_size = static_cast<uint32_t>(key.size());
+  if (key.size() <= kMaxInlineKeySize) {
+    std::memcpy(slot.key, key.data(), key.size());
+  } else {
+    char *long_key = new char[key.size()];
+    std::memcpy(long_key, key.data(), key.size());
+    std::memcpy(slot.key, &long_key, sizeof(long_key));
+  }
+  slot.value = value;
+  SetControl(index, ControlOf(hash));
+  ++size_;
+  return 0;
+}
+
+size_t SwissShardStorage::Erase(const std::string &key) {
+  size_t index = Find(key, MixHash(std::hash<std::string>()(key)));
+  if (index == capacity_) {
+    return 0;
+  }
+
+  Slot &slot = slots_[index];
+  size_t bytes = BytesOf(slot.key_size, slot.value.size());
+  if (slot.key_size > kMaxInlineKeySize) {
+    delete[] KeyOf(slot);
+  }
+  std::string().swap(slot.value);
+  // A probe for another key may have passed this slot, so it cannot be
+  // marked empty
+  SetControl(index, kDeletedControl);
+  --size_;
+  ++num_of_deleted_;
+  return bytes;
+}
+
+void SwissShardStorage::ForEach(const Visitor &visitor) const {
+  for (size_t i = 0; i < capacity_; ++i) {
+    if (controls_[i] >= 0) {
+      const Slot &slot = slots_[i];
+      visitor(KeyOf(slot), slot.key_size, slot.value.data(),
+              slot.value.size());
+    }
+  }
+}
+
+size_t SwissShardStorage::BytesOf(size_t key_size, size_t value_size) const {
+  size_t key_heap_size =
+      key_size > kMaxInlineKeySize ? MallocChunkSizeOf(key_size) : 0;
+  return sizeof(Slot) + 1 + key_heap_size + StringHeapSizeOf(value_size);
+}
+
+const char *SwissShardStorage::KeyOf(const Slot &slot) {
+  if (slot.key_size <= kMaxInlineKeySize) {
+    return slot.key;
+  }
+  const char *long_key;
+  std::memcpy(&long_key, slot.key, sizeof(long_key));
+  return long_key;
+}
+
+size_t SwissShardStorage::Find(const std::string &key, uint64_t hash) const {
+  int8_t control = ControlOf(hash);
+  size_t mask = capacity_ - 1;
+  size_t position = static_cast<size_t>(hash >> 7) & mask;
+  // Moving by 1, 2, 3... groups visits every group of a power-of-2 table
+  for (size_t step = kGroupSize;; step += kGroupSize) {
+    const int8_t *group = controls_.data() + position;
+    for (uint32_t matches = MatchControl(group, control); matches != 0;
+         matches &= matches - 1) {
+      size_t index = (position + __builtin_ctz(matches)) & mask;
+      const Slot &slot = slots_[index];
+      if (slot.hash == hash && slot.key_size == key.size() &&
+          std::memcmp(KeyOf(slot), key.data(), key.size()) == 0) {
+        return index;
+      }
+    }
+    // The key would have been put in this empty slot
+    if (MatchControl(group, kEmptyControl) != 0) {
+      return capacity_;
+    }
+    position = (position + step) & mask;
+  }
+}
+
+size_t SwissShardStorage::FindFreeSlot(uint64_t hash) const {
+  size_t mask = capacity_ - 1;
+  size_t position = static_cast<size_t>(hash >> 7) & mask;
+  for (size_t step = kGroupSize;; step += kGroupSize) {
+    uint32_t matches = MatchFree(controls_.data() + position);
+    if (matches != 0) {
+      return (position + __builtin_ctz(matches)) & mask;
+    }
+    position = (position + step) & mask;
+  }
+}
+
+void SwissShardStorage::SetControl(size_t index, int8_t control) {
+  controls_[index] = control;
+  if (index < kGroupSize) {
+    controls_[capacity_ + index] = control;
+  }
+}
+
+void SwissShardStorage::Rehash(size_t capacity) {
+  std::vector<int8_t> controls(capacity + kGroupSize, kEmptyControl);
+  std::vector<Slot> slots(capacity);
+  controls_.swap(controls);
+  slots_.swap(slots);
+  size_t previous_capacity = capacity_;
+  capacity_ = capacity;
+  num_of_deleted_ = 0;
+
+  // The keys are moved with their slots, long ones included
+  for (size_t i = 0; i < previous_capacity; ++i) {
+    if (controls[i] < 0) {
+      continue;
+    }
+    Slot &slot = slots[i];
+    size_t index = FindFreeSlot(slot.hash);
+    Slot &new_slot = slots_[index];
+    new_slot.hash = slot.hash;
+    new_slot.key_size = slot.key_size;
+    std::memcpy(new_slot.key, slot.key, sizeof(slot.key));
+    new_slot.value.swap(slot.value);
+    SetControl(index, ControlOf(slot.hash));
+  }
+}
@@ -0,0 +1,348 @@
+#ifndef CHIRP_SRC_BACKEND_SHARD_STORAGE_H_
+#define CHIRP_SRC_BACKEND_SHARD_STORAGE_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "backend_value_buffer.h"
+
+// The key-value pairs of one shard of `BackendDataStructure`
+// This is the interface of a storage engine. `BackendDataStructure` does the
+// sharding, the locking, the batching, the atomic operations, the logging and
+// the memory accounting on top of it, so an engine only stores the pairs of
+// one shard and is picked with `Options::mode` without touching the server.
+// Implementations are not thread-safe. The shard's lock is held around every
+// call, as a reader for the const methods and as a writer for the others,
+// unless a method says otherwise.
+class ShardStorage {
+ public:
+  // How the pairs are laid out in memory
+  enum Modes : int {
+    // Every pair is a node of a `std::unordered_map` holding the key and a
+    // `ValueBuffer`
+    HEAP = 0,
+    // Every pair is one record carved out of slabs, indexed by an
+    // open-addressing hash table
+    ARENA,
+    // Recent writes are kept in a sorted memtable and older pairs in sorted
+    // run files on disk, see `LsmShardStorage`
+    LSM,
+    // Every pair is a node of a `std::map` holding the key and a
+    // `ValueBuffer`, so ranges are scanned in order without walking the
+    // whole shard
+    ORDERED,
+    // Every pair is a slot of an open-addressing table probed a group of
+    // control bytes at a time, see `SwissShardStorage`
+    SWISS
+  };
+
+  // The memtable size of the LSM mode used by default
+  static const size_t kDefaultMemtableSize = 1 << 20;
+
+  // How the storage of every shard is created
+  struct Options {
+    // Not explicit, so a mode alone can be given where options are expected
+    Options(Modes mode = HEAP)
+        : mode(mode), directory(), memtable_size(kDefaultMemtableSize) {}
+
+    Modes mode;
+    // Where the LSM mode keeps its files
+    std::string directory;
+    // The LSM mode flushes a memtable to disk once it holds this many bytes
+    size_t memtable_size;
+  };
+
+  // Called with every pair by `ForEach()`
+  // The pointers are only valid during the call.
+  typedef std::function<void(const char *key, size_t key_size,
+                             const char *value, size_t value_size)>
+      Visitor;
+
+  virtual ~ShardStorage() {}
+
+  // returns a new storage of the shard `index` as given by `options`
+  // Nothing is read from disk until `Open()` is called.
+  static std::unique_ptr<ShardStorage> Create(const Options &options,
+                                              size_t index);
+
+  // Parses "heap", "arena", "lsm", "ordered" or "swiss"
+  // returns true if this operation succeeds
+  // returns false if `name` is not a storage mode
+  static bool ParseMode(const std::string &name, Modes *mode);
+
+  // returns the name `ParseMode()` takes for `mode`
+  static const char *ModeName(Modes mode);
+
+  // returns the size of the chunk glibc malloc hands out for `size` bytes,
+  // including its header
+  static size_t MallocChunkSizeOf(size_t size);
+
+  // returns the heap memory a `std::string` of `size` bytes holds
+  static size_t StringHeapSizeOf(size_t size);
+
+  // Looks up `key` and copies its value to `value` if it is not nullptr
+  // returns true if `key` is found
+  // returns false otherwise
+  virtual bool Get(const std::string &key, std::string *value) const = 0;
+
+  // Sets `key` to `value`
+  // returns the number of bytes the previous pair of `key` took, or 0 if
+  // `key` is new
+  virtual size_t Put(const std::string &key, const std::string &value) = 0;
+
+  // Looks up `key` and shares its value through `value`
+  // A storage that keeps its values as `ValueBuffer`s hands out a reference
+  // to the value it holds; the others copy the value to a new buffer.
+  // returns true if `key` is found
+  // returns false otherwise
+  virtual bool GetShared(const std::string &key, ValueBuffer *value) const;
+
+  // Sets `key` to `value` like `Put()`
+  // A storage that keeps its values as `ValueBuffer`s keeps a reference to
+  // `value`; the others copy it.
+  virtual size_t PutShared(const std::string &key, const ValueBuffer &value) {
+    return Put(key, value.str());
+  }
+
+  // Removes `key`
+  // returns the number of bytes the pair took, or 0 if `key` is not found
+  virtual size_t Erase(const std::string &key) = 0;
+
+  // Calls `visitor` with every pair, in no particular order
+  virtual void ForEach(const Visitor &visitor) const = 0;
+
+  // Calls `visitor` with the pairs whose keys are in [`start`, `end`)
+  // An empty `end` means there is no upper bound. If `is_ordered()`, the
+  // pairs are visited in ascending key order and at most `limit` of them
+  // are, 0 meaning no limit. Otherwise every pair in the range is visited in
+  // no particular order, which by default walks the whole shard.
+  virtual void Scan(const std::string &start, const std::string &end,
+                    size_t limit, const Visitor &visitor) const;
+
+  // returns true if `Scan()` visits the pairs in ascending key order
+  virtual bool is_ordered() const { return false; }
+
+  // returns the number of pairs
+  virtual size_t size() const = 0;
+
+  // returns the number of bytes a pair of these sizes takes
+  // This is what `Put()` and `Erase()` report, so the sum over the pairs is
+  // the memory held for them.
+  virtual size_t BytesOf(size_t key_size, size_t value_size) const = 0;
+
+  // Loads the pairs kept on disk, if this storage keeps any
+  // This is called once before the storage is used.
+  // returns true if this operation succeeds
+  // returns false otherwise
+  virtual bool Open() { return true; }
+
+  // returns true if the pairs outlive the process once they are flushed, so
+  // the write-ahead log can be truncated without writing a snapshot
+  virtual bool is_persistent() const { return false; }
+
+  // Starts flushing every pair put so far to disk
+  virtual void SealMemtable() {}
+
+  // Waits until every pair sealed by `SealMemtable()` is durable
+  // The shard's lock does not need to be held.
+  // returns true if this operation succeeds
+  // returns false otherwise
+  virtual bool WaitForFlushes() { return true; }
+};
+
+// The pairs are kept in a `std::unordered_map`
+// Values are `ValueBuffer`s, so a get can share a value instead of copying
+// it, and a put of a buffer keeps it as it is.
+// `BytesOf()` is an estimate based on the node layout of libstdc++ and the
+// chunk sizes of glibc malloc.
+class HeapShardStorage final : public ShardStorage {
+ public:
+  bool Get(const std::string &key, std::string *value) const override;
+  size_t Put(const std::string &key, const std::string &value) override;
+  bool GetShared(const std::string &key, ValueBuffer *value) const override;
+  size_t PutShared(const std::string &key, const ValueBuffer &value) override;
+  size_t Erase(const std::string &key) override;
+  void ForEach(const Visitor &visitor) const override;
+  inline size_t size() const override { return key_value_map_.size(); }
+  size_t BytesOf(size_t key_size, size_t value_size) const override;
+
+ private:
+  std::unordered_map<std::string, ValueBuffer> key_value_map_;
+};
+
+// The pairs are kept in a `std::map`
+// Lookups take O(log n) key comparisons instead of one hash, in exchange for
+// scans that only touch the keys in their range.
+// Values are `ValueBuffer`s the same way as `HeapShardStorage`, and
+// `BytesOf()` is an estimate the same way.
+class OrderedShardStorage final : public ShardStorage {
+ public:
+  bool Get(const std::string &key, std::string *value) const override;
+  size_t Put(const std::string &key, const std::string &value) override;
+  bool GetShared(const std::string &key, ValueBuffer *value) const override;
+  size_t PutShared(const std::string &key, const ValueBuffer &value) override;
+  size_t Erase(const std::string &key) override;
+  void ForEach(const Visitor &visitor) const override;
+  void Scan(const std::string &start, const std::string &end, size_t limit,
+            const Visitor &visitor) const override;
+  inline size_t size() const override { return key_value_map_.size(); }
+  size_t BytesOf(size_t key_size, size_t value_size) const override;
+  inline bool is_ordered() const override { return true; }
+
+ private:
+  std::map<std::string, ValueBuffer> key_value_map_;
+};
+
+// The pairs are records carved out of slabs owned by the shard
+// A record is the key size and the value size as 32-bit integers followed by
+// the key and the value. Records are rounded up to a size class. Freed
+// records go to the free list of their class and are reused by records of
+// the same class, so there is no per-record malloc header and no
+// fragmentation across classes. Records too large for a class get their own
+// allocation.
+// The index is an open-addressing table with linear probing, holding a
+// pointer to the record and the hash of its key.
+// `BytesOf()` is exact: the size class of the record plus one index slot.
+class ArenaShardStorage final : public ShardStorage {
+ public:
+  // Records are rounded up to a multiple of this
+  static const size_t kSizeClassGranularity = 16;
+  // Records larger than this are allocated on their own
+  static const size_t kMaxSlabRecordSize = 2048;
+  // The first slab of a shard is this large, and every next slab is twice
+  // as large as the previous one, up to `kMaxSlabSize`
+  static const size_t kMinSlabSize = 1 << 10;
+  static const size_t kMaxSlabSize = 64 << 10;
+
+  ArenaShardStorage();
+  ~ArenaShardStorage();
+
+  ArenaShardStorage(const ArenaShardStorage &) = delete;
+  ArenaShardStorage &operator=(const ArenaShardStorage &) = delete;
+
+  bool Get(const std::string &key, std::string *value) const override;
+  size_t Put(const std::string &key, const std::string &value) override;
+  size_t Erase(const std::string &key) override;
+  void ForEach(const Visitor &visitor) const override;
+  inline size_t size() const override { return size_; }
+  size_t BytesOf(size_t key_size, size_t value_size) const override;
+
+ private:
+  // One entry of the index. `record` is nullptr if the slot is empty.
+  struct Slot {
+    char *record;
+    uint64_t hash;
+  };
+
+  // returns the number of bytes of a record holding a pair of these sizes,
+  // rounded up to its size class
+  static size_t RecordSizeOf(size_t key_size, size_t value_size);
+
+  // returns the index of the slot `key` is in, or of the empty slot it
+  // would go to
+  size_t Find(const std::string &key, uint64_t hash) const;
+
+  // returns a new record of `size` bytes, already rounded up
+  char *Allocate(size_t size);
+
+  // Gives the record of `size` bytes back to its free list
+  void Free(char *record, size_t size);
+
+  // Doubles the number of slots and moves every record
+  void Grow();
+
+  std::vector<Slot> slots_;
+  // The number of bits of a hash used as a slot index
+  int slot_bits_;
+  size_t size_;
+
+  // The slabs, the unused end of the last one, and the size of the next one
+  std::vector<std::unique_ptr<char[]>> slabs_;
+  char *slab_next_;
+  size_t slab_left_;
+  size_t next_slab_size_;
+
+  // The first free record of every size class
+  // A free record holds a pointer to the next one.
+  std::vector<char *> free_lists_;
+};
+
+// The pairs are slots of an open-addressing table in the style of a Swiss
+// table
+// Next to the slots is one control byte per slot: empty, deleted, or the low 7
+// bits of the hash of a full slot's key. A lookup loads `kGroupSize` control
+// bytes at once and compares all of them to the 7 bits of its key with SSE2,
+// so most probes touch one group of control bytes and then only the slots
+// whose bits match, instead of following a pointer and comparing keys at
+// every step. A slot caches the full hash, which is compared before the key,
+// and keeps keys of up to `kMaxInlineKeySize` bytes in the slot itself. The
+// value is a `std::string` in the slot.
+// Erased slots are marked deleted, and the table is rebuilt in place of its
+// tombstones or at twice the size once it is 7/8 full.
+// `BytesOf()` is an estimate the same way as `HeapShardStorage`, counting one
+// slot and one control byte per pair.
+class SwissShardStorage final : public ShardStorage {
+ public:
+  // The number of control bytes compared at once
+  static const size_t kGroupSize = 16;
+  // Keys this large or smaller are kept in their slots
+  static const size_t kMaxInlineKeySize = 20;
+
+  SwissShardStorage();
+  ~SwissShardStorage();
+
+  SwissShardStorage(const SwissShardStorage &) = delete;
+  SwissShardStorage &operator=(const SwissShardStorage &) = delete;
+
+  bool Get(const std::string &key, std::string *value) const override;
+  size_t Put(const std::string &key, const std::string &value) override;
+  size_t Erase(const std::string &key) override;
+  void ForEach(const Visitor &visitor) const override;
+  inline size_t size() const override { return size_; }
+  size_t BytesOf(size_t key_size, size_t value_size) const override;
+
+ private:
+  // One entry of the table, 64 bytes with libstdc++
+  // A key longer than `kMaxInlineKeySize` is a `new char[]` whose pointer is
+  // kept at the start of `key`.
+  struct Slot {
+    uint64_t hash;
+    uint32_t key_size;
+    char key[kMaxInlineKeySize];
+    std::string value;
+  };
+
+  // returns the key bytes of the full `slot`
+  static const char *KeyOf(const Slot &slot);
+
+  // returns the index of the slot holding `key`, or `capacity_` if `key` is
+  // not found
+  size_t Find(const std::string &key, uint64_t hash) const;
+
+  // returns the index of the first empty or deleted slot of the probe
+  // sequence of `hash`
+  size_t FindFreeSlot(uint64_t hash) const;
+
+  // Sets the control byte of the slot `index`, and its copy after the end
+  void SetControl(size_t index, int8_t control);
+
+  // Moves every pair to a table of `capacity` slots, dropping tombstones
+  void Rehash(size_t capacity);
+
+  // `capacity_` control bytes followed by a copy of the first `kGroupSize`
+  // of them, so a group can be loaded at any slot without wrapping around
+  std::vector<int8_t> controls_;
+  std::vector<Slot> slots_;
+  // The number of slots, a power of 2 no smaller than `kGroupSize`
+  size_t capacity_;
+  size_t size_;
+  size_t num_of_deleted_;
+};
+
+#endif /* CHIRP_SRC_BACKEND_SHARD_STORAGE_H_ */
@@ -0,0 +1,201 @@
+#include "backend_snapshot.h"
+
+#include <errno.h>
+#include <fcntl.h>
+#include <libgen.h>
+#include <stdio.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <algorithm>
+#include <cstring>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace {
+const char kMagic[8] = {'C', 'H', 'I', 'R', 'P', 'S', 'N', 'P'};
+const size_t kHeaderSize = sizeof(kMagic) + 3 * sizeof(uint64_t);
+const size_t kEntryHeaderSize = 2 * sizeof(uint32_t);
+
+template <typename T>
+inline void AppendFixed(std::string *output, const T &input) {
+  output->append(reinterpret_cast<const char *>(&input), sizeof(T));
+}
+
+template <typename T>
+inline T ReadFixed(const char *input) {
+  T ret;
+  std::memcpy(&ret, input, sizeof(T));
+  return ret;
+}
+
+// Writes all of `data` to `fd` starting at `offset`
+// returns true if this operation succeeds
+// returns false otherwise
+bool WriteAllAt(int fd, const std::string &data, uint64_t offset) {
+  size_t written = 0;
+  while (written < data.size()) {
+    ssize_t ret = pwrite(fd, data.data() + written, data.size() - written,
+                         offset + written);
+    if (ret < 0) {
+      if (errno == EINTR) {
+        continue;
+      }
+      return false;
+    }
+    written += ret;
+  }
+  return true;
+}
+
+// fsyncs the directory containing `path` so that a rename in it is durable
+bool SyncParentDirectory(const std::string &path) {
+  std::vector<char> copy(path.begin(), path.end());
+  copy.push_back('\0');
+  int fd = open(dirname(copy.data()), O_RDONLY);
+  if (fd < 0) {
+    return false;
+  }
+  bool ok = fsync(fd) == 0;
+  close(fd);
+  return ok;
+}
+}  // Anonymous namespace
+
+bool BackendSnapshot::Write(const std::string &path, uint64_t lsn,
+                            BackendDataStructure *data) {
+  std::string temporary_path = path + ".tmp";
+  int fd = open(temporary_path.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+  if (fd < 0) {
+    return false;
+  }
+
+  // The header is written last, when the index offset is known
+  uint64_t offset = kHeaderSize;
+  std::vector<uint64_t> index;
+  bool ok = true;
+
+  for (size_t i = 0; ok && i < data->get_num_of_shards(); ++i) {
+    std::vector<std::pair<std::string, std::string>> pairs;
+    data->CopyShard(i, &pairs);
+
+    std::string buffer;
+    for (const auto &pair : pairs) {
+      index.push_back(offset + buffer.size());
+      AppendFixed<uint32_t>(&buffer, pair.first.size());
+      AppendFixed<uint32_t>(&buffer, pair.second.size());
+      buffer.append(pair.first);
+      buffer.append(pair.second);
+    }
+    ok = WriteAllAt(fd, buffer, offset);
+    offset += buffer.size();
+  }
+
+  if (ok) {
+    std::string buffer;
+    for (uint64_t entry_offset : index) {
+      AppendFixed<uint64_t>(&buffer, entry_offset);
+    }
+    ok = WriteAllAt(fd, buffer, offset);
+  }
+
+  if (ok) {
+    std::string header(kMagic, sizeof(kMagic));
+    AppendFixed<uint64_t>(&header, lsn);
+    AppendFixed<uint64_t>(&header, index.size());
+    AppendFixed<uint64_t>(&header, offset);
+    ok = WriteAllAt(fd, header, 0) && fsync(fd) == 0;
+  }
+  close(fd);
+
+  ok = ok && rename(temporary_path.c_str(), path.c_str()) == 0 &&
+       SyncParentDirectory(path);
+  if (!ok) {
+    unlink(temporary_path.c_str());
+  }
+  return ok;
+}
+
+bool BackendSnapshot::Load(const std::string &path, size_t num_of_threads,
+                           BackendDataStructure *data, uint64_t *lsn) {
+  *lsn = 0;
+
+  int fd = open(path.c_str(), O_RDONLY);
+  if (fd < 0) {
+    // No snapshot has been taken yet
+    return errno == ENOENT;
+  }
+
+  struct stat file_stat;
+  if (fstat(fd, &file_stat) != 0 ||
+      static_cast<size_t>(file_stat.st_size) < kHeaderSize) {
+    close(fd);
+    return false;
+  }
+  size_t file_size = file_stat.st_size;
+
+  void *mapped = mmap(nullptr, file_size, PROT_READ, MAP_PRIVATE, fd, 0);
+  close(fd);
+  if (mapped == MAP_FAILED) {
+    return false;
+  }
+  const char *base = static_cast<const char *>(mapped);
+
+  uint64_t snapshot_lsn = ReadFixed<uint64_t>(base + sizeof(kMagic));
+  uint64_t num_of_entries =
+      ReadFixed<uint64_t>(base + sizeof(kMagic) + sizeof(uint64_t));
+  uint64_t index_offset =
+      ReadFixed<uint64_t>(base + sizeof(kMagic) + 2 * sizeof(uint64_t));
+  if (std::memcmp(base, kMagic, sizeof(kMagic)) != 0 ||
+      index_offset > file_size ||
+      num_of_entries > (file_size - index_offset) / sizeof(uint64_t)) {
+    munmap(mapped, file_size);
+    return false;
+  }
+  const char *index = base + index_offset;
+
+  // Every thread loads a contiguous range of the index
+  if (num_of_threads == 0) {
+    num_of_threads = 1;
+  }
+  size_t per_thread = (num_of_entries + num_of_threads - 1) / num_of_threads;
+  std::vector<char> thread_ok(num_of_threads, true);
+  std::vector<std::thread> threads;
+  for (size_t t = 0; t < num_of_threads; ++t) {
+    threads.emplace_back([&, t]() {
+      size_t begin = std::min<size_t>(num_of_entries, t * per_thread);
+      size_t end = std::min<size_t>(num_of_entries, begin + per_thread);
+      for (size_t i = begin; i < end; ++i) {
+        uint64_t offset = ReadFixed<uint64_t>(index + i * sizeof(uint64_t));
+        if (offset < kHeaderSize || offset + kEntryHeaderSize > index_offset) {
+          thread_ok[t] = false;
+          return;
+        }
+        uint32_t key_length = ReadFixed<uint32_t>(base + offset);
+        uint32_t value_length =
+            ReadFixed<uint32_t>(base + offset + sizeof(uint32_t));
+        const char *key = base + offset + kEntryHeaderSize;
+        if (offset + kEntryHeaderSize + key_length + value_length >
+            index_offset) {
+          thread_ok[t] = false;
+          return;
+        }
+        data->Restore(std::string(key, key_length),
+                      std::string(key + key_length, value_length));
+      }
+    });
+  }
+  for (auto &thread : threads) {
+    thread.join();
+  }
+  munmap(mapped, file_size);
+
+  for (char ok : thread_ok) {
+    if (!ok) {
+      return false;
+    }
+  }
+  *lsn = snapshot_lsn;
+  return true;
+}
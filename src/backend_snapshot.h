@@ -0,0 +1,39 @@
+#ifndef CHIRP_SRC_BACKEND_SNAPSHOT_H_
+#define CHIRP_SRC_BACKEND_SNAPSHOT_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+#include "backend_data_structure.h"
+
+// Point-in-time snapshot files of the backend data structure.
+// A snapshot is taken as of a write-ahead log LSN: it holds every operation up
+// to that LSN and possibly some later ones, so replaying the log records after
+// that LSN on top of it gives back the latest state.
+//
+// The file is laid out so that it can be memory-mapped and split between
+// threads without parsing it from the front:
+//   header:  char[8] magic, u64 lsn, u64 number of entries, u64 index offset
+//   entries: u32 key length, u32 value length, key bytes, value bytes
+//   index:   u64 file offset of every entry
+class BackendSnapshot {
+ public:
+  // Writes a snapshot of `data` as of `lsn` to `path`
+  // Shards are copied one at a time, so writers are only held back on the
+  // shard being copied. The file is written under a temporary name and
+  // renamed into place once it is complete and fsynced.
+  // returns true if this operation succeeds
+  // returns false otherwise
+  static bool Write(const std::string &path, uint64_t lsn,
+                    BackendDataStructure *data);
+
+  // Loads the snapshot at `path` into `data` using `num_of_threads` threads
+  // The LSN of the snapshot is stored in `lsn`, or 0 if there is no snapshot.
+  // returns true if the snapshot is loaded or does not exist
+  // returns false otherwise
+  static bool Load(const std::string &path, size_t num_of_threads,
+                   BackendDataStructure *data, uint64_t *lsn);
+};
+
+#endif /* CHIRP_SRC_BACKEND_SNAPSHOT_H_ */
@@ -0,0 +1,48 @@
+#ifndef CHIRP_SRC_BACKEND_VALUE_BUFFER_H_
+#define CHIRP_SRC_BACKEND_VALUE_BUFFER_H_
+
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <utility>
+
+// A value whose bytes are shared by reference
+// The bytes never change once the buffer is made, so a storage can hand the
+// same buffer to any number of readers, and a reply can point at it while it
+// is sent, without copying the value. The bytes are freed once the last
+// reference is dropped, even if the key is overwritten or deleted before.
+class ValueBuffer {
+ public:
+  // Constructor of an empty value
+  ValueBuffer() : value_() {}
+
+  // Constructor that takes the bytes of `value` without copying them
+  explicit ValueBuffer(std::string &&value)
+      : value_(std::make_shared<const std::string>(std::move(value))) {}
+
+  // Constructor that copies `value`
+  explicit ValueBuffer(const std::string &value)
+      : value_(std::make_shared<const std::string>(value)) {}
+
+  // returns the value, which stays valid as long as this buffer
+  inline const std::string &str() const {
+    return value_ != nullptr ? *value_ : Empty();
+  }
+
+  inline const char *data() const { return str().data(); }
+
+  inline size_t size() const { return str().size(); }
+
+  // returns a reference that keeps the bytes alive on its own
+  inline std::shared_ptr<const std::string> share() const { return value_; }
+
+ private:
+  static const std::string &Empty() {
+    static const std::string empty;
+    return empty;
+  }
+
+  std::shared_ptr<const std::string> value_;
+};
+
+#endif /* CHIRP_SRC_BACKEND_VALUE_BUFFER_H_ */
@@ -0,0 +1,125 @@
+#include "backend_watch_table.h"
+
+#include <algorithm>
+
+const size_t WatchTable::kDefaultCapacity;
+
+WatchTable::Watcher::Watcher(size_t capacity, bool with_values,
+                             const std::function<void()> &on_event)
+    : capacity_(std::max<size_t>(capacity, 1)),
+      with_values_(with_values),
+      on_event_(on_event),
+      events_(),
+      dropped_(false) {}
+
+bool WatchTable::Watcher::Take(std::chrono::milliseconds timeout,
+                               std::vector<Event> *events) {
+  std::unique_lock<std::mutex> lock(mutex_);
+  if (events_.empty() && !dropped_) {
+    pushed_cv_.wait_for(lock, timeout,
+                        [this]() { return !events_.empty() || dropped_; });
+  }
+  for (auto &event : events_) {
+    events->push_back(std::move(event));
+  }
+  events_.clear();
+  bool complete = !dropped_;
+  dropped_ = false;
+  return complete;
+}
+
+void WatchTable::Watcher::Push(const std::string &key,
+                               const std::string &value, bool deleted) {
+  {
+    std::lock_guard<std::mutex> guard(mutex_);
+    if (events_.size() >= capacity_) {
+      events_.pop_front();
+      dropped_ = true;
+    }
+    events_.push_back(Event{key, deleted, with_values_ ? value : ""});
+  }
+  pushed_cv_.notify_all();
+  if (on_event_) {
+    on_event_();
+  }
+}
+
+WatchTable::WatchTable() : root_(), prefixes_(), num_of_watchers_(0) {}
+
+void WatchTable::Add(const std::vector<std::string> &prefixes,
+                     Watcher *watcher) {
+  // Sorted, a prefix comes right after the kept prefix it starts with
+  std::vector<std::string> sorted(prefixes);
+  std::sort(sorted.begin(), sorted.end());
+  std::vector<std::string> kept;
+  for (const auto &prefix : sorted) {
+    if (kept.empty() ||
+        prefix.compare(0, kept.back().size(), kept.back()) != 0) {
+      kept.push_back(prefix);
+    }
+  }
+
+  WriterLockGuard guard(&lock_);
+  for (const auto &prefix : kept) {
+    Node *node = &root_;
+    for (char c : prefix) {
+      auto &child = node->children[c];
+      if (child == nullptr) {
+        child.reset(new Node());
+      }
+      node = child.get();
+    }
+    node->watchers.push_back(watcher);
+  }
+  prefixes_[watcher] = kept;
+  ++num_of_watchers_;
+}
+
+void WatchTable::Remove(Watcher *watcher) {
+  WriterLockGuard guard(&lock_);
+  auto it = prefixes_.find(watcher);
+  if (it == prefixes_.end()) {
+    return;
+  }
+
+  for (const auto &prefix : it->second) {
+    // The nodes down the prefix, to prune the ones left empty
+    std::vector<Node *> path(1, &root_);
+    for (char c : prefix) {
+      path.push_back(path.back()->children[c].get());
+    }
+    auto &watchers = path.back()->watchers;
+    watchers.erase(std::find(watchers.begin(), watchers.end(), watcher));
+    for (size_t i = prefix.size(); i > 0; --i) {
+      if (!path[i]->watchers.empty() || !path[i]->children.empty()) {
+        break;
+      }
+      path[i - 1]->children.erase(prefix[i - 1]);
+    }
+  }
+  prefixes_.erase(it);
+  --num_of_watchers_;
+}
+
+void WatchTable::Notify(const std::string &key, const std::string &value,
+                        bool deleted) {
+  if (num_of_watchers_ == 0) {
+    return;
+  }
+
+  ReaderLockGuard guard(&lock_);
+  const Node *node = &root_;
+  for (size_t i = 0;; ++i) {
+    for (Watcher *watcher : node->watchers) {
+      watcher->Push(key, value, deleted);
+    }
+    if (i == key.size()) {
+      break;
+    }
+    auto it = node->children.find(key[i]);
+    if (it == node->children.end()) {
+      break;
+    }
+    node = it->second.get();
+  }
+}
@@ -0,0 +1,109 @@
+#ifndef CHIRP_SRC_BACKEND_WATCH_TABLE_H_
+#define CHIRP_SRC_BACKEND_WATCH_TABLE_H_
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "read_write_lock.h"
+
+// The watchers of key prefixes, and the writes they are told about
+// The prefixes are kept in a trie, so a write walks down the path of its key
+// and only reaches the watchers of the prefixes of that key. A write is
+// pushed while the shard of its key is locked, so every watcher sees the
+// writes of a key in the order they are applied.
+class WatchTable {
+ public:
+  // A write seen by a watcher
+  struct Event {
+    std::string key;
+    bool deleted;
+    // Empty for a delete, or if the watcher does not take values
+    std::string value;
+  };
+
+  // The events a watcher keeps for its reader by default
+  static const size_t kDefaultCapacity = 4096;
+
+  // A watcher of some prefixes and the events not taken yet
+  class Watcher {
+   public:
+    // Constructor that takes the number of events kept, whether the events
+    // carry values, and a function called after every event, which may be
+    // empty
+    // `on_event` is called while the table is locked, so it should only wake
+    // the reader up.
+    Watcher(size_t capacity, bool with_values,
+            const std::function<void()> &on_event);
+
+    Watcher(const Watcher &) = delete;
+    Watcher &operator=(const Watcher &) = delete;
+
+    // Moves the events pushed so far to `events`, waiting up to `timeout`
+    // for one
+    // returns true if this operation succeeds
+    // returns false if some events were dropped since the last take, since
+    // the reader was too slow; the other events are still moved
+    bool Take(std::chrono::milliseconds timeout, std::vector<Event> *events);
+
+   private:
+    friend class WatchTable;
+
+    void Push(const std::string &key, const std::string &value,
+              bool deleted);
+
+    const size_t capacity_;
+    const bool with_values_;
+    const std::function<void()> on_event_;
+
+    // Guards every member below
+    std::mutex mutex_;
+    std::deque<Event> events_;
+    bool dropped_;
+    std::condition_variable pushed_cv_;
+  };
+
+  WatchTable();
+
+  WatchTable(const WatchTable &) = delete;
+  WatchTable &operator=(const WatchTable &) = delete;
+
+  // Tells `watcher` about every write of a key starting with any of
+  // `prefixes` from now on
+  // A prefix that starts with another one of the list is left out, so a
+  // write reaches a watcher once.
+  void Add(const std::vector<std::string> &prefixes, Watcher *watcher);
+
+  // Stops telling `watcher` about writes
+  // It is not pushed anything, nor its `on_event` called, once this returns.
+  void Remove(Watcher *watcher);
+
+  // Tells the watchers of the prefixes of `key` that it is written
+  void Notify(const std::string &key, const std::string &value, bool deleted);
+
+  inline size_t get_num_of_watchers() const { return num_of_watchers_; }
+
+ private:
+  struct Node {
+    std::map<char, std::unique_ptr<Node>> children;
+    std::vector<Watcher *> watchers;
+  };
+
+  // Readers push events, writers add and remove watchers
+  ReadWriteLock lock_;
+  Node root_;
+  // The prefixes of every watcher, to remove it from the trie
+  std::map<Watcher *, std::vector<std::string>> prefixes_;
+  // Lets writes skip the lock while nobody watches
+  std::atomic<size_t> num_of_watchers_;
+};
+
+#endif /* CHIRP_SRC_BACKEND_WATCH_TABLE_H_ */
@@ -0,0 +1,442 @@
+#include "backend_write_ahead_log.h"
+
+#include <errno.h>
+#include <stdio.h>
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <utility>
+
+#include "backend_replication_log.h"
+
+const char WriteAheadLog::kBatchContinues;
+
+namespace {
+// Layout of a record:
+//   u32 crc32 of everything after this field
+//   u32 length of the record without the checksum, including this field
+//   u64 lsn
+//   u8  operation
+//   u32 key length
+//   key bytes
+//   value bytes (the rest of the record)
+const size_t kCrcSize = sizeof(uint32_t);
+const size_t kLengthSize = sizeof(uint32_t);
+const size_t kHeaderSize = kCrcSize + kLengthSize;
+const size_t kFixedBodySize = sizeof(uint64_t) + 1 + sizeof(uint32_t);
+
+// How often the records are written to the file in NONE mode
+const std::chrono::milliseconds kNoneFlushInterval(10);
+
+// Lookup table of `Crc32()`
+struct Crc32Table {
+  Crc32Table() {
+    for (uint32_t i = 0; i < 256; ++i) {
+      uint32_t c = i;
+      for (int k = 0; k < 8; ++k) {
+        c = (c & 1) ? 0xEDB88320u ^ (c >> 1) : c >> 1;
+      }
+      entries[i] = c;
+    }
+  }
+
+  uint32_t entries[256];
+};
+
+// returns the CRC-32 (IEEE 802.3) of `length` bytes starting at `data`
+uint32_t Crc32(const char *data, size_t length) {
+  // Function-local statics are initialized once even with multiple threads
+  static const Crc32Table table;
+
+  uint32_t crc = 0xFFFFFFFFu;
+  for (size_t i = 0; i < length; ++i) {
+    crc = table.entries[(crc ^ static_cast<uint8_t>(data[i])) & 0xFF] ^
+          (crc >> 8);
+  }
+  return crc ^ 0xFFFFFFFFu;
+}
+
+template <typename T>
+inline void AppendFixed(std::string *output, const T &input) {
+  output->append(reinterpret_cast<const char *>(&input), sizeof(T));
+}
+
+template <typename T>
+inline T ReadFixed(const char *input) {
+  T ret;
+  std::memcpy(&ret, input, sizeof(T));
+  return ret;
+}
+
+// Writes all of `data` to `fd`
+// returns true if this operation succeeds
+// returns false otherwise
+bool WriteAll(int fd, const std::string &data) {
+  size_t written = 0;
+  while (written < data.size()) {
+    ssize_t ret = write(fd, data.data() + written, data.size() - written);
+    if (ret < 0) {
+      if (errno == EINTR) {
+        continue;
+      }
+      return false;
+    }
+    written += ret;
+  }
+  return true;
+}
+
+// Decodes the record starting at `data` whose total size is `size`
+// returns true if the checksum matches
+// returns false otherwise
+bool DecodeRecord(const char *data, size_t size,
+                  WriteAheadLog::Record *record) {
+  uint32_t crc = ReadFixed<uint32_t>(data);
+  const char *body = data + kCrcSize;
+  size_t body_size = size - kCrcSize;
+  if (Crc32(body, body_size) != crc) {
+    return false;
+  }
+
+  const char *cursor = body + kLengthSize;
+  record->lsn = ReadFixed<uint64_t>(cursor);
+  cursor += sizeof(uint64_t);
+  record->operation = static_cast<WriteAheadLog::Operations>(*cursor);
+  cursor += 1;
+  uint32_t key_length = ReadFixed<uint32_t>(cursor);
+  cursor += sizeof(uint32_t);
+
+  const char *end = data + size;
+  if (key_length > static_cast<size_t>(end - cursor)) {
+    return false;
+  }
+  record->key.assign(cursor, key_length);
+  cursor += key_length;
+  record->value.assign(cursor, end - cursor);
+  return true;
+}
+}  // Anonymous namespace
+
+WriteAheadLog::WriteAheadLog(const std::string &path, DurabilityModes mode)
+    : path_(path),
+      mode_(mode),
+      fd_(-1),
+      buffer_(),
+      last_lsn_(0),
+      durable_lsn_(0),
+      failed_(false),
+      stopping_(false),
+      replication_log_(nullptr) {}
+
+WriteAheadLog::~WriteAheadLog() {
+  {
+    std::lock_guard<std::mutex> guard(mutex_);
+    stopping_ = true;
+  }
+  pending_cv_.notify_all();
+  if (commit_thread_.joinable()) {
+    commit_thread_.join();
+  }
+
+  if (fd_ >= 0) {
+    FlushBuffer(true);
+    close(fd_);
+  }
+}
+
+bool WriteAheadLog::ReadRecords(const std::string &path,
+                                size_t num_of_threads,
+                                std::vector<Record> *records,
+                                uint64_t *valid_length) {
+  *valid_length = 0;
+
+  int fd = open(path.c_str(), O_RDONLY);
+  if (fd < 0) {
+    // A log that has never been written is empty
+    return errno == ENOENT;
+  }
+
+  std::string content;
+  char chunk[1 << 16];
+  ssize_t ret;
+  while ((ret = read(fd, chunk, sizeof(chunk))) != 0) {
+    if (ret < 0) {
+      if (errno == EINTR) {
+        continue;
+      }
+      close(fd);
+      return false;
+    }
+    content.append(chunk, ret);
+  }
+  close(fd);
+
+  // Find the boundaries of the records. This only jumps over the length
+  // fields, so it is cheap to do on one thread.
+  std::vector<std::pair<size_t, size_t>> boundaries;
+  size_t offset = 0;
+  while (content.size() - offset >= kHeaderSize) {
+    uint32_t body_size = ReadFixed<uint32_t>(content.data() + offset +
+                                             kCrcSize);
+    size_t record_size = kCrcSize + body_size;
+    if (body_size < kLengthSize + kFixedBodySize ||
+        record_size > content.size() - offset) {
+      // Torn tail
+      break;
+    }
+    boundaries.emplace_back(offset, record_size);
+    offset += record_size;
+  }
+
+  // Decode and verify the records in parallel
+  if (num_of_threads == 0) {
+    num_of_threads = 1;
+  }
+  std::vector<Record> decoded(boundaries.size());
+  std::vector<size_t> first_bad(num_of_threads, boundaries.size());
+  size_t per_thread = (boundaries.size() + num_of_threads - 1) / num_of_threads;
+  std::vector<std::thread> threads;
+  for (size_t t = 0; t < num_of_threads; ++t) {
+    threads.emplace_back([&, t]() {
+      size_t begin = std::min(boundaries.size(), t * per_thread);
+      size_t end = std::min(boundaries.size(), begin + per_thread);
+      for (size_t i = begin; i < end; ++i) {
+        if (!DecodeRecord(content.data() + boundaries[i].first,
+                          boundaries[i].second, &decoded[i])) {
+          first_bad[t] = i;
+          break;
+        }
+      }
+    });
+  }
+  for (auto &thread : threads) {
+    thread.join();
+  }
+
+  // Everything from the first corrupted record on is discarded, and so is a
+  // batch left without its last record
+  size_t num_of_valid =
+      *std::min_element(first_bad.begin(), first_bad.end());
+  while (num_of_valid > 0 &&
+         (decoded[num_of_valid - 1].operation & kBatchContinues) != 0) {
+    --num_of_valid;
+  }
+  decoded.resize(num_of_valid);
+  if (num_of_valid > 0) {
+    *valid_length = boundaries[num_of_valid - 1].first +
+                    boundaries[num_of_valid - 1].second;
+  }
+
+  for (Record &record : decoded) {
+    record.operation =
+        static_cast<Operations>(record.operation & ~kBatchContinues);
+    records->push_back(std::move(record));
+  }
+  return true;
+}
+
+bool WriteAheadLog::Open(uint64_t valid_length, uint64_t last_lsn) {
+  fd_ = open(path_.c_str(), O_WRONLY | O_CREAT, 0644);
+  if (fd_ < 0) {
+    return false;
+  }
+  if (ftruncate(fd_, valid_length) != 0 ||
+      lseek(fd_, 0, SEEK_END) < 0) {
+    close(fd_);
+    fd_ = -1;
+    return false;
+  }
+
+  last_lsn_ = last_lsn;
+  durable_lsn_ = last_lsn;
+
+  if (mode_ != SYNC) {
+    commit_thread_ = std::thread(&WriteAheadLog::CommitLoop, this);
+  }
+  return true;
+}
+
+uint64_t WriteAheadLog::Append(Operations operation, const std::string &key,
+                               const std::string &value) {
+  std::lock_guard<std::mutex> guard(mutex_);
+  uint64_t lsn = ++last_lsn_;
+  AppendLocked(lsn, operation, false, key, value);
+
+  if (mode_ == BATCH) {
+    pending_cv_.notify_one();
+  }
+  return lsn;
+}
+
+uint64_t WriteAheadLog::AppendBatch(const std::vector<Record> &records) {
+  if (records.empty()) {
+    return 0;
+  }
+
+  // Under one lock, so no other record and no rotation comes in between
+  std::lock_guard<std::mutex> guard(mutex_);
+  for (size_t i = 0; i < records.size(); ++i) {
+    AppendLocked(++last_lsn_, records[i].operation, i + 1 < records.size(),
+                 records[i].key, records[i].value);
+  }
+
+  if (mode_ == BATCH) {
+    pending_cv_.notify_one();
+  }
+  return last_lsn_;
+}
+
+void WriteAheadLog::AppendLocked(uint64_t lsn, Operations operation,
+                                 bool continues, const std::string &key,
+                                 const std::string &value) {
+  size_t start = buffer_.size();
+  uint32_t body_size = kLengthSize + kFixedBodySize + key.size() + value.size();
+  // Checksum placeholder
+  AppendFixed<uint32_t>(&buffer_, 0);
+  AppendFixed<uint32_t>(&buffer_, body_size);
+  AppendFixed<uint64_t>(&buffer_, lsn);
+  buffer_.push_back(continues ? static_cast<char>(operation | kBatchContinues)
+                              : static_cast<char>(operation));
+  AppendFixed<uint32_t>(&buffer_, key.size());
+  buffer_.append(key);
+  buffer_.append(value);
+
+  uint32_t crc = Crc32(buffer_.data() + start + kCrcSize, body_size);
+  std::memcpy(&buffer_[start], &crc, sizeof(crc));
+
+  // Still under the lock, so the backups get the records in LSN order
+  if (replication_log_ != nullptr) {
+    replication_log_->Append(lsn, operation, key, value);
+  }
+}
+
+bool WriteAheadLog::WaitForDurable(uint64_t lsn) {
+  if (!WaitForFile(lsn)) {
+    return false;
+  }
+  if (replication_log_ != nullptr) {
+    replication_log_->WaitForBackups(lsn);
+  }
+  return true;
+}
+
+bool WriteAheadLog::WaitForFile(uint64_t lsn) {
+  if (mode_ == NONE) {
+    std::lock_guard<std::mutex> guard(mutex_);
+    return !failed_;
+  }
+
+  if (mode_ == SYNC) {
+    {
+      std::lock_guard<std::mutex> guard(mutex_);
+      if (durable_lsn_ >= lsn) {
+        return true;
+      }
+    }
+    // Another writer may have flushed this record already, in which case
+    // this fsync covers the records appended in the meantime.
+    return FlushBuffer(true);
+  }
+
+  std::unique_lock<std::mutex> lock(mutex_);
+  durable_cv_.wait(lock,
+                   [this, lsn]() { return durable_lsn_ >= lsn || failed_; });
+  return durable_lsn_ >= lsn;
+}
+
+bool WriteAheadLog::Rotate(const std::string &old_path, uint64_t *lsn) {
+  std::lock_guard<std::mutex> io_guard(io_mutex_);
+  // Appending is blocked until the new file is open, so that every record up
+  // to `lsn` is in the old file and every record after it in the new one
+  std::lock_guard<std::mutex> guard(mutex_);
+
+  bool ok = WriteAll(fd_, buffer_) && fdatasync(fd_) == 0;
+  if (ok) {
+    buffer_.clear();
+    durable_lsn_ = last_lsn_;
+    ok = rename(path_.c_str(), old_path.c_str()) == 0;
+  }
+  if (ok) {
+    int new_fd = open(path_.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    ok = new_fd >= 0;
+    if (ok) {
+      close(fd_);
+      fd_ = new_fd;
+    }
+  }
+
+  if (!ok) {
+    failed_ = true;
+  }
+  durable_cv_.notify_all();
+  *lsn = last_lsn_;
+  return ok;
+}
+
+uint64_t WriteAheadLog::get_last_lsn() {
+  std::lock_guard<std::mutex> guard(mutex_);
+  return last_lsn_;
+}
+
+bool WriteAheadLog::ParseDurabilityMode(const std::string &name,
+                                        DurabilityModes *mode) {
+  if (name == "none") {
+    *mode = NONE;
+  } else if (name == "batch") {
+    *mode = BATCH;
+  } else if (name == "sync") {
+    *mode = SYNC;
+  } else {
+    return false;
+  }
+  return true;
+}
+
+bool WriteAheadLog::FlushBuffer(bool sync) {
+  std::lock_guard<std::mutex> io_guard(io_mutex_);
+
+  std::string pending;
+  uint64_t pending_lsn;
+  {
+    std::lock_guard<std::mutex> guard(mutex_);
+    pending.swap(buffer_);
+    pending_lsn = last_lsn_;
+  }
+
+  bool ok = WriteAll(fd_, pending) && (!sync || fdatasync(fd_) == 0);
+
+  {
+    std::lock_guard<std::mutex> guard(mutex_);
+    if (ok) {
+      durable_lsn_ = std::max(durable_lsn_, pending_lsn);
+    } else {
+      failed_ = true;
+    }
+  }
+  durable_cv_.notify_all();
+  return ok;
+}
+
+void WriteAheadLog::CommitLoop() {
+  std::unique_lock<std::mutex> lock(mutex_);
+  while (!stopping_) {
+    if (mode_ == BATCH) {
+      // Everything appended while the previous fsync was running is committed
+      // by the next one
+      pending_cv_.wait(lock, [this]() { return stopping_ || !buffer_.empty(); });
+    } else {
+      pending_cv_.wait_for(lock, kNoneFlushInterval,
+                           [this]() { return stopping_; });
+    }
+    if (buffer_.empty()) {
+      continue;
+    }
+
+    lock.unlock();
+    FlushBuffer(mode_ == BATCH);
+    lock.lock();
+  }
+}
@@ -0,0 +1,173 @@
+#ifndef CHIRP_SRC_BACKEND_WRITE_AHEAD_LOG_H_
+#define CHIRP_SRC_BACKEND_WRITE_AHEAD_LOG_H_
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+class ReplicationLog;
+
+// An append-only write-ahead log for the backend data structure.
+// Every put and deletekey is appended as one record carrying a log sequence
+// number (LSN). Records are first appended to an in-memory buffer and written
+// to the file later, so that the fsync of many concurrent writers can be
+// shared (group commit).
+class WriteAheadLog {
+ public:
+  // How hard the log tries to keep the records on disk
+  enum DurabilityModes : int {
+    // Records are written to the file in the background without fsync
+    NONE = 0,
+    // Records are written and fsynced in batches by a group-commit thread
+    BATCH,
+    // Every writer writes and fsyncs the log before it returns
+    SYNC
+  };
+
+  // Operations that can be logged
+  // The value of a `PUT_WITH_DEADLINE` is the deadline in milliseconds, as 8
+  // bytes in host byte order, followed by the value put.
+  enum Operations : char { PUT = 1, DELETE_KEY = 2, PUT_WITH_DEADLINE = 3 };
+
+  // Set in the operation byte of every record of a batch but the last, so
+  // that a batch cut short by a crash can be told apart when reading
+  static const char kBatchContinues = 0x40;
+
+  // One decoded log record
+  struct Record {
+    uint64_t lsn;
+    Operations operation;
+    std::string key;
+    // Empty for `DELETE_KEY`
+    std::string value;
+  };
+
+  // Constructor that takes the path of the log file and the durability mode
+  // The log does nothing until `Open()` is called.
+  WriteAheadLog(const std::string &path, DurabilityModes mode);
+
+  // Flushes the remaining records and closes the log file
+  ~WriteAheadLog();
+
+  WriteAheadLog(const WriteAheadLog &) = delete;
+  WriteAheadLog &operator=(const WriteAheadLog &) = delete;
+
+  // Reads every valid record of the log file at `path` in LSN order.
+  // Decoding and checksum verification are split across `num_of_threads`
+  // threads. Reading stops at the first torn or corrupted record, and the
+  // length of the valid prefix of the file is stored in `valid_length`.
+  // A missing file is an empty log.
+  // returns true if the file can be read
+  // returns false otherwise
+  static bool ReadRecords(const std::string &path, size_t num_of_threads,
+                          std::vector<Record> *records,
+                          uint64_t *valid_length);
+
+  // Opens the log file for appending
+  // The file is truncated to `valid_length` so that a torn tail left by a
+  // crash does not hide the records appended after it. New records get LSNs
+  // starting from `last_lsn + 1`.
+  // returns true if this operation succeeds
+  // returns false otherwise
+  bool Open(uint64_t valid_length, uint64_t last_lsn);
+
+  // Appends one record to the log buffer
+  // Callers must append in the same order as they apply the operations to
+  // the same key, e.g. by appending while holding the lock of that key.
+  // returns the LSN of the record
+  uint64_t Append(Operations operation, const std::string &key,
+                  const std::string &value);
+
+  // Appends `records` next to each other as one batch; their LSNs are
+  // ignored and new ones are taken
+  // After a crash either every record of the batch is read back or none is.
+  // The backups still apply the records one by one.
+  // returns the LSN of the last record, or 0 if `records` is empty
+  uint64_t AppendBatch(const std::vector<Record> &records);
+
+  // Blocks until the record with `lsn` is as durable as the durability mode
+  // promises, and applied by the backups if they are waited for. Call this
+  // after releasing any data structure lock so that other writers can join
+  // the same fsync.
+  // returns true if this operation succeeds
+  // returns false if the log cannot be written
+  bool WaitForDurable(uint64_t lsn);
+
+  // Copies every record appended from now on to `log`, which ships them to
+  // the backups
+  // `log` is not owned and should outlive this log's writers. This should be
+  // called before the log takes writes.
+  inline void SetReplicationLog(ReplicationLog *log) { replication_log_ = log; }
+
+  // Moves the records logged so far to `old_path` and continues with an
+  // empty log file. The records are fsynced before they are moved.
+  // The LSN of the last record moved is stored in `lsn`.
+  // returns true if this operation succeeds
+  // returns false otherwise
+  bool Rotate(const std::string &old_path, uint64_t *lsn);
+
+  // returns the LSN of the latest appended record
+  uint64_t get_last_lsn();
+
+  // returns true if a write or fsync of the log failed
+  // A failed log never recovers; the records appended since are not durable.
+  inline bool has_failed() const { return failed_; }
+
+  inline DurabilityModes get_mode() const { return mode_; }
+
+  // returns the durability mode named by `name` ("none", "batch", "sync")
+  // returns false if `name` is not a durability mode
+  static bool ParseDurabilityMode(const std::string &name,
+                                  DurabilityModes *mode);
+
+ private:
+  // Writes the buffered records to the file, and fsyncs if `sync` is true
+  // returns true if this operation succeeds
+  // returns false otherwise
+  bool FlushBuffer(bool sync);
+
+  // Encodes one record to the buffer and hands it to the replication log
+  // `mutex_` should be held.
+  void AppendLocked(uint64_t lsn, Operations operation, bool continues,
+                    const std::string &key, const std::string &value);
+
+  // The loop run by `commit_thread_` in NONE and BATCH modes
+  void CommitLoop();
+
+  // Blocks until the record with `lsn` is in the file as the durability mode
+  // promises
+  bool WaitForFile(uint64_t lsn);
+
+  const std::string path_;
+  const DurabilityModes mode_;
+  int fd_;
+
+  // Guards every member below
+  std::mutex mutex_;
+  // Records appended but not yet written to the file
+  std::string buffer_;
+  uint64_t last_lsn_;
+  uint64_t durable_lsn_;
+  // Also read without the lock by `has_failed()`
+  std::atomic<bool> failed_;
+  bool stopping_;
+  // Signaled when records are appended
+  std::condition_variable pending_cv_;
+  // Signaled when `durable_lsn_` moves or the log fails
+  std::condition_variable durable_cv_;
+
+  // Serializes writes to `fd_`
+  std::mutex io_mutex_;
+
+  std::thread commit_thread_;
+
+  // nullptr if the records are not replicated
+  ReplicationLog *replication_log_;
+};
+
+#endif /* CHIRP_SRC_BACKEND_WRITE_AHEAD_LOG_H_ */
@@ -0,0 +1,39 @@
+#include "consistent_hash_ring.h"
+
+#include <algorithm>
+
+#include "hash.h"
+
+const size_t ConsistentHashRing::kDefaultNumOfVirtualNodes;
+
+ConsistentHashRing::ConsistentHashRing(size_t num_of_virtual_nodes)
+    : num_of_virtual_nodes_(std::max<size_t>(num_of_virtual_nodes, 1)),
+      num_of_nodes_(0),
+      points_() {}
+
+size_t ConsistentHashRing::AddNode(const std::string &name) {
+  size_t index = num_of_nodes_++;
+  for (size_t i = 0; i < num_of_virtual_nodes_; ++i) {
+    points_.emplace_back(Hash(name + "#" + std::to_string(i)), index);
+  }
+  std::sort(points_.begin(), points_.end());
+  return index;
+}
+
+size_t ConsistentHashRing::NodeOf(const std::string &key) const {
+  if (num_of_nodes_ == 1) {
+    return 0;
+  }
+  // The first point at or after the hash, wrapping around past the last one
+  auto it = std::lower_bound(
+      points_.begin(), points_.end(),
+      std::make_pair(Hash(key), static_cast<size_t>(0)));
+  if (it == points_.end()) {
+    it = points_.begin();
+  }
+  return it->second;
+}
+
+uint64_t ConsistentHashRing::Hash(const std::string &data) {
+  return HashBytes(data.data(), data.size());
+}
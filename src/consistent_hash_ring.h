@@ -0,0 +1,50 @@
+#ifndef CHIRP_SRC_CONSISTENT_HASH_RING_H_
+#define CHIRP_SRC_CONSISTENT_HASH_RING_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <utility>
+#include <vector>
+
+// Maps keys to nodes with consistent hashing
+// Every node is hashed to `num_of_virtual_nodes` points on a ring of 64-bit
+// hashes, and a key belongs to the node of the first point at or after the
+// hash of the key. Adding a node to N nodes only moves the keys of the
+// points it takes, about 1/(N+1) of them, and they all move to the new node.
+// The points of a node only depend on its name, so clients that know the
+// same nodes agree on the owner of every key whatever order they add them
+// in.
+// This class is not thread-safe for `AddNode()`. `NodeOf()` may be called
+// from any number of threads once the nodes are added.
+class ConsistentHashRing {
+ public:
+  // Enough points for the nodes to get within about 10% of an even share
+  static const size_t kDefaultNumOfVirtualNodes = 160;
+
+  // Constructor that takes the number of points of every node
+  explicit ConsistentHashRing(
+      size_t num_of_virtual_nodes = kDefaultNumOfVirtualNodes);
+
+  // Adds the node named `name`
+  // returns the index of the node, which is the number of nodes added
+  // before it
+  size_t AddNode(const std::string &name);
+
+  // returns the index of the node owning `key`
+  // At least one node should be added first.
+  size_t NodeOf(const std::string &key) const;
+
+  inline size_t get_num_of_nodes() const { return num_of_nodes_; }
+
+  // returns a 64-bit hash of `data` that is the same on every platform
+  static uint64_t Hash(const std::string &data);
+
+ private:
+  const size_t num_of_virtual_nodes_;
+  size_t num_of_nodes_;
+  // The points of every node and the index of their node, sorted
+  std::vector<std::pair<uint64_t, size_t>> points_;
+};
+
+#endif /* CHIRP_SRC_CONSISTENT_HASH_RING_H_ */
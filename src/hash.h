@@ -0,0 +1,33 @@
+#ifndef CHIRP_SRC_HASH_H_
+#define CHIRP_SRC_HASH_H_
+
+#include <cstddef>
+#include <cstdint>
+
+// Hashes that do not depend on the standard library, so that their values
+// can be written to disk or agreed on by separate processes
+
+// The finalizer of MurmurHash3
+// Every bit of the result depends on every bit of `hash`, so any bits of it
+// can pick a bucket or a slot.
+inline uint64_t MixHash(uint64_t hash) {
+  hash ^= hash >> 33;
+  hash *= 0xFF51AFD7ED558CCDULL;
+  hash ^= hash >> 33;
+  hash *= 0xC4CEB9FE1A85EC53ULL;
+  hash ^= hash >> 33;
+  return hash;
+}
+
+// 64-bit FNV-1a of the `size` bytes at `data`, whose low bits are poor on
+// their own, followed by `MixHash()`
+inline uint64_t HashBytes(const char *data, size_t size) {
+  uint64_t hash = 0xCBF29CE484222325ULL;
+  for (size_t i = 0; i < size; ++i) {
+    hash ^= static_cast<uint8_t>(data[i]);
+    hash *= 0x100000001B3ULL;
+  }
+  return MixHash(hash);
+}
+
+#endif /* CHIRP_SRC_HASH_H_ */
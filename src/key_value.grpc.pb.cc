@@ -0,0 +1,824 @@
+// Generated by the gRPC C++ plugin.
+// If you make any local change, they will be lost.
+// source: key_value.proto
+
+#include "key_value.pb.h"
+#include "key_value.grpc.pb.h"
+
+#include <functional>
+#include <grpcpp/support/async_stream.h>
+#include <grpcpp/support/async_unary_call.h>
+#include <grpcpp/impl/channel_interface.h>
+#include <grpcpp/impl/client_unary_call.h>
+#include <grpcpp/support/client_callback.h>
+#include <grpcpp/support/message_allocator.h>
+#include <grpcpp/support/method_handler.h>
+#include <grpcpp/impl/rpc_service_method.h>
+#include <grpcpp/support/server_callback.h>
+#include <grpcpp/impl/codegen/server_callback_handlers.h>
+#include <grpcpp/server_context.h>
+#include <grpcpp/impl/service_type.h>
+#include <grpcpp/support/sync_stream.h>
+namespace chirp {
+
+static const char* KeyValueStore_method_names[] = {
+  "/chirp.KeyValueStore/put",
+  "/chirp.KeyValueStore/get",
+  "/chirp.KeyValueStore/deletekey",
+  "/chirp.KeyValueStore/multiput",
+  "/chirp.KeyValueStore/multidelete",
+  "/chirp.KeyValueStore/fetch_add",
+  "/chirp.KeyValueStore/compare_and_swap",
+  "/chirp.KeyValueStore/write_batch",
+  "/chirp.KeyValueStore/scan",
+  "/chirp.KeyValueStore/list_append",
+  "/chirp.KeyValueStore/list_remove",
+  "/chirp.KeyValueStore/memory_usage",
+  "/chirp.KeyValueStore/stats",
+  "/chirp.KeyValueStore/exists",
+  "/chirp.KeyValueStore/create_snapshot",
+  "/chirp.KeyValueStore/release_snapshot",
+  "/chirp.KeyValueStore/changes",
+  "/chirp.KeyValueStore/watch",
+};
+
+std::unique_ptr< KeyValueStore::Stub> KeyValueStore::NewStub(const std::shared_ptr< ::grpc::ChannelInterface>& channel, const ::grpc::StubOptions& options) {
+  (void)options;
+  std::unique_ptr< KeyValueStore::Stub> stub(new KeyValueStore::Stub(channel, options));
+  return stub;
+}
+
+KeyValueStore::Stub::Stub(const std::shared_ptr< ::grpc::ChannelInterface>& channel, const ::grpc::StubOptions& options)
+  : channel_(channel), rpcmethod_put_(KeyValueStore_method_names[0], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
+  , rpcmethod_get_(KeyValueStore_method_names[1], options.suffix_for_stats(),::grpc::internal::RpcMethod::BIDI_STREAMING, channel)
+  , rpcmethod_deletekey_(KeyValueStore_method_names[2], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
+  , rpcmethod_multiput_(KeyValueStore_method_names[3], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
+  , rpcmethod_multidelete_(KeyValueStore_method_names[4], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
+  , rpcmethod_fetch_add_(KeyValueStore_method_names[5], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
+  , rpcmethod_compare_and_swap_(KeyValueStore_method_names[6], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
+  , rpcmethod_write_batch_(KeyValueStore_method_names[7], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
+  , rpcmethod_scan_(KeyValueStore_method_names[8], options.suffix_for_stats(),::grpc::internal::RpcMethod::SERVER_STREAMING, channel)
+  , rpcmethod_list_append_(KeyValueStore_method_names[9], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
+  , rpcmethod_list_remove_(KeyValueStore_method_names[10], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
+  , rpcmethod_memory_usage_(KeyValueStore_method_names[11], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
+  , rpcmethod_stats_(KeyValueStore_method_names[12], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
+  , rpcmethod_exists_(KeyValueStore_method_names[13], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
+  , rpcmethod_create_snapshot_(KeyValueStore_method_names[14], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
+  , rpcmethod_release_snapshot_(KeyValueStore_method_names[15], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
+  , rpcmethod_changes_(KeyValueStore_method_names[16], options.suffix_for_stats(),::grpc::internal::RpcMethod::SERVER_STREAMING, channel)
+  , rpcmethod_watch_(KeyValueStore_method_names[17], options.suffix_for_stats(),::grpc::internal::RpcMethod::SERVER_STREAMING, channel)
+  {}
+
+::grpc::Status KeyValueStore::Stub::put(::grpc::ClientContext* context, const ::chirp::PutRequest& request, ::chirp::PutReply* response) {
+  return ::grpc::internal::BlockingUnaryCall< ::chirp::PutRequest, ::chirp::PutReply, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), rpcmethod_put_, context, request, response);
+}
+
+void KeyValueStore::Stub::async::put(::grpc::ClientContext* context, const ::chirp::PutRequest* request, ::chirp::PutReply* response, std::function<void(::grpc::Status)> f) {
+  ::grpc::internal::CallbackUnaryCall< ::chirp::PutRequest, ::chirp::PutReply, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_put_, context, request, response, std::move(f));
+}
+
+void KeyValueStore::Stub::async::put(::grpc::ClientContext* context, const ::chirp::PutRequest* request, ::chirp::PutReply* response, ::grpc::ClientUnaryReactor* reactor) {
+  ::grpc::internal::ClientCallbackUnaryFactory::Create< ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_put_, context, request, response, reactor);
+}
+
+::grpc::ClientAsyncResponseReader< ::chirp::PutReply>* KeyValueStore::Stub::PrepareAsyncputRaw(::grpc::ClientContext* context, const ::chirp::PutRequest& request, ::grpc::CompletionQueue* cq) {
+  return ::grpc::internal::ClientAsyncResponseReaderHelper::Create< ::chirp::PutReply, ::chirp::PutRequest, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), cq, rpcmethod_put_, context, request);
+}
+
+::grpc::ClientAsyncResponseReader< ::chirp::PutReply>* KeyValueStore::Stub::AsyncputRaw(::grpc::ClientContext* context, const ::chirp::PutRequest& request, ::grpc::CompletionQueue* cq) {
+  auto* result =
+    this->PrepareAsyncputRaw(context, request, cq);
+  result->StartCall();
+  return result;
+}
+
+::grpc::ClientReaderWriter< ::chirp::GetRequest, ::chirp::GetReply>* KeyValueStore::Stub::getRaw(::grpc::ClientContext* context) {
+  return ::grpc::internal::ClientReaderWriterFactory< ::chirp::GetRequest, ::chirp::GetReply>::Create(channel_.get(), rpcmethod_get_, context);
+}
+
+void KeyValueStore::Stub::async::get(::grpc::ClientContext* context, ::grpc::ClientBidiReactor< ::chirp::GetRequest,::chirp::GetReply>* reactor) {
+  ::grpc::internal::ClientCallbackReaderWriterFactory< ::chirp::GetRequest,::chirp::GetReply>::Create(stub_->channel_.get(), stub_->rpcmethod_get_, context, reactor);
+}
+
+::grpc::ClientAsyncReaderWriter< ::chirp::GetRequest, ::chirp::GetReply>* KeyValueStore::Stub::AsyncgetRaw(::grpc::ClientContext* context, ::grpc::CompletionQueue* cq, void* tag) {
+  return ::grpc::internal::ClientAsyncReaderWriterFactory< ::chirp::GetRequest, ::chirp::GetReply>::Create(channel_.get(), cq, rpcmethod_get_, context, true, tag);
+}
+
+::grpc::ClientAsyncReaderWriter< ::chirp::GetRequest, ::chirp::GetReply>* KeyValueStore::Stub::PrepareAsyncgetRaw(::grpc::ClientContext* context, ::grpc::CompletionQueue* cq) {
+  return ::grpc::internal::ClientAsyncReaderWriterFactory< ::chirp::GetRequest, ::chirp::GetReply>::Create(channel_.get(), cq, rpcmethod_get_, context, false, nullptr);
+}
+
+::grpc::Status KeyValueStore::Stub::deletekey(::grpc::ClientContext* context, const ::chirp::DeleteRequest& request, ::chirp::DeleteReply* response) {
+  return ::grpc::internal::BlockingUnaryCall< ::chirp::DeleteRequest, ::chirp::DeleteReply, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), rpcmethod_deletekey_, context, request, response);
+}
+
+void KeyValueStore::Stub::async::deletekey(::grpc::ClientContext* context, const ::chirp::DeleteRequest* request, ::chirp::DeleteReply* response, std::function<void(::grpc::Status)> f) {
+  ::grpc::internal::CallbackUnaryCall< ::chirp::DeleteRequest, ::chirp::DeleteReply, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_deletekey_, context, request, response, std::move(f));
+}
+
+void KeyValueStore::Stub::async::deletekey(::grpc::ClientContext* context, const ::chirp::DeleteRequest* request, ::chirp::DeleteReply* response, ::grpc::ClientUnaryReactor* reactor) {
+  ::grpc::internal::ClientCallbackUnaryFactory::Create< ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_deletekey_, context, request, response, reactor);
+}
+
+::grpc::ClientAsyncResponseReader< ::chirp::DeleteReply>* KeyValueStore::Stub::PrepareAsyncdeletekeyRaw(::grpc::ClientContext* context, const ::chirp::DeleteRequest& request, ::grpc::CompletionQueue* cq) {
+  return ::grpc::internal::ClientAsyncResponseReaderHelper::Create< ::chirp::DeleteReply, ::chirp::DeleteRequest, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), cq, rpcmethod_deletekey_, context, request);
+}
+
+::grpc::ClientAsyncResponseReader< ::chirp::DeleteReply>* KeyValueStore::Stub::AsyncdeletekeyRaw(::grpc::ClientContext* context, const ::chirp::DeleteRequest& request, ::grpc::CompletionQueue* cq) {
+  auto* result =
+    this->PrepareAsyncdeletekeyRaw(context, request, cq);
+  result->StartCall();
+  return result;
+}
+
+::grpc::Status KeyValueStore::Stub::multiput(::grpc::ClientContext* context, const ::chirp::MultiPutRequest& request, ::chirp::MultiPutReply* response) {
+  return ::grpc::internal::BlockingUnaryCall< ::chirp::MultiPutRequest, ::chirp::MultiPutReply, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), rpcmethod_multiput_, context, request, response);
+}
+
+void KeyValueStore::Stub::async::multiput(::grpc::ClientContext* context, const ::chirp::MultiPutRequest* request, ::chirp::MultiPutReply* response, std::function<void(::grpc::Status)> f) {
+  ::grpc::internal::CallbackUnaryCall< ::chirp::MultiPutRequest, ::chirp::MultiPutReply, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_multiput_, context, request, response, std::move(f));
+}
+
+void KeyValueStore::Stub::async::multiput(::grpc::ClientContext* context, const ::chirp::MultiPutRequest* request, ::chirp::MultiPutReply* response, ::grpc::ClientUnaryReactor* reactor) {
+  ::grpc::internal::ClientCallbackUnaryFactory::Create< ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_multiput_, context, request, response, reactor);
+}
+
+::grpc::ClientAsyncResponseReader< ::chirp::MultiPutReply>* KeyValueStore::Stub::PrepareAsyncmultiputRaw(::grpc::ClientContext* context, const ::chirp::MultiPutRequest& request, ::grpc::CompletionQueue* cq) {
+  return ::grpc::internal::ClientAsyncResponseReaderHelper::Create< ::chirp::MultiPutReply, ::chirp::MultiPutRequest, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), cq, rpcmethod_multiput_, context, request);
+}
+
+::grpc::ClientAsyncResponseReader< ::chirp::MultiPutReply>* KeyValueStore::Stub::AsyncmultiputRaw(::grpc::ClientContext* context, const ::chirp::MultiPutRequest& request, ::grpc::CompletionQueue* cq) {
+  auto* result =
+    this->PrepareAsyncmultiputRaw(context, request, cq);
+  result->StartCall();
+  return result;
+}
+
+::grpc::Status KeyValueStore::Stub::multidelete(::grpc::ClientContext* context, const ::chirp::MultiDeleteRequest& request, ::chirp::MultiDeleteReply* response) {
+  return ::grpc::internal::BlockingUnaryCall< ::chirp::MultiDeleteRequest, ::chirp::MultiDeleteReply, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), rpcmethod_multidelete_, context, request, response);
+}
+
+void KeyValueStore::Stub::async::multidelete(::grpc::ClientContext* context, const ::chirp::MultiDeleteRequest* request, ::chirp::MultiDeleteReply* response, std::function<void(::grpc::Status)> f) {
+  ::grpc::internal::CallbackUnaryCall< ::chirp::MultiDeleteRequest, ::chirp::MultiDeleteReply, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_multidelete_, context, request, response, std::move(f));
+}
+
+void KeyValueStore::Stub::async::multidelete(::grpc::ClientContext* context, const ::chirp::MultiDeleteRequest* request, ::chirp::MultiDeleteReply* response, ::grpc::ClientUnaryReactor* reactor) {
+  ::grpc::internal::ClientCallbackUnaryFactory::Create< ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_multidelete_, context, request, response, reactor);
+}
+
+::grpc::ClientAsyncResponseReader< ::chirp::MultiDeleteReply>* KeyValueStore::Stub::PrepareAsyncmultideleteRaw(::grpc::ClientContext* context, const ::chirp::MultiDeleteRequest& request, ::grpc::CompletionQueue* cq) {
+  return ::grpc::internal::ClientAsyncResponseReaderHelper::Create< ::chirp::MultiDeleteReply, ::chirp::MultiDeleteRequest, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), cq, rpcmethod_multidelete_, context, request);
+}
+
+::grpc::ClientAsyncResponseReader< ::chirp::MultiDeleteReply>* KeyValueStore::Stub::AsyncmultideleteRaw(::grpc::ClientContext* context, const ::chirp::MultiDeleteRequest& request, ::grpc::CompletionQueue* cq) {
+  auto* result =
+    this->PrepareAsyncmultideleteRaw(context, request, cq);
+  result->StartCall();
+  return result;
+}
+
+::grpc::Status KeyValueStore::Stub::fetch_add(::grpc::ClientContext* context, const ::chirp::FetchAddRequest& request, ::chirp::FetchAddReply* response) {
+  return ::grpc::internal::BlockingUnaryCall< ::chirp::FetchAddRequest, ::chirp::FetchAddReply, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), rpcmethod_fetch_add_, context, request, response);
+}
+
+void KeyValueStore::Stub::async::fetch_add(::grpc::ClientContext* context, const ::chirp::FetchAddRequest* request, ::chirp::FetchAddReply* response, std::function<void(::grpc::Status)> f) {
+  ::grpc::internal::CallbackUnaryCall< ::chirp::FetchAddRequest, ::chirp::FetchAddReply, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_fetch_add_, context, request, response, std::move(f));
+}
+
+void KeyValueStore::Stub::async::fetch_add(::grpc::ClientContext* context, const ::chirp::FetchAddRequest* request, ::chirp::FetchAddReply* response, ::grpc::ClientUnaryReactor* reactor) {
+  ::grpc::internal::ClientCallbackUnaryFactory::Create< ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_fetch_add_, context, request, response, reactor);
+}
+
+::grpc::ClientAsyncResponseReader< ::chirp::FetchAddReply>* KeyValueStore::Stub::PrepareAsyncfetch_addRaw(::grpc::ClientContext* context, const ::chirp::FetchAddRequest& request, ::grpc::CompletionQueue* cq) {
+  return ::grpc::internal::ClientAsyncResponseReaderHelper::Create< ::chirp::FetchAddReply, ::chirp::FetchAddRequest, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), cq, rpcmethod_fetch_add_, context, request);
+}
+
+::grpc::ClientAsyncResponseReader< ::chirp::FetchAddReply>* KeyValueStore::Stub::Asyncfetch_addRaw(::grpc::ClientContext* context, const ::chirp::FetchAddRequest& request, ::grpc::CompletionQueue* cq) {
+  auto* result =
+    this->PrepareAsyncfetch_addRaw(context, request, cq);
+  result->StartCall();
+  return result;
+}
+
+::grpc::Status KeyValueStore::Stub::compare_and_swap(::grpc::ClientContext* context, const ::chirp::CompareAndSwapRequest& request, ::chirp::CompareAndSwapReply* response) {
+  return ::grpc::internal::BlockingUnaryCall< ::chirp::CompareAndSwapRequest, ::chirp::CompareAndSwapReply, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), rpcmethod_compare_and_swap_, context, request, response);
+}
+
+void KeyValueStore::Stub::async::compare_and_swap(::grpc::ClientContext* context, const ::chirp::CompareAndSwapRequest* request, ::chirp::CompareAndSwapReply* response, std::function<void(::grpc::Status)> f) {
+  ::grpc::internal::CallbackUnaryCall< ::chirp::CompareAndSwapRequest, ::chirp::CompareAndSwapReply, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_compare_and_swap_, context, request, response, std::move(f));
+}
+
+void KeyValueStore::Stub::async::compare_and_swap(::grpc::ClientContext* context, const ::chirp::CompareAndSwapRequest* request, ::chirp::CompareAndSwapReply* response, ::grpc::ClientUnaryReactor* reactor) {
+  ::grpc::internal::ClientCallbackUnaryFactory::Create< ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_compare_and_swap_, context, request, response, reactor);
+}
+
+::grpc::ClientAsyncResponseReader< ::chirp::CompareAndSwapReply>* KeyValueStore::Stub::PrepareAsynccompare_and_swapRaw(::grpc::ClientContext* context, const ::chirp::CompareAndSwapRequest& request, ::grpc::CompletionQueue* cq) {
+  return ::grpc::internal::ClientAsyncResponseReaderHelper::Create< ::chirp::CompareAndSwapReply, ::chirp::CompareAndSwapRequest, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), cq, rpcmethod_compare_and_swap_, context, request);
+}
+
+::grpc::ClientAsyncResponseReader< ::chirp::CompareAndSwapReply>* KeyValueStore::Stub::Asynccompare_and_swapRaw(::grpc::ClientContext* context, const ::chirp::CompareAndSwapRequest& request, ::grpc::CompletionQueue* cq) {
+  auto* result =
+    this->PrepareAsynccompare_and_swapRaw(context, request, cq);
+  result->StartCall();
+  return result;
+}
+
+::grpc::Status KeyValueStore::Stub::write_batch(::grpc::ClientContext* context, const ::chirp::WriteBatchRequest& request, ::chirp::WriteBatchReply* response) {
+  return ::grpc::internal::BlockingUnaryCall< ::chirp::WriteBatchRequest, ::chirp::WriteBatchReply, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), rpcmethod_write_batch_, context, request, response);
+}
+
+void KeyValueStore::Stub::async::write_batch(::grpc::ClientContext* context, const ::chirp::WriteBatchRequest* request, ::chirp::WriteBatchReply* response, std::function<void(::grpc::Status)> f) {
+  ::grpc::internal::CallbackUnaryCall< ::chirp::WriteBatchRequest, ::chirp::WriteBatchReply, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_write_batch_, context, request, response, std::move(f));
+}
+
+void KeyValueStore::Stub::async::write_batch(::grpc::ClientContext* context, const ::chirp::WriteBatchRequest* request, ::chirp::WriteBatchReply* response, ::grpc::ClientUnaryReactor* reactor) {
+  ::grpc::internal::ClientCallbackUnaryFactory::Create< ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_write_batch_, context, request, response, reactor);
+}
+
+::grpc::ClientAsyncResponseReader< ::chirp::WriteBatchReply>* KeyValueStore::Stub::PrepareAsyncwrite_batchRaw(::grpc::ClientContext* context, const ::chirp::WriteBatchRequest& request, ::grpc::CompletionQueue* cq) {
+  return ::grpc::internal::ClientAsyncResponseReaderHelper::Create< ::chirp::WriteBatchReply, ::chirp::WriteBatchRequest, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), cq, rpcmethod_write_batch_, context, request);
+}
+
+::grpc::ClientAsyncResponseReader< ::chirp::WriteBatchReply>* KeyValueStore::Stub::Asyncwrite_batchRaw(::grpc::ClientContext* context, const ::chirp::WriteBatchRequest& request, ::grpc::CompletionQueue* cq) {
+  auto* result =
+    this->PrepareAsyncwrite_batchRaw(context, request, cq);
+  result->StartCall();
+  return result;
+}
+
+::grpc::ClientReader< ::chirp::ScanReply>* KeyValueStore::Stub::scanRaw(::grpc::ClientContext* context, const ::chirp::ScanRequest& request) {
+  return ::grpc::internal::ClientReaderFactory< ::chirp::ScanReply>::Create(channel_.get(), rpcmethod_scan_, context, request);
+}
+
+void KeyValueStore::Stub::async::scan(::grpc::ClientContext* context, const ::chirp::ScanRequest* request, ::grpc::ClientReadReactor< ::chirp::ScanReply>* reactor) {
+  ::grpc::internal::ClientCallbackReaderFactory< ::chirp::ScanReply>::Create(stub_->channel_.get(), stub_->rpcmethod_scan_, context, request, reactor);
+}
+
+::grpc::ClientAsyncReader< ::chirp::ScanReply>* KeyValueStore::Stub::AsyncscanRaw(::grpc::ClientContext* context, const ::chirp::ScanRequest& request, ::grpc::CompletionQueue* cq, void* tag) {
+  return ::grpc::internal::ClientAsyncReaderFactory< ::chirp::ScanReply>::Create(channel_.get(), cq, rpcmethod_scan_, context, request, true, tag);
+}
+
+::grpc::ClientAsyncReader< ::chirp::ScanReply>* KeyValueStore::Stub::PrepareAsyncscanRaw(::grpc::ClientContext* context, const ::chirp::ScanRequest& request, ::grpc::CompletionQueue* cq) {
+  return ::grpc::internal::ClientAsyncReaderFactory< ::chirp::ScanReply>::Create(channel_.get(), cq, rpcmethod_scan_, context, request, false, nullptr);
+}
+
+::grpc::Status KeyValueStore::Stub::list_append(::grpc::ClientContext* context, const ::chirp::ListElementRequest& request, ::chirp::ListElementReply* response) {
+  return ::grpc::internal::BlockingUnaryCall< ::chirp::ListElementRequest, ::chirp::ListElementReply, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), rpcmethod_list_append_, context, request, response);
+}
+
+void KeyValueStore::Stub::async::list_append(::grpc::ClientContext* context, const ::chirp::ListElementRequest* request, ::chirp::ListElementReply* response, std::function<void(::grpc::Status)> f) {
+  ::grpc::internal::CallbackUnaryCall< ::chirp::ListElementRequest, ::chirp::ListElementReply, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_list_append_, context, request, response, std::move(f));
+}
+
+void KeyValueStore::Stub::async::list_append(::grpc::ClientContext* context, const ::chirp::ListElementRequest* request, ::chirp::ListElementReply* response, ::grpc::ClientUnaryReactor* reactor) {
+  ::grpc::internal::ClientCallbackUnaryFactory::Create< ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_list_append_, context, request, response, reactor);
+}
+
+::grpc::ClientAsyncResponseReader< ::chirp::ListElementReply>* KeyValueStore::Stub::PrepareAsynclist_appendRaw(::grpc::ClientContext* context, const ::chirp::ListElementRequest& request, ::grpc::CompletionQueue* cq) {
+  return ::grpc::internal::ClientAsyncResponseReaderHelper::Create< ::chirp::ListElementReply, ::chirp::ListElementRequest, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), cq, rpcmethod_list_append_, context, request);
+}
+
+::grpc::ClientAsyncResponseReader< ::chirp::ListElementReply>* KeyValueStore::Stub::Asynclist_appendRaw(::grpc::ClientContext* context, const ::chirp::ListElementRequest& request, ::grpc::CompletionQueue* cq) {
+  auto* result =
+    this->PrepareAsynclist_appendRaw(context, request, cq);
+  result->StartCall();
+  return result;
+}
+
+::grpc::Status KeyValueStore::Stub::list_remove(::grpc::ClientContext* context, const ::chirp::ListElementRequest& request, ::chirp::ListElementReply* response) {
+  return ::grpc::internal::BlockingUnaryCall< ::chirp::ListElementRequest, ::chirp::ListElementReply, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), rpcmethod_list_remove_, context, request, response);
+}
+
+void KeyValueStore::Stub::async::list_remove(::grpc::ClientContext* context, const ::chirp::ListElementRequest* request, ::chirp::ListElementReply* response, std::function<void(::grpc::Status)> f) {
+  ::grpc::internal::CallbackUnaryCall< ::chirp::ListElementRequest, ::chirp::ListElementReply, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_list_remove_, context, request, response, std::move(f));
+}
+
+void KeyValueStore::Stub::async::list_remove(::grpc::ClientContext* context, const ::chirp::ListElementRequest* request, ::chirp::ListElementReply* response, ::grpc::ClientUnaryReactor* reactor) {
+  ::grpc::internal::ClientCallbackUnaryFactory::Create< ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_list_remove_, context, request, response, reactor);
+}
+
+::grpc::ClientAsyncResponseReader< ::chirp::ListElementReply>* KeyValueStore::Stub::PrepareAsynclist_removeRaw(::grpc::ClientContext* context, const ::chirp::ListElementRequest& request, ::grpc::CompletionQueue* cq) {
+  return ::grpc::internal::ClientAsyncResponseReaderHelper::Create< ::chirp::ListElementReply, ::chirp::ListElementRequest, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), cq, rpcmethod_list_remove_, context, request);
+}
+
+::grpc::ClientAsyncResponseReader< ::chirp::ListElementReply>* KeyValueStore::Stub::Asynclist_removeRaw(::grpc::ClientContext* context, const ::chirp::ListElementRequest& request, ::grpc::CompletionQueue* cq) {
+  auto* result =
+    this->PrepareAsynclist_removeRaw(context, request, cq);
+  result->StartCall();
+  return result;
+}
+
+::grpc::Status KeyValueStore::Stub::memory_usage(::grpc::ClientContext* context, const ::chirp::MemoryUsageRequest& request, ::chirp::MemoryUsageReply* response) {
+  return ::grpc::internal::BlockingUnaryCall< ::chirp::MemoryUsageRequest, ::chirp::MemoryUsageReply, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), rpcmethod_memory_usage_, context, request, response);
+}
+
+void KeyValueStore::Stub::async::memory_usage(::grpc::ClientContext* context, const ::chirp::MemoryUsageRequest* request, ::chirp::MemoryUsageReply* response, std::function<void(::grpc::Status)> f) {
+  ::grpc::internal::CallbackUnaryCall< ::chirp::MemoryUsageRequest, ::chirp::MemoryUsageReply, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_memory_usage_, context, request, response, std::move(f));
+}
+
+void KeyValueStore::Stub::async::memory_usage(::grpc::ClientContext* context, const ::chirp::MemoryUsageRequest* request, ::chirp::MemoryUsageReply* response, ::grpc::ClientUnaryReactor* reactor) {
+  ::grpc::internal::ClientCallbackUnaryFactory::Create< ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_memory_usage_, context, request, response, reactor);
+}
+
+::grpc::ClientAsyncResponseReader< ::chirp::MemoryUsageReply>* KeyValueStore::Stub::PrepareAsyncmemory_usageRaw(::grpc::ClientContext* context, const ::chirp::MemoryUsageRequest& request, ::grpc::CompletionQueue* cq) {
+  return ::grpc::internal::ClientAsyncResponseReaderHelper::Create< ::chirp::MemoryUsageReply, ::chirp::MemoryUsageRequest, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), cq, rpcmethod_memory_usage_, context, request);
+}
+
+::grpc::ClientAsyncResponseReader< ::chirp::MemoryUsageReply>* KeyValueStore::Stub::Asyncmemory_usageRaw(::grpc::ClientContext* context, const ::chirp::MemoryUsageRequest& request, ::grpc::CompletionQueue* cq) {
+  auto* result =
+    this->PrepareAsyncmemory_usageRaw(context, request, cq);
+  result->StartCall();
+  return result;
+}
+
+::grpc::Status KeyValueStore::Stub::stats(::grpc::ClientContext* context, const ::chirp::StatsRequest& request, ::chirp::StatsReply* response) {
+  return ::grpc::internal::BlockingUnaryCall< ::chirp::StatsRequest, ::chirp::StatsReply, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), rpcmethod_stats_, context, request, response);
+}
+
+void KeyValueStore::Stub::async::stats(::grpc::ClientContext* context, const ::chirp::StatsRequest* request, ::chirp::StatsReply* response, std::function<void(::grpc::Status)> f) {
+  ::grpc::internal::CallbackUnaryCall< ::chirp::StatsRequest, ::chirp::StatsReply, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_stats_, context, request, response, std::move(f));
+}
+
+void KeyValueStore::Stub::async::stats(::grpc::ClientContext* context, const ::chirp::StatsRequest* request, ::chirp::StatsReply* response, ::grpc::ClientUnaryReactor* reactor) {
+  ::grpc::internal::ClientCallbackUnaryFactory::Create< ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_stats_, context, request, response, reactor);
+}
+
+::grpc::ClientAsyncResponseReader< ::chirp::StatsReply>* KeyValueStore::Stub::PrepareAsyncstatsRaw(::grpc::ClientContext* context, const ::chirp::StatsRequest& request, ::grpc::CompletionQueue* cq) {
+  return ::grpc::internal::ClientAsyncResponseReaderHelper::Create< ::chirp::StatsReply, ::chirp::StatsRequest, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), cq, rpcmethod_stats_, context, request);
+}
+
+::grpc::ClientAsyncResponseReader< ::chirp::StatsReply>* KeyValueStore::Stub::AsyncstatsRaw(::grpc::ClientContext* context, const ::chirp::StatsRequest& request, ::grpc::CompletionQueue* cq) {
+  auto* result =
+    this->PrepareAsyncstatsRaw(context, request, cq);
+  result->StartCall();
+  return result;
+}
+
+::grpc::Status KeyValueStore::Stub::exists(::grpc::ClientContext* context, const ::chirp::ExistsRequest& request, ::chirp::ExistsReply* response) {
+  return ::grpc::internal::BlockingUnaryCall< ::chirp::ExistsRequest, ::chirp::ExistsReply, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), rpcmethod_exists_, context, request, response);
+}
+
+void KeyValueStore::Stub::async::exists(::grpc::ClientContext* context, const ::chirp::ExistsRequest* request, ::chirp::ExistsReply* response, std::function<void(::grpc::Status)> f) {
+  ::grpc::internal::CallbackUnaryCall< ::chirp::ExistsRequest, ::chirp::ExistsReply, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_exists_, context, request, response, std::move(f));
+}
+
+void KeyValueStore::Stub::async::exists(::grpc::ClientContext* context, const ::chirp::ExistsRequest* request, ::chirp::ExistsReply* response, ::grpc::ClientUnaryReactor* reactor) {
+  ::grpc::internal::ClientCallbackUnaryFactory::Create< ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_exists_, context, request, response, reactor);
+}
+
+::grpc::ClientAsyncResponseReader< ::chirp::ExistsReply>* KeyValueStore::Stub::PrepareAsyncexistsRaw(::grpc::ClientContext* context, const ::chirp::ExistsRequest& request, ::grpc::CompletionQueue* cq) {
+  return ::grpc::internal::ClientAsyncResponseReaderHelper::Create< ::chirp::ExistsReply, ::chirp::ExistsRequest, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), cq, rpcmethod_exists_, context, request);
+}
+
+::grpc::ClientAsyncResponseReader< ::chirp::ExistsReply>* KeyValueStore::Stub::AsyncexistsRaw(::grpc::ClientContext* context, const ::chirp::ExistsRequest& request, ::grpc::CompletionQueue* cq) {
+  auto* result =
+    this->PrepareAsyncexistsRaw(context, request, cq);
+  result->StartCall();
+  return result;
+}
+
+::grpc::Status KeyValueStore::Stub::create_snapshot(::grpc::ClientContext* context, const ::chirp::CreateSnapshotRequest& request, ::chirp::CreateSnapshotReply* response) {
+  return ::grpc::internal::BlockingUnaryCall< ::chirp::CreateSnapshotRequest, ::chirp::CreateSnapshotReply, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), rpcmethod_create_snapshot_, context, request, response);
+}
+
+void KeyValueStore::Stub::async::create_snapshot(::grpc::ClientContext* context, const ::chirp::CreateSnapshotRequest* request, ::chirp::CreateSnapshotReply* response, std::function<void(::grpc::Status)> f) {
+  ::grpc::internal::CallbackUnaryCall< ::chirp::CreateSnapshotRequest, ::chirp::CreateSnapshotReply, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_create_snapshot_, context, request, response, std::move(f));
+}
+
+void KeyValueStore::Stub::async::create_snapshot(::grpc::ClientContext* context, const ::chirp::CreateSnapshotRequest* request, ::chirp::CreateSnapshotReply* response, ::grpc::ClientUnaryReactor* reactor) {
+  ::grpc::internal::ClientCallbackUnaryFactory::Create< ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_create_snapshot_, context, request, response, reactor);
+}
+
+::grpc::ClientAsyncResponseReader< ::chirp::CreateSnapshotReply>* KeyValueStore::Stub::PrepareAsynccreate_snapshotRaw(::grpc::ClientContext* context, const ::chirp::CreateSnapshotRequest& request, ::grpc::CompletionQueue* cq) {
+  return ::grpc::internal::ClientAsyncResponseReaderHelper::Create< ::chirp::CreateSnapshotReply, ::chirp::CreateSnapshotRequest, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), cq, rpcmethod_create_snapshot_, context, request);
+}
+
+::grpc::ClientAsyncResponseReader< ::chirp::CreateSnapshotReply>* KeyValueStore::Stub::Asynccreate_snapshotRaw(::grpc::ClientContext* context, const ::chirp::CreateSnapshotRequest& request, ::grpc::CompletionQueue* cq) {
+  auto* result =
+    this->PrepareAsynccreate_snapshotRaw(context, request, cq);
+  result->StartCall();
+  return result;
+}
+
+::grpc::Status KeyValueStore::Stub::release_snapshot(::grpc::ClientContext* context, const ::chirp::ReleaseSnapshotRequest& request, ::chirp::ReleaseSnapshotReply* response) {
+  return ::grpc::internal::BlockingUnaryCall< ::chirp::ReleaseSnapshotRequest, ::chirp::ReleaseSnapshotReply, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), rpcmethod_release_snapshot_, context, request, response);
+}
+
+void KeyValueStore::Stub::async::release_snapshot(::grpc::ClientContext* context, const ::chirp::ReleaseSnapshotRequest* request, ::chirp::ReleaseSnapshotReply* response, std::function<void(::grpc::Status)> f) {
+  ::grpc::internal::CallbackUnaryCall< ::chirp::ReleaseSnapshotRequest, ::chirp::ReleaseSnapshotReply, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_release_snapshot_, context, request, response, std::move(f));
+}
+
+void KeyValueStore::Stub::async::release_snapshot(::grpc::ClientContext* context, const ::chirp::ReleaseSnapshotRequest* request, ::chirp::ReleaseSnapshotReply* response, ::grpc::ClientUnaryReactor* reactor) {
+  ::grpc::internal::ClientCallbackUnaryFactory::Create< ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_release_snapshot_, context, request, response, reactor);
+}
+
+::grpc::ClientAsyncResponseReader< ::chirp::ReleaseSnapshotReply>* KeyValueStore::Stub::PrepareAsyncrelease_snapshotRaw(::grpc::ClientContext* context, const ::chirp::ReleaseSnapshotRequest& request, ::grpc::CompletionQueue* cq) {
+  return ::grpc::internal::ClientAsyncResponseReaderHelper::Create< ::chirp::ReleaseSnapshotReply, ::chirp::ReleaseSnapshotRequest, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), cq, rpcmethod_release_snapshot_, context, request);
+}
+
+::grpc::ClientAsyncResponseReader< ::chirp::ReleaseSnapshotReply>* KeyValueStore::Stub::Asyncrelease_snapshotRaw(::grpc::ClientContext* context, const ::chirp::ReleaseSnapshotRequest& request, ::grpc::CompletionQueue* cq) {
+  auto* result =
+    this->PrepareAsyncrelease_snapshotRaw(context, request, cq);
+  result->StartCall();
+  return result;
+}
+
+::grpc::ClientReader< ::chirp::ChangesReply>* KeyValueStore::Stub::changesRaw(::grpc::ClientContext* context, const ::chirp::ChangesRequest& request) {
+  return ::grpc::internal::ClientReaderFactory< ::chirp::ChangesReply>::Create(channel_.get(), rpcmethod_changes_, context, request);
+}
+
+void KeyValueStore::Stub::async::changes(::grpc::ClientContext* context, const ::chirp::ChangesRequest* request, ::grpc::ClientReadReactor< ::chirp::ChangesReply>* reactor) {
+  ::grpc::internal::ClientCallbackReaderFactory< ::chirp::ChangesReply>::Create(stub_->channel_.get(), stub_->rpcmethod_changes_, context, request, reactor);
+}
+
+::grpc::ClientAsyncReader< ::chirp::ChangesReply>* KeyValueStore::Stub::AsyncchangesRaw(::grpc::ClientContext* context, const ::chirp::ChangesRequest& request, ::grpc::CompletionQueue* cq, void* tag) {
+  return ::grpc::internal::ClientAsyncReaderFactory< ::chirp::ChangesReply>::Create(channel_.get(), cq, rpcmethod_changes_, context, request, true, tag);
+}
+
+::grpc::ClientAsyncReader< ::chirp::ChangesReply>* KeyValueStore::Stub::PrepareAsyncchangesRaw(::grpc::ClientContext* context, const ::chirp::ChangesRequest& request, ::grpc::CompletionQueue* cq) {
+  return ::grpc::internal::ClientAsyncReaderFactory< ::chirp::ChangesReply>::Create(channel_.get(), cq, rpcmethod_changes_, context, request, false, nullptr);
+}
+
+::grpc::ClientReader< ::chirp::WatchReply>* KeyValueStore::Stub::watchRaw(::grpc::ClientContext* context, const ::chirp::WatchRequest& request) {
+  return ::grpc::internal::ClientReaderFactory< ::chirp::WatchReply>::Create(channel_.get(), rpcmethod_watch_, context, request);
+}
+
+void KeyValueStore::Stub::async::watch(::grpc::ClientContext* context, const ::chirp::WatchRequest* request, ::grpc::ClientReadReactor< ::chirp::WatchReply>* reactor) {
+  ::grpc::internal::ClientCallbackReaderFactory< ::chirp::WatchReply>::Create(stub_->channel_.get(), stub_->rpcmethod_watch_, context, request, reactor);
+}
+
+::grpc::ClientAsyncReader< ::chirp::WatchReply>* KeyValueStore::Stub::AsyncwatchRaw(::grpc::ClientContext* context, const ::chirp::WatchRequest& request, ::grpc::CompletionQueue* cq, void* tag) {
+  return ::grpc::internal::ClientAsyncReaderFactory< ::chirp::WatchReply>::Create(channel_.get(), cq, rpcmethod_watch_, context, request, true, tag);
+}
+
+::grpc::ClientAsyncReader< ::chirp::WatchReply>* KeyValueStore::Stub::PrepareAsyncwatchRaw(::grpc::ClientContext* context, const ::chirp::WatchRequest& request, ::grpc::CompletionQueue* cq) {
+  return ::grpc::internal::ClientAsyncReaderFactory< ::chirp::WatchReply>::Create(channel_.get(), cq, rpcmethod_watch_, context, request, false, nullptr);
+}
+
+KeyValueStore::Service::Service() {
+  AddMethod(new ::grpc::internal::RpcServiceMethod(
+      KeyValueStore_method_names[0],
+      ::grpc::internal::RpcMethod::NORMAL_RPC,
+      new ::grpc::internal::RpcMethodHandler< KeyValueStore::Service, ::chirp::PutRequest, ::chirp::PutReply, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(
+          [](KeyValueStore::Service* service,
+             ::grpc::ServerContext* ctx,
+             const ::chirp::PutRequest* req,
+             ::chirp::PutReply* resp) {
+               return service->put(ctx, req, resp);
+             }, this)));
+  AddMethod(new ::grpc::internal::RpcServiceMethod(
+      KeyValueStore_method_names[1],
+      ::grpc::internal::RpcMethod::BIDI_STREAMING,
+      new ::grpc::internal::BidiStreamingHandler< KeyValueStore::Service, ::chirp::GetRequest, ::chirp::GetReply>(
+          [](KeyValueStore::Service* service,
+             ::grpc::ServerContext* ctx,
+             ::grpc::ServerReaderWriter<::chirp::GetReply,
+             ::chirp::GetRequest>* stream) {
+               return service->get(ctx, stream);
+             }, this)));
+  AddMethod(new ::grpc::internal::RpcServiceMethod(
+      KeyValueStore_method_names[2],
+      ::grpc::internal::RpcMethod::NORMAL_RPC,
+      new ::grpc::internal::RpcMethodHandler< KeyValueStore::Service, ::chirp::DeleteRequest, ::chirp::DeleteReply, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(
+          [](KeyValueStore::Service* service,
+             ::grpc::ServerContext* ctx,
+             const ::chirp::DeleteRequest* req,
+             ::chirp::DeleteReply* resp) {
+               return service->deletekey(ctx, req, resp);
+             }, this)));
+  AddMethod(new ::grpc::internal::RpcServiceMethod(
+      KeyValueStore_method_names[3],
+      ::grpc::internal::RpcMethod::NORMAL_RPC,
+      new ::grpc::internal::RpcMethodHandler< KeyValueStore::Service, ::chirp::MultiPutRequest, ::chirp::MultiPutReply, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(
+          [](KeyValueStore::Service* service,
+             ::grpc::ServerContext* ctx,
+             const ::chirp::MultiPutRequest* req,
+             ::chirp::MultiPutReply* resp) {
+               return service->multiput(ctx, req, resp);
+             }, this)));
+  AddMethod(new ::grpc::internal::RpcServiceMethod(
+      KeyValueStore_method_names[4],
+      ::grpc::internal::RpcMethod::NORMAL_RPC,
+      new ::grpc::internal::RpcMethodHandler< KeyValueStore::Service, ::chirp::MultiDeleteRequest, ::chirp::MultiDeleteReply, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(
+          [](KeyValueStore::Service* service,
+             ::grpc::ServerContext* ctx,
+             const ::chirp::MultiDeleteRequest* req,
+             ::chirp::MultiDeleteReply* resp) {
+               return service->multidelete(ctx, req, resp);
+             }, this)));
+  AddMethod(new ::grpc::internal::RpcServiceMethod(
+      KeyValueStore_method_names[5],
+      ::grpc::internal::RpcMethod::NORMAL_RPC,
+      new ::grpc::internal::RpcMethodHandler< KeyValueStore::Service, ::chirp::FetchAddRequest, ::chirp::FetchAddReply, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(
+          [](KeyValueStore::Service* service,
+             ::grpc::ServerContext* ctx,
+             const ::chirp::FetchAddRequest* req,
+             ::chirp::FetchAddReply* resp) {
+               return service->fetch_add(ctx, req, resp);
+             }, this)));
+  AddMethod(new ::grpc::internal::RpcServiceMethod(
+      KeyValueStore_method_names[6],
+      ::grpc::internal::RpcMethod::NORMAL_RPC,
+      new ::grpc::internal::RpcMethodHandler< KeyValueStore::Service, ::chirp::CompareAndSwapRequest, ::chirp::CompareAndSwapReply, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(
+          [](KeyValueStore::Service* service,
+             ::grpc::ServerContext* ctx,
+             const ::chirp::CompareAndSwapRequest* req,
+             ::chirp::CompareAndSwapReply* resp) {
+               return service->compare_and_swap(ctx, req, resp);
+             }, this)));
+  AddMethod(new ::grpc::internal::RpcServiceMethod(
+      KeyValueStore_method_names[7],
+      ::grpc::internal::RpcMethod::NORMAL_RPC,
+      new ::grpc::internal::RpcMethodHandler< KeyValueStore::Service, ::chirp::WriteBatchRequest, ::chirp::WriteBatchReply, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(
+          [](KeyValueStore::Service* service,
+             ::grpc::ServerContext* ctx,
+             const ::chirp::WriteBatchRequest* req,
+             ::chirp::WriteBatchReply* resp) {
+               return service->write_batch(ctx, req, resp);
+             }, this)));
+  AddMethod(new ::grpc::internal::RpcServiceMethod(
+      KeyValueStore_method_names[8],
+      ::grpc::internal::RpcMethod::SERVER_STREAMING,
+      new ::grpc::internal::ServerStreamingHandler< KeyValueStore::Service, ::chirp::ScanRequest, ::chirp::ScanReply>(
+          [](KeyValueStore::Service* service,
+             ::grpc::ServerContext* ctx,
+             const ::chirp::ScanRequest* req,
+             ::grpc::ServerWriter<::chirp::ScanReply>* writer) {
+               return service->scan(ctx, req, writer);
+             }, this)));
+  AddMethod(new ::grpc::internal::RpcServiceMethod(
+      KeyValueStore_method_names[9],
+      ::grpc::internal::RpcMethod::NORMAL_RPC,
+      new ::grpc::internal::RpcMethodHandler< KeyValueStore::Service, ::chirp::ListElementRequest, ::chirp::ListElementReply, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(
+          [](KeyValueStore::Service* service,
+             ::grpc::ServerContext* ctx,
+             const ::chirp::ListElementRequest* req,
+             ::chirp::ListElementReply* resp) {
+               return service->list_append(ctx, req, resp);
+             }, this)));
+  AddMethod(new ::grpc::internal::RpcServiceMethod(
+      KeyValueStore_method_names[10],
+      ::grpc::internal::RpcMethod::NORMAL_RPC,
+      new ::grpc::internal::RpcMethodHandler< KeyValueStore::Service, ::chirp::ListElementRequest, ::chirp::ListElementReply, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(
+          [](KeyValueStore::Service* service,
+             ::grpc::ServerContext* ctx,
+             const ::chirp::ListElementRequest* req,
+             ::chirp::ListElementReply* resp) {
+               return service->list_remove(ctx, req, resp);
+             }, this)));
+  AddMethod(new ::grpc::internal::RpcServiceMethod(
+      KeyValueStore_method_names[11],
+      ::grpc::internal::RpcMethod::NORMAL_RPC,
+      new ::grpc::internal::RpcMethodHandler< KeyValueStore::Service, ::chirp::MemoryUsageRequest, ::chirp::MemoryUsageReply, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(
+          [](KeyValueStore::Service* service,
+             ::grpc::ServerContext* ctx,
+             const ::chirp::MemoryUsageRequest* req,
+             ::chirp::MemoryUsageReply* resp) {
+               return service->memory_usage(ctx, req, resp);
+             }, this)));
+  AddMethod(new ::grpc::internal::RpcServiceMethod(
+      KeyValueStore_method_names[12],
+      ::grpc::internal::RpcMethod::NORMAL_RPC,
+      new ::grpc::internal::RpcMethodHandler< KeyValueStore::Service, ::chirp::StatsRequest, ::chirp::StatsReply, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(
+          [](KeyValueStore::Service* service,
+             ::grpc::ServerContext* ctx,
+             const ::chirp::StatsRequest* req,
+             ::chirp::StatsReply* resp) {
+               return service->stats(ctx, req, resp);
+             }, this)));
+  AddMethod(new ::grpc::internal::RpcServiceMethod(
+      KeyValueStore_method_names[13],
+      ::grpc::internal::RpcMethod::NORMAL_RPC,
+      new ::grpc::internal::RpcMethodHandler< KeyValueStore::Service, ::chirp::ExistsRequest, ::chirp::ExistsReply, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(
+          [](KeyValueStore::Service* service,
+             ::grpc::ServerContext* ctx,
+             const ::chirp::ExistsRequest* req,
+             ::chirp::ExistsReply* resp) {
+               return service->exists(ctx, req, resp);
+             }, this)));
+  AddMethod(new ::grpc::internal::RpcServiceMethod(
+      KeyValueStore_method_names[14],
+      ::grpc::internal::RpcMethod::NORMAL_RPC,
+      new ::grpc::internal::RpcMethodHandler< KeyValueStore::Service, ::chirp::CreateSnapshotRequest, ::chirp::CreateSnapshotReply, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(
+          [](KeyValueStore::Service* service,
+             ::grpc::ServerContext* ctx,
+             const ::chirp::CreateSnapshotRequest* req,
+             ::chirp::CreateSnapshotReply* resp) {
+               return service->create_snapshot(ctx, req, resp);
+             }, this)));
+  AddMethod(new ::grpc::internal::RpcServiceMethod(
+      KeyValueStore_method_names[15],
+      ::grpc::internal::RpcMethod::NORMAL_RPC,
+      new ::grpc::internal::RpcMethodHandler< KeyValueStore::Service, ::chirp::ReleaseSnapshotRequest, ::chirp::ReleaseSnapshotReply, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(
+          [](KeyValueStore::Service* service,
+             ::grpc::ServerContext* ctx,
+             const ::chirp::ReleaseSnapshotRequest* req,
+             ::chirp::ReleaseSnapshotReply* resp) {
+               return service->release_snapshot(ctx, req, resp);
+             }, this)));
+  AddMethod(new ::grpc::internal::RpcServiceMethod(
+      KeyValueStore_method_names[16],
+      ::grpc::internal::RpcMethod::SERVER_STREAMING,
+      new ::grpc::internal::ServerStreamingHandler< KeyValueStore::Service, ::chirp::ChangesRequest, ::chirp::ChangesReply>(
+          [](KeyValueStore::Service* service,
+             ::grpc::ServerContext* ctx,
+             const ::chirp::ChangesRequest* req,
+             ::grpc::ServerWriter<::chirp::ChangesReply>* writer) {
+               return service->changes(ctx, req, writer);
+             }, this)));
+  AddMethod(new ::grpc::internal::RpcServiceMethod(
+      KeyValueStore_method_names[17],
+      ::grpc::internal::RpcMethod::SERVER_STREAMING,
+      new ::grpc::internal::ServerStreamingHandler< KeyValueStore::Service, ::chirp::WatchRequest, ::chirp::WatchReply>(
+          [](KeyValueStore::Service* service,
+             ::grpc::ServerContext* ctx,
+             const ::chirp::WatchRequest* req,
+             ::grpc::ServerWriter<::chirp::WatchReply>* writer) {
+               return service->watch(ctx, req, writer);
+             }, this)));
+}
+
+KeyValueStore::Service::~Service() {
+}
+
+::grpc::Status KeyValueStore::Service::put(::grpc::ServerContext* context, const ::chirp::PutRequest* request, ::chirp::PutReply* response) {
+  (void) context;
+  (void) request;
+  (void) response;
+  return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+}
+
+::grpc::Status KeyValueStore::Service::get(::grpc::ServerContext* context, ::grpc::ServerReaderWriter< ::chirp::GetReply, ::chirp::GetRequest>* stream) {
+  (void) context;
+  (void) stream;
+  return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+}
+
+::grpc::Status KeyValueStore::Service::deletekey(::grpc::ServerContext* context, const ::chirp::DeleteRequest* request, ::chirp::DeleteReply* response) {
+  (void) context;
+  (void) request;
+  (void) response;
+  return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+}
+
+::grpc::Status KeyValueStore::Service::multiput(::grpc::ServerContext* context, const ::chirp::MultiPutRequest* request, ::chirp::MultiPutReply* response) {
+  (void) context;
+  (void) request;
+  (void) response;
+  return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+}
+
+::grpc::Status KeyValueStore::Service::multidelete(::grpc::ServerContext* context, const ::chirp::MultiDeleteRequest* request, ::chirp::MultiDeleteReply* response) {
+  (void) context;
+  (void) request;
+  (void) response;
+  return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+}
+
+::grpc::Status KeyValueStore::Service::fetch_add(::grpc::ServerContext* context, const ::chirp::FetchAddRequest* request, ::chirp::FetchAddReply* response) {
+  (void) context;
+  (void) request;
+  (void) response;
+  return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+}
+
+::grpc::Status KeyValueStore::Service::compare_and_swap(::grpc::ServerContext* context, const ::chirp::CompareAndSwapRequest* request, ::chirp::CompareAndSwapReply* response) {
+  (void) context;
+  (void) request;
+  (void) response;
+  return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+}
+
+::grpc::Status KeyValueStore::Service::write_batch(::grpc::ServerContext* context, const ::chirp::WriteBatchRequest* request, ::chirp::WriteBatchReply* response) {
+  (void) context;
+  (void) request;
+  (void) response;
+  return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+}
+
+::grpc::Status KeyValueStore::Service::scan(::grpc::ServerContext* context, const ::chirp::ScanRequest* request, ::grpc::ServerWriter< ::chirp::ScanReply>* writer) {
+  (void) context;
+  (void) request;
+  (void) writer;
+  return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+}
+
+::grpc::Status KeyValueStore::Service::list_append(::grpc::ServerContext* context, const ::chirp::ListElementRequest* request, ::chirp::ListElementReply* response) {
+  (void) context;
+  (void) request;
+  (void) response;
+  return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+}
+
+::grpc::Status KeyValueStore::Service::list_remove(::grpc::ServerContext* context, const ::chirp::ListElementRequest* request, ::chirp::ListElementReply* response) {
+  (void) context;
+  (void) request;
+  (void) response;
+  return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+}
+
+::grpc::Status KeyValueStore::Service::memory_usage(::grpc::ServerContext* context, const ::chirp::MemoryUsageRequest* request, ::chirp::MemoryUsageReply* response) {
+  (void) context;
+  (void) request;
+  (void) response;
+  return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+}
+
+::grpc::Status KeyValueStore::Service::stats(::grpc::ServerContext* context, const ::chirp::StatsRequest* request, ::chirp::StatsReply* response) {
+  (void) context;
+  (void) request;
+  (void) response;
+  return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+}
+
+::grpc::Status KeyValueStore::Service::exists(::grpc::ServerContext* context, const ::chirp::ExistsRequest* request, ::chirp::ExistsReply* response) {
+  (void) context;
+  (void) request;
+  (void) response;
+  return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+}
+
+::grpc::Status KeyValueStore::Service::create_snapshot(::grpc::ServerContext* context, const ::chirp::CreateSnapshotRequest* request, ::chirp::CreateSnapshotReply* response) {
+  (void) context;
+  (void) request;
+  (void) response;
+  return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+}
+
+::grpc::Status KeyValueStore::Service::release_snapshot(::grpc::ServerContext* context, const ::chirp::ReleaseSnapshotRequest* request, ::chirp::ReleaseSnapshotReply* response) {
+  (void) context;
+  (void) request;
+  (void) response;
+  return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+}
+
+::grpc::Status KeyValueStore::Service::changes(::grpc::ServerContext* context, const ::chirp::ChangesRequest* request, ::grpc::ServerWriter< ::chirp::ChangesReply>* writer) {
+  (void) context;
+  (void) request;
+  (void) writer;
+  return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+}
+
+::grpc::Status KeyValueStore::Service::watch(::grpc::ServerContext* context, const ::chirp::WatchRequest* request, ::grpc::ServerWriter< ::chirp::WatchReply>* writer) {
+  (void) context;
+  (void) request;
+  (void) writer;
+  return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+}
+
+
+static const char* Replication_method_names[] = {
+  "/chirp.Replication/replicate",
+};
+
+std::unique_ptr< Replication::Stub> Replication::NewStub(const std::shared_ptr< ::grpc::ChannelInterface>& channel, const ::grpc::StubOptions& options) {
+  (void)options;
+  std::unique_ptr< Replication::Stub> stub(new Replication::Stub(channel, options));
+  return stub;
+}
+
+Replication::Stub::Stub(const std::shared_ptr< ::grpc::ChannelInterface>& channel, const ::grpc::StubOptions& options)
+  : channel_(channel), rpcmethod_replicate_(Replication_method_names[0], options.suffix_for_stats(),::grpc::internal::RpcMethod::BIDI_STREAMING, channel)
+  {}
+
+::grpc::ClientReaderWriter< ::chirp::ReplicationAck, ::chirp::ReplicationBatch>* Replication::Stub::replicateRaw(::grpc::ClientContext* context) {
+  return ::grpc::internal::ClientReaderWriterFactory< ::chirp::ReplicationAck, ::chirp::ReplicationBatch>::Create(channel_.get(), rpcmethod_replicate_, context);
+}
+
+void Replication::Stub::async::replicate(::grpc::ClientContext* context, ::grpc::ClientBidiReactor< ::chirp::ReplicationAck,::chirp::ReplicationBatch>* reactor) {
+  ::grpc::internal::ClientCallbackReaderWriterFactory< ::chirp::ReplicationAck,::chirp::ReplicationBatch>::Create(stub_->channel_.get(), stub_->rpcmethod_replicate_, context, reactor);
+}
+
+::grpc::ClientAsyncReaderWriter< ::chirp::ReplicationAck, ::chirp::ReplicationBatch>* Replication::Stub::AsyncreplicateRaw(::grpc::ClientContext* context, ::grpc::CompletionQueue* cq, void* tag) {
+  return ::grpc::internal::ClientAsyncReaderWriterFactory< ::chirp::ReplicationAck, ::chirp::ReplicationBatch>::Create(channel_.get(), cq, rpcmethod_replicate_, context, true, tag);
+}
+
+::grpc::ClientAsyncReaderWriter< ::chirp::ReplicationAck, ::chirp::ReplicationBatch>* Replication::Stub::PrepareAsyncreplicateRaw(::grpc::ClientContext* context, ::grpc::CompletionQueue* cq) {
+  return ::grpc::internal::ClientAsyncReaderWriterFactory< ::chirp::ReplicationAck, ::chirp::ReplicationBatch>::Create(channel_.get(), cq, rpcmethod_replicate_, context, false, nullptr);
+}
+
+Replication::Service::Service() {
+  AddMethod(new ::grpc::internal::RpcServiceMethod(
+      Replication_method_names[0],
+      ::grpc::internal::RpcMethod::BIDI_STREAMING,
+      new ::grpc::internal::BidiStreamingHandler< Replication::Service, ::chirp::ReplicationAck, ::chirp::ReplicationBatch>(
+          [](Replication::Service* service,
+             ::grpc::ServerContext* ctx,
+             ::grpc::ServerReaderWriter<::chirp::ReplicationBatch,
+             ::chirp::ReplicationAck>* stream) {
+               return service->replicate(ctx, stream);
+             }, this)));
+}
+
+Replication::Service::~Service() {
+}
+
+::grpc::Status Replication::Service::replicate(::grpc::ServerContext* context, ::grpc::ServerReaderWriter< ::chirp::ReplicationBatch, ::chirp::ReplicationAck>* stream) {
+  (void) context;
+  (void) stream;
+  return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+}
+
+
+}  // namespace chirp
+
@@ -0,0 +1,3061 @@
+// Generated by the gRPC C++ plugin.
+// If you make any local change, they will be lost.
+// source: key_value.proto
+#ifndef GRPC_key_5fvalue_2eproto__INCLUDED
+#define GRPC_key_5fvalue_2eproto__INCLUDED
+
+#include "key_value.pb.h"
+
+#include <functional>
+#include <grpcpp/generic/async_generic_service.h>
+#include <grpcpp/support/async_stream.h>
+#include <grpcpp/support/async_unary_call.h>
+#include <grpcpp/support/client_callback.h>
+#include <grpcpp/client_context.h>
+#include <grpcpp/completion_queue.h>
+#include <grpcpp/support/message_allocator.h>
+#include <grpcpp/support/method_handler.h>
+#include <grpcpp/impl/codegen/proto_utils.h>
+#include <grpcpp/impl/rpc_method.h>
+#include <grpcpp/support/server_callback.h>
+#include <grpcpp/impl/codegen/server_callback_handlers.h>
+#include <grpcpp/server_context.h>
+#include <grpcpp/impl/service_type.h>
+#include <grpcpp/impl/codegen/status.h>
+#include <grpcpp/support/stub_options.h>
+#include <grpcpp/support/sync_stream.h>
+
+namespace chirp {
+
+class KeyValueStore final {
+ public:
+  static constexpr char const* service_full_name() {
+    return "chirp.KeyValueStore";
+  }
+  class StubInterface {
+   public:
+    virtual ~StubInterface() {}
+    virtual ::grpc::Status put(::grpc::ClientContext* context, const ::chirp::PutRequest& request, ::chirp::PutReply* response) = 0;
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::chirp::PutReply>> Asyncput(::grpc::ClientContext* context, const ::chirp::PutRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::chirp::PutReply>>(AsyncputRaw(context, request, cq));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::chirp::PutReply>> PrepareAsyncput(::grpc::ClientContext* context, const ::chirp::PutRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::chirp::PutReply>>(PrepareAsyncputRaw(context, request, cq));
+    }
+    std::unique_ptr< ::grpc::ClientReaderWriterInterface< ::chirp::GetRequest, ::chirp::GetReply>> get(::grpc::ClientContext* context) {
+      return std::unique_ptr< ::grpc::ClientReaderWriterInterface< ::chirp::GetRequest, ::chirp::GetReply>>(getRaw(context));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncReaderWriterInterface< ::chirp::GetRequest, ::chirp::GetReply>> Asyncget(::grpc::ClientContext* context, ::grpc::CompletionQueue* cq, void* tag) {
+      return std::unique_ptr< ::grpc::ClientAsyncReaderWriterInterface< ::chirp::GetRequest, ::chirp::GetReply>>(AsyncgetRaw(context, cq, tag));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncReaderWriterInterface< ::chirp::GetRequest, ::chirp::GetReply>> PrepareAsyncget(::grpc::ClientContext* context, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncReaderWriterInterface< ::chirp::GetRequest, ::chirp::GetReply>>(PrepareAsyncgetRaw(context, cq));
+    }
+    virtual ::grpc::Status deletekey(::grpc::ClientContext* context, const ::chirp::DeleteRequest& request, ::chirp::DeleteReply* response) = 0;
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::chirp::DeleteReply>> Asyncdeletekey(::grpc::ClientContext* context, const ::chirp::DeleteRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::chirp::DeleteReply>>(AsyncdeletekeyRaw(context, request, cq));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::chirp::DeleteReply>> PrepareAsyncdeletekey(::grpc::ClientContext* context, const ::chirp::DeleteRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::chirp::DeleteReply>>(PrepareAsyncdeletekeyRaw(context, request, cq));
+    }
+    virtual ::grpc::Status multiput(::grpc::ClientContext* context, const ::chirp::MultiPutRequest& request, ::chirp::MultiPutReply* response) = 0;
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::chirp::MultiPutReply>> Asyncmultiput(::grpc::ClientContext* context, const ::chirp::MultiPutRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::chirp::MultiPutReply>>(AsyncmultiputRaw(context, request, cq));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::chirp::MultiPutReply>> PrepareAsyncmultiput(::grpc::ClientContext* context, const ::chirp::MultiPutRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::chirp::MultiPutReply>>(PrepareAsyncmultiputRaw(context, request, cq));
+    }
+    virtual ::grpc::Status multidelete(::grpc::ClientContext* context, const ::chirp::MultiDeleteRequest& request, ::chirp::MultiDeleteReply* response) = 0;
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::chirp::MultiDeleteReply>> Asyncmultidelete(::grpc::ClientContext* context, const ::chirp::MultiDeleteRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::chirp::MultiDeleteReply>>(AsyncmultideleteRaw(context, request, cq));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::chirp::MultiDeleteReply>> PrepareAsyncmultidelete(::grpc::ClientContext* context, const ::chirp::MultiDeleteRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::chirp::MultiDeleteReply>>(PrepareAsyncmultideleteRaw(context, request, cq));
+    }
+    virtual ::grpc::Status fetch_add(::grpc::ClientContext* context, const ::chirp::FetchAddRequest& request, ::chirp::FetchAddReply* response) = 0;
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::chirp::FetchAddReply>> Asyncfetch_add(::grpc::ClientContext* context, const ::chirp::FetchAddRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::chirp::FetchAddReply>>(Asyncfetch_addRaw(context, request, cq));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::chirp::FetchAddReply>> PrepareAsyncfetch_add(::grpc::ClientContext* context, const ::chirp::FetchAddRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::chirp::FetchAddReply>>(PrepareAsyncfetch_addRaw(context, request, cq));
+    }
+    virtual ::grpc::Status compare_and_swap(::grpc::ClientContext* context, const ::chirp::CompareAndSwapRequest& request, ::chirp::CompareAndSwapReply* response) = 0;
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::chirp::CompareAndSwapReply>> Asynccompare_and_swap(::grpc::ClientContext* context, const ::chirp::CompareAndSwapRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::chirp::CompareAndSwapReply>>(Asynccompare_and_swapRaw(context, request, cq));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::chirp::CompareAndSwapReply>> PrepareAsynccompare_and_swap(::grpc::ClientContext* context, const ::chirp::CompareAndSwapRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::chirp::CompareAndSwapReply>>(PrepareAsynccompare_and_swapRaw(context, request, cq));
+    }
+    virtual ::grpc::Status write_batch(::grpc::ClientContext* context, const ::chirp::WriteBatchRequest& request, ::chirp::WriteBatchReply* response) = 0;
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::chirp::WriteBatchReply>> Asyncwrite_batch(::grpc::ClientContext* context, const ::chirp::WriteBatchRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::chirp::WriteBatchReply>>(Asyncwrite_batchRaw(context, request, cq));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::chirp::WriteBatchReply>> PrepareAsyncwrite_batch(::grpc::ClientContext* context, const ::chirp::WriteBatchRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::chirp::WriteBatchReply>>(PrepareAsyncwrite_batchRaw(context, request, cq));
+    }
+    std::unique_ptr< ::grpc::ClientReaderInterface< ::chirp::ScanReply>> scan(::grpc::ClientContext* context, const ::chirp::ScanRequest& request) {
+      return std::unique_ptr< ::grpc::ClientReaderInterface< ::chirp::ScanReply>>(scanRaw(context, request));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncReaderInterface< ::chirp::ScanReply>> Asyncscan(::grpc::ClientContext* context, const ::chirp::ScanRequest& request, ::grpc::CompletionQueue* cq, void* tag) {
+      return std::unique_ptr< ::grpc::ClientAsyncReaderInterface< ::chirp::ScanReply>>(AsyncscanRaw(context, request, cq, tag));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncReaderInterface< ::chirp::ScanReply>> PrepareAsyncscan(::grpc::ClientContext* context, const ::chirp::ScanRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncReaderInterface< ::chirp::ScanReply>>(PrepareAsyncscanRaw(context, request, cq));
+    }
+    virtual ::grpc::Status list_append(::grpc::ClientContext* context, const ::chirp::ListElementRequest& request, ::chirp::ListElementReply* response) = 0;
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::chirp::ListElementReply>> Asynclist_append(::grpc::ClientContext* context, const ::chirp::ListElementRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::chirp::ListElementReply>>(Asynclist_appendRaw(context, request, cq));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::chirp::ListElementReply>> PrepareAsynclist_append(::grpc::ClientContext* context, const ::chirp::ListElementRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::chirp::ListElementReply>>(PrepareAsynclist_appendRaw(context, request, cq));
+    }
+    virtual ::grpc::Status list_remove(::grpc::ClientContext* context, const ::chirp::ListElementRequest& request, ::chirp::ListElementReply* response) = 0;
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::chirp::ListElementReply>> Asynclist_remove(::grpc::ClientContext* context, const ::chirp::ListElementRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::chirp::ListElementReply>>(Asynclist_removeRaw(context, request, cq));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::chirp::ListElementReply>> PrepareAsynclist_remove(::grpc::ClientContext* context, const ::chirp::ListElementRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::chirp::ListElementReply>>(PrepareAsynclist_removeRaw(context, request, cq));
+    }
+    virtual ::grpc::Status memory_usage(::grpc::ClientContext* context, const ::chirp::MemoryUsageRequest& request, ::chirp::MemoryUsageReply* response) = 0;
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::chirp::MemoryUsageReply>> Asyncmemory_usage(::grpc::ClientContext* context, const ::chirp::MemoryUsageRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::chirp::MemoryUsageReply>>(Asyncmemory_usageRaw(context, request, cq));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::chirp::MemoryUsageReply>> PrepareAsyncmemory_usage(::grpc::ClientContext* context, const ::chirp::MemoryUsageRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::chirp::MemoryUsageReply>>(PrepareAsyncmemory_usageRaw(context, request, cq));
+    }
+    virtual ::grpc::Status stats(::grpc::ClientContext* context, const ::chirp::StatsRequest& request, ::chirp::StatsReply* response) = 0;
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::chirp::StatsReply>> Asyncstats(::grpc::ClientContext* context, const ::chirp::StatsRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::chirp::StatsReply>>(AsyncstatsRaw(context, request, cq));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::chirp::StatsReply>> PrepareAsyncstats(::grpc::ClientContext* context, const ::chirp::StatsRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::chirp::StatsReply>>(PrepareAsyncstatsRaw(context, request, cq));
+    }
+    virtual ::grpc::Status exists(::grpc::ClientContext* context, const ::chirp::ExistsRequest& request, ::chirp::ExistsReply* response) = 0;
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::chirp::ExistsReply>> Asyncexists(::grpc::ClientContext* context, const ::chirp::ExistsRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::chirp::ExistsReply>>(AsyncexistsRaw(context, request, cq));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::chirp::ExistsReply>> PrepareAsyncexists(::grpc::ClientContext* context, const ::chirp::ExistsRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::chirp::ExistsReply>>(PrepareAsyncexistsRaw(context, request, cq));
+    }
+    virtual ::grpc::Status create_snapshot(::grpc::ClientContext* context, const ::chirp::CreateSnapshotRequest& request, ::chirp::CreateSnapshotReply* response) = 0;
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::chirp::CreateSnapshotReply>> Asynccreate_snapshot(::grpc::ClientContext* context, const ::chirp::CreateSnapshotRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::chirp::CreateSnapshotReply>>(Asynccreate_snapshotRaw(context, request, cq));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::chirp::CreateSnapshotReply>> PrepareAsynccreate_snapshot(::grpc::ClientContext* context, const ::chirp::CreateSnapshotRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::chirp::CreateSnapshotReply>>(PrepareAsynccreate_snapshotRaw(context, request, cq));
+    }
+    virtual ::grpc::Status release_snapshot(::grpc::ClientContext* context, const ::chirp::ReleaseSnapshotRequest& request, ::chirp::ReleaseSnapshotReply* response) = 0;
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::chirp::ReleaseSnapshotReply>> Asyncrelease_snapshot(::grpc::ClientContext* context, const ::chirp::ReleaseSnapshotRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::chirp::ReleaseSnapshotReply>>(Asyncrelease_snapshotRaw(context, request, cq));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::chirp::ReleaseSnapshotReply>> PrepareAsyncrelease_snapshot(::grpc::ClientContext* context, const ::chirp::ReleaseSnapshotRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::chirp::ReleaseSnapshotReply>>(PrepareAsyncrelease_snapshotRaw(context, request, cq));
+    }
+    std::unique_ptr< ::grpc::ClientReaderInterface< ::chirp::ChangesReply>> changes(::grpc::ClientContext* context, const ::chirp::ChangesRequest& request) {
+      return std::unique_ptr< ::grpc::ClientReaderInterface< ::chirp::ChangesReply>>(changesRaw(context, request));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncReaderInterface< ::chirp::ChangesReply>> Asyncchanges(::grpc::ClientContext* context, const ::chirp::ChangesRequest& request, ::grpc::CompletionQueue* cq, void* tag) {
+      return std::unique_ptr< ::grpc::ClientAsyncReaderInterface< ::chirp::ChangesReply>>(AsyncchangesRaw(context, request, cq, tag));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncReaderInterface< ::chirp::ChangesReply>> PrepareAsyncchanges(::grpc::ClientContext* context, const ::chirp::ChangesRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncReaderInterface< ::chirp::ChangesReply>>(PrepareAsyncchangesRaw(context, request, cq));
+    }
+    std::unique_ptr< ::grpc::ClientReaderInterface< ::chirp::WatchReply>> watch(::grpc::ClientContext* context, const ::chirp::WatchRequest& request) {
+      return std::unique_ptr< ::grpc::ClientReaderInterface< ::chirp::WatchReply>>(watchRaw(context, request));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncReaderInterface< ::chirp::WatchReply>> Asyncwatch(::grpc::ClientContext* context, const ::chirp::WatchRequest& request, ::grpc::CompletionQueue* cq, void* tag) {
+      return std::unique_ptr< ::grpc::ClientAsyncReaderInterface< ::chirp::WatchReply>>(AsyncwatchRaw(context, request, cq, tag));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncReaderInterface< ::chirp::WatchReply>> PrepareAsyncwatch(::grpc::ClientContext* context, const ::chirp::WatchRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncReaderInterface< ::chirp::WatchReply>>(PrepareAsyncwatchRaw(context, request, cq));
+    }
+    class async_interface {
+     public:
+      virtual ~async_interface() {}
+      virtual void put(::grpc::ClientContext* context, const ::chirp::PutRequest* request, ::chirp::PutReply* response, std::function<void(::grpc::Status)>) = 0;
+      virtual void put(::grpc::ClientContext* context, const ::chirp::PutRequest* request, ::chirp::PutReply* response, ::grpc::ClientUnaryReactor* reactor) = 0;
+      virtual void get(::grpc::ClientContext* context, ::grpc::ClientBidiReactor< ::chirp::GetRequest,::chirp::GetReply>* reactor) = 0;
+      virtual void deletekey(::grpc::ClientContext* context, const ::chirp::DeleteRequest* request, ::chirp::DeleteReply* response, std::function<void(::grpc::Status)>) = 0;
+      virtual void deletekey(::grpc::ClientContext* context, const ::chirp::DeleteRequest* request, ::chirp::DeleteReply* response, ::grpc::ClientUnaryReactor* reactor) = 0;
+      virtual void multiput(::grpc::ClientContext* context, const ::chirp::MultiPutRequest* request, ::chirp::MultiPutReply* response, std::function<void(::grpc::Status)>) = 0;
+      virtual void multiput(::grpc::ClientContext* context, const ::chirp::MultiPutRequest* request, ::chirp::MultiPutReply* response, ::grpc::ClientUnaryReactor* reactor) = 0;
+      virtual void multidelete(::grpc::ClientContext* context, const ::chirp::MultiDeleteRequest* request, ::chirp::MultiDeleteReply* response, std::function<void(::grpc::Status)>) = 0;
+      virtual void multidelete(::grpc::ClientContext* context, const ::chirp::MultiDeleteRequest* request, ::chirp::MultiDeleteReply* response, ::grpc::ClientUnaryReactor* reactor) = 0;
+      virtual void fetch_add(::grpc::ClientContext* context, const ::chirp::FetchAddRequest* request, ::chirp::FetchAddReply* response, std::function<void(::grpc::Status)>) = 0;
+      virtual void fetch_add(::grpc::ClientContext* context, const ::chirp::FetchAddRequest* request, ::chirp::FetchAddReply* response, ::grpc::ClientUnaryReactor* reactor) = 0;
+      virtual void compare_and_swap(::grpc::ClientContext* context, const ::chirp::CompareAndSwapRequest* request, ::chirp::CompareAndSwapReply* response, std::function<void(::grpc::Status)>) = 0;
+      virtual void compare_and_swap(::grpc::ClientContext* context, const ::chirp::CompareAndSwapRequest* request, ::chirp::CompareAndSwapReply* response, ::grpc::ClientUnaryReactor* reactor) = 0;
+      virtual void write_batch(::grpc::ClientContext* context, const ::chirp::WriteBatchRequest* request, ::chirp::WriteBatchReply* response, std::function<void(::grpc::Status)>) = 0;
+      virtual void write_batch(::grpc::ClientContext* context, const ::chirp::WriteBatchRequest* request, ::chirp::WriteBatchReply* response, ::grpc::ClientUnaryReactor* reactor) = 0;
+      virtual void scan(::grpc::ClientContext* context, const ::chirp::ScanRequest* request, ::grpc::ClientReadReactor< ::chirp::ScanReply>* reactor) = 0;
+      virtual void list_append(::grpc::ClientContext* context, const ::chirp::ListElementRequest* request, ::chirp::ListElementReply* response, std::function<void(::grpc::Status)>) = 0;
+      virtual void list_append(::grpc::ClientContext* context, const ::chirp::ListElementRequest* request, ::chirp::ListElementReply* response, ::grpc::ClientUnaryReactor* reactor) = 0;
+      virtual void list_remove(::grpc::ClientContext* context, const ::chirp::ListElementRequest* request, ::chirp::ListElementReply* response, std::function<void(::grpc::Status)>) = 0;
+      virtual void list_remove(::grpc::ClientContext* context, const ::chirp::ListElementRequest* request, ::chirp::ListElementReply* response, ::grpc::ClientUnaryReactor* reactor) = 0;
+      virtual void memory_usage(::grpc::ClientContext* context, const ::chirp::MemoryUsageRequest* request, ::chirp::MemoryUsageReply* response, std::function<void(::grpc::Status)>) = 0;
+      virtual void memory_usage(::grpc::ClientContext* context, const ::chirp::MemoryUsageRequest* request, ::chirp::MemoryUsageReply* response, ::grpc::ClientUnaryReactor* reactor) = 0;
+      virtual void stats(::grpc::ClientContext* context, const ::chirp::StatsRequest* request, ::chirp::StatsReply* response, std::function<void(::grpc::Status)>) = 0;
+      virtual void stats(::grpc::ClientContext* context, const ::chirp::StatsRequest* request, ::chirp::StatsReply* response, ::grpc::ClientUnaryReactor* reactor) = 0;
+      virtual void exists(::grpc::ClientContext* context, const ::chirp::ExistsRequest* request, ::chirp::ExistsReply* response, std::function<void(::grpc::Status)>) = 0;
+      virtual void exists(::grpc::ClientContext* context, const ::chirp::ExistsRequest* request, ::chirp::ExistsReply* response, ::grpc::ClientUnaryReactor* reactor) = 0;
+      virtual void create_snapshot(::grpc::ClientContext* context, const ::chirp::CreateSnapshotRequest* request, ::chirp::CreateSnapshotReply* response, std::function<void(::grpc::Status)>) = 0;
+      virtual void create_snapshot(::grpc::ClientContext* context, const ::chirp::CreateSnapshotRequest* request, ::chirp::CreateSnapshotReply* response, ::grpc::ClientUnaryReactor* reactor) = 0;
+      virtual void release_snapshot(::grpc::ClientContext* context, const ::chirp::ReleaseSnapshotRequest* request, ::chirp::ReleaseSnapshotReply* response, std::function<void(::grpc::Status)>) = 0;
+      virtual void release_snapshot(::grpc::ClientContext* context, const ::chirp::ReleaseSnapshotRequest* request, ::chirp::ReleaseSnapshotReply* response, ::grpc::ClientUnaryReactor* reactor) = 0;
+      virtual void changes(::grpc::ClientContext* context, const ::chirp::ChangesRequest* request, ::grpc::ClientReadReactor< ::chirp::ChangesReply>* reactor) = 0;
+      virtual void watch(::grpc::ClientContext* context, const ::chirp::WatchRequest* request, ::grpc::ClientReadReactor< ::chirp::WatchReply>* reactor) = 0;
+    };
+    typedef class async_interface experimental_async_interface;
+    virtual class async_interface* async() { return nullptr; }
+    class async_interface* experimental_async() { return async(); }
+   private:
+    virtual ::grpc::ClientAsyncResponseReaderInterface< ::chirp::PutReply>* AsyncputRaw(::grpc::ClientContext* context, const ::chirp::PutRequest& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientAsyncResponseReaderInterface< ::chirp::PutReply>* PrepareAsyncputRaw(::grpc::ClientContext* context, const ::chirp::PutRequest& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientReaderWriterInterface< ::chirp::GetRequest, ::chirp::GetReply>* getRaw(::grpc::ClientContext* context) = 0;
+    virtual ::grpc::ClientAsyncReaderWriterInterface< ::chirp::GetRequest, ::chirp::GetReply>* AsyncgetRaw(::grpc::ClientContext* context, ::grpc::CompletionQueue* cq, void* tag) = 0;
+    virtual ::grpc::ClientAsyncReaderWriterInterface< ::chirp::GetRequest, ::chirp::GetReply>* PrepareAsyncgetRaw(::grpc::ClientContext* context, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientAsyncResponseReaderInterface< ::chirp::DeleteReply>* AsyncdeletekeyRaw(::grpc::ClientContext* context, const ::chirp::DeleteRequest& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientAsyncResponseReaderInterface< ::chirp::DeleteReply>* PrepareAsyncdeletekeyRaw(::grpc::ClientContext* context, const ::chirp::DeleteRequest& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientAsyncResponseReaderInterface< ::chirp::MultiPutReply>* AsyncmultiputRaw(::grpc::ClientContext* context, const ::chirp::MultiPutRequest& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientAsyncResponseReaderInterface< ::chirp::MultiPutReply>* PrepareAsyncmultiputRaw(::grpc::ClientContext* context, const ::chirp::MultiPutRequest& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientAsyncResponseReaderInterface< ::chirp::MultiDeleteReply>* AsyncmultideleteRaw(::grpc::ClientContext* context, const ::chirp::MultiDeleteRequest& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientAsyncResponseReaderInterface< ::chirp::MultiDeleteReply>* PrepareAsyncmultideleteRaw(::grpc::ClientContext* context, const ::chirp::MultiDeleteRequest& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientAsyncResponseReaderInterface< ::chirp::FetchAddReply>* Asyncfetch_addRaw(::grpc::ClientContext* context, const ::chirp::FetchAddRequest& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientAsyncResponseReaderInterface< ::chirp::FetchAddReply>* PrepareAsyncfetch_addRaw(::grpc::ClientContext* context, const ::chirp::FetchAddRequest& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientAsyncResponseReaderInterface< ::chirp::CompareAndSwapReply>* Asynccompare_and_swapRaw(::grpc::ClientContext* context, const ::chirp::CompareAndSwapRequest& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientAsyncResponseReaderInterface< ::chirp::CompareAndSwapReply>* PrepareAsynccompare_and_swapRaw(::grpc::ClientContext* context, const ::chirp::CompareAndSwapRequest& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientAsyncResponseReaderInterface< ::chirp::WriteBatchReply>* Asyncwrite_batchRaw(::grpc::ClientContext* context, const ::chirp::WriteBatchRequest& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientAsyncResponseReaderInterface< ::chirp::WriteBatchReply>* PrepareAsyncwrite_batchRaw(::grpc::ClientContext* context, const ::chirp::WriteBatchRequest& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientReaderInterface< ::chirp::ScanReply>* scanRaw(::grpc::ClientContext* context, const ::chirp::ScanRequest& request) = 0;
+    virtual ::grpc::ClientAsyncReaderInterface< ::chirp::ScanReply>* AsyncscanRaw(::grpc::ClientContext* context, const ::chirp::ScanRequest& request, ::grpc::CompletionQueue* cq, void* tag) = 0;
+    virtual ::grpc::ClientAsyncReaderInterface< ::chirp::ScanReply>* PrepareAsyncscanRaw(::grpc::ClientContext* context, const ::chirp::ScanRequest& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientAsyncResponseReaderInterface< ::chirp::ListElementReply>* Asynclist_appendRaw(::grpc::ClientContext* context, const ::chirp::ListElementRequest& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientAsyncResponseReaderInterface< ::chirp::ListElementReply>* PrepareAsynclist_appendRaw(::grpc::ClientContext* context, const ::chirp::ListElementRequest& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientAsyncResponseReaderInterface< ::chirp::ListElementReply>* Asynclist_removeRaw(::grpc::ClientContext* context, const ::chirp::ListElementRequest& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientAsyncResponseReaderInterface< ::chirp::ListElementReply>* PrepareAsynclist_removeRaw(::grpc::ClientContext* context, const ::chirp::ListElementRequest& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientAsyncResponseReaderInterface< ::chirp::MemoryUsageReply>* Asyncmemory_usageRaw(::grpc::ClientContext* context, const ::chirp::MemoryUsageRequest& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientAsyncResponseReaderInterface< ::chirp::MemoryUsageReply>* PrepareAsyncmemory_usageRaw(::grpc::ClientContext* context, const ::chirp::MemoryUsageRequest& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientAsyncResponseReaderInterface< ::chirp::StatsReply>* AsyncstatsRaw(::grpc::ClientContext* context, const ::chirp::StatsRequest& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientAsyncResponseReaderInterface< ::chirp::StatsReply>* PrepareAsyncstatsRaw(::grpc::ClientContext* context, const ::chirp::StatsRequest& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientAsyncResponseReaderInterface< ::chirp::ExistsReply>* AsyncexistsRaw(::grpc::ClientContext* context, const ::chirp::ExistsRequest& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientAsyncResponseReaderInterface< ::chirp::ExistsReply>* PrepareAsyncexistsRaw(::grpc::ClientContext* context, const ::chirp::ExistsRequest& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientAsyncResponseReaderInterface< ::chirp::CreateSnapshotReply>* Asynccreate_snapshotRaw(::grpc::ClientContext* context, const ::chirp::CreateSnapshotRequest& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientAsyncResponseReaderInterface< ::chirp::CreateSnapshotReply>* PrepareAsynccreate_snapshotRaw(::grpc::ClientContext* context, const ::chirp::CreateSnapshotRequest& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientAsyncResponseReaderInterface< ::chirp::ReleaseSnapshotReply>* Asyncrelease_snapshotRaw(::grpc::ClientContext* context, const ::chirp::ReleaseSnapshotRequest& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientAsyncResponseReaderInterface< ::chirp::ReleaseSnapshotReply>* PrepareAsyncrelease_snapshotRaw(::grpc::ClientContext* context, const ::chirp::ReleaseSnapshotRequest& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientReaderInterface< ::chirp::ChangesReply>* changesRaw(::grpc::ClientContext* context, const ::chirp::ChangesRequest& request) = 0;
+    virtual ::grpc::ClientAsyncReaderInterface< ::chirp::ChangesReply>* AsyncchangesRaw(::grpc::ClientContext* context, const ::chirp::ChangesRequest& request, ::grpc::CompletionQueue* cq, void* tag) = 0;
+    virtual ::grpc::ClientAsyncReaderInterface< ::chirp::ChangesReply>* PrepareAsyncchangesRaw(::grpc::ClientContext* context, const ::chirp::ChangesRequest& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientReaderInterface< ::chirp::WatchReply>* watchRaw(::grpc::ClientContext* context, const ::chirp::WatchRequest& request) = 0;
+    virtual ::grpc::ClientAsyncReaderInterface< ::chirp::WatchReply>* AsyncwatchRaw(::grpc::ClientContext* context, const ::chirp::WatchRequest& request, ::grpc::CompletionQueue* cq, void* tag) = 0;
+    virtual ::grpc::ClientAsyncReaderInterface< ::chirp::WatchReply>* PrepareAsyncwatchRaw(::grpc::ClientContext* context, const ::chirp::WatchRequest& request, ::grpc::CompletionQueue* cq) = 0;
+  };
+  class Stub final : public StubInterface {
+   public:
+    Stub(const std::shared_ptr< ::grpc::ChannelInterface>& channel, const ::grpc::StubOptions& options = ::grpc::StubOptions());
+    ::grpc::Status put(::grpc::ClientContext* context, const ::chirp::PutRequest& request, ::chirp::PutReply* response) override;
+    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::chirp::PutReply>> Asyncput(::grpc::ClientContext* context, const ::chirp::PutRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::chirp::PutReply>>(AsyncputRaw(context, request, cq));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::chirp::PutReply>> PrepareAsyncput(::grpc::ClientContext* context, const ::chirp::PutRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::chirp::PutReply>>(PrepareAsyncputRaw(context, request, cq));
+    }
+    std::unique_ptr< ::grpc::ClientReaderWriter< ::chirp::GetRequest, ::chirp::GetReply>> get(::grpc::ClientContext* context) {
+      return std::unique_ptr< ::grpc::ClientReaderWriter< ::chirp::GetRequest, ::chirp::GetReply>>(getRaw(context));
+    }
+    std::unique_ptr<  ::grpc::ClientAsyncReaderWriter< ::chirp::GetRequest, ::chirp::GetReply>> Asyncget(::grpc::ClientContext* context, ::grpc::CompletionQueue* cq, void* tag) {
+      return std::unique_ptr< ::grpc::ClientAsyncReaderWriter< ::chirp::GetRequest, ::chirp::GetReply>>(AsyncgetRaw(context, cq, tag));
+    }
+    std::unique_ptr<  ::grpc::ClientAsyncReaderWriter< ::chirp::GetRequest, ::chirp::GetReply>> PrepareAsyncget(::grpc::ClientContext* context, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncReaderWriter< ::chirp::GetRequest, ::chirp::GetReply>>(PrepareAsyncgetRaw(context, cq));
+    }
+    ::grpc::Status deletekey(::grpc::ClientContext* context, const ::chirp::DeleteRequest& request, ::chirp::DeleteReply* response) override;
+    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::chirp::DeleteReply>> Asyncdeletekey(::grpc::ClientContext* context, const ::chirp::DeleteRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::chirp::DeleteReply>>(AsyncdeletekeyRaw(context, request, cq));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::chirp::DeleteReply>> PrepareAsyncdeletekey(::grpc::ClientContext* context, const ::chirp::DeleteRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::chirp::DeleteReply>>(PrepareAsyncdeletekeyRaw(context, request, cq));
+    }
+    ::grpc::Status multiput(::grpc::ClientContext* context, const ::chirp::MultiPutRequest& request, ::chirp::MultiPutReply* response) override;
+    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::chirp::MultiPutReply>> Asyncmultiput(::grpc::ClientContext* context, const ::chirp::MultiPutRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::chirp::MultiPutReply>>(AsyncmultiputRaw(context, request, cq));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::chirp::MultiPutReply>> PrepareAsyncmultiput(::grpc::ClientContext* context, const ::chirp::MultiPutRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::chirp::MultiPutReply>>(PrepareAsyncmultiputRaw(context, request, cq));
+    }
+    ::grpc::Status multidelete(::grpc::ClientContext* context, const ::chirp::MultiDeleteRequest& request, ::chirp::MultiDeleteReply* response) override;
+    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::chirp::MultiDeleteReply>> Asyncmultidelete(::grpc::ClientContext* context, const ::chirp::MultiDeleteRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::chirp::MultiDeleteReply>>(AsyncmultideleteRaw(context, request, cq));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::chirp::MultiDeleteReply>> PrepareAsyncmultidelete(::grpc::ClientContext* context, const ::chirp::MultiDeleteRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::chirp::MultiDeleteReply>>(PrepareAsyncmultideleteRaw(context, request, cq));
+    }
+    ::grpc::Status fetch_add(::grpc::ClientContext* context, const ::chirp::FetchAddRequest& request, ::chirp::FetchAddReply* response) override;
+    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::chirp::FetchAddReply>> Asyncfetch_add(::grpc::ClientContext* context, const ::chirp::FetchAddRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::chirp::FetchAddReply>>(Asyncfetch_addRaw(context, request, cq));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::chirp::FetchAddReply>> PrepareAsyncfetch_add(::grpc::ClientContext* context, const ::chirp::FetchAddRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::chirp::FetchAddReply>>(PrepareAsyncfetch_addRaw(context, request, cq));
+    }
+    ::grpc::Status compare_and_swap(::grpc::ClientContext* context, const ::chirp::CompareAndSwapRequest& request, ::chirp::CompareAndSwapReply* response) override;
+    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::chirp::CompareAndSwapReply>> Asynccompare_and_swap(::grpc::ClientContext* context, const ::chirp::CompareAndSwapRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::chirp::CompareAndSwapReply>>(Asynccompare_and_swapRaw(context, request, cq));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::chirp::CompareAndSwapReply>> PrepareAsynccompare_and_swap(::grpc::ClientContext* context, const ::chirp::CompareAndSwapRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::chirp::CompareAndSwapReply>>(PrepareAsynccompare_and_swapRaw(context, request, cq));
+    }
+    ::grpc::Status write_batch(::grpc::ClientContext* context, const ::chirp::WriteBatchRequest& request, ::chirp::WriteBatchReply* response) override;
+    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::chirp::WriteBatchReply>> Asyncwrite_batch(::grpc::ClientContext* context, const ::chirp::WriteBatchRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::chirp::WriteBatchReply>>(Asyncwrite_batchRaw(context, request, cq));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::chirp::WriteBatchReply>> PrepareAsyncwrite_batch(::grpc::ClientContext* context, const ::chirp::WriteBatchRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::chirp::WriteBatchReply>>(PrepareAsyncwrite_batchRaw(context, request, cq));
+    }
+    std::unique_ptr< ::grpc::ClientReader< ::chirp::ScanReply>> scan(::grpc::ClientContext* context, const ::chirp::ScanRequest& request) {
+      return std::unique_ptr< ::grpc::ClientReader< ::chirp::ScanReply>>(scanRaw(context, request));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncReader< ::chirp::ScanReply>> Asyncscan(::grpc::ClientContext* context, const ::chirp::ScanRequest& request, ::grpc::CompletionQueue* cq, void* tag) {
+      return std::unique_ptr< ::grpc::ClientAsyncReader< ::chirp::ScanReply>>(AsyncscanRaw(context, request, cq, tag));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncReader< ::chirp::ScanReply>> PrepareAsyncscan(::grpc::ClientContext* context, const ::chirp::ScanRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncReader< ::chirp::ScanReply>>(PrepareAsyncscanRaw(context, request, cq));
+    }
+    ::grpc::Status list_append(::grpc::ClientContext* context, const ::chirp::ListElementRequest& request, ::chirp::ListElementReply* response) override;
+    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::chirp::ListElementReply>> Asynclist_append(::grpc::ClientContext* context, const ::chirp::ListElementRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::chirp::ListElementReply>>(Asynclist_appendRaw(context, request, cq));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::chirp::ListElementReply>> PrepareAsynclist_append(::grpc::ClientContext* context, const ::chirp::ListElementRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::chirp::ListElementReply>>(PrepareAsynclist_appendRaw(context, request, cq));
+    }
+    ::grpc::Status list_remove(::grpc::ClientContext* context, const ::chirp::ListElementRequest& request, ::chirp::ListElementReply* response) override;
+    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::chirp::ListElementReply>> Asynclist_remove(::grpc::ClientContext* context, const ::chirp::ListElementRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::chirp::ListElementReply>>(Asynclist_removeRaw(context, request, cq));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::chirp::ListElementReply>> PrepareAsynclist_remove(::grpc::ClientContext* context, const ::chirp::ListElementRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::chirp::ListElementReply>>(PrepareAsynclist_removeRaw(context, request, cq));
+    }
+    ::grpc::Status memory_usage(::grpc::ClientContext* context, const ::chirp::MemoryUsageRequest& request, ::chirp::MemoryUsageReply* response) override;
+    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::chirp::MemoryUsageReply>> Asyncmemory_usage(::grpc::ClientContext* context, const ::chirp::MemoryUsageRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::chirp::MemoryUsageReply>>(Asyncmemory_usageRaw(context, request, cq));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::chirp::MemoryUsageReply>> PrepareAsyncmemory_usage(::grpc::ClientContext* context, const ::chirp::MemoryUsageRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::chirp::MemoryUsageReply>>(PrepareAsyncmemory_usageRaw(context, request, cq));
+    }
+    ::grpc::Status stats(::grpc::ClientContext* context, const ::chirp::StatsRequest& request, ::chirp::StatsReply* response) override;
+    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::chirp::StatsReply>> Asyncstats(::grpc::ClientContext* context, const ::chirp::StatsRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::chirp::StatsReply>>(AsyncstatsRaw(context, request, cq));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::chirp::StatsReply>> PrepareAsyncstats(::grpc::ClientContext* context, const ::chirp::StatsRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::chirp::StatsReply>>(PrepareAsyncstatsRaw(context, request, cq));
+    }
+    ::grpc::Status exists(::grpc::ClientContext* context, const ::chirp::ExistsRequest& request, ::chirp::ExistsReply* response) override;
+    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::chirp::ExistsReply>> Asyncexists(::grpc::ClientContext* context, const ::chirp::ExistsRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::chirp::ExistsReply>>(AsyncexistsRaw(context, request, cq));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::chirp::ExistsReply>> PrepareAsyncexists(::grpc::ClientContext* context, const ::chirp::ExistsRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::chirp::ExistsReply>>(PrepareAsyncexistsRaw(context, request, cq));
+    }
+    ::grpc::Status create_snapshot(::grpc::ClientContext* context, const ::chirp::CreateSnapshotRequest& request, ::chirp::CreateSnapshotReply* response) override;
+    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::chirp::CreateSnapshotReply>> Asynccreate_snapshot(::grpc::ClientContext* context, const ::chirp::CreateSnapshotRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::chirp::CreateSnapshotReply>>(Asynccreate_snapshotRaw(context, request, cq));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::chirp::CreateSnapshotReply>> PrepareAsynccreate_snapshot(::grpc::ClientContext* context, const ::chirp::CreateSnapshotRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::chirp::CreateSnapshotReply>>(PrepareAsynccreate_snapshotRaw(context, request, cq));
+    }
+    ::grpc::Status release_snapshot(::grpc::ClientContext* context, const ::chirp::ReleaseSnapshotRequest& request, ::chirp::ReleaseSnapshotReply* response) override;
+    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::chirp::ReleaseSnapshotReply>> Asyncrelease_snapshot(::grpc::ClientContext* context, const ::chirp::ReleaseSnapshotRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::chirp::ReleaseSnapshotReply>>(Asyncrelease_snapshotRaw(context, request, cq));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::chirp::ReleaseSnapshotReply>> PrepareAsyncrelease_snapshot(::grpc::ClientContext* context, const ::chirp::ReleaseSnapshotRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::chirp::ReleaseSnapshotReply>>(PrepareAsyncrelease_snapshotRaw(context, request, cq));
+    }
+    std::unique_ptr< ::grpc::ClientReader< ::chirp::ChangesReply>> changes(::grpc::ClientContext* context, const ::chirp::ChangesRequest& request) {
+      return std::unique_ptr< ::grpc::ClientReader< ::chirp::ChangesReply>>(changesRaw(context, request));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncReader< ::chirp::ChangesReply>> Asyncchanges(::grpc::ClientContext* context, const ::chirp::ChangesRequest& request, ::grpc::CompletionQueue* cq, void* tag) {
+      return std::unique_ptr< ::grpc::ClientAsyncReader< ::chirp::ChangesReply>>(AsyncchangesRaw(context, request, cq, tag));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncReader< ::chirp::ChangesReply>> PrepareAsyncchanges(::grpc::ClientContext* context, const ::chirp::ChangesRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncReader< ::chirp::ChangesReply>>(PrepareAsyncchangesRaw(context, request, cq));
+    }
+    std::unique_ptr< ::grpc::ClientReader< ::chirp::WatchReply>> watch(::grpc::ClientContext* context, const ::chirp::WatchRequest& request) {
+      return std::unique_ptr< ::grpc::ClientReader< ::chirp::WatchReply>>(watchRaw(context, request));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncReader< ::chirp::WatchReply>> Asyncwatch(::grpc::ClientContext* context, const ::chirp::WatchRequest& request, ::grpc::CompletionQueue* cq, void* tag) {
+      return std::unique_ptr< ::grpc::ClientAsyncReader< ::chirp::WatchReply>>(AsyncwatchRaw(context, request, cq, tag));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncReader< ::chirp::WatchReply>> PrepareAsyncwatch(::grpc::ClientContext* context, const ::chirp::WatchRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncReader< ::chirp::WatchReply>>(PrepareAsyncwatchRaw(context, request, cq));
+    }
+    class async final :
+      public StubInterface::async_interface {
+     public:
+      void put(::grpc::ClientContext* context, const ::chirp::PutRequest* request, ::chirp::PutReply* response, std::function<void(::grpc::Status)>) override;
+      void put(::grpc::ClientContext* context, const ::chirp::PutRequest* request, ::chirp::PutReply* response, ::grpc::ClientUnaryReactor* reactor) override;
+      void get(::grpc::ClientContext* context, ::grpc::ClientBidiReactor< ::chirp::GetRequest,::chirp::GetReply>* reactor) override;
+      void deletekey(::grpc::ClientContext* context, const ::chirp::DeleteRequest* request, ::chirp::DeleteReply* response, std::function<void(::grpc::Status)>) override;
+      void deletekey(::grpc::ClientContext* context, const ::chirp::DeleteRequest* request, ::chirp::DeleteReply* response, ::grpc::ClientUnaryReactor* reactor) override;
+      void multiput(::grpc::ClientContext* context, const ::chirp::MultiPutRequest* request, ::chirp::MultiPutReply* response, std::function<void(::grpc::Status)>) override;
+      void multiput(::grpc::ClientContext* context, const ::chirp::MultiPutRequest* request, ::chirp::MultiPutReply* response, ::grpc::ClientUnaryReactor* reactor) override;
+      void multidelete(::grpc::ClientContext* context, const ::chirp::MultiDeleteRequest* request, ::chirp::MultiDeleteReply* response, std::function<void(::grpc::Status)>) override;
+      void multidelete(::grpc::ClientContext* context, const ::chirp::MultiDeleteRequest* request, ::chirp::MultiDeleteReply* response, ::grpc::ClientUnaryReactor* reactor) override;
+      void fetch_add(::grpc::ClientContext* context, const ::chirp::FetchAddRequest* request, ::chirp::FetchAddReply* response, std::function<void(::grpc::Status)>) override;
+      void fetch_add(::grpc::ClientContext* context, const ::chirp::FetchAddRequest* request, ::chirp::FetchAddReply* response, ::grpc::ClientUnaryReactor* reactor) override;
+      void compare_and_swap(::grpc::ClientContext* context, const ::chirp::CompareAndSwapRequest* request, ::chirp::CompareAndSwapReply* response, std::function<void(::grpc::Status)>) override;
+      void compare_and_swap(::grpc::ClientContext* context, const ::chirp::CompareAndSwapRequest* request, ::chirp::CompareAndSwapReply* response, ::grpc::ClientUnaryReactor* reactor) override;
+      void write_batch(::grpc::ClientContext* context, const ::chirp::WriteBatchRequest* request, ::chirp::WriteBatchReply* response, std::function<void(::grpc::Status)>) override;
+      void write_batch(::grpc::ClientContext* context, const ::chirp::WriteBatchRequest* request, ::chirp::WriteBatchReply* response, ::grpc::ClientUnaryReactor* reactor) override;
+      void scan(::grpc::ClientContext* context, const ::chirp::ScanRequest* request, ::grpc::ClientReadReactor< ::chirp::ScanReply>* reactor) override;
+      void list_append(::grpc::ClientContext* context, const ::chirp::ListElementRequest* request, ::chirp::ListElementReply* response, std::function<void(::grpc::Status)>) override;
+      void list_append(::grpc::ClientContext* context, const ::chirp::ListElementRequest* request, ::chirp::ListElementReply* response, ::grpc::ClientUnaryReactor* reactor) override;
+      void list_remove(::grpc::ClientContext* context, const ::chirp::ListElementRequest* request, ::chirp::ListElementReply* response, std::function<void(::grpc::Status)>) override;
+      void list_remove(::grpc::ClientContext* context, const ::chirp::ListElementRequest* request, ::chirp::ListElementReply* response, ::grpc::ClientUnaryReactor* reactor) override;
+      void memory_usage(::grpc::ClientContext* context, const ::chirp::MemoryUsageRequest* request, ::chirp::MemoryUsageReply* response, std::function<void(::grpc::Status)>) override;
+      void memory_usage(::grpc::ClientContext* context, const ::chirp::MemoryUsageRequest* request, ::chirp::MemoryUsageReply* response, ::grpc::ClientUnaryReactor* reactor) override;
+      void stats(::grpc::ClientContext* context, const ::chirp::StatsRequest* request, ::chirp::StatsReply* response, std::function<void(::grpc::Status)>) override;
+      void stats(::grpc::ClientContext* context, const ::chirp::StatsRequest* request, ::chirp::StatsReply* response, ::grpc::ClientUnaryReactor* reactor) override;
+      void exists(::grpc::ClientContext* context, const ::chirp::ExistsRequest* request, ::chirp::ExistsReply* response, std::function<void(::grpc::Status)>) override;
+      void exists(::grpc::ClientContext* context, const ::chirp::ExistsRequest* request, ::chirp::ExistsReply* response, ::grpc::ClientUnaryReactor* reactor) override;
+      void create_snapshot(::grpc::ClientContext* context, const ::chirp::CreateSnapshotRequest* request, ::chirp::CreateSnapshotReply* response, std::function<void(::grpc::Status)>) override;
+      void create_snapshot(::grpc::ClientContext* context, const ::chirp::CreateSnapshotRequest* request, ::chirp::CreateSnapshotReply* response, ::grpc::ClientUnaryReactor* reactor) override;
+      void release_snapshot(::grpc::ClientContext* context, const ::chirp::ReleaseSnapshotRequest* request, ::chirp::ReleaseSnapshotReply* response, std::function<void(::grpc::Status)>) override;
+      void release_snapshot(::grpc::ClientContext* context, const ::chirp::ReleaseSnapshotRequest* request, ::chirp::ReleaseSnapshotReply* response, ::grpc::ClientUnaryReactor* reactor) override;
+      void changes(::grpc::ClientContext* context, const ::chirp::ChangesRequest* request, ::grpc::ClientReadReactor< ::chirp::ChangesReply>* reactor) override;
+      void watch(::grpc::ClientContext* context, const ::chirp::WatchRequest* request, ::grpc::ClientReadReactor< ::chirp::WatchReply>* reactor) override;
+     private:
+      friend class Stub;
+      explicit async(Stub* stub): stub_(stub) { }
+      Stub* stub() { return stub_; }
+      Stub* stub_;
+    };
+    class async* async() override { return &async_stub_; }
+
+   private:
+    std::shared_ptr< ::grpc::ChannelInterface> channel_;
+    class async async_stub_{this};
+    ::grpc::ClientAsyncResponseReader< ::chirp::PutReply>* AsyncputRaw(::grpc::ClientContext* context, const ::chirp::PutRequest& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientAsyncResponseReader< ::chirp::PutReply>* PrepareAsyncputRaw(::grpc::ClientContext* context, const ::chirp::PutRequest& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientReaderWriter< ::chirp::GetRequest, ::chirp::GetReply>* getRaw(::grpc::ClientContext* context) override;
+    ::grpc::ClientAsyncReaderWriter< ::chirp::GetRequest, ::chirp::GetReply>* AsyncgetRaw(::grpc::ClientContext* context, ::grpc::CompletionQueue* cq, void* tag) override;
+    ::grpc::ClientAsyncReaderWriter< ::chirp::GetRequest, ::chirp::GetReply>* PrepareAsyncgetRaw(::grpc::ClientContext* context, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientAsyncResponseReader< ::chirp::DeleteReply>* AsyncdeletekeyRaw(::grpc::ClientContext* context, const ::chirp::DeleteRequest& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientAsyncResponseReader< ::chirp::DeleteReply>* PrepareAsyncdeletekeyRaw(::grpc::ClientContext* context, const ::chirp::DeleteRequest& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientAsyncResponseReader< ::chirp::MultiPutReply>* AsyncmultiputRaw(::grpc::ClientContext* context, const ::chirp::MultiPutRequest& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientAsyncResponseReader< ::chirp::MultiPutReply>* PrepareAsyncmultiputRaw(::grpc::ClientContext* context, const ::chirp::MultiPutRequest& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientAsyncResponseReader< ::chirp::MultiDeleteReply>* AsyncmultideleteRaw(::grpc::ClientContext* context, const ::chirp::MultiDeleteRequest& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientAsyncResponseReader< ::chirp::MultiDeleteReply>* PrepareAsyncmultideleteRaw(::grpc::ClientContext* context, const ::chirp::MultiDeleteRequest& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientAsyncResponseReader< ::chirp::FetchAddReply>* Asyncfetch_addRaw(::grpc::ClientContext* context, const ::chirp::FetchAddRequest& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientAsyncResponseReader< ::chirp::FetchAddReply>* PrepareAsyncfetch_addRaw(::grpc::ClientContext* context, const ::chirp::FetchAddRequest& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientAsyncResponseReader< ::chirp::CompareAndSwapReply>* Asynccompare_and_swapRaw(::grpc::ClientContext* context, const ::chirp::CompareAndSwapRequest& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientAsyncResponseReader< ::chirp::CompareAndSwapReply>* PrepareAsynccompare_and_swapRaw(::grpc::ClientContext* context, const ::chirp::CompareAndSwapRequest& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientAsyncResponseReader< ::chirp::WriteBatchReply>* Asyncwrite_batchRaw(::grpc::ClientContext* context, const ::chirp::WriteBatchRequest& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientAsyncResponseReader< ::chirp::WriteBatchReply>* PrepareAsyncwrite_batchRaw(::grpc::ClientContext* context, const ::chirp::WriteBatchRequest& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientReader< ::chirp::ScanReply>* scanRaw(::grpc::ClientContext* context, const ::chirp::ScanRequest& request) override;
+    ::grpc::ClientAsyncReader< ::chirp::ScanReply>* AsyncscanRaw(::grpc::ClientContext* context, const ::chirp::ScanRequest& request, ::grpc::CompletionQueue* cq, void* tag) override;
+    ::grpc::ClientAsyncReader< ::chirp::ScanReply>* PrepareAsyncscanRaw(::grpc::ClientContext* context, const ::chirp::ScanRequest& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientAsyncResponseReader< ::chirp::ListElementReply>* Asynclist_appendRaw(::grpc::ClientContext* context, const ::chirp::ListElementRequest& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientAsyncResponseReader< ::chirp::ListElementReply>* PrepareAsynclist_appendRaw(::grpc::ClientContext* context, const ::chirp::ListElementRequest& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientAsyncResponseReader< ::chirp::ListElementReply>* Asynclist_removeRaw(::grpc::ClientContext* context, const ::chirp::ListElementRequest& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientAsyncResponseReader< ::chirp::ListElementReply>* PrepareAsynclist_removeRaw(::grpc::ClientContext* context, const ::chirp::ListElementRequest& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientAsyncResponseReader< ::chirp::MemoryUsageReply>* Asyncmemory_usageRaw(::grpc::ClientContext* context, const ::chirp::MemoryUsageRequest& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientAsyncResponseReader< ::chirp::MemoryUsageReply>* PrepareAsyncmemory_usageRaw(::grpc::ClientContext* context, const ::chirp::MemoryUsageRequest& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientAsyncResponseReader< ::chirp::StatsReply>* AsyncstatsRaw(::grpc::ClientContext* context, const ::chirp::StatsRequest& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientAsyncResponseReader< ::chirp::StatsReply>* PrepareAsyncstatsRaw(::grpc::ClientContext* context, const ::chirp::StatsRequest& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientAsyncResponseReader< ::chirp::ExistsReply>* AsyncexistsRaw(::grpc::ClientContext* context, const ::chirp::ExistsRequest& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientAsyncResponseReader< ::chirp::ExistsReply>* PrepareAsyncexistsRaw(::grpc::ClientContext* context, const ::chirp::ExistsRequest& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientAsyncResponseReader< ::chirp::CreateSnapshotReply>* Asynccreate_snapshotRaw(::grpc::ClientContext* context, const ::chirp::CreateSnapshotRequest& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientAsyncResponseReader< ::chirp::CreateSnapshotReply>* PrepareAsynccreate_snapshotRaw(::grpc::ClientContext* context, const ::chirp::CreateSnapshotRequest& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientAsyncResponseReader< ::chirp::ReleaseSnapshotReply>* Asyncrelease_snapshotRaw(::grpc::ClientContext* context, const ::chirp::ReleaseSnapshotRequest& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientAsyncResponseReader< ::chirp::ReleaseSnapshotReply>* PrepareAsyncrelease_snapshotRaw(::grpc::ClientContext* context, const ::chirp::ReleaseSnapshotRequest& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientReader< ::chirp::ChangesReply>* changesRaw(::grpc::ClientContext* context, const ::chirp::ChangesRequest& request) override;
+    ::grpc::ClientAsyncReader< ::chirp::ChangesReply>* AsyncchangesRaw(::grpc::ClientContext* context, const ::chirp::ChangesRequest& request, ::grpc::CompletionQueue* cq, void* tag) override;
+    ::grpc::ClientAsyncReader< ::chirp::ChangesReply>* PrepareAsyncchangesRaw(::grpc::ClientContext* context, const ::chirp::ChangesRequest& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientReader< ::chirp::WatchReply>* watchRaw(::grpc::ClientContext* context, const ::chirp::WatchRequest& request) override;
+    ::grpc::ClientAsyncReader< ::chirp::WatchReply>* AsyncwatchRaw(::grpc::ClientContext* context, const ::chirp::WatchRequest& request, ::grpc::CompletionQueue* cq, void* tag) override;
+    ::grpc::ClientAsyncReader< ::chirp::WatchReply>* PrepareAsyncwatchRaw(::grpc::ClientContext* context, const ::chirp::WatchRequest& request, ::grpc::CompletionQueue* cq) override;
+    const ::grpc::internal::RpcMethod rpcmethod_put_;
+    const ::grpc::internal::RpcMethod rpcmethod_get_;
+    const ::grpc::internal::RpcMethod rpcmethod_deletekey_;
+    const ::grpc::internal::RpcMethod rpcmethod_multiput_;
+    const ::grpc::internal::RpcMethod rpcmethod_multidelete_;
+    const ::grpc::internal::RpcMethod rpcmethod_fetch_add_;
+    const ::grpc::internal::RpcMethod rpcmethod_compare_and_swap_;
+    const ::grpc::internal::RpcMethod rpcmethod_write_batch_;
+    const ::grpc::internal::RpcMethod rpcmethod_scan_;
+    const ::grpc::internal::RpcMethod rpcmethod_list_append_;
+    const ::grpc::internal::RpcMethod rpcmethod_list_remove_;
+    const ::grpc::internal::RpcMethod rpcmethod_memory_usage_;
+    const ::grpc::internal::RpcMethod rpcmethod_stats_;
+    const ::grpc::internal::RpcMethod rpcmethod_exists_;
+    const ::grpc::internal::RpcMethod rpcmethod_create_snapshot_;
+    const ::grpc::internal::RpcMethod rpcmethod_release_snapshot_;
+    const ::grpc::internal::RpcMethod rpcmethod_changes_;
+    const ::grpc::internal::RpcMethod rpcmethod_watch_;
+  };
+  static std::unique_ptr<Stub> NewStub(const std::shared_ptr< ::grpc::ChannelInterface>& channel, const ::grpc::StubOptions& options = ::grpc::StubOptions());
+
+  class Service : public ::grpc::Service {
+   public:
+    Service();
+    virtual ~Service();
+    virtual ::grpc::Status put(::grpc::ServerContext* context, const ::chirp::PutRequest* request, ::chirp::PutReply* response);
+    virtual ::grpc::Status get(::grpc::ServerContext* context, ::grpc::ServerReaderWriter< ::chirp::GetReply, ::chirp::GetRequest>* stream);
+    virtual ::grpc::Status deletekey(::grpc::ServerContext* context, const ::chirp::DeleteRequest* request, ::chirp::DeleteReply* response);
+    virtual ::grpc::Status multiput(::grpc::ServerContext* context, const ::chirp::MultiPutRequest* request, ::chirp::MultiPutReply* response);
+    virtual ::grpc::Status multidelete(::grpc::ServerContext* context, const ::chirp::MultiDeleteRequest* request, ::chirp::MultiDeleteReply* response);
+    virtual ::grpc::Status fetch_add(::grpc::ServerContext* context, const ::chirp::FetchAddRequest* request, ::chirp::FetchAddReply* response);
+    virtual ::grpc::Status compare_and_swap(::grpc::ServerContext* context, const ::chirp::CompareAndSwapRequest* request, ::chirp::CompareAndSwapReply* response);
+    virtual ::grpc::Status write_batch(::grpc::ServerContext* context, const ::chirp::WriteBatchRequest* request, ::chirp::WriteBatchReply* response);
+    virtual ::grpc::Status scan(::grpc::ServerContext* context, const ::chirp::ScanRequest* request, ::grpc::ServerWriter< ::chirp::ScanReply>* writer);
+    virtual ::grpc::Status list_append(::grpc::ServerContext* context, const ::chirp::ListElementRequest* request, ::chirp::ListElementReply* response);
+    virtual ::grpc::Status list_remove(::grpc::ServerContext* context, const ::chirp::ListElementRequest* request, ::chirp::ListElementReply* response);
+    virtual ::grpc::Status memory_usage(::grpc::ServerContext* context, const ::chirp::MemoryUsageRequest* request, ::chirp::MemoryUsageReply* response);
+    virtual ::grpc::Status stats(::grpc::ServerContext* context, const ::chirp::StatsRequest* request, ::chirp::StatsReply* response);
+    virtual ::grpc::Status exists(::grpc::ServerContext* context, const ::chirp::ExistsRequest* request, ::chirp::ExistsReply* response);
+    virtual ::grpc::Status create_snapshot(::grpc::ServerContext* context, const ::chirp::CreateSnapshotRequest* request, ::chirp::CreateSnapshotReply* response);
+    virtual ::grpc::Status release_snapshot(::grpc::ServerContext* context, const ::chirp::ReleaseSnapshotRequest* request, ::chirp::ReleaseSnapshotReply* response);
+    virtual ::grpc::Status changes(::grpc::ServerContext* context, const ::chirp::ChangesRequest* request, ::grpc::ServerWriter< ::chirp::ChangesReply>* writer);
+    virtual ::grpc::Status watch(::grpc::ServerContext* context, const ::chirp::WatchRequest* request, ::grpc::ServerWriter< ::chirp::WatchReply>* writer);
+  };
+  template <class BaseClass>
+  class WithAsyncMethod_put : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithAsyncMethod_put() {
+      ::grpc::Service::MarkMethodAsync(0);
+    }
+    ~WithAsyncMethod_put() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status put(::grpc::ServerContext* /*context*/, const ::chirp::PutRequest* /*request*/, ::chirp::PutReply* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void Requestput(::grpc::ServerContext* context, ::chirp::PutRequest* request, ::grpc::ServerAsyncResponseWriter< ::chirp::PutReply>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncUnary(0, context, request, response, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithAsyncMethod_get : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithAsyncMethod_get() {
+      ::grpc::Service::MarkMethodAsync(1);
+    }
+    ~WithAsyncMethod_get() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status get(::grpc::ServerContext* /*context*/, ::grpc::ServerReaderWriter< ::chirp::GetReply, ::chirp::GetRequest>* /*stream*/)  override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void Requestget(::grpc::ServerContext* context, ::grpc::ServerAsyncReaderWriter< ::chirp::GetReply, ::chirp::GetRequest>* stream, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncBidiStreaming(1, context, stream, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithAsyncMethod_deletekey : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithAsyncMethod_deletekey() {
+      ::grpc::Service::MarkMethodAsync(2);
+    }
+    ~WithAsyncMethod_deletekey() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status deletekey(::grpc::ServerContext* /*context*/, const ::chirp::DeleteRequest* /*request*/, ::chirp::DeleteReply* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void Requestdeletekey(::grpc::ServerContext* context, ::chirp::DeleteRequest* request, ::grpc::ServerAsyncResponseWriter< ::chirp::DeleteReply>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncUnary(2, context, request, response, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithAsyncMethod_multiput : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithAsyncMethod_multiput() {
+      ::grpc::Service::MarkMethodAsync(3);
+    }
+    ~WithAsyncMethod_multiput() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status multiput(::grpc::ServerContext* /*context*/, const ::chirp::MultiPutRequest* /*request*/, ::chirp::MultiPutReply* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void Requestmultiput(::grpc::ServerContext* context, ::chirp::MultiPutRequest* request, ::grpc::ServerAsyncResponseWriter< ::chirp::MultiPutReply>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncUnary(3, context, request, response, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithAsyncMethod_multidelete : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithAsyncMethod_multidelete() {
+      ::grpc::Service::MarkMethodAsync(4);
+    }
+    ~WithAsyncMethod_multidelete() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status multidelete(::grpc::ServerContext* /*context*/, const ::chirp::MultiDeleteRequest* /*request*/, ::chirp::MultiDeleteReply* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void Requestmultidelete(::grpc::ServerContext* context, ::chirp::MultiDeleteRequest* request, ::grpc::ServerAsyncResponseWriter< ::chirp::MultiDeleteReply>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncUnary(4, context, request, response, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithAsyncMethod_fetch_add : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithAsyncMethod_fetch_add() {
+      ::grpc::Service::MarkMethodAsync(5);
+    }
+    ~WithAsyncMethod_fetch_add() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status fetch_add(::grpc::ServerContext* /*context*/, const ::chirp::FetchAddRequest* /*request*/, ::chirp::FetchAddReply* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void Requestfetch_add(::grpc::ServerContext* context, ::chirp::FetchAddRequest* request, ::grpc::ServerAsyncResponseWriter< ::chirp::FetchAddReply>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncUnary(5, context, request, response, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithAsyncMethod_compare_and_swap : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithAsyncMethod_compare_and_swap() {
+      ::grpc::Service::MarkMethodAsync(6);
+    }
+    ~WithAsyncMethod_compare_and_swap() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status compare_and_swap(::grpc::ServerContext* /*context*/, const ::chirp::CompareAndSwapRequest* /*request*/, ::chirp::CompareAndSwapReply* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void Requestcompare_and_swap(::grpc::ServerContext* context, ::chirp::CompareAndSwapRequest* request, ::grpc::ServerAsyncResponseWriter< ::chirp::CompareAndSwapReply>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncUnary(6, context, request, response, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithAsyncMethod_write_batch : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithAsyncMethod_write_batch() {
+      ::grpc::Service::MarkMethodAsync(7);
+    }
+    ~WithAsyncMethod_write_batch() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status write_batch(::grpc::ServerContext* /*context*/, const ::chirp::WriteBatchRequest* /*request*/, ::chirp::WriteBatchReply* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void Requestwrite_batch(::grpc::ServerContext* context, ::chirp::WriteBatchRequest* request, ::grpc::ServerAsyncResponseWriter< ::chirp::WriteBatchReply>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncUnary(7, context, request, response, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithAsyncMethod_scan : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithAsyncMethod_scan() {
+      ::grpc::Service::MarkMethodAsync(8);
+    }
+    ~WithAsyncMethod_scan() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status scan(::grpc::ServerContext* /*context*/, const ::chirp::ScanRequest* /*request*/, ::grpc::ServerWriter< ::chirp::ScanReply>* /*writer*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void Requestscan(::grpc::ServerContext* context, ::chirp::ScanRequest* request, ::grpc::ServerAsyncWriter< ::chirp::ScanReply>* writer, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncServerStreaming(8, context, request, writer, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithAsyncMethod_list_append : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithAsyncMethod_list_append() {
+      ::grpc::Service::MarkMethodAsync(9);
+    }
+    ~WithAsyncMethod_list_append() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status list_append(::grpc::ServerContext* /*context*/, const ::chirp::ListElementRequest* /*request*/, ::chirp::ListElementReply* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void Requestlist_append(::grpc::ServerContext* context, ::chirp::ListElementRequest* request, ::grpc::ServerAsyncResponseWriter< ::chirp::ListElementReply>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncUnary(9, context, request, response, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithAsyncMethod_list_remove : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithAsyncMethod_list_remove() {
+      ::grpc::Service::MarkMethodAsync(10);
+    }
+    ~WithAsyncMethod_list_remove() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status list_remove(::grpc::ServerContext* /*context*/, const ::chirp::ListElementRequest* /*request*/, ::chirp::ListElementReply* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void Requestlist_remove(::grpc::ServerContext* context, ::chirp::ListElementRequest* request, ::grpc::ServerAsyncResponseWriter< ::chirp::ListElementReply>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncUnary(10, context, request, response, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithAsyncMethod_memory_usage : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithAsyncMethod_memory_usage() {
+      ::grpc::Service::MarkMethodAsync(11);
+    }
+    ~WithAsyncMethod_memory_usage() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status memory_usage(::grpc::ServerContext* /*context*/, const ::chirp::MemoryUsageRequest* /*request*/, ::chirp::MemoryUsageReply* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void Requestmemory_usage(::grpc::ServerContext* context, ::chirp::MemoryUsageRequest* request, ::grpc::ServerAsyncResponseWriter< ::chirp::MemoryUsageReply>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncUnary(11, context, request, response, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithAsyncMethod_stats : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithAsyncMethod_stats() {
+      ::grpc::Service::MarkMethodAsync(12);
+    }
+    ~WithAsyncMethod_stats() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status stats(::grpc::ServerContext* /*context*/, const ::chirp::StatsRequest* /*request*/, ::chirp::StatsReply* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void Requeststats(::grpc::ServerContext* context, ::chirp::StatsRequest* request, ::grpc::ServerAsyncResponseWriter< ::chirp::StatsReply>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncUnary(12, context, request, response, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithAsyncMethod_exists : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithAsyncMethod_exists() {
+      ::grpc::Service::MarkMethodAsync(13);
+    }
+    ~WithAsyncMethod_exists() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status exists(::grpc::ServerContext* /*context*/, const ::chirp::ExistsRequest* /*request*/, ::chirp::ExistsReply* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void Requestexists(::grpc::ServerContext* context, ::chirp::ExistsRequest* request, ::grpc::ServerAsyncResponseWriter< ::chirp::ExistsReply>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncUnary(13, context, request, response, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithAsyncMethod_create_snapshot : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithAsyncMethod_create_snapshot() {
+      ::grpc::Service::MarkMethodAsync(14);
+    }
+    ~WithAsyncMethod_create_snapshot() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status create_snapshot(::grpc::ServerContext* /*context*/, const ::chirp::CreateSnapshotRequest* /*request*/, ::chirp::CreateSnapshotReply* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void Requestcreate_snapshot(::grpc::ServerContext* context, ::chirp::CreateSnapshotRequest* request, ::grpc::ServerAsyncResponseWriter< ::chirp::CreateSnapshotReply>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncUnary(14, context, request, response, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithAsyncMethod_release_snapshot : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithAsyncMethod_release_snapshot() {
+      ::grpc::Service::MarkMethodAsync(15);
+    }
+    ~WithAsyncMethod_release_snapshot() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status release_snapshot(::grpc::ServerContext* /*context*/, const ::chirp::ReleaseSnapshotRequest* /*request*/, ::chirp::ReleaseSnapshotReply* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void Requestrelease_snapshot(::grpc::ServerContext* context, ::chirp::ReleaseSnapshotRequest* request, ::grpc::ServerAsyncResponseWriter< ::chirp::ReleaseSnapshotReply>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncUnary(15, context, request, response, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithAsyncMethod_changes : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithAsyncMethod_changes() {
+      ::grpc::Service::MarkMethodAsync(16);
+    }
+    ~WithAsyncMethod_changes() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status changes(::grpc::ServerContext* /*context*/, const ::chirp::ChangesRequest* /*request*/, ::grpc::ServerWriter< ::chirp::ChangesReply>* /*writer*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void Requestchanges(::grpc::ServerContext* context, ::chirp::ChangesRequest* request, ::grpc::ServerAsyncWriter< ::chirp::ChangesReply>* writer, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncServerStreaming(16, context, request, writer, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithAsyncMethod_watch : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithAsyncMethod_watch() {
+      ::grpc::Service::MarkMethodAsync(17);
+    }
+    ~WithAsyncMethod_watch() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status watch(::grpc::ServerContext* /*context*/, const ::chirp::WatchRequest* /*request*/, ::grpc::ServerWriter< ::chirp::WatchReply>* /*writer*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void Requestwatch(::grpc::ServerContext* context, ::chirp::WatchRequest* request, ::grpc::ServerAsyncWriter< ::chirp::WatchReply>* writer, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncServerStreaming(17, context, request, writer, new_call_cq, notification_cq, tag);
+    }
+  };
+  typedef WithAsyncMethod_put<WithAsyncMethod_get<WithAsyncMethod_deletekey<WithAsyncMethod_multiput<WithAsyncMethod_multidelete<WithAsyncMethod_fetch_add<WithAsyncMethod_compare_and_swap<WithAsyncMethod_write_batch<WithAsyncMethod_scan<WithAsyncMethod_list_append<WithAsyncMethod_list_remove<WithAsyncMethod_memory_usage<WithAsyncMethod_stats<WithAsyncMethod_exists<WithAsyncMethod_create_snapshot<WithAsyncMethod_release_snapshot<WithAsyncMethod_changes<WithAsyncMethod_watch<Service > > > > > > > > > > > > > > > > > > AsyncService;
+  template <class BaseClass>
+  class WithCallbackMethod_put : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithCallbackMethod_put() {
+      ::grpc::Service::MarkMethodCallback(0,
+          new ::grpc::internal::CallbackUnaryHandler< ::chirp::PutRequest, ::chirp::PutReply>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::chirp::PutRequest* request, ::chirp::PutReply* response) { return this->put(context, request, response); }));}
+    void SetMessageAllocatorFor_put(
+        ::grpc::MessageAllocator< ::chirp::PutRequest, ::chirp::PutReply>* allocator) {
+      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(0);
+      static_cast<::grpc::internal::CallbackUnaryHandler< ::chirp::PutRequest, ::chirp::PutReply>*>(handler)
+              ->SetMessageAllocator(allocator);
+    }
+    ~WithCallbackMethod_put() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status put(::grpc::ServerContext* /*context*/, const ::chirp::PutRequest* /*request*/, ::chirp::PutReply* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerUnaryReactor* put(
+      ::grpc::CallbackServerContext* /*context*/, const ::chirp::PutRequest* /*request*/, ::chirp::PutReply* /*response*/)  { return nullptr; }
+  };
+  template <class BaseClass>
+  class WithCallbackMethod_get : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithCallbackMethod_get() {
+      ::grpc::Service::MarkMethodCallback(1,
+          new ::grpc::internal::CallbackBidiHandler< ::chirp::GetRequest, ::chirp::GetReply>(
+            [this](
+                   ::grpc::CallbackServerContext* context) { return this->get(context); }));
+    }
+    ~WithCallbackMethod_get() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status get(::grpc::ServerContext* /*context*/, ::grpc::ServerReaderWriter< ::chirp::GetReply, ::chirp::GetRequest>* /*stream*/)  override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerBidiReactor< ::chirp::GetRequest, ::chirp::GetReply>* get(
+      ::grpc::CallbackServerContext* /*context*/)
+      { return nullptr; }
+  };
+  template <class BaseClass>
+  class WithCallbackMethod_deletekey : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithCallbackMethod_deletekey() {
+      ::grpc::Service::MarkMethodCallback(2,
+          new ::grpc::internal::CallbackUnaryHandler< ::chirp::DeleteRequest, ::chirp::DeleteReply>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::chirp::DeleteRequest* request, ::chirp::DeleteReply* response) { return this->deletekey(context, request, response); }));}
+    void SetMessageAllocatorFor_deletekey(
+        ::grpc::MessageAllocator< ::chirp::DeleteRequest, ::chirp::DeleteReply>* allocator) {
+      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(2);
+      static_cast<::grpc::internal::CallbackUnaryHandler< ::chirp::DeleteRequest, ::chirp::DeleteReply>*>(handler)
+              ->SetMessageAllocator(allocator);
+    }
+    ~WithCallbackMethod_deletekey() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status deletekey(::grpc::ServerContext* /*context*/, const ::chirp::DeleteRequest* /*request*/, ::chirp::DeleteReply* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerUnaryReactor* deletekey(
+      ::grpc::CallbackServerContext* /*context*/, const ::chirp::DeleteRequest* /*request*/, ::chirp::DeleteReply* /*response*/)  { return nullptr; }
+  };
+  template <class BaseClass>
+  class WithCallbackMethod_multiput : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithCallbackMethod_multiput() {
+      ::grpc::Service::MarkMethodCallback(3,
+          new ::grpc::internal::CallbackUnaryHandler< ::chirp::MultiPutRequest, ::chirp::MultiPutReply>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::chirp::MultiPutRequest* request, ::chirp::MultiPutReply* response) { return this->multiput(context, request, response); }));}
+    void SetMessageAllocatorFor_multiput(
+        ::grpc::MessageAllocator< ::chirp::MultiPutRequest, ::chirp::MultiPutReply>* allocator) {
+      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(3);
+      static_cast<::grpc::internal::CallbackUnaryHandler< ::chirp::MultiPutRequest, ::chirp::MultiPutReply>*>(handler)
+              ->SetMessageAllocator(allocator);
+    }
+    ~WithCallbackMethod_multiput() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status multiput(::grpc::ServerContext* /*context*/, const ::chirp::MultiPutRequest* /*request*/, ::chirp::MultiPutReply* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerUnaryReactor* multiput(
+      ::grpc::CallbackServerContext* /*context*/, const ::chirp::MultiPutRequest* /*request*/, ::chirp::MultiPutReply* /*response*/)  { return nullptr; }
+  };
+  template <class BaseClass>
+  class WithCallbackMethod_multidelete : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithCallbackMethod_multidelete() {
+      ::grpc::Service::MarkMethodCallback(4,
+          new ::grpc::internal::CallbackUnaryHandler< ::chirp::MultiDeleteRequest, ::chirp::MultiDeleteReply>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::chirp::MultiDeleteRequest* request, ::chirp::MultiDeleteReply* response) { return this->multidelete(context, request, response); }));}
+    void SetMessageAllocatorFor_multidelete(
+        ::grpc::MessageAllocator< ::chirp::MultiDeleteRequest, ::chirp::MultiDeleteReply>* allocator) {
+      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(4);
+      static_cast<::grpc::internal::CallbackUnaryHandler< ::chirp::MultiDeleteRequest, ::chirp::MultiDeleteReply>*>(handler)
+              ->SetMessageAllocator(allocator);
+    }
+    ~WithCallbackMethod_multidelete() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status multidelete(::grpc::ServerContext* /*context*/, const ::chirp::MultiDeleteRequest* /*request*/, ::chirp::MultiDeleteReply* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerUnaryReactor* multidelete(
+      ::grpc::CallbackServerContext* /*context*/, const ::chirp::MultiDeleteRequest* /*request*/, ::chirp::MultiDeleteReply* /*response*/)  { return nullptr; }
+  };
+  template <class BaseClass>
+  class WithCallbackMethod_fetch_add : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithCallbackMethod_fetch_add() {
+      ::grpc::Service::MarkMethodCallback(5,
+          new ::grpc::internal::CallbackUnaryHandler< ::chirp::FetchAddRequest, ::chirp::FetchAddReply>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::chirp::FetchAddRequest* request, ::chirp::FetchAddReply* response) { return this->fetch_add(context, request, response); }));}
+    void SetMessageAllocatorFor_fetch_add(
+        ::grpc::MessageAllocator< ::chirp::FetchAddRequest, ::chirp::FetchAddReply>* allocator) {
+      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(5);
+      static_cast<::grpc::internal::CallbackUnaryHandler< ::chirp::FetchAddRequest, ::chirp::FetchAddReply>*>(handler)
+              ->SetMessageAllocator(allocator);
+    }
+    ~WithCallbackMethod_fetch_add() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status fetch_add(::grpc::ServerContext* /*context*/, const ::chirp::FetchAddRequest* /*request*/, ::chirp::FetchAddReply* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerUnaryReactor* fetch_add(
+      ::grpc::CallbackServerContext* /*context*/, const ::chirp::FetchAddRequest* /*request*/, ::chirp::FetchAddReply* /*response*/)  { return nullptr; }
+  };
+  template <class BaseClass>
+  class WithCallbackMethod_compare_and_swap : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithCallbackMethod_compare_and_swap() {
+      ::grpc::Service::MarkMethodCallback(6,
+          new ::grpc::internal::CallbackUnaryHandler< ::chirp::CompareAndSwapRequest, ::chirp::CompareAndSwapReply>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::chirp::CompareAndSwapRequest* request, ::chirp::CompareAndSwapReply* response) { return this->compare_and_swap(context, request, response); }));}
+    void SetMessageAllocatorFor_compare_and_swap(
+        ::grpc::MessageAllocator< ::chirp::CompareAndSwapRequest, ::chirp::CompareAndSwapReply>* allocator) {
+      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(6);
+      static_cast<::grpc::internal::CallbackUnaryHandler< ::chirp::CompareAndSwapRequest, ::chirp::CompareAndSwapReply>*>(handler)
+              ->SetMessageAllocator(allocator);
+    }
+    ~WithCallbackMethod_compare_and_swap() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status compare_and_swap(::grpc::ServerContext* /*context*/, const ::chirp::CompareAndSwapRequest* /*request*/, ::chirp::CompareAndSwapReply* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerUnaryReactor* compare_and_swap(
+      ::grpc::CallbackServerContext* /*context*/, const ::chirp::CompareAndSwapRequest* /*request*/, ::chirp::CompareAndSwapReply* /*response*/)  { return nullptr; }
+  };
+  template <class BaseClass>
+  class WithCallbackMethod_write_batch : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithCallbackMethod_write_batch() {
+      ::grpc::Service::MarkMethodCallback(7,
+          new ::grpc::internal::CallbackUnaryHandler< ::chirp::WriteBatchRequest, ::chirp::WriteBatchReply>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::chirp::WriteBatchRequest* request, ::chirp::WriteBatchReply* response) { return this->write_batch(context, request, response); }));}
+    void SetMessageAllocatorFor_write_batch(
+        ::grpc::MessageAllocator< ::chirp::WriteBatchRequest, ::chirp::WriteBatchReply>* allocator) {
+      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(7);
+      static_cast<::grpc::internal::CallbackUnaryHandler< ::chirp::WriteBatchRequest, ::chirp::WriteBatchReply>*>(handler)
+              ->SetMessageAllocator(allocator);
+    }
+    ~WithCallbackMethod_write_batch() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status write_batch(::grpc::ServerContext* /*context*/, const ::chirp::WriteBatchRequest* /*request*/, ::chirp::WriteBatchReply* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerUnaryReactor* write_batch(
+      ::grpc::CallbackServerContext* /*context*/, const ::chirp::WriteBatchRequest* /*request*/, ::chirp::WriteBatchReply* /*response*/)  { return nullptr; }
+  };
+  template <class BaseClass>
+  class WithCallbackMethod_scan : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithCallbackMethod_scan() {
+      ::grpc::Service::MarkMethodCallback(8,
+          new ::grpc::internal::CallbackServerStreamingHandler< ::chirp::ScanRequest, ::chirp::ScanReply>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::chirp::ScanRequest* request) { return this->scan(context, request); }));
+    }
+    ~WithCallbackMethod_scan() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status scan(::grpc::ServerContext* /*context*/, const ::chirp::ScanRequest* /*request*/, ::grpc::ServerWriter< ::chirp::ScanReply>* /*writer*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerWriteReactor< ::chirp::ScanReply>* scan(
+      ::grpc::CallbackServerContext* /*context*/, const ::chirp::ScanRequest* /*request*/)  { return nullptr; }
+  };
+  template <class BaseClass>
+  class WithCallbackMethod_list_append : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithCallbackMethod_list_append() {
+      ::grpc::Service::MarkMethodCallback(9,
+          new ::grpc::internal::CallbackUnaryHandler< ::chirp::ListElementRequest, ::chirp::ListElementReply>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::chirp::ListElementRequest* request, ::chirp::ListElementReply* response) { return this->list_append(context, request, response); }));}
+    void SetMessageAllocatorFor_list_append(
+        ::grpc::MessageAllocator< ::chirp::ListElementRequest, ::chirp::ListElementReply>* allocator) {
+      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(9);
+      static_cast<::grpc::internal::CallbackUnaryHandler< ::chirp::ListElementRequest, ::chirp::ListElementReply>*>(handler)
+              ->SetMessageAllocator(allocator);
+    }
+    ~WithCallbackMethod_list_append() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status list_append(::grpc::ServerContext* /*context*/, const ::chirp::ListElementRequest* /*request*/, ::chirp::ListElementReply* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerUnaryReactor* list_append(
+      ::grpc::CallbackServerContext* /*context*/, const ::chirp::ListElementRequest* /*request*/, ::chirp::ListElementReply* /*response*/)  { return nullptr; }
+  };
+  template <class BaseClass>
+  class WithCallbackMethod_list_remove : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithCallbackMethod_list_remove() {
+      ::grpc::Service::MarkMethodCallback(10,
+          new ::grpc::internal::CallbackUnaryHandler< ::chirp::ListElementRequest, ::chirp::ListElementReply>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::chirp::ListElementRequest* request, ::chirp::ListElementReply* response) { return this->list_remove(context, request, response); }));}
+    void SetMessageAllocatorFor_list_remove(
+        ::grpc::MessageAllocator< ::chirp::ListElementRequest, ::chirp::ListElementReply>* allocator) {
+      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(10);
+      static_cast<::grpc::internal::CallbackUnaryHandler< ::chirp::ListElementRequest, ::chirp::ListElementReply>*>(handler)
+              ->SetMessageAllocator(allocator);
+    }
+    ~WithCallbackMethod_list_remove() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status list_remove(::grpc::ServerContext* /*context*/, const ::chirp::ListElementRequest* /*request*/, ::chirp::ListElementReply* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerUnaryReactor* list_remove(
+      ::grpc::CallbackServerContext* /*context*/, const ::chirp::ListElementRequest* /*request*/, ::chirp::ListElementReply* /*response*/)  { return nullptr; }
+  };
+  template <class BaseClass>
+  class WithCallbackMethod_memory_usage : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithCallbackMethod_memory_usage() {
+      ::grpc::Service::MarkMethodCallback(11,
+          new ::grpc::internal::CallbackUnaryHandler< ::chirp::MemoryUsageRequest, ::chirp::MemoryUsageReply>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::chirp::MemoryUsageRequest* request, ::chirp::MemoryUsageReply* response) { return this->memory_usage(context, request, response); }));}
+    void SetMessageAllocatorFor_memory_usage(
+        ::grpc::MessageAllocator< ::chirp::MemoryUsageRequest, ::chirp::MemoryUsageReply>* allocator) {
+      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(11);
+      static_cast<::grpc::internal::CallbackUnaryHandler< ::chirp::MemoryUsageRequest, ::chirp::MemoryUsageReply>*>(handler)
+              ->SetMessageAllocator(allocator);
+    }
+    ~WithCallbackMethod_memory_usage() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status memory_usage(::grpc::ServerContext* /*context*/, const ::chirp::MemoryUsageRequest* /*request*/, ::chirp::MemoryUsageReply* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerUnaryReactor* memory_usage(
+      ::grpc::CallbackServerContext* /*context*/, const ::chirp::MemoryUsageRequest* /*request*/, ::chirp::MemoryUsageReply* /*response*/)  { return nullptr; }
+  };
+  template <class BaseClass>
+  class WithCallbackMethod_stats : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithCallbackMethod_stats() {
+      ::grpc::Service::MarkMethodCallback(12,
+          new ::grpc::internal::CallbackUnaryHandler< ::chirp::StatsRequest, ::chirp::StatsReply>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::chirp::StatsRequest* request, ::chirp::StatsReply* response) { return this->stats(context, request, response); }));}
+    void SetMessageAllocatorFor_stats(
+        ::grpc::MessageAllocator< ::chirp::StatsRequest, ::chirp::StatsReply>* allocator) {
+      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(12);
+      static_cast<::grpc::internal::CallbackUnaryHandler< ::chirp::StatsRequest, ::chirp::StatsReply>*>(handler)
+              ->SetMessageAllocator(allocator);
+    }
+    ~WithCallbackMethod_stats() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status stats(::grpc::ServerContext* /*context*/, const ::chirp::StatsRequest* /*request*/, ::chirp::StatsReply* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerUnaryReactor* stats(
+      ::grpc::CallbackServerContext* /*context*/, const ::chirp::StatsRequest* /*request*/, ::chirp::StatsReply* /*response*/)  { return nullptr; }
+  };
+  template <class BaseClass>
+  class WithCallbackMethod_exists : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithCallbackMethod_exists() {
+      ::grpc::Service::MarkMethodCallback(13,
+          new ::grpc::internal::CallbackUnaryHandler< ::chirp::ExistsRequest, ::chirp::ExistsReply>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::chirp::ExistsRequest* request, ::chirp::ExistsReply* response) { return this->exists(context, request, response); }));}
+    void SetMessageAllocatorFor_exists(
+        ::grpc::MessageAllocator< ::chirp::ExistsRequest, ::chirp::ExistsReply>* allocator) {
+      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(13);
+      static_cast<::grpc::internal::CallbackUnaryHandler< ::chirp::ExistsRequest, ::chirp::ExistsReply>*>(handler)
+              ->SetMessageAllocator(allocator);
+    }
+    ~WithCallbackMethod_exists() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status exists(::grpc::ServerContext* /*context*/, const ::chirp::ExistsRequest* /*request*/, ::chirp::ExistsReply* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerUnaryReactor* exists(
+      ::grpc::CallbackServerContext* /*context*/, const ::chirp::ExistsRequest* /*request*/, ::chirp::ExistsReply* /*response*/)  { return nullptr; }
+  };
+  template <class BaseClass>
+  class WithCallbackMethod_create_snapshot : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithCallbackMethod_create_snapshot() {
+      ::grpc::Service::MarkMethodCallback(14,
+          new ::grpc::internal::CallbackUnaryHandler< ::chirp::CreateSnapshotRequest, ::chirp::CreateSnapshotReply>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::chirp::CreateSnapshotRequest* request, ::chirp::CreateSnapshotReply* response) { return this->create_snapshot(context, request, response); }));}
+    void SetMessageAllocatorFor_create_snapshot(
+        ::grpc::MessageAllocator< ::chirp::CreateSnapshotRequest, ::chirp::CreateSnapshotReply>* allocator) {
+      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(14);
+      static_cast<::grpc::internal::CallbackUnaryHandler< ::chirp::CreateSnapshotRequest, ::chirp::CreateSnapshotReply>*>(handler)
+              ->SetMessageAllocator(allocator);
+    }
+    ~WithCallbackMethod_create_snapshot() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status create_snapshot(::grpc::ServerContext* /*context*/, const ::chirp::CreateSnapshotRequest* /*request*/, ::chirp::CreateSnapshotReply* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerUnaryReactor* create_snapshot(
+      ::grpc::CallbackServerContext* /*context*/, const ::chirp::CreateSnapshotRequest* /*request*/, ::chirp::CreateSnapshotReply* /*response*/)  { return nullptr; }
+  };
+  template <class BaseClass>
+  class WithCallbackMethod_release_snapshot : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithCallbackMethod_release_snapshot() {
+      ::grpc::Service::MarkMethodCallback(15,
+          new ::grpc::internal::CallbackUnaryHandler< ::chirp::ReleaseSnapshotRequest, ::chirp::ReleaseSnapshotReply>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::chirp::ReleaseSnapshotRequest* request, ::chirp::ReleaseSnapshotReply* response) { return this->release_snapshot(context, request, response); }));}
+    void SetMessageAllocatorFor_release_snapshot(
+        ::grpc::MessageAllocator< ::chirp::ReleaseSnapshotRequest, ::chirp::ReleaseSnapshotReply>* allocator) {
+      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(15);
+      static_cast<::grpc::internal::CallbackUnaryHandler< ::chirp::ReleaseSnapshotRequest, ::chirp::ReleaseSnapshotReply>*>(handler)
+              ->SetMessageAllocator(allocator);
+    }
+    ~WithCallbackMethod_release_snapshot() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status release_snapshot(::grpc::ServerContext* /*context*/, const ::chirp::ReleaseSnapshotRequest* /*request*/, ::chirp::ReleaseSnapshotReply* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerUnaryReactor* release_snapshot(
+      ::grpc::CallbackServerContext* /*context*/, const ::chirp::ReleaseSnapshotRequest* /*request*/, ::chirp::ReleaseSnapshotReply* /*response*/)  { return nullptr; }
+  };
+  template <class BaseClass>
+  class WithCallbackMethod_changes : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithCallbackMethod_changes() {
+      ::grpc::Service::MarkMethodCallback(16,
+          new ::grpc::internal::CallbackServerStreamingHandler< ::chirp::ChangesRequest, ::chirp::ChangesReply>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::chirp::ChangesRequest* request) { return this->changes(context, request); }));
+    }
+    ~WithCallbackMethod_changes() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status changes(::grpc::ServerContext* /*context*/, const ::chirp::ChangesRequest* /*request*/, ::grpc::ServerWriter< ::chirp::ChangesReply>* /*writer*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerWriteReactor< ::chirp::ChangesReply>* changes(
+      ::grpc::CallbackServerContext* /*context*/, const ::chirp::ChangesRequest* /*request*/)  { return nullptr; }
+  };
+  template <class BaseClass>
+  class WithCallbackMethod_watch : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithCallbackMethod_watch() {
+      ::grpc::Service::MarkMethodCallback(17,
+          new ::grpc::internal::CallbackServerStreamingHandler< ::chirp::WatchRequest, ::chirp::WatchReply>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::chirp::WatchRequest* request) { return this->watch(context, request); }));
+    }
+    ~WithCallbackMethod_watch() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status watch(::grpc::ServerContext* /*context*/, const ::chirp::WatchRequest* /*request*/, ::grpc::ServerWriter< ::chirp::WatchReply>* /*writer*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerWriteReactor< ::chirp::WatchReply>* watch(
+      ::grpc::CallbackServerContext* /*context*/, const ::chirp::WatchRequest* /*request*/)  { return nullptr; }
+  };
+  typedef WithCallbackMethod_put<WithCallbackMethod_get<WithCallbackMethod_deletekey<WithCallbackMethod_multiput<WithCallbackMethod_multidelete<WithCallbackMethod_fetch_add<WithCallbackMethod_compare_and_swap<WithCallbackMethod_write_batch<WithCallbackMethod_scan<WithCallbackMethod_list_append<WithCallbackMethod_list_remove<WithCallbackMethod_memory_usage<WithCallbackMethod_stats<WithCallbackMethod_exists<WithCallbackMethod_create_snapshot<WithCallbackMethod_release_snapshot<WithCallbackMethod_changes<WithCallbackMethod_watch<Service > > > > > > > > > > > > > > > > > > CallbackService;
+  typedef CallbackService ExperimentalCallbackService;
+  template <class BaseClass>
+  class WithGenericMethod_put : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithGenericMethod_put() {
+      ::grpc::Service::MarkMethodGeneric(0);
+    }
+    ~WithGenericMethod_put() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status put(::grpc::ServerContext* /*context*/, const ::chirp::PutRequest* /*request*/, ::chirp::PutReply* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+  };
+  template <class BaseClass>
+  class WithGenericMethod_get : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithGenericMethod_get() {
+      ::grpc::Service::MarkMethodGeneric(1);
+    }
+    ~WithGenericMethod_get() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status get(::grpc::ServerContext* /*context*/, ::grpc::ServerReaderWriter< ::chirp::GetReply, ::chirp::GetRequest>* /*stream*/)  override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+  };
+  template <class BaseClass>
+  class WithGenericMethod_deletekey : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithGenericMethod_deletekey() {
+      ::grpc::Service::MarkMethodGeneric(2);
+    }
+    ~WithGenericMethod_deletekey() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status deletekey(::grpc::ServerContext* /*context*/, const ::chirp::DeleteRequest* /*request*/, ::chirp::DeleteReply* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+  };
+  template <class BaseClass>
+  class WithGenericMethod_multiput : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithGenericMethod_multiput() {
+      ::grpc::Service::MarkMethodGeneric(3);
+    }
+    ~WithGenericMethod_multiput() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status multiput(::grpc::ServerContext* /*context*/, const ::chirp::MultiPutRequest* /*request*/, ::chirp::MultiPutReply* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+  };
+  template <class BaseClass>
+  class WithGenericMethod_multidelete : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithGenericMethod_multidelete() {
+      ::grpc::Service::MarkMethodGeneric(4);
+    }
+    ~WithGenericMethod_multidelete() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status multidelete(::grpc::ServerContext* /*context*/, const ::chirp::MultiDeleteRequest* /*request*/, ::chirp::MultiDeleteReply* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+  };
+  template <class BaseClass>
+  class WithGenericMethod_fetch_add : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithGenericMethod_fetch_add() {
+      ::grpc::Service::MarkMethodGeneric(5);
+    }
+    ~WithGenericMethod_fetch_add() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status fetch_add(::grpc::ServerContext* /*context*/, const ::chirp::FetchAddRequest* /*request*/, ::chirp::FetchAddReply* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+  };
+  template <class BaseClass>
+  class WithGenericMethod_compare_and_swap : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithGenericMethod_compare_and_swap() {
+      ::grpc::Service::MarkMethodGeneric(6);
+    }
+    ~WithGenericMethod_compare_and_swap() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status compare_and_swap(::grpc::ServerContext* /*context*/, const ::chirp::CompareAndSwapRequest* /*request*/, ::chirp::CompareAndSwapReply* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+  };
+  template <class BaseClass>
+  class WithGenericMethod_write_batch : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithGenericMethod_write_batch() {
+      ::grpc::Service::MarkMethodGeneric(7);
+    }
+    ~WithGenericMethod_write_batch() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status write_batch(::grpc::ServerContext* /*context*/, const ::chirp::WriteBatchRequest* /*request*/, ::chirp::WriteBatchReply* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+  };
+  template <class BaseClass>
+  class WithGenericMethod_scan : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithGenericMethod_scan() {
+      ::grpc::Service::MarkMethodGeneric(8);
+    }
+    ~WithGenericMethod_scan() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status scan(::grpc::ServerContext* /*context*/, const ::chirp::ScanRequest* /*request*/, ::grpc::ServerWriter< ::chirp::ScanReply>* /*writer*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+  };
+  template <class BaseClass>
+  class WithGenericMethod_list_append : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithGenericMethod_list_append() {
+      ::grpc::Service::MarkMethodGeneric(9);
+    }
+    ~WithGenericMethod_list_append() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status list_append(::grpc::ServerContext* /*context*/, const ::chirp::ListElementRequest* /*request*/, ::chirp::ListElementReply* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+  };
+  template <class BaseClass>
+  class WithGenericMethod_list_remove : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithGenericMethod_list_remove() {
+      ::grpc::Service::MarkMethodGeneric(10);
+    }
+    ~WithGenericMethod_list_remove() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status list_remove(::grpc::ServerContext* /*context*/, const ::chirp::ListElementRequest* /*request*/, ::chirp::ListElementReply* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+  };
+  template <class BaseClass>
+  class WithGenericMethod_memory_usage : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithGenericMethod_memory_usage() {
+      ::grpc::Service::MarkMethodGeneric(11);
+    }
+    ~WithGenericMethod_memory_usage() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status memory_usage(::grpc::ServerContext* /*context*/, const ::chirp::MemoryUsageRequest* /*request*/, ::chirp::MemoryUsageReply* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+  };
+  template <class BaseClass>
+  class WithGenericMethod_stats : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithGenericMethod_stats() {
+      ::grpc::Service::MarkMethodGeneric(12);
+    }
+    ~WithGenericMethod_stats() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status stats(::grpc::ServerContext* /*context*/, const ::chirp::StatsRequest* /*request*/, ::chirp::StatsReply* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+  };
+  template <class BaseClass>
+  class WithGenericMethod_exists : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithGenericMethod_exists() {
+      ::grpc::Service::MarkMethodGeneric(13);
+    }
+    ~WithGenericMethod_exists() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status exists(::grpc::ServerContext* /*context*/, const ::chirp::ExistsRequest* /*request*/, ::chirp::ExistsReply* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+  };
+  template <class BaseClass>
+  class WithGenericMethod_create_snapshot : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithGenericMethod_create_snapshot() {
+      ::grpc::Service::MarkMethodGeneric(14);
+    }
+    ~WithGenericMethod_create_snapshot() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status create_snapshot(::grpc::ServerContext* /*context*/, const ::chirp::CreateSnapshotRequest* /*request*/, ::chirp::CreateSnapshotReply* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+  };
+  template <class BaseClass>
+  class WithGenericMethod_release_snapshot : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithGenericMethod_release_snapshot() {
+      ::grpc::Service::MarkMethodGeneric(15);
+    }
+    ~WithGenericMethod_release_snapshot() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status release_snapshot(::grpc::ServerContext* /*context*/, const ::chirp::ReleaseSnapshotRequest* /*request*/, ::chirp::ReleaseSnapshotReply* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+  };
+  template <class BaseClass>
+  class WithGenericMethod_changes : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithGenericMethod_changes() {
+      ::grpc::Service::MarkMethodGeneric(16);
+    }
+    ~WithGenericMethod_changes() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status changes(::grpc::ServerContext* /*context*/, const ::chirp::ChangesRequest* /*request*/, ::grpc::ServerWriter< ::chirp::ChangesReply>* /*writer*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+  };
+  template <class BaseClass>
+  class WithGenericMethod_watch : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithGenericMethod_watch() {
+      ::grpc::Service::MarkMethodGeneric(17);
+    }
+    ~WithGenericMethod_watch() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status watch(::grpc::ServerContext* /*context*/, const ::chirp::WatchRequest* /*request*/, ::grpc::ServerWriter< ::chirp::WatchReply>* /*writer*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+  };
+  template <class BaseClass>
+  class WithRawMethod_put : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawMethod_put() {
+      ::grpc::Service::MarkMethodRaw(0);
+    }
+    ~WithRawMethod_put() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status put(::grpc::ServerContext* /*context*/, const ::chirp::PutRequest* /*request*/, ::chirp::PutReply* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void Requestput(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncResponseWriter< ::grpc::ByteBuffer>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncUnary(0, context, request, response, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithRawMethod_get : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawMethod_get() {
+      ::grpc::Service::MarkMethodRaw(1);
+    }
+    ~WithRawMethod_get() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status get(::grpc::ServerContext* /*context*/, ::grpc::ServerReaderWriter< ::chirp::GetReply, ::chirp::GetRequest>* /*stream*/)  override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void Requestget(::grpc::ServerContext* context, ::grpc::ServerAsyncReaderWriter< ::grpc::ByteBuffer, ::grpc::ByteBuffer>* stream, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncBidiStreaming(1, context, stream, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithRawMethod_deletekey : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawMethod_deletekey() {
+      ::grpc::Service::MarkMethodRaw(2);
+    }
+    ~WithRawMethod_deletekey() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status deletekey(::grpc::ServerContext* /*context*/, const ::chirp::DeleteRequest* /*request*/, ::chirp::DeleteReply* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void Requestdeletekey(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncResponseWriter< ::grpc::ByteBuffer>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncUnary(2, context, request, response, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithRawMethod_multiput : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawMethod_multiput() {
+      ::grpc::Service::MarkMethodRaw(3);
+    }
+    ~WithRawMethod_multiput() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status multiput(::grpc::ServerContext* /*context*/, const ::chirp::MultiPutRequest* /*request*/, ::chirp::MultiPutReply* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void Requestmultiput(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncResponseWriter< ::grpc::ByteBuffer>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncUnary(3, context, request, response, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithRawMethod_multidelete : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawMethod_multidelete() {
+      ::grpc::Service::MarkMethodRaw(4);
+    }
+    ~WithRawMethod_multidelete() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status multidelete(::grpc::ServerContext* /*context*/, const ::chirp::MultiDeleteRequest* /*request*/, ::chirp::MultiDeleteReply* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void Requestmultidelete(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncResponseWriter< ::grpc::ByteBuffer>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncUnary(4, context, request, response, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithRawMethod_fetch_add : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawMethod_fetch_add() {
+      ::grpc::Service::MarkMethodRaw(5);
+    }
+    ~WithRawMethod_fetch_add() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status fetch_add(::grpc::ServerContext* /*context*/, const ::chirp::FetchAddRequest* /*request*/, ::chirp::FetchAddReply* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void Requestfetch_add(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncResponseWriter< ::grpc::ByteBuffer>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncUnary(5, context, request, response, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithRawMethod_compare_and_swap : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawMethod_compare_and_swap() {
+      ::grpc::Service::MarkMethodRaw(6);
+    }
+    ~WithRawMethod_compare_and_swap() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status compare_and_swap(::grpc::ServerContext* /*context*/, const ::chirp::CompareAndSwapRequest* /*request*/, ::chirp::CompareAndSwapReply* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void Requestcompare_and_swap(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncResponseWriter< ::grpc::ByteBuffer>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncUnary(6, context, request, response, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithRawMethod_write_batch : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawMethod_write_batch() {
+      ::grpc::Service::MarkMethodRaw(7);
+    }
+    ~WithRawMethod_write_batch() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status write_batch(::grpc::ServerContext* /*context*/, const ::chirp::WriteBatchRequest* /*request*/, ::chirp::WriteBatchReply* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void Requestwrite_batch(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncResponseWriter< ::grpc::ByteBuffer>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncUnary(7, context, request, response, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithRawMethod_scan : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawMethod_scan() {
+      ::grpc::Service::MarkMethodRaw(8);
+    }
+    ~WithRawMethod_scan() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status scan(::grpc::ServerContext* /*context*/, const ::chirp::ScanRequest* /*request*/, ::grpc::ServerWriter< ::chirp::ScanReply>* /*writer*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void Requestscan(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncWriter< ::grpc::ByteBuffer>* writer, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncServerStreaming(8, context, request, writer, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithRawMethod_list_append : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawMethod_list_append() {
+      ::grpc::Service::MarkMethodRaw(9);
+    }
+    ~WithRawMethod_list_append() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status list_append(::grpc::ServerContext* /*context*/, const ::chirp::ListElementRequest* /*request*/, ::chirp::ListElementReply* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void Requestlist_append(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncResponseWriter< ::grpc::ByteBuffer>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncUnary(9, context, request, response, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithRawMethod_list_remove : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawMethod_list_remove() {
+      ::grpc::Service::MarkMethodRaw(10);
+    }
+    ~WithRawMethod_list_remove() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status list_remove(::grpc::ServerContext* /*context*/, const ::chirp::ListElementRequest* /*request*/, ::chirp::ListElementReply* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void Requestlist_remove(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncResponseWriter< ::grpc::ByteBuffer>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncUnary(10, context, request, response, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithRawMethod_memory_usage : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawMethod_memory_usage() {
+      ::grpc::Service::MarkMethodRaw(11);
+    }
+    ~WithRawMethod_memory_usage() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status memory_usage(::grpc::ServerContext* /*context*/, const ::chirp::MemoryUsageRequest* /*request*/, ::chirp::MemoryUsageReply* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void Requestmemory_usage(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncResponseWriter< ::grpc::ByteBuffer>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncUnary(11, context, request, response, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithRawMethod_stats : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawMethod_stats() {
+      ::grpc::Service::MarkMethodRaw(12);
+    }
+    ~WithRawMethod_stats() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status stats(::grpc::ServerContext* /*context*/, const ::chirp::StatsRequest* /*request*/, ::chirp::StatsReply* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void Requeststats(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncResponseWriter< ::grpc::ByteBuffer>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncUnary(12, context, request, response, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithRawMethod_exists : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawMethod_exists() {
+      ::grpc::Service::MarkMethodRaw(13);
+    }
+    ~WithRawMethod_exists() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status exists(::grpc::ServerContext* /*context*/, const ::chirp::ExistsRequest* /*request*/, ::chirp::ExistsReply* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void Requestexists(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncResponseWriter< ::grpc::ByteBuffer>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncUnary(13, context, request, response, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithRawMethod_create_snapshot : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawMethod_create_snapshot() {
+      ::grpc::Service::MarkMethodRaw(14);
+    }
+    ~WithRawMethod_create_snapshot() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status create_snapshot(::grpc::ServerContext* /*context*/, const ::chirp::CreateSnapshotRequest* /*request*/, ::chirp::CreateSnapshotReply* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void Requestcreate_snapshot(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncResponseWriter< ::grpc::ByteBuffer>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncUnary(14, context, request, response, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithRawMethod_release_snapshot : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawMethod_release_snapshot() {
+      ::grpc::Service::MarkMethodRaw(15);
+    }
+    ~WithRawMethod_release_snapshot() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status release_snapshot(::grpc::ServerContext* /*context*/, const ::chirp::ReleaseSnapshotRequest* /*request*/, ::chirp::ReleaseSnapshotReply* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void Requestrelease_snapshot(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncResponseWriter< ::grpc::ByteBuffer>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncUnary(15, context, request, response, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithRawMethod_changes : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawMethod_changes() {
+      ::grpc::Service::MarkMethodRaw(16);
+    }
+    ~WithRawMethod_changes() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status changes(::grpc::ServerContext* /*context*/, const ::chirp::ChangesRequest* /*request*/, ::grpc::ServerWriter< ::chirp::ChangesReply>* /*writer*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void Requestchanges(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncWriter< ::grpc::ByteBuffer>* writer, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncServerStreaming(16, context, request, writer, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithRawMethod_watch : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawMethod_watch() {
+      ::grpc::Service::MarkMethodRaw(17);
+    }
+    ~WithRawMethod_watch() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status watch(::grpc::ServerContext* /*context*/, const ::chirp::WatchRequest* /*request*/, ::grpc::ServerWriter< ::chirp::WatchReply>* /*writer*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void Requestwatch(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncWriter< ::grpc::ByteBuffer>* writer, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncServerStreaming(17, context, request, writer, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithRawCallbackMethod_put : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawCallbackMethod_put() {
+      ::grpc::Service::MarkMethodRawCallback(0,
+          new ::grpc::internal::CallbackUnaryHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::grpc::ByteBuffer* request, ::grpc::ByteBuffer* response) { return this->put(context, request, response); }));
+    }
+    ~WithRawCallbackMethod_put() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status put(::grpc::ServerContext* /*context*/, const ::chirp::PutRequest* /*request*/, ::chirp::PutReply* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerUnaryReactor* put(
+      ::grpc::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/, ::grpc::ByteBuffer* /*response*/)  { return nullptr; }
+  };
+  template <class BaseClass>
+  class WithRawCallbackMethod_get : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawCallbackMethod_get() {
+      ::grpc::Service::MarkMethodRawCallback(1,
+          new ::grpc::internal::CallbackBidiHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
+            [this](
+                   ::grpc::CallbackServerContext* context) { return this->get(context); }));
+    }
+    ~WithRawCallbackMethod_get() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status get(::grpc::ServerContext* /*context*/, ::grpc::ServerReaderWriter< ::chirp::GetReply, ::chirp::GetRequest>* /*stream*/)  override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerBidiReactor< ::grpc::ByteBuffer, ::grpc::ByteBuffer>* get(
+      ::grpc::CallbackServerContext* /*context*/)
+      { return nullptr; }
+  };
+  template <class BaseClass>
+  class WithRawCallbackMethod_deletekey : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawCallbackMethod_deletekey() {
+      ::grpc::Service::MarkMethodRawCallback(2,
+          new ::grpc::internal::CallbackUnaryHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::grpc::ByteBuffer* request, ::grpc::ByteBuffer* response) { return this->deletekey(context, request, response); }));
+    }
+    ~WithRawCallbackMethod_deletekey() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status deletekey(::grpc::ServerContext* /*context*/, const ::chirp::DeleteRequest* /*request*/, ::chirp::DeleteReply* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerUnaryReactor* deletekey(
+      ::grpc::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/, ::grpc::ByteBuffer* /*response*/)  { return nullptr; }
+  };
+  template <class BaseClass>
+  class WithRawCallbackMethod_multiput : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawCallbackMethod_multiput() {
+      ::grpc::Service::MarkMethodRawCallback(3,
+          new ::grpc::internal::CallbackUnaryHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::grpc::ByteBuffer* request, ::grpc::ByteBuffer* response) { return this->multiput(context, request, response); }));
+    }
+    ~WithRawCallbackMethod_multiput() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status multiput(::grpc::ServerContext* /*context*/, const ::chirp::MultiPutRequest* /*request*/, ::chirp::MultiPutReply* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerUnaryReactor* multiput(
+      ::grpc::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/, ::grpc::ByteBuffer* /*response*/)  { return nullptr; }
+  };
+  template <class BaseClass>
+  class WithRawCallbackMethod_multidelete : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawCallbackMethod_multidelete() {
+      ::grpc::Service::MarkMethodRawCallback(4,
+          new ::grpc::internal::CallbackUnaryHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::grpc::ByteBuffer* request, ::grpc::ByteBuffer* response) { return this->multidelete(context, request, response); }));
+    }
+    ~WithRawCallbackMethod_multidelete() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status multidelete(::grpc::ServerContext* /*context*/, const ::chirp::MultiDeleteRequest* /*request*/, ::chirp::MultiDeleteReply* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerUnaryReactor* multidelete(
+      ::grpc::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/, ::grpc::ByteBuffer* /*response*/)  { return nullptr; }
+  };
+  template <class BaseClass>
+  class WithRawCallbackMethod_fetch_add : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawCallbackMethod_fetch_add() {
+      ::grpc::Service::MarkMethodRawCallback(5,
+          new ::grpc::internal::CallbackUnaryHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::grpc::ByteBuffer* request, ::grpc::ByteBuffer* response) { return this->fetch_add(context, request, response); }));
+    }
+    ~WithRawCallbackMethod_fetch_add() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status fetch_add(::grpc::ServerContext* /*context*/, const ::chirp::FetchAddRequest* /*request*/, ::chirp::FetchAddReply* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerUnaryReactor* fetch_add(
+      ::grpc::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/, ::grpc::ByteBuffer* /*response*/)  { return nullptr; }
+  };
+  template <class BaseClass>
+  class WithRawCallbackMethod_compare_and_swap : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawCallbackMethod_compare_and_swap() {
+      ::grpc::Service::MarkMethodRawCallback(6,
+          new ::grpc::internal::CallbackUnaryHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::grpc::ByteBuffer* request, ::grpc::ByteBuffer* response) { return this->compare_and_swap(context, request, response); }));
+    }
+    ~WithRawCallbackMethod_compare_and_swap() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status compare_and_swap(::grpc::ServerContext* /*context*/, const ::chirp::CompareAndSwapRequest* /*request*/, ::chirp::CompareAndSwapReply* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerUnaryReactor* compare_and_swap(
+      ::grpc::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/, ::grpc::ByteBuffer* /*response*/)  { return nullptr; }
+  };
+  template <class BaseClass>
+  class WithRawCallbackMethod_write_batch : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawCallbackMethod_write_batch() {
+      ::grpc::Service::MarkMethodRawCallback(7,
+          new ::grpc::internal::CallbackUnaryHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::grpc::ByteBuffer* request, ::grpc::ByteBuffer* response) { return this->write_batch(context, request, response); }));
+    }
+    ~WithRawCallbackMethod_write_batch() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status write_batch(::grpc::ServerContext* /*context*/, const ::chirp::WriteBatchRequest* /*request*/, ::chirp::WriteBatchReply* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerUnaryReactor* write_batch(
+      ::grpc::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/, ::grpc::ByteBuffer* /*response*/)  { return nullptr; }
+  };
+  template <class BaseClass>
+  class WithRawCallbackMethod_scan : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawCallbackMethod_scan() {
+      ::grpc::Service::MarkMethodRawCallback(8,
+          new ::grpc::internal::CallbackServerStreamingHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const::grpc::ByteBuffer* request) { return this->scan(context, request); }));
+    }
+    ~WithRawCallbackMethod_scan() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status scan(::grpc::ServerContext* /*context*/, const ::chirp::ScanRequest* /*request*/, ::grpc::ServerWriter< ::chirp::ScanReply>* /*writer*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerWriteReactor< ::grpc::ByteBuffer>* scan(
+      ::grpc::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/)  { return nullptr; }
+  };
+  template <class BaseClass>
+  class WithRawCallbackMethod_list_append : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawCallbackMethod_list_append() {
+      ::grpc::Service::MarkMethodRawCallback(9,
+          new ::grpc::internal::CallbackUnaryHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::grpc::ByteBuffer* request, ::grpc::ByteBuffer* response) { return this->list_append(context, request, response); }));
+    }
+    ~WithRawCallbackMethod_list_append() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status list_append(::grpc::ServerContext* /*context*/, const ::chirp::ListElementRequest* /*request*/, ::chirp::ListElementReply* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerUnaryReactor* list_append(
+      ::grpc::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/, ::grpc::ByteBuffer* /*response*/)  { return nullptr; }
+  };
+  template <class BaseClass>
+  class WithRawCallbackMethod_list_remove : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawCallbackMethod_list_remove() {
+      ::grpc::Service::MarkMethodRawCallback(10,
+          new ::grpc::internal::CallbackUnaryHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::grpc::ByteBuffer* request, ::grpc::ByteBuffer* response) { return this->list_remove(context, request, response); }));
+    }
+    ~WithRawCallbackMethod_list_remove() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status list_remove(::grpc::ServerContext* /*context*/, const ::chirp::ListElementRequest* /*request*/, ::chirp::ListElementReply* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerUnaryReactor* list_remove(
+      ::grpc::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/, ::grpc::ByteBuffer* /*response*/)  { return nullptr; }
+  };
+  template <class BaseClass>
+  class WithRawCallbackMethod_memory_usage : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawCallbackMethod_memory_usage() {
+      ::grpc::Service::MarkMethodRawCallback(11,
+          new ::grpc::internal::CallbackUnaryHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::grpc::ByteBuffer* request, ::grpc::ByteBuffer* response) { return this->memory_usage(context, request, response); }));
+    }
+    ~WithRawCallbackMethod_memory_usage() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status memory_usage(::grpc::ServerContext* /*context*/, const ::chirp::MemoryUsageRequest* /*request*/, ::chirp::MemoryUsageReply* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerUnaryReactor* memory_usage(
+      ::grpc::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/, ::grpc::ByteBuffer* /*response*/)  { return nullptr; }
+  };
+  template <class BaseClass>
+  class WithRawCallbackMethod_stats : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawCallbackMethod_stats() {
+      ::grpc::Service::MarkMethodRawCallback(12,
+          new ::grpc::internal::CallbackUnaryHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::grpc::ByteBuffer* request, ::grpc::ByteBuffer* response) { return this->stats(context, request, response); }));
+    }
+    ~WithRawCallbackMethod_stats() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status stats(::grpc::ServerContext* /*context*/, const ::chirp::StatsRequest* /*request*/, ::chirp::StatsReply* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerUnaryReactor* stats(
+      ::grpc::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/, ::grpc::ByteBuffer* /*response*/)  { return nullptr; }
+  };
+  template <class BaseClass>
+  class WithRawCallbackMethod_exists : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawCallbackMethod_exists() {
+      ::grpc::Service::MarkMethodRawCallback(13,
+          new ::grpc::internal::CallbackUnaryHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::grpc::ByteBuffer* request, ::grpc::ByteBuffer* response) { return this->exists(context, request, response); }));
+    }
+    ~WithRawCallbackMethod_exists() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status exists(::grpc::ServerContext* /*context*/, const ::chirp::ExistsRequest* /*request*/, ::chirp::ExistsReply* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerUnaryReactor* exists(
+      ::grpc::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/, ::grpc::ByteBuffer* /*response*/)  { return nullptr; }
+  };
+  template <class BaseClass>
+  class WithRawCallbackMethod_create_snapshot : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawCallbackMethod_create_snapshot() {
+      ::grpc::Service::MarkMethodRawCallback(14,
+          new ::grpc::internal::CallbackUnaryHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::grpc::ByteBuffer* request, ::grpc::ByteBuffer* response) { return this->create_snapshot(context, request, response); }));
+    }
+    ~WithRawCallbackMethod_create_snapshot() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status create_snapshot(::grpc::ServerContext* /*context*/, const ::chirp::CreateSnapshotRequest* /*request*/, ::chirp::CreateSnapshotReply* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerUnaryReactor* create_snapshot(
+      ::grpc::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/, ::grpc::ByteBuffer* /*response*/)  { return nullptr; }
+  };
+  template <class BaseClass>
+  class WithRawCallbackMethod_release_snapshot : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawCallbackMethod_release_snapshot() {
+      ::grpc::Service::MarkMethodRawCallback(15,
+          new ::grpc::internal::CallbackUnaryHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::grpc::ByteBuffer* request, ::grpc::ByteBuffer* response) { return this->release_snapshot(context, request, response); }));
+    }
+    ~WithRawCallbackMethod_release_snapshot() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status release_snapshot(::grpc::ServerContext* /*context*/, const ::chirp::ReleaseSnapshotRequest* /*request*/, ::chirp::ReleaseSnapshotReply* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerUnaryReactor* release_snapshot(
+      ::grpc::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/, ::grpc::ByteBuffer* /*response*/)  { return nullptr; }
+  };
+  template <class BaseClass>
+  class WithRawCallbackMethod_changes : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawCallbackMethod_changes() {
+      ::grpc::Service::MarkMethodRawCallback(16,
+          new ::grpc::internal::CallbackServerStreamingHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const::grpc::ByteBuffer* request) { return this->changes(context, request); }));
+    }
+    ~WithRawCallbackMethod_changes() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status changes(::grpc::ServerContext* /*context*/, const ::chirp::ChangesRequest* /*request*/, ::grpc::ServerWriter< ::chirp::ChangesReply>* /*writer*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerWriteReactor< ::grpc::ByteBuffer>* changes(
+      ::grpc::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/)  { return nullptr; }
+  };
+  template <class BaseClass>
+  class WithRawCallbackMethod_watch : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawCallbackMethod_watch() {
+      ::grpc::Service::MarkMethodRawCallback(17,
+          new ::grpc::internal::CallbackServerStreamingHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const::grpc::ByteBuffer* request) { return this->watch(context, request); }));
+    }
+    ~WithRawCallbackMethod_watch() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status watch(::grpc::ServerContext* /*context*/, const ::chirp::WatchRequest* /*request*/, ::grpc::ServerWriter< ::chirp::WatchReply>* /*writer*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerWriteReactor< ::grpc::ByteBuffer>* watch(
+      ::grpc::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/)  { return nullptr; }
+  };
+  template <class BaseClass>
+  class WithStreamedUnaryMethod_put : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithStreamedUnaryMethod_put() {
+      ::grpc::Service::MarkMethodStreamed(0,
+        new ::grpc::internal::StreamedUnaryHandler<
+          ::chirp::PutRequest, ::chirp::PutReply>(
+            [this](::grpc::ServerContext* context,
+                   ::grpc::ServerUnaryStreamer<
+                     ::chirp::PutRequest, ::chirp::PutReply>* streamer) {
+                       return this->Streamedput(context,
+                         streamer);
+                  }));
+    }
+    ~WithStreamedUnaryMethod_put() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable regular version of this method
+    ::grpc::Status put(::grpc::ServerContext* /*context*/, const ::chirp::PutRequest* /*request*/, ::chirp::PutReply* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    // replace default version of method with streamed unary
+    virtual ::grpc::Status Streamedput(::grpc::ServerContext* context, ::grpc::ServerUnaryStreamer< ::chirp::PutRequest,::chirp::PutReply>* server_unary_streamer) = 0;
+  };
+  template <class BaseClass>
+  class WithStreamedUnaryMethod_deletekey : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithStreamedUnaryMethod_deletekey() {
+      ::grpc::Service::MarkMethodStreamed(2,
+        new ::grpc::internal::StreamedUnaryHandler<
+          ::chirp::DeleteRequest, ::chirp::DeleteReply>(
+            [this](::grpc::ServerContext* context,
+                   ::grpc::ServerUnaryStreamer<
+                     ::chirp::DeleteRequest, ::chirp::DeleteReply>* streamer) {
+                       return this->Streameddeletekey(context,
+                         streamer);
+                  }));
+    }
+    ~WithStreamedUnaryMethod_deletekey() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable regular version of this method
+    ::grpc::Status deletekey(::grpc::ServerContext* /*context*/, const ::chirp::DeleteRequest* /*request*/, ::chirp::DeleteReply* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    // replace default version of method with streamed unary
+    virtual ::grpc::Status Streameddeletekey(::grpc::ServerContext* context, ::grpc::ServerUnaryStreamer< ::chirp::DeleteRequest,::chirp::DeleteReply>* server_unary_streamer) = 0;
+  };
+  template <class BaseClass>
+  class WithStreamedUnaryMethod_multiput : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithStreamedUnaryMethod_multiput() {
+      ::grpc::Service::MarkMethodStreamed(3,
+        new ::grpc::internal::StreamedUnaryHandler<
+          ::chirp::MultiPutRequest, ::chirp::MultiPutReply>(
+            [this](::grpc::ServerContext* context,
+                   ::grpc::ServerUnaryStreamer<
+                     ::chirp::MultiPutRequest, ::chirp::MultiPutReply>* streamer) {
+                       return this->Streamedmultiput(context,
+                         streamer);
+                  }));
+    }
+    ~WithStreamedUnaryMethod_multiput() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable regular version of this method
+    ::grpc::Status multiput(::grpc::ServerContext* /*context*/, const ::chirp::MultiPutRequest* /*request*/, ::chirp::MultiPutReply* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    // replace default version of method with streamed unary
+    virtual ::grpc::Status Streamedmultiput(::grpc::ServerContext* context, ::grpc::ServerUnaryStreamer< ::chirp::MultiPutRequest,::chirp::MultiPutReply>* server_unary_streamer) = 0;
+  };
+  template <class BaseClass>
+  class WithStreamedUnaryMethod_multidelete : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithStreamedUnaryMethod_multidelete() {
+      ::grpc::Service::MarkMethodStreamed(4,
+        new ::grpc::internal::StreamedUnaryHandler<
+          ::chirp::MultiDeleteRequest, ::chirp::MultiDeleteReply>(
+            [this](::grpc::ServerContext* context,
+                   ::grpc::ServerUnaryStreamer<
+                     ::chirp::MultiDeleteRequest, ::chirp::MultiDeleteReply>* streamer) {
+                       return this->Streamedmultidelete(context,
+                         streamer);
+                  }));
+    }
+    ~WithStreamedUnaryMethod_multidelete() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable regular version of this method
+    ::grpc::Status multidelete(::grpc::ServerContext* /*context*/, const ::chirp::MultiDeleteRequest* /*request*/, ::chirp::MultiDeleteReply* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    // replace default version of method with streamed unary
+    virtual ::grpc::Status Streamedmultidelete(::grpc::ServerContext* context, ::grpc::ServerUnaryStreamer< ::chirp::MultiDeleteRequest,::chirp::MultiDeleteReply>* server_unary_streamer) = 0;
+  };
+  template <class BaseClass>
+  class WithStreamedUnaryMethod_fetch_add : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithStreamedUnaryMethod_fetch_add() {
+      ::grpc::Service::MarkMethodStreamed(5,
+        new ::grpc::internal::StreamedUnaryHandler<
+          ::chirp::FetchAddRequest, ::chirp::FetchAddReply>(
+            [this](::grpc::ServerContext* context,
+                   ::grpc::ServerUnaryStreamer<
+                     ::chirp::FetchAddRequest, ::chirp::FetchAddReply>* streamer) {
+                       return this->Streamedfetch_add(context,
+                         streamer);
+                  }));
+    }
+    ~WithStreamedUnaryMethod_fetch_add() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable regular version of this method
+    ::grpc::Status fetch_add(::grpc::ServerContext* /*context*/, const ::chirp::FetchAddRequest* /*request*/, ::chirp::FetchAddReply* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    // replace default version of method with streamed unary
+    virtual ::grpc::Status Streamedfetch_add(::grpc::ServerContext* context, ::grpc::ServerUnaryStreamer< ::chirp::FetchAddRequest,::chirp::FetchAddReply>* server_unary_streamer) = 0;
+  };
+  template <class BaseClass>
+  class WithStreamedUnaryMethod_compare_and_swap : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithStreamedUnaryMethod_compare_and_swap() {
+      ::grpc::Service::MarkMethodStreamed(6,
+        new ::grpc::internal::StreamedUnaryHandler<
+          ::chirp::CompareAndSwapRequest, ::chirp::CompareAndSwapReply>(
+            [this](::grpc::ServerContext* context,
+                   ::grpc::ServerUnaryStreamer<
+                     ::chirp::CompareAndSwapRequest, ::chirp::CompareAndSwapReply>* streamer) {
+                       return this->Streamedcompare_and_swap(context,
+                         streamer);
+                  }));
+    }
+    ~WithStreamedUnaryMethod_compare_and_swap() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable regular version of this method
+    ::grpc::Status compare_and_swap(::grpc::ServerContext* /*context*/, const ::chirp::CompareAndSwapRequest* /*request*/, ::chirp::CompareAndSwapReply* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    // replace default version of method with streamed unary
+    virtual ::grpc::Status Streamedcompare_and_swap(::grpc::ServerContext* context, ::grpc::ServerUnaryStreamer< ::chirp::CompareAndSwapRequest,::chirp::CompareAndSwapReply>* server_unary_streamer) = 0;
+  };
+  template <class BaseClass>
+  class WithStreamedUnaryMethod_write_batch : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithStreamedUnaryMethod_write_batch() {
+      ::grpc::Service::MarkMethodStreamed(7,
+        new ::grpc::internal::StreamedUnaryHandler<
+          ::chirp::WriteBatchRequest, ::chirp::WriteBatchReply>(
+            [this](::grpc::ServerContext* context,
+                   ::grpc::ServerUnaryStreamer<
+                     ::chirp::WriteBatchRequest, ::chirp::WriteBatchReply>* streamer) {
+                       return this->Streamedwrite_batch(context,
+                         streamer);
+                  }));
+    }
+    ~WithStreamedUnaryMethod_write_batch() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable regular version of this method
+    ::grpc::Status write_batch(::grpc::ServerContext* /*context*/, const ::chirp::WriteBatchRequest* /*request*/, ::chirp::WriteBatchReply* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    // replace default version of method with streamed unary
+    virtual ::grpc::Status Streamedwrite_batch(::grpc::ServerContext* context, ::grpc::ServerUnaryStreamer< ::chirp::WriteBatchRequest,::chirp::WriteBatchReply>* server_unary_streamer) = 0;
+  };
+  template <class BaseClass>
+  class WithStreamedUnaryMethod_list_append : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithStreamedUnaryMethod_list_append() {
+      ::grpc::Service::MarkMethodStreamed(9,
+        new ::grpc::internal::StreamedUnaryHandler<
+          ::chirp::ListElementRequest, ::chirp::ListElementReply>(
+            [this](::grpc::ServerContext* context,
+                   ::grpc::ServerUnaryStreamer<
+                     ::chirp::ListElementRequest, ::chirp::ListElementReply>* streamer) {
+                       return this->Streamedlist_append(context,
+                         streamer);
+                  }));
+    }
+    ~WithStreamedUnaryMethod_list_append() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable regular version of this method
+    ::grpc::Status list_append(::grpc::ServerContext* /*context*/, const ::chirp::ListElementRequest* /*request*/, ::chirp::ListElementReply* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    // replace default version of method with streamed unary
+    virtual ::grpc::Status Streamedlist_append(::grpc::ServerContext* context, ::grpc::ServerUnaryStreamer< ::chirp::ListElementRequest,::chirp::ListElementReply>* server_unary_streamer) = 0;
+  };
+  template <class BaseClass>
+  class WithStreamedUnaryMethod_list_remove : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithStreamedUnaryMethod_list_remove() {
+      ::grpc::Service::MarkMethodStreamed(10,
+        new ::grpc::internal::StreamedUnaryHandler<
+          ::chirp::ListElementRequest, ::chirp::ListElementReply>(
+            [this](::grpc::ServerContext* context,
+                   ::grpc::ServerUnaryStreamer<
+                     ::chirp::ListElementRequest, ::chirp::ListElementReply>* streamer) {
+                       return this->Streamedlist_remove(context,
+                         streamer);
+                  }));
+    }
+    ~WithStreamedUnaryMethod_list_remove() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable regular version of this method
+    ::grpc::Status list_remove(::grpc::ServerContext* /*context*/, const ::chirp::ListElementRequest* /*request*/, ::chirp::ListElementReply* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    // replace default version of method with streamed unary
+    virtual ::grpc::Status Streamedlist_remove(::grpc::ServerContext* context, ::grpc::ServerUnaryStreamer< ::chirp::ListElementRequest,::chirp::ListElementReply>* server_unary_streamer) = 0;
+  };
+  template <class BaseClass>
+  class WithStreamedUnaryMethod_memory_usage : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithStreamedUnaryMethod_memory_usage() {
+      ::grpc::Service::MarkMethodStreamed(11,
+        new ::grpc::internal::StreamedUnaryHandler<
+          ::chirp::MemoryUsageRequest, ::chirp::MemoryUsageReply>(
+            [this](::grpc::ServerContext* context,
+                   ::grpc::ServerUnaryStreamer<
+                     ::chirp::MemoryUsageRequest, ::chirp::MemoryUsageReply>* streamer) {
+                       return this->Streamedmemory_usage(context,
+                         streamer);
+                  }));
+    }
+    ~WithStreamedUnaryMethod_memory_usage() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable regular version of this method
+    ::grpc::Status memory_usage(::grpc::ServerContext* /*context*/, const ::chirp::MemoryUsageRequest* /*request*/, ::chirp::MemoryUsageReply* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    // replace default version of method with streamed unary
+    virtual ::grpc::Status Streamedmemory_usage(::grpc::ServerContext* context, ::grpc::ServerUnaryStreamer< ::chirp::MemoryUsageRequest,::chirp::MemoryUsageReply>* server_unary_streamer) = 0;
+  };
+  template <class BaseClass>
+  class WithStreamedUnaryMethod_stats : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithStreamedUnaryMethod_stats() {
+      ::grpc::Service::MarkMethodStreamed(12,
+        new ::grpc::internal::StreamedUnaryHandler<
+          ::chirp::StatsRequest, ::chirp::StatsReply>(
+            [this](::grpc::ServerContext* context,
+                   ::grpc::ServerUnaryStreamer<
+                     ::chirp::StatsRequest, ::chirp::StatsReply>* streamer) {
+                       return this->Streamedstats(context,
+                         streamer);
+                  }));
+    }
+    ~WithStreamedUnaryMethod_stats() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable regular version of this method
+    ::grpc::Status stats(::grpc::ServerContext* /*context*/, const ::chirp::StatsRequest* /*request*/, ::chirp::StatsReply* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    // replace default version of method with streamed unary
+    virtual ::grpc::Status Streamedstats(::grpc::ServerContext* context, ::grpc::ServerUnaryStreamer< ::chirp::StatsRequest,::chirp::StatsReply>* server_unary_streamer) = 0;
+  };
+  template <class BaseClass>
+  class WithStreamedUnaryMethod_exists : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithStreamedUnaryMethod_exists() {
+      ::grpc::Service::MarkMethodStreamed(13,
+        new ::grpc::internal::StreamedUnaryHandler<
+          ::chirp::ExistsRequest, ::chirp::ExistsReply>(
+            [this](::grpc::ServerContext* context,
+                   ::grpc::ServerUnaryStreamer<
+                     ::chirp::ExistsRequest, ::chirp::ExistsReply>* streamer) {
+                       return this->Streamedexists(context,
+                         streamer);
+                  }));
+    }
+    ~WithStreamedUnaryMethod_exists() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable regular version of this method
+    ::grpc::Status exists(::grpc::ServerContext* /*context*/, const ::chirp::ExistsRequest* /*request*/, ::chirp::ExistsReply* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    // replace default version of method with streamed unary
+    virtual ::grpc::Status Streamedexists(::grpc::ServerContext* context, ::grpc::ServerUnaryStreamer< ::chirp::ExistsRequest,::chirp::ExistsReply>* server_unary_streamer) = 0;
+  };
+  template <class BaseClass>
+  class WithStreamedUnaryMethod_create_snapshot : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithStreamedUnaryMethod_create_snapshot() {
+      ::grpc::Service::MarkMethodStreamed(14,
+        new ::grpc::internal::StreamedUnaryHandler<
+          ::chirp::CreateSnapshotRequest, ::chirp::CreateSnapshotReply>(
+            [this](::grpc::ServerContext* context,
+                   ::grpc::ServerUnaryStreamer<
+                     ::chirp::CreateSnapshotRequest, ::chirp::CreateSnapshotReply>* streamer) {
+                       return this->Streamedcreate_snapshot(context,
+                         streamer);
+                  }));
+    }
+    ~WithStreamedUnaryMethod_create_snapshot() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable regular version of this method
+    ::grpc::Status create_snapshot(::grpc::ServerContext* /*context*/, const ::chirp::CreateSnapshotRequest* /*request*/, ::chirp::CreateSnapshotReply* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    // replace default version of method with streamed unary
+    virtual ::grpc::Status Streamedcreate_snapshot(::grpc::ServerContext* context, ::grpc::ServerUnaryStreamer< ::chirp::CreateSnapshotRequest,::chirp::CreateSnapshotReply>* server_unary_streamer) = 0;
+  };
+  template <class BaseClass>
+  class WithStreamedUnaryMethod_release_snapshot : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithStreamedUnaryMethod_release_snapshot() {
+      ::grpc::Service::MarkMethodStreamed(15,
+        new ::grpc::internal::StreamedUnaryHandler<
+          ::chirp::ReleaseSnapshotRequest, ::chirp::ReleaseSnapshotReply>(
+            [this](::grpc::ServerContext* context,
+                   ::grpc::ServerUnaryStreamer<
+                     ::chirp::ReleaseSnapshotRequest, ::chirp::ReleaseSnapshotReply>* streamer) {
+                       return this->Streamedrelease_snapshot(context,
+                         streamer);
+                  }));
+    }
+    ~WithStreamedUnaryMethod_release_snapshot() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable regular version of this method
+    ::grpc::Status release_snapshot(::grpc::ServerContext* /*context*/, const ::chirp::ReleaseSnapshotRequest* /*request*/, ::chirp::ReleaseSnapshotReply* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    // replace default version of method with streamed unary
+    virtual ::grpc::Status Streamedrelease_snapshot(::grpc::ServerContext* context, ::grpc::ServerUnaryStreamer< ::chirp::ReleaseSnapshotRequest,::chirp::ReleaseSnapshotReply>* server_unary_streamer) = 0;
+  };
+  typedef WithStreamedUnaryMethod_put<WithStreamedUnaryMethod_deletekey<WithStreamedUnaryMethod_multiput<WithStreamedUnaryMethod_multidelete<WithStreamedUnaryMethod_fetch_add<WithStreamedUnaryMethod_compare_and_swap<WithStreamedUnaryMethod_write_batch<WithStreamedUnaryMethod_list_append<WithStreamedUnaryMethod_list_remove<WithStreamedUnaryMethod_memory_usage<WithStreamedUnaryMethod_stats<WithStreamedUnaryMethod_exists<WithStreamedUnaryMethod_create_snapshot<WithStreamedUnaryMethod_release_snapshot<Service > > > > > > > > > > > > > > StreamedUnaryService;
+  template <class BaseClass>
+  class WithSplitStreamingMethod_scan : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithSplitStreamingMethod_scan() {
+      ::grpc::Service::MarkMethodStreamed(8,
+        new ::grpc::internal::SplitServerStreamingHandler<
+          ::chirp::ScanRequest, ::chirp::ScanReply>(
+            [this](::grpc::ServerContext* context,
+                   ::grpc::ServerSplitStreamer<
+                     ::chirp::ScanRequest, ::chirp::ScanReply>* streamer) {
+                       return this->Streamedscan(context,
+                         streamer);
+                  }));
+    }
+    ~WithSplitStreamingMethod_scan() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable regular version of this method
+    ::grpc::Status scan(::grpc::ServerContext* /*context*/, const ::chirp::ScanRequest* /*request*/, ::grpc::ServerWriter< ::chirp::ScanReply>* /*writer*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    // replace default version of method with split streamed
+    virtual ::grpc::Status Streamedscan(::grpc::ServerContext* context, ::grpc::ServerSplitStreamer< ::chirp::ScanRequest,::chirp::ScanReply>* server_split_streamer) = 0;
+  };
+  template <class BaseClass>
+  class WithSplitStreamingMethod_changes : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithSplitStreamingMethod_changes() {
+      ::grpc::Service::MarkMethodStreamed(16,
+        new ::grpc::internal::SplitServerStreamingHandler<
+          ::chirp::ChangesRequest, ::chirp::ChangesReply>(
+            [this](::grpc::ServerContext* context,
+                   ::grpc::ServerSplitStreamer<
+                     ::chirp::ChangesRequest, ::chirp::ChangesReply>* streamer) {
+                       return this->Streamedchanges(context,
+                         streamer);
+                  }));
+    }
+    ~WithSplitStreamingMethod_changes() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable regular version of this method
+    ::grpc::Status changes(::grpc::ServerContext* /*context*/, const ::chirp::ChangesRequest* /*request*/, ::grpc::ServerWriter< ::chirp::ChangesReply>* /*writer*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    // replace default version of method with split streamed
+    virtual ::grpc::Status Streamedchanges(::grpc::ServerContext* context, ::grpc::ServerSplitStreamer< ::chirp::ChangesRequest,::chirp::ChangesReply>* server_split_streamer) = 0;
+  };
+  template <class BaseClass>
+  class WithSplitStreamingMethod_watch : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithSplitStreamingMethod_watch() {
+      ::grpc::Service::MarkMethodStreamed(17,
+        new ::grpc::internal::SplitServerStreamingHandler<
+          ::chirp::WatchRequest, ::chirp::WatchReply>(
+            [this](::grpc::ServerContext* context,
+                   ::grpc::ServerSplitStreamer<
+                     ::chirp::WatchRequest, ::chirp::WatchReply>* streamer) {
+                       return this->Streamedwatch(context,
+                         streamer);
+                  }));
+    }
+    ~WithSplitStreamingMethod_watch() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable regular version of this method
+    ::grpc::Status watch(::grpc::ServerContext* /*context*/, const ::chirp::WatchRequest* /*request*/, ::grpc::ServerWriter< ::chirp::WatchReply>* /*writer*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    // replace default version of method with split streamed
+    virtual ::grpc::Status Streamedwatch(::grpc::ServerContext* context, ::grpc::ServerSplitStreamer< ::chirp::WatchRequest,::chirp::WatchReply>* server_split_streamer) = 0;
+  };
+  typedef WithSplitStreamingMethod_scan<WithSplitStreamingMethod_changes<WithSplitStreamingMethod_watch<Service > > > SplitStreamedService;
+  typedef WithStreamedUnaryMethod_put<WithStreamedUnaryMethod_deletekey<WithStreamedUnaryMethod_multiput<WithStreamedUnaryMethod_multidelete<WithStreamedUnaryMethod_fetch_add<WithStreamedUnaryMethod_compare_and_swap<WithStreamedUnaryMethod_write_batch<WithSplitStreamingMethod_scan<WithStreamedUnaryMethod_list_append<WithStreamedUnaryMethod_list_remove<WithStreamedUnaryMethod_memory_usage<WithStreamedUnaryMethod_stats<WithStreamedUnaryMethod_exists<WithStreamedUnaryMethod_create_snapshot<WithStreamedUnaryMethod_release_snapshot<WithSplitStreamingMethod_changes<WithSplitStreamingMethod_watch<Service > > > > > > > > > > > > > > > > > StreamedService;
+};
+
+class Replication final {
+ public:
+  static constexpr char const* service_full_name() {
+    return "chirp.Replication";
+  }
+  class StubInterface {
+   public:
+    virtual ~StubInterface() {}
+    std::unique_ptr< ::grpc::ClientReaderWriterInterface< ::chirp::ReplicationAck, ::chirp::ReplicationBatch>> replicate(::grpc::ClientContext* context) {
+      return std::unique_ptr< ::grpc::ClientReaderWriterInterface< ::chirp::ReplicationAck, ::chirp::ReplicationBatch>>(replicateRaw(context));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncReaderWriterInterface< ::chirp::ReplicationAck, ::chirp::ReplicationBatch>> Asyncreplicate(::grpc::ClientContext* context, ::grpc::CompletionQueue* cq, void* tag) {
+      return std::unique_ptr< ::grpc::ClientAsyncReaderWriterInterface< ::chirp::ReplicationAck, ::chirp::ReplicationBatch>>(AsyncreplicateRaw(context, cq, tag));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncReaderWriterInterface< ::chirp::ReplicationAck, ::chirp::ReplicationBatch>> PrepareAsyncreplicate(::grpc::ClientContext* context, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncReaderWriterInterface< ::chirp::ReplicationAck, ::chirp::ReplicationBatch>>(PrepareAsyncreplicateRaw(context, cq));
+    }
+    class async_interface {
+     public:
+      virtual ~async_interface() {}
+      virtual void replicate(::grpc::ClientContext* context, ::grpc::ClientBidiReactor< ::chirp::ReplicationAck,::chirp::ReplicationBatch>* reactor) = 0;
+    };
+    typedef class async_interface experimental_async_interface;
+    virtual class async_interface* async() { return nullptr; }
+    class async_interface* experimental_async() { return async(); }
+   private:
+    virtual ::grpc::ClientReaderWriterInterface< ::chirp::ReplicationAck, ::chirp::ReplicationBatch>* replicateRaw(::grpc::ClientContext* context) = 0;
+    virtual ::grpc::ClientAsyncReaderWriterInterface< ::chirp::ReplicationAck, ::chirp::ReplicationBatch>* AsyncreplicateRaw(::grpc::ClientContext* context, ::grpc::CompletionQueue* cq, void* tag) = 0;
+    virtual ::grpc::ClientAsyncReaderWriterInterface< ::chirp::ReplicationAck, ::chirp::ReplicationBatch>* PrepareAsyncreplicateRaw(::grpc::ClientContext* context, ::grpc::CompletionQueue* cq) = 0;
+  };
+  class Stub final : public StubInterface {
+   public:
+    Stub(const std::shared_ptr< ::grpc::ChannelInterface>& channel, const ::grpc::StubOptions& options = ::grpc::StubOptions());
+    std::unique_ptr< ::grpc::ClientReaderWriter< ::chirp::ReplicationAck, ::chirp::ReplicationBatch>> replicate(::grpc::ClientContext* context) {
+      return std::unique_ptr< ::grpc::ClientReaderWriter< ::chirp::ReplicationAck, ::chirp::ReplicationBatch>>(replicateRaw(context));
+    }
+    std::unique_ptr<  ::grpc::ClientAsyncReaderWriter< ::chirp::ReplicationAck, ::chirp::ReplicationBatch>> Asyncreplicate(::grpc::ClientContext* context, ::grpc::CompletionQueue* cq, void* tag) {
+      return std::unique_ptr< ::grpc::ClientAsyncReaderWriter< ::chirp::ReplicationAck, ::chirp::ReplicationBatch>>(AsyncreplicateRaw(context, cq, tag));
+    }
+    std::unique_ptr<  ::grpc::ClientAsyncReaderWriter< ::chirp::ReplicationAck, ::chirp::ReplicationBatch>> PrepareAsyncreplicate(::grpc::ClientContext* context, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncReaderWriter< ::chirp::ReplicationAck, ::chirp::ReplicationBatch>>(PrepareAsyncreplicateRaw(context, cq));
+    }
+    class async final :
+      public StubInterface::async_interface {
+     public:
+      void replicate(::grpc::ClientContext* context, ::grpc::ClientBidiReactor< ::chirp::ReplicationAck,::chirp::ReplicationBatch>* reactor) override;
+     private:
+      friend class Stub;
+      explicit async(Stub* stub): stub_(stub) { }
+      Stub* stub() { return stub_; }
+      Stub* stub_;
+    };
+    class async* async() override { return &async_stub_; }
+
+   private:
+    std::shared_ptr< ::grpc::ChannelInterface> channel_;
+    class async async_stub_{this};
+    ::grpc::ClientReaderWriter< ::chirp::ReplicationAck, ::chirp::ReplicationBatch>* replicateRaw(::grpc::ClientContext* context) override;
+    ::grpc::ClientAsyncReaderWriter< ::chirp::ReplicationAck, ::chirp::ReplicationBatch>* AsyncreplicateRaw(::grpc::ClientContext* context, ::grpc::CompletionQueue* cq, void* tag) override;
+    ::grpc::ClientAsyncReaderWriter< ::chirp::ReplicationAck, ::chirp::ReplicationBatch>* PrepareAsyncreplicateRaw(::grpc::ClientContext* context, ::grpc::CompletionQueue* cq) override;
+    const ::grpc::internal::RpcMethod rpcmethod_replicate_;
+  };
+  static std::unique_ptr<Stub> NewStub(const std::shared_ptr< ::grpc::ChannelInterface>& channel, const ::grpc::StubOptions& options = ::grpc::StubOptions());
+
+  class Service : public ::grpc::Service {
+   public:
+    Service();
+    virtual ~Service();
+    virtual ::grpc::Status replicate(::grpc::ServerContext* context, ::grpc::ServerReaderWriter< ::chirp::ReplicationBatch, ::chirp::ReplicationAck>* stream);
+  };
+  template <class BaseClass>
+  class WithAsyncMethod_replicate : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithAsyncMethod_replicate() {
+      ::grpc::Service::MarkMethodAsync(0);
+    }
+    ~WithAsyncMethod_replicate() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status replicate(::grpc::ServerContext* /*context*/, ::grpc::ServerReaderWriter< ::chirp::ReplicationBatch, ::chirp::ReplicationAck>* /*stream*/)  override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void Requestreplicate(::grpc::ServerContext* context, ::grpc::ServerAsyncReaderWriter< ::chirp::ReplicationBatch, ::chirp::ReplicationAck>* stream, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncBidiStreaming(0, context, stream, new_call_cq, notification_cq, tag);
+    }
+  };
+  typedef WithAsyncMethod_replicate<Service > AsyncService;
+  template <class BaseClass>
+  class WithCallbackMethod_replicate : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithCallbackMethod_replicate() {
+      ::grpc::Service::MarkMethodCallback(0,
+          new ::grpc::internal::CallbackBidiHandler< ::chirp::ReplicationAck, ::chirp::ReplicationBatch>(
+            [this](
+                   ::grpc::CallbackServerContext* context) { return this->replicate(context); }));
+    }
+    ~WithCallbackMethod_replicate() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status replicate(::grpc::ServerContext* /*context*/, ::grpc::ServerReaderWriter< ::chirp::ReplicationBatch, ::chirp::ReplicationAck>* /*stream*/)  override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerBidiReactor< ::chirp::ReplicationAck, ::chirp::ReplicationBatch>* replicate(
+      ::grpc::CallbackServerContext* /*context*/)
+      { return nullptr; }
+  };
+  typedef WithCallbackMethod_replicate<Service > CallbackService;
+  typedef CallbackService ExperimentalCallbackService;
+  template <class BaseClass>
+  class WithGenericMethod_replicate : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithGenericMethod_replicate() {
+      ::grpc::Service::MarkMethodGeneric(0);
+    }
+    ~WithGenericMethod_replicate() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status replicate(::grpc::ServerContext* /*context*/, ::grpc::ServerReaderWriter< ::chirp::ReplicationBatch, ::chirp::ReplicationAck>* /*stream*/)  override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+  };
+  template <class BaseClass>
+  class WithRawMethod_replicate : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawMethod_replicate() {
+      ::grpc::Service::MarkMethodRaw(0);
+    }
+    ~WithRawMethod_replicate() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status replicate(::grpc::ServerContext* /*context*/, ::grpc::ServerReaderWriter< ::chirp::ReplicationBatch, ::chirp::ReplicationAck>* /*stream*/)  override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void Requestreplicate(::grpc::ServerContext* context, ::grpc::ServerAsyncReaderWriter< ::grpc::ByteBuffer, ::grpc::ByteBuffer>* stream, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncBidiStreaming(0, context, stream, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithRawCallbackMethod_replicate : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawCallbackMethod_replicate() {
+      ::grpc::Service::MarkMethodRawCallback(0,
+          new ::grpc::internal::CallbackBidiHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
+            [this](
+                   ::grpc::CallbackServerContext* context) { return this->replicate(context); }));
+    }
+    ~WithRawCallbackMethod_replicate() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status replicate(::grpc::ServerContext* /*context*/, ::grpc::ServerReaderWriter< ::chirp::ReplicationBatch, ::chirp::ReplicationAck>* /*stream*/)  override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerBidiReactor< ::grpc::ByteBuffer, ::grpc::ByteBuffer>* replicate(
+      ::grpc::CallbackServerContext* /*context*/)
+      { return nullptr; }
+  };
+  typedef Service StreamedUnaryService;
+  typedef Service SplitStreamedService;
+  typedef Service StreamedService;
+};
+
+}  // namespace chirp
+
+
+#endif  // GRPC_key_5fvalue_2eproto__INCLUDED
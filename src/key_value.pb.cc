@@ -0,0 +1,10602 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: key_value.proto
+
+#include "key_value.pb.h"
+
+#include <algorithm>
+
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/extension_set.h>
+#include <google/protobuf/wire_format_lite.h>
+#include <google/protobuf/descriptor.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/reflection_ops.h>
+#include <google/protobuf/wire_format.h>
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+
+PROTOBUF_PRAGMA_INIT_SEG
+
+namespace _pb = ::PROTOBUF_NAMESPACE_ID;
+namespace _pbi = _pb::internal;
+
+namespace chirp {
+PROTOBUF_CONSTEXPR PutRequest::PutRequest(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.key_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.value_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.ttl_ms_)*/uint64_t{0u}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct PutRequestDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR PutRequestDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~PutRequestDefaultTypeInternal() {}
+  union {
+    PutRequest _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 PutRequestDefaultTypeInternal _PutRequest_default_instance_;
+PROTOBUF_CONSTEXPR PutReply::PutReply(
+    ::_pbi::ConstantInitialized) {}
+struct PutReplyDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR PutReplyDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~PutReplyDefaultTypeInternal() {}
+  union {
+    PutReply _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 PutReplyDefaultTypeInternal _PutReply_default_instance_;
+PROTOBUF_CONSTEXPR GetRequest::GetRequest(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.keys_)*/{}
+  , /*decltype(_impl_.key_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.snapshot_)*/uint64_t{0u}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct GetRequestDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR GetRequestDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~GetRequestDefaultTypeInternal() {}
+  union {
+    GetRequest _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 GetRequestDefaultTypeInternal _GetRequest_default_instance_;
+PROTOBUF_CONSTEXPR GetReply::GetReply(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.value_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct GetReplyDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR GetReplyDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~GetReplyDefaultTypeInternal() {}
+  union {
+    GetReply _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 GetReplyDefaultTypeInternal _GetReply_default_instance_;
+PROTOBUF_CONSTEXPR DeleteRequest::DeleteRequest(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.key_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct DeleteRequestDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR DeleteRequestDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~DeleteRequestDefaultTypeInternal() {}
+  union {
+    DeleteRequest _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 DeleteRequestDefaultTypeInternal _DeleteRequest_default_instance_;
+PROTOBUF_CONSTEXPR DeleteReply::DeleteReply(
+    ::_pbi::ConstantInitialized) {}
+struct DeleteReplyDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR DeleteReplyDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~DeleteReplyDefaultTypeInternal() {}
+  union {
+    DeleteReply _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 DeleteReplyDefaultTypeInternal _DeleteReply_default_instance_;
+PROTOBUF_CONSTEXPR MultiPutRequest::MultiPutRequest(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.pairs_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct MultiPutRequestDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR MultiPutRequestDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~MultiPutRequestDefaultTypeInternal() {}
+  union {
+    MultiPutRequest _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 MultiPutRequestDefaultTypeInternal _MultiPutRequest_default_instance_;
+PROTOBUF_CONSTEXPR MultiPutReply::MultiPutReply(
+    ::_pbi::ConstantInitialized) {}
+struct MultiPutReplyDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR MultiPutReplyDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~MultiPutReplyDefaultTypeInternal() {}
+  union {
+    MultiPutReply _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 MultiPutReplyDefaultTypeInternal _MultiPutReply_default_instance_;
+PROTOBUF_CONSTEXPR MultiDeleteRequest::MultiDeleteRequest(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.keys_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct MultiDeleteRequestDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR MultiDeleteRequestDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~MultiDeleteRequestDefaultTypeInternal() {}
+  union {
+    MultiDeleteRequest _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 MultiDeleteRequestDefaultTypeInternal _MultiDeleteRequest_default_instance_;
+PROTOBUF_CONSTEXPR MultiDeleteReply::MultiDeleteReply(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.num_of_deleted_)*/uint64_t{0u}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct MultiDeleteReplyDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR MultiDeleteReplyDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~MultiDeleteReplyDefaultTypeInternal() {}
+  union {
+    MultiDeleteReply _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 MultiDeleteReplyDefaultTypeInternal _MultiDeleteReply_default_instance_;
+PROTOBUF_CONSTEXPR FetchAddRequest::FetchAddRequest(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.key_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.delta_)*/uint64_t{0u}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct FetchAddRequestDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR FetchAddRequestDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~FetchAddRequestDefaultTypeInternal() {}
+  union {
+    FetchAddRequest _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 FetchAddRequestDefaultTypeInternal _FetchAddRequest_default_instance_;
+PROTOBUF_CONSTEXPR FetchAddReply::FetchAddReply(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.previous_)*/uint64_t{0u}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct FetchAddReplyDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR FetchAddReplyDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~FetchAddReplyDefaultTypeInternal() {}
+  union {
+    FetchAddReply _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 FetchAddReplyDefaultTypeInternal _FetchAddReply_default_instance_;
+PROTOBUF_CONSTEXPR CompareAndSwapRequest::CompareAndSwapRequest(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.key_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.expected_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.desired_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct CompareAndSwapRequestDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR CompareAndSwapRequestDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~CompareAndSwapRequestDefaultTypeInternal() {}
+  union {
+    CompareAndSwapRequest _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 CompareAndSwapRequestDefaultTypeInternal _CompareAndSwapRequest_default_instance_;
+PROTOBUF_CONSTEXPR CompareAndSwapReply::CompareAndSwapReply(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.actual_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.swapped_)*/false
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct CompareAndSwapReplyDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR CompareAndSwapReplyDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~CompareAndSwapReplyDefaultTypeInternal() {}
+  union {
+    CompareAndSwapReply _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 CompareAndSwapReplyDefaultTypeInternal _CompareAndSwapReply_default_instance_;
+PROTOBUF_CONSTEXPR ScanRequest::ScanRequest(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.start_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.end_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.limit_)*/uint64_t{0u}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct ScanRequestDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ScanRequestDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ScanRequestDefaultTypeInternal() {}
+  union {
+    ScanRequest _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ScanRequestDefaultTypeInternal _ScanRequest_default_instance_;
+PROTOBUF_CONSTEXPR ScanReply::ScanReply(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.pairs_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct ScanReplyDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ScanReplyDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ScanReplyDefaultTypeInternal() {}
+  union {
+    ScanReply _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ScanReplyDefaultTypeInternal _ScanReply_default_instance_;
+PROTOBUF_CONSTEXPR ListElementRequest::ListElementRequest(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.key_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.field_)*/0u
+  , /*decltype(_impl_.if_absent_)*/false
+  , /*decltype(_impl_.if_exists_)*/false
+  , /*decltype(_impl_.element_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_._oneof_case_)*/{}} {}
+struct ListElementRequestDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ListElementRequestDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ListElementRequestDefaultTypeInternal() {}
+  union {
+    ListElementRequest _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ListElementRequestDefaultTypeInternal _ListElementRequest_default_instance_;
+PROTOBUF_CONSTEXPR ListElementReply::ListElementReply(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.changed_)*/false
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct ListElementReplyDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ListElementReplyDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ListElementReplyDefaultTypeInternal() {}
+  union {
+    ListElementReply _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ListElementReplyDefaultTypeInternal _ListElementReply_default_instance_;
+PROTOBUF_CONSTEXPR MemoryUsageRequest::MemoryUsageRequest(
+    ::_pbi::ConstantInitialized) {}
+struct MemoryUsageRequestDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR MemoryUsageRequestDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~MemoryUsageRequestDefaultTypeInternal() {}
+  union {
+    MemoryUsageRequest _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 MemoryUsageRequestDefaultTypeInternal _MemoryUsageRequest_default_instance_;
+PROTOBUF_CONSTEXPR PrefixUsage::PrefixUsage(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.prefix_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.num_of_keys_)*/uint64_t{0u}
+  , /*decltype(_impl_.bytes_)*/uint64_t{0u}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct PrefixUsageDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR PrefixUsageDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~PrefixUsageDefaultTypeInternal() {}
+  union {
+    PrefixUsage _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 PrefixUsageDefaultTypeInternal _PrefixUsage_default_instance_;
+PROTOBUF_CONSTEXPR MemoryUsageReply::MemoryUsageReply(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.prefixes_)*/{}
+  , /*decltype(_impl_.storage_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.bytes_used_)*/uint64_t{0u}
+  , /*decltype(_impl_.memory_limit_)*/uint64_t{0u}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct MemoryUsageReplyDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR MemoryUsageReplyDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~MemoryUsageReplyDefaultTypeInternal() {}
+  union {
+    MemoryUsageReply _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 MemoryUsageReplyDefaultTypeInternal _MemoryUsageReply_default_instance_;
+PROTOBUF_CONSTEXPR StatsRequest::StatsRequest(
+    ::_pbi::ConstantInitialized) {}
+struct StatsRequestDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR StatsRequestDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~StatsRequestDefaultTypeInternal() {}
+  union {
+    StatsRequest _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 StatsRequestDefaultTypeInternal _StatsRequest_default_instance_;
+PROTOBUF_CONSTEXPR OperationStats::OperationStats(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.operation_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.count_)*/uint64_t{0u}
+  , /*decltype(_impl_.mean_ns_)*/uint64_t{0u}
+  , /*decltype(_impl_.p50_ns_)*/uint64_t{0u}
+  , /*decltype(_impl_.p90_ns_)*/uint64_t{0u}
+  , /*decltype(_impl_.p99_ns_)*/uint64_t{0u}
+  , /*decltype(_impl_.p999_ns_)*/uint64_t{0u}
+  , /*decltype(_impl_.max_ns_)*/uint64_t{0u}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct OperationStatsDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR OperationStatsDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~OperationStatsDefaultTypeInternal() {}
+  union {
+    OperationStats _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 OperationStatsDefaultTypeInternal _OperationStats_default_instance_;
+PROTOBUF_CONSTEXPR StatsReply::StatsReply(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.operations_)*/{}
+  , /*decltype(_impl_.prefixes_)*/{}
+  , /*decltype(_impl_.lock_contentions_)*/uint64_t{0u}
+  , /*decltype(_impl_.lock_wait_ns_)*/uint64_t{0u}
+  , /*decltype(_impl_.bytes_used_)*/uint64_t{0u}
+  , /*decltype(_impl_.num_of_backups_)*/uint64_t{0u}
+  , /*decltype(_impl_.num_of_backups_in_sync_)*/uint64_t{0u}
+  , /*decltype(_impl_.num_of_sync_timeouts_)*/uint64_t{0u}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct StatsReplyDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR StatsReplyDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~StatsReplyDefaultTypeInternal() {}
+  union {
+    StatsReply _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 StatsReplyDefaultTypeInternal _StatsReply_default_instance_;
+PROTOBUF_CONSTEXPR ExistsRequest::ExistsRequest(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.keys_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct ExistsRequestDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ExistsRequestDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ExistsRequestDefaultTypeInternal() {}
+  union {
+    ExistsRequest _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ExistsRequestDefaultTypeInternal _ExistsRequest_default_instance_;
+PROTOBUF_CONSTEXPR ExistsReply::ExistsReply(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.exists_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct ExistsReplyDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ExistsReplyDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ExistsReplyDefaultTypeInternal() {}
+  union {
+    ExistsReply _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ExistsReplyDefaultTypeInternal _ExistsReply_default_instance_;
+PROTOBUF_CONSTEXPR CreateSnapshotRequest::CreateSnapshotRequest(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.lease_ms_)*/uint64_t{0u}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct CreateSnapshotRequestDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR CreateSnapshotRequestDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~CreateSnapshotRequestDefaultTypeInternal() {}
+  union {
+    CreateSnapshotRequest _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 CreateSnapshotRequestDefaultTypeInternal _CreateSnapshotRequest_default_instance_;
+PROTOBUF_CONSTEXPR CreateSnapshotReply::CreateSnapshotReply(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.snapshot_)*/uint64_t{0u}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct CreateSnapshotReplyDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR CreateSnapshotReplyDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~CreateSnapshotReplyDefaultTypeInternal() {}
+  union {
+    CreateSnapshotReply _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 CreateSnapshotReplyDefaultTypeInternal _CreateSnapshotReply_default_instance_;
+PROTOBUF_CONSTEXPR ReleaseSnapshotRequest::ReleaseSnapshotRequest(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.snapshot_)*/uint64_t{0u}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct ReleaseSnapshotRequestDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ReleaseSnapshotRequestDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ReleaseSnapshotRequestDefaultTypeInternal() {}
+  union {
+    ReleaseSnapshotRequest _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ReleaseSnapshotRequestDefaultTypeInternal _ReleaseSnapshotRequest_default_instance_;
+PROTOBUF_CONSTEXPR ReleaseSnapshotReply::ReleaseSnapshotReply(
+    ::_pbi::ConstantInitialized) {}
+struct ReleaseSnapshotReplyDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ReleaseSnapshotReplyDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ReleaseSnapshotReplyDefaultTypeInternal() {}
+  union {
+    ReleaseSnapshotReply _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ReleaseSnapshotReplyDefaultTypeInternal _ReleaseSnapshotReply_default_instance_;
+PROTOBUF_CONSTEXPR ChangesRequest::ChangesRequest(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.prefix_filter_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.from_seq_)*/uint64_t{0u}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct ChangesRequestDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ChangesRequestDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ChangesRequestDefaultTypeInternal() {}
+  union {
+    ChangesRequest _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ChangesRequestDefaultTypeInternal _ChangesRequest_default_instance_;
+PROTOBUF_CONSTEXPR Change::Change(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.key_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.value_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.seq_)*/uint64_t{0u}
+  , /*decltype(_impl_.deleted_)*/false
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct ChangeDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ChangeDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ChangeDefaultTypeInternal() {}
+  union {
+    Change _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ChangeDefaultTypeInternal _Change_default_instance_;
+PROTOBUF_CONSTEXPR ChangesReply::ChangesReply(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.changes_)*/{}
+  , /*decltype(_impl_.next_seq_)*/uint64_t{0u}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct ChangesReplyDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ChangesReplyDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ChangesReplyDefaultTypeInternal() {}
+  union {
+    ChangesReply _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ChangesReplyDefaultTypeInternal _ChangesReply_default_instance_;
+PROTOBUF_CONSTEXPR WatchRequest::WatchRequest(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.prefixes_)*/{}
+  , /*decltype(_impl_.with_values_)*/false
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct WatchRequestDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR WatchRequestDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~WatchRequestDefaultTypeInternal() {}
+  union {
+    WatchRequest _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 WatchRequestDefaultTypeInternal _WatchRequest_default_instance_;
+PROTOBUF_CONSTEXPR WatchEvent::WatchEvent(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.key_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.value_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.deleted_)*/false
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct WatchEventDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR WatchEventDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~WatchEventDefaultTypeInternal() {}
+  union {
+    WatchEvent _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 WatchEventDefaultTypeInternal _WatchEvent_default_instance_;
+PROTOBUF_CONSTEXPR WatchReply::WatchReply(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.events_)*/{}
+  , /*decltype(_impl_.overflowed_)*/false
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct WatchReplyDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR WatchReplyDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~WatchReplyDefaultTypeInternal() {}
+  union {
+    WatchReply _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 WatchReplyDefaultTypeInternal _WatchReply_default_instance_;
+PROTOBUF_CONSTEXPR BatchCondition::BatchCondition(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.key_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.expected_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.exists_)*/false
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct BatchConditionDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR BatchConditionDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~BatchConditionDefaultTypeInternal() {}
+  union {
+    BatchCondition _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 BatchConditionDefaultTypeInternal _BatchCondition_default_instance_;
+PROTOBUF_CONSTEXPR BatchWrite::BatchWrite(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.write_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_._oneof_case_)*/{}} {}
+struct BatchWriteDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR BatchWriteDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~BatchWriteDefaultTypeInternal() {}
+  union {
+    BatchWrite _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 BatchWriteDefaultTypeInternal _BatchWrite_default_instance_;
+PROTOBUF_CONSTEXPR WriteBatchRequest::WriteBatchRequest(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.conditions_)*/{}
+  , /*decltype(_impl_.writes_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct WriteBatchRequestDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR WriteBatchRequestDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~WriteBatchRequestDefaultTypeInternal() {}
+  union {
+    WriteBatchRequest _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 WriteBatchRequestDefaultTypeInternal _WriteBatchRequest_default_instance_;
+PROTOBUF_CONSTEXPR WriteBatchReply::WriteBatchReply(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.actual_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.applied_)*/false
+  , /*decltype(_impl_.failed_condition_)*/0u
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct WriteBatchReplyDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR WriteBatchReplyDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~WriteBatchReplyDefaultTypeInternal() {}
+  union {
+    WriteBatchReply _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 WriteBatchReplyDefaultTypeInternal _WriteBatchReply_default_instance_;
+PROTOBUF_CONSTEXPR ReplicationRecord::ReplicationRecord(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.key_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.value_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.lsn_)*/uint64_t{0u}
+  , /*decltype(_impl_.operation_)*/0u
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct ReplicationRecordDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ReplicationRecordDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ReplicationRecordDefaultTypeInternal() {}
+  union {
+    ReplicationRecord _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ReplicationRecordDefaultTypeInternal _ReplicationRecord_default_instance_;
+PROTOBUF_CONSTEXPR ReplicationBatch::ReplicationBatch(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.pairs_)*/{}
+  , /*decltype(_impl_.records_)*/{}
+  , /*decltype(_impl_.lsn_)*/uint64_t{0u}
+  , /*decltype(_impl_.reset_)*/false
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct ReplicationBatchDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ReplicationBatchDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ReplicationBatchDefaultTypeInternal() {}
+  union {
+    ReplicationBatch _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ReplicationBatchDefaultTypeInternal _ReplicationBatch_default_instance_;
+PROTOBUF_CONSTEXPR ReplicationAck::ReplicationAck(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.applied_lsn_)*/uint64_t{0u}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct ReplicationAckDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ReplicationAckDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ReplicationAckDefaultTypeInternal() {}
+  union {
+    ReplicationAck _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ReplicationAckDefaultTypeInternal _ReplicationAck_default_instance_;
+}  // namespace chirp
+static ::_pb::Metadata file_level_metadata_key_5fvalue_2eproto[43];
+static constexpr ::_pb::EnumDescriptor const** file_level_enum_descriptors_key_5fvalue_2eproto = nullptr;
+static constexpr ::_pb::ServiceDescriptor const** file_level_service_descriptors_key_5fvalue_2eproto = nullptr;
+
+const uint32_t TableStruct_key_5fvalue_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::chirp::PutRequest, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::chirp::PutRequest, _impl_.key_),
+  PROTOBUF_FIELD_OFFSET(::chirp::PutRequest, _impl_.value_),
+  PROTOBUF_FIELD_OFFSET(::chirp::PutRequest, _impl_.ttl_ms_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::chirp::PutReply, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::chirp::GetRequest, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::chirp::GetRequest, _impl_.key_),
+  PROTOBUF_FIELD_OFFSET(::chirp::GetRequest, _impl_.keys_),
+  PROTOBUF_FIELD_OFFSET(::chirp::GetRequest, _impl_.snapshot_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::chirp::GetReply, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::chirp::GetReply, _impl_.value_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::chirp::DeleteRequest, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::chirp::DeleteRequest, _impl_.key_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::chirp::DeleteReply, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::chirp::MultiPutRequest, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::chirp::MultiPutRequest, _impl_.pairs_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::chirp::MultiPutReply, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::chirp::MultiDeleteRequest, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::chirp::MultiDeleteRequest, _impl_.keys_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::chirp::MultiDeleteReply, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::chirp::MultiDeleteReply, _impl_.num_of_deleted_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::chirp::FetchAddRequest, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::chirp::FetchAddRequest, _impl_.key_),
+  PROTOBUF_FIELD_OFFSET(::chirp::FetchAddRequest, _impl_.delta_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::chirp::FetchAddReply, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::chirp::FetchAddReply, _impl_.previous_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::chirp::CompareAndSwapRequest, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::chirp::CompareAndSwapRequest, _impl_.key_),
+  PROTOBUF_FIELD_OFFSET(::chirp::CompareAndSwapRequest, _impl_.expected_),
+  PROTOBUF_FIELD_OFFSET(::chirp::CompareAndSwapRequest, _impl_.desired_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::chirp::CompareAndSwapReply, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::chirp::CompareAndSwapReply, _impl_.swapped_),
+  PROTOBUF_FIELD_OFFSET(::chirp::CompareAndSwapReply, _impl_.actual_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::chirp::ScanRequest, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::chirp::ScanRequest, _impl_.start_),
+  PROTOBUF_FIELD_OFFSET(::chirp::ScanRequest, _impl_.end_),
+  PROTOBUF_FIELD_OFFSET(::chirp::ScanRequest, _impl_.limit_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::chirp::ScanReply, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::chirp::ScanReply, _impl_.pairs_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::chirp::ListElementRequest, _internal_metadata_),
+  ~0u,  // no _extensions_
+  PROTOBUF_FIELD_OFFSET(::chirp::ListElementRequest, _impl_._oneof_case_[0]),
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::chirp::ListElementRequest, _impl_.key_),
+  PROTOBUF_FIELD_OFFSET(::chirp::ListElementRequest, _impl_.field_),
+  ::_pbi::kInvalidFieldOffsetTag,
+  ::_pbi::kInvalidFieldOffsetTag,
+  PROTOBUF_FIELD_OFFSET(::chirp::ListElementRequest, _impl_.if_absent_),
+  PROTOBUF_FIELD_OFFSET(::chirp::ListElementRequest, _impl_.if_exists_),
+  PROTOBUF_FIELD_OFFSET(::chirp::ListElementRequest, _impl_.element_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::chirp::ListElementReply, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::chirp::ListElementReply, _impl_.changed_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::chirp::MemoryUsageRequest, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::chirp::PrefixUsage, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::chirp::PrefixUsage, _impl_.prefix_),
+  PROTOBUF_FIELD_OFFSET(::chirp::PrefixUsage, _impl_.num_of_keys_),
+  PROTOBUF_FIELD_OFFSET(::chirp::PrefixUsage, _impl_.bytes_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::chirp::MemoryUsageReply, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::chirp::MemoryUsageReply, _impl_.bytes_used_),
+  PROTOBUF_FIELD_OFFSET(::chirp::MemoryUsageReply, _impl_.memory_limit_),
+  PROTOBUF_FIELD_OFFSET(::chirp::MemoryUsageReply, _impl_.prefixes_),
+  PROTOBUF_FIELD_OFFSET(::chirp::MemoryUsageReply, _impl_.storage_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::chirp::StatsRequest, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::chirp::OperationStats, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::chirp::OperationStats, _impl_.operation_),
+  PROTOBUF_FIELD_OFFSET(::chirp::OperationStats, _impl_.count_),
+  PROTOBUF_FIELD_OFFSET(::chirp::OperationStats, _impl_.mean_ns_),
+  PROTOBUF_FIELD_OFFSET(::chirp::OperationStats, _impl_.p50_ns_),
+  PROTOBUF_FIELD_OFFSET(::chirp::OperationStats, _impl_.p90_ns_),
+  PROTOBUF_FIELD_OFFSET(::chirp::OperationStats, _impl_.p99_ns_),
+  PROTOBUF_FIELD_OFFSET(::chirp::OperationStats, _impl_.p999_ns_),
+  PROTOBUF_FIELD_OFFSET(::chirp::OperationStats, _impl_.max_ns_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::chirp::StatsReply, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::chirp::StatsReply, _impl_.operations_),
+  PROTOBUF_FIELD_OFFSET(::chirp::StatsReply, _impl_.lock_contentions_),
+  PROTOBUF_FIELD_OFFSET(::chirp::StatsReply, _impl_.lock_wait_ns_),
+  PROTOBUF_FIELD_OFFSET(::chirp::StatsReply, _impl_.bytes_used_),
+  PROTOBUF_FIELD_OFFSET(::chirp::StatsReply, _impl_.prefixes_),
+  PROTOBUF_FIELD_OFFSET(::chirp::StatsReply, _impl_.num_of_backups_),
+  PROTOBUF_FIELD_OFFSET(::chirp::StatsReply, _impl_.num_of_backups_in_sync_),
+  PROTOBUF_FIELD_OFFSET(::chirp::StatsReply, _impl_.num_of_sync_timeouts_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::chirp::ExistsRequest, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::chirp::ExistsRequest, _impl_.keys_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::chirp::ExistsReply, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::chirp::ExistsReply, _impl_.exists_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::chirp::CreateSnapshotRequest, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::chirp::CreateSnapshotRequest, _impl_.lease_ms_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::chirp::CreateSnapshotReply, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::chirp::CreateSnapshotReply, _impl_.snapshot_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::chirp::ReleaseSnapshotRequest, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::chirp::ReleaseSnapshotRequest, _impl_.snapshot_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::chirp::ReleaseSnapshotReply, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::chirp::ChangesRequest, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::chirp::ChangesRequest, _impl_.from_seq_),
+  PROTOBUF_FIELD_OFFSET(::chirp::ChangesRequest, _impl_.prefix_filter_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::chirp::Change, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::chirp::Change, _impl_.seq_),
+  PROTOBUF_FIELD_OFFSET(::chirp::Change, _impl_.deleted_),
+  PROTOBUF_FIELD_OFFSET(::chirp::Change, _impl_.key_),
+  PROTOBUF_FIELD_OFFSET(::chirp::Change, _impl_.value_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::chirp::ChangesReply, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::chirp::ChangesReply, _impl_.changes_),
+  PROTOBUF_FIELD_OFFSET(::chirp::ChangesReply, _impl_.next_seq_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::chirp::WatchRequest, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::chirp::WatchRequest, _impl_.prefixes_),
+  PROTOBUF_FIELD_OFFSET(::chirp::WatchRequest, _impl_.with_values_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::chirp::WatchEvent, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::chirp::WatchEvent, _impl_.key_),
+  PROTOBUF_FIELD_OFFSET(::chirp::WatchEvent, _impl_.deleted_),
+  PROTOBUF_FIELD_OFFSET(::chirp::WatchEvent, _impl_.value_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::chirp::WatchReply, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::chirp::WatchReply, _impl_.events_),
+  PROTOBUF_FIELD_OFFSET(::chirp::WatchReply, _impl_.overflowed_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::chirp::BatchCondition, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::chirp::BatchCondition, _impl_.key_),
+  PROTOBUF_FIELD_OFFSET(::chirp::BatchCondition, _impl_.expected_),
+  PROTOBUF_FIELD_OFFSET(::chirp::BatchCondition, _impl_.exists_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::chirp::BatchWrite, _internal_metadata_),
+  ~0u,  // no _extensions_
+  PROTOBUF_FIELD_OFFSET(::chirp::BatchWrite, _impl_._oneof_case_[0]),
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  ::_pbi::kInvalidFieldOffsetTag,
+  ::_pbi::kInvalidFieldOffsetTag,
+  ::_pbi::kInvalidFieldOffsetTag,
+  ::_pbi::kInvalidFieldOffsetTag,
+  PROTOBUF_FIELD_OFFSET(::chirp::BatchWrite, _impl_.write_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::chirp::WriteBatchRequest, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::chirp::WriteBatchRequest, _impl_.conditions_),
+  PROTOBUF_FIELD_OFFSET(::chirp::WriteBatchRequest, _impl_.writes_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::chirp::WriteBatchReply, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::chirp::WriteBatchReply, _impl_.applied_),
+  PROTOBUF_FIELD_OFFSET(::chirp::WriteBatchReply, _impl_.failed_condition_),
+  PROTOBUF_FIELD_OFFSET(::chirp::WriteBatchReply, _impl_.actual_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::chirp::ReplicationRecord, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::chirp::ReplicationRecord, _impl_.lsn_),
+  PROTOBUF_FIELD_OFFSET(::chirp::ReplicationRecord, _impl_.operation_),
+  PROTOBUF_FIELD_OFFSET(::chirp::ReplicationRecord, _impl_.key_),
+  PROTOBUF_FIELD_OFFSET(::chirp::ReplicationRecord, _impl_.value_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::chirp::ReplicationBatch, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::chirp::ReplicationBatch, _impl_.reset_),
+  PROTOBUF_FIELD_OFFSET(::chirp::ReplicationBatch, _impl_.pairs_),
+  PROTOBUF_FIELD_OFFSET(::chirp::ReplicationBatch, _impl_.records_),
+  PROTOBUF_FIELD_OFFSET(::chirp::ReplicationBatch, _impl_.lsn_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::chirp::ReplicationAck, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::chirp::ReplicationAck, _impl_.applied_lsn_),
+};
+static const ::_pbi::MigrationSchema schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  { 0, -1, -1, sizeof(::chirp::PutRequest)},
+  { 9, -1, -1, sizeof(::chirp::PutReply)},
+  { 15, -1, -1, sizeof(::chirp::GetRequest)},
+  { 24, -1, -1, sizeof(::chirp::GetReply)},
+  { 31, -1, -1, sizeof(::chirp::DeleteRequest)},
+  { 38, -1, -1, sizeof(::chirp::DeleteReply)},
+  { 44, -1, -1, sizeof(::chirp::MultiPutRequest)},
+  { 51, -1, -1, sizeof(::chirp::MultiPutReply)},
+  { 57, -1, -1, sizeof(::chirp::MultiDeleteRequest)},
+  { 64, -1, -1, sizeof(::chirp::MultiDeleteReply)},
+  { 71, -1, -1, sizeof(::chirp::FetchAddRequest)},
+  { 79, -1, -1, sizeof(::chirp::FetchAddReply)},
+  { 86, -1, -1, sizeof(::chirp::CompareAndSwapRequest)},
+  { 95, -1, -1, sizeof(::chirp::CompareAndSwapReply)},
+  { 103, -1, -1, sizeof(::chirp::ScanRequest)},
+  { 112, -1, -1, sizeof(::chirp::ScanReply)},
+  { 119, -1, -1, sizeof(::chirp::ListElementRequest)},
+  { 132, -1, -1, sizeof(::chirp::ListElementReply)},
+  { 139, -1, -1, sizeof(::chirp::MemoryUsageRequest)},
+  { 145, -1, -1, sizeof(::chirp::PrefixUsage)},
+  { 154, -1, -1, sizeof(::chirp::MemoryUsageReply)},
+  { 164, -1, -1, sizeof(::chirp::StatsRequest)},
+  { 170, -1, -1, sizeof(::chirp::OperationStats)},
+  { 184, -1, -1, sizeof(::chirp::StatsReply)},
+  { 198, -1, -1, sizeof(::chirp::ExistsRequest)},
+  { 205, -1, -1, sizeof(::chirp::ExistsReply)},
+  { 212, -1, -1, sizeof(::chirp::CreateSnapshotRequest)},
+  { 219, -1, -1, sizeof(::chirp::CreateSnapshotReply)},
+  { 226, -1, -1, sizeof(::chirp::ReleaseSnapshotRequest)},
+  { 233, -1, -1, sizeof(::chirp::ReleaseSnapshotReply)},
+  { 239, -1, -1, sizeof(::chirp::ChangesRequest)},
+  { 247, -1, -1, sizeof(::chirp::Change)},
+  { 257, -1, -1, sizeof(::chirp::ChangesReply)},
+  { 265, -1, -1, sizeof(::chirp::WatchRequest)},
+  { 273, -1, -1, sizeof(::chirp::WatchEvent)},
+  { 282, -1, -1, sizeof(::chirp::WatchReply)},
+  { 290, -1, -1, sizeof(::chirp::BatchCondition)},
+  { 299, -1, -1, sizeof(::chirp::BatchWrite)},
+  { 310, -1, -1, sizeof(::chirp::WriteBatchRequest)},
+  { 318, -1, -1, sizeof(::chirp::WriteBatchReply)},
+  { 327, -1, -1, sizeof(::chirp::ReplicationRecord)},
+  { 337, -1, -1, sizeof(::chirp::ReplicationBatch)},
+  { 347, -1, -1, sizeof(::chirp::ReplicationAck)},
+};
+
+static const ::_pb::Message* const file_default_instances[] = {
+  &::chirp::_PutRequest_default_instance_._instance,
+  &::chirp::_PutReply_default_instance_._instance,
+  &::chirp::_GetRequest_default_instance_._instance,
+  &::chirp::_GetReply_default_instance_._instance,
+  &::chirp::_DeleteRequest_default_instance_._instance,
+  &::chirp::_DeleteReply_default_instance_._instance,
+  &::chirp::_MultiPutRequest_default_instance_._instance,
+  &::chirp::_MultiPutReply_default_instance_._instance,
+  &::chirp::_MultiDeleteRequest_default_instance_._instance,
+  &::chirp::_MultiDeleteReply_default_instance_._instance,
+  &::chirp::_FetchAddRequest_default_instance_._instance,
+  &::chirp::_FetchAddReply_default_instance_._instance,
+  &::chirp::_CompareAndSwapRequest_default_instance_._instance,
+  &::chirp::_CompareAndSwapReply_default_instance_._instance,
+  &::chirp::_ScanRequest_default_instance_._instance,
+  &::chirp::_ScanReply_default_instance_._instance,
+  &::chirp::_ListElementRequest_default_instance_._instance,
+  &::chirp::_ListElementReply_default_instance_._instance,
+  &::chirp::_MemoryUsageRequest_default_instance_._instance,
+  &::chirp::_PrefixUsage_default_instance_._instance,
+  &::chirp::_MemoryUsageReply_default_instance_._instance,
+  &::chirp::_StatsRequest_default_instance_._instance,
+  &::chirp::_OperationStats_default_instance_._instance,
+  &::chirp::_StatsReply_default_instance_._instance,
+  &::chirp::_ExistsRequest_default_instance_._instance,
+  &::chirp::_ExistsReply_default_instance_._instance,
+  &::chirp::_CreateSnapshotRequest_default_instance_._instance,
+  &::chirp::_CreateSnapshotReply_default_instance_._instance,
+  &::chirp::_ReleaseSnapshotRequest_default_instance_._instance,
+  &::chirp::_ReleaseSnapshotReply_default_instance_._instance,
+  &::chirp::_ChangesRequest_default_instance_._instance,
+  &::chirp::_Change_default_instance_._instance,
+  &::chirp::_ChangesReply_default_instance_._instance,
+  &::chirp::_WatchRequest_default_instance_._instance,
+  &::chirp::_WatchEvent_default_instance_._instance,
+  &::chirp::_WatchReply_default_instance_._instance,
+  &::chirp::_BatchCondition_default_instance_._instance,
+  &::chirp::_BatchWrite_default_instance_._instance,
+  &::chirp::_WriteBatchRequest_default_instance_._instance,
+  &::chirp::_WriteBatchReply_default_instance_._instance,
+  &::chirp::_ReplicationRecord_default_instance_._instance,
+  &::chirp::_ReplicationBatch_default_instance_._instance,
+  &::chirp::_ReplicationAck_default_instance_._instance,
+};
+
+const char descriptor_table_protodef_key_5fvalue_2eproto[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) =
+  "\n\017key_value.proto\022\005chirp\"8\n\nPutRequest\022\013"
+  "\n\003key\030\001 \001(\014\022\r\n\005value\030\002 \001(\014\022\016\n\006ttl_ms\030\003 \001"
+  "(\004\"\n\n\010PutReply\"9\n\nGetRequest\022\013\n\003key\030\001 \001("
+  "\014\022\014\n\004keys\030\002 \003(\014\022\020\n\010snapshot\030\003 \001(\004\"\031\n\010Get"
+  "Reply\022\r\n\005value\030\001 \001(\014\"\034\n\rDeleteRequest\022\013\n"
+  "\003key\030\001 \001(\014\"\r\n\013DeleteReply\"3\n\017MultiPutReq"
+  "uest\022 \n\005pairs\030\001 \003(\0132\021.chirp.PutRequest\"\017"
+  "\n\rMultiPutReply\"\"\n\022MultiDeleteRequest\022\014\n"
+  "\004keys\030\001 \003(\014\"*\n\020MultiDeleteReply\022\026\n\016num_o"
+  "f_deleted\030\001 \001(\004\"-\n\017FetchAddRequest\022\013\n\003ke"
+  "y\030\001 \001(\014\022\r\n\005delta\030\002 \001(\004\"!\n\rFetchAddReply\022"
+  "\020\n\010previous\030\001 \001(\004\"G\n\025CompareAndSwapReque"
+  "st\022\013\n\003key\030\001 \001(\014\022\020\n\010expected\030\002 \001(\014\022\017\n\007des"
+  "ired\030\003 \001(\014\"6\n\023CompareAndSwapReply\022\017\n\007swa"
+  "pped\030\001 \001(\010\022\016\n\006actual\030\002 \001(\014\"8\n\013ScanReques"
+  "t\022\r\n\005start\030\001 \001(\014\022\013\n\003end\030\002 \001(\014\022\r\n\005limit\030\003"
+  " \001(\004\"-\n\tScanReply\022 \n\005pairs\030\001 \003(\0132\021.chirp"
+  ".PutRequest\"\225\001\n\022ListElementRequest\022\013\n\003ke"
+  "y\030\001 \001(\014\022\r\n\005field\030\002 \001(\r\022\030\n\016uint64_element"
+  "\030\003 \001(\004H\000\022\030\n\016string_element\030\004 \001(\014H\000\022\021\n\tif"
+  "_absent\030\005 \001(\010\022\021\n\tif_exists\030\006 \001(\010B\t\n\007elem"
+  "ent\"#\n\020ListElementReply\022\017\n\007changed\030\001 \001(\010"
+  "\"\024\n\022MemoryUsageRequest\"A\n\013PrefixUsage\022\016\n"
+  "\006prefix\030\001 \001(\014\022\023\n\013num_of_keys\030\002 \001(\004\022\r\n\005by"
+  "tes\030\003 \001(\004\"s\n\020MemoryUsageReply\022\022\n\nbytes_u"
+  "sed\030\001 \001(\004\022\024\n\014memory_limit\030\002 \001(\004\022$\n\010prefi"
+  "xes\030\003 \003(\0132\022.chirp.PrefixUsage\022\017\n\007storage"
+  "\030\004 \001(\t\"\016\n\014StatsRequest\"\224\001\n\016OperationStat"
+  "s\022\021\n\toperation\030\001 \001(\t\022\r\n\005count\030\002 \001(\004\022\017\n\007m"
+  "ean_ns\030\003 \001(\004\022\016\n\006p50_ns\030\004 \001(\004\022\016\n\006p90_ns\030\005"
+  " \001(\004\022\016\n\006p99_ns\030\006 \001(\004\022\017\n\007p999_ns\030\007 \001(\004\022\016\n"
+  "\006max_ns\030\010 \001(\004\"\367\001\n\nStatsReply\022)\n\noperatio"
+  "ns\030\001 \003(\0132\025.chirp.OperationStats\022\030\n\020lock_"
+  "contentions\030\002 \001(\004\022\024\n\014lock_wait_ns\030\003 \001(\004\022"
+  "\022\n\nbytes_used\030\004 \001(\004\022$\n\010prefixes\030\005 \003(\0132\022."
+  "chirp.PrefixUsage\022\026\n\016num_of_backups\030\006 \001("
+  "\004\022\036\n\026num_of_backups_in_sync\030\007 \001(\004\022\034\n\024num"
+  "_of_sync_timeouts\030\010 \001(\004\"\035\n\rExistsRequest"
+  "\022\014\n\004keys\030\001 \003(\014\"\035\n\013ExistsReply\022\016\n\006exists\030"
+  "\001 \003(\010\")\n\025CreateSnapshotRequest\022\020\n\010lease_"
+  "ms\030\001 \001(\004\"\'\n\023CreateSnapshotReply\022\020\n\010snaps"
+  "hot\030\001 \001(\004\"*\n\026ReleaseSnapshotRequest\022\020\n\010s"
+  "napshot\030\001 \001(\004\"\026\n\024ReleaseSnapshotReply\"9\n"
+  "\016ChangesRequest\022\020\n\010from_seq\030\001 \001(\004\022\025\n\rpre"
+  "fix_filter\030\002 \001(\014\"B\n\006Change\022\013\n\003seq\030\001 \001(\004\022"
+  "\017\n\007deleted\030\002 \001(\010\022\013\n\003key\030\003 \001(\014\022\r\n\005value\030\004"
+  " \001(\014\"@\n\014ChangesReply\022\036\n\007changes\030\001 \003(\0132\r."
+  "chirp.Change\022\020\n\010next_seq\030\002 \001(\004\"5\n\014WatchR"
+  "equest\022\020\n\010prefixes\030\001 \003(\014\022\023\n\013with_values\030"
+  "\002 \001(\010\"9\n\nWatchEvent\022\013\n\003key\030\001 \001(\014\022\017\n\007dele"
+  "ted\030\002 \001(\010\022\r\n\005value\030\003 \001(\014\"C\n\nWatchReply\022!"
+  "\n\006events\030\001 \003(\0132\021.chirp.WatchEvent\022\022\n\nove"
+  "rflowed\030\002 \001(\010\"\?\n\016BatchCondition\022\013\n\003key\030\001"
+  " \001(\014\022\020\n\010expected\030\002 \001(\014\022\016\n\006exists\030\003 \001(\010\"\307"
+  "\001\n\nBatchWrite\022 \n\003put\030\001 \001(\0132\021.chirp.PutRe"
+  "questH\000\022*\n\ndelete_key\030\002 \001(\0132\024.chirp.Dele"
+  "teRequestH\000\0220\n\013list_append\030\003 \001(\0132\031.chirp"
+  ".ListElementRequestH\000\0220\n\013list_remove\030\004 \001"
+  "(\0132\031.chirp.ListElementRequestH\000B\007\n\005write"
+  "\"a\n\021WriteBatchRequest\022)\n\nconditions\030\001 \003("
+  "\0132\025.chirp.BatchCondition\022!\n\006writes\030\002 \003(\013"
+  "2\021.chirp.BatchWrite\"L\n\017WriteBatchReply\022\017"
+  "\n\007applied\030\001 \001(\010\022\030\n\020failed_condition\030\002 \001("
+  "\r\022\016\n\006actual\030\003 \001(\014\"O\n\021ReplicationRecord\022\013"
+  "\n\003lsn\030\001 \001(\004\022\021\n\toperation\030\002 \001(\r\022\013\n\003key\030\003 "
+  "\001(\014\022\r\n\005value\030\004 \001(\014\"{\n\020ReplicationBatch\022\r"
+  "\n\005reset\030\001 \001(\010\022 \n\005pairs\030\002 \003(\0132\021.chirp.Put"
+  "Request\022)\n\007records\030\003 \003(\0132\030.chirp.Replica"
+  "tionRecord\022\013\n\003lsn\030\004 \001(\004\"%\n\016ReplicationAc"
+  "k\022\023\n\013applied_lsn\030\001 \001(\0042\363\010\n\rKeyValueStore"
+  "\022+\n\003put\022\021.chirp.PutRequest\032\017.chirp.PutRe"
+  "ply\"\000\022/\n\003get\022\021.chirp.GetRequest\032\017.chirp."
+  "GetReply\"\000(\0010\001\0227\n\tdeletekey\022\024.chirp.Dele"
+  "teRequest\032\022.chirp.DeleteReply\"\000\022:\n\010multi"
+  "put\022\026.chirp.MultiPutRequest\032\024.chirp.Mult"
+  "iPutReply\"\000\022C\n\013multidelete\022\031.chirp.Multi"
+  "DeleteRequest\032\027.chirp.MultiDeleteReply\"\000"
+  "\022;\n\tfetch_add\022\026.chirp.FetchAddRequest\032\024."
+  "chirp.FetchAddReply\"\000\022N\n\020compare_and_swa"
+  "p\022\034.chirp.CompareAndSwapRequest\032\032.chirp."
+  "CompareAndSwapReply\"\000\022A\n\013write_batch\022\030.c"
+  "hirp.WriteBatchRequest\032\026.chirp.WriteBatc"
+  "hReply\"\000\0220\n\004scan\022\022.chirp.ScanRequest\032\020.c"
+  "hirp.ScanReply\"\0000\001\022C\n\013list_append\022\031.chir"
+  "p.ListElementRequest\032\027.chirp.ListElement"
+  "Reply\"\000\022C\n\013list_remove\022\031.chirp.ListEleme"
+  "ntRequest\032\027.chirp.ListElementReply\"\000\022D\n\014"
+  "memory_usage\022\031.chirp.MemoryUsageRequest\032"
+  "\027.chirp.MemoryUsageReply\"\000\0221\n\005stats\022\023.ch"
+  "irp.StatsRequest\032\021.chirp.StatsReply\"\000\0224\n"
+  "\006exists\022\024.chirp.ExistsRequest\032\022.chirp.Ex"
+  "istsReply\"\000\022M\n\017create_snapshot\022\034.chirp.C"
+  "reateSnapshotRequest\032\032.chirp.CreateSnaps"
+  "hotReply\"\000\022P\n\020release_snapshot\022\035.chirp.R"
+  "eleaseSnapshotRequest\032\033.chirp.ReleaseSna"
+  "pshotReply\"\000\0229\n\007changes\022\025.chirp.ChangesR"
+  "equest\032\023.chirp.ChangesReply\"\0000\001\0223\n\005watch"
+  "\022\023.chirp.WatchRequest\032\021.chirp.WatchReply"
+  "\"\0000\0012P\n\013Replication\022A\n\treplicate\022\025.chirp"
+  ".ReplicationAck\032\027.chirp.ReplicationBatch"
+  "\"\000(\0010\001b\006proto3"
+  ;
+static ::_pbi::once_flag descriptor_table_key_5fvalue_2eproto_once;
+const ::_pbi::DescriptorTable descriptor_table_key_5fvalue_2eproto = {
+    false, false, 4014, descriptor_table_protodef_key_5fvalue_2eproto,
+    "key_value.proto",
+    &descriptor_table_key_5fvalue_2eproto_once, nullptr, 0, 43,
+    schemas, file_default_instances, TableStruct_key_5fvalue_2eproto::offsets,
+    file_level_metadata_key_5fvalue_2eproto, file_level_enum_descriptors_key_5fvalue_2eproto,
+    file_level_service_descriptors_key_5fvalue_2eproto,
+};
+PROTOBUF_ATTRIBUTE_WEAK const ::_pbi::DescriptorTable* descriptor_table_key_5fvalue_2eproto_getter() {
+  return &descriptor_table_key_5fvalue_2eproto;
+}
+
+// Force running AddDescriptors() at dynamic initialization time.
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 static ::_pbi::AddDescriptorsRunner dynamic_init_dummy_key_5fvalue_2eproto(&descriptor_table_key_5fvalue_2eproto);
+namespace chirp {
+
+// ===================================================================
+
+class PutRequest::_Internal {
+ public:
+};
+
+PutRequest::PutRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:chirp.PutRequest)
+}
+PutRequest::PutRequest(const PutRequest& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  PutRequest* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.key_){}
+    , decltype(_impl_.value_){}
+    , decltype(_impl_.ttl_ms_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.key_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.key_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_key().empty()) {
+    _this->_impl_.key_.Set(from._internal_key(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.value_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.value_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_value().empty()) {
+    _this->_impl_.value_.Set(from._internal_value(), 
+      _this->GetArenaForAllocation());
+  }
+  _this->_impl_.ttl_ms_ = from._impl_.ttl_ms_;
+  // @@protoc_insertion_point(copy_constructor:chirp.PutRequest)
+}
+
+inline void PutRequest::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.key_){}
+    , decltype(_impl_.value_){}
+    , decltype(_impl_.ttl_ms_){uint64_t{0u}}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.key_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.key_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.value_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.value_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+PutRequest::~PutRequest() {
+  // @@protoc_insertion_point(destructor:chirp.PutRequest)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void PutRequest::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.key_.Destroy();
+  _impl_.value_.Destroy();
+}
+
+void PutRequest::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void PutRequest::Clear() {
+// @@protoc_insertion_point(message_clear_start:chirp.PutRequest)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.key_.ClearToEmpty();
+  _impl_.value_.ClearToEmpty();
+  _impl_.ttl_ms_ = uint64_t{0u};
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* PutRequest::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // bytes key = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_key();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // bytes value = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_value();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 ttl_ms = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _impl_.ttl_ms_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* PutRequest::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:chirp.PutRequest)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // bytes key = 1;
+  if (!this->_internal_key().empty()) {
+    target = stream->WriteBytesMaybeAliased(
+        1, this->_internal_key(), target);
+  }
+
+  // bytes value = 2;
+  if (!this->_internal_value().empty()) {
+    target = stream->WriteBytesMaybeAliased(
+        2, this->_internal_value(), target);
+  }
+
+  // uint64 ttl_ms = 3;
+  if (this->_internal_ttl_ms() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(3, this->_internal_ttl_ms(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:chirp.PutRequest)
+  return target;
+}
+
+size_t PutRequest::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:chirp.PutRequest)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // bytes key = 1;
+  if (!this->_internal_key().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_key());
+  }
+
+  // bytes value = 2;
+  if (!this->_internal_value().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_value());
+  }
+
+  // uint64 ttl_ms = 3;
+  if (this->_internal_ttl_ms() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_ttl_ms());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData PutRequest::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    PutRequest::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*PutRequest::GetClassData() const { return &_class_data_; }
+
+
+void PutRequest::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<PutRequest*>(&to_msg);
+  auto& from = static_cast<const PutRequest&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:chirp.PutRequest)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_key().empty()) {
+    _this->_internal_set_key(from._internal_key());
+  }
+  if (!from._internal_value().empty()) {
+    _this->_internal_set_value(from._internal_value());
+  }
+  if (from._internal_ttl_ms() != 0) {
+    _this->_internal_set_ttl_ms(from._internal_ttl_ms());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void PutRequest::CopyFrom(const PutRequest& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:chirp.PutRequest)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool PutRequest::IsInitialized() const {
+  return true;
+}
+
+void PutRequest::InternalSwap(PutRequest* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.key_, lhs_arena,
+      &other->_impl_.key_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.value_, lhs_arena,
+      &other->_impl_.value_, rhs_arena
+  );
+  swap(_impl_.ttl_ms_, other->_impl_.ttl_ms_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata PutRequest::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_key_5fvalue_2eproto_getter, &descriptor_table_key_5fvalue_2eproto_once,
+      file_level_metadata_key_5fvalue_2eproto[0]);
+}
+
+// ===================================================================
+
+class PutReply::_Internal {
+ public:
+};
+
+PutReply::PutReply(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase(arena, is_message_owned) {
+  // @@protoc_insertion_point(arena_constructor:chirp.PutReply)
+}
+PutReply::PutReply(const PutReply& from)
+  : ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase() {
+  PutReply* const _this = this; (void)_this;
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  // @@protoc_insertion_point(copy_constructor:chirp.PutReply)
+}
+
+
+
+
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData PutReply::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::CopyImpl,
+    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::MergeImpl,
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*PutReply::GetClassData() const { return &_class_data_; }
+
+
+
+
+
+
+
+::PROTOBUF_NAMESPACE_ID::Metadata PutReply::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_key_5fvalue_2eproto_getter, &descriptor_table_key_5fvalue_2eproto_once,
+      file_level_metadata_key_5fvalue_2eproto[1]);
+}
+
+// ===================================================================
+
+class GetRequest::_Internal {
+ public:
+};
+
+GetRequest::GetRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:chirp.GetRequest)
+}
+GetRequest::GetRequest(const GetRequest& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  GetRequest* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.keys_){from._impl_.keys_}
+    , decltype(_impl_.key_){}
+    , decltype(_impl_.snapshot_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.key_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.key_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_key().empty()) {
+    _this->_impl_.key_.Set(from._internal_key(), 
+      _this->GetArenaForAllocation());
+  }
+  _this->_impl_.snapshot_ = from._impl_.snapshot_;
+  // @@protoc_insertion_point(copy_constructor:chirp.GetRequest)
+}
+
+inline void GetRequest::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.keys_){arena}
+    , decltype(_impl_.key_){}
+    , decltype(_impl_.snapshot_){uint64_t{0u}}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.key_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.key_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+GetRequest::~GetRequest() {
+  // @@protoc_insertion_point(destructor:chirp.GetRequest)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void GetRequest::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.keys_.~RepeatedPtrField();
+  _impl_.key_.Destroy();
+}
+
+void GetRequest::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void GetRequest::Clear() {
+// @@protoc_insertion_point(message_clear_start:chirp.GetRequest)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.keys_.Clear();
+  _impl_.key_.ClearToEmpty();
+  _impl_.snapshot_ = uint64_t{0u};
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* GetRequest::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // bytes key = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_key();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated bytes keys = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            auto str = _internal_add_keys();
+            ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<18>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 snapshot = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _impl_.snapshot_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* GetRequest::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:chirp.GetRequest)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // bytes key = 1;
+  if (!this->_internal_key().empty()) {
+    target = stream->WriteBytesMaybeAliased(
+        1, this->_internal_key(), target);
+  }
+
+  // repeated bytes keys = 2;
+  for (int i = 0, n = this->_internal_keys_size(); i < n; i++) {
+    const auto& s = this->_internal_keys(i);
+    target = stream->WriteBytes(2, s, target);
+  }
+
+  // uint64 snapshot = 3;
+  if (this->_internal_snapshot() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(3, this->_internal_snapshot(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:chirp.GetRequest)
+  return target;
+}
+
+size_t GetRequest::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:chirp.GetRequest)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated bytes keys = 2;
+  total_size += 1 *
+      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(_impl_.keys_.size());
+  for (int i = 0, n = _impl_.keys_.size(); i < n; i++) {
+    total_size += ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+      _impl_.keys_.Get(i));
+  }
+
+  // bytes key = 1;
+  if (!this->_internal_key().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_key());
+  }
+
+  // uint64 snapshot = 3;
+  if (this->_internal_snapshot() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_snapshot());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData GetRequest::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    GetRequest::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetRequest::GetClassData() const { return &_class_data_; }
+
+
+void GetRequest::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<GetRequest*>(&to_msg);
+  auto& from = static_cast<const GetRequest&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:chirp.GetRequest)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.keys_.MergeFrom(from._impl_.keys_);
+  if (!from._internal_key().empty()) {
+    _this->_internal_set_key(from._internal_key());
+  }
+  if (from._internal_snapshot() != 0) {
+    _this->_internal_set_snapshot(from._internal_snapshot());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void GetRequest::CopyFrom(const GetRequest& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:chirp.GetRequest)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool GetRequest::IsInitialized() const {
+  return true;
+}
+
+void GetRequest::InternalSwap(GetRequest* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.keys_.InternalSwap(&other->_impl_.keys_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.key_, lhs_arena,
+      &other->_impl_.key_, rhs_arena
+  );
+  swap(_impl_.snapshot_, other->_impl_.snapshot_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata GetRequest::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_key_5fvalue_2eproto_getter, &descriptor_table_key_5fvalue_2eproto_once,
+      file_level_metadata_key_5fvalue_2eproto[2]);
+}
+
+// ===================================================================
+
+class GetReply::_Internal {
+ public:
+};
+
+GetReply::GetReply(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:chirp.GetReply)
+}
+GetReply::GetReply(const GetReply& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  GetReply* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.value_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.value_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.value_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_value().empty()) {
+    _this->_impl_.value_.Set(from._internal_value(), 
+      _this->GetArenaForAllocation());
+  }
+  // @@protoc_insertion_point(copy_constructor:chirp.GetReply)
+}
+
+inline void GetReply::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.value_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.value_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.value_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+GetReply::~GetReply() {
+  // @@protoc_insertion_point(destructor:chirp.GetReply)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void GetReply::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.value_.Destroy();
+}
+
+void GetReply::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void GetReply::Clear() {
+// @@protoc_insertion_point(message_clear_start:chirp.GetReply)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.value_.ClearToEmpty();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* GetReply::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // bytes value = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_value();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* GetReply::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:chirp.GetReply)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // bytes value = 1;
+  if (!this->_internal_value().empty()) {
+    target = stream->WriteBytesMaybeAliased(
+        1, this->_internal_value(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:chirp.GetReply)
+  return target;
+}
+
+size_t GetReply::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:chirp.GetReply)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // bytes value = 1;
+  if (!this->_internal_value().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_value());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData GetReply::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    GetReply::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetReply::GetClassData() const { return &_class_data_; }
+
+
+void GetReply::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<GetReply*>(&to_msg);
+  auto& from = static_cast<const GetReply&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:chirp.GetReply)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_value().empty()) {
+    _this->_internal_set_value(from._internal_value());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void GetReply::CopyFrom(const GetReply& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:chirp.GetReply)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool GetReply::IsInitialized() const {
+  return true;
+}
+
+void GetReply::InternalSwap(GetReply* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.value_, lhs_arena,
+      &other->_impl_.value_, rhs_arena
+  );
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata GetReply::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_key_5fvalue_2eproto_getter, &descriptor_table_key_5fvalue_2eproto_once,
+      file_level_metadata_key_5fvalue_2eproto[3]);
+}
+
+// ===================================================================
+
+class DeleteRequest::_Internal {
+ public:
+};
+
+DeleteRequest::DeleteRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:chirp.DeleteRequest)
+}
+DeleteRequest::DeleteRequest(const DeleteRequest& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  DeleteRequest* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.key_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.key_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.key_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_key().empty()) {
+    _this->_impl_.key_.Set(from._internal_key(), 
+      _this->GetArenaForAllocation());
+  }
+  // @@protoc_insertion_point(copy_constructor:chirp.DeleteRequest)
+}
+
+inline void DeleteRequest::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.key_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.key_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.key_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+DeleteRequest::~DeleteRequest() {
+  // @@protoc_insertion_point(destructor:chirp.DeleteRequest)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void DeleteRequest::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.key_.Destroy();
+}
+
+void DeleteRequest::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void DeleteRequest::Clear() {
+// @@protoc_insertion_point(message_clear_start:chirp.DeleteRequest)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.key_.ClearToEmpty();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* DeleteRequest::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // bytes key = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_key();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* DeleteRequest::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:chirp.DeleteRequest)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // bytes key = 1;
+  if (!this->_internal_key().empty()) {
+    target = stream->WriteBytesMaybeAliased(
+        1, this->_internal_key(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:chirp.DeleteRequest)
+  return target;
+}
+
+size_t DeleteRequest::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:chirp.DeleteRequest)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // bytes key = 1;
+  if (!this->_internal_key().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_key());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData DeleteRequest::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    DeleteRequest::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*DeleteRequest::GetClassData() const { return &_class_data_; }
+
+
+void DeleteRequest::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<DeleteRequest*>(&to_msg);
+  auto& from = static_cast<const DeleteRequest&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:chirp.DeleteRequest)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_key().empty()) {
+    _this->_internal_set_key(from._internal_key());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void DeleteRequest::CopyFrom(const DeleteRequest& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:chirp.DeleteRequest)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool DeleteRequest::IsInitialized() const {
+  return true;
+}
+
+void DeleteRequest::InternalSwap(DeleteRequest* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.key_, lhs_arena,
+      &other->_impl_.key_, rhs_arena
+  );
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata DeleteRequest::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_key_5fvalue_2eproto_getter, &descriptor_table_key_5fvalue_2eproto_once,
+      file_level_metadata_key_5fvalue_2eproto[4]);
+}
+
+// ===================================================================
+
+class DeleteReply::_Internal {
+ public:
+};
+
+DeleteReply::DeleteReply(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase(arena, is_message_owned) {
+  // @@protoc_insertion_point(arena_constructor:chirp.DeleteReply)
+}
+DeleteReply::DeleteReply(const DeleteReply& from)
+  : ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase() {
+  DeleteReply* const _this = this; (void)_this;
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  // @@protoc_insertion_point(copy_constructor:chirp.DeleteReply)
+}
+
+
+
+
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData DeleteReply::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::CopyImpl,
+    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::MergeImpl,
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*DeleteReply::GetClassData() const { return &_class_data_; }
+
+
+
+
+
+
+
+::PROTOBUF_NAMESPACE_ID::Metadata DeleteReply::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_key_5fvalue_2eproto_getter, &descriptor_table_key_5fvalue_2eproto_once,
+      file_level_metadata_key_5fvalue_2eproto[5]);
+}
+
+// ===================================================================
+
+class MultiPutRequest::_Internal {
+ public:
+};
+
+MultiPutRequest::MultiPutRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:chirp.MultiPutRequest)
+}
+MultiPutRequest::MultiPutRequest(const MultiPutRequest& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  MultiPutRequest* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.pairs_){from._impl_.pairs_}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  // @@protoc_insertion_point(copy_constructor:chirp.MultiPutRequest)
+}
+
+inline void MultiPutRequest::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.pairs_){arena}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+MultiPutRequest::~MultiPutRequest() {
+  // @@protoc_insertion_point(destructor:chirp.MultiPutRequest)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void MultiPutRequest::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.pairs_.~RepeatedPtrField();
+}
+
+void MultiPutRequest::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void MultiPutRequest::Clear() {
+// @@protoc_insertion_point(message_clear_start:chirp.MultiPutRequest)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.pairs_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* MultiPutRequest::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // repeated .chirp.PutRequest pairs = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_pairs(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<10>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* MultiPutRequest::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:chirp.MultiPutRequest)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // repeated .chirp.PutRequest pairs = 1;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_pairs_size()); i < n; i++) {
+    const auto& repfield = this->_internal_pairs(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(1, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:chirp.MultiPutRequest)
+  return target;
+}
+
+size_t MultiPutRequest::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:chirp.MultiPutRequest)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .chirp.PutRequest pairs = 1;
+  total_size += 1UL * this->_internal_pairs_size();
+  for (const auto& msg : this->_impl_.pairs_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData MultiPutRequest::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    MultiPutRequest::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*MultiPutRequest::GetClassData() const { return &_class_data_; }
+
+
+void MultiPutRequest::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<MultiPutRequest*>(&to_msg);
+  auto& from = static_cast<const MultiPutRequest&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:chirp.MultiPutRequest)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.pairs_.MergeFrom(from._impl_.pairs_);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void MultiPutRequest::CopyFrom(const MultiPutRequest& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:chirp.MultiPutRequest)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool MultiPutRequest::IsInitialized() const {
+  return true;
+}
+
+void MultiPutRequest::InternalSwap(MultiPutRequest* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.pairs_.InternalSwap(&other->_impl_.pairs_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata MultiPutRequest::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_key_5fvalue_2eproto_getter, &descriptor_table_key_5fvalue_2eproto_once,
+      file_level_metadata_key_5fvalue_2eproto[6]);
+}
+
+// ===================================================================
+
+class MultiPutReply::_Internal {
+ public:
+};
+
+MultiPutReply::MultiPutReply(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase(arena, is_message_owned) {
+  // @@protoc_insertion_point(arena_constructor:chirp.MultiPutReply)
+}
+MultiPutReply::MultiPutReply(const MultiPutReply& from)
+  : ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase() {
+  MultiPutReply* const _this = this; (void)_this;
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  // @@protoc_insertion_point(copy_constructor:chirp.MultiPutReply)
+}
+
+
+
+
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData MultiPutReply::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::CopyImpl,
+    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::MergeImpl,
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*MultiPutReply::GetClassData() const { return &_class_data_; }
+
+
+
+
+
+
+
+::PROTOBUF_NAMESPACE_ID::Metadata MultiPutReply::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_key_5fvalue_2eproto_getter, &descriptor_table_key_5fvalue_2eproto_once,
+      file_level_metadata_key_5fvalue_2eproto[7]);
+}
+
+// ===================================================================
+
+class MultiDeleteRequest::_Internal {
+ public:
+};
+
+MultiDeleteRequest::MultiDeleteRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:chirp.MultiDeleteRequest)
+}
+MultiDeleteRequest::MultiDeleteRequest(const MultiDeleteRequest& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  MultiDeleteRequest* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.keys_){from._impl_.keys_}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  // @@protoc_insertion_point(copy_constructor:chirp.MultiDeleteRequest)
+}
+
+inline void MultiDeleteRequest::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.keys_){arena}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+MultiDeleteRequest::~MultiDeleteRequest() {
+  // @@protoc_insertion_point(destructor:chirp.MultiDeleteRequest)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void MultiDeleteRequest::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.keys_.~RepeatedPtrField();
+}
+
+void MultiDeleteRequest::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void MultiDeleteRequest::Clear() {
+// @@protoc_insertion_point(message_clear_start:chirp.MultiDeleteRequest)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.keys_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* MultiDeleteRequest::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // repeated bytes keys = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            auto str = _internal_add_keys();
+            ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<10>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* MultiDeleteRequest::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:chirp.MultiDeleteRequest)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // repeated bytes keys = 1;
+  for (int i = 0, n = this->_internal_keys_size(); i < n; i++) {
+    const auto& s = this->_internal_keys(i);
+    target = stream->WriteBytes(1, s, target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:chirp.MultiDeleteRequest)
+  return target;
+}
+
+size_t MultiDeleteRequest::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:chirp.MultiDeleteRequest)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated bytes keys = 1;
+  total_size += 1 *
+      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(_impl_.keys_.size());
+  for (int i = 0, n = _impl_.keys_.size(); i < n; i++) {
+    total_size += ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+      _impl_.keys_.Get(i));
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData MultiDeleteRequest::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    MultiDeleteRequest::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*MultiDeleteRequest::GetClassData() const { return &_class_data_; }
+
+
+void MultiDeleteRequest::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<MultiDeleteRequest*>(&to_msg);
+  auto& from = static_cast<const MultiDeleteRequest&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:chirp.MultiDeleteRequest)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.keys_.MergeFrom(from._impl_.keys_);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void MultiDeleteRequest::CopyFrom(const MultiDeleteRequest& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:chirp.MultiDeleteRequest)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool MultiDeleteRequest::IsInitialized() const {
+  return true;
+}
+
+void MultiDeleteRequest::InternalSwap(MultiDeleteRequest* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.keys_.InternalSwap(&other->_impl_.keys_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata MultiDeleteRequest::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_key_5fvalue_2eproto_getter, &descriptor_table_key_5fvalue_2eproto_once,
+      file_level_metadata_key_5fvalue_2eproto[8]);
+}
+
+// ===================================================================
+
+class MultiDeleteReply::_Internal {
+ public:
+};
+
+MultiDeleteReply::MultiDeleteReply(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:chirp.MultiDeleteReply)
+}
+MultiDeleteReply::MultiDeleteReply(const MultiDeleteReply& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  MultiDeleteReply* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.num_of_deleted_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _this->_impl_.num_of_deleted_ = from._impl_.num_of_deleted_;
+  // @@protoc_insertion_point(copy_constructor:chirp.MultiDeleteReply)
+}
+
+inline void MultiDeleteReply::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.num_of_deleted_){uint64_t{0u}}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+MultiDeleteReply::~MultiDeleteReply() {
+  // @@protoc_insertion_point(destructor:chirp.MultiDeleteReply)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void MultiDeleteReply::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void MultiDeleteReply::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void MultiDeleteReply::Clear() {
+// @@protoc_insertion_point(message_clear_start:chirp.MultiDeleteReply)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.num_of_deleted_ = uint64_t{0u};
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* MultiDeleteReply::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // uint64 num_of_deleted = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.num_of_deleted_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* MultiDeleteReply::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:chirp.MultiDeleteReply)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // uint64 num_of_deleted = 1;
+  if (this->_internal_num_of_deleted() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(1, this->_internal_num_of_deleted(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:chirp.MultiDeleteReply)
+  return target;
+}
+
+size_t MultiDeleteReply::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:chirp.MultiDeleteReply)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // uint64 num_of_deleted = 1;
+  if (this->_internal_num_of_deleted() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_num_of_deleted());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData MultiDeleteReply::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    MultiDeleteReply::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*MultiDeleteReply::GetClassData() const { return &_class_data_; }
+
+
+void MultiDeleteReply::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<MultiDeleteReply*>(&to_msg);
+  auto& from = static_cast<const MultiDeleteReply&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:chirp.MultiDeleteReply)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_num_of_deleted() != 0) {
+    _this->_internal_set_num_of_deleted(from._internal_num_of_deleted());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void MultiDeleteReply::CopyFrom(const MultiDeleteReply& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:chirp.MultiDeleteReply)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool MultiDeleteReply::IsInitialized() const {
+  return true;
+}
+
+void MultiDeleteReply::InternalSwap(MultiDeleteReply* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_.num_of_deleted_, other->_impl_.num_of_deleted_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata MultiDeleteReply::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_key_5fvalue_2eproto_getter, &descriptor_table_key_5fvalue_2eproto_once,
+      file_level_metadata_key_5fvalue_2eproto[9]);
+}
+
+// ===================================================================
+
+class FetchAddRequest::_Internal {
+ public:
+};
+
+FetchAddRequest::FetchAddRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:chirp.FetchAddRequest)
+}
+FetchAddRequest::FetchAddRequest(const FetchAddRequest& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  FetchAddRequest* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.key_){}
+    , decltype(_impl_.delta_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.key_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.key_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_key().empty()) {
+    _this->_impl_.key_.Set(from._internal_key(), 
+      _this->GetArenaForAllocation());
+  }
+  _this->_impl_.delta_ = from._impl_.delta_;
+  // @@protoc_insertion_point(copy_constructor:chirp.FetchAddRequest)
+}
+
+inline void FetchAddRequest::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.key_){}
+    , decltype(_impl_.delta_){uint64_t{0u}}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.key_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.key_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+FetchAddRequest::~FetchAddRequest() {
+  // @@protoc_insertion_point(destructor:chirp.FetchAddRequest)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void FetchAddRequest::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.key_.Destroy();
+}
+
+void FetchAddRequest::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void FetchAddRequest::Clear() {
+// @@protoc_insertion_point(message_clear_start:chirp.FetchAddRequest)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.key_.ClearToEmpty();
+  _impl_.delta_ = uint64_t{0u};
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* FetchAddRequest::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // bytes key = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_key();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 delta = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.delta_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* FetchAddRequest::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:chirp.FetchAddRequest)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // bytes key = 1;
+  if (!this->_internal_key().empty()) {
+    target = stream->WriteBytesMaybeAliased(
+        1, this->_internal_key(), target);
+  }
+
+  // uint64 delta = 2;
+  if (this->_internal_delta() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(2, this->_internal_delta(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:chirp.FetchAddRequest)
+  return target;
+}
+
+size_t FetchAddRequest::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:chirp.FetchAddRequest)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // bytes key = 1;
+  if (!this->_internal_key().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_key());
+  }
+
+  // uint64 delta = 2;
+  if (this->_internal_delta() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_delta());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData FetchAddRequest::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    FetchAddRequest::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*FetchAddRequest::GetClassData() const { return &_class_data_; }
+
+
+void FetchAddRequest::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<FetchAddRequest*>(&to_msg);
+  auto& from = static_cast<const FetchAddRequest&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:chirp.FetchAddRequest)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_key().empty()) {
+    _this->_internal_set_key(from._internal_key());
+  }
+  if (from._internal_delta() != 0) {
+    _this->_internal_set_delta(from._internal_delta());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void FetchAddRequest::CopyFrom(const FetchAddRequest& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:chirp.FetchAddRequest)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool FetchAddRequest::IsInitialized() const {
+  return true;
+}
+
+void FetchAddRequest::InternalSwap(FetchAddRequest* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.key_, lhs_arena,
+      &other->_impl_.key_, rhs_arena
+  );
+  swap(_impl_.delta_, other->_impl_.delta_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata FetchAddRequest::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_key_5fvalue_2eproto_getter, &descriptor_table_key_5fvalue_2eproto_once,
+      file_level_metadata_key_5fvalue_2eproto[10]);
+}
+
+// ===================================================================
+
+class FetchAddReply::_Internal {
+ public:
+};
+
+FetchAddReply::FetchAddReply(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:chirp.FetchAddReply)
+}
+FetchAddReply::FetchAddReply(const FetchAddReply& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  FetchAddReply* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.previous_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _this->_impl_.previous_ = from._impl_.previous_;
+  // @@protoc_insertion_point(copy_constructor:chirp.FetchAddReply)
+}
+
+inline void FetchAddReply::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.previous_){uint64_t{0u}}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+FetchAddReply::~FetchAddReply() {
+  // @@protoc_insertion_point(destructor:chirp.FetchAddReply)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void FetchAddReply::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void FetchAddReply::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void FetchAddReply::Clear() {
+// @@protoc_insertion_point(message_clear_start:chirp.FetchAddReply)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.previous_ = uint64_t{0u};
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* FetchAddReply::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // uint64 previous = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.previous_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* FetchAddReply::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:chirp.FetchAddReply)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // uint64 previous = 1;
+  if (this->_internal_previous() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(1, this->_internal_previous(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:chirp.FetchAddReply)
+  return target;
+}
+
+size_t FetchAddReply::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:chirp.FetchAddReply)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // uint64 previous = 1;
+  if (this->_internal_previous() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_previous());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData FetchAddReply::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    FetchAddReply::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*FetchAddReply::GetClassData() const { return &_class_data_; }
+
+
+void FetchAddReply::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<FetchAddReply*>(&to_msg);
+  auto& from = static_cast<const FetchAddReply&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:chirp.FetchAddReply)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_previous() != 0) {
+    _this->_internal_set_previous(from._internal_previous());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void FetchAddReply::CopyFrom(const FetchAddReply& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:chirp.FetchAddReply)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool FetchAddReply::IsInitialized() const {
+  return true;
+}
+
+void FetchAddReply::InternalSwap(FetchAddReply* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_.previous_, other->_impl_.previous_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata FetchAddReply::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_key_5fvalue_2eproto_getter, &descriptor_table_key_5fvalue_2eproto_once,
+      file_level_metadata_key_5fvalue_2eproto[11]);
+}
+
+// ===================================================================
+
+class CompareAndSwapRequest::_Internal {
+ public:
+};
+
+CompareAndSwapRequest::CompareAndSwapRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:chirp.CompareAndSwapRequest)
+}
+CompareAndSwapRequest::CompareAndSwapRequest(const CompareAndSwapRequest& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  CompareAndSwapRequest* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.key_){}
+    , decltype(_impl_.expected_){}
+    , decltype(_impl_.desired_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.key_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.key_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_key().empty()) {
+    _this->_impl_.key_.Set(from._internal_key(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.expected_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.expected_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_expected().empty()) {
+    _this->_impl_.expected_.Set(from._internal_expected(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.desired_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.desired_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_desired().empty()) {
+    _this->_impl_.desired_.Set(from._internal_desired(), 
+      _this->GetArenaForAllocation());
+  }
+  // @@protoc_insertion_point(copy_constructor:chirp.CompareAndSwapRequest)
+}
+
+inline void CompareAndSwapRequest::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.key_){}
+    , decltype(_impl_.expected_){}
+    , decltype(_impl_.desired_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.key_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.key_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.expected_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.expected_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.desired_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.desired_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+CompareAndSwapRequest::~CompareAndSwapRequest() {
+  // @@protoc_insertion_point(destructor:chirp.CompareAndSwapRequest)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void CompareAndSwapRequest::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.key_.Destroy();
+  _impl_.expected_.Destroy();
+  _impl_.desired_.Destroy();
+}
+
+void CompareAndSwapRequest::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void CompareAndSwapRequest::Clear() {
+// @@protoc_insertion_point(message_clear_start:chirp.CompareAndSwapRequest)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.key_.ClearToEmpty();
+  _impl_.expected_.ClearToEmpty();
+  _impl_.desired_.ClearToEmpty();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* CompareAndSwapRequest::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // bytes key = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_key();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // bytes expected = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_expected();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // bytes desired = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          auto str = _internal_mutable_desired();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* CompareAndSwapRequest::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:chirp.CompareAndSwapRequest)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // bytes key = 1;
+  if (!this->_internal_key().empty()) {
+    target = stream->WriteBytesMaybeAliased(
+        1, this->_internal_key(), target);
+  }
+
+  // bytes expected = 2;
+  if (!this->_internal_expected().empty()) {
+    target = stream->WriteBytesMaybeAliased(
+        2, this->_internal_expected(), target);
+  }
+
+  // bytes desired = 3;
+  if (!this->_internal_desired().empty()) {
+    target = stream->WriteBytesMaybeAliased(
+        3, this->_internal_desired(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:chirp.CompareAndSwapRequest)
+  return target;
+}
+
+size_t CompareAndSwapRequest::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:chirp.CompareAndSwapRequest)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // bytes key = 1;
+  if (!this->_internal_key().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_key());
+  }
+
+  // bytes expected = 2;
+  if (!this->_internal_expected().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_expected());
+  }
+
+  // bytes desired = 3;
+  if (!this->_internal_desired().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_desired());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData CompareAndSwapRequest::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    CompareAndSwapRequest::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*CompareAndSwapRequest::GetClassData() const { return &_class_data_; }
+
+
+void CompareAndSwapRequest::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<CompareAndSwapRequest*>(&to_msg);
+  auto& from = static_cast<const CompareAndSwapRequest&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:chirp.CompareAndSwapRequest)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_key().empty()) {
+    _this->_internal_set_key(from._internal_key());
+  }
+  if (!from._internal_expected().empty()) {
+    _this->_internal_set_expected(from._internal_expected());
+  }
+  if (!from._internal_desired().empty()) {
+    _this->_internal_set_desired(from._internal_desired());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void CompareAndSwapRequest::CopyFrom(const CompareAndSwapRequest& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:chirp.CompareAndSwapRequest)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool CompareAndSwapRequest::IsInitialized() const {
+  return true;
+}
+
+void CompareAndSwapRequest::InternalSwap(CompareAndSwapRequest* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.key_, lhs_arena,
+      &other->_impl_.key_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.expected_, lhs_arena,
+      &other->_impl_.expected_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.desired_, lhs_arena,
+      &other->_impl_.desired_, rhs_arena
+  );
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata CompareAndSwapRequest::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_key_5fvalue_2eproto_getter, &descriptor_table_key_5fvalue_2eproto_once,
+      file_level_metadata_key_5fvalue_2eproto[12]);
+}
+
+// ===================================================================
+
+class CompareAndSwapReply::_Internal {
+ public:
+};
+
+CompareAndSwapReply::CompareAndSwapReply(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:chirp.CompareAndSwapReply)
+}
+CompareAndSwapReply::CompareAndSwapReply(const CompareAndSwapReply& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  CompareAndSwapReply* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.actual_){}
+    , decltype(_impl_.swapped_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.actual_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.actual_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_actual().empty()) {
+    _this->_impl_.actual_.Set(from._internal_actual(), 
+      _this->GetArenaForAllocation());
+  }
+  _this->_impl_.swapped_ = from._impl_.swapped_;
+  // @@protoc_insertion_point(copy_constructor:chirp.CompareAndSwapReply)
+}
+
+inline void CompareAndSwapReply::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.actual_){}
+    , decltype(_impl_.swapped_){false}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.actual_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.actual_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+CompareAndSwapReply::~CompareAndSwapReply() {
+  // @@protoc_insertion_point(destructor:chirp.CompareAndSwapReply)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void CompareAndSwapReply::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.actual_.Destroy();
+}
+
+void CompareAndSwapReply::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void CompareAndSwapReply::Clear() {
+// @@protoc_insertion_point(message_clear_start:chirp.CompareAndSwapReply)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.actual_.ClearToEmpty();
+  _impl_.swapped_ = false;
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* CompareAndSwapReply::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // bool swapped = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.swapped_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // bytes actual = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_actual();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* CompareAndSwapReply::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:chirp.CompareAndSwapReply)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // bool swapped = 1;
+  if (this->_internal_swapped() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(1, this->_internal_swapped(), target);
+  }
+
+  // bytes actual = 2;
+  if (!this->_internal_actual().empty()) {
+    target = stream->WriteBytesMaybeAliased(
+        2, this->_internal_actual(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:chirp.CompareAndSwapReply)
+  return target;
+}
+
+size_t CompareAndSwapReply::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:chirp.CompareAndSwapReply)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // bytes actual = 2;
+  if (!this->_internal_actual().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_actual());
+  }
+
+  // bool swapped = 1;
+  if (this->_internal_swapped() != 0) {
+    total_size += 1 + 1;
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData CompareAndSwapReply::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    CompareAndSwapReply::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*CompareAndSwapReply::GetClassData() const { return &_class_data_; }
+
+
+void CompareAndSwapReply::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<CompareAndSwapReply*>(&to_msg);
+  auto& from = static_cast<const CompareAndSwapReply&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:chirp.CompareAndSwapReply)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_actual().empty()) {
+    _this->_internal_set_actual(from._internal_actual());
+  }
+  if (from._internal_swapped() != 0) {
+    _this->_internal_set_swapped(from._internal_swapped());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void CompareAndSwapReply::CopyFrom(const CompareAndSwapReply& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:chirp.CompareAndSwapReply)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool CompareAndSwapReply::IsInitialized() const {
+  return true;
+}
+
+void CompareAndSwapReply::InternalSwap(CompareAndSwapReply* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.actual_, lhs_arena,
+      &other->_impl_.actual_, rhs_arena
+  );
+  swap(_impl_.swapped_, other->_impl_.swapped_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata CompareAndSwapReply::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_key_5fvalue_2eproto_getter, &descriptor_table_key_5fvalue_2eproto_once,
+      file_level_metadata_key_5fvalue_2eproto[13]);
+}
+
+// ===================================================================
+
+class ScanRequest::_Internal {
+ public:
+};
+
+ScanRequest::ScanRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:chirp.ScanRequest)
+}
+ScanRequest::ScanRequest(const ScanRequest& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  ScanRequest* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.start_){}
+    , decltype(_impl_.end_){}
+    , decltype(_impl_.limit_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.start_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.start_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_start().empty()) {
+    _this->_impl_.start_.Set(from._internal_start(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.end_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.end_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_end().empty()) {
+    _this->_impl_.end_.Set(from._internal_end(), 
+      _this->GetArenaForAllocation());
+  }
+  _this->_impl_.limit_ = from._impl_.limit_;
+  // @@protoc_insertion_point(copy_constructor:chirp.ScanRequest)
+}
+
+inline void ScanRequest::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.start_){}
+    , decltype(_impl_.end_){}
+    , decltype(_impl_.limit_){uint64_t{0u}}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.start_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.start_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.end_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.end_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+ScanRequest::~ScanRequest() {
+  // @@protoc_insertion_point(destructor:chirp.ScanRequest)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void ScanRequest::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.start_.Destroy();
+  _impl_.end_.Destroy();
+}
+
+void ScanRequest::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void ScanRequest::Clear() {
+// @@protoc_insertion_point(message_clear_start:chirp.ScanRequest)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.start_.ClearToEmpty();
+  _impl_.end_.ClearToEmpty();
+  _impl_.limit_ = uint64_t{0u};
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* ScanRequest::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // bytes start = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_start();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // bytes end = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_end();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 limit = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _impl_.limit_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* ScanRequest::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:chirp.ScanRequest)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // bytes start = 1;
+  if (!this->_internal_start().empty()) {
+    target = stream->WriteBytesMaybeAliased(
+        1, this->_internal_start(), target);
+  }
+
+  // bytes end = 2;
+  if (!this->_internal_end().empty()) {
+    target = stream->WriteBytesMaybeAliased(
+        2, this->_internal_end(), target);
+  }
+
+  // uint64 limit = 3;
+  if (this->_internal_limit() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(3, this->_internal_limit(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:chirp.ScanRequest)
+  return target;
+}
+
+size_t ScanRequest::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:chirp.ScanRequest)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // bytes start = 1;
+  if (!this->_internal_start().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_start());
+  }
+
+  // bytes end = 2;
+  if (!this->_internal_end().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_end());
+  }
+
+  // uint64 limit = 3;
+  if (this->_internal_limit() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_limit());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData ScanRequest::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    ScanRequest::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*ScanRequest::GetClassData() const { return &_class_data_; }
+
+
+void ScanRequest::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<ScanRequest*>(&to_msg);
+  auto& from = static_cast<const ScanRequest&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:chirp.ScanRequest)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_start().empty()) {
+    _this->_internal_set_start(from._internal_start());
+  }
+  if (!from._internal_end().empty()) {
+    _this->_internal_set_end(from._internal_end());
+  }
+  if (from._internal_limit() != 0) {
+    _this->_internal_set_limit(from._internal_limit());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void ScanRequest::CopyFrom(const ScanRequest& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:chirp.ScanRequest)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool ScanRequest::IsInitialized() const {
+  return true;
+}
+
+void ScanRequest::InternalSwap(ScanRequest* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.start_, lhs_arena,
+      &other->_impl_.start_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.end_, lhs_arena,
+      &other->_impl_.end_, rhs_arena
+  );
+  swap(_impl_.limit_, other->_impl_.limit_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata ScanRequest::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_key_5fvalue_2eproto_getter, &descriptor_table_key_5fvalue_2eproto_once,
+      file_level_metadata_key_5fvalue_2eproto[14]);
+}
+
+// ===================================================================
+
+class ScanReply::_Internal {
+ public:
+};
+
+ScanReply::ScanReply(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:chirp.ScanReply)
+}
+ScanReply::ScanReply(const ScanReply& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  ScanReply* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.pairs_){from._impl_.pairs_}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  // @@protoc_insertion_point(copy_constructor:chirp.ScanReply)
+}
+
+inline void ScanReply::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.pairs_){arena}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+ScanReply::~ScanReply() {
+  // @@protoc_insertion_point(destructor:chirp.ScanReply)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void ScanReply::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.pairs_.~RepeatedPtrField();
+}
+
+void ScanReply::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void ScanReply::Clear() {
+// @@protoc_insertion_point(message_clear_start:chirp.ScanReply)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.pairs_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* ScanReply::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // repeated .chirp.PutRequest pairs = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_pairs(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<10>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* ScanReply::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:chirp.ScanReply)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // repeated .chirp.PutRequest pairs = 1;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_pairs_size()); i < n; i++) {
+    const auto& repfield = this->_internal_pairs(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(1, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:chirp.ScanReply)
+  return target;
+}
+
+size_t ScanReply::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:chirp.ScanReply)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .chirp.PutRequest pairs = 1;
+  total_size += 1UL * this->_internal_pairs_size();
+  for (const auto& msg : this->_impl_.pairs_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData ScanReply::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    ScanReply::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*ScanReply::GetClassData() const { return &_class_data_; }
+
+
+void ScanReply::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<ScanReply*>(&to_msg);
+  auto& from = static_cast<const ScanReply&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:chirp.ScanReply)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.pairs_.MergeFrom(from._impl_.pairs_);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void ScanReply::CopyFrom(const ScanReply& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:chirp.ScanReply)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool ScanReply::IsInitialized() const {
+  return true;
+}
+
+void ScanReply::InternalSwap(ScanReply* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.pairs_.InternalSwap(&other->_impl_.pairs_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata ScanReply::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_key_5fvalue_2eproto_getter, &descriptor_table_key_5fvalue_2eproto_once,
+      file_level_metadata_key_5fvalue_2eproto[15]);
+}
+
+// ===================================================================
+
+class ListElementRequest::_Internal {
+ public:
+};
+
+ListElementRequest::ListElementRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:chirp.ListElementRequest)
+}
+ListElementRequest::ListElementRequest(const ListElementRequest& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  ListElementRequest* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.key_){}
+    , decltype(_impl_.field_){}
+    , decltype(_impl_.if_absent_){}
+    , decltype(_impl_.if_exists_){}
+    , decltype(_impl_.element_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , /*decltype(_impl_._oneof_case_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.key_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.key_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_key().empty()) {
+    _this->_impl_.key_.Set(from._internal_key(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.field_, &from._impl_.field_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.if_exists_) -
+    reinterpret_cast<char*>(&_impl_.field_)) + sizeof(_impl_.if_exists_));
+  clear_has_element();
+  switch (from.element_case()) {
+    case kUint64Element: {
+      _this->_internal_set_uint64_element(from._internal_uint64_element());
+      break;
+    }
+    case kStringElement: {
+      _this->_internal_set_string_element(from._internal_string_element());
+      break;
+    }
+    case ELEMENT_NOT_SET: {
+      break;
+    }
+  }
+  // @@protoc_insertion_point(copy_constructor:chirp.ListElementRequest)
+}
+
+inline void ListElementRequest::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.key_){}
+    , decltype(_impl_.field_){0u}
+    , decltype(_impl_.if_absent_){false}
+    , decltype(_impl_.if_exists_){false}
+    , decltype(_impl_.element_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , /*decltype(_impl_._oneof_case_)*/{}
+  };
+  _impl_.key_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.key_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  clear_has_element();
+}
+
+ListElementRequest::~ListElementRequest() {
+  // @@protoc_insertion_point(destructor:chirp.ListElementRequest)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void ListElementRequest::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.key_.Destroy();
+  if (has_element()) {
+    clear_element();
+  }
+}
+
+void ListElementRequest::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void ListElementRequest::clear_element() {
+// @@protoc_insertion_point(one_of_clear_start:chirp.ListElementRequest)
+  switch (element_case()) {
+    case kUint64Element: {
+      // No need to clear
+      break;
+    }
+    case kStringElement: {
+      _impl_.element_.string_element_.Destroy();
+      break;
+    }
+    case ELEMENT_NOT_SET: {
+      break;
+    }
+  }
+  _impl_._oneof_case_[0] = ELEMENT_NOT_SET;
+}
+
+
+void ListElementRequest::Clear() {
+// @@protoc_insertion_point(message_clear_start:chirp.ListElementRequest)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.key_.ClearToEmpty();
+  ::memset(&_impl_.field_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.if_exists_) -
+      reinterpret_cast<char*>(&_impl_.field_)) + sizeof(_impl_.if_exists_));
+  clear_element();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* ListElementRequest::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // bytes key = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_key();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint32 field = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.field_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 uint64_element = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _internal_set_uint64_element(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr));
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // bytes string_element = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          auto str = _internal_mutable_string_element();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // bool if_absent = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
+          _impl_.if_absent_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // bool if_exists = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 48)) {
+          _impl_.if_exists_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* ListElementRequest::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:chirp.ListElementRequest)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // bytes key = 1;
+  if (!this->_internal_key().empty()) {
+    target = stream->WriteBytesMaybeAliased(
+        1, this->_internal_key(), target);
+  }
+
+  // uint32 field = 2;
+  if (this->_internal_field() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(2, this->_internal_field(), target);
+  }
+
+  // uint64 uint64_element = 3;
+  if (_internal_has_uint64_element()) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(3, this->_internal_uint64_element(), target);
+  }
+
+  // bytes string_element = 4;
+  if (_internal_has_string_element()) {
+    target = stream->WriteBytesMaybeAliased(
+        4, this->_internal_string_element(), target);
+  }
+
+  // bool if_absent = 5;
+  if (this->_internal_if_absent() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(5, this->_internal_if_absent(), target);
+  }
+
+  // bool if_exists = 6;
+  if (this->_internal_if_exists() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(6, this->_internal_if_exists(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:chirp.ListElementRequest)
+  return target;
+}
+
+size_t ListElementRequest::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:chirp.ListElementRequest)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // bytes key = 1;
+  if (!this->_internal_key().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_key());
+  }
+
+  // uint32 field = 2;
+  if (this->_internal_field() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_field());
+  }
+
+  // bool if_absent = 5;
+  if (this->_internal_if_absent() != 0) {
+    total_size += 1 + 1;
+  }
+
+  // bool if_exists = 6;
+  if (this->_internal_if_exists() != 0) {
+    total_size += 1 + 1;
+  }
+
+  switch (element_case()) {
+    // uint64 uint64_element = 3;
+    case kUint64Element: {
+      total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_uint64_element());
+      break;
+    }
+    // bytes string_element = 4;
+    case kStringElement: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+          this->_internal_string_element());
+      break;
+    }
+    case ELEMENT_NOT_SET: {
+      break;
+    }
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData ListElementRequest::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    ListElementRequest::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*ListElementRequest::GetClassData() const { return &_class_data_; }
+
+
+void ListElementRequest::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<ListElementRequest*>(&to_msg);
+  auto& from = static_cast<const ListElementRequest&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:chirp.ListElementRequest)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_key().empty()) {
+    _this->_internal_set_key(from._internal_key());
+  }
+  if (from._internal_field() != 0) {
+    _this->_internal_set_field(from._internal_field());
+  }
+  if (from._internal_if_absent() != 0) {
+    _this->_internal_set_if_absent(from._internal_if_absent());
+  }
+  if (from._internal_if_exists() != 0) {
+    _this->_internal_set_if_exists(from._internal_if_exists());
+  }
+  switch (from.element_case()) {
+    case kUint64Element: {
+      _this->_internal_set_uint64_element(from._internal_uint64_element());
+      break;
+    }
+    case kStringElement: {
+      _this->_internal_set_string_element(from._internal_string_element());
+      break;
+    }
+    case ELEMENT_NOT_SET: {
+      break;
+    }
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void ListElementRequest::CopyFrom(const ListElementRequest& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:chirp.ListElementRequest)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool ListElementRequest::IsInitialized() const {
+  return true;
+}
+
+void ListElementRequest::InternalSwap(ListElementRequest* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.key_, lhs_arena,
+      &other->_impl_.key_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(ListElementRequest, _impl_.if_exists_)
+      + sizeof(ListElementRequest::_impl_.if_exists_)
+      - PROTOBUF_FIELD_OFFSET(ListElementRequest, _impl_.field_)>(
+          reinterpret_cast<char*>(&_impl_.field_),
+          reinterpret_cast<char*>(&other->_impl_.field_));
+  swap(_impl_.element_, other->_impl_.element_);
+  swap(_impl_._oneof_case_[0], other->_impl_._oneof_case_[0]);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata ListElementRequest::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_key_5fvalue_2eproto_getter, &descriptor_table_key_5fvalue_2eproto_once,
+      file_level_metadata_key_5fvalue_2eproto[16]);
+}
+
+// ===================================================================
+
+class ListElementReply::_Internal {
+ public:
+};
+
+ListElementReply::ListElementReply(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:chirp.ListElementReply)
+}
+ListElementReply::ListElementReply(const ListElementReply& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  ListElementReply* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.changed_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _this->_impl_.changed_ = from._impl_.changed_;
+  // @@protoc_insertion_point(copy_constructor:chirp.ListElementReply)
+}
+
+inline void ListElementReply::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.changed_){false}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+ListElementReply::~ListElementReply() {
+  // @@protoc_insertion_point(destructor:chirp.ListElementReply)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void ListElementReply::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void ListElementReply::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void ListElementReply::Clear() {
+// @@protoc_insertion_point(message_clear_start:chirp.ListElementReply)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.changed_ = false;
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* ListElementReply::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // bool changed = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.changed_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* ListElementReply::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:chirp.ListElementReply)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // bool changed = 1;
+  if (this->_internal_changed() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(1, this->_internal_changed(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:chirp.ListElementReply)
+  return target;
+}
+
+size_t ListElementReply::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:chirp.ListElementReply)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // bool changed = 1;
+  if (this->_internal_changed() != 0) {
+    total_size += 1 + 1;
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData ListElementReply::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    ListElementReply::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*ListElementReply::GetClassData() const { return &_class_data_; }
+
+
+void ListElementReply::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<ListElementReply*>(&to_msg);
+  auto& from = static_cast<const ListElementReply&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:chirp.ListElementReply)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_changed() != 0) {
+    _this->_internal_set_changed(from._internal_changed());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void ListElementReply::CopyFrom(const ListElementReply& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:chirp.ListElementReply)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool ListElementReply::IsInitialized() const {
+  return true;
+}
+
+void ListElementReply::InternalSwap(ListElementReply* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_.changed_, other->_impl_.changed_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata ListElementReply::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_key_5fvalue_2eproto_getter, &descriptor_table_key_5fvalue_2eproto_once,
+      file_level_metadata_key_5fvalue_2eproto[17]);
+}
+
+// ===================================================================
+
+class MemoryUsageRequest::_Internal {
+ public:
+};
+
+MemoryUsageRequest::MemoryUsageRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase(arena, is_message_owned) {
+  // @@protoc_insertion_point(arena_constructor:chirp.MemoryUsageRequest)
+}
+MemoryUsageRequest::MemoryUsageRequest(const MemoryUsageRequest& from)
+  : ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase() {
+  MemoryUsageRequest* const _this = this; (void)_this;
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  // @@protoc_insertion_point(copy_constructor:chirp.MemoryUsageRequest)
+}
+
+
+
+
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData MemoryUsageRequest::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::CopyImpl,
+    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::MergeImpl,
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*MemoryUsageRequest::GetClassData() const { return &_class_data_; }
+
+
+
+
+
+
+
+::PROTOBUF_NAMESPACE_ID::Metadata MemoryUsageRequest::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_key_5fvalue_2eproto_getter, &descriptor_table_key_5fvalue_2eproto_once,
+      file_level_metadata_key_5fvalue_2eproto[18]);
+}
+
+// ===================================================================
+
+class PrefixUsage::_Internal {
+ public:
+};
+
+PrefixUsage::PrefixUsage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:chirp.PrefixUsage)
+}
+PrefixUsage::PrefixUsage(const PrefixUsage& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  PrefixUsage* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.prefix_){}
+    , decltype(_impl_.num_of_keys_){}
+    , decltype(_impl_.bytes_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.prefix_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.prefix_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_prefix().empty()) {
+    _this->_impl_.prefix_.Set(from._internal_prefix(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.num_of_keys_, &from._impl_.num_of_keys_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.bytes_) -
+    reinterpret_cast<char*>(&_impl_.num_of_keys_)) + sizeof(_impl_.bytes_));
+  // @@protoc_insertion_point(copy_constructor:chirp.PrefixUsage)
+}
+
+inline void PrefixUsage::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.prefix_){}
+    , decltype(_impl_.num_of_keys_){uint64_t{0u}}
+    , decltype(_impl_.bytes_){uint64_t{0u}}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.prefix_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.prefix_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+PrefixUsage::~PrefixUsage() {
+  // @@protoc_insertion_point(destructor:chirp.PrefixUsage)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void PrefixUsage::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.prefix_.Destroy();
+}
+
+void PrefixUsage::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void PrefixUsage::Clear() {
+// @@protoc_insertion_point(message_clear_start:chirp.PrefixUsage)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.prefix_.ClearToEmpty();
+  ::memset(&_impl_.num_of_keys_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.bytes_) -
+      reinterpret_cast<char*>(&_impl_.num_of_keys_)) + sizeof(_impl_.bytes_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* PrefixUsage::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // bytes prefix = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_prefix();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 num_of_keys = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.num_of_keys_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 bytes = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _impl_.bytes_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* PrefixUsage::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:chirp.PrefixUsage)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // bytes prefix = 1;
+  if (!this->_internal_prefix().empty()) {
+    target = stream->WriteBytesMaybeAliased(
+        1, this->_internal_prefix(), target);
+  }
+
+  // uint64 num_of_keys = 2;
+  if (this->_internal_num_of_keys() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(2, this->_internal_num_of_keys(), target);
+  }
+
+  // uint64 bytes = 3;
+  if (this->_internal_bytes() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(3, this->_internal_bytes(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:chirp.PrefixUsage)
+  return target;
+}
+
+size_t PrefixUsage::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:chirp.PrefixUsage)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // bytes prefix = 1;
+  if (!this->_internal_prefix().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_prefix());
+  }
+
+  // uint64 num_of_keys = 2;
+  if (this->_internal_num_of_keys() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_num_of_keys());
+  }
+
+  // uint64 bytes = 3;
+  if (this->_internal_bytes() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_bytes());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData PrefixUsage::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    PrefixUsage::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*PrefixUsage::GetClassData() const { return &_class_data_; }
+
+
+void PrefixUsage::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<PrefixUsage*>(&to_msg);
+  auto& from = static_cast<const PrefixUsage&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:chirp.PrefixUsage)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_prefix().empty()) {
+    _this->_internal_set_prefix(from._internal_prefix());
+  }
+  if (from._internal_num_of_keys() != 0) {
+    _this->_internal_set_num_of_keys(from._internal_num_of_keys());
+  }
+  if (from._internal_bytes() != 0) {
+    _this->_internal_set_bytes(from._internal_bytes());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void PrefixUsage::CopyFrom(const PrefixUsage& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:chirp.PrefixUsage)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool PrefixUsage::IsInitialized() const {
+  return true;
+}
+
+void PrefixUsage::InternalSwap(PrefixUsage* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.prefix_, lhs_arena,
+      &other->_impl_.prefix_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(PrefixUsage, _impl_.bytes_)
+      + sizeof(PrefixUsage::_impl_.bytes_)
+      - PROTOBUF_FIELD_OFFSET(PrefixUsage, _impl_.num_of_keys_)>(
+          reinterpret_cast<char*>(&_impl_.num_of_keys_),
+          reinterpret_cast<char*>(&other->_impl_.num_of_keys_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata PrefixUsage::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_key_5fvalue_2eproto_getter, &descriptor_table_key_5fvalue_2eproto_once,
+      file_level_metadata_key_5fvalue_2eproto[19]);
+}
+
+// ===================================================================
+
+class MemoryUsageReply::_Internal {
+ public:
+};
+
+MemoryUsageReply::MemoryUsageReply(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:chirp.MemoryUsageReply)
+}
+MemoryUsageReply::MemoryUsageReply(const MemoryUsageReply& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  MemoryUsageReply* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.prefixes_){from._impl_.prefixes_}
+    , decltype(_impl_.storage_){}
+    , decltype(_impl_.bytes_used_){}
+    , decltype(_impl_.memory_limit_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.storage_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.storage_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_storage().empty()) {
+    _this->_impl_.storage_.Set(from._internal_storage(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.bytes_used_, &from._impl_.bytes_used_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.memory_limit_) -
+    reinterpret_cast<char*>(&_impl_.bytes_used_)) + sizeof(_impl_.memory_limit_));
+  // @@protoc_insertion_point(copy_constructor:chirp.MemoryUsageReply)
+}
+
+inline void MemoryUsageReply::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.prefixes_){arena}
+    , decltype(_impl_.storage_){}
+    , decltype(_impl_.bytes_used_){uint64_t{0u}}
+    , decltype(_impl_.memory_limit_){uint64_t{0u}}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.storage_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.storage_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+MemoryUsageReply::~MemoryUsageReply() {
+  // @@protoc_insertion_point(destructor:chirp.MemoryUsageReply)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void MemoryUsageReply::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.prefixes_.~RepeatedPtrField();
+  _impl_.storage_.Destroy();
+}
+
+void MemoryUsageReply::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void MemoryUsageReply::Clear() {
+// @@protoc_insertion_point(message_clear_start:chirp.MemoryUsageReply)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.prefixes_.Clear();
+  _impl_.storage_.ClearToEmpty();
+  ::memset(&_impl_.bytes_used_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.memory_limit_) -
+      reinterpret_cast<char*>(&_impl_.bytes_used_)) + sizeof(_impl_.memory_limit_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* MemoryUsageReply::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // uint64 bytes_used = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.bytes_used_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 memory_limit = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.memory_limit_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .chirp.PrefixUsage prefixes = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_prefixes(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<26>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // string storage = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          auto str = _internal_mutable_storage();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "chirp.MemoryUsageReply.storage"));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* MemoryUsageReply::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:chirp.MemoryUsageReply)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // uint64 bytes_used = 1;
+  if (this->_internal_bytes_used() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(1, this->_internal_bytes_used(), target);
+  }
+
+  // uint64 memory_limit = 2;
+  if (this->_internal_memory_limit() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(2, this->_internal_memory_limit(), target);
+  }
+
+  // repeated .chirp.PrefixUsage prefixes = 3;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_prefixes_size()); i < n; i++) {
+    const auto& repfield = this->_internal_prefixes(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(3, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  // string storage = 4;
+  if (!this->_internal_storage().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_storage().data(), static_cast<int>(this->_internal_storage().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "chirp.MemoryUsageReply.storage");
+    target = stream->WriteStringMaybeAliased(
+        4, this->_internal_storage(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:chirp.MemoryUsageReply)
+  return target;
+}
+
+size_t MemoryUsageReply::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:chirp.MemoryUsageReply)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .chirp.PrefixUsage prefixes = 3;
+  total_size += 1UL * this->_internal_prefixes_size();
+  for (const auto& msg : this->_impl_.prefixes_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  // string storage = 4;
+  if (!this->_internal_storage().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_storage());
+  }
+
+  // uint64 bytes_used = 1;
+  if (this->_internal_bytes_used() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_bytes_used());
+  }
+
+  // uint64 memory_limit = 2;
+  if (this->_internal_memory_limit() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_memory_limit());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData MemoryUsageReply::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    MemoryUsageReply::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*MemoryUsageReply::GetClassData() const { return &_class_data_; }
+
+
+void MemoryUsageReply::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<MemoryUsageReply*>(&to_msg);
+  auto& from = static_cast<const MemoryUsageReply&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:chirp.MemoryUsageReply)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.prefixes_.MergeFrom(from._impl_.prefixes_);
+  if (!from._internal_storage().empty()) {
+    _this->_internal_set_storage(from._internal_storage());
+  }
+  if (from._internal_bytes_used() != 0) {
+    _this->_internal_set_bytes_used(from._internal_bytes_used());
+  }
+  if (from._internal_memory_limit() != 0) {
+    _this->_internal_set_memory_limit(from._internal_memory_limit());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void MemoryUsageReply::CopyFrom(const MemoryUsageReply& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:chirp.MemoryUsageReply)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool MemoryUsageReply::IsInitialized() const {
+  return true;
+}
+
+void MemoryUsageReply::InternalSwap(MemoryUsageReply* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.prefixes_.InternalSwap(&other->_impl_.prefixes_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.storage_, lhs_arena,
+      &other->_impl_.storage_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(MemoryUsageReply, _impl_.memory_limit_)
+      + sizeof(MemoryUsageReply::_impl_.memory_limit_)
+      - PROTOBUF_FIELD_OFFSET(MemoryUsageReply, _impl_.bytes_used_)>(
+          reinterpret_cast<char*>(&_impl_.bytes_used_),
+          reinterpret_cast<char*>(&other->_impl_.bytes_used_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata MemoryUsageReply::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_key_5fvalue_2eproto_getter, &descriptor_table_key_5fvalue_2eproto_once,
+      file_level_metadata_key_5fvalue_2eproto[20]);
+}
+
+// ===================================================================
+
+class StatsRequest::_Internal {
+ public:
+};
+
+StatsRequest::StatsRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase(arena, is_message_owned) {
+  // @@protoc_insertion_point(arena_constructor:chirp.StatsRequest)
+}
+StatsRequest::StatsRequest(const StatsRequest& from)
+  : ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase() {
+  StatsRequest* const _this = this; (void)_this;
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  // @@protoc_insertion_point(copy_constructor:chirp.StatsRequest)
+}
+
+
+
+
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData StatsRequest::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::CopyImpl,
+    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::MergeImpl,
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*StatsRequest::GetClassData() const { return &_class_data_; }
+
+
+
+
+
+
+
+::PROTOBUF_NAMESPACE_ID::Metadata StatsRequest::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_key_5fvalue_2eproto_getter, &descriptor_table_key_5fvalue_2eproto_once,
+      file_level_metadata_key_5fvalue_2eproto[21]);
+}
+
+// ===================================================================
+
+class OperationStats::_Internal {
+ public:
+};
+
+OperationStats::OperationStats(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:chirp.OperationStats)
+}
+OperationStats::OperationStats(const OperationStats& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  OperationStats* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.operation_){}
+    , decltype(_impl_.count_){}
+    , decltype(_impl_.mean_ns_){}
+    , decltype(_impl_.p50_ns_){}
+    , decltype(_impl_.p90_ns_){}
+    , decltype(_impl_.p99_ns_){}
+    , decltype(_impl_.p999_ns_){}
+    , decltype(_impl_.max_ns_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.operation_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.operation_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_operation().empty()) {
+    _this->_impl_.operation_.Set(from._internal_operation(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.count_, &from._impl_.count_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.max_ns_) -
+    reinterpret_cast<char*>(&_impl_.count_)) + sizeof(_impl_.max_ns_));
+  // @@protoc_insertion_point(copy_constructor:chirp.OperationStats)
+}
+
+inline void OperationStats::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.operation_){}
+    , decltype(_impl_.count_){uint64_t{0u}}
+    , decltype(_impl_.mean_ns_){uint64_t{0u}}
+    , decltype(_impl_.p50_ns_){uint64_t{0u}}
+    , decltype(_impl_.p90_ns_){uint64_t{0u}}
+    , decltype(_impl_.p99_ns_){uint64_t{0u}}
+    , decltype(_impl_.p999_ns_){uint64_t{0u}}
+    , decltype(_impl_.max_ns_){uint64_t{0u}}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.operation_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.operation_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+OperationStats::~OperationStats() {
+  // @@protoc_insertion_point(destructor:chirp.OperationStats)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void OperationStats::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.operation_.Destroy();
+}
+
+void OperationStats::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void OperationStats::Clear() {
+// @@protoc_insertion_point(message_clear_start:chirp.OperationStats)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.operation_.ClearToEmpty();
+  ::memset(&_impl_.count_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.max_ns_) -
+      reinterpret_cast<char*>(&_impl_.count_)) + sizeof(_impl_.max_ns_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* OperationStats::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // string operation = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_operation();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "chirp.OperationStats.operation"));
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 count = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.count_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 mean_ns = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _impl_.mean_ns_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 p50_ns = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _impl_.p50_ns_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 p90_ns = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
+          _impl_.p90_ns_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 p99_ns = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 48)) {
+          _impl_.p99_ns_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 p999_ns = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 56)) {
+          _impl_.p999_ns_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 max_ns = 8;
+      case 8:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 64)) {
+          _impl_.max_ns_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* OperationStats::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:chirp.OperationStats)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // string operation = 1;
+  if (!this->_internal_operation().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_operation().data(), static_cast<int>(this->_internal_operation().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "chirp.OperationStats.operation");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_operation(), target);
+  }
+
+  // uint64 count = 2;
+  if (this->_internal_count() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(2, this->_internal_count(), target);
+  }
+
+  // uint64 mean_ns = 3;
+  if (this->_internal_mean_ns() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(3, this->_internal_mean_ns(), target);
+  }
+
+  // uint64 p50_ns = 4;
+  if (this->_internal_p50_ns() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(4, this->_internal_p50_ns(), target);
+  }
+
+  // uint64 p90_ns = 5;
+  if (this->_internal_p90_ns() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(5, this->_internal_p90_ns(), target);
+  }
+
+  // uint64 p99_ns = 6;
+  if (this->_internal_p99_ns() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(6, this->_internal_p99_ns(), target);
+  }
+
+  // uint64 p999_ns = 7;
+  if (this->_internal_p999_ns() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(7, this->_internal_p999_ns(), target);
+  }
+
+  // uint64 max_ns = 8;
+  if (this->_internal_max_ns() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(8, this->_internal_max_ns(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:chirp.OperationStats)
+  return target;
+}
+
+size_t OperationStats::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:chirp.OperationStats)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // string operation = 1;
+  if (!this->_internal_operation().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_operation());
+  }
+
+  // uint64 count = 2;
+  if (this->_internal_count() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_count());
+  }
+
+  // uint64 mean_ns = 3;
+  if (this->_internal_mean_ns() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_mean_ns());
+  }
+
+  // uint64 p50_ns = 4;
+  if (this->_internal_p50_ns() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_p50_ns());
+  }
+
+  // uint64 p90_ns = 5;
+  if (this->_internal_p90_ns() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_p90_ns());
+  }
+
+  // uint64 p99_ns = 6;
+  if (this->_internal_p99_ns() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_p99_ns());
+  }
+
+  // uint64 p999_ns = 7;
+  if (this->_internal_p999_ns() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_p999_ns());
+  }
+
+  // uint64 max_ns = 8;
+  if (this->_internal_max_ns() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_max_ns());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData OperationStats::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    OperationStats::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*OperationStats::GetClassData() const { return &_class_data_; }
+
+
+void OperationStats::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<OperationStats*>(&to_msg);
+  auto& from = static_cast<const OperationStats&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:chirp.OperationStats)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_operation().empty()) {
+    _this->_internal_set_operation(from._internal_operation());
+  }
+  if (from._internal_count() != 0) {
+    _this->_internal_set_count(from._internal_count());
+  }
+  if (from._internal_mean_ns() != 0) {
+    _this->_internal_set_mean_ns(from._internal_mean_ns());
+  }
+  if (from._internal_p50_ns() != 0) {
+    _this->_internal_set_p50_ns(from._internal_p50_ns());
+  }
+  if (from._internal_p90_ns() != 0) {
+    _this->_internal_set_p90_ns(from._internal_p90_ns());
+  }
+  if (from._internal_p99_ns() != 0) {
+    _this->_internal_set_p99_ns(from._internal_p99_ns());
+  }
+  if (from._internal_p999_ns() != 0) {
+    _this->_internal_set_p999_ns(from._internal_p999_ns());
+  }
+  if (from._internal_max_ns() != 0) {
+    _this->_internal_set_max_ns(from._internal_max_ns());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void OperationStats::CopyFrom(const OperationStats& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:chirp.OperationStats)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool OperationStats::IsInitialized() const {
+  return true;
+}
+
+void OperationStats::InternalSwap(OperationStats* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.operation_, lhs_arena,
+      &other->_impl_.operation_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(OperationStats, _impl_.max_ns_)
+      + sizeof(OperationStats::_impl_.max_ns_)
+      - PROTOBUF_FIELD_OFFSET(OperationStats, _impl_.count_)>(
+          reinterpret_cast<char*>(&_impl_.count_),
+          reinterpret_cast<char*>(&other->_impl_.count_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata OperationStats::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_key_5fvalue_2eproto_getter, &descriptor_table_key_5fvalue_2eproto_once,
+      file_level_metadata_key_5fvalue_2eproto[22]);
+}
+
+// ===================================================================
+
+class StatsReply::_Internal {
+ public:
+};
+
+StatsReply::StatsReply(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:chirp.StatsReply)
+}
+StatsReply::StatsReply(const StatsReply& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  StatsReply* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.operations_){from._impl_.operations_}
+    , decltype(_impl_.prefixes_){from._impl_.prefixes_}
+    , decltype(_impl_.lock_contentions_){}
+    , decltype(_impl_.lock_wait_ns_){}
+    , decltype(_impl_.bytes_used_){}
+    , decltype(_impl_.num_of_backups_){}
+    , decltype(_impl_.num_of_backups_in_sync_){}
+    , decltype(_impl_.num_of_sync_timeouts_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.lock_contentions_, &from._impl_.lock_contentions_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.num_of_sync_timeouts_) -
+    reinterpret_cast<char*>(&_impl_.lock_contentions_)) + sizeof(_impl_.num_of_sync_timeouts_));
+  // @@protoc_insertion_point(copy_constructor:chirp.StatsReply)
+}
+
+inline void StatsReply::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.operations_){arena}
+    , decltype(_impl_.prefixes_){arena}
+    , decltype(_impl_.lock_contentions_){uint64_t{0u}}
+    , decltype(_impl_.lock_wait_ns_){uint64_t{0u}}
+    , decltype(_impl_.bytes_used_){uint64_t{0u}}
+    , decltype(_impl_.num_of_backups_){uint64_t{0u}}
+    , decltype(_impl_.num_of_backups_in_sync_){uint64_t{0u}}
+    , decltype(_impl_.num_of_sync_timeouts_){uint64_t{0u}}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+StatsReply::~StatsReply() {
+  // @@protoc_insertion_point(destructor:chirp.StatsReply)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void StatsReply::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.operations_.~RepeatedPtrField();
+  _impl_.prefixes_.~RepeatedPtrField();
+}
+
+void StatsReply::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void StatsReply::Clear() {
+// @@protoc_insertion_point(message_clear_start:chirp.StatsReply)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.operations_.Clear();
+  _impl_.prefixes_.Clear();
+  ::memset(&_impl_.lock_contentions_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.num_of_sync_timeouts_) -
+      reinterpret_cast<char*>(&_impl_.lock_contentions_)) + sizeof(_impl_.num_of_sync_timeouts_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* StatsReply::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // repeated .chirp.OperationStats operations = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_operations(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<10>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 lock_contentions = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.lock_contentions_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 lock_wait_ns = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _impl_.lock_wait_ns_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 bytes_used = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _impl_.bytes_used_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .chirp.PrefixUsage prefixes = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 42)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_prefixes(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<42>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 num_of_backups = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 48)) {
+          _impl_.num_of_backups_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 num_of_backups_in_sync = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 56)) {
+          _impl_.num_of_backups_in_sync_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 num_of_sync_timeouts = 8;
+      case 8:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 64)) {
+          _impl_.num_of_sync_timeouts_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* StatsReply::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:chirp.StatsReply)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // repeated .chirp.OperationStats operations = 1;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_operations_size()); i < n; i++) {
+    const auto& repfield = this->_internal_operations(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(1, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  // uint64 lock_contentions = 2;
+  if (this->_internal_lock_contentions() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(2, this->_internal_lock_contentions(), target);
+  }
+
+  // uint64 lock_wait_ns = 3;
+  if (this->_internal_lock_wait_ns() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(3, this->_internal_lock_wait_ns(), target);
+  }
+
+  // uint64 bytes_used = 4;
+  if (this->_internal_bytes_used() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(4, this->_internal_bytes_used(), target);
+  }
+
+  // repeated .chirp.PrefixUsage prefixes = 5;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_prefixes_size()); i < n; i++) {
+    const auto& repfield = this->_internal_prefixes(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(5, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  // uint64 num_of_backups = 6;
+  if (this->_internal_num_of_backups() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(6, this->_internal_num_of_backups(), target);
+  }
+
+  // uint64 num_of_backups_in_sync = 7;
+  if (this->_internal_num_of_backups_in_sync() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(7, this->_internal_num_of_backups_in_sync(), target);
+  }
+
+  // uint64 num_of_sync_timeouts = 8;
+  if (this->_internal_num_of_sync_timeouts() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(8, this->_internal_num_of_sync_timeouts(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:chirp.StatsReply)
+  return target;
+}
+
+size_t StatsReply::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:chirp.StatsReply)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .chirp.OperationStats operations = 1;
+  total_size += 1UL * this->_internal_operations_size();
+  for (const auto& msg : this->_impl_.operations_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  // repeated .chirp.PrefixUsage prefixes = 5;
+  total_size += 1UL * this->_internal_prefixes_size();
+  for (const auto& msg : this->_impl_.prefixes_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  // uint64 lock_contentions = 2;
+  if (this->_internal_lock_contentions() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_lock_contentions());
+  }
+
+  // uint64 lock_wait_ns = 3;
+  if (this->_internal_lock_wait_ns() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_lock_wait_ns());
+  }
+
+  // uint64 bytes_used = 4;
+  if (this->_internal_bytes_used() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_bytes_used());
+  }
+
+  // uint64 num_of_backups = 6;
+  if (this->_internal_num_of_backups() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_num_of_backups());
+  }
+
+  // uint64 num_of_backups_in_sync = 7;
+  if (this->_internal_num_of_backups_in_sync() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_num_of_backups_in_sync());
+  }
+
+  // uint64 num_of_sync_timeouts = 8;
+  if (this->_internal_num_of_sync_timeouts() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_num_of_sync_timeouts());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData StatsReply::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    StatsReply::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*StatsReply::GetClassData() const { return &_class_data_; }
+
+
+void StatsReply::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<StatsReply*>(&to_msg);
+  auto& from = static_cast<const StatsReply&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:chirp.StatsReply)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.operations_.MergeFrom(from._impl_.operations_);
+  _this->_impl_.prefixes_.MergeFrom(from._impl_.prefixes_);
+  if (from._internal_lock_contentions() != 0) {
+    _this->_internal_set_lock_contentions(from._internal_lock_contentions());
+  }
+  if (from._internal_lock_wait_ns() != 0) {
+    _this->_internal_set_lock_wait_ns(from._internal_lock_wait_ns());
+  }
+  if (from._internal_bytes_used() != 0) {
+    _this->_internal_set_bytes_used(from._internal_bytes_used());
+  }
+  if (from._internal_num_of_backups() != 0) {
+    _this->_internal_set_num_of_backups(from._internal_num_of_backups());
+  }
+  if (from._internal_num_of_backups_in_sync() != 0) {
+    _this->_internal_set_num_of_backups_in_sync(from._internal_num_of_backups_in_sync());
+  }
+  if (from._internal_num_of_sync_timeouts() != 0) {
+    _this->_internal_set_num_of_sync_timeouts(from._internal_num_of_sync_timeouts());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void StatsReply::CopyFrom(const StatsReply& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:chirp.StatsReply)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool StatsReply::IsInitialized() const {
+  return true;
+}
+
+void StatsReply::InternalSwap(StatsReply* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.operations_.InternalSwap(&other->_impl_.operations_);
+  _impl_.prefixes_.InternalSwap(&other->_impl_.prefixes_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(StatsReply, _impl_.num_of_sync_timeouts_)
+      + sizeof(StatsReply::_impl_.num_of_sync_timeouts_)
+      - PROTOBUF_FIELD_OFFSET(StatsReply, _impl_.lock_contentions_)>(
+          reinterpret_cast<char*>(&_impl_.lock_contentions_),
+          reinterpret_cast<char*>(&other->_impl_.lock_contentions_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata StatsReply::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_key_5fvalue_2eproto_getter, &descriptor_table_key_5fvalue_2eproto_once,
+      file_level_metadata_key_5fvalue_2eproto[23]);
+}
+
+// ===================================================================
+
+class ExistsRequest::_Internal {
+ public:
+};
+
+ExistsRequest::ExistsRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:chirp.ExistsRequest)
+}
+ExistsRequest::ExistsRequest(const ExistsRequest& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  ExistsRequest* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.keys_){from._impl_.keys_}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  // @@protoc_insertion_point(copy_constructor:chirp.ExistsRequest)
+}
+
+inline void ExistsRequest::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.keys_){arena}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+ExistsRequest::~ExistsRequest() {
+  // @@protoc_insertion_point(destructor:chirp.ExistsRequest)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void ExistsRequest::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.keys_.~RepeatedPtrField();
+}
+
+void ExistsRequest::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void ExistsRequest::Clear() {
+// @@protoc_insertion_point(message_clear_start:chirp.ExistsRequest)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.keys_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* ExistsRequest::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // repeated bytes keys = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            auto str = _internal_add_keys();
+            ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<10>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* ExistsRequest::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:chirp.ExistsRequest)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // repeated bytes keys = 1;
+  for (int i = 0, n = this->_internal_keys_size(); i < n; i++) {
+    const auto& s = this->_internal_keys(i);
+    target = stream->WriteBytes(1, s, target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:chirp.ExistsRequest)
+  return target;
+}
+
+size_t ExistsRequest::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:chirp.ExistsRequest)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated bytes keys = 1;
+  total_size += 1 *
+      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(_impl_.keys_.size());
+  for (int i = 0, n = _impl_.keys_.size(); i < n; i++) {
+    total_size += ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+      _impl_.keys_.Get(i));
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData ExistsRequest::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    ExistsRequest::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*ExistsRequest::GetClassData() const { return &_class_data_; }
+
+
+void ExistsRequest::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<ExistsRequest*>(&to_msg);
+  auto& from = static_cast<const ExistsRequest&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:chirp.ExistsRequest)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.keys_.MergeFrom(from._impl_.keys_);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void ExistsRequest::CopyFrom(const ExistsRequest& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:chirp.ExistsRequest)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool ExistsRequest::IsInitialized() const {
+  return true;
+}
+
+void ExistsRequest::InternalSwap(ExistsRequest* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.keys_.InternalSwap(&other->_impl_.keys_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata ExistsRequest::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_key_5fvalue_2eproto_getter, &descriptor_table_key_5fvalue_2eproto_once,
+      file_level_metadata_key_5fvalue_2eproto[24]);
+}
+
+// ===================================================================
+
+class ExistsReply::_Internal {
+ public:
+};
+
+ExistsReply::ExistsReply(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:chirp.ExistsReply)
+}
+ExistsReply::ExistsReply(const ExistsReply& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  ExistsReply* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.exists_){from._impl_.exists_}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  // @@protoc_insertion_point(copy_constructor:chirp.ExistsReply)
+}
+
+inline void ExistsReply::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.exists_){arena}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+ExistsReply::~ExistsReply() {
+  // @@protoc_insertion_point(destructor:chirp.ExistsReply)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void ExistsReply::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.exists_.~RepeatedField();
+}
+
+void ExistsReply::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void ExistsReply::Clear() {
+// @@protoc_insertion_point(message_clear_start:chirp.ExistsReply)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.exists_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* ExistsReply::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // repeated bool exists = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedBoolParser(_internal_mutable_exists(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<uint8_t>(tag) == 8) {
+          _internal_add_exists(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr));
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* ExistsReply::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:chirp.ExistsReply)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // repeated bool exists = 1;
+  if (this->_internal_exists_size() > 0) {
+    target = stream->WriteFixedPacked(1, _internal_exists(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:chirp.ExistsReply)
+  return target;
+}
+
+size_t ExistsReply::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:chirp.ExistsReply)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated bool exists = 1;
+  {
+    unsigned int count = static_cast<unsigned int>(this->_internal_exists_size());
+    size_t data_size = 1UL * count;
+    if (data_size > 0) {
+      total_size += 1 +
+        ::_pbi::WireFormatLite::Int32Size(static_cast<int32_t>(data_size));
+    }
+    total_size += data_size;
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData ExistsReply::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    ExistsReply::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*ExistsReply::GetClassData() const { return &_class_data_; }
+
+
+void ExistsReply::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<ExistsReply*>(&to_msg);
+  auto& from = static_cast<const ExistsReply&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:chirp.ExistsReply)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.exists_.MergeFrom(from._impl_.exists_);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void ExistsReply::CopyFrom(const ExistsReply& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:chirp.ExistsReply)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool ExistsReply::IsInitialized() const {
+  return true;
+}
+
+void ExistsReply::InternalSwap(ExistsReply* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.exists_.InternalSwap(&other->_impl_.exists_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata ExistsReply::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_key_5fvalue_2eproto_getter, &descriptor_table_key_5fvalue_2eproto_once,
+      file_level_metadata_key_5fvalue_2eproto[25]);
+}
+
+// ===================================================================
+
+class CreateSnapshotRequest::_Internal {
+ public:
+};
+
+CreateSnapshotRequest::CreateSnapshotRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:chirp.CreateSnapshotRequest)
+}
+CreateSnapshotRequest::CreateSnapshotRequest(const CreateSnapshotRequest& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  CreateSnapshotRequest* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.lease_ms_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _this->_impl_.lease_ms_ = from._impl_.lease_ms_;
+  // @@protoc_insertion_point(copy_constructor:chirp.CreateSnapshotRequest)
+}
+
+inline void CreateSnapshotRequest::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.lease_ms_){uint64_t{0u}}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+CreateSnapshotRequest::~CreateSnapshotRequest() {
+  // @@protoc_insertion_point(destructor:chirp.CreateSnapshotRequest)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void CreateSnapshotRequest::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void CreateSnapshotRequest::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void CreateSnapshotRequest::Clear() {
+// @@protoc_insertion_point(message_clear_start:chirp.CreateSnapshotRequest)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.lease_ms_ = uint64_t{0u};
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* CreateSnapshotRequest::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // uint64 lease_ms = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.lease_ms_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* CreateSnapshotRequest::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:chirp.CreateSnapshotRequest)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // uint64 lease_ms = 1;
+  if (this->_internal_lease_ms() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(1, this->_internal_lease_ms(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:chirp.CreateSnapshotRequest)
+  return target;
+}
+
+size_t CreateSnapshotRequest::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:chirp.CreateSnapshotRequest)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // uint64 lease_ms = 1;
+  if (this->_internal_lease_ms() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_lease_ms());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData CreateSnapshotRequest::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    CreateSnapshotRequest::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*CreateSnapshotRequest::GetClassData() const { return &_class_data_; }
+
+
+void CreateSnapshotRequest::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<CreateSnapshotRequest*>(&to_msg);
+  auto& from = static_cast<const CreateSnapshotRequest&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:chirp.CreateSnapshotRequest)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_lease_ms() != 0) {
+    _this->_internal_set_lease_ms(from._internal_lease_ms());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void CreateSnapshotRequest::CopyFrom(const CreateSnapshotRequest& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:chirp.CreateSnapshotRequest)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool CreateSnapshotRequest::IsInitialized() const {
+  return true;
+}
+
+void CreateSnapshotRequest::InternalSwap(CreateSnapshotRequest* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_.lease_ms_, other->_impl_.lease_ms_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata CreateSnapshotRequest::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_key_5fvalue_2eproto_getter, &descriptor_table_key_5fvalue_2eproto_once,
+      file_level_metadata_key_5fvalue_2eproto[26]);
+}
+
+// ===================================================================
+
+class CreateSnapshotReply::_Internal {
+ public:
+};
+
+CreateSnapshotReply::CreateSnapshotReply(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:chirp.CreateSnapshotReply)
+}
+CreateSnapshotReply::CreateSnapshotReply(const CreateSnapshotReply& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  CreateSnapshotReply* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.snapshot_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _this->_impl_.snapshot_ = from._impl_.snapshot_;
+  // @@protoc_insertion_point(copy_constructor:chirp.CreateSnapshotReply)
+}
+
+inline void CreateSnapshotReply::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.snapshot_){uint64_t{0u}}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+CreateSnapshotReply::~CreateSnapshotReply() {
+  // @@protoc_insertion_point(destructor:chirp.CreateSnapshotReply)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void CreateSnapshotReply::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void CreateSnapshotReply::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void CreateSnapshotReply::Clear() {
+// @@protoc_insertion_point(message_clear_start:chirp.CreateSnapshotReply)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.snapshot_ = uint64_t{0u};
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* CreateSnapshotReply::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // uint64 snapshot = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.snapshot_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* CreateSnapshotReply::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:chirp.CreateSnapshotReply)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // uint64 snapshot = 1;
+  if (this->_internal_snapshot() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(1, this->_internal_snapshot(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:chirp.CreateSnapshotReply)
+  return target;
+}
+
+size_t CreateSnapshotReply::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:chirp.CreateSnapshotReply)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // uint64 snapshot = 1;
+  if (this->_internal_snapshot() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_snapshot());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData CreateSnapshotReply::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    CreateSnapshotReply::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*CreateSnapshotReply::GetClassData() const { return &_class_data_; }
+
+
+void CreateSnapshotReply::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<CreateSnapshotReply*>(&to_msg);
+  auto& from = static_cast<const CreateSnapshotReply&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:chirp.CreateSnapshotReply)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_snapshot() != 0) {
+    _this->_internal_set_snapshot(from._internal_snapshot());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void CreateSnapshotReply::CopyFrom(const CreateSnapshotReply& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:chirp.CreateSnapshotReply)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool CreateSnapshotReply::IsInitialized() const {
+  return true;
+}
+
+void CreateSnapshotReply::InternalSwap(CreateSnapshotReply* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_.snapshot_, other->_impl_.snapshot_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata CreateSnapshotReply::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_key_5fvalue_2eproto_getter, &descriptor_table_key_5fvalue_2eproto_once,
+      file_level_metadata_key_5fvalue_2eproto[27]);
+}
+
+// ===================================================================
+
+class ReleaseSnapshotRequest::_Internal {
+ public:
+};
+
+ReleaseSnapshotRequest::ReleaseSnapshotRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:chirp.ReleaseSnapshotRequest)
+}
+ReleaseSnapshotRequest::ReleaseSnapshotRequest(const ReleaseSnapshotRequest& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  ReleaseSnapshotRequest* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.snapshot_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _this->_impl_.snapshot_ = from._impl_.snapshot_;
+  // @@protoc_insertion_point(copy_constructor:chirp.ReleaseSnapshotRequest)
+}
+
+inline void ReleaseSnapshotRequest::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.snapshot_){uint64_t{0u}}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+ReleaseSnapshotRequest::~ReleaseSnapshotRequest() {
+  // @@protoc_insertion_point(destructor:chirp.ReleaseSnapshotRequest)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void ReleaseSnapshotRequest::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void ReleaseSnapshotRequest::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void ReleaseSnapshotRequest::Clear() {
+// @@protoc_insertion_point(message_clear_start:chirp.ReleaseSnapshotRequest)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.snapshot_ = uint64_t{0u};
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* ReleaseSnapshotRequest::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // uint64 snapshot = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.snapshot_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* ReleaseSnapshotRequest::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:chirp.ReleaseSnapshotRequest)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // uint64 snapshot = 1;
+  if (this->_internal_snapshot() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(1, this->_internal_snapshot(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:chirp.ReleaseSnapshotRequest)
+  return target;
+}
+
+size_t ReleaseSnapshotRequest::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:chirp.ReleaseSnapshotRequest)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // uint64 snapshot = 1;
+  if (this->_internal_snapshot() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_snapshot());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData ReleaseSnapshotRequest::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    ReleaseSnapshotRequest::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*ReleaseSnapshotRequest::GetClassData() const { return &_class_data_; }
+
+
+void ReleaseSnapshotRequest::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<ReleaseSnapshotRequest*>(&to_msg);
+  auto& from = static_cast<const ReleaseSnapshotRequest&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:chirp.ReleaseSnapshotRequest)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_snapshot() != 0) {
+    _this->_internal_set_snapshot(from._internal_snapshot());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void ReleaseSnapshotRequest::CopyFrom(const ReleaseSnapshotRequest& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:chirp.ReleaseSnapshotRequest)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool ReleaseSnapshotRequest::IsInitialized() const {
+  return true;
+}
+
+void ReleaseSnapshotRequest::InternalSwap(ReleaseSnapshotRequest* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_.snapshot_, other->_impl_.snapshot_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata ReleaseSnapshotRequest::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_key_5fvalue_2eproto_getter, &descriptor_table_key_5fvalue_2eproto_once,
+      file_level_metadata_key_5fvalue_2eproto[28]);
+}
+
+// ===================================================================
+
+class ReleaseSnapshotReply::_Internal {
+ public:
+};
+
+ReleaseSnapshotReply::ReleaseSnapshotReply(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase(arena, is_message_owned) {
+  // @@protoc_insertion_point(arena_constructor:chirp.ReleaseSnapshotReply)
+}
+ReleaseSnapshotReply::ReleaseSnapshotReply(const ReleaseSnapshotReply& from)
+  : ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase() {
+  ReleaseSnapshotReply* const _this = this; (void)_this;
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  // @@protoc_insertion_point(copy_constructor:chirp.ReleaseSnapshotReply)
+}
+
+
+
+
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData ReleaseSnapshotReply::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::CopyImpl,
+    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::MergeImpl,
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*ReleaseSnapshotReply::GetClassData() const { return &_class_data_; }
+
+
+
+
+
+
+
+::PROTOBUF_NAMESPACE_ID::Metadata ReleaseSnapshotReply::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_key_5fvalue_2eproto_getter, &descriptor_table_key_5fvalue_2eproto_once,
+      file_level_metadata_key_5fvalue_2eproto[29]);
+}
+
+// ===================================================================
+
+class ChangesRequest::_Internal {
+ public:
+};
+
+ChangesRequest::ChangesRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:chirp.ChangesRequest)
+}
+ChangesRequest::ChangesRequest(const ChangesRequest& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  ChangesRequest* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.prefix_filter_){}
+    , decltype(_impl_.from_seq_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.prefix_filter_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.prefix_filter_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_prefix_filter().empty()) {
+    _this->_impl_.prefix_filter_.Set(from._internal_prefix_filter(), 
+      _this->GetArenaForAllocation());
+  }
+  _this->_impl_.from_seq_ = from._impl_.from_seq_;
+  // @@protoc_insertion_point(copy_constructor:chirp.ChangesRequest)
+}
+
+inline void ChangesRequest::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.prefix_filter_){}
+    , decltype(_impl_.from_seq_){uint64_t{0u}}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.prefix_filter_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.prefix_filter_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+ChangesRequest::~ChangesRequest() {
+  // @@protoc_insertion_point(destructor:chirp.ChangesRequest)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void ChangesRequest::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.prefix_filter_.Destroy();
+}
+
+void ChangesRequest::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void ChangesRequest::Clear() {
+// @@protoc_insertion_point(message_clear_start:chirp.ChangesRequest)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.prefix_filter_.ClearToEmpty();
+  _impl_.from_seq_ = uint64_t{0u};
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* ChangesRequest::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // uint64 from_seq = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.from_seq_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // bytes prefix_filter = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_prefix_filter();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* ChangesRequest::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:chirp.ChangesRequest)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // uint64 from_seq = 1;
+  if (this->_internal_from_seq() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(1, this->_internal_from_seq(), target);
+  }
+
+  // bytes prefix_filter = 2;
+  if (!this->_internal_prefix_filter().empty()) {
+    target = stream->WriteBytesMaybeAliased(
+        2, this->_internal_prefix_filter(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:chirp.ChangesRequest)
+  return target;
+}
+
+size_t ChangesRequest::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:chirp.ChangesRequest)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // bytes prefix_filter = 2;
+  if (!this->_internal_prefix_filter().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_prefix_filter());
+  }
+
+  // uint64 from_seq = 1;
+  if (this->_internal_from_seq() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_from_seq());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData ChangesRequest::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    ChangesRequest::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*ChangesRequest::GetClassData() const { return &_class_data_; }
+
+
+void ChangesRequest::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<ChangesRequest*>(&to_msg);
+  auto& from = static_cast<const ChangesRequest&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:chirp.ChangesRequest)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_prefix_filter().empty()) {
+    _this->_internal_set_prefix_filter(from._internal_prefix_filter());
+  }
+  if (from._internal_from_seq() != 0) {
+    _this->_internal_set_from_seq(from._internal_from_seq());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void ChangesRequest::CopyFrom(const ChangesRequest& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:chirp.ChangesRequest)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool ChangesRequest::IsInitialized() const {
+  return true;
+}
+
+void ChangesRequest::InternalSwap(ChangesRequest* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.prefix_filter_, lhs_arena,
+      &other->_impl_.prefix_filter_, rhs_arena
+  );
+  swap(_impl_.from_seq_, other->_impl_.from_seq_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata ChangesRequest::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_key_5fvalue_2eproto_getter, &descriptor_table_key_5fvalue_2eproto_once,
+      file_level_metadata_key_5fvalue_2eproto[30]);
+}
+
+// ===================================================================
+
+class Change::_Internal {
+ public:
+};
+
+Change::Change(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:chirp.Change)
+}
+Change::Change(const Change& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  Change* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.key_){}
+    , decltype(_impl_.value_){}
+    , decltype(_impl_.seq_){}
+    , decltype(_impl_.deleted_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.key_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.key_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_key().empty()) {
+    _this->_impl_.key_.Set(from._internal_key(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.value_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.value_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_value().empty()) {
+    _this->_impl_.value_.Set(from._internal_value(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.seq_, &from._impl_.seq_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.deleted_) -
+    reinterpret_cast<char*>(&_impl_.seq_)) + sizeof(_impl_.deleted_));
+  // @@protoc_insertion_point(copy_constructor:chirp.Change)
+}
+
+inline void Change::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.key_){}
+    , decltype(_impl_.value_){}
+    , decltype(_impl_.seq_){uint64_t{0u}}
+    , decltype(_impl_.deleted_){false}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.key_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.key_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.value_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.value_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+Change::~Change() {
+  // @@protoc_insertion_point(destructor:chirp.Change)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void Change::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.key_.Destroy();
+  _impl_.value_.Destroy();
+}
+
+void Change::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void Change::Clear() {
+// @@protoc_insertion_point(message_clear_start:chirp.Change)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.key_.ClearToEmpty();
+  _impl_.value_.ClearToEmpty();
+  ::memset(&_impl_.seq_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.deleted_) -
+      reinterpret_cast<char*>(&_impl_.seq_)) + sizeof(_impl_.deleted_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* Change::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // uint64 seq = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.seq_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // bool deleted = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.deleted_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // bytes key = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          auto str = _internal_mutable_key();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // bytes value = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          auto str = _internal_mutable_value();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* Change::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:chirp.Change)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // uint64 seq = 1;
+  if (this->_internal_seq() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(1, this->_internal_seq(), target);
+  }
+
+  // bool deleted = 2;
+  if (this->_internal_deleted() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(2, this->_internal_deleted(), target);
+  }
+
+  // bytes key = 3;
+  if (!this->_internal_key().empty()) {
+    target = stream->WriteBytesMaybeAliased(
+        3, this->_internal_key(), target);
+  }
+
+  // bytes value = 4;
+  if (!this->_internal_value().empty()) {
+    target = stream->WriteBytesMaybeAliased(
+        4, this->_internal_value(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:chirp.Change)
+  return target;
+}
+
+size_t Change::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:chirp.Change)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // bytes key = 3;
+  if (!this->_internal_key().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_key());
+  }
+
+  // bytes value = 4;
+  if (!this->_internal_value().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_value());
+  }
+
+  // uint64 seq = 1;
+  if (this->_internal_seq() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_seq());
+  }
+
+  // bool deleted = 2;
+  if (this->_internal_deleted() != 0) {
+    total_size += 1 + 1;
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData Change::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    Change::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*Change::GetClassData() const { return &_class_data_; }
+
+
+void Change::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<Change*>(&to_msg);
+  auto& from = static_cast<const Change&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:chirp.Change)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_key().empty()) {
+    _this->_internal_set_key(from._internal_key());
+  }
+  if (!from._internal_value().empty()) {
+    _this->_internal_set_value(from._internal_value());
+  }
+  if (from._internal_seq() != 0) {
+    _this->_internal_set_seq(from._internal_seq());
+  }
+  if (from._internal_deleted() != 0) {
+    _this->_internal_set_deleted(from._internal_deleted());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void Change::CopyFrom(const Change& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:chirp.Change)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool Change::IsInitialized() const {
+  return true;
+}
+
+void Change::InternalSwap(Change* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.key_, lhs_arena,
+      &other->_impl_.key_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.value_, lhs_arena,
+      &other->_impl_.value_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(Change, _impl_.deleted_)
+      + sizeof(Change::_impl_.deleted_)
+      - PROTOBUF_FIELD_OFFSET(Change, _impl_.seq_)>(
+          reinterpret_cast<char*>(&_impl_.seq_),
+          reinterpret_cast<char*>(&other->_impl_.seq_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata Change::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_key_5fvalue_2eproto_getter, &descriptor_table_key_5fvalue_2eproto_once,
+      file_level_metadata_key_5fvalue_2eproto[31]);
+}
+
+// ===================================================================
+
+class ChangesReply::_Internal {
+ public:
+};
+
+ChangesReply::ChangesReply(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:chirp.ChangesReply)
+}
+ChangesReply::ChangesReply(const ChangesReply& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  ChangesReply* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.changes_){from._impl_.changes_}
+    , decltype(_impl_.next_seq_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _this->_impl_.next_seq_ = from._impl_.next_seq_;
+  // @@protoc_insertion_point(copy_constructor:chirp.ChangesReply)
+}
+
+inline void ChangesReply::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.changes_){arena}
+    , decltype(_impl_.next_seq_){uint64_t{0u}}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+ChangesReply::~ChangesReply() {
+  // @@protoc_insertion_point(destructor:chirp.ChangesReply)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void ChangesReply::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.changes_.~RepeatedPtrField();
+}
+
+void ChangesReply::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void ChangesReply::Clear() {
+// @@protoc_insertion_point(message_clear_start:chirp.ChangesReply)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.changes_.Clear();
+  _impl_.next_seq_ = uint64_t{0u};
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* ChangesReply::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // repeated .chirp.Change changes = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_changes(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<10>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 next_seq = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.next_seq_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* ChangesReply::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:chirp.ChangesReply)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // repeated .chirp.Change changes = 1;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_changes_size()); i < n; i++) {
+    const auto& repfield = this->_internal_changes(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(1, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  // uint64 next_seq = 2;
+  if (this->_internal_next_seq() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(2, this->_internal_next_seq(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:chirp.ChangesReply)
+  return target;
+}
+
+size_t ChangesReply::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:chirp.ChangesReply)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .chirp.Change changes = 1;
+  total_size += 1UL * this->_internal_changes_size();
+  for (const auto& msg : this->_impl_.changes_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  // uint64 next_seq = 2;
+  if (this->_internal_next_seq() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_next_seq());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData ChangesReply::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    ChangesReply::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*ChangesReply::GetClassData() const { return &_class_data_; }
+
+
+void ChangesReply::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<ChangesReply*>(&to_msg);
+  auto& from = static_cast<const ChangesReply&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:chirp.ChangesReply)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.changes_.MergeFrom(from._impl_.changes_);
+  if (from._internal_next_seq() != 0) {
+    _this->_internal_set_next_seq(from._internal_next_seq());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void ChangesReply::CopyFrom(const ChangesReply& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:chirp.ChangesReply)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool ChangesReply::IsInitialized() const {
+  return true;
+}
+
+void ChangesReply::InternalSwap(ChangesReply* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.changes_.InternalSwap(&other->_impl_.changes_);
+  swap(_impl_.next_seq_, other->_impl_.next_seq_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata ChangesReply::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_key_5fvalue_2eproto_getter, &descriptor_table_key_5fvalue_2eproto_once,
+      file_level_metadata_key_5fvalue_2eproto[32]);
+}
+
+// ===================================================================
+
+class WatchRequest::_Internal {
+ public:
+};
+
+WatchRequest::WatchRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:chirp.WatchRequest)
+}
+WatchRequest::WatchRequest(const WatchRequest& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  WatchRequest* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.prefixes_){from._impl_.prefixes_}
+    , decltype(_impl_.with_values_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _this->_impl_.with_values_ = from._impl_.with_values_;
+  // @@protoc_insertion_point(copy_constructor:chirp.WatchRequest)
+}
+
+inline void WatchRequest::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.prefixes_){arena}
+    , decltype(_impl_.with_values_){false}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+WatchRequest::~WatchRequest() {
+  // @@protoc_insertion_point(destructor:chirp.WatchRequest)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void WatchRequest::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.prefixes_.~RepeatedPtrField();
+}
+
+void WatchRequest::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void WatchRequest::Clear() {
+// @@protoc_insertion_point(message_clear_start:chirp.WatchRequest)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.prefixes_.Clear();
+  _impl_.with_values_ = false;
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* WatchRequest::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // repeated bytes prefixes = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            auto str = _internal_add_prefixes();
+            ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<10>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // bool with_values = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.with_values_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* WatchRequest::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:chirp.WatchRequest)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // repeated bytes prefixes = 1;
+  for (int i = 0, n = this->_internal_prefixes_size(); i < n; i++) {
+    const auto& s = this->_internal_prefixes(i);
+    target = stream->WriteBytes(1, s, target);
+  }
+
+  // bool with_values = 2;
+  if (this->_internal_with_values() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(2, this->_internal_with_values(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:chirp.WatchRequest)
+  return target;
+}
+
+size_t WatchRequest::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:chirp.WatchRequest)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated bytes prefixes = 1;
+  total_size += 1 *
+      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(_impl_.prefixes_.size());
+  for (int i = 0, n = _impl_.prefixes_.size(); i < n; i++) {
+    total_size += ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+      _impl_.prefixes_.Get(i));
+  }
+
+  // bool with_values = 2;
+  if (this->_internal_with_values() != 0) {
+    total_size += 1 + 1;
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData WatchRequest::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    WatchRequest::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*WatchRequest::GetClassData() const { return &_class_data_; }
+
+
+void WatchRequest::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<WatchRequest*>(&to_msg);
+  auto& from = static_cast<const WatchRequest&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:chirp.WatchRequest)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.prefixes_.MergeFrom(from._impl_.prefixes_);
+  if (from._internal_with_values() != 0) {
+    _this->_internal_set_with_values(from._internal_with_values());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void WatchRequest::CopyFrom(const WatchRequest& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:chirp.WatchRequest)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool WatchRequest::IsInitialized() const {
+  return true;
+}
+
+void WatchRequest::InternalSwap(WatchRequest* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.prefixes_.InternalSwap(&other->_impl_.prefixes_);
+  swap(_impl_.with_values_, other->_impl_.with_values_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata WatchRequest::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_key_5fvalue_2eproto_getter, &descriptor_table_key_5fvalue_2eproto_once,
+      file_level_metadata_key_5fvalue_2eproto[33]);
+}
+
+// ===================================================================
+
+class WatchEvent::_Internal {
+ public:
+};
+
+WatchEvent::WatchEvent(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:chirp.WatchEvent)
+}
+WatchEvent::WatchEvent(const WatchEvent& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  WatchEvent* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.key_){}
+    , decltype(_impl_.value_){}
+    , decltype(_impl_.deleted_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.key_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.key_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_key().empty()) {
+    _this->_impl_.key_.Set(from._internal_key(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.value_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.value_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_value().empty()) {
+    _this->_impl_.value_.Set(from._internal_value(), 
+      _this->GetArenaForAllocation());
+  }
+  _this->_impl_.deleted_ = from._impl_.deleted_;
+  // @@protoc_insertion_point(copy_constructor:chirp.WatchEvent)
+}
+
+inline void WatchEvent::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.key_){}
+    , decltype(_impl_.value_){}
+    , decltype(_impl_.deleted_){false}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.key_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.key_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.value_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.value_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+WatchEvent::~WatchEvent() {
+  // @@protoc_insertion_point(destructor:chirp.WatchEvent)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void WatchEvent::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.key_.Destroy();
+  _impl_.value_.Destroy();
+}
+
+void WatchEvent::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void WatchEvent::Clear() {
+// @@protoc_insertion_point(message_clear_start:chirp.WatchEvent)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.key_.ClearToEmpty();
+  _impl_.value_.ClearToEmpty();
+  _impl_.deleted_ = false;
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* WatchEvent::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // bytes key = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_key();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // bool deleted = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.deleted_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // bytes value = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          auto str = _internal_mutable_value();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* WatchEvent::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:chirp.WatchEvent)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // bytes key = 1;
+  if (!this->_internal_key().empty()) {
+    target = stream->WriteBytesMaybeAliased(
+        1, this->_internal_key(), target);
+  }
+
+  // bool deleted = 2;
+  if (this->_internal_deleted() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(2, this->_internal_deleted(), target);
+  }
+
+  // bytes value = 3;
+  if (!this->_internal_value().empty()) {
+    target = stream->WriteBytesMaybeAliased(
+        3, this->_internal_value(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:chirp.WatchEvent)
+  return target;
+}
+
+size_t WatchEvent::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:chirp.WatchEvent)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // bytes key = 1;
+  if (!this->_internal_key().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_key());
+  }
+
+  // bytes value = 3;
+  if (!this->_internal_value().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_value());
+  }
+
+  // bool deleted = 2;
+  if (this->_internal_deleted() != 0) {
+    total_size += 1 + 1;
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData WatchEvent::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    WatchEvent::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*WatchEvent::GetClassData() const { return &_class_data_; }
+
+
+void WatchEvent::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<WatchEvent*>(&to_msg);
+  auto& from = static_cast<const WatchEvent&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:chirp.WatchEvent)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_key().empty()) {
+    _this->_internal_set_key(from._internal_key());
+  }
+  if (!from._internal_value().empty()) {
+    _this->_internal_set_value(from._internal_value());
+  }
+  if (from._internal_deleted() != 0) {
+    _this->_internal_set_deleted(from._internal_deleted());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void WatchEvent::CopyFrom(const WatchEvent& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:chirp.WatchEvent)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool WatchEvent::IsInitialized() const {
+  return true;
+}
+
+void WatchEvent::InternalSwap(WatchEvent* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.key_, lhs_arena,
+      &other->_impl_.key_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.value_, lhs_arena,
+      &other->_impl_.value_, rhs_arena
+  );
+  swap(_impl_.deleted_, other->_impl_.deleted_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata WatchEvent::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_key_5fvalue_2eproto_getter, &descriptor_table_key_5fvalue_2eproto_once,
+      file_level_metadata_key_5fvalue_2eproto[34]);
+}
+
+// ===================================================================
+
+class WatchReply::_Internal {
+ public:
+};
+
+WatchReply::WatchReply(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:chirp.WatchReply)
+}
+WatchReply::WatchReply(const WatchReply& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  WatchReply* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.events_){from._impl_.events_}
+    , decltype(_impl_.overflowed_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _this->_impl_.overflowed_ = from._impl_.overflowed_;
+  // @@protoc_insertion_point(copy_constructor:chirp.WatchReply)
+}
+
+inline void WatchReply::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.events_){arena}
+    , decltype(_impl_.overflowed_){false}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+WatchReply::~WatchReply() {
+  // @@protoc_insertion_point(destructor:chirp.WatchReply)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void WatchReply::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.events_.~RepeatedPtrField();
+}
+
+void WatchReply::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void WatchReply::Clear() {
+// @@protoc_insertion_point(message_clear_start:chirp.WatchReply)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.events_.Clear();
+  _impl_.overflowed_ = false;
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* WatchReply::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // repeated .chirp.WatchEvent events = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_events(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<10>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // bool overflowed = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.overflowed_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* WatchReply::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:chirp.WatchReply)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // repeated .chirp.WatchEvent events = 1;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_events_size()); i < n; i++) {
+    const auto& repfield = this->_internal_events(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(1, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  // bool overflowed = 2;
+  if (this->_internal_overflowed() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(2, this->_internal_overflowed(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:chirp.WatchReply)
+  return target;
+}
+
+size_t WatchReply::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:chirp.WatchReply)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .chirp.WatchEvent events = 1;
+  total_size += 1UL * this->_internal_events_size();
+  for (const auto& msg : this->_impl_.events_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  // bool overflowed = 2;
+  if (this->_internal_overflowed() != 0) {
+    total_size += 1 + 1;
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData WatchReply::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    WatchReply::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*WatchReply::GetClassData() const { return &_class_data_; }
+
+
+void WatchReply::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<WatchReply*>(&to_msg);
+  auto& from = static_cast<const WatchReply&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:chirp.WatchReply)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.events_.MergeFrom(from._impl_.events_);
+  if (from._internal_overflowed() != 0) {
+    _this->_internal_set_overflowed(from._internal_overflowed());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void WatchReply::CopyFrom(const WatchReply& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:chirp.WatchReply)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool WatchReply::IsInitialized() const {
+  return true;
+}
+
+void WatchReply::InternalSwap(WatchReply* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.events_.InternalSwap(&other->_impl_.events_);
+  swap(_impl_.overflowed_, other->_impl_.overflowed_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata WatchReply::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_key_5fvalue_2eproto_getter, &descriptor_table_key_5fvalue_2eproto_once,
+      file_level_metadata_key_5fvalue_2eproto[35]);
+}
+
+// ===================================================================
+
+class BatchCondition::_Internal {
+ public:
+};
+
+BatchCondition::BatchCondition(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:chirp.BatchCondition)
+}
+BatchCondition::BatchCondition(const BatchCondition& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  BatchCondition* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.key_){}
+    , decltype(_impl_.expected_){}
+    , decltype(_impl_.exists_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.key_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.key_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_key().empty()) {
+    _this->_impl_.key_.Set(from._internal_key(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.expected_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.expected_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_expected().empty()) {
+    _this->_impl_.expected_.Set(from._internal_expected(), 
+      _this->GetArenaForAllocation());
+  }
+  _this->_impl_.exists_ = from._impl_.exists_;
+  // @@protoc_insertion_point(copy_constructor:chirp.BatchCondition)
+}
+
+inline void BatchCondition::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.key_){}
+    , decltype(_impl_.expected_){}
+    , decltype(_impl_.exists_){false}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.key_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.key_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.expected_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.expected_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+BatchCondition::~BatchCondition() {
+  // @@protoc_insertion_point(destructor:chirp.BatchCondition)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void BatchCondition::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.key_.Destroy();
+  _impl_.expected_.Destroy();
+}
+
+void BatchCondition::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void BatchCondition::Clear() {
+// @@protoc_insertion_point(message_clear_start:chirp.BatchCondition)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.key_.ClearToEmpty();
+  _impl_.expected_.ClearToEmpty();
+  _impl_.exists_ = false;
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* BatchCondition::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // bytes key = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_key();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // bytes expected = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_expected();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // bool exists = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _impl_.exists_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* BatchCondition::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:chirp.BatchCondition)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // bytes key = 1;
+  if (!this->_internal_key().empty()) {
+    target = stream->WriteBytesMaybeAliased(
+        1, this->_internal_key(), target);
+  }
+
+  // bytes expected = 2;
+  if (!this->_internal_expected().empty()) {
+    target = stream->WriteBytesMaybeAliased(
+        2, this->_internal_expected(), target);
+  }
+
+  // bool exists = 3;
+  if (this->_internal_exists() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(3, this->_internal_exists(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:chirp.BatchCondition)
+  return target;
+}
+
+size_t BatchCondition::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:chirp.BatchCondition)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // bytes key = 1;
+  if (!this->_internal_key().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_key());
+  }
+
+  // bytes expected = 2;
+  if (!this->_internal_expected().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_expected());
+  }
+
+  // bool exists = 3;
+  if (this->_internal_exists() != 0) {
+    total_size += 1 + 1;
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData BatchCondition::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    BatchCondition::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*BatchCondition::GetClassData() const { return &_class_data_; }
+
+
+void BatchCondition::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<BatchCondition*>(&to_msg);
+  auto& from = static_cast<const BatchCondition&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:chirp.BatchCondition)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_key().empty()) {
+    _this->_internal_set_key(from._internal_key());
+  }
+  if (!from._internal_expected().empty()) {
+    _this->_internal_set_expected(from._internal_expected());
+  }
+  if (from._internal_exists() != 0) {
+    _this->_internal_set_exists(from._internal_exists());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void BatchCondition::CopyFrom(const BatchCondition& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:chirp.BatchCondition)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool BatchCondition::IsInitialized() const {
+  return true;
+}
+
+void BatchCondition::InternalSwap(BatchCondition* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.key_, lhs_arena,
+      &other->_impl_.key_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.expected_, lhs_arena,
+      &other->_impl_.expected_, rhs_arena
+  );
+  swap(_impl_.exists_, other->_impl_.exists_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata BatchCondition::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_key_5fvalue_2eproto_getter, &descriptor_table_key_5fvalue_2eproto_once,
+      file_level_metadata_key_5fvalue_2eproto[36]);
+}
+
+// ===================================================================
+
+class BatchWrite::_Internal {
+ public:
+  static const ::chirp::PutRequest& put(const BatchWrite* msg);
+  static const ::chirp::DeleteRequest& delete_key(const BatchWrite* msg);
+  static const ::chirp::ListElementRequest& list_append(const BatchWrite* msg);
+  static const ::chirp::ListElementRequest& list_remove(const BatchWrite* msg);
+};
+
+const ::chirp::PutRequest&
+BatchWrite::_Internal::put(const BatchWrite* msg) {
+  return *msg->_impl_.write_.put_;
+}
+const ::chirp::DeleteRequest&
+BatchWrite::_Internal::delete_key(const BatchWrite* msg) {
+  return *msg->_impl_.write_.delete_key_;
+}
+const ::chirp::ListElementRequest&
+BatchWrite::_Internal::list_append(const BatchWrite* msg) {
+  return *msg->_impl_.write_.list_append_;
+}
+const ::chirp::ListElementRequest&
+BatchWrite::_Internal::list_remove(const BatchWrite* msg) {
+  return *msg->_impl_.write_.list_remove_;
+}
+void BatchWrite::set_allocated_put(::chirp::PutRequest* put) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  clear_write();
+  if (put) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(put);
+    if (message_arena != submessage_arena) {
+      put = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, put, submessage_arena);
+    }
+    set_has_put();
+    _impl_.write_.put_ = put;
+  }
+  // @@protoc_insertion_point(field_set_allocated:chirp.BatchWrite.put)
+}
+void BatchWrite::set_allocated_delete_key(::chirp::DeleteRequest* delete_key) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  clear_write();
+  if (delete_key) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(delete_key);
+    if (message_arena != submessage_arena) {
+      delete_key = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, delete_key, submessage_arena);
+    }
+    set_has_delete_key();
+    _impl_.write_.delete_key_ = delete_key;
+  }
+  // @@protoc_insertion_point(field_set_allocated:chirp.BatchWrite.delete_key)
+}
+void BatchWrite::set_allocated_list_append(::chirp::ListElementRequest* list_append) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  clear_write();
+  if (list_append) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(list_append);
+    if (message_arena != submessage_arena) {
+      list_append = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, list_append, submessage_arena);
+    }
+    set_has_list_append();
+    _impl_.write_.list_append_ = list_append;
+  }
+  // @@protoc_insertion_point(field_set_allocated:chirp.BatchWrite.list_append)
+}
+void BatchWrite::set_allocated_list_remove(::chirp::ListElementRequest* list_remove) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  clear_write();
+  if (list_remove) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(list_remove);
+    if (message_arena != submessage_arena) {
+      list_remove = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, list_remove, submessage_arena);
+    }
+    set_has_list_remove();
+    _impl_.write_.list_remove_ = list_remove;
+  }
+  // @@protoc_insertion_point(field_set_allocated:chirp.BatchWrite.list_remove)
+}
+BatchWrite::BatchWrite(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:chirp.BatchWrite)
+}
+BatchWrite::BatchWrite(const BatchWrite& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  BatchWrite* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.write_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , /*decltype(_impl_._oneof_case_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  clear_has_write();
+  switch (from.write_case()) {
+    case kPut: {
+      _this->_internal_mutable_put()->::chirp::PutRequest::MergeFrom(
+          from._internal_put());
+      break;
+    }
+    case kDeleteKey: {
+      _this->_internal_mutable_delete_key()->::chirp::DeleteRequest::MergeFrom(
+          from._internal_delete_key());
+      break;
+    }
+    case kListAppend: {
+      _this->_internal_mutable_list_append()->::chirp::ListElementRequest::MergeFrom(
+          from._internal_list_append());
+      break;
+    }
+    case kListRemove: {
+      _this->_internal_mutable_list_remove()->::chirp::ListElementRequest::MergeFrom(
+          from._internal_list_remove());
+      break;
+    }
+    case WRITE_NOT_SET: {
+      break;
+    }
+  }
+  // @@protoc_insertion_point(copy_constructor:chirp.BatchWrite)
+}
+
+inline void BatchWrite::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.write_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , /*decltype(_impl_._oneof_case_)*/{}
+  };
+  clear_has_write();
+}
+
+BatchWrite::~BatchWrite() {
+  // @@protoc_insertion_point(destructor:chirp.BatchWrite)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void BatchWrite::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  if (has_write()) {
+    clear_write();
+  }
+}
+
+void BatchWrite::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void BatchWrite::clear_write() {
+// @@protoc_insertion_point(one_of_clear_start:chirp.BatchWrite)
+  switch (write_case()) {
+    case kPut: {
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.write_.put_;
+      }
+      break;
+    }
+    case kDeleteKey: {
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.write_.delete_key_;
+      }
+      break;
+    }
+    case kListAppend: {
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.write_.list_append_;
+      }
+      break;
+    }
+    case kListRemove: {
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.write_.list_remove_;
+      }
+      break;
+    }
+    case WRITE_NOT_SET: {
+      break;
+    }
+  }
+  _impl_._oneof_case_[0] = WRITE_NOT_SET;
+}
+
+
+void BatchWrite::Clear() {
+// @@protoc_insertion_point(message_clear_start:chirp.BatchWrite)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  clear_write();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* BatchWrite::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // .chirp.PutRequest put = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr = ctx->ParseMessage(_internal_mutable_put(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .chirp.DeleteRequest delete_key = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr = ctx->ParseMessage(_internal_mutable_delete_key(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .chirp.ListElementRequest list_append = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          ptr = ctx->ParseMessage(_internal_mutable_list_append(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .chirp.ListElementRequest list_remove = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          ptr = ctx->ParseMessage(_internal_mutable_list_remove(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* BatchWrite::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:chirp.BatchWrite)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // .chirp.PutRequest put = 1;
+  if (_internal_has_put()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(1, _Internal::put(this),
+        _Internal::put(this).GetCachedSize(), target, stream);
+  }
+
+  // .chirp.DeleteRequest delete_key = 2;
+  if (_internal_has_delete_key()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(2, _Internal::delete_key(this),
+        _Internal::delete_key(this).GetCachedSize(), target, stream);
+  }
+
+  // .chirp.ListElementRequest list_append = 3;
+  if (_internal_has_list_append()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(3, _Internal::list_append(this),
+        _Internal::list_append(this).GetCachedSize(), target, stream);
+  }
+
+  // .chirp.ListElementRequest list_remove = 4;
+  if (_internal_has_list_remove()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(4, _Internal::list_remove(this),
+        _Internal::list_remove(this).GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:chirp.BatchWrite)
+  return target;
+}
+
+size_t BatchWrite::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:chirp.BatchWrite)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  switch (write_case()) {
+    // .chirp.PutRequest put = 1;
+    case kPut: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.write_.put_);
+      break;
+    }
+    // .chirp.DeleteRequest delete_key = 2;
+    case kDeleteKey: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.write_.delete_key_);
+      break;
+    }
+    // .chirp.ListElementRequest list_append = 3;
+    case kListAppend: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.write_.list_append_);
+      break;
+    }
+    // .chirp.ListElementRequest list_remove = 4;
+    case kListRemove: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.write_.list_remove_);
+      break;
+    }
+    case WRITE_NOT_SET: {
+      break;
+    }
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData BatchWrite::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    BatchWrite::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*BatchWrite::GetClassData() const { return &_class_data_; }
+
+
+void BatchWrite::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<BatchWrite*>(&to_msg);
+  auto& from = static_cast<const BatchWrite&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:chirp.BatchWrite)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  switch (from.write_case()) {
+    case kPut: {
+      _this->_internal_mutable_put()->::chirp::PutRequest::MergeFrom(
+          from._internal_put());
+      break;
+    }
+    case kDeleteKey: {
+      _this->_internal_mutable_delete_key()->::chirp::DeleteRequest::MergeFrom(
+          from._internal_delete_key());
+      break;
+    }
+    case kListAppend: {
+      _this->_internal_mutable_list_append()->::chirp::ListElementRequest::MergeFrom(
+          from._internal_list_append());
+      break;
+    }
+    case kListRemove: {
+      _this->_internal_mutable_list_remove()->::chirp::ListElementRequest::MergeFrom(
+          from._internal_list_remove());
+      break;
+    }
+    case WRITE_NOT_SET: {
+      break;
+    }
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void BatchWrite::CopyFrom(const BatchWrite& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:chirp.BatchWrite)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool BatchWrite::IsInitialized() const {
+  return true;
+}
+
+void BatchWrite::InternalSwap(BatchWrite* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_.write_, other->_impl_.write_);
+  swap(_impl_._oneof_case_[0], other->_impl_._oneof_case_[0]);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata BatchWrite::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_key_5fvalue_2eproto_getter, &descriptor_table_key_5fvalue_2eproto_once,
+      file_level_metadata_key_5fvalue_2eproto[37]);
+}
+
+// ===================================================================
+
+class WriteBatchRequest::_Internal {
+ public:
+};
+
+WriteBatchRequest::WriteBatchRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:chirp.WriteBatchRequest)
+}
+WriteBatchRequest::WriteBatchRequest(const WriteBatchRequest& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  WriteBatchRequest* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.conditions_){from._impl_.conditions_}
+    , decltype(_impl_.writes_){from._impl_.writes_}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  // @@protoc_insertion_point(copy_constructor:chirp.WriteBatchRequest)
+}
+
+inline void WriteBatchRequest::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.conditions_){arena}
+    , decltype(_impl_.writes_){arena}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+WriteBatchRequest::~WriteBatchRequest() {
+  // @@protoc_insertion_point(destructor:chirp.WriteBatchRequest)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void WriteBatchRequest::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.conditions_.~RepeatedPtrField();
+  _impl_.writes_.~RepeatedPtrField();
+}
+
+void WriteBatchRequest::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void WriteBatchRequest::Clear() {
+// @@protoc_insertion_point(message_clear_start:chirp.WriteBatchRequest)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.conditions_.Clear();
+  _impl_.writes_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* WriteBatchRequest::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // repeated .chirp.BatchCondition conditions = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_conditions(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<10>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .chirp.BatchWrite writes = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_writes(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<18>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* WriteBatchRequest::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:chirp.WriteBatchRequest)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // repeated .chirp.BatchCondition conditions = 1;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_conditions_size()); i < n; i++) {
+    const auto& repfield = this->_internal_conditions(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(1, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  // repeated .chirp.BatchWrite writes = 2;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_writes_size()); i < n; i++) {
+    const auto& repfield = this->_internal_writes(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(2, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:chirp.WriteBatchRequest)
+  return target;
+}
+
+size_t WriteBatchRequest::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:chirp.WriteBatchRequest)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .chirp.BatchCondition conditions = 1;
+  total_size += 1UL * this->_internal_conditions_size();
+  for (const auto& msg : this->_impl_.conditions_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  // repeated .chirp.BatchWrite writes = 2;
+  total_size += 1UL * this->_internal_writes_size();
+  for (const auto& msg : this->_impl_.writes_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData WriteBatchRequest::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    WriteBatchRequest::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*WriteBatchRequest::GetClassData() const { return &_class_data_; }
+
+
+void WriteBatchRequest::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<WriteBatchRequest*>(&to_msg);
+  auto& from = static_cast<const WriteBatchRequest&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:chirp.WriteBatchRequest)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.conditions_.MergeFrom(from._impl_.conditions_);
+  _this->_impl_.writes_.MergeFrom(from._impl_.writes_);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void WriteBatchRequest::CopyFrom(const WriteBatchRequest& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:chirp.WriteBatchRequest)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool WriteBatchRequest::IsInitialized() const {
+  return true;
+}
+
+void WriteBatchRequest::InternalSwap(WriteBatchRequest* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.conditions_.InternalSwap(&other->_impl_.conditions_);
+  _impl_.writes_.InternalSwap(&other->_impl_.writes_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata WriteBatchRequest::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_key_5fvalue_2eproto_getter, &descriptor_table_key_5fvalue_2eproto_once,
+      file_level_metadata_key_5fvalue_2eproto[38]);
+}
+
+// ===================================================================
+
+class WriteBatchReply::_Internal {
+ public:
+};
+
+WriteBatchReply::WriteBatchReply(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:chirp.WriteBatchReply)
+}
+WriteBatchReply::WriteBatchReply(const WriteBatchReply& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  WriteBatchReply* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.actual_){}
+    , decltype(_impl_.applied_){}
+    , decltype(_impl_.failed_condition_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.actual_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.actual_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_actual().empty()) {
+    _this->_impl_.actual_.Set(from._internal_actual(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.applied_, &from._impl_.applied_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.failed_condition_) -
+    reinterpret_cast<char*>(&_impl_.applied_)) + sizeof(_impl_.failed_condition_));
+  // @@protoc_insertion_point(copy_constructor:chirp.WriteBatchReply)
+}
+
+inline void WriteBatchReply::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.actual_){}
+    , decltype(_impl_.applied_){false}
+    , decltype(_impl_.failed_condition_){0u}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.actual_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.actual_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+WriteBatchReply::~WriteBatchReply() {
+  // @@protoc_insertion_point(destructor:chirp.WriteBatchReply)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void WriteBatchReply::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.actual_.Destroy();
+}
+
+void WriteBatchReply::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void WriteBatchReply::Clear() {
+// @@protoc_insertion_point(message_clear_start:chirp.WriteBatchReply)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.actual_.ClearToEmpty();
+  ::memset(&_impl_.applied_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.failed_condition_) -
+      reinterpret_cast<char*>(&_impl_.applied_)) + sizeof(_impl_.failed_condition_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* WriteBatchReply::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // bool applied = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.applied_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint32 failed_condition = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.failed_condition_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // bytes actual = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          auto str = _internal_mutable_actual();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* WriteBatchReply::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:chirp.WriteBatchReply)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // bool applied = 1;
+  if (this->_internal_applied() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(1, this->_internal_applied(), target);
+  }
+
+  // uint32 failed_condition = 2;
+  if (this->_internal_failed_condition() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(2, this->_internal_failed_condition(), target);
+  }
+
+  // bytes actual = 3;
+  if (!this->_internal_actual().empty()) {
+    target = stream->WriteBytesMaybeAliased(
+        3, this->_internal_actual(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:chirp.WriteBatchReply)
+  return target;
+}
+
+size_t WriteBatchReply::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:chirp.WriteBatchReply)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // bytes actual = 3;
+  if (!this->_internal_actual().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_actual());
+  }
+
+  // bool applied = 1;
+  if (this->_internal_applied() != 0) {
+    total_size += 1 + 1;
+  }
+
+  // uint32 failed_condition = 2;
+  if (this->_internal_failed_condition() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_failed_condition());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData WriteBatchReply::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    WriteBatchReply::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*WriteBatchReply::GetClassData() const { return &_class_data_; }
+
+
+void WriteBatchReply::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<WriteBatchReply*>(&to_msg);
+  auto& from = static_cast<const WriteBatchReply&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:chirp.WriteBatchReply)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_actual().empty()) {
+    _this->_internal_set_actual(from._internal_actual());
+  }
+  if (from._internal_applied() != 0) {
+    _this->_internal_set_applied(from._internal_applied());
+  }
+  if (from._internal_failed_condition() != 0) {
+    _this->_internal_set_failed_condition(from._internal_failed_condition());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void WriteBatchReply::CopyFrom(const WriteBatchReply& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:chirp.WriteBatchReply)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool WriteBatchReply::IsInitialized() const {
+  return true;
+}
+
+void WriteBatchReply::InternalSwap(WriteBatchReply* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.actual_, lhs_arena,
+      &other->_impl_.actual_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(WriteBatchReply, _impl_.failed_condition_)
+      + sizeof(WriteBatchReply::_impl_.failed_condition_)
+      - PROTOBUF_FIELD_OFFSET(WriteBatchReply, _impl_.applied_)>(
+          reinterpret_cast<char*>(&_impl_.applied_),
+          reinterpret_cast<char*>(&other->_impl_.applied_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata WriteBatchReply::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_key_5fvalue_2eproto_getter, &descriptor_table_key_5fvalue_2eproto_once,
+      file_level_metadata_key_5fvalue_2eproto[39]);
+}
+
+// ===================================================================
+
+class ReplicationRecord::_Internal {
+ public:
+};
+
+ReplicationRecord::ReplicationRecord(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:chirp.ReplicationRecord)
+}
+ReplicationRecord::ReplicationRecord(const ReplicationRecord& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  ReplicationRecord* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.key_){}
+    , decltype(_impl_.value_){}
+    , decltype(_impl_.lsn_){}
+    , decltype(_impl_.operation_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.key_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.key_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_key().empty()) {
+    _this->_impl_.key_.Set(from._internal_key(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.value_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.value_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_value().empty()) {
+    _this->_impl_.value_.Set(from._internal_value(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.lsn_, &from._impl_.lsn_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.operation_) -
+    reinterpret_cast<char*>(&_impl_.lsn_)) + sizeof(_impl_.operation_));
+  // @@protoc_insertion_point(copy_constructor:chirp.ReplicationRecord)
+}
+
+inline void ReplicationRecord::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.key_){}
+    , decltype(_impl_.value_){}
+    , decltype(_impl_.lsn_){uint64_t{0u}}
+    , decltype(_impl_.operation_){0u}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.key_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.key_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.value_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.value_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+ReplicationRecord::~ReplicationRecord() {
+  // @@protoc_insertion_point(destructor:chirp.ReplicationRecord)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void ReplicationRecord::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.key_.Destroy();
+  _impl_.value_.Destroy();
+}
+
+void ReplicationRecord::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void ReplicationRecord::Clear() {
+// @@protoc_insertion_point(message_clear_start:chirp.ReplicationRecord)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.key_.ClearToEmpty();
+  _impl_.value_.ClearToEmpty();
+  ::memset(&_impl_.lsn_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.operation_) -
+      reinterpret_cast<char*>(&_impl_.lsn_)) + sizeof(_impl_.operation_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* ReplicationRecord::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // uint64 lsn = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.lsn_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint32 operation = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.operation_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // bytes key = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          auto str = _internal_mutable_key();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // bytes value = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          auto str = _internal_mutable_value();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* ReplicationRecord::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:chirp.ReplicationRecord)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // uint64 lsn = 1;
+  if (this->_internal_lsn() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(1, this->_internal_lsn(), target);
+  }
+
+  // uint32 operation = 2;
+  if (this->_internal_operation() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(2, this->_internal_operation(), target);
+  }
+
+  // bytes key = 3;
+  if (!this->_internal_key().empty()) {
+    target = stream->WriteBytesMaybeAliased(
+        3, this->_internal_key(), target);
+  }
+
+  // bytes value = 4;
+  if (!this->_internal_value().empty()) {
+    target = stream->WriteBytesMaybeAliased(
+        4, this->_internal_value(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:chirp.ReplicationRecord)
+  return target;
+}
+
+size_t ReplicationRecord::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:chirp.ReplicationRecord)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // bytes key = 3;
+  if (!this->_internal_key().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_key());
+  }
+
+  // bytes value = 4;
+  if (!this->_internal_value().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_value());
+  }
+
+  // uint64 lsn = 1;
+  if (this->_internal_lsn() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_lsn());
+  }
+
+  // uint32 operation = 2;
+  if (this->_internal_operation() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_operation());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData ReplicationRecord::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    ReplicationRecord::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*ReplicationRecord::GetClassData() const { return &_class_data_; }
+
+
+void ReplicationRecord::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<ReplicationRecord*>(&to_msg);
+  auto& from = static_cast<const ReplicationRecord&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:chirp.ReplicationRecord)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_key().empty()) {
+    _this->_internal_set_key(from._internal_key());
+  }
+  if (!from._internal_value().empty()) {
+    _this->_internal_set_value(from._internal_value());
+  }
+  if (from._internal_lsn() != 0) {
+    _this->_internal_set_lsn(from._internal_lsn());
+  }
+  if (from._internal_operation() != 0) {
+    _this->_internal_set_operation(from._internal_operation());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void ReplicationRecord::CopyFrom(const ReplicationRecord& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:chirp.ReplicationRecord)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool ReplicationRecord::IsInitialized() const {
+  return true;
+}
+
+void ReplicationRecord::InternalSwap(ReplicationRecord* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.key_, lhs_arena,
+      &other->_impl_.key_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.value_, lhs_arena,
+      &other->_impl_.value_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(ReplicationRecord, _impl_.operation_)
+      + sizeof(ReplicationRecord::_impl_.operation_)
+      - PROTOBUF_FIELD_OFFSET(ReplicationRecord, _impl_.lsn_)>(
+          reinterpret_cast<char*>(&_impl_.lsn_),
+          reinterpret_cast<char*>(&other->_impl_.lsn_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata ReplicationRecord::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_key_5fvalue_2eproto_getter, &descriptor_table_key_5fvalue_2eproto_once,
+      file_level_metadata_key_5fvalue_2eproto[40]);
+}
+
+// ===================================================================
+
+class ReplicationBatch::_Internal {
+ public:
+};
+
+ReplicationBatch::ReplicationBatch(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:chirp.ReplicationBatch)
+}
+ReplicationBatch::ReplicationBatch(const ReplicationBatch& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  ReplicationBatch* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.pairs_){from._impl_.pairs_}
+    , decltype(_impl_.records_){from._impl_.records_}
+    , decltype(_impl_.lsn_){}
+    , decltype(_impl_.reset_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.lsn_, &from._impl_.lsn_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.reset_) -
+    reinterpret_cast<char*>(&_impl_.lsn_)) + sizeof(_impl_.reset_));
+  // @@protoc_insertion_point(copy_constructor:chirp.ReplicationBatch)
+}
+
+inline void ReplicationBatch::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.pairs_){arena}
+    , decltype(_impl_.records_){arena}
+    , decltype(_impl_.lsn_){uint64_t{0u}}
+    , decltype(_impl_.reset_){false}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+ReplicationBatch::~ReplicationBatch() {
+  // @@protoc_insertion_point(destructor:chirp.ReplicationBatch)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void ReplicationBatch::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.pairs_.~RepeatedPtrField();
+  _impl_.records_.~RepeatedPtrField();
+}
+
+void ReplicationBatch::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void ReplicationBatch::Clear() {
+// @@protoc_insertion_point(message_clear_start:chirp.ReplicationBatch)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.pairs_.Clear();
+  _impl_.records_.Clear();
+  ::memset(&_impl_.lsn_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.reset_) -
+      reinterpret_cast<char*>(&_impl_.lsn_)) + sizeof(_impl_.reset_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* ReplicationBatch::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // bool reset = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.reset_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .chirp.PutRequest pairs = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_pairs(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<18>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .chirp.ReplicationRecord records = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_records(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<26>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 lsn = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _impl_.lsn_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* ReplicationBatch::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:chirp.ReplicationBatch)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // bool reset = 1;
+  if (this->_internal_reset() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(1, this->_internal_reset(), target);
+  }
+
+  // repeated .chirp.PutRequest pairs = 2;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_pairs_size()); i < n; i++) {
+    const auto& repfield = this->_internal_pairs(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(2, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  // repeated .chirp.ReplicationRecord records = 3;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_records_size()); i < n; i++) {
+    const auto& repfield = this->_internal_records(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(3, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  // uint64 lsn = 4;
+  if (this->_internal_lsn() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(4, this->_internal_lsn(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:chirp.ReplicationBatch)
+  return target;
+}
+
+size_t ReplicationBatch::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:chirp.ReplicationBatch)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .chirp.PutRequest pairs = 2;
+  total_size += 1UL * this->_internal_pairs_size();
+  for (const auto& msg : this->_impl_.pairs_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  // repeated .chirp.ReplicationRecord records = 3;
+  total_size += 1UL * this->_internal_records_size();
+  for (const auto& msg : this->_impl_.records_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  // uint64 lsn = 4;
+  if (this->_internal_lsn() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_lsn());
+  }
+
+  // bool reset = 1;
+  if (this->_internal_reset() != 0) {
+    total_size += 1 + 1;
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData ReplicationBatch::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    ReplicationBatch::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*ReplicationBatch::GetClassData() const { return &_class_data_; }
+
+
+void ReplicationBatch::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<ReplicationBatch*>(&to_msg);
+  auto& from = static_cast<const ReplicationBatch&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:chirp.ReplicationBatch)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.pairs_.MergeFrom(from._impl_.pairs_);
+  _this->_impl_.records_.MergeFrom(from._impl_.records_);
+  if (from._internal_lsn() != 0) {
+    _this->_internal_set_lsn(from._internal_lsn());
+  }
+  if (from._internal_reset() != 0) {
+    _this->_internal_set_reset(from._internal_reset());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void ReplicationBatch::CopyFrom(const ReplicationBatch& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:chirp.ReplicationBatch)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool ReplicationBatch::IsInitialized() const {
+  return true;
+}
+
+void ReplicationBatch::InternalSwap(ReplicationBatch* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.pairs_.InternalSwap(&other->_impl_.pairs_);
+  _impl_.records_.InternalSwap(&other->_impl_.records_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(ReplicationBatch, _impl_.reset_)
+      + sizeof(ReplicationBatch::_impl_.reset_)
+      - PROTOBUF_FIELD_OFFSET(ReplicationBatch, _impl_.lsn_)>(
+          reinterpret_cast<char*>(&_impl_.lsn_),
+          reinterpret_cast<char*>(&other->_impl_.lsn_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata ReplicationBatch::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_key_5fvalue_2eproto_getter, &descriptor_table_key_5fvalue_2eproto_once,
+      file_level_metadata_key_5fvalue_2eproto[41]);
+}
+
+// ===================================================================
+
+class ReplicationAck::_Internal {
+ public:
+};
+
+ReplicationAck::ReplicationAck(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:chirp.ReplicationAck)
+}
+ReplicationAck::ReplicationAck(const ReplicationAck& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  ReplicationAck* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.applied_lsn_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _this->_impl_.applied_lsn_ = from._impl_.applied_lsn_;
+  // @@protoc_insertion_point(copy_constructor:chirp.ReplicationAck)
+}
+
+inline void ReplicationAck::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.applied_lsn_){uint64_t{0u}}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+ReplicationAck::~ReplicationAck() {
+  // @@protoc_insertion_point(destructor:chirp.ReplicationAck)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void ReplicationAck::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void ReplicationAck::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void ReplicationAck::Clear() {
+// @@protoc_insertion_point(message_clear_start:chirp.ReplicationAck)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.applied_lsn_ = uint64_t{0u};
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* ReplicationAck::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // uint64 applied_lsn = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.applied_lsn_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* ReplicationAck::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:chirp.ReplicationAck)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // uint64 applied_lsn = 1;
+  if (this->_internal_applied_lsn() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(1, this->_internal_applied_lsn(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:chirp.ReplicationAck)
+  return target;
+}
+
+size_t ReplicationAck::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:chirp.ReplicationAck)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // uint64 applied_lsn = 1;
+  if (this->_internal_applied_lsn() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_applied_lsn());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData ReplicationAck::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    ReplicationAck::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*ReplicationAck::GetClassData() const { return &_class_data_; }
+
+
+void ReplicationAck::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<ReplicationAck*>(&to_msg);
+  auto& from = static_cast<const ReplicationAck&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:chirp.ReplicationAck)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_applied_lsn() != 0) {
+    _this->_internal_set_applied_lsn(from._internal_applied_lsn());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void ReplicationAck::CopyFrom(const ReplicationAck& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:chirp.ReplicationAck)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool ReplicationAck::IsInitialized() const {
+  return true;
+}
+
+void ReplicationAck::InternalSwap(ReplicationAck* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_.applied_lsn_, other->_impl_.applied_lsn_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata ReplicationAck::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_key_5fvalue_2eproto_getter, &descriptor_table_key_5fvalue_2eproto_once,
+      file_level_metadata_key_5fvalue_2eproto[42]);
+}
+
+// @@protoc_insertion_point(namespace_scope)
+}  // namespace chirp
+PROTOBUF_NAMESPACE_OPEN
+template<> PROTOBUF_NOINLINE ::chirp::PutRequest*
+Arena::CreateMaybeMessage< ::chirp::PutRequest >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::chirp::PutRequest >(arena);
+}
+template<> PROTOBUF_NOINLINE ::chirp::PutReply*
+Arena::CreateMaybeMessage< ::chirp::PutReply >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::chirp::PutReply >(arena);
+}
+template<> PROTOBUF_NOINLINE ::chirp::GetRequest*
+Arena::CreateMaybeMessage< ::chirp::GetRequest >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::chirp::GetRequest >(arena);
+}
+template<> PROTOBUF_NOINLINE ::chirp::GetReply*
+Arena::CreateMaybeMessage< ::chirp::GetReply >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::chirp::GetReply >(arena);
+}
+template<> PROTOBUF_NOINLINE ::chirp::DeleteRequest*
+Arena::CreateMaybeMessage< ::chirp::DeleteRequest >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::chirp::DeleteRequest >(arena);
+}
+template<> PROTOBUF_NOINLINE ::chirp::DeleteReply*
+Arena::CreateMaybeMessage< ::chirp::DeleteReply >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::chirp::DeleteReply >(arena);
+}
+template<> PROTOBUF_NOINLINE ::chirp::MultiPutRequest*
+Arena::CreateMaybeMessage< ::chirp::MultiPutRequest >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::chirp::MultiPutRequest >(arena);
+}
+template<> PROTOBUF_NOINLINE ::chirp::MultiPutReply*
+Arena::CreateMaybeMessage< ::chirp::MultiPutReply >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::chirp::MultiPutReply >(arena);
+}
+template<> PROTOBUF_NOINLINE ::chirp::MultiDeleteRequest*
+Arena::CreateMaybeMessage< ::chirp::MultiDeleteRequest >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::chirp::MultiDeleteRequest >(arena);
+}
+template<> PROTOBUF_NOINLINE ::chirp::MultiDeleteReply*
+Arena::CreateMaybeMessage< ::chirp::MultiDeleteReply >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::chirp::MultiDeleteReply >(arena);
+}
+template<> PROTOBUF_NOINLINE ::chirp::FetchAddRequest*
+Arena::CreateMaybeMessage< ::chirp::FetchAddRequest >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::chirp::FetchAddRequest >(arena);
+}
+template<> PROTOBUF_NOINLINE ::chirp::FetchAddReply*
+Arena::CreateMaybeMessage< ::chirp::FetchAddReply >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::chirp::FetchAddReply >(arena);
+}
+template<> PROTOBUF_NOINLINE ::chirp::CompareAndSwapRequest*
+Arena::CreateMaybeMessage< ::chirp::CompareAndSwapRequest >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::chirp::CompareAndSwapRequest >(arena);
+}
+template<> PROTOBUF_NOINLINE ::chirp::CompareAndSwapReply*
+Arena::CreateMaybeMessage< ::chirp::CompareAndSwapReply >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::chirp::CompareAndSwapReply >(arena);
+}
+template<> PROTOBUF_NOINLINE ::chirp::ScanRequest*
+Arena::CreateMaybeMessage< ::chirp::ScanRequest >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::chirp::ScanRequest >(arena);
+}
+template<> PROTOBUF_NOINLINE ::chirp::ScanReply*
+Arena::CreateMaybeMessage< ::chirp::ScanReply >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::chirp::ScanReply >(arena);
+}
+template<> PROTOBUF_NOINLINE ::chirp::ListElementRequest*
+Arena::CreateMaybeMessage< ::chirp::ListElementRequest >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::chirp::ListElementRequest >(arena);
+}
+template<> PROTOBUF_NOINLINE ::chirp::ListElementReply*
+Arena::CreateMaybeMessage< ::chirp::ListElementReply >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::chirp::ListElementReply >(arena);
+}
+template<> PROTOBUF_NOINLINE ::chirp::MemoryUsageRequest*
+Arena::CreateMaybeMessage< ::chirp::MemoryUsageRequest >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::chirp::MemoryUsageRequest >(arena);
+}
+template<> PROTOBUF_NOINLINE ::chirp::PrefixUsage*
+Arena::CreateMaybeMessage< ::chirp::PrefixUsage >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::chirp::PrefixUsage >(arena);
+}
+template<> PROTOBUF_NOINLINE ::chirp::MemoryUsageReply*
+Arena::CreateMaybeMessage< ::chirp::MemoryUsageReply >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::chirp::MemoryUsageReply >(arena);
+}
+template<> PROTOBUF_NOINLINE ::chirp::StatsRequest*
+Arena::CreateMaybeMessage< ::chirp::StatsRequest >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::chirp::StatsRequest >(arena);
+}
+template<> PROTOBUF_NOINLINE ::chirp::OperationStats*
+Arena::CreateMaybeMessage< ::chirp::OperationStats >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::chirp::OperationStats >(arena);
+}
+template<> PROTOBUF_NOINLINE ::chirp::StatsReply*
+Arena::CreateMaybeMessage< ::chirp::StatsReply >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::chirp::StatsReply >(arena);
+}
+template<> PROTOBUF_NOINLINE ::chirp::ExistsRequest*
+Arena::CreateMaybeMessage< ::chirp::ExistsRequest >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::chirp::ExistsRequest >(arena);
+}
+template<> PROTOBUF_NOINLINE ::chirp::ExistsReply*
+Arena::CreateMaybeMessage< ::chirp::ExistsReply >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::chirp::ExistsReply >(arena);
+}
+template<> PROTOBUF_NOINLINE ::chirp::CreateSnapshotRequest*
+Arena::CreateMaybeMessage< ::chirp::CreateSnapshotRequest >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::chirp::CreateSnapshotRequest >(arena);
+}
+template<> PROTOBUF_NOINLINE ::chirp::CreateSnapshotReply*
+Arena::CreateMaybeMessage< ::chirp::CreateSnapshotReply >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::chirp::CreateSnapshotReply >(arena);
+}
+template<> PROTOBUF_NOINLINE ::chirp::ReleaseSnapshotRequest*
+Arena::CreateMaybeMessage< ::chirp::ReleaseSnapshotRequest >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::chirp::ReleaseSnapshotRequest >(arena);
+}
+template<> PROTOBUF_NOINLINE ::chirp::ReleaseSnapshotReply*
+Arena::CreateMaybeMessage< ::chirp::ReleaseSnapshotReply >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::chirp::ReleaseSnapshotReply >(arena);
+}
+template<> PROTOBUF_NOINLINE ::chirp::ChangesRequest*
+Arena::CreateMaybeMessage< ::chirp::ChangesRequest >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::chirp::ChangesRequest >(arena);
+}
+template<> PROTOBUF_NOINLINE ::chirp::Change*
+Arena::CreateMaybeMessage< ::chirp::Change >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::chirp::Change >(arena);
+}
+template<> PROTOBUF_NOINLINE ::chirp::ChangesReply*
+Arena::CreateMaybeMessage< ::chirp::ChangesReply >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::chirp::ChangesReply >(arena);
+}
+template<> PROTOBUF_NOINLINE ::chirp::WatchRequest*
+Arena::CreateMaybeMessage< ::chirp::WatchRequest >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::chirp::WatchRequest >(arena);
+}
+template<> PROTOBUF_NOINLINE ::chirp::WatchEvent*
+Arena::CreateMaybeMessage< ::chirp::WatchEvent >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::chirp::WatchEvent >(arena);
+}
+template<> PROTOBUF_NOINLINE ::chirp::WatchReply*
+Arena::CreateMaybeMessage< ::chirp::WatchReply >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::chirp::WatchReply >(arena);
+}
+template<> PROTOBUF_NOINLINE ::chirp::BatchCondition*
+Arena::CreateMaybeMessage< ::chirp::BatchCondition >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::chirp::BatchCondition >(arena);
+}
+template<> PROTOBUF_NOINLINE ::chirp::BatchWrite*
+Arena::CreateMaybeMessage< ::chirp::BatchWrite >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::chirp::BatchWrite >(arena);
+}
+template<> PROTOBUF_NOINLINE ::chirp::WriteBatchRequest*
+Arena::CreateMaybeMessage< ::chirp::WriteBatchRequest >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::chirp::WriteBatchRequest >(arena);
+}
+template<> PROTOBUF_NOINLINE ::chirp::WriteBatchReply*
+Arena::CreateMaybeMessage< ::chirp::WriteBatchReply >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::chirp::WriteBatchReply >(arena);
+}
+template<> PROTOBUF_NOINLINE ::chirp::ReplicationRecord*
+Arena::CreateMaybeMessage< ::chirp::ReplicationRecord >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::chirp::ReplicationRecord >(arena);
+}
+template<> PROTOBUF_NOINLINE ::chirp::ReplicationBatch*
+Arena::CreateMaybeMessage< ::chirp::ReplicationBatch >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::chirp::ReplicationBatch >(arena);
+}
+template<> PROTOBUF_NOINLINE ::chirp::ReplicationAck*
+Arena::CreateMaybeMessage< ::chirp::ReplicationAck >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::chirp::ReplicationAck >(arena);
+}
+PROTOBUF_NAMESPACE_CLOSE
+
+// @@protoc_insertion_point(global_scope)
+#include <google/protobuf/port_undef.inc>
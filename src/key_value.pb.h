@@ -0,0 +1,11140 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: key_value.proto
+
+#ifndef GOOGLE_PROTOBUF_INCLUDED_key_5fvalue_2eproto
+#define GOOGLE_PROTOBUF_INCLUDED_key_5fvalue_2eproto
+
+#include <limits>
+#include <string>
+
+#include <google/protobuf/port_def.inc>
+#if PROTOBUF_VERSION < 3021000
+#error This file was generated by a newer version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please update
+#error your headers.
+#endif
+#if 3021012 < PROTOBUF_MIN_PROTOC_VERSION
+#error This file was generated by an older version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please
+#error regenerate this file with a newer version of protoc.
+#endif
+
+#include <google/protobuf/port_undef.inc>
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/arena.h>
+#include <google/protobuf/arenastring.h>
+#include <google/protobuf/generated_message_bases.h>
+#include <google/protobuf/generated_message_util.h>
+#include <google/protobuf/metadata_lite.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/message.h>
+#include <google/protobuf/repeated_field.h>  // IWYU pragma: export
+#include <google/protobuf/extension_set.h>  // IWYU pragma: export
+#include <google/protobuf/unknown_field_set.h>
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+#define PROTOBUF_INTERNAL_EXPORT_key_5fvalue_2eproto
+PROTOBUF_NAMESPACE_OPEN
+namespace internal {
+class AnyMetadata;
+}  // namespace internal
+PROTOBUF_NAMESPACE_CLOSE
+
+// Internal implementation detail -- do not use these members.
+struct TableStruct_key_5fvalue_2eproto {
+  static const uint32_t offsets[];
+};
+extern const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_key_5fvalue_2eproto;
+namespace chirp {
+class BatchCondition;
+struct BatchConditionDefaultTypeInternal;
+extern BatchConditionDefaultTypeInternal _BatchCondition_default_instance_;
+class BatchWrite;
+struct BatchWriteDefaultTypeInternal;
+extern BatchWriteDefaultTypeInternal _BatchWrite_default_instance_;
+class Change;
+struct ChangeDefaultTypeInternal;
+extern ChangeDefaultTypeInternal _Change_default_instance_;
+class ChangesReply;
+struct ChangesReplyDefaultTypeInternal;
+extern ChangesReplyDefaultTypeInternal _ChangesReply_default_instance_;
+class ChangesRequest;
+struct ChangesRequestDefaultTypeInternal;
+extern ChangesRequestDefaultTypeInternal _ChangesRequest_default_instance_;
+class CompareAndSwapReply;
+struct CompareAndSwapReplyDefaultTypeInternal;
+extern CompareAndSwapReplyDefaultTypeInternal _CompareAndSwapReply_default_instance_;
+class CompareAndSwapRequest;
+struct CompareAndSwapRequestDefaultTypeInternal;
+extern CompareAndSwapRequestDefaultTypeInternal _CompareAndSwapRequest_default_instance_;
+class CreateSnapshotReply;
+struct CreateSnapshotReplyDefaultTypeInternal;
+extern CreateSnapshotReplyDefaultTypeInternal _CreateSnapshotReply_default_instance_;
+class CreateSnapshotRequest;
+struct CreateSnapshotRequestDefaultTypeInternal;
+extern CreateSnapshotRequestDefaultTypeInternal _CreateSnapshotRequest_default_instance_;
+class DeleteReply;
+struct DeleteReplyDefaultTypeInternal;
+extern DeleteReplyDefaultTypeInternal _DeleteReply_default_instance_;
+class DeleteRequest;
+struct DeleteRequestDefaultTypeInternal;
+extern DeleteRequestDefaultTypeInternal _DeleteRequest_default_instance_;
+class ExistsReply;
+struct ExistsReplyDefaultTypeInternal;
+extern ExistsReplyDefaultTypeInternal _ExistsReply_default_instance_;
+class ExistsRequest;
+struct ExistsRequestDefaultTypeInternal;
+extern ExistsRequestDefaultTypeInternal _ExistsRequest_default_instance_;
+class FetchAddReply;
+struct FetchAddReplyDefaultTypeInternal;
+extern FetchAddReplyDefaultTypeInternal _FetchAddReply_default_instance_;
+class FetchAddRequest;
+struct FetchAddRequestDefaultTypeInternal;
+extern FetchAddRequestDefaultTypeInternal _FetchAddRequest_default_instance_;
+class GetReply;
+struct GetReplyDefaultTypeInternal;
+extern GetReplyDefaultTypeInternal _GetReply_default_instance_;
+class GetRequest;
+struct GetRequestDefaultTypeInternal;
+extern GetRequestDefaultTypeInternal _GetRequest_default_instance_;
+class ListElementReply;
+struct ListElementReplyDefaultTypeInternal;
+extern ListElementReplyDefaultTypeInternal _ListElementReply_default_instance_;
+class ListElementRequest;
+struct ListElementRequestDefaultTypeInternal;
+extern ListElementRequestDefaultTypeInternal _ListElementRequest_default_instance_;
+class MemoryUsageReply;
+struct MemoryUsageReplyDefaultTypeInternal;
+extern MemoryUsageReplyDefaultTypeInternal _MemoryUsageReply_default_instance_;
+class MemoryUsageRequest;
+struct MemoryUsageRequestDefaultTypeInternal;
+extern MemoryUsageRequestDefaultTypeInternal _MemoryUsageRequest_default_instance_;
+class MultiDeleteReply;
+struct MultiDeleteReplyDefaultTypeInternal;
+extern MultiDeleteReplyDefaultTypeInternal _MultiDeleteReply_default_instance_;
+class MultiDeleteRequest;
+struct MultiDeleteRequestDefaultTypeInternal;
+extern MultiDeleteRequestDefaultTypeInternal _MultiDeleteRequest_default_instance_;
+class MultiPutReply;
+struct MultiPutReplyDefaultTypeInternal;
+extern MultiPutReplyDefaultTypeInternal _MultiPutReply_default_instance_;
+class MultiPutRequest;
+struct MultiPutRequestDefaultTypeInternal;
+extern MultiPutRequestDefaultTypeInternal _MultiPutRequest_default_instance_;
+class OperationStats;
+struct OperationStatsDefaultTypeInternal;
+extern OperationStatsDefaultTypeInternal _OperationStats_default_instance_;
+class PrefixUsage;
+struct PrefixUsageDefaultTypeInternal;
+extern PrefixUsageDefaultTypeInternal _PrefixUsage_default_instance_;
+class PutReply;
+struct PutReplyDefaultTypeInternal;
+extern PutReplyDefaultTypeInternal _PutReply_default_instance_;
+class PutRequest;
+struct PutRequestDefaultTypeInternal;
+extern PutRequestDefaultTypeInternal _PutRequest_default_instance_;
+class ReleaseSnapshotReply;
+struct ReleaseSnapshotReplyDefaultTypeInternal;
+extern ReleaseSnapshotReplyDefaultTypeInternal _ReleaseSnapshotReply_default_instance_;
+class ReleaseSnapshotRequest;
+struct ReleaseSnapshotRequestDefaultTypeInternal;
+extern ReleaseSnapshotRequestDefaultTypeInternal _ReleaseSnapshotRequest_default_instance_;
+class ReplicationAck;
+struct ReplicationAckDefaultTypeInternal;
+extern ReplicationAckDefaultTypeInternal _ReplicationAck_default_instance_;
+class ReplicationBatch;
+struct ReplicationBatchDefaultTypeInternal;
+extern ReplicationBatchDefaultTypeInternal _ReplicationBatch_default_instance_;
+class ReplicationRecord;
+struct ReplicationRecordDefaultTypeInternal;
+extern ReplicationRecordDefaultTypeInternal _ReplicationRecord_default_instance_;
+class ScanReply;
+struct ScanReplyDefaultTypeInternal;
+extern ScanReplyDefaultTypeInternal _ScanReply_default_instance_;
+class ScanRequest;
+struct ScanRequestDefaultTypeInternal;
+extern ScanRequestDefaultTypeInternal _ScanRequest_default_instance_;
+class StatsReply;
+struct StatsReplyDefaultTypeInternal;
+extern StatsReplyDefaultTypeInternal _StatsReply_default_instance_;
+class StatsRequest;
+struct StatsRequestDefaultTypeInternal;
+extern StatsRequestDefaultTypeInternal _StatsRequest_default_instance_;
+class WatchEvent;
+struct WatchEventDefaultTypeInternal;
+extern WatchEventDefaultTypeInternal _WatchEvent_default_instance_;
+class WatchReply;
+struct WatchReplyDefaultTypeInternal;
+extern WatchReplyDefaultTypeInternal _WatchReply_default_instance_;
+class WatchRequest;
+struct WatchRequestDefaultTypeInternal;
+extern WatchRequestDefaultTypeInternal _WatchRequest_default_instance_;
+class WriteBatchReply;
+struct WriteBatchReplyDefaultTypeInternal;
+extern WriteBatchReplyDefaultTypeInternal _WriteBatchReply_default_instance_;
+class WriteBatchRequest;
+struct WriteBatchRequestDefaultTypeInternal;
+extern WriteBatchRequestDefaultTypeInternal _WriteBatchRequest_default_instance_;
+}  // namespace chirp
+PROTOBUF_NAMESPACE_OPEN
+template<> ::chirp::BatchCondition* Arena::CreateMaybeMessage<::chirp::BatchCondition>(Arena*);
+template<> ::chirp::BatchWrite* Arena::CreateMaybeMessage<::chirp::BatchWrite>(Arena*);
+template<> ::chirp::Change* Arena::CreateMaybeMessage<::chirp::Change>(Arena*);
+template<> ::chirp::ChangesReply* Arena::CreateMaybeMessage<::chirp::ChangesReply>(Arena*);
+template<> ::chirp::ChangesRequest* Arena::CreateMaybeMessage<::chirp::ChangesRequest>(Arena*);
+template<> ::chirp::CompareAndSwapReply* Arena::CreateMaybeMessage<::chirp::CompareAndSwapReply>(Arena*);
+template<> ::chirp::CompareAndSwapRequest* Arena::CreateMaybeMessage<::chirp::CompareAndSwapRequest>(Arena*);
+template<> ::chirp::CreateSnapshotReply* Arena::CreateMaybeMessage<::chirp::CreateSnapshotReply>(Arena*);
+template<> ::chirp::CreateSnapshotRequest* Arena::CreateMaybeMessage<::chirp::CreateSnapshotRequest>(Arena*);
+template<> ::chirp::DeleteReply* Arena::CreateMaybeMessage<::chirp::DeleteReply>(Arena*);
+template<> ::chirp::DeleteRequest* Arena::CreateMaybeMessage<::chirp::DeleteRequest>(Arena*);
+template<> ::chirp::ExistsReply* Arena::CreateMaybeMessage<::chirp::ExistsReply>(Arena*);
+template<> ::chirp::ExistsRequest* Arena::CreateMaybeMessage<::chirp::ExistsRequest>(Arena*);
+template<> ::chirp::FetchAddReply* Arena::CreateMaybeMessage<::chirp::FetchAddReply>(Arena*);
+template<> ::chirp::FetchAddRequest* Arena::CreateMaybeMessage<::chirp::FetchAddRequest>(Arena*);
+template<> ::chirp::GetReply* Arena::CreateMaybeMessage<::chirp::GetReply>(Arena*);
+template<> ::chirp::GetRequest* Arena::CreateMaybeMessage<::chirp::GetRequest>(Arena*);
+template<> ::chirp::ListElementReply* Arena::CreateMaybeMessage<::chirp::ListElementReply>(Arena*);
+template<> ::chirp::ListElementRequest* Arena::CreateMaybeMessage<::chirp::ListElementRequest>(Arena*);
+template<> ::chirp::MemoryUsageReply* Arena::CreateMaybeMessage<::chirp::MemoryUsageReply>(Arena*);
+template<> ::chirp::MemoryUsageRequest* Arena::CreateMaybeMessage<::chirp::MemoryUsageRequest>(Arena*);
+template<> ::chirp::MultiDeleteReply* Arena::CreateMaybeMessage<::chirp::MultiDeleteReply>(Arena*);
+template<> ::chirp::MultiDeleteRequest* Arena::CreateMaybeMessage<::chirp::MultiDeleteRequest>(Arena*);
+template<> ::chirp::MultiPutReply* Arena::CreateMaybeMessage<::chirp::MultiPutReply>(Arena*);
+template<> ::chirp::MultiPutRequest* Arena::CreateMaybeMessage<::chirp::MultiPutRequest>(Arena*);
+template<> ::chirp::OperationStats* Arena::CreateMaybeMessage<::chirp::OperationStats>(Arena*);
+template<> ::chirp::PrefixUsage* Arena::CreateMaybeMessage<::chirp::PrefixUsage>(Arena*);
+template<> ::chirp::PutReply* Arena::CreateMaybeMessage<::chirp::PutReply>(Arena*);
+template<> ::chirp::PutRequest* Arena::CreateMaybeMessage<::chirp::PutRequest>(Arena*);
+template<> ::chirp::ReleaseSnapshotReply* Arena::CreateMaybeMessage<::chirp::ReleaseSnapshotReply>(Arena*);
+template<> ::chirp::ReleaseSnapshotRequest* Arena::CreateMaybeMessage<::chirp::ReleaseSnapshotRequest>(Arena*);
+template<> ::chirp::ReplicationAck* Arena::CreateMaybeMessage<::chirp::ReplicationAck>(Arena*);
+template<> ::chirp::ReplicationBatch* Arena::CreateMaybeMessage<::chirp::ReplicationBatch>(Arena*);
+template<> ::chirp::ReplicationRecord* Arena::CreateMaybeMessage<::chirp::ReplicationRecord>(Arena*);
+template<> ::chirp::ScanReply* Arena::CreateMaybeMessage<::chirp::ScanReply>(Arena*);
+template<> ::chirp::ScanRequest* Arena::CreateMaybeMessage<::chirp::ScanRequest>(Arena*);
+template<> ::chirp::StatsReply* Arena::CreateMaybeMessage<::chirp::StatsReply>(Arena*);
+template<> ::chirp::StatsRequest* Arena::CreateMaybeMessage<::chirp::StatsRequest>(Arena*);
+template<> ::chirp::WatchEvent* Arena::CreateMaybeMessage<::chirp::WatchEvent>(Arena*);
+template<> ::chirp::WatchReply* Arena::CreateMaybeMessage<::chirp::WatchReply>(Arena*);
+template<> ::chirp::WatchRequest* Arena::CreateMaybeMessage<::chirp::WatchRequest>(Arena*);
+template<> ::chirp::WriteBatchReply* Arena::CreateMaybeMessage<::chirp::WriteBatchReply>(Arena*);
+template<> ::chirp::WriteBatchRequest* Arena::CreateMaybeMessage<::chirp::WriteBatchRequest>(Arena*);
+PROTOBUF_NAMESPACE_CLOSE
+namespace chirp {
+
+// ===================================================================
+
+class PutRequest final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:chirp.PutRequest) */ {
+ public:
+  inline PutRequest() : PutRequest(nullptr) {}
+  ~PutRequest() override;
+  explicit PROTOBUF_CONSTEXPR PutRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  PutRequest(const PutRequest& from);
+  PutRequest(PutRequest&& from) noexcept
+    : PutRequest() {
+    *this = ::std::move(from);
+  }
+
+  inline PutRequest& operator=(const PutRequest& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline PutRequest& operator=(PutRequest&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const PutRequest& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const PutRequest* internal_default_instance() {
+    return reinterpret_cast<const PutRequest*>(
+               &_PutRequest_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    0;
+
+  friend void swap(PutRequest& a, PutRequest& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(PutRequest* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(PutRequest* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  PutRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<PutRequest>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const PutRequest& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const PutRequest& from) {
+    PutRequest::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(PutRequest* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "chirp.PutRequest";
+  }
+  protected:
+  explicit PutRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kKeyFieldNumber = 1,
+    kValueFieldNumber = 2,
+    kTtlMsFieldNumber = 3,
+  };
+  // bytes key = 1;
+  void clear_key();
+  const std::string& key() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_key(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_key();
+  PROTOBUF_NODISCARD std::string* release_key();
+  void set_allocated_key(std::string* key);
+  private:
+  const std::string& _internal_key() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_key(const std::string& value);
+  std::string* _internal_mutable_key();
+  public:
+
+  // bytes value = 2;
+  void clear_value();
+  const std::string& value() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_value(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_value();
+  PROTOBUF_NODISCARD std::string* release_value();
+  void set_allocated_value(std::string* value);
+  private:
+  const std::string& _internal_value() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_value(const std::string& value);
+  std::string* _internal_mutable_value();
+  public:
+
+  // uint64 ttl_ms = 3;
+  void clear_ttl_ms();
+  uint64_t ttl_ms() const;
+  void set_ttl_ms(uint64_t value);
+  private:
+  uint64_t _internal_ttl_ms() const;
+  void _internal_set_ttl_ms(uint64_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:chirp.PutRequest)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr key_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr value_;
+    uint64_t ttl_ms_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_key_5fvalue_2eproto;
+};
+// -------------------------------------------------------------------
+
+class PutReply final :
+    public ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase /* @@protoc_insertion_point(class_definition:chirp.PutReply) */ {
+ public:
+  inline PutReply() : PutReply(nullptr) {}
+  explicit PROTOBUF_CONSTEXPR PutReply(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  PutReply(const PutReply& from);
+  PutReply(PutReply&& from) noexcept
+    : PutReply() {
+    *this = ::std::move(from);
+  }
+
+  inline PutReply& operator=(const PutReply& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline PutReply& operator=(PutReply&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const PutReply& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const PutReply* internal_default_instance() {
+    return reinterpret_cast<const PutReply*>(
+               &_PutReply_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    1;
+
+  friend void swap(PutReply& a, PutReply& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(PutReply* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(PutReply* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  PutReply* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<PutReply>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::CopyFrom;
+  inline void CopyFrom(const PutReply& from) {
+    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::CopyImpl(*this, from);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::MergeFrom;
+  void MergeFrom(const PutReply& from) {
+    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::MergeImpl(*this, from);
+  }
+  public:
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "chirp.PutReply";
+  }
+  protected:
+  explicit PutReply(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  // @@protoc_insertion_point(class_scope:chirp.PutReply)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+  };
+  friend struct ::TableStruct_key_5fvalue_2eproto;
+};
+// -------------------------------------------------------------------
+
+class GetRequest final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:chirp.GetRequest) */ {
+ public:
+  inline GetRequest() : GetRequest(nullptr) {}
+  ~GetRequest() override;
+  explicit PROTOBUF_CONSTEXPR GetRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  GetRequest(const GetRequest& from);
+  GetRequest(GetRequest&& from) noexcept
+    : GetRequest() {
+    *this = ::std::move(from);
+  }
+
+  inline GetRequest& operator=(const GetRequest& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline GetRequest& operator=(GetRequest&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const GetRequest& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const GetRequest* internal_default_instance() {
+    return reinterpret_cast<const GetRequest*>(
+               &_GetRequest_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    2;
+
+  friend void swap(GetRequest& a, GetRequest& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(GetRequest* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(GetRequest* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  GetRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<GetRequest>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const GetRequest& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const GetRequest& from) {
+    GetRequest::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(GetRequest* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "chirp.GetRequest";
+  }
+  protected:
+  explicit GetRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kKeysFieldNumber = 2,
+    kKeyFieldNumber = 1,
+    kSnapshotFieldNumber = 3,
+  };
+  // repeated bytes keys = 2;
+  int keys_size() const;
+  private:
+  int _internal_keys_size() const;
+  public:
+  void clear_keys();
+  const std::string& keys(int index) const;
+  std::string* mutable_keys(int index);
+  void set_keys(int index, const std::string& value);
+  void set_keys(int index, std::string&& value);
+  void set_keys(int index, const char* value);
+  void set_keys(int index, const void* value, size_t size);
+  std::string* add_keys();
+  void add_keys(const std::string& value);
+  void add_keys(std::string&& value);
+  void add_keys(const char* value);
+  void add_keys(const void* value, size_t size);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>& keys() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>* mutable_keys();
+  private:
+  const std::string& _internal_keys(int index) const;
+  std::string* _internal_add_keys();
+  public:
+
+  // bytes key = 1;
+  void clear_key();
+  const std::string& key() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_key(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_key();
+  PROTOBUF_NODISCARD std::string* release_key();
+  void set_allocated_key(std::string* key);
+  private:
+  const std::string& _internal_key() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_key(const std::string& value);
+  std::string* _internal_mutable_key();
+  public:
+
+  // uint64 snapshot = 3;
+  void clear_snapshot();
+  uint64_t snapshot() const;
+  void set_snapshot(uint64_t value);
+  private:
+  uint64_t _internal_snapshot() const;
+  void _internal_set_snapshot(uint64_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:chirp.GetRequest)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string> keys_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr key_;
+    uint64_t snapshot_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_key_5fvalue_2eproto;
+};
+// -------------------------------------------------------------------
+
+class GetReply final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:chirp.GetReply) */ {
+ public:
+  inline GetReply() : GetReply(nullptr) {}
+  ~GetReply() override;
+  explicit PROTOBUF_CONSTEXPR GetReply(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  GetReply(const GetReply& from);
+  GetReply(GetReply&& from) noexcept
+    : GetReply() {
+    *this = ::std::move(from);
+  }
+
+  inline GetReply& operator=(const GetReply& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline GetReply& operator=(GetReply&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const GetReply& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const GetReply* internal_default_instance() {
+    return reinterpret_cast<const GetReply*>(
+               &_GetReply_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    3;
+
+  friend void swap(GetReply& a, GetReply& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(GetReply* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(GetReply* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  GetReply* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<GetReply>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const GetReply& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const GetReply& from) {
+    GetReply::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(GetReply* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "chirp.GetReply";
+  }
+  protected:
+  explicit GetReply(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kValueFieldNumber = 1,
+  };
+  // bytes value = 1;
+  void clear_value();
+  const std::string& value() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_value(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_value();
+  PROTOBUF_NODISCARD std::string* release_value();
+  void set_allocated_value(std::string* value);
+  private:
+  const std::string& _internal_value() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_value(const std::string& value);
+  std::string* _internal_mutable_value();
+  public:
+
+  // @@protoc_insertion_point(class_scope:chirp.GetReply)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr value_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_key_5fvalue_2eproto;
+};
+// -------------------------------------------------------------------
+
+class DeleteRequest final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:chirp.DeleteRequest) */ {
+ public:
+  inline DeleteRequest() : DeleteRequest(nullptr) {}
+  ~DeleteRequest() override;
+  explicit PROTOBUF_CONSTEXPR DeleteRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  DeleteRequest(const DeleteRequest& from);
+  DeleteRequest(DeleteRequest&& from) noexcept
+    : DeleteRequest() {
+    *this = ::std::move(from);
+  }
+
+  inline DeleteRequest& operator=(const DeleteRequest& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline DeleteRequest& operator=(DeleteRequest&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const DeleteRequest& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const DeleteRequest* internal_default_instance() {
+    return reinterpret_cast<const DeleteRequest*>(
+               &_DeleteRequest_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    4;
+
+  friend void swap(DeleteRequest& a, DeleteRequest& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(DeleteRequest* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(DeleteRequest* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  DeleteRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<DeleteRequest>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const DeleteRequest& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const DeleteRequest& from) {
+    DeleteRequest::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(DeleteRequest* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "chirp.DeleteRequest";
+  }
+  protected:
+  explicit DeleteRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kKeyFieldNumber = 1,
+  };
+  // bytes key = 1;
+  void clear_key();
+  const std::string& key() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_key(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_key();
+  PROTOBUF_NODISCARD std::string* release_key();
+  void set_allocated_key(std::string* key);
+  private:
+  const std::string& _internal_key() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_key(const std::string& value);
+  std::string* _internal_mutable_key();
+  public:
+
+  // @@protoc_insertion_point(class_scope:chirp.DeleteRequest)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr key_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_key_5fvalue_2eproto;
+};
+// -------------------------------------------------------------------
+
+class DeleteReply final :
+    public ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase /* @@protoc_insertion_point(class_definition:chirp.DeleteReply) */ {
+ public:
+  inline DeleteReply() : DeleteReply(nullptr) {}
+  explicit PROTOBUF_CONSTEXPR DeleteReply(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  DeleteReply(const DeleteReply& from);
+  DeleteReply(DeleteReply&& from) noexcept
+    : DeleteReply() {
+    *this = ::std::move(from);
+  }
+
+  inline DeleteReply& operator=(const DeleteReply& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline DeleteReply& operator=(DeleteReply&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const DeleteReply& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const DeleteReply* internal_default_instance() {
+    return reinterpret_cast<const DeleteReply*>(
+               &_DeleteReply_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    5;
+
+  friend void swap(DeleteReply& a, DeleteReply& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(DeleteReply* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(DeleteReply* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  DeleteReply* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<DeleteReply>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::CopyFrom;
+  inline void CopyFrom(const DeleteReply& from) {
+    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::CopyImpl(*this, from);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::MergeFrom;
+  void MergeFrom(const DeleteReply& from) {
+    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::MergeImpl(*this, from);
+  }
+  public:
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "chirp.DeleteReply";
+  }
+  protected:
+  explicit DeleteReply(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  // @@protoc_insertion_point(class_scope:chirp.DeleteReply)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+  };
+  friend struct ::TableStruct_key_5fvalue_2eproto;
+};
+// -------------------------------------------------------------------
+
+class MultiPutRequest final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:chirp.MultiPutRequest) */ {
+ public:
+  inline MultiPutRequest() : MultiPutRequest(nullptr) {}
+  ~MultiPutRequest() override;
+  explicit PROTOBUF_CONSTEXPR MultiPutRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  MultiPutRequest(const MultiPutRequest& from);
+  MultiPutRequest(MultiPutRequest&& from) noexcept
+    : MultiPutRequest() {
+    *this = ::std::move(from);
+  }
+
+  inline MultiPutRequest& operator=(const MultiPutRequest& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline MultiPutRequest& operator=(MultiPutRequest&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const MultiPutRequest& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const MultiPutRequest* internal_default_instance() {
+    return reinterpret_cast<const MultiPutRequest*>(
+               &_MultiPutRequest_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    6;
+
+  friend void swap(MultiPutRequest& a, MultiPutRequest& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(MultiPutRequest* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(MultiPutRequest* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  MultiPutRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<MultiPutRequest>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const MultiPutRequest& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const MultiPutRequest& from) {
+    MultiPutRequest::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(MultiPutRequest* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "chirp.MultiPutRequest";
+  }
+  protected:
+  explicit MultiPutRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kPairsFieldNumber = 1,
+  };
+  // repeated .chirp.PutRequest pairs = 1;
+  int pairs_size() const;
+  private:
+  int _internal_pairs_size() const;
+  public:
+  void clear_pairs();
+  ::chirp::PutRequest* mutable_pairs(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::chirp::PutRequest >*
+      mutable_pairs();
+  private:
+  const ::chirp::PutRequest& _internal_pairs(int index) const;
+  ::chirp::PutRequest* _internal_add_pairs();
+  public:
+  const ::chirp::PutRequest& pairs(int index) const;
+  ::chirp::PutRequest* add_pairs();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::chirp::PutRequest >&
+      pairs() const;
+
+  // @@protoc_insertion_point(class_scope:chirp.MultiPutRequest)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::chirp::PutRequest > pairs_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_key_5fvalue_2eproto;
+};
+// -------------------------------------------------------------------
+
+class MultiPutReply final :
+    public ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase /* @@protoc_insertion_point(class_definition:chirp.MultiPutReply) */ {
+ public:
+  inline MultiPutReply() : MultiPutReply(nullptr) {}
+  explicit PROTOBUF_CONSTEXPR MultiPutReply(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  MultiPutReply(const MultiPutReply& from);
+  MultiPutReply(MultiPutReply&& from) noexcept
+    : MultiPutReply() {
+    *this = ::std::move(from);
+  }
+
+  inline MultiPutReply& operator=(const MultiPutReply& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline MultiPutReply& operator=(MultiPutReply&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const MultiPutReply& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const MultiPutReply* internal_default_instance() {
+    return reinterpret_cast<const MultiPutReply*>(
+               &_MultiPutReply_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    7;
+
+  friend void swap(MultiPutReply& a, MultiPutReply& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(MultiPutReply* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(MultiPutReply* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  MultiPutReply* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<MultiPutReply>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::CopyFrom;
+  inline void CopyFrom(const MultiPutReply& from) {
+    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::CopyImpl(*this, from);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::MergeFrom;
+  void MergeFrom(const MultiPutReply& from) {
+    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::MergeImpl(*this, from);
+  }
+  public:
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "chirp.MultiPutReply";
+  }
+  protected:
+  explicit MultiPutReply(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  // @@protoc_insertion_point(class_scope:chirp.MultiPutReply)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+  };
+  friend struct ::TableStruct_key_5fvalue_2eproto;
+};
+// -------------------------------------------------------------------
+
+class MultiDeleteRequest final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:chirp.MultiDeleteRequest) */ {
+ public:
+  inline MultiDeleteRequest() : MultiDeleteRequest(nullptr) {}
+  ~MultiDeleteRequest() override;
+  explicit PROTOBUF_CONSTEXPR MultiDeleteRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  MultiDeleteRequest(const MultiDeleteRequest& from);
+  MultiDeleteRequest(MultiDeleteRequest&& from) noexcept
+    : MultiDeleteRequest() {
+    *this = ::std::move(from);
+  }
+
+  inline MultiDeleteRequest& operator=(const MultiDeleteRequest& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline MultiDeleteRequest& operator=(MultiDeleteRequest&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const MultiDeleteRequest& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const MultiDeleteRequest* internal_default_instance() {
+    return reinterpret_cast<const MultiDeleteRequest*>(
+               &_MultiDeleteRequest_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    8;
+
+  friend void swap(MultiDeleteRequest& a, MultiDeleteRequest& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(MultiDeleteRequest* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(MultiDeleteRequest* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  MultiDeleteRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<MultiDeleteRequest>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const MultiDeleteRequest& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const MultiDeleteRequest& from) {
+    MultiDeleteRequest::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(MultiDeleteRequest* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "chirp.MultiDeleteRequest";
+  }
+  protected:
+  explicit MultiDeleteRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kKeysFieldNumber = 1,
+  };
+  // repeated bytes keys = 1;
+  int keys_size() const;
+  private:
+  int _internal_keys_size() const;
+  public:
+  void clear_keys();
+  const std::string& keys(int index) const;
+  std::string* mutable_keys(int index);
+  void set_keys(int index, const std::string& value);
+  void set_keys(int index, std::string&& value);
+  void set_keys(int index, const char* value);
+  void set_keys(int index, const void* value, size_t size);
+  std::string* add_keys();
+  void add_keys(const std::string& value);
+  void add_keys(std::string&& value);
+  void add_keys(const char* value);
+  void add_keys(const void* value, size_t size);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>& keys() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>* mutable_keys();
+  private:
+  const std::string& _internal_keys(int index) const;
+  std::string* _internal_add_keys();
+  public:
+
+  // @@protoc_insertion_point(class_scope:chirp.MultiDeleteRequest)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string> keys_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_key_5fvalue_2eproto;
+};
+// -------------------------------------------------------------------
+
+class MultiDeleteReply final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:chirp.MultiDeleteReply) */ {
+ public:
+  inline MultiDeleteReply() : MultiDeleteReply(nullptr) {}
+  ~MultiDeleteReply() override;
+  explicit PROTOBUF_CONSTEXPR MultiDeleteReply(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  MultiDeleteReply(const MultiDeleteReply& from);
+  MultiDeleteReply(MultiDeleteReply&& from) noexcept
+    : MultiDeleteReply() {
+    *this = ::std::move(from);
+  }
+
+  inline MultiDeleteReply& operator=(const MultiDeleteReply& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline MultiDeleteReply& operator=(MultiDeleteReply&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const MultiDeleteReply& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const MultiDeleteReply* internal_default_instance() {
+    return reinterpret_cast<const MultiDeleteReply*>(
+               &_MultiDeleteReply_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    9;
+
+  friend void swap(MultiDeleteReply& a, MultiDeleteReply& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(MultiDeleteReply* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(MultiDeleteReply* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  MultiDeleteReply* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<MultiDeleteReply>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const MultiDeleteReply& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const MultiDeleteReply& from) {
+    MultiDeleteReply::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(MultiDeleteReply* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "chirp.MultiDeleteReply";
+  }
+  protected:
+  explicit MultiDeleteReply(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kNumOfDeletedFieldNumber = 1,
+  };
+  // uint64 num_of_deleted = 1;
+  void clear_num_of_deleted();
+  uint64_t num_of_deleted() const;
+  void set_num_of_deleted(uint64_t value);
+  private:
+  uint64_t _internal_num_of_deleted() const;
+  void _internal_set_num_of_deleted(uint64_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:chirp.MultiDeleteReply)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    uint64_t num_of_deleted_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_key_5fvalue_2eproto;
+};
+// -------------------------------------------------------------------
+
+class FetchAddRequest final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:chirp.FetchAddRequest) */ {
+ public:
+  inline FetchAddRequest() : FetchAddRequest(nullptr) {}
+  ~FetchAddRequest() override;
+  explicit PROTOBUF_CONSTEXPR FetchAddRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  FetchAddRequest(const FetchAddRequest& from);
+  FetchAddRequest(FetchAddRequest&& from) noexcept
+    : FetchAddRequest() {
+    *this = ::std::move(from);
+  }
+
+  inline FetchAddRequest& operator=(const FetchAddRequest& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline FetchAddRequest& operator=(FetchAddRequest&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const FetchAddRequest& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const FetchAddRequest* internal_default_instance() {
+    return reinterpret_cast<const FetchAddRequest*>(
+               &_FetchAddRequest_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    10;
+
+  friend void swap(FetchAddRequest& a, FetchAddRequest& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(FetchAddRequest* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(FetchAddRequest* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  FetchAddRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<FetchAddRequest>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const FetchAddRequest& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const FetchAddRequest& from) {
+    FetchAddRequest::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(FetchAddRequest* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "chirp.FetchAddRequest";
+  }
+  protected:
+  explicit FetchAddRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kKeyFieldNumber = 1,
+    kDeltaFieldNumber = 2,
+  };
+  // bytes key = 1;
+  void clear_key();
+  const std::string& key() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_key(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_key();
+  PROTOBUF_NODISCARD std::string* release_key();
+  void set_allocated_key(std::string* key);
+  private:
+  const std::string& _internal_key() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_key(const std::string& value);
+  std::string* _internal_mutable_key();
+  public:
+
+  // uint64 delta = 2;
+  void clear_delta();
+  uint64_t delta() const;
+  void set_delta(uint64_t value);
+  private:
+  uint64_t _internal_delta() const;
+  void _internal_set_delta(uint64_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:chirp.FetchAddRequest)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr key_;
+    uint64_t delta_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_key_5fvalue_2eproto;
+};
+// -------------------------------------------------------------------
+
+class FetchAddReply final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:chirp.FetchAddReply) */ {
+ public:
+  inline FetchAddReply() : FetchAddReply(nullptr) {}
+  ~FetchAddReply() override;
+  explicit PROTOBUF_CONSTEXPR FetchAddReply(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  FetchAddReply(const FetchAddReply& from);
+  FetchAddReply(FetchAddReply&& from) noexcept
+    : FetchAddReply() {
+    *this = ::std::move(from);
+  }
+
+  inline FetchAddReply& operator=(const FetchAddReply& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline FetchAddReply& operator=(FetchAddReply&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const FetchAddReply& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const FetchAddReply* internal_default_instance() {
+    return reinterpret_cast<const FetchAddReply*>(
+               &_FetchAddReply_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    11;
+
+  friend void swap(FetchAddReply& a, FetchAddReply& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(FetchAddReply* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(FetchAddReply* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  FetchAddReply* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<FetchAddReply>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const FetchAddReply& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const FetchAddReply& from) {
+    FetchAddReply::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(FetchAddReply* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "chirp.FetchAddReply";
+  }
+  protected:
+  explicit FetchAddReply(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kPreviousFieldNumber = 1,
+  };
+  // uint64 previous = 1;
+  void clear_previous();
+  uint64_t previous() const;
+  void set_previous(uint64_t value);
+  private:
+  uint64_t _internal_previous() const;
+  void _internal_set_previous(uint64_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:chirp.FetchAddReply)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    uint64_t previous_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_key_5fvalue_2eproto;
+};
+// -------------------------------------------------------------------
+
+class CompareAndSwapRequest final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:chirp.CompareAndSwapRequest) */ {
+ public:
+  inline CompareAndSwapRequest() : CompareAndSwapRequest(nullptr) {}
+  ~CompareAndSwapRequest() override;
+  explicit PROTOBUF_CONSTEXPR CompareAndSwapRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  CompareAndSwapRequest(const CompareAndSwapRequest& from);
+  CompareAndSwapRequest(CompareAndSwapRequest&& from) noexcept
+    : CompareAndSwapRequest() {
+    *this = ::std::move(from);
+  }
+
+  inline CompareAndSwapRequest& operator=(const CompareAndSwapRequest& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline CompareAndSwapRequest& operator=(CompareAndSwapRequest&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const CompareAndSwapRequest& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const CompareAndSwapRequest* internal_default_instance() {
+    return reinterpret_cast<const CompareAndSwapRequest*>(
+               &_CompareAndSwapRequest_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    12;
+
+  friend void swap(CompareAndSwapRequest& a, CompareAndSwapRequest& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(CompareAndSwapRequest* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(CompareAndSwapRequest* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  CompareAndSwapRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<CompareAndSwapRequest>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const CompareAndSwapRequest& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const CompareAndSwapRequest& from) {
+    CompareAndSwapRequest::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(CompareAndSwapRequest* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "chirp.CompareAndSwapRequest";
+  }
+  protected:
+  explicit CompareAndSwapRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kKeyFieldNumber = 1,
+    kExpectedFieldNumber = 2,
+    kDesiredFieldNumber = 3,
+  };
+  // bytes key = 1;
+  void clear_key();
+  const std::string& key() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_key(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_key();
+  PROTOBUF_NODISCARD std::string* release_key();
+  void set_allocated_key(std::string* key);
+  private:
+  const std::string& _internal_key() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_key(const std::string& value);
+  std::string* _internal_mutable_key();
+  public:
+
+  // bytes expected = 2;
+  void clear_expected();
+  const std::string& expected() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_expected(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_expected();
+  PROTOBUF_NODISCARD std::string* release_expected();
+  void set_allocated_expected(std::string* expected);
+  private:
+  const std::string& _internal_expected() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_expected(const std::string& value);
+  std::string* _internal_mutable_expected();
+  public:
+
+  // bytes desired = 3;
+  void clear_desired();
+  const std::string& desired() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_desired(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_desired();
+  PROTOBUF_NODISCARD std::string* release_desired();
+  void set_allocated_desired(std::string* desired);
+  private:
+  const std::string& _internal_desired() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_desired(const std::string& value);
+  std::string* _internal_mutable_desired();
+  public:
+
+  // @@protoc_insertion_point(class_scope:chirp.CompareAndSwapRequest)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr key_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr expected_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr desired_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_key_5fvalue_2eproto;
+};
+// -------------------------------------------------------------------
+
+class CompareAndSwapReply final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:chirp.CompareAndSwapReply) */ {
+ public:
+  inline CompareAndSwapReply() : CompareAndSwapReply(nullptr) {}
+  ~CompareAndSwapReply() override;
+  explicit PROTOBUF_CONSTEXPR CompareAndSwapReply(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  CompareAndSwapReply(const CompareAndSwapReply& from);
+  CompareAndSwapReply(CompareAndSwapReply&& from) noexcept
+    : CompareAndSwapReply() {
+    *this = ::std::move(from);
+  }
+
+  inline CompareAndSwapReply& operator=(const CompareAndSwapReply& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline CompareAndSwapReply& operator=(CompareAndSwapReply&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const CompareAndSwapReply& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const CompareAndSwapReply* internal_default_instance() {
+    return reinterpret_cast<const CompareAndSwapReply*>(
+               &_CompareAndSwapReply_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    13;
+
+  friend void swap(CompareAndSwapReply& a, CompareAndSwapReply& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(CompareAndSwapReply* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(CompareAndSwapReply* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  CompareAndSwapReply* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<CompareAndSwapReply>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const CompareAndSwapReply& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const CompareAndSwapReply& from) {
+    CompareAndSwapReply::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(CompareAndSwapReply* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "chirp.CompareAndSwapReply";
+  }
+  protected:
+  explicit CompareAndSwapReply(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kActualFieldNumber = 2,
+    kSwappedFieldNumber = 1,
+  };
+  // bytes actual = 2;
+  void clear_actual();
+  const std::string& actual() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_actual(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_actual();
+  PROTOBUF_NODISCARD std::string* release_actual();
+  void set_allocated_actual(std::string* actual);
+  private:
+  const std::string& _internal_actual() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_actual(const std::string& value);
+  std::string* _internal_mutable_actual();
+  public:
+
+  // bool swapped = 1;
+  void clear_swapped();
+  bool swapped() const;
+  void set_swapped(bool value);
+  private:
+  bool _internal_swapped() const;
+  void _internal_set_swapped(bool value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:chirp.CompareAndSwapReply)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr actual_;
+    bool swapped_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_key_5fvalue_2eproto;
+};
+// -------------------------------------------------------------------
+
+class ScanRequest final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:chirp.ScanRequest) */ {
+ public:
+  inline ScanRequest() : ScanRequest(nullptr) {}
+  ~ScanRequest() override;
+  explicit PROTOBUF_CONSTEXPR ScanRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  ScanRequest(const ScanRequest& from);
+  ScanRequest(ScanRequest&& from) noexcept
+    : ScanRequest() {
+    *this = ::std::move(from);
+  }
+
+  inline ScanRequest& operator=(const ScanRequest& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline ScanRequest& operator=(ScanRequest&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ScanRequest& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const ScanRequest* internal_default_instance() {
+    return reinterpret_cast<const ScanRequest*>(
+               &_ScanRequest_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    14;
+
+  friend void swap(ScanRequest& a, ScanRequest& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(ScanRequest* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ScanRequest* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  ScanRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ScanRequest>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const ScanRequest& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const ScanRequest& from) {
+    ScanRequest::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(ScanRequest* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "chirp.ScanRequest";
+  }
+  protected:
+  explicit ScanRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kStartFieldNumber = 1,
+    kEndFieldNumber = 2,
+    kLimitFieldNumber = 3,
+  };
+  // bytes start = 1;
+  void clear_start();
+  const std::string& start() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_start(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_start();
+  PROTOBUF_NODISCARD std::string* release_start();
+  void set_allocated_start(std::string* start);
+  private:
+  const std::string& _internal_start() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_start(const std::string& value);
+  std::string* _internal_mutable_start();
+  public:
+
+  // bytes end = 2;
+  void clear_end();
+  const std::string& end() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_end(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_end();
+  PROTOBUF_NODISCARD std::string* release_end();
+  void set_allocated_end(std::string* end);
+  private:
+  const std::string& _internal_end() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_end(const std::string& value);
+  std::string* _internal_mutable_end();
+  public:
+
+  // uint64 limit = 3;
+  void clear_limit();
+  uint64_t limit() const;
+  void set_limit(uint64_t value);
+  private:
+  uint64_t _internal_limit() const;
+  void _internal_set_limit(uint64_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:chirp.ScanRequest)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr start_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr end_;
+    uint64_t limit_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_key_5fvalue_2eproto;
+};
+// -------------------------------------------------------------------
+
+class ScanReply final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:chirp.ScanReply) */ {
+ public:
+  inline ScanReply() : ScanReply(nullptr) {}
+  ~ScanReply() override;
+  explicit PROTOBUF_CONSTEXPR ScanReply(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  ScanReply(const ScanReply& from);
+  ScanReply(ScanReply&& from) noexcept
+    : ScanReply() {
+    *this = ::std::move(from);
+  }
+
+  inline ScanReply& operator=(const ScanReply& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline ScanReply& operator=(ScanReply&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ScanReply& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const ScanReply* internal_default_instance() {
+    return reinterpret_cast<const ScanReply*>(
+               &_ScanReply_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    15;
+
+  friend void swap(ScanReply& a, ScanReply& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(ScanReply* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ScanReply* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  ScanReply* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ScanReply>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const ScanReply& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const ScanReply& from) {
+    ScanReply::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(ScanReply* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "chirp.ScanReply";
+  }
+  protected:
+  explicit ScanReply(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kPairsFieldNumber = 1,
+  };
+  // repeated .chirp.PutRequest pairs = 1;
+  int pairs_size() const;
+  private:
+  int _internal_pairs_size() const;
+  public:
+  void clear_pairs();
+  ::chirp::PutRequest* mutable_pairs(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::chirp::PutRequest >*
+      mutable_pairs();
+  private:
+  const ::chirp::PutRequest& _internal_pairs(int index) const;
+  ::chirp::PutRequest* _internal_add_pairs();
+  public:
+  const ::chirp::PutRequest& pairs(int index) const;
+  ::chirp::PutRequest* add_pairs();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::chirp::PutRequest >&
+      pairs() const;
+
+  // @@protoc_insertion_point(class_scope:chirp.ScanReply)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::chirp::PutRequest > pairs_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_key_5fvalue_2eproto;
+};
+// -------------------------------------------------------------------
+
+class ListElementRequest final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:chirp.ListElementRequest) */ {
+ public:
+  inline ListElementRequest() : ListElementRequest(nullptr) {}
+  ~ListElementRequest() override;
+  explicit PROTOBUF_CONSTEXPR ListElementRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  ListElementRequest(const ListElementRequest& from);
+  ListElementRequest(ListElementRequest&& from) noexcept
+    : ListElementRequest() {
+    *this = ::std::move(from);
+  }
+
+  inline ListElementRequest& operator=(const ListElementRequest& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline ListElementRequest& operator=(ListElementRequest&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ListElementRequest& default_instance() {
+    return *internal_default_instance();
+  }
+  enum ElementCase {
+    kUint64Element = 3,
+    kStringElement = 4,
+    ELEMENT_NOT_SET = 0,
+  };
+
+  static inline const ListElementRequest* internal_default_instance() {
+    return reinterpret_cast<const ListElementRequest*>(
+               &_ListElementRequest_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    16;
+
+  friend void swap(ListElementRequest& a, ListElementRequest& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(ListElementRequest* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ListElementRequest* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  ListElementRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ListElementRequest>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const ListElementRequest& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const ListElementRequest& from) {
+    ListElementRequest::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(ListElementRequest* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "chirp.ListElementRequest";
+  }
+  protected:
+  explicit ListElementRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kKeyFieldNumber = 1,
+    kFieldFieldNumber = 2,
+    kIfAbsentFieldNumber = 5,
+    kIfExistsFieldNumber = 6,
+    kUint64ElementFieldNumber = 3,
+    kStringElementFieldNumber = 4,
+  };
+  // bytes key = 1;
+  void clear_key();
+  const std::string& key() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_key(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_key();
+  PROTOBUF_NODISCARD std::string* release_key();
+  void set_allocated_key(std::string* key);
+  private:
+  const std::string& _internal_key() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_key(const std::string& value);
+  std::string* _internal_mutable_key();
+  public:
+
+  // uint32 field = 2;
+  void clear_field();
+  uint32_t field() const;
+  void set_field(uint32_t value);
+  private:
+  uint32_t _internal_field() const;
+  void _internal_set_field(uint32_t value);
+  public:
+
+  // bool if_absent = 5;
+  void clear_if_absent();
+  bool if_absent() const;
+  void set_if_absent(bool value);
+  private:
+  bool _internal_if_absent() const;
+  void _internal_set_if_absent(bool value);
+  public:
+
+  // bool if_exists = 6;
+  void clear_if_exists();
+  bool if_exists() const;
+  void set_if_exists(bool value);
+  private:
+  bool _internal_if_exists() const;
+  void _internal_set_if_exists(bool value);
+  public:
+
+  // uint64 uint64_element = 3;
+  bool has_uint64_element() const;
+  private:
+  bool _internal_has_uint64_element() const;
+  public:
+  void clear_uint64_element();
+  uint64_t uint64_element() const;
+  void set_uint64_element(uint64_t value);
+  private:
+  uint64_t _internal_uint64_element() const;
+  void _internal_set_uint64_element(uint64_t value);
+  public:
+
+  // bytes string_element = 4;
+  bool has_string_element() const;
+  private:
+  bool _internal_has_string_element() const;
+  public:
+  void clear_string_element();
+  const std::string& string_element() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_string_element(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_string_element();
+  PROTOBUF_NODISCARD std::string* release_string_element();
+  void set_allocated_string_element(std::string* string_element);
+  private:
+  const std::string& _internal_string_element() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_string_element(const std::string& value);
+  std::string* _internal_mutable_string_element();
+  public:
+
+  void clear_element();
+  ElementCase element_case() const;
+  // @@protoc_insertion_point(class_scope:chirp.ListElementRequest)
+ private:
+  class _Internal;
+  void set_has_uint64_element();
+  void set_has_string_element();
+
+  inline bool has_element() const;
+  inline void clear_has_element();
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr key_;
+    uint32_t field_;
+    bool if_absent_;
+    bool if_exists_;
+    union ElementUnion {
+      constexpr ElementUnion() : _constinit_{} {}
+        ::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized _constinit_;
+      uint64_t uint64_element_;
+      ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr string_element_;
+    } element_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    uint32_t _oneof_case_[1];
+
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_key_5fvalue_2eproto;
+};
+// -------------------------------------------------------------------
+
+class ListElementReply final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:chirp.ListElementReply) */ {
+ public:
+  inline ListElementReply() : ListElementReply(nullptr) {}
+  ~ListElementReply() override;
+  explicit PROTOBUF_CONSTEXPR ListElementReply(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  ListElementReply(const ListElementReply& from);
+  ListElementReply(ListElementReply&& from) noexcept
+    : ListElementReply() {
+    *this = ::std::move(from);
+  }
+
+  inline ListElementReply& operator=(const ListElementReply& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline ListElementReply& operator=(ListElementReply&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ListElementReply& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const ListElementReply* internal_default_instance() {
+    return reinterpret_cast<const ListElementReply*>(
+               &_ListElementReply_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    17;
+
+  friend void swap(ListElementReply& a, ListElementReply& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(ListElementReply* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ListElementReply* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  ListElementReply* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ListElementReply>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const ListElementReply& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const ListElementReply& from) {
+    ListElementReply::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(ListElementReply* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "chirp.ListElementReply";
+  }
+  protected:
+  explicit ListElementReply(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kChangedFieldNumber = 1,
+  };
+  // bool changed = 1;
+  void clear_changed();
+  bool changed() const;
+  void set_changed(bool value);
+  private:
+  bool _internal_changed() const;
+  void _internal_set_changed(bool value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:chirp.ListElementReply)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    bool changed_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_key_5fvalue_2eproto;
+};
+// -------------------------------------------------------------------
+
+class MemoryUsageRequest final :
+    public ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase /* @@protoc_insertion_point(class_definition:chirp.MemoryUsageRequest) */ {
+ public:
+  inline MemoryUsageRequest() : MemoryUsageRequest(nullptr) {}
+  explicit PROTOBUF_CONSTEXPR MemoryUsageRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  MemoryUsageRequest(const MemoryUsageRequest& from);
+  MemoryUsageRequest(MemoryUsageRequest&& from) noexcept
+    : MemoryUsageRequest() {
+    *this = ::std::move(from);
+  }
+
+  inline MemoryUsageRequest& operator=(const MemoryUsageRequest& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline MemoryUsageRequest& operator=(MemoryUsageRequest&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const MemoryUsageRequest& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const MemoryUsageRequest* internal_default_instance() {
+    return reinterpret_cast<const MemoryUsageRequest*>(
+               &_MemoryUsageRequest_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    18;
+
+  friend void swap(MemoryUsageRequest& a, MemoryUsageRequest& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(MemoryUsageRequest* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(MemoryUsageRequest* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  MemoryUsageRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<MemoryUsageRequest>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::CopyFrom;
+  inline void CopyFrom(const MemoryUsageRequest& from) {
+    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::CopyImpl(*this, from);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::MergeFrom;
+  void MergeFrom(const MemoryUsageRequest& from) {
+    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::MergeImpl(*this, from);
+  }
+  public:
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "chirp.MemoryUsageRequest";
+  }
+  protected:
+  explicit MemoryUsageRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  // @@protoc_insertion_point(class_scope:chirp.MemoryUsageRequest)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+  };
+  friend struct ::TableStruct_key_5fvalue_2eproto;
+};
+// -------------------------------------------------------------------
+
+class PrefixUsage final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:chirp.PrefixUsage) */ {
+ public:
+  inline PrefixUsage() : PrefixUsage(nullptr) {}
+  ~PrefixUsage() override;
+  explicit PROTOBUF_CONSTEXPR PrefixUsage(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  PrefixUsage(const PrefixUsage& from);
+  PrefixUsage(PrefixUsage&& from) noexcept
+    : PrefixUsage() {
+    *this = ::std::move(from);
+  }
+
+  inline PrefixUsage& operator=(const PrefixUsage& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline PrefixUsage& operator=(PrefixUsage&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const PrefixUsage& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const PrefixUsage* internal_default_instance() {
+    return reinterpret_cast<const PrefixUsage*>(
+               &_PrefixUsage_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    19;
+
+  friend void swap(PrefixUsage& a, PrefixUsage& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(PrefixUsage* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(PrefixUsage* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  PrefixUsage* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<PrefixUsage>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const PrefixUsage& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const PrefixUsage& from) {
+    PrefixUsage::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(PrefixUsage* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "chirp.PrefixUsage";
+  }
+  protected:
+  explicit PrefixUsage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kPrefixFieldNumber = 1,
+    kNumOfKeysFieldNumber = 2,
+    kBytesFieldNumber = 3,
+  };
+  // bytes prefix = 1;
+  void clear_prefix();
+  const std::string& prefix() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_prefix(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_prefix();
+  PROTOBUF_NODISCARD std::string* release_prefix();
+  void set_allocated_prefix(std::string* prefix);
+  private:
+  const std::string& _internal_prefix() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_prefix(const std::string& value);
+  std::string* _internal_mutable_prefix();
+  public:
+
+  // uint64 num_of_keys = 2;
+  void clear_num_of_keys();
+  uint64_t num_of_keys() const;
+  void set_num_of_keys(uint64_t value);
+  private:
+  uint64_t _internal_num_of_keys() const;
+  void _internal_set_num_of_keys(uint64_t value);
+  public:
+
+  // uint64 bytes = 3;
+  void clear_bytes();
+  uint64_t bytes() const;
+  void set_bytes(uint64_t value);
+  private:
+  uint64_t _internal_bytes() const;
+  void _internal_set_bytes(uint64_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:chirp.PrefixUsage)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr prefix_;
+    uint64_t num_of_keys_;
+    uint64_t bytes_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_key_5fvalue_2eproto;
+};
+// -------------------------------------------------------------------
+
+class MemoryUsageReply final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:chirp.MemoryUsageReply) */ {
+ public:
+  inline MemoryUsageReply() : MemoryUsageReply(nullptr) {}
+  ~MemoryUsageReply() override;
+  explicit PROTOBUF_CONSTEXPR MemoryUsageReply(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  MemoryUsageReply(const MemoryUsageReply& from);
+  MemoryUsageReply(MemoryUsageReply&& from) noexcept
+    : MemoryUsageReply() {
+    *this = ::std::move(from);
+  }
+
+  inline MemoryUsageReply& operator=(const MemoryUsageReply& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline MemoryUsageReply& operator=(MemoryUsageReply&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const MemoryUsageReply& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const MemoryUsageReply* internal_default_instance() {
+    return reinterpret_cast<const MemoryUsageReply*>(
+               &_MemoryUsageReply_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    20;
+
+  friend void swap(MemoryUsageReply& a, MemoryUsageReply& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(MemoryUsageReply* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(MemoryUsageReply* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  MemoryUsageReply* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<MemoryUsageReply>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const MemoryUsageReply& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const MemoryUsageReply& from) {
+    MemoryUsageReply::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(MemoryUsageReply* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "chirp.MemoryUsageReply";
+  }
+  protected:
+  explicit MemoryUsageReply(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kPrefixesFieldNumber = 3,
+    kStorageFieldNumber = 4,
+    kBytesUsedFieldNumber = 1,
+    kMemoryLimitFieldNumber = 2,
+  };
+  // repeated .chirp.PrefixUsage prefixes = 3;
+  int prefixes_size() const;
+  private:
+  int _internal_prefixes_size() const;
+  public:
+  void clear_prefixes();
+  ::chirp::PrefixUsage* mutable_prefixes(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::chirp::PrefixUsage >*
+      mutable_prefixes();
+  private:
+  const ::chirp::PrefixUsage& _internal_prefixes(int index) const;
+  ::chirp::PrefixUsage* _internal_add_prefixes();
+  public:
+  const ::chirp::PrefixUsage& prefixes(int index) const;
+  ::chirp::PrefixUsage* add_prefixes();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::chirp::PrefixUsage >&
+      prefixes() const;
+
+  // string storage = 4;
+  void clear_storage();
+  const std::string& storage() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_storage(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_storage();
+  PROTOBUF_NODISCARD std::string* release_storage();
+  void set_allocated_storage(std::string* storage);
+  private:
+  const std::string& _internal_storage() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_storage(const std::string& value);
+  std::string* _internal_mutable_storage();
+  public:
+
+  // uint64 bytes_used = 1;
+  void clear_bytes_used();
+  uint64_t bytes_used() const;
+  void set_bytes_used(uint64_t value);
+  private:
+  uint64_t _internal_bytes_used() const;
+  void _internal_set_bytes_used(uint64_t value);
+  public:
+
+  // uint64 memory_limit = 2;
+  void clear_memory_limit();
+  uint64_t memory_limit() const;
+  void set_memory_limit(uint64_t value);
+  private:
+  uint64_t _internal_memory_limit() const;
+  void _internal_set_memory_limit(uint64_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:chirp.MemoryUsageReply)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::chirp::PrefixUsage > prefixes_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr storage_;
+    uint64_t bytes_used_;
+    uint64_t memory_limit_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_key_5fvalue_2eproto;
+};
+// -------------------------------------------------------------------
+
+class StatsRequest final :
+    public ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase /* @@protoc_insertion_point(class_definition:chirp.StatsRequest) */ {
+ public:
+  inline StatsRequest() : StatsRequest(nullptr) {}
+  explicit PROTOBUF_CONSTEXPR StatsRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  StatsRequest(const StatsRequest& from);
+  StatsRequest(StatsRequest&& from) noexcept
+    : StatsRequest() {
+    *this = ::std::move(from);
+  }
+
+  inline StatsRequest& operator=(const StatsRequest& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline StatsRequest& operator=(StatsRequest&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const StatsRequest& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const StatsRequest* internal_default_instance() {
+    return reinterpret_cast<const StatsRequest*>(
+               &_StatsRequest_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    21;
+
+  friend void swap(StatsRequest& a, StatsRequest& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(StatsRequest* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(StatsRequest* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  StatsRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<StatsRequest>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::CopyFrom;
+  inline void CopyFrom(const StatsRequest& from) {
+    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::CopyImpl(*this, from);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::MergeFrom;
+  void MergeFrom(const StatsRequest& from) {
+    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::MergeImpl(*this, from);
+  }
+  public:
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "chirp.StatsRequest";
+  }
+  protected:
+  explicit StatsRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  // @@protoc_insertion_point(class_scope:chirp.StatsRequest)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+  };
+  friend struct ::TableStruct_key_5fvalue_2eproto;
+};
+// -------------------------------------------------------------------
+
+class OperationStats final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:chirp.OperationStats) */ {
+ public:
+  inline OperationStats() : OperationStats(nullptr) {}
+  ~OperationStats() override;
+  explicit PROTOBUF_CONSTEXPR OperationStats(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  OperationStats(const OperationStats& from);
+  OperationStats(OperationStats&& from) noexcept
+    : OperationStats() {
+    *this = ::std::move(from);
+  }
+
+  inline OperationStats& operator=(const OperationStats& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline OperationStats& operator=(OperationStats&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const OperationStats& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const OperationStats* internal_default_instance() {
+    return reinterpret_cast<const OperationStats*>(
+               &_OperationStats_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    22;
+
+  friend void swap(OperationStats& a, OperationStats& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(OperationStats* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(OperationStats* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  OperationStats* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<OperationStats>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const OperationStats& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const OperationStats& from) {
+    OperationStats::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(OperationStats* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "chirp.OperationStats";
+  }
+  protected:
+  explicit OperationStats(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kOperationFieldNumber = 1,
+    kCountFieldNumber = 2,
+    kMeanNsFieldNumber = 3,
+    kP50NsFieldNumber = 4,
+    kP90NsFieldNumber = 5,
+    kP99NsFieldNumber = 6,
+    kP999NsFieldNumber = 7,
+    kMaxNsFieldNumber = 8,
+  };
+  // string operation = 1;
+  void clear_operation();
+  const std::string& operation() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_operation(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_operation();
+  PROTOBUF_NODISCARD std::string* release_operation();
+  void set_allocated_operation(std::string* operation);
+  private:
+  const std::string& _internal_operation() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_operation(const std::string& value);
+  std::string* _internal_mutable_operation();
+  public:
+
+  // uint64 count = 2;
+  void clear_count();
+  uint64_t count() const;
+  void set_count(uint64_t value);
+  private:
+  uint64_t _internal_count() const;
+  void _internal_set_count(uint64_t value);
+  public:
+
+  // uint64 mean_ns = 3;
+  void clear_mean_ns();
+  uint64_t mean_ns() const;
+  void set_mean_ns(uint64_t value);
+  private:
+  uint64_t _internal_mean_ns() const;
+  void _internal_set_mean_ns(uint64_t value);
+  public:
+
+  // uint64 p50_ns = 4;
+  void clear_p50_ns();
+  uint64_t p50_ns() const;
+  void set_p50_ns(uint64_t value);
+  private:
+  uint64_t _internal_p50_ns() const;
+  void _internal_set_p50_ns(uint64_t value);
+  public:
+
+  // uint64 p90_ns = 5;
+  void clear_p90_ns();
+  uint64_t p90_ns() const;
+  void set_p90_ns(uint64_t value);
+  private:
+  uint64_t _internal_p90_ns() const;
+  void _internal_set_p90_ns(uint64_t value);
+  public:
+
+  // uint64 p99_ns = 6;
+  void clear_p99_ns();
+  uint64_t p99_ns() const;
+  void set_p99_ns(uint64_t value);
+  private:
+  uint64_t _internal_p99_ns() const;
+  void _internal_set_p99_ns(uint64_t value);
+  public:
+
+  // uint64 p999_ns = 7;
+  void clear_p999_ns();
+  uint64_t p999_ns() const;
+  void set_p999_ns(uint64_t value);
+  private:
+  uint64_t _internal_p999_ns() const;
+  void _internal_set_p999_ns(uint64_t value);
+  public:
+
+  // uint64 max_ns = 8;
+  void clear_max_ns();
+  uint64_t max_ns() const;
+  void set_max_ns(uint64_t value);
+  private:
+  uint64_t _internal_max_ns() const;
+  void _internal_set_max_ns(uint64_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:chirp.OperationStats)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr operation_;
+    uint64_t count_;
+    uint64_t mean_ns_;
+    uint64_t p50_ns_;
+    uint64_t p90_ns_;
+    uint64_t p99_ns_;
+    uint64_t p999_ns_;
+    uint64_t max_ns_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_key_5fvalue_2eproto;
+};
+// -------------------------------------------------------------------
+
+class StatsReply final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:chirp.StatsReply) */ {
+ public:
+  inline StatsReply() : StatsReply(nullptr) {}
+  ~StatsReply() override;
+  explicit PROTOBUF_CONSTEXPR StatsReply(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  StatsReply(const StatsReply& from);
+  StatsReply(StatsReply&& from) noexcept
+    : StatsReply() {
+    *this = ::std::move(from);
+  }
+
+  inline StatsReply& operator=(const StatsReply& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline StatsReply& operator=(StatsReply&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const StatsReply& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const StatsReply* internal_default_instance() {
+    return reinterpret_cast<const StatsReply*>(
+               &_StatsReply_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    23;
+
+  friend void swap(StatsReply& a, StatsReply& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(StatsReply* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(StatsReply* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  StatsReply* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<StatsReply>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const StatsReply& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const StatsReply& from) {
+    StatsReply::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(StatsReply* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "chirp.StatsReply";
+  }
+  protected:
+  explicit StatsReply(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kOperationsFieldNumber = 1,
+    kPrefixesFieldNumber = 5,
+    kLockContentionsFieldNumber = 2,
+    kLockWaitNsFieldNumber = 3,
+    kBytesUsedFieldNumber = 4,
+    kNumOfBackupsFieldNumber = 6,
+    kNumOfBackupsInSyncFieldNumber = 7,
+    kNumOfSyncTimeoutsFieldNumber = 8,
+  };
+  // repeated .chirp.OperationStats operations = 1;
+  int operations_size() const;
+  private:
+  int _internal_operations_size() const;
+  public:
+  void clear_operations();
+  ::chirp::OperationStats* mutable_operations(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::chirp::OperationStats >*
+      mutable_operations();
+  private:
+  const ::chirp::OperationStats& _internal_operations(int index) const;
+  ::chirp::OperationStats* _internal_add_operations();
+  public:
+  const ::chirp::OperationStats& operations(int index) const;
+  ::chirp::OperationStats* add_operations();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::chirp::OperationStats >&
+      operations() const;
+
+  // repeated .chirp.PrefixUsage prefixes = 5;
+  int prefixes_size() const;
+  private:
+  int _internal_prefixes_size() const;
+  public:
+  void clear_prefixes();
+  ::chirp::PrefixUsage* mutable_prefixes(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::chirp::PrefixUsage >*
+      mutable_prefixes();
+  private:
+  const ::chirp::PrefixUsage& _internal_prefixes(int index) const;
+  ::chirp::PrefixUsage* _internal_add_prefixes();
+  public:
+  const ::chirp::PrefixUsage& prefixes(int index) const;
+  ::chirp::PrefixUsage* add_prefixes();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::chirp::PrefixUsage >&
+      prefixes() const;
+
+  // uint64 lock_contentions = 2;
+  void clear_lock_contentions();
+  uint64_t lock_contentions() const;
+  void set_lock_contentions(uint64_t value);
+  private:
+  uint64_t _internal_lock_contentions() const;
+  void _internal_set_lock_contentions(uint64_t value);
+  public:
+
+  // uint64 lock_wait_ns = 3;
+  void clear_lock_wait_ns();
+  uint64_t lock_wait_ns() const;
+  void set_lock_wait_ns(uint64_t value);
+  private:
+  uint64_t _internal_lock_wait_ns() const;
+  void _internal_set_lock_wait_ns(uint64_t value);
+  public:
+
+  // uint64 bytes_used = 4;
+  void clear_bytes_used();
+  uint64_t bytes_used() const;
+  void set_bytes_used(uint64_t value);
+  private:
+  uint64_t _internal_bytes_used() const;
+  void _internal_set_bytes_used(uint64_t value);
+  public:
+
+  // uint64 num_of_backups = 6;
+  void clear_num_of_backups();
+  uint64_t num_of_backups() const;
+  void set_num_of_backups(uint64_t value);
+  private:
+  uint64_t _internal_num_of_backups() const;
+  void _internal_set_num_of_backups(uint64_t value);
+  public:
+
+  // uint64 num_of_backups_in_sync = 7;
+  void clear_num_of_backups_in_sync();
+  uint64_t num_of_backups_in_sync() const;
+  void set_num_of_backups_in_sync(uint64_t value);
+  private:
+  uint64_t _internal_num_of_backups_in_sync() const;
+  void _internal_set_num_of_backups_in_sync(uint64_t value);
+  public:
+
+  // uint64 num_of_sync_timeouts = 8;
+  void clear_num_of_sync_timeouts();
+  uint64_t num_of_sync_timeouts() const;
+  void set_num_of_sync_timeouts(uint64_t value);
+  private:
+  uint64_t _internal_num_of_sync_timeouts() const;
+  void _internal_set_num_of_sync_timeouts(uint64_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:chirp.StatsReply)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::chirp::OperationStats > operations_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::chirp::PrefixUsage > prefixes_;
+    uint64_t lock_contentions_;
+    uint64_t lock_wait_ns_;
+    uint64_t bytes_used_;
+    uint64_t num_of_backups_;
+    uint64_t num_of_backups_in_sync_;
+    uint64_t num_of_sync_timeouts_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_key_5fvalue_2eproto;
+};
+// -------------------------------------------------------------------
+
+class ExistsRequest final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:chirp.ExistsRequest) */ {
+ public:
+  inline ExistsRequest() : ExistsRequest(nullptr) {}
+  ~ExistsRequest() override;
+  explicit PROTOBUF_CONSTEXPR ExistsRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  ExistsRequest(const ExistsRequest& from);
+  ExistsRequest(ExistsRequest&& from) noexcept
+    : ExistsRequest() {
+    *this = ::std::move(from);
+  }
+
+  inline ExistsRequest& operator=(const ExistsRequest& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline ExistsRequest& operator=(ExistsRequest&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ExistsRequest& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const ExistsRequest* internal_default_instance() {
+    return reinterpret_cast<const ExistsRequest*>(
+               &_ExistsRequest_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    24;
+
+  friend void swap(ExistsRequest& a, ExistsRequest& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(ExistsRequest* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ExistsRequest* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  ExistsRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ExistsRequest>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const ExistsRequest& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const ExistsRequest& from) {
+    ExistsRequest::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(ExistsRequest* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "chirp.ExistsRequest";
+  }
+  protected:
+  explicit ExistsRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kKeysFieldNumber = 1,
+  };
+  // repeated bytes keys = 1;
+  int keys_size() const;
+  private:
+  int _internal_keys_size() const;
+  public:
+  void clear_keys();
+  const std::string& keys(int index) const;
+  std::string* mutable_keys(int index);
+  void set_keys(int index, const std::string& value);
+  void set_keys(int index, std::string&& value);
+  void set_keys(int index, const char* value);
+  void set_keys(int index, const void* value, size_t size);
+  std::string* add_keys();
+  void add_keys(const std::string& value);
+  void add_keys(std::string&& value);
+  void add_keys(const char* value);
+  void add_keys(const void* value, size_t size);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>& keys() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>* mutable_keys();
+  private:
+  const std::string& _internal_keys(int index) const;
+  std::string* _internal_add_keys();
+  public:
+
+  // @@protoc_insertion_point(class_scope:chirp.ExistsRequest)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string> keys_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_key_5fvalue_2eproto;
+};
+// -------------------------------------------------------------------
+
+class ExistsReply final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:chirp.ExistsReply) */ {
+ public:
+  inline ExistsReply() : ExistsReply(nullptr) {}
+  ~ExistsReply() override;
+  explicit PROTOBUF_CONSTEXPR ExistsReply(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  ExistsReply(const ExistsReply& from);
+  ExistsReply(ExistsReply&& from) noexcept
+    : ExistsReply() {
+    *this = ::std::move(from);
+  }
+
+  inline ExistsReply& operator=(const ExistsReply& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline ExistsReply& operator=(ExistsReply&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ExistsReply& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const ExistsReply* internal_default_instance() {
+    return reinterpret_cast<const ExistsReply*>(
+               &_ExistsReply_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    25;
+
+  friend void swap(ExistsReply& a, ExistsReply& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(ExistsReply* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ExistsReply* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  ExistsReply* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ExistsReply>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const ExistsReply& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const ExistsReply& from) {
+    ExistsReply::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(ExistsReply* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "chirp.ExistsReply";
+  }
+  protected:
+  explicit ExistsReply(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kExistsFieldNumber = 1,
+  };
+  // repeated bool exists = 1;
+  int exists_size() const;
+  private:
+  int _internal_exists_size() const;
+  public:
+  void clear_exists();
+  private:
+  bool _internal_exists(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< bool >&
+      _internal_exists() const;
+  void _internal_add_exists(bool value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< bool >*
+      _internal_mutable_exists();
+  public:
+  bool exists(int index) const;
+  void set_exists(int index, bool value);
+  void add_exists(bool value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< bool >&
+      exists() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< bool >*
+      mutable_exists();
+
+  // @@protoc_insertion_point(class_scope:chirp.ExistsReply)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< bool > exists_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_key_5fvalue_2eproto;
+};
+// -------------------------------------------------------------------
+
+class CreateSnapshotRequest final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:chirp.CreateSnapshotRequest) */ {
+ public:
+  inline CreateSnapshotRequest() : CreateSnapshotRequest(nullptr) {}
+  ~CreateSnapshotRequest() override;
+  explicit PROTOBUF_CONSTEXPR CreateSnapshotRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  CreateSnapshotRequest(const CreateSnapshotRequest& from);
+  CreateSnapshotRequest(CreateSnapshotRequest&& from) noexcept
+    : CreateSnapshotRequest() {
+    *this = ::std::move(from);
+  }
+
+  inline CreateSnapshotRequest& operator=(const CreateSnapshotRequest& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline CreateSnapshotRequest& operator=(CreateSnapshotRequest&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const CreateSnapshotRequest& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const CreateSnapshotRequest* internal_default_instance() {
+    return reinterpret_cast<const CreateSnapshotRequest*>(
+               &_CreateSnapshotRequest_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    26;
+
+  friend void swap(CreateSnapshotRequest& a, CreateSnapshotRequest& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(CreateSnapshotRequest* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(CreateSnapshotRequest* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  CreateSnapshotRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<CreateSnapshotRequest>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const CreateSnapshotRequest& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const CreateSnapshotRequest& from) {
+    CreateSnapshotRequest::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(CreateSnapshotRequest* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "chirp.CreateSnapshotRequest";
+  }
+  protected:
+  explicit CreateSnapshotRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kLeaseMsFieldNumber = 1,
+  };
+  // uint64 lease_ms = 1;
+  void clear_lease_ms();
+  uint64_t lease_ms() const;
+  void set_lease_ms(uint64_t value);
+  private:
+  uint64_t _internal_lease_ms() const;
+  void _internal_set_lease_ms(uint64_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:chirp.CreateSnapshotRequest)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    uint64_t lease_ms_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_key_5fvalue_2eproto;
+};
+// -------------------------------------------------------------------
+
+class CreateSnapshotReply final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:chirp.CreateSnapshotReply) */ {
+ public:
+  inline CreateSnapshotReply() : CreateSnapshotReply(nullptr) {}
+  ~CreateSnapshotReply() override;
+  explicit PROTOBUF_CONSTEXPR CreateSnapshotReply(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  CreateSnapshotReply(const CreateSnapshotReply& from);
+  CreateSnapshotReply(CreateSnapshotReply&& from) noexcept
+    : CreateSnapshotReply() {
+    *this = ::std::move(from);
+  }
+
+  inline CreateSnapshotReply& operator=(const CreateSnapshotReply& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline CreateSnapshotReply& operator=(CreateSnapshotReply&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const CreateSnapshotReply& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const CreateSnapshotReply* internal_default_instance() {
+    return reinterpret_cast<const CreateSnapshotReply*>(
+               &_CreateSnapshotReply_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    27;
+
+  friend void swap(CreateSnapshotReply& a, CreateSnapshotReply& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(CreateSnapshotReply* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(CreateSnapshotReply* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  CreateSnapshotReply* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<CreateSnapshotReply>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const CreateSnapshotReply& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const CreateSnapshotReply& from) {
+    CreateSnapshotReply::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(CreateSnapshotReply* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "chirp.CreateSnapshotReply";
+  }
+  protected:
+  explicit CreateSnapshotReply(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kSnapshotFieldNumber = 1,
+  };
+  // uint64 snapshot = 1;
+  void clear_snapshot();
+  uint64_t snapshot() const;
+  void set_snapshot(uint64_t value);
+  private:
+  uint64_t _internal_snapshot() const;
+  void _internal_set_snapshot(uint64_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:chirp.CreateSnapshotReply)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    uint64_t snapshot_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_key_5fvalue_2eproto;
+};
+// -------------------------------------------------------------------
+
+class ReleaseSnapshotRequest final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:chirp.ReleaseSnapshotRequest) */ {
+ public:
+  inline ReleaseSnapshotRequest() : ReleaseSnapshotRequest(nullptr) {}
+  ~ReleaseSnapshotRequest() override;
+  explicit PROTOBUF_CONSTEXPR ReleaseSnapshotRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  ReleaseSnapshotRequest(const ReleaseSnapshotRequest& from);
+  ReleaseSnapshotRequest(ReleaseSnapshotRequest&& from) noexcept
+    : ReleaseSnapshotRequest() {
+    *this = ::std::move(from);
+  }
+
+  inline ReleaseSnapshotRequest& operator=(const ReleaseSnapshotRequest& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline ReleaseSnapshotRequest& operator=(ReleaseSnapshotRequest&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ReleaseSnapshotRequest& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const ReleaseSnapshotRequest* internal_default_instance() {
+    return reinterpret_cast<const ReleaseSnapshotRequest*>(
+               &_ReleaseSnapshotRequest_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    28;
+
+  friend void swap(ReleaseSnapshotRequest& a, ReleaseSnapshotRequest& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(ReleaseSnapshotRequest* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ReleaseSnapshotRequest* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  ReleaseSnapshotRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ReleaseSnapshotRequest>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const ReleaseSnapshotRequest& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const ReleaseSnapshotRequest& from) {
+    ReleaseSnapshotRequest::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(ReleaseSnapshotRequest* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "chirp.ReleaseSnapshotRequest";
+  }
+  protected:
+  explicit ReleaseSnapshotRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kSnapshotFieldNumber = 1,
+  };
+  // uint64 snapshot = 1;
+  void clear_snapshot();
+  uint64_t snapshot() const;
+  void set_snapshot(uint64_t value);
+  private:
+  uint64_t _internal_snapshot() const;
+  void _internal_set_snapshot(uint64_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:chirp.ReleaseSnapshotRequest)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    uint64_t snapshot_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_key_5fvalue_2eproto;
+};
+// -------------------------------------------------------------------
+
+class ReleaseSnapshotReply final :
+    public ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase /* @@protoc_insertion_point(class_definition:chirp.ReleaseSnapshotReply) */ {
+ public:
+  inline ReleaseSnapshotReply() : ReleaseSnapshotReply(nullptr) {}
+  explicit PROTOBUF_CONSTEXPR ReleaseSnapshotReply(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  ReleaseSnapshotReply(const ReleaseSnapshotReply& from);
+  ReleaseSnapshotReply(ReleaseSnapshotReply&& from) noexcept
+    : ReleaseSnapshotReply() {
+    *this = ::std::move(from);
+  }
+
+  inline ReleaseSnapshotReply& operator=(const ReleaseSnapshotReply& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline ReleaseSnapshotReply& operator=(ReleaseSnapshotReply&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ReleaseSnapshotReply& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const ReleaseSnapshotReply* internal_default_instance() {
+    return reinterpret_cast<const ReleaseSnapshotReply*>(
+               &_ReleaseSnapshotReply_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    29;
+
+  friend void swap(ReleaseSnapshotReply& a, ReleaseSnapshotReply& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(ReleaseSnapshotReply* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ReleaseSnapshotReply* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  ReleaseSnapshotReply* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ReleaseSnapshotReply>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::CopyFrom;
+  inline void CopyFrom(const ReleaseSnapshotReply& from) {
+    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::CopyImpl(*this, from);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::MergeFrom;
+  void MergeFrom(const ReleaseSnapshotReply& from) {
+    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::MergeImpl(*this, from);
+  }
+  public:
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "chirp.ReleaseSnapshotReply";
+  }
+  protected:
+  explicit ReleaseSnapshotReply(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  // @@protoc_insertion_point(class_scope:chirp.ReleaseSnapshotReply)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+  };
+  friend struct ::TableStruct_key_5fvalue_2eproto;
+};
+// -------------------------------------------------------------------
+
+class ChangesRequest final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:chirp.ChangesRequest) */ {
+ public:
+  inline ChangesRequest() : ChangesRequest(nullptr) {}
+  ~ChangesRequest() override;
+  explicit PROTOBUF_CONSTEXPR ChangesRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  ChangesRequest(const ChangesRequest& from);
+  ChangesRequest(ChangesRequest&& from) noexcept
+    : ChangesRequest() {
+    *this = ::std::move(from);
+  }
+
+  inline ChangesRequest& operator=(const ChangesRequest& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline ChangesRequest& operator=(ChangesRequest&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ChangesRequest& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const ChangesRequest* internal_default_instance() {
+    return reinterpret_cast<const ChangesRequest*>(
+               &_ChangesRequest_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    30;
+
+  friend void swap(ChangesRequest& a, ChangesRequest& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(ChangesRequest* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ChangesRequest* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  ChangesRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ChangesRequest>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const ChangesRequest& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const ChangesRequest& from) {
+    ChangesRequest::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(ChangesRequest* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "chirp.ChangesRequest";
+  }
+  protected:
+  explicit ChangesRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kPrefixFilterFieldNumber = 2,
+    kFromSeqFieldNumber = 1,
+  };
+  // bytes prefix_filter = 2;
+  void clear_prefix_filter();
+  const std::string& prefix_filter() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_prefix_filter(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_prefix_filter();
+  PROTOBUF_NODISCARD std::string* release_prefix_filter();
+  void set_allocated_prefix_filter(std::string* prefix_filter);
+  private:
+  const std::string& _internal_prefix_filter() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_prefix_filter(const std::string& value);
+  std::string* _internal_mutable_prefix_filter();
+  public:
+
+  // uint64 from_seq = 1;
+  void clear_from_seq();
+  uint64_t from_seq() const;
+  void set_from_seq(uint64_t value);
+  private:
+  uint64_t _internal_from_seq() const;
+  void _internal_set_from_seq(uint64_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:chirp.ChangesRequest)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr prefix_filter_;
+    uint64_t from_seq_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_key_5fvalue_2eproto;
+};
+// -------------------------------------------------------------------
+
+class Change final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:chirp.Change) */ {
+ public:
+  inline Change() : Change(nullptr) {}
+  ~Change() override;
+  explicit PROTOBUF_CONSTEXPR Change(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  Change(const Change& from);
+  Change(Change&& from) noexcept
+    : Change() {
+    *this = ::std::move(from);
+  }
+
+  inline Change& operator=(const Change& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline Change& operator=(Change&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const Change& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const Change* internal_default_instance() {
+    return reinterpret_cast<const Change*>(
+               &_Change_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    31;
+
+  friend void swap(Change& a, Change& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(Change* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(Change* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  Change* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<Change>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const Change& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const Change& from) {
+    Change::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(Change* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "chirp.Change";
+  }
+  protected:
+  explicit Change(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kKeyFieldNumber = 3,
+    kValueFieldNumber = 4,
+    kSeqFieldNumber = 1,
+    kDeletedFieldNumber = 2,
+  };
+  // bytes key = 3;
+  void clear_key();
+  const std::string& key() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_key(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_key();
+  PROTOBUF_NODISCARD std::string* release_key();
+  void set_allocated_key(std::string* key);
+  private:
+  const std::string& _internal_key() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_key(const std::string& value);
+  std::string* _internal_mutable_key();
+  public:
+
+  // bytes value = 4;
+  void clear_value();
+  const std::string& value() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_value(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_value();
+  PROTOBUF_NODISCARD std::string* release_value();
+  void set_allocated_value(std::string* value);
+  private:
+  const std::string& _internal_value() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_value(const std::string& value);
+  std::string* _internal_mutable_value();
+  public:
+
+  // uint64 seq = 1;
+  void clear_seq();
+  uint64_t seq() const;
+  void set_seq(uint64_t value);
+  private:
+  uint64_t _internal_seq() const;
+  void _internal_set_seq(uint64_t value);
+  public:
+
+  // bool deleted = 2;
+  void clear_deleted();
+  bool deleted() const;
+  void set_deleted(bool value);
+  private:
+  bool _internal_deleted() const;
+  void _internal_set_deleted(bool value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:chirp.Change)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr key_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr value_;
+    uint64_t seq_;
+    bool deleted_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_key_5fvalue_2eproto;
+};
+// -------------------------------------------------------------------
+
+class ChangesReply final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:chirp.ChangesReply) */ {
+ public:
+  inline ChangesReply() : ChangesReply(nullptr) {}
+  ~ChangesReply() override;
+  explicit PROTOBUF_CONSTEXPR ChangesReply(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  ChangesReply(const ChangesReply& from);
+  ChangesReply(ChangesReply&& from) noexcept
+    : ChangesReply() {
+    *this = ::std::move(from);
+  }
+
+  inline ChangesReply& operator=(const ChangesReply& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline ChangesReply& operator=(ChangesReply&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ChangesReply& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const ChangesReply* internal_default_instance() {
+    return reinterpret_cast<const ChangesReply*>(
+               &_ChangesReply_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    32;
+
+  friend void swap(ChangesReply& a, ChangesReply& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(ChangesReply* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ChangesReply* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  ChangesReply* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ChangesReply>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const ChangesReply& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const ChangesReply& from) {
+    ChangesReply::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(ChangesReply* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "chirp.ChangesReply";
+  }
+  protected:
+  explicit ChangesReply(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kChangesFieldNumber = 1,
+    kNextSeqFieldNumber = 2,
+  };
+  // repeated .chirp.Change changes = 1;
+  int changes_size() const;
+  private:
+  int _internal_changes_size() const;
+  public:
+  void clear_changes();
+  ::chirp::Change* mutable_changes(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::chirp::Change >*
+      mutable_changes();
+  private:
+  const ::chirp::Change& _internal_changes(int index) const;
+  ::chirp::Change* _internal_add_changes();
+  public:
+  const ::chirp::Change& changes(int index) const;
+  ::chirp::Change* add_changes();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::chirp::Change >&
+      changes() const;
+
+  // uint64 next_seq = 2;
+  void clear_next_seq();
+  uint64_t next_seq() const;
+  void set_next_seq(uint64_t value);
+  private:
+  uint64_t _internal_next_seq() const;
+  void _internal_set_next_seq(uint64_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:chirp.ChangesReply)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::chirp::Change > changes_;
+    uint64_t next_seq_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_key_5fvalue_2eproto;
+};
+// -------------------------------------------------------------------
+
+class WatchRequest final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:chirp.WatchRequest) */ {
+ public:
+  inline WatchRequest() : WatchRequest(nullptr) {}
+  ~WatchRequest() override;
+  explicit PROTOBUF_CONSTEXPR WatchRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  WatchRequest(const WatchRequest& from);
+  WatchRequest(WatchRequest&& from) noexcept
+    : WatchRequest() {
+    *this = ::std::move(from);
+  }
+
+  inline WatchRequest& operator=(const WatchRequest& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline WatchRequest& operator=(WatchRequest&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const WatchRequest& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const WatchRequest* internal_default_instance() {
+    return reinterpret_cast<const WatchRequest*>(
+               &_WatchRequest_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    33;
+
+  friend void swap(WatchRequest& a, WatchRequest& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(WatchRequest* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(WatchRequest* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  WatchRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<WatchRequest>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const WatchRequest& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const WatchRequest& from) {
+    WatchRequest::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(WatchRequest* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "chirp.WatchRequest";
+  }
+  protected:
+  explicit WatchRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kPrefixesFieldNumber = 1,
+    kWithValuesFieldNumber = 2,
+  };
+  // repeated bytes prefixes = 1;
+  int prefixes_size() const;
+  private:
+  int _internal_prefixes_size() const;
+  public:
+  void clear_prefixes();
+  const std::string& prefixes(int index) const;
+  std::string* mutable_prefixes(int index);
+  void set_prefixes(int index, const std::string& value);
+  void set_prefixes(int index, std::string&& value);
+  void set_prefixes(int index, const char* value);
+  void set_prefixes(int index, const void* value, size_t size);
+  std::string* add_prefixes();
+  void add_prefixes(const std::string& value);
+  void add_prefixes(std::string&& value);
+  void add_prefixes(const char* value);
+  void add_prefixes(const void* value, size_t size);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>& prefixes() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>* mutable_prefixes();
+  private:
+  const std::string& _internal_prefixes(int index) const;
+  std::string* _internal_add_prefixes();
+  public:
+
+  // bool with_values = 2;
+  void clear_with_values();
+  bool with_values() const;
+  void set_with_values(bool value);
+  private:
+  bool _internal_with_values() const;
+  void _internal_set_with_values(bool value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:chirp.WatchRequest)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string> prefixes_;
+    bool with_values_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_key_5fvalue_2eproto;
+};
+// -------------------------------------------------------------------
+
+class WatchEvent final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:chirp.WatchEvent) */ {
+ public:
+  inline WatchEvent() : WatchEvent(nullptr) {}
+  ~WatchEvent() override;
+  explicit PROTOBUF_CONSTEXPR WatchEvent(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  WatchEvent(const WatchEvent& from);
+  WatchEvent(WatchEvent&& from) noexcept
+    : WatchEvent() {
+    *this = ::std::move(from);
+  }
+
+  inline WatchEvent& operator=(const WatchEvent& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline WatchEvent& operator=(WatchEvent&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const WatchEvent& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const WatchEvent* internal_default_instance() {
+    return reinterpret_cast<const WatchEvent*>(
+               &_WatchEvent_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    34;
+
+  friend void swap(WatchEvent& a, WatchEvent& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(WatchEvent* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(WatchEvent* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  WatchEvent* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<WatchEvent>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const WatchEvent& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const WatchEvent& from) {
+    WatchEvent::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(WatchEvent* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "chirp.WatchEvent";
+  }
+  protected:
+  explicit WatchEvent(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kKeyFieldNumber = 1,
+    kValueFieldNumber = 3,
+    kDeletedFieldNumber = 2,
+  };
+  // bytes key = 1;
+  void clear_key();
+  const std::string& key() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_key(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_key();
+  PROTOBUF_NODISCARD std::string* release_key();
+  void set_allocated_key(std::string* key);
+  private:
+  const std::string& _internal_key() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_key(const std::string& value);
+  std::string* _internal_mutable_key();
+  public:
+
+  // bytes value = 3;
+  void clear_value();
+  const std::string& value() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_value(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_value();
+  PROTOBUF_NODISCARD std::string* release_value();
+  void set_allocated_value(std::string* value);
+  private:
+  const std::string& _internal_value() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_value(const std::string& value);
+  std::string* _internal_mutable_value();
+  public:
+
+  // bool deleted = 2;
+  void clear_deleted();
+  bool deleted() const;
+  void set_deleted(bool value);
+  private:
+  bool _internal_deleted() const;
+  void _internal_set_deleted(bool value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:chirp.WatchEvent)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr key_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr value_;
+    bool deleted_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_key_5fvalue_2eproto;
+};
+// -------------------------------------------------------------------
+
+class WatchReply final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:chirp.WatchReply) */ {
+ public:
+  inline WatchReply() : WatchReply(nullptr) {}
+  ~WatchReply() override;
+  explicit PROTOBUF_CONSTEXPR WatchReply(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  WatchReply(const WatchReply& from);
+  WatchReply(WatchReply&& from) noexcept
+    : WatchReply() {
+    *this = ::std::move(from);
+  }
+
+  inline WatchReply& operator=(const WatchReply& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline WatchReply& operator=(WatchReply&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const WatchReply& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const WatchReply* internal_default_instance() {
+    return reinterpret_cast<const WatchReply*>(
+               &_WatchReply_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    35;
+
+  friend void swap(WatchReply& a, WatchReply& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(WatchReply* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(WatchReply* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  WatchReply* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<WatchReply>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const WatchReply& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const WatchReply& from) {
+    WatchReply::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(WatchReply* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "chirp.WatchReply";
+  }
+  protected:
+  explicit WatchReply(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kEventsFieldNumber = 1,
+    kOverflowedFieldNumber = 2,
+  };
+  // repeated .chirp.WatchEvent events = 1;
+  int events_size() const;
+  private:
+  int _internal_events_size() const;
+  public:
+  void clear_events();
+  ::chirp::WatchEvent* mutable_events(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::chirp::WatchEvent >*
+      mutable_events();
+  private:
+  const ::chirp::WatchEvent& _internal_events(int index) const;
+  ::chirp::WatchEvent* _internal_add_events();
+  public:
+  const ::chirp::WatchEvent& events(int index) const;
+  ::chirp::WatchEvent* add_events();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::chirp::WatchEvent >&
+      events() const;
+
+  // bool overflowed = 2;
+  void clear_overflowed();
+  bool overflowed() const;
+  void set_overflowed(bool value);
+  private:
+  bool _internal_overflowed() const;
+  void _internal_set_overflowed(bool value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:chirp.WatchReply)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::chirp::WatchEvent > events_;
+    bool overflowed_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_key_5fvalue_2eproto;
+};
+// -------------------------------------------------------------------
+
+class BatchCondition final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:chirp.BatchCondition) */ {
+ public:
+  inline BatchCondition() : BatchCondition(nullptr) {}
+  ~BatchCondition() override;
+  explicit PROTOBUF_CONSTEXPR BatchCondition(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  BatchCondition(const BatchCondition& from);
+  BatchCondition(BatchCondition&& from) noexcept
+    : BatchCondition() {
+    *this = ::std::move(from);
+  }
+
+  inline BatchCondition& operator=(const BatchCondition& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline BatchCondition& operator=(BatchCondition&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const BatchCondition& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const BatchCondition* internal_default_instance() {
+    return reinterpret_cast<const BatchCondition*>(
+               &_BatchCondition_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    36;
+
+  friend void swap(BatchCondition& a, BatchCondition& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(BatchCondition* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(BatchCondition* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  BatchCondition* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<BatchCondition>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const BatchCondition& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const BatchCondition& from) {
+    BatchCondition::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(BatchCondition* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "chirp.BatchCondition";
+  }
+  protected:
+  explicit BatchCondition(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kKeyFieldNumber = 1,
+    kExpectedFieldNumber = 2,
+    kExistsFieldNumber = 3,
+  };
+  // bytes key = 1;
+  void clear_key();
+  const std::string& key() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_key(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_key();
+  PROTOBUF_NODISCARD std::string* release_key();
+  void set_allocated_key(std::string* key);
+  private:
+  const std::string& _internal_key() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_key(const std::string& value);
+  std::string* _internal_mutable_key();
+  public:
+
+  // bytes expected = 2;
+  void clear_expected();
+  const std::string& expected() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_expected(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_expected();
+  PROTOBUF_NODISCARD std::string* release_expected();
+  void set_allocated_expected(std::string* expected);
+  private:
+  const std::string& _internal_expected() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_expected(const std::string& value);
+  std::string* _internal_mutable_expected();
+  public:
+
+  // bool exists = 3;
+  void clear_exists();
+  bool exists() const;
+  void set_exists(bool value);
+  private:
+  bool _internal_exists() const;
+  void _internal_set_exists(bool value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:chirp.BatchCondition)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr key_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr expected_;
+    bool exists_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_key_5fvalue_2eproto;
+};
+// -------------------------------------------------------------------
+
+class BatchWrite final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:chirp.BatchWrite) */ {
+ public:
+  inline BatchWrite() : BatchWrite(nullptr) {}
+  ~BatchWrite() override;
+  explicit PROTOBUF_CONSTEXPR BatchWrite(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  BatchWrite(const BatchWrite& from);
+  BatchWrite(BatchWrite&& from) noexcept
+    : BatchWrite() {
+    *this = ::std::move(from);
+  }
+
+  inline BatchWrite& operator=(const BatchWrite& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline BatchWrite& operator=(BatchWrite&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const BatchWrite& default_instance() {
+    return *internal_default_instance();
+  }
+  enum WriteCase {
+    kPut = 1,
+    kDeleteKey = 2,
+    kListAppend = 3,
+    kListRemove = 4,
+    WRITE_NOT_SET = 0,
+  };
+
+  static inline const BatchWrite* internal_default_instance() {
+    return reinterpret_cast<const BatchWrite*>(
+               &_BatchWrite_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    37;
+
+  friend void swap(BatchWrite& a, BatchWrite& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(BatchWrite* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(BatchWrite* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  BatchWrite* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<BatchWrite>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const BatchWrite& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const BatchWrite& from) {
+    BatchWrite::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(BatchWrite* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "chirp.BatchWrite";
+  }
+  protected:
+  explicit BatchWrite(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kPutFieldNumber = 1,
+    kDeleteKeyFieldNumber = 2,
+    kListAppendFieldNumber = 3,
+    kListRemoveFieldNumber = 4,
+  };
+  // .chirp.PutRequest put = 1;
+  bool has_put() const;
+  private:
+  bool _internal_has_put() const;
+  public:
+  void clear_put();
+  const ::chirp::PutRequest& put() const;
+  PROTOBUF_NODISCARD ::chirp::PutRequest* release_put();
+  ::chirp::PutRequest* mutable_put();
+  void set_allocated_put(::chirp::PutRequest* put);
+  private:
+  const ::chirp::PutRequest& _internal_put() const;
+  ::chirp::PutRequest* _internal_mutable_put();
+  public:
+  void unsafe_arena_set_allocated_put(
+      ::chirp::PutRequest* put);
+  ::chirp::PutRequest* unsafe_arena_release_put();
+
+  // .chirp.DeleteRequest delete_key = 2;
+  bool has_delete_key() const;
+  private:
+  bool _internal_has_delete_key() const;
+  public:
+  void clear_delete_key();
+  const ::chirp::DeleteRequest& delete_key() const;
+  PROTOBUF_NODISCARD ::chirp::DeleteRequest* release_delete_key();
+  ::chirp::DeleteRequest* mutable_delete_key();
+  void set_allocated_delete_key(::chirp::DeleteRequest* delete_key);
+  private:
+  const ::chirp::DeleteRequest& _internal_delete_key() const;
+  ::chirp::DeleteRequest* _internal_mutable_delete_key();
+  public:
+  void unsafe_arena_set_allocated_delete_key(
+      ::chirp::DeleteRequest* delete_key);
+  ::chirp::DeleteRequest* unsafe_arena_release_delete_key();
+
+  // .chirp.ListElementRequest list_append = 3;
+  bool has_list_append() const;
+  private:
+  bool _internal_has_list_append() const;
+  public:
+  void clear_list_append();
+  const ::chirp::ListElementRequest& list_append() const;
+  PROTOBUF_NODISCARD ::chirp::ListElementRequest* release_list_append();
+  ::chirp::ListElementRequest* mutable_list_append();
+  void set_allocated_list_append(::chirp::ListElementRequest* list_append);
+  private:
+  const ::chirp::ListElementRequest& _internal_list_append() const;
+  ::chirp::ListElementRequest* _internal_mutable_list_append();
+  public:
+  void unsafe_arena_set_allocated_list_append(
+      ::chirp::ListElementRequest* list_append);
+  ::chirp::ListElementRequest* unsafe_arena_release_list_append();
+
+  // .chirp.ListElementRequest list_remove = 4;
+  bool has_list_remove() const;
+  private:
+  bool _internal_has_list_remove() const;
+  public:
+  void clear_list_remove();
+  const ::chirp::ListElementRequest& list_remove() const;
+  PROTOBUF_NODISCARD ::chirp::ListElementRequest* release_list_remove();
+  ::chirp::ListElementRequest* mutable_list_remove();
+  void set_allocated_list_remove(::chirp::ListElementRequest* list_remove);
+  private:
+  const ::chirp::ListElementRequest& _internal_list_remove() const;
+  ::chirp::ListElementRequest* _internal_mutable_list_remove();
+  public:
+  void unsafe_arena_set_allocated_list_remove(
+      ::chirp::ListElementRequest* list_remove);
+  ::chirp::ListElementRequest* unsafe_arena_release_list_remove();
+
+  void clear_write();
+  WriteCase write_case() const;
+  // @@protoc_insertion_point(class_scope:chirp.BatchWrite)
+ private:
+  class _Internal;
+  void set_has_put();
+  void set_has_delete_key();
+  void set_has_list_append();
+  void set_has_list_remove();
+
+  inline bool has_write() const;
+  inline void clear_has_write();
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    union WriteUnion {
+      constexpr WriteUnion() : _constinit_{} {}
+        ::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized _constinit_;
+      ::chirp::PutRequest* put_;
+      ::chirp::DeleteRequest* delete_key_;
+      ::chirp::ListElementRequest* list_append_;
+      ::chirp::ListElementRequest* list_remove_;
+    } write_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    uint32_t _oneof_case_[1];
+
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_key_5fvalue_2eproto;
+};
+// -------------------------------------------------------------------
+
+class WriteBatchRequest final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:chirp.WriteBatchRequest) */ {
+ public:
+  inline WriteBatchRequest() : WriteBatchRequest(nullptr) {}
+  ~WriteBatchRequest() override;
+  explicit PROTOBUF_CONSTEXPR WriteBatchRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  WriteBatchRequest(const WriteBatchRequest& from);
+  WriteBatchRequest(WriteBatchRequest&& from) noexcept
+    : WriteBatchRequest() {
+    *this = ::std::move(from);
+  }
+
+  inline WriteBatchRequest& operator=(const WriteBatchRequest& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline WriteBatchRequest& operator=(WriteBatchRequest&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const WriteBatchRequest& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const WriteBatchRequest* internal_default_instance() {
+    return reinterpret_cast<const WriteBatchRequest*>(
+               &_WriteBatchRequest_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    38;
+
+  friend void swap(WriteBatchRequest& a, WriteBatchRequest& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(WriteBatchRequest* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(WriteBatchRequest* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  WriteBatchRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<WriteBatchRequest>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const WriteBatchRequest& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const WriteBatchRequest& from) {
+    WriteBatchRequest::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(WriteBatchRequest* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "chirp.WriteBatchRequest";
+  }
+  protected:
+  explicit WriteBatchRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kConditionsFieldNumber = 1,
+    kWritesFieldNumber = 2,
+  };
+  // repeated .chirp.BatchCondition conditions = 1;
+  int conditions_size() const;
+  private:
+  int _internal_conditions_size() const;
+  public:
+  void clear_conditions();
+  ::chirp::BatchCondition* mutable_conditions(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::chirp::BatchCondition >*
+      mutable_conditions();
+  private:
+  const ::chirp::BatchCondition& _internal_conditions(int index) const;
+  ::chirp::BatchCondition* _internal_add_conditions();
+  public:
+  const ::chirp::BatchCondition& conditions(int index) const;
+  ::chirp::BatchCondition* add_conditions();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::chirp::BatchCondition >&
+      conditions() const;
+
+  // repeated .chirp.BatchWrite writes = 2;
+  int writes_size() const;
+  private:
+  int _internal_writes_size() const;
+  public:
+  void clear_writes();
+  ::chirp::BatchWrite* mutable_writes(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::chirp::BatchWrite >*
+      mutable_writes();
+  private:
+  const ::chirp::BatchWrite& _internal_writes(int index) const;
+  ::chirp::BatchWrite* _internal_add_writes();
+  public:
+  const ::chirp::BatchWrite& writes(int index) const;
+  ::chirp::BatchWrite* add_writes();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::chirp::BatchWrite >&
+      writes() const;
+
+  // @@protoc_insertion_point(class_scope:chirp.WriteBatchRequest)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::chirp::BatchCondition > conditions_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::chirp::BatchWrite > writes_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_key_5fvalue_2eproto;
+};
+// -------------------------------------------------------------------
+
+class WriteBatchReply final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:chirp.WriteBatchReply) */ {
+ public:
+  inline WriteBatchReply() : WriteBatchReply(nullptr) {}
+  ~WriteBatchReply() override;
+  explicit PROTOBUF_CONSTEXPR WriteBatchReply(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  WriteBatchReply(const WriteBatchReply& from);
+  WriteBatchReply(WriteBatchReply&& from) noexcept
+    : WriteBatchReply() {
+    *this = ::std::move(from);
+  }
+
+  inline WriteBatchReply& operator=(const WriteBatchReply& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline WriteBatchReply& operator=(WriteBatchReply&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const WriteBatchReply& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const WriteBatchReply* internal_default_instance() {
+    return reinterpret_cast<const WriteBatchReply*>(
+               &_WriteBatchReply_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    39;
+
+  friend void swap(WriteBatchReply& a, WriteBatchReply& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(WriteBatchReply* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(WriteBatchReply* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  WriteBatchReply* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<WriteBatchReply>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const WriteBatchReply& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const WriteBatchReply& from) {
+    WriteBatchReply::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(WriteBatchReply* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "chirp.WriteBatchReply";
+  }
+  protected:
+  explicit WriteBatchReply(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kActualFieldNumber = 3,
+    kAppliedFieldNumber = 1,
+    kFailedConditionFieldNumber = 2,
+  };
+  // bytes actual = 3;
+  void clear_actual();
+  const std::string& actual() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_actual(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_actual();
+  PROTOBUF_NODISCARD std::string* release_actual();
+  void set_allocated_actual(std::string* actual);
+  private:
+  const std::string& _internal_actual() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_actual(const std::string& value);
+  std::string* _internal_mutable_actual();
+  public:
+
+  // bool applied = 1;
+  void clear_applied();
+  bool applied() const;
+  void set_applied(bool value);
+  private:
+  bool _internal_applied() const;
+  void _internal_set_applied(bool value);
+  public:
+
+  // uint32 failed_condition = 2;
+  void clear_failed_condition();
+  uint32_t failed_condition() const;
+  void set_failed_condition(uint32_t value);
+  private:
+  uint32_t _internal_failed_condition() const;
+  void _internal_set_failed_condition(uint32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:chirp.WriteBatchReply)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr actual_;
+    bool applied_;
+    uint32_t failed_condition_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_key_5fvalue_2eproto;
+};
+// -------------------------------------------------------------------
+
+class ReplicationRecord final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:chirp.ReplicationRecord) */ {
+ public:
+  inline ReplicationRecord() : ReplicationRecord(nullptr) {}
+  ~ReplicationRecord() override;
+  explicit PROTOBUF_CONSTEXPR ReplicationRecord(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  ReplicationRecord(const ReplicationRecord& from);
+  ReplicationRecord(ReplicationRecord&& from) noexcept
+    : ReplicationRecord() {
+    *this = ::std::move(from);
+  }
+
+  inline ReplicationRecord& operator=(const ReplicationRecord& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline ReplicationRecord& operator=(ReplicationRecord&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ReplicationRecord& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const ReplicationRecord* internal_default_instance() {
+    return reinterpret_cast<const ReplicationRecord*>(
+               &_ReplicationRecord_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    40;
+
+  friend void swap(ReplicationRecord& a, ReplicationRecord& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(ReplicationRecord* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ReplicationRecord* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  ReplicationRecord* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ReplicationRecord>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const ReplicationRecord& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const ReplicationRecord& from) {
+    ReplicationRecord::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(ReplicationRecord* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "chirp.ReplicationRecord";
+  }
+  protected:
+  explicit ReplicationRecord(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kKeyFieldNumber = 3,
+    kValueFieldNumber = 4,
+    kLsnFieldNumber = 1,
+    kOperationFieldNumber = 2,
+  };
+  // bytes key = 3;
+  void clear_key();
+  const std::string& key() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_key(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_key();
+  PROTOBUF_NODISCARD std::string* release_key();
+  void set_allocated_key(std::string* key);
+  private:
+  const std::string& _internal_key() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_key(const std::string& value);
+  std::string* _internal_mutable_key();
+  public:
+
+  // bytes value = 4;
+  void clear_value();
+  const std::string& value() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_value(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_value();
+  PROTOBUF_NODISCARD std::string* release_value();
+  void set_allocated_value(std::string* value);
+  private:
+  const std::string& _internal_value() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_value(const std::string& value);
+  std::string* _internal_mutable_value();
+  public:
+
+  // uint64 lsn = 1;
+  void clear_lsn();
+  uint64_t lsn() const;
+  void set_lsn(uint64_t value);
+  private:
+  uint64_t _internal_lsn() const;
+  void _internal_set_lsn(uint64_t value);
+  public:
+
+  // uint32 operation = 2;
+  void clear_operation();
+  uint32_t operation() const;
+  void set_operation(uint32_t value);
+  private:
+  uint32_t _internal_operation() const;
+  void _internal_set_operation(uint32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:chirp.ReplicationRecord)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr key_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr value_;
+    uint64_t lsn_;
+    uint32_t operation_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_key_5fvalue_2eproto;
+};
+// -------------------------------------------------------------------
+
+class ReplicationBatch final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:chirp.ReplicationBatch) */ {
+ public:
+  inline ReplicationBatch() : ReplicationBatch(nullptr) {}
+  ~ReplicationBatch() override;
+  explicit PROTOBUF_CONSTEXPR ReplicationBatch(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  ReplicationBatch(const ReplicationBatch& from);
+  ReplicationBatch(ReplicationBatch&& from) noexcept
+    : ReplicationBatch() {
+    *this = ::std::move(from);
+  }
+
+  inline ReplicationBatch& operator=(const ReplicationBatch& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline ReplicationBatch& operator=(ReplicationBatch&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ReplicationBatch& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const ReplicationBatch* internal_default_instance() {
+    return reinterpret_cast<const ReplicationBatch*>(
+               &_ReplicationBatch_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    41;
+
+  friend void swap(ReplicationBatch& a, ReplicationBatch& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(ReplicationBatch* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ReplicationBatch* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  ReplicationBatch* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ReplicationBatch>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const ReplicationBatch& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const ReplicationBatch& from) {
+    ReplicationBatch::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(ReplicationBatch* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "chirp.ReplicationBatch";
+  }
+  protected:
+  explicit ReplicationBatch(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kPairsFieldNumber = 2,
+    kRecordsFieldNumber = 3,
+    kLsnFieldNumber = 4,
+    kResetFieldNumber = 1,
+  };
+  // repeated .chirp.PutRequest pairs = 2;
+  int pairs_size() const;
+  private:
+  int _internal_pairs_size() const;
+  public:
+  void clear_pairs();
+  ::chirp::PutRequest* mutable_pairs(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::chirp::PutRequest >*
+      mutable_pairs();
+  private:
+  const ::chirp::PutRequest& _internal_pairs(int index) const;
+  ::chirp::PutRequest* _internal_add_pairs();
+  public:
+  const ::chirp::PutRequest& pairs(int index) const;
+  ::chirp::PutRequest* add_pairs();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::chirp::PutRequest >&
+      pairs() const;
+
+  // repeated .chirp.ReplicationRecord records = 3;
+  int records_size() const;
+  private:
+  int _internal_records_size() const;
+  public:
+  void clear_records();
+  ::chirp::ReplicationRecord* mutable_records(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::chirp::ReplicationRecord >*
+      mutable_records();
+  private:
+  const ::chirp::ReplicationRecord& _internal_records(int index) const;
+  ::chirp::ReplicationRecord* _internal_add_records();
+  public:
+  const ::chirp::ReplicationRecord& records(int index) const;
+  ::chirp::ReplicationRecord* add_records();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::chirp::ReplicationRecord >&
+      records() const;
+
+  // uint64 lsn = 4;
+  void clear_lsn();
+  uint64_t lsn() const;
+  void set_lsn(uint64_t value);
+  private:
+  uint64_t _internal_lsn() const;
+  void _internal_set_lsn(uint64_t value);
+  public:
+
+  // bool reset = 1;
+  void clear_reset();
+  bool reset() const;
+  void set_reset(bool value);
+  private:
+  bool _internal_reset() const;
+  void _internal_set_reset(bool value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:chirp.ReplicationBatch)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::chirp::PutRequest > pairs_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::chirp::ReplicationRecord > records_;
+    uint64_t lsn_;
+    bool reset_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_key_5fvalue_2eproto;
+};
+// -------------------------------------------------------------------
+
+class ReplicationAck final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:chirp.ReplicationAck) */ {
+ public:
+  inline ReplicationAck() : ReplicationAck(nullptr) {}
+  ~ReplicationAck() override;
+  explicit PROTOBUF_CONSTEXPR ReplicationAck(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  ReplicationAck(const ReplicationAck& from);
+  ReplicationAck(ReplicationAck&& from) noexcept
+    : ReplicationAck() {
+    *this = ::std::move(from);
+  }
+
+  inline ReplicationAck& operator=(const ReplicationAck& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline ReplicationAck& operator=(ReplicationAck&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ReplicationAck& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const ReplicationAck* internal_default_instance() {
+    return reinterpret_cast<const ReplicationAck*>(
+               &_ReplicationAck_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    42;
+
+  friend void swap(ReplicationAck& a, ReplicationAck& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(ReplicationAck* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ReplicationAck* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  ReplicationAck* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ReplicationAck>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const ReplicationAck& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const ReplicationAck& from) {
+    ReplicationAck::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(ReplicationAck* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "chirp.ReplicationAck";
+  }
+  protected:
+  explicit ReplicationAck(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kAppliedLsnFieldNumber = 1,
+  };
+  // uint64 applied_lsn = 1;
+  void clear_applied_lsn();
+  uint64_t applied_lsn() const;
+  void set_applied_lsn(uint64_t value);
+  private:
+  uint64_t _internal_applied_lsn() const;
+  void _internal_set_applied_lsn(uint64_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:chirp.ReplicationAck)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    uint64_t applied_lsn_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_key_5fvalue_2eproto;
+};
+// ===================================================================
+
+
+// ===================================================================
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic push
+  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
+#endif  // __GNUC__
+// PutRequest
+
+// bytes key = 1;
+inline void PutRequest::clear_key() {
+  _impl_.key_.ClearToEmpty();
+}
+inline const std::string& PutRequest::key() const {
+  // @@protoc_insertion_point(field_get:chirp.PutRequest.key)
+  return _internal_key();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void PutRequest::set_key(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.key_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:chirp.PutRequest.key)
+}
+inline std::string* PutRequest::mutable_key() {
+  std::string* _s = _internal_mutable_key();
+  // @@protoc_insertion_point(field_mutable:chirp.PutRequest.key)
+  return _s;
+}
+inline const std::string& PutRequest::_internal_key() const {
+  return _impl_.key_.Get();
+}
+inline void PutRequest::_internal_set_key(const std::string& value) {
+  
+  _impl_.key_.Set(value, GetArenaForAllocation());
+}
+inline std::string* PutRequest::_internal_mutable_key() {
+  
+  return _impl_.key_.Mutable(GetArenaForAllocation());
+}
+inline std::string* PutRequest::release_key() {
+  // @@protoc_insertion_point(field_release:chirp.PutRequest.key)
+  return _impl_.key_.Release();
+}
+inline void PutRequest::set_allocated_key(std::string* key) {
+  if (key != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.key_.SetAllocated(key, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.key_.IsDefault()) {
+    _impl_.key_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:chirp.PutRequest.key)
+}
+
+// bytes value = 2;
+inline void PutRequest::clear_value() {
+  _impl_.value_.ClearToEmpty();
+}
+inline const std::string& PutRequest::value() const {
+  // @@protoc_insertion_point(field_get:chirp.PutRequest.value)
+  return _internal_value();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void PutRequest::set_value(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.value_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:chirp.PutRequest.value)
+}
+inline std::string* PutRequest::mutable_value() {
+  std::string* _s = _internal_mutable_value();
+  // @@protoc_insertion_point(field_mutable:chirp.PutRequest.value)
+  return _s;
+}
+inline const std::string& PutRequest::_internal_value() const {
+  return _impl_.value_.Get();
+}
+inline void PutRequest::_internal_set_value(const std::string& value) {
+  
+  _impl_.value_.Set(value, GetArenaForAllocation());
+}
+inline std::string* PutRequest::_internal_mutable_value() {
+  
+  return _impl_.value_.Mutable(GetArenaForAllocation());
+}
+inline std::string* PutRequest::release_value() {
+  // @@protoc_insertion_point(field_release:chirp.PutRequest.value)
+  return _impl_.value_.Release();
+}
+inline void PutRequest::set_allocated_value(std::string* value) {
+  if (value != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.value_.SetAllocated(value, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.value_.IsDefault()) {
+    _impl_.value_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:chirp.PutRequest.value)
+}
+
+// uint64 ttl_ms = 3;
+inline void PutRequest::clear_ttl_ms() {
+  _impl_.ttl_ms_ = uint64_t{0u};
+}
+inline uint64_t PutRequest::_internal_ttl_ms() const {
+  return _impl_.ttl_ms_;
+}
+inline uint64_t PutRequest::ttl_ms() const {
+  // @@protoc_insertion_point(field_get:chirp.PutRequest.ttl_ms)
+  return _internal_ttl_ms();
+}
+inline void PutRequest::_internal_set_ttl_ms(uint64_t value) {
+  
+  _impl_.ttl_ms_ = value;
+}
+inline void PutRequest::set_ttl_ms(uint64_t value) {
+  _internal_set_ttl_ms(value);
+  // @@protoc_insertion_point(field_set:chirp.PutRequest.ttl_ms)
+}
+
+// -------------------------------------------------------------------
+
+// PutReply
+
+// -------------------------------------------------------------------
+
+// GetRequest
+
+// bytes key = 1;
+inline void GetRequest::clear_key() {
+  _impl_.key_.ClearToEmpty();
+}
+inline const std::string& GetRequest::key() const {
+  // @@protoc_insertion_point(field_get:chirp.GetRequest.key)
+  return _internal_key();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void GetRequest::set_key(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.key_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:chirp.GetRequest.key)
+}
+inline std::string* GetRequest::mutable_key() {
+  std::string* _s = _internal_mutable_key();
+  // @@protoc_insertion_point(field_mutable:chirp.GetRequest.key)
+  return _s;
+}
+inline const std::string& GetRequest::_internal_key() const {
+  return _impl_.key_.Get();
+}
+inline void GetRequest::_internal_set_key(const std::string& value) {
+  
+  _impl_.key_.Set(value, GetArenaForAllocation());
+}
+inline std::string* GetRequest::_internal_mutable_key() {
+  
+  return _impl_.key_.Mutable(GetArenaForAllocation());
+}
+inline std::string* GetRequest::release_key() {
+  // @@protoc_insertion_point(field_release:chirp.GetRequest.key)
+  return _impl_.key_.Release();
+}
+inline void GetRequest::set_allocated_key(std::string* key) {
+  if (key != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.key_.SetAllocated(key, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.key_.IsDefault()) {
+    _impl_.key_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:chirp.GetRequest.key)
+}
+
+// repeated bytes keys = 2;
+inline int GetRequest::_internal_keys_size() const {
+  return _impl_.keys_.size();
+}
+inline int GetRequest::keys_size() const {
+  return _internal_keys_size();
+}
+inline void GetRequest::clear_keys() {
+  _impl_.keys_.Clear();
+}
+inline std::string* GetRequest::add_keys() {
+  std::string* _s = _internal_add_keys();
+  // @@protoc_insertion_point(field_add_mutable:chirp.GetRequest.keys)
+  return _s;
+}
+inline const std::string& GetRequest::_internal_keys(int index) const {
+  return _impl_.keys_.Get(index);
+}
+inline const std::string& GetRequest::keys(int index) const {
+  // @@protoc_insertion_point(field_get:chirp.GetRequest.keys)
+  return _internal_keys(index);
+}
+inline std::string* GetRequest::mutable_keys(int index) {
+  // @@protoc_insertion_point(field_mutable:chirp.GetRequest.keys)
+  return _impl_.keys_.Mutable(index);
+}
+inline void GetRequest::set_keys(int index, const std::string& value) {
+  _impl_.keys_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set:chirp.GetRequest.keys)
+}
+inline void GetRequest::set_keys(int index, std::string&& value) {
+  _impl_.keys_.Mutable(index)->assign(std::move(value));
+  // @@protoc_insertion_point(field_set:chirp.GetRequest.keys)
+}
+inline void GetRequest::set_keys(int index, const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.keys_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set_char:chirp.GetRequest.keys)
+}
+inline void GetRequest::set_keys(int index, const void* value, size_t size) {
+  _impl_.keys_.Mutable(index)->assign(
+    reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_set_pointer:chirp.GetRequest.keys)
+}
+inline std::string* GetRequest::_internal_add_keys() {
+  return _impl_.keys_.Add();
+}
+inline void GetRequest::add_keys(const std::string& value) {
+  _impl_.keys_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add:chirp.GetRequest.keys)
+}
+inline void GetRequest::add_keys(std::string&& value) {
+  _impl_.keys_.Add(std::move(value));
+  // @@protoc_insertion_point(field_add:chirp.GetRequest.keys)
+}
+inline void GetRequest::add_keys(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.keys_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add_char:chirp.GetRequest.keys)
+}
+inline void GetRequest::add_keys(const void* value, size_t size) {
+  _impl_.keys_.Add()->assign(reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_add_pointer:chirp.GetRequest.keys)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>&
+GetRequest::keys() const {
+  // @@protoc_insertion_point(field_list:chirp.GetRequest.keys)
+  return _impl_.keys_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>*
+GetRequest::mutable_keys() {
+  // @@protoc_insertion_point(field_mutable_list:chirp.GetRequest.keys)
+  return &_impl_.keys_;
+}
+
+// uint64 snapshot = 3;
+inline void GetRequest::clear_snapshot() {
+  _impl_.snapshot_ = uint64_t{0u};
+}
+inline uint64_t GetRequest::_internal_snapshot() const {
+  return _impl_.snapshot_;
+}
+inline uint64_t GetRequest::snapshot() const {
+  // @@protoc_insertion_point(field_get:chirp.GetRequest.snapshot)
+  return _internal_snapshot();
+}
+inline void GetRequest::_internal_set_snapshot(uint64_t value) {
+  
+  _impl_.snapshot_ = value;
+}
+inline void GetRequest::set_snapshot(uint64_t value) {
+  _internal_set_snapshot(value);
+  // @@protoc_insertion_point(field_set:chirp.GetRequest.snapshot)
+}
+
+// -------------------------------------------------------------------
+
+// GetReply
+
+// bytes value = 1;
+inline void GetReply::clear_value() {
+  _impl_.value_.ClearToEmpty();
+}
+inline const std::string& GetReply::value() const {
+  // @@protoc_insertion_point(field_get:chirp.GetReply.value)
+  return _internal_value();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void GetReply::set_value(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.value_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:chirp.GetReply.value)
+}
+inline std::string* GetReply::mutable_value() {
+  std::string* _s = _internal_mutable_value();
+  // @@protoc_insertion_point(field_mutable:chirp.GetReply.value)
+  return _s;
+}
+inline const std::string& GetReply::_internal_value() const {
+  return _impl_.value_.Get();
+}
+inline void GetReply::_internal_set_value(const std::string& value) {
+  
+  _impl_.value_.Set(value, GetArenaForAllocation());
+}
+inline std::string* GetReply::_internal_mutable_value() {
+  
+  return _impl_.value_.Mutable(GetArenaForAllocation());
+}
+inline std::string* GetReply::release_value() {
+  // @@protoc_insertion_point(field_release:chirp.GetReply.value)
+  return _impl_.value_.Release();
+}
+inline void GetReply::set_allocated_value(std::string* value) {
+  if (value != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.value_.SetAllocated(value, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.value_.IsDefault()) {
+    _impl_.value_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:chirp.GetReply.value)
+}
+
+// -------------------------------------------------------------------
+
+// DeleteRequest
+
+// bytes key = 1;
+inline void DeleteRequest::clear_key() {
+  _impl_.key_.ClearToEmpty();
+}
+inline const std::string& DeleteRequest::key() const {
+  // @@protoc_insertion_point(field_get:chirp.DeleteRequest.key)
+  return _internal_key();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void DeleteRequest::set_key(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.key_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:chirp.DeleteRequest.key)
+}
+inline std::string* DeleteRequest::mutable_key() {
+  std::string* _s = _internal_mutable_key();
+  // @@protoc_insertion_point(field_mutable:chirp.DeleteRequest.key)
+  return _s;
+}
+inline const std::string& DeleteRequest::_internal_key() const {
+  return _impl_.key_.Get();
+}
+inline void DeleteRequest::_internal_set_key(const std::string& value) {
+  
+  _impl_.key_.Set(value, GetArenaForAllocation());
+}
+inline std::string* DeleteRequest::_internal_mutable_key() {
+  
+  return _impl_.key_.Mutable(GetArenaForAllocation());
+}
+inline std::string* DeleteRequest::release_key() {
+  // @@protoc_insertion_point(field_release:chirp.DeleteRequest.key)
+  return _impl_.key_.Release();
+}
+inline void DeleteRequest::set_allocated_key(std::string* key) {
+  if (key != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.key_.SetAllocated(key, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.key_.IsDefault()) {
+    _impl_.key_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:chirp.DeleteRequest.key)
+}
+
+// -------------------------------------------------------------------
+
+// DeleteReply
+
+// -------------------------------------------------------------------
+
+// MultiPutRequest
+
+// repeated .chirp.PutRequest pairs = 1;
+inline int MultiPutRequest::_internal_pairs_size() const {
+  return _impl_.pairs_.size();
+}
+inline int MultiPutRequest::pairs_size() const {
+  return _internal_pairs_size();
+}
+inline void MultiPutRequest::clear_pairs() {
+  _impl_.pairs_.Clear();
+}
+inline ::chirp::PutRequest* MultiPutRequest::mutable_pairs(int index) {
+  // @@protoc_insertion_point(field_mutable:chirp.MultiPutRequest.pairs)
+  return _impl_.pairs_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::chirp::PutRequest >*
+MultiPutRequest::mutable_pairs() {
+  // @@protoc_insertion_point(field_mutable_list:chirp.MultiPutRequest.pairs)
+  return &_impl_.pairs_;
+}
+inline const ::chirp::PutRequest& MultiPutRequest::_internal_pairs(int index) const {
+  return _impl_.pairs_.Get(index);
+}
+inline const ::chirp::PutRequest& MultiPutRequest::pairs(int index) const {
+  // @@protoc_insertion_point(field_get:chirp.MultiPutRequest.pairs)
+  return _internal_pairs(index);
+}
+inline ::chirp::PutRequest* MultiPutRequest::_internal_add_pairs() {
+  return _impl_.pairs_.Add();
+}
+inline ::chirp::PutRequest* MultiPutRequest::add_pairs() {
+  ::chirp::PutRequest* _add = _internal_add_pairs();
+  // @@protoc_insertion_point(field_add:chirp.MultiPutRequest.pairs)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::chirp::PutRequest >&
+MultiPutRequest::pairs() const {
+  // @@protoc_insertion_point(field_list:chirp.MultiPutRequest.pairs)
+  return _impl_.pairs_;
+}
+
+// -------------------------------------------------------------------
+
+// MultiPutReply
+
+// -------------------------------------------------------------------
+
+// MultiDeleteRequest
+
+// repeated bytes keys = 1;
+inline int MultiDeleteRequest::_internal_keys_size() const {
+  return _impl_.keys_.size();
+}
+inline int MultiDeleteRequest::keys_size() const {
+  return _internal_keys_size();
+}
+inline void MultiDeleteRequest::clear_keys() {
+  _impl_.keys_.Clear();
+}
+inline std::string* MultiDeleteRequest::add_keys() {
+  std::string* _s = _internal_add_keys();
+  // @@protoc_insertion_point(field_add_mutable:chirp.MultiDeleteRequest.keys)
+  return _s;
+}
+inline const std::string& MultiDeleteRequest::_internal_keys(int index) const {
+  return _impl_.keys_.Get(index);
+}
+inline const std::string& MultiDeleteRequest::keys(int index) const {
+  // @@protoc_insertion_point(field_get:chirp.MultiDeleteRequest.keys)
+  return _internal_keys(index);
+}
+inline std::string* MultiDeleteRequest::mutable_keys(int index) {
+  // @@protoc_insertion_point(field_mutable:chirp.MultiDeleteRequest.keys)
+  return _impl_.keys_.Mutable(index);
+}
+inline void MultiDeleteRequest::set_keys(int index, const std::string& value) {
+  _impl_.keys_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set:chirp.MultiDeleteRequest.keys)
+}
+inline void MultiDeleteRequest::set_keys(int index, std::string&& value) {
+  _impl_.keys_.Mutable(index)->assign(std::move(value));
+  // @@protoc_insertion_point(field_set:chirp.MultiDeleteRequest.keys)
+}
+inline void MultiDeleteRequest::set_keys(int index, const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.keys_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set_char:chirp.MultiDeleteRequest.keys)
+}
+inline void MultiDeleteRequest::set_keys(int index, const void* value, size_t size) {
+  _impl_.keys_.Mutable(index)->assign(
+    reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_set_pointer:chirp.MultiDeleteRequest.keys)
+}
+inline std::string* MultiDeleteRequest::_internal_add_keys() {
+  return _impl_.keys_.Add();
+}
+inline void MultiDeleteRequest::add_keys(const std::string& value) {
+  _impl_.keys_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add:chirp.MultiDeleteRequest.keys)
+}
+inline void MultiDeleteRequest::add_keys(std::string&& value) {
+  _impl_.keys_.Add(std::move(value));
+  // @@protoc_insertion_point(field_add:chirp.MultiDeleteRequest.keys)
+}
+inline void MultiDeleteRequest::add_keys(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.keys_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add_char:chirp.MultiDeleteRequest.keys)
+}
+inline void MultiDeleteRequest::add_keys(const void* value, size_t size) {
+  _impl_.keys_.Add()->assign(reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_add_pointer:chirp.MultiDeleteRequest.keys)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>&
+MultiDeleteRequest::keys() const {
+  // @@protoc_insertion_point(field_list:chirp.MultiDeleteRequest.keys)
+  return _impl_.keys_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>*
+MultiDeleteRequest::mutable_keys() {
+  // @@protoc_insertion_point(field_mutable_list:chirp.MultiDeleteRequest.keys)
+  return &_impl_.keys_;
+}
+
+// -------------------------------------------------------------------
+
+// MultiDeleteReply
+
+// uint64 num_of_deleted = 1;
+inline void MultiDeleteReply::clear_num_of_deleted() {
+  _impl_.num_of_deleted_ = uint64_t{0u};
+}
+inline uint64_t MultiDeleteReply::_internal_num_of_deleted() const {
+  return _impl_.num_of_deleted_;
+}
+inline uint64_t MultiDeleteReply::num_of_deleted() const {
+  // @@protoc_insertion_point(field_get:chirp.MultiDeleteReply.num_of_deleted)
+  return _internal_num_of_deleted();
+}
+inline void MultiDeleteReply::_internal_set_num_of_deleted(uint64_t value) {
+  
+  _impl_.num_of_deleted_ = value;
+}
+inline void MultiDeleteReply::set_num_of_deleted(uint64_t value) {
+  _internal_set_num_of_deleted(value);
+  // @@protoc_insertion_point(field_set:chirp.MultiDeleteReply.num_of_deleted)
+}
+
+// -------------------------------------------------------------------
+
+// FetchAddRequest
+
+// bytes key = 1;
+inline void FetchAddRequest::clear_key() {
+  _impl_.key_.ClearToEmpty();
+}
+inline const std::string& FetchAddRequest::key() const {
+  // @@protoc_insertion_point(field_get:chirp.FetchAddRequest.key)
+  return _internal_key();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void FetchAddRequest::set_key(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.key_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:chirp.FetchAddRequest.key)
+}
+inline std::string* FetchAddRequest::mutable_key() {
+  std::string* _s = _internal_mutable_key();
+  // @@protoc_insertion_point(field_mutable:chirp.FetchAddRequest.key)
+  return _s;
+}
+inline const std::string& FetchAddRequest::_internal_key() const {
+  return _impl_.key_.Get();
+}
+inline void FetchAddRequest::_internal_set_key(const std::string& value) {
+  
+  _impl_.key_.Set(value, GetArenaForAllocation());
+}
+inline std::string* FetchAddRequest::_internal_mutable_key() {
+  
+  return _impl_.key_.Mutable(GetArenaForAllocation());
+}
+inline std::string* FetchAddRequest::release_key() {
+  // @@protoc_insertion_point(field_release:chirp.FetchAddRequest.key)
+  return _impl_.key_.Release();
+}
+inline void FetchAddRequest::set_allocated_key(std::string* key) {
+  if (key != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.key_.SetAllocated(key, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.key_.IsDefault()) {
+    _impl_.key_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:chirp.FetchAddRequest.key)
+}
+
+// uint64 delta = 2;
+inline void FetchAddRequest::clear_delta() {
+  _impl_.delta_ = uint64_t{0u};
+}
+inline uint64_t FetchAddRequest::_internal_delta() const {
+  return _impl_.delta_;
+}
+inline uint64_t FetchAddRequest::delta() const {
+  // @@protoc_insertion_point(field_get:chirp.FetchAddRequest.delta)
+  return _internal_delta();
+}
+inline void FetchAddRequest::_internal_set_delta(uint64_t value) {
+  
+  _impl_.delta_ = value;
+}
+inline void FetchAddRequest::set_delta(uint64_t value) {
+  _internal_set_delta(value);
+  // @@protoc_insertion_point(field_set:chirp.FetchAddRequest.delta)
+}
+
+// -------------------------------------------------------------------
+
+// FetchAddReply
+
+// uint64 previous = 1;
+inline void FetchAddReply::clear_previous() {
+  _impl_.previous_ = uint64_t{0u};
+}
+inline uint64_t FetchAddReply::_internal_previous() const {
+  return _impl_.previous_;
+}
+inline uint64_t FetchAddReply::previous() const {
+  // @@protoc_insertion_point(field_get:chirp.FetchAddReply.previous)
+  return _internal_previous();
+}
+inline void FetchAddReply::_internal_set_previous(uint64_t value) {
+  
+  _impl_.previous_ = value;
+}
+inline void FetchAddReply::set_previous(uint64_t value) {
+  _internal_set_previous(value);
+  // @@protoc_insertion_point(field_set:chirp.FetchAddReply.previous)
+}
+
+// -------------------------------------------------------------------
+
+// CompareAndSwapRequest
+
+// bytes key = 1;
+inline void CompareAndSwapRequest::clear_key() {
+  _impl_.key_.ClearToEmpty();
+}
+inline const std::string& CompareAndSwapRequest::key() const {
+  // @@protoc_insertion_point(field_get:chirp.CompareAndSwapRequest.key)
+  return _internal_key();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void CompareAndSwapRequest::set_key(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.key_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:chirp.CompareAndSwapRequest.key)
+}
+inline std::string* CompareAndSwapRequest::mutable_key() {
+  std::string* _s = _internal_mutable_key();
+  // @@protoc_insertion_point(field_mutable:chirp.CompareAndSwapRequest.key)
+  return _s;
+}
+inline const std::string& CompareAndSwapRequest::_internal_key() const {
+  return _impl_.key_.Get();
+}
+inline void CompareAndSwapRequest::_internal_set_key(const std::string& value) {
+  
+  _impl_.key_.Set(value, GetArenaForAllocation());
+}
+inline std::string* CompareAndSwapRequest::_internal_mutable_key() {
+  
+  return _impl_.key_.Mutable(GetArenaForAllocation());
+}
+inline std::string* CompareAndSwapRequest::release_key() {
+  // @@protoc_insertion_point(field_release:chirp.CompareAndSwapRequest.key)
+  return _impl_.key_.Release();
+}
+inline void CompareAndSwapRequest::set_allocated_key(std::string* key) {
+  if (key != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.key_.SetAllocated(key, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.key_.IsDefault()) {
+    _impl_.key_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:chirp.CompareAndSwapRequest.key)
+}
+
+// bytes expected = 2;
+inline void CompareAndSwapRequest::clear_expected() {
+  _impl_.expected_.ClearToEmpty();
+}
+inline const std::string& CompareAndSwapRequest::expected() const {
+  // @@protoc_insertion_point(field_get:chirp.CompareAndSwapRequest.expected)
+  return _internal_expected();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void CompareAndSwapRequest::set_expected(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.expected_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:chirp.CompareAndSwapRequest.expected)
+}
+inline std::string* CompareAndSwapRequest::mutable_expected() {
+  std::string* _s = _internal_mutable_expected();
+  // @@protoc_insertion_point(field_mutable:chirp.CompareAndSwapRequest.expected)
+  return _s;
+}
+inline const std::string& CompareAndSwapRequest::_internal_expected() const {
+  return _impl_.expected_.Get();
+}
+inline void CompareAndSwapRequest::_internal_set_expected(const std::string& value) {
+  
+  _impl_.expected_.Set(value, GetArenaForAllocation());
+}
+inline std::string* CompareAndSwapRequest::_internal_mutable_expected() {
+  
+  return _impl_.expected_.Mutable(GetArenaForAllocation());
+}
+inline std::string* CompareAndSwapRequest::release_expected() {
+  // @@protoc_insertion_point(field_release:chirp.CompareAndSwapRequest.expected)
+  return _impl_.expected_.Release();
+}
+inline void CompareAndSwapRequest::set_allocated_expected(std::string* expected) {
+  if (expected != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.expected_.SetAllocated(expected, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.expected_.IsDefault()) {
+    _impl_.expected_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:chirp.CompareAndSwapRequest.expected)
+}
+
+// bytes desired = 3;
+inline void CompareAndSwapRequest::clear_desired() {
+  _impl_.desired_.ClearToEmpty();
+}
+inline const std::string& CompareAndSwapRequest::desired() const {
+  // @@protoc_insertion_point(field_get:chirp.CompareAndSwapRequest.desired)
+  return _internal_desired();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void CompareAndSwapRequest::set_desired(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.desired_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:chirp.CompareAndSwapRequest.desired)
+}
+inline std::string* CompareAndSwapRequest::mutable_desired() {
+  std::string* _s = _internal_mutable_desired();
+  // @@protoc_insertion_point(field_mutable:chirp.CompareAndSwapRequest.desired)
+  return _s;
+}
+inline const std::string& CompareAndSwapRequest::_internal_desired() const {
+  return _impl_.desired_.Get();
+}
+inline void CompareAndSwapRequest::_internal_set_desired(const std::string& value) {
+  
+  _impl_.desired_.Set(value, GetArenaForAllocation());
+}
+inline std::string* CompareAndSwapRequest::_internal_mutable_desired() {
+  
+  return _impl_.desired_.Mutable(GetArenaForAllocation());
+}
+inline std::string* CompareAndSwapRequest::release_desired() {
+  // @@protoc_insertion_point(field_release:chirp.CompareAndSwapRequest.desired)
+  return _impl_.desired_.Release();
+}
+inline void CompareAndSwapRequest::set_allocated_desired(std::string* desired) {
+  if (desired != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.desired_.SetAllocated(desired, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.desired_.IsDefault()) {
+    _impl_.desired_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:chirp.CompareAndSwapRequest.desired)
+}
+
+// -------------------------------------------------------------------
+
+// CompareAndSwapReply
+
+// bool swapped = 1;
+inline void CompareAndSwapReply::clear_swapped() {
+  _impl_.swapped_ = false;
+}
+inline bool CompareAndSwapReply::_internal_swapped() const {
+  return _impl_.swapped_;
+}
+inline bool CompareAndSwapReply::swapped() const {
+  // @@protoc_insertion_point(field_get:chirp.CompareAndSwapReply.swapped)
+  return _internal_swapped();
+}
+inline void CompareAndSwapReply::_internal_set_swapped(bool value) {
+  
+  _impl_.swapped_ = value;
+}
+inline void CompareAndSwapReply::set_swapped(bool value) {
+  _internal_set_swapped(value);
+  // @@protoc_insertion_point(field_set:chirp.CompareAndSwapReply.swapped)
+}
+
+// bytes actual = 2;
+inline void CompareAndSwapReply::clear_actual() {
+  _impl_.actual_.ClearToEmpty();
+}
+inline const std::string& CompareAndSwapReply::actual() const {
+  // @@protoc_insertion_point(field_get:chirp.CompareAndSwapReply.actual)
+  return _internal_actual();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void CompareAndSwapReply::set_actual(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.actual_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:chirp.CompareAndSwapReply.actual)
+}
+inline std::string* CompareAndSwapReply::mutable_actual() {
+  std::string* _s = _internal_mutable_actual();
+  // @@protoc_insertion_point(field_mutable:chirp.CompareAndSwapReply.actual)
+  return _s;
+}
+inline const std::string& CompareAndSwapReply::_internal_actual() const {
+  return _impl_.actual_.Get();
+}
+inline void CompareAndSwapReply::_internal_set_actual(const std::string& value) {
+  
+  _impl_.actual_.Set(value, GetArenaForAllocation());
+}
+inline std::string* CompareAndSwapReply::_internal_mutable_actual() {
+  
+  return _impl_.actual_.Mutable(GetArenaForAllocation());
+}
+inline std::string* CompareAndSwapReply::release_actual() {
+  // @@protoc_insertion_point(field_release:chirp.CompareAndSwapReply.actual)
+  return _impl_.actual_.Release();
+}
+inline void CompareAndSwapReply::set_allocated_actual(std::string* actual) {
+  if (actual != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.actual_.SetAllocated(actual, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.actual_.IsDefault()) {
+    _impl_.actual_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:chirp.CompareAndSwapReply.actual)
+}
+
+// -------------------------------------------------------------------
+
+// ScanRequest
+
+// bytes start = 1;
+inline void ScanRequest::clear_start() {
+  _impl_.start_.ClearToEmpty();
+}
+inline const std::string& ScanRequest::start() const {
+  // @@protoc_insertion_point(field_get:chirp.ScanRequest.start)
+  return _internal_start();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void ScanRequest::set_start(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.start_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:chirp.ScanRequest.start)
+}
+inline std::string* ScanRequest::mutable_start() {
+  std::string* _s = _internal_mutable_start();
+  // @@protoc_insertion_point(field_mutable:chirp.ScanRequest.start)
+  return _s;
+}
+inline const std::string& ScanRequest::_internal_start() const {
+  return _impl_.start_.Get();
+}
+inline void ScanRequest::_internal_set_start(const std::string& value) {
+  
+  _impl_.start_.Set(value, GetArenaForAllocation());
+}
+inline std::string* ScanRequest::_internal_mutable_start() {
+  
+  return _impl_.start_.Mutable(GetArenaForAllocation());
+}
+inline std::string* ScanRequest::release_start() {
+  // @@protoc_insertion_point(field_release:chirp.ScanRequest.start)
+  return _impl_.start_.Release();
+}
+inline void ScanRequest::set_allocated_start(std::string* start) {
+  if (start != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.start_.SetAllocated(start, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.start_.IsDefault()) {
+    _impl_.start_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:chirp.ScanRequest.start)
+}
+
+// bytes end = 2;
+inline void ScanRequest::clear_end() {
+  _impl_.end_.ClearToEmpty();
+}
+inline const std::string& ScanRequest::end() const {
+  // @@protoc_insertion_point(field_get:chirp.ScanRequest.end)
+  return _internal_end();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void ScanRequest::set_end(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.end_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:chirp.ScanRequest.end)
+}
+inline std::string* ScanRequest::mutable_end() {
+  std::string* _s = _internal_mutable_end();
+  // @@protoc_insertion_point(field_mutable:chirp.ScanRequest.end)
+  return _s;
+}
+inline const std::string& ScanRequest::_internal_end() const {
+  return _impl_.end_.Get();
+}
+inline void ScanRequest::_internal_set_end(const std::string& value) {
+  
+  _impl_.end_.Set(value, GetArenaForAllocation());
+}
+inline std::string* ScanRequest::_internal_mutable_end() {
+  
+  return _impl_.end_.Mutable(GetArenaForAllocation());
+}
+inline std::string* ScanRequest::release_end() {
+  // @@protoc_insertion_point(field_release:chirp.ScanRequest.end)
+  return _impl_.end_.Release();
+}
+inline void ScanRequest::set_allocated_end(std::string* end) {
+  if (end != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.end_.SetAllocated(end, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.end_.IsDefault()) {
+    _impl_.end_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:chirp.ScanRequest.end)
+}
+
+// uint64 limit = 3;
+inline void ScanRequest::clear_limit() {
+  _impl_.limit_ = uint64_t{0u};
+}
+inline uint64_t ScanRequest::_internal_limit() const {
+  return _impl_.limit_;
+}
+inline uint64_t ScanRequest::limit() const {
+  // @@protoc_insertion_point(field_get:chirp.ScanRequest.limit)
+  return _internal_limit();
+}
+inline void ScanRequest::_internal_set_limit(uint64_t value) {
+  
+  _impl_.limit_ = value;
+}
+inline void ScanRequest::set_limit(uint64_t value) {
+  _internal_set_limit(value);
+  // @@protoc_insertion_point(field_set:chirp.ScanRequest.limit)
+}
+
+// -------------------------------------------------------------------
+
+// ScanReply
+
+// repeated .chirp.PutRequest pairs = 1;
+inline int ScanReply::_internal_pairs_size() const {
+  return _impl_.pairs_.size();
+}
+inline int ScanReply::pairs_size() const {
+  return _internal_pairs_size();
+}
+inline void ScanReply::clear_pairs() {
+  _impl_.pairs_.Clear();
+}
+inline ::chirp::PutRequest* ScanReply::mutable_pairs(int index) {
+  // @@protoc_insertion_point(field_mutable:chirp.ScanReply.pairs)
+  return _impl_.pairs_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::chirp::PutRequest >*
+ScanReply::mutable_pairs() {
+  // @@protoc_insertion_point(field_mutable_list:chirp.ScanReply.pairs)
+  return &_impl_.pairs_;
+}
+inline const ::chirp::PutRequest& ScanReply::_internal_pairs(int index) const {
+  return _impl_.pairs_.Get(index);
+}
+inline const ::chirp::PutRequest& ScanReply::pairs(int index) const {
+  // @@protoc_insertion_point(field_get:chirp.ScanReply.pairs)
+  return _internal_pairs(index);
+}
+inline ::chirp::PutRequest* ScanReply::_internal_add_pairs() {
+  return _impl_.pairs_.Add();
+}
+inline ::chirp::PutRequest* ScanReply::add_pairs() {
+  ::chirp::PutRequest* _add = _internal_add_pairs();
+  // @@protoc_insertion_point(field_add:chirp.ScanReply.pairs)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::chirp::PutRequest >&
+ScanReply::pairs() const {
+  // @@protoc_insertion_point(field_list:chirp.ScanReply.pairs)
+  return _impl_.pairs_;
+}
+
+// -------------------------------------------------------------------
+
+// ListElementRequest
+
+// bytes key = 1;
+inline void ListElementRequest::clear_key() {
+  _impl_.key_.ClearToEmpty();
+}
+inline const std::string& ListElementRequest::key() const {
+  // @@protoc_insertion_point(field_get:chirp.ListElementRequest.key)
+  return _internal_key();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void ListElementRequest::set_key(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.key_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:chirp.ListElementRequest.key)
+}
+inline std::string* ListElementRequest::mutable_key() {
+  std::string* _s = _internal_mutable_key();
+  // @@protoc_insertion_point(field_mutable:chirp.ListElementRequest.key)
+  return _s;
+}
+inline const std::string& ListElementRequest::_internal_key() const {
+  return _impl_.key_.Get();
+}
+inline void ListElementRequest::_internal_set_key(const std::string& value) {
+  
+  _impl_.key_.Set(value, GetArenaForAllocation());
+}
+inline std::string* ListElementRequest::_internal_mutable_key() {
+  
+  return _impl_.key_.Mutable(GetArenaForAllocation());
+}
+inline std::string* ListElementRequest::release_key() {
+  // @@protoc_insertion_point(field_release:chirp.ListElementRequest.key)
+  return _impl_.key_.Release();
+}
+inline void ListElementRequest::set_allocated_key(std::string* key) {
+  if (key != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.key_.SetAllocated(key, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.key_.IsDefault()) {
+    _impl_.key_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:chirp.ListElementRequest.key)
+}
+
+// uint32 field = 2;
+inline void ListElementRequest::clear_field() {
+  _impl_.field_ = 0u;
+}
+inline uint32_t ListElementRequest::_internal_field() const {
+  return _impl_.field_;
+}
+inline uint32_t ListElementRequest::field() const {
+  // @@protoc_insertion_point(field_get:chirp.ListElementRequest.field)
+  return _internal_field();
+}
+inline void ListElementRequest::_internal_set_field(uint32_t value) {
+  
+  _impl_.field_ = value;
+}
+inline void ListElementRequest::set_field(uint32_t value) {
+  _internal_set_field(value);
+  // @@protoc_insertion_point(field_set:chirp.ListElementRequest.field)
+}
+
+// uint64 uint64_element = 3;
+inline bool ListElementRequest::_internal_has_uint64_element() const {
+  return element_case() == kUint64Element;
+}
+inline bool ListElementRequest::has_uint64_element() const {
+  return _internal_has_uint64_element();
+}
+inline void ListElementRequest::set_has_uint64_element() {
+  _impl_._oneof_case_[0] = kUint64Element;
+}
+inline void ListElementRequest::clear_uint64_element() {
+  if (_internal_has_uint64_element()) {
+    _impl_.element_.uint64_element_ = uint64_t{0u};
+    clear_has_element();
+  }
+}
+inline uint64_t ListElementRequest::_internal_uint64_element() const {
+  if (_internal_has_uint64_element()) {
+    return _impl_.element_.uint64_element_;
+  }
+  return uint64_t{0u};
+}
+inline void ListElementRequest::_internal_set_uint64_element(uint64_t value) {
+  if (!_internal_has_uint64_element()) {
+    clear_element();
+    set_has_uint64_element();
+  }
+  _impl_.element_.uint64_element_ = value;
+}
+inline uint64_t ListElementRequest::uint64_element() const {
+  // @@protoc_insertion_point(field_get:chirp.ListElementRequest.uint64_element)
+  return _internal_uint64_element();
+}
+inline void ListElementRequest::set_uint64_element(uint64_t value) {
+  _internal_set_uint64_element(value);
+  // @@protoc_insertion_point(field_set:chirp.ListElementRequest.uint64_element)
+}
+
+// bytes string_element = 4;
+inline bool ListElementRequest::_internal_has_string_element() const {
+  return element_case() == kStringElement;
+}
+inline bool ListElementRequest::has_string_element() const {
+  return _internal_has_string_element();
+}
+inline void ListElementRequest::set_has_string_element() {
+  _impl_._oneof_case_[0] = kStringElement;
+}
+inline void ListElementRequest::clear_string_element() {
+  if (_internal_has_string_element()) {
+    _impl_.element_.string_element_.Destroy();
+    clear_has_element();
+  }
+}
+inline const std::string& ListElementRequest::string_element() const {
+  // @@protoc_insertion_point(field_get:chirp.ListElementRequest.string_element)
+  return _internal_string_element();
+}
+template <typename ArgT0, typename... ArgT>
+inline void ListElementRequest::set_string_element(ArgT0&& arg0, ArgT... args) {
+  if (!_internal_has_string_element()) {
+    clear_element();
+    set_has_string_element();
+    _impl_.element_.string_element_.InitDefault();
+  }
+  _impl_.element_.string_element_.SetBytes( static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:chirp.ListElementRequest.string_element)
+}
+inline std::string* ListElementRequest::mutable_string_element() {
+  std::string* _s = _internal_mutable_string_element();
+  // @@protoc_insertion_point(field_mutable:chirp.ListElementRequest.string_element)
+  return _s;
+}
+inline const std::string& ListElementRequest::_internal_string_element() const {
+  if (_internal_has_string_element()) {
+    return _impl_.element_.string_element_.Get();
+  }
+  return ::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited();
+}
+inline void ListElementRequest::_internal_set_string_element(const std::string& value) {
+  if (!_internal_has_string_element()) {
+    clear_element();
+    set_has_string_element();
+    _impl_.element_.string_element_.InitDefault();
+  }
+  _impl_.element_.string_element_.Set(value, GetArenaForAllocation());
+}
+inline std::string* ListElementRequest::_internal_mutable_string_element() {
+  if (!_internal_has_string_element()) {
+    clear_element();
+    set_has_string_element();
+    _impl_.element_.string_element_.InitDefault();
+  }
+  return _impl_.element_.string_element_.Mutable(      GetArenaForAllocation());
+}
+inline std::string* ListElementRequest::release_string_element() {
+  // @@protoc_insertion_point(field_release:chirp.ListElementRequest.string_element)
+  if (_internal_has_string_element()) {
+    clear_has_element();
+    return _impl_.element_.string_element_.Release();
+  } else {
+    return nullptr;
+  }
+}
+inline void ListElementRequest::set_allocated_string_element(std::string* string_element) {
+  if (has_element()) {
+    clear_element();
+  }
+  if (string_element != nullptr) {
+    set_has_string_element();
+    _impl_.element_.string_element_.InitAllocated(string_element, GetArenaForAllocation());
+  }
+  // @@protoc_insertion_point(field_set_allocated:chirp.ListElementRequest.string_element)
+}
+
+// bool if_absent = 5;
+inline void ListElementRequest::clear_if_absent() {
+  _impl_.if_absent_ = false;
+}
+inline bool ListElementRequest::_internal_if_absent() const {
+  return _impl_.if_absent_;
+}
+inline bool ListElementRequest::if_absent() const {
+  // @@protoc_insertion_point(field_get:chirp.ListElementRequest.if_absent)
+  return _internal_if_absent();
+}
+inline void ListElementRequest::_internal_set_if_absent(bool value) {
+  
+  _impl_.if_absent_ = value;
+}
+inline void ListElementRequest::set_if_absent(bool value) {
+  _internal_set_if_absent(value);
+  // @@protoc_insertion_point(field_set:chirp.ListElementRequest.if_absent)
+}
+
+// bool if_exists = 6;
+inline void ListElementRequest::clear_if_exists() {
+  _impl_.if_exists_ = false;
+}
+inline bool ListElementRequest::_internal_if_exists() const {
+  return _impl_.if_exists_;
+}
+inline bool ListElementRequest::if_exists() const {
+  // @@protoc_insertion_point(field_get:chirp.ListElementRequest.if_exists)
+  return _internal_if_exists();
+}
+inline void ListElementRequest::_internal_set_if_exists(bool value) {
+  
+  _impl_.if_exists_ = value;
+}
+inline void ListElementRequest::set_if_exists(bool value) {
+  _internal_set_if_exists(value);
+  // @@protoc_insertion_point(field_set:chirp.ListElementRequest.if_exists)
+}
+
+inline bool ListElementRequest::has_element() const {
+  return element_case() != ELEMENT_NOT_SET;
+}
+inline void ListElementRequest::clear_has_element() {
+  _impl_._oneof_case_[0] = ELEMENT_NOT_SET;
+}
+inline ListElementRequest::ElementCase ListElementRequest::element_case() const {
+  return ListElementRequest::ElementCase(_impl_._oneof_case_[0]);
+}
+// -------------------------------------------------------------------
+
+// ListElementReply
+
+// bool changed = 1;
+inline void ListElementReply::clear_changed() {
+  _impl_.changed_ = false;
+}
+inline bool ListElementReply::_internal_changed() const {
+  return _impl_.changed_;
+}
+inline bool ListElementReply::changed() const {
+  // @@protoc_insertion_point(field_get:chirp.ListElementReply.changed)
+  return _internal_changed();
+}
+inline void ListElementReply::_internal_set_changed(bool value) {
+  
+  _impl_.changed_ = value;
+}
+inline void ListElementReply::set_changed(bool value) {
+  _internal_set_changed(value);
+  // @@protoc_insertion_point(field_set:chirp.ListElementReply.changed)
+}
+
+// -------------------------------------------------------------------
+
+// MemoryUsageRequest
+
+// -------------------------------------------------------------------
+
+// PrefixUsage
+
+// bytes prefix = 1;
+inline void PrefixUsage::clear_prefix() {
+  _impl_.prefix_.ClearToEmpty();
+}
+inline const std::string& PrefixUsage::prefix() const {
+  // @@protoc_insertion_point(field_get:chirp.PrefixUsage.prefix)
+  return _internal_prefix();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void PrefixUsage::set_prefix(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.prefix_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:chirp.PrefixUsage.prefix)
+}
+inline std::string* PrefixUsage::mutable_prefix() {
+  std::string* _s = _internal_mutable_prefix();
+  // @@protoc_insertion_point(field_mutable:chirp.PrefixUsage.prefix)
+  return _s;
+}
+inline const std::string& PrefixUsage::_internal_prefix() const {
+  return _impl_.prefix_.Get();
+}
+inline void PrefixUsage::_internal_set_prefix(const std::string& value) {
+  
+  _impl_.prefix_.Set(value, GetArenaForAllocation());
+}
+inline std::string* PrefixUsage::_internal_mutable_prefix() {
+  
+  return _impl_.prefix_.Mutable(GetArenaForAllocation());
+}
+inline std::string* PrefixUsage::release_prefix() {
+  // @@protoc_insertion_point(field_release:chirp.PrefixUsage.prefix)
+  return _impl_.prefix_.Release();
+}
+inline void PrefixUsage::set_allocated_prefix(std::string* prefix) {
+  if (prefix != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.prefix_.SetAllocated(prefix, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.prefix_.IsDefault()) {
+    _impl_.prefix_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:chirp.PrefixUsage.prefix)
+}
+
+// uint64 num_of_keys = 2;
+inline void PrefixUsage::clear_num_of_keys() {
+  _impl_.num_of_keys_ = uint64_t{0u};
+}
+inline uint64_t PrefixUsage::_internal_num_of_keys() const {
+  return _impl_.num_of_keys_;
+}
+inline uint64_t PrefixUsage::num_of_keys() const {
+  // @@protoc_insertion_point(field_get:chirp.PrefixUsage.num_of_keys)
+  return _internal_num_of_keys();
+}
+inline void PrefixUsage::_internal_set_num_of_keys(uint64_t value) {
+  
+  _impl_.num_of_keys_ = value;
+}
+inline void PrefixUsage::set_num_of_keys(uint64_t value) {
+  _internal_set_num_of_keys(value);
+  // @@protoc_insertion_point(field_set:chirp.PrefixUsage.num_of_keys)
+}
+
+// uint64 bytes = 3;
+inline void PrefixUsage::clear_bytes() {
+  _impl_.bytes_ = uint64_t{0u};
+}
+inline uint64_t PrefixUsage::_internal_bytes() const {
+  return _impl_.bytes_;
+}
+inline uint64_t PrefixUsage::bytes() const {
+  // @@protoc_insertion_point(field_get:chirp.PrefixUsage.bytes)
+  return _internal_bytes();
+}
+inline void PrefixUsage::_internal_set_bytes(uint64_t value) {
+  
+  _impl_.bytes_ = value;
+}
+inline void PrefixUsage::set_bytes(uint64_t value) {
+  _internal_set_bytes(value);
+  // @@protoc_insertion_point(field_set:chirp.PrefixUsage.bytes)
+}
+
+// -------------------------------------------------------------------
+
+// MemoryUsageReply
+
+// uint64 bytes_used = 1;
+inline void MemoryUsageReply::clear_bytes_used() {
+  _impl_.bytes_used_ = uint64_t{0u};
+}
+inline uint64_t MemoryUsageReply::_internal_bytes_used() const {
+  return _impl_.bytes_used_;
+}
+inline uint64_t MemoryUsageReply::bytes_used() const {
+  // @@protoc_insertion_point(field_get:chirp.MemoryUsageReply.bytes_used)
+  return _internal_bytes_used();
+}
+inline void MemoryUsageReply::_internal_set_bytes_used(uint64_t value) {
+  
+  _impl_.bytes_used_ = value;
+}
+inline void MemoryUsageReply::set_bytes_used(uint64_t value) {
+  _internal_set_bytes_used(value);
+  // @@protoc_insertion_point(field_set:chirp.MemoryUsageReply.bytes_used)
+}
+
+// uint64 memory_limit = 2;
+inline void MemoryUsageReply::clear_memory_limit() {
+  _impl_.memory_limit_ = uint64_t{0u};
+}
+inline uint64_t MemoryUsageReply::_internal_memory_limit() const {
+  return _impl_.memory_limit_;
+}
+inline uint64_t MemoryUsageReply::memory_limit() const {
+  // @@protoc_insertion_point(field_get:chirp.MemoryUsageReply.memory_limit)
+  return _internal_memory_limit();
+}
+inline void MemoryUsageReply::_internal_set_memory_limit(uint64_t value) {
+  
+  _impl_.memory_limit_ = value;
+}
+inline void MemoryUsageReply::set_memory_limit(uint64_t value) {
+  _internal_set_memory_limit(value);
+  // @@protoc_insertion_point(field_set:chirp.MemoryUsageReply.memory_limit)
+}
+
+// repeated .chirp.PrefixUsage prefixes = 3;
+inline int MemoryUsageReply::_internal_prefixes_size() const {
+  return _impl_.prefixes_.size();
+}
+inline int MemoryUsageReply::prefixes_size() const {
+  return _internal_prefixes_size();
+}
+inline void MemoryUsageReply::clear_prefixes() {
+  _impl_.prefixes_.Clear();
+}
+inline ::chirp::PrefixUsage* MemoryUsageReply::mutable_prefixes(int index) {
+  // @@protoc_insertion_point(field_mutable:chirp.MemoryUsageReply.prefixes)
+  return _impl_.prefixes_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::chirp::PrefixUsage >*
+MemoryUsageReply::mutable_prefixes() {
+  // @@protoc_insertion_point(field_mutable_list:chirp.MemoryUsageReply.prefixes)
+  return &_impl_.prefixes_;
+}
+inline const ::chirp::PrefixUsage& MemoryUsageReply::_internal_prefixes(int index) const {
+  return _impl_.prefixes_.Get(index);
+}
+inline const ::chirp::PrefixUsage& MemoryUsageReply::prefixes(int index) const {
+  // @@protoc_insertion_point(field_get:chirp.MemoryUsageReply.prefixes)
+  return _internal_prefixes(index);
+}
+inline ::chirp::PrefixUsage* MemoryUsageReply::_internal_add_prefixes() {
+  return _impl_.prefixes_.Add();
+}
+inline ::chirp::PrefixUsage* MemoryUsageReply::add_prefixes() {
+  ::chirp::PrefixUsage* _add = _internal_add_prefixes();
+  // @@protoc_insertion_point(field_add:chirp.MemoryUsageReply.prefixes)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::chirp::PrefixUsage >&
+MemoryUsageReply::prefixes() const {
+  // @@protoc_insertion_point(field_list:chirp.MemoryUsageReply.prefixes)
+  return _impl_.prefixes_;
+}
+
+// string storage = 4;
+inline void MemoryUsageReply::clear_storage() {
+  _impl_.storage_.ClearToEmpty();
+}
+inline const std::string& MemoryUsageReply::storage() const {
+  // @@protoc_insertion_point(field_get:chirp.MemoryUsageReply.storage)
+  return _internal_storage();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void MemoryUsageReply::set_storage(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.storage_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:chirp.MemoryUsageReply.storage)
+}
+inline std::string* MemoryUsageReply::mutable_storage() {
+  std::string* _s = _internal_mutable_storage();
+  // @@protoc_insertion_point(field_mutable:chirp.MemoryUsageReply.storage)
+  return _s;
+}
+inline const std::string& MemoryUsageReply::_internal_storage() const {
+  return _impl_.storage_.Get();
+}
+inline void MemoryUsageReply::_internal_set_storage(const std::string& value) {
+  
+  _impl_.storage_.Set(value, GetArenaForAllocation());
+}
+inline std::string* MemoryUsageReply::_internal_mutable_storage() {
+  
+  return _impl_.storage_.Mutable(GetArenaForAllocation());
+}
+inline std::string* MemoryUsageReply::release_storage() {
+  // @@protoc_insertion_point(field_release:chirp.MemoryUsageReply.storage)
+  return _impl_.storage_.Release();
+}
+inline void MemoryUsageReply::set_allocated_storage(std::string* storage) {
+  if (storage != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.storage_.SetAllocated(storage, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.storage_.IsDefault()) {
+    _impl_.storage_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:chirp.MemoryUsageReply.storage)
+}
+
+// -------------------------------------------------------------------
+
+// StatsRequest
+
+// -------------------------------------------------------------------
+
+// OperationStats
+
+// string operation = 1;
+inline void OperationStats::clear_operation() {
+  _impl_.operation_.ClearToEmpty();
+}
+inline const std::string& OperationStats::operation() const {
+  // @@protoc_insertion_point(field_get:chirp.OperationStats.operation)
+  return _internal_operation();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void OperationStats::set_operation(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.operation_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:chirp.OperationStats.operation)
+}
+inline std::string* OperationStats::mutable_operation() {
+  std::string* _s = _internal_mutable_operation();
+  // @@protoc_insertion_point(field_mutable:chirp.OperationStats.operation)
+  return _s;
+}
+inline const std::string& OperationStats::_internal_operation() const {
+  return _impl_.operation_.Get();
+}
+inline void OperationStats::_internal_set_operation(const std::string& value) {
+  
+  _impl_.operation_.Set(value, GetArenaForAllocation());
+}
+inline std::string* OperationStats::_internal_mutable_operation() {
+  
+  return _impl_.operation_.Mutable(GetArenaForAllocation());
+}
+inline std::string* OperationStats::release_operation() {
+  // @@protoc_insertion_point(field_release:chirp.OperationStats.operation)
+  return _impl_.operation_.Release();
+}
+inline void OperationStats::set_allocated_operation(std::string* operation) {
+  if (operation != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.operation_.SetAllocated(operation, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.operation_.IsDefault()) {
+    _impl_.operation_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:chirp.OperationStats.operation)
+}
+
+// uint64 count = 2;
+inline void OperationStats::clear_count() {
+  _impl_.count_ = uint64_t{0u};
+}
+inline uint64_t OperationStats::_internal_count() const {
+  return _impl_.count_;
+}
+inline uint64_t OperationStats::count() const {
+  // @@protoc_insertion_point(field_get:chirp.OperationStats.count)
+  return _internal_count();
+}
+inline void OperationStats::_internal_set_count(uint64_t value) {
+  
+  _impl_.count_ = value;
+}
+inline void OperationStats::set_count(uint64_t value) {
+  _internal_set_count(value);
+  // @@protoc_insertion_point(field_set:chirp.OperationStats.count)
+}
+
+// uint64 mean_ns = 3;
+inline void OperationStats::clear_mean_ns() {
+  _impl_.mean_ns_ = uint64_t{0u};
+}
+inline uint64_t OperationStats::_internal_mean_ns() const {
+  return _impl_.mean_ns_;
+}
+inline uint64_t OperationStats::mean_ns() const {
+  // @@protoc_insertion_point(field_get:chirp.OperationStats.mean_ns)
+  return _internal_mean_ns();
+}
+inline void OperationStats::_internal_set_mean_ns(uint64_t value) {
+  
+  _impl_.mean_ns_ = value;
+}
+inline void OperationStats::set_mean_ns(uint64_t value) {
+  _internal_set_mean_ns(value);
+  // @@protoc_insertion_point(field_set:chirp.OperationStats.mean_ns)
+}
+
+// uint64 p50_ns = 4;
+inline void OperationStats::clear_p50_ns() {
+  _impl_.p50_ns_ = uint64_t{0u};
+}
+inline uint64_t OperationStats::_internal_p50_ns() const {
+  return _impl_.p50_ns_;
+}
+inline uint64_t OperationStats::p50_ns() const {
+  // @@protoc_insertion_point(field_get:chirp.OperationStats.p50_ns)
+  return _internal_p50_ns();
+}
+inline void OperationStats::_internal_set_p50_ns(uint64_t value) {
+  
+  _impl_.p50_ns_ = value;
+}
+inline void OperationStats::set_p50_ns(uint64_t value) {
+  _internal_set_p50_ns(value);
+  // @@protoc_insertion_point(field_set:chirp.OperationStats.p50_ns)
+}
+
+// uint64 p90_ns = 5;
+inline void OperationStats::clear_p90_ns() {
+  _impl_.p90_ns_ = uint64_t{0u};
+}
+inline uint64_t OperationStats::_internal_p90_ns() const {
+  return _impl_.p90_ns_;
+}
+inline uint64_t OperationStats::p90_ns() const {
+  // @@protoc_insertion_point(field_get:chirp.OperationStats.p90_ns)
+  return _internal_p90_ns();
+}
+inline void OperationStats::_internal_set_p90_ns(uint64_t value) {
+  
+  _impl_.p90_ns_ = value;
+}
+inline void OperationStats::set_p90_ns(uint64_t value) {
+  _internal_set_p90_ns(value);
+  // @@protoc_insertion_point(field_set:chirp.OperationStats.p90_ns)
+}
+
+// uint64 p99_ns = 6;
+inline void OperationStats::clear_p99_ns() {
+  _impl_.p99_ns_ = uint64_t{0u};
+}
+inline uint64_t OperationStats::_internal_p99_ns() const {
+  return _impl_.p99_ns_;
+}
+inline uint64_t OperationStats::p99_ns() const {
+  // @@protoc_insertion_point(field_get:chirp.OperationStats.p99_ns)
+  return _internal_p99_ns();
+}
+inline void OperationStats::_internal_set_p99_ns(uint64_t value) {
+  
+  _impl_.p99_ns_ = value;
+}
+inline void OperationStats::set_p99_ns(uint64_t value) {
+  _internal_set_p99_ns(value);
+  // @@protoc_insertion_point(field_set:chirp.OperationStats.p99_ns)
+}
+
+// uint64 p999_ns = 7;
+inline void OperationStats::clear_p999_ns() {
+  _impl_.p999_ns_ = uint64_t{0u};
+}
+inline uint64_t OperationStats::_internal_p999_ns() const {
+  return _impl_.p999_ns_;
+}
+inline uint64_t OperationStats::p999_ns() const {
+  // @@protoc_insertion_point(field_get:chirp.OperationStats.p999_ns)
+  return _internal_p999_ns();
+}
+inline void OperationStats::_internal_set_p999_ns(uint64_t value) {
+  
+  _impl_.p999_ns_ = value;
+}
+inline void OperationStats::set_p999_ns(uint64_t value) {
+  _internal_set_p999_ns(value);
+  // @@protoc_insertion_point(field_set:chirp.OperationStats.p999_ns)
+}
+
+// uint64 max_ns = 8;
+inline void OperationStats::clear_max_ns() {
+  _impl_.max_ns_ = uint64_t{0u};
+}
+inline uint64_t OperationStats::_internal_max_ns() const {
+  return _impl_.max_ns_;
+}
+inline uint64_t OperationStats::max_ns() const {
+  // @@protoc_insertion_point(field_get:chirp.OperationStats.max_ns)
+  return _internal_max_ns();
+}
+inline void OperationStats::_internal_set_max_ns(uint64_t value) {
+  
+  _impl_.max_ns_ = value;
+}
+inline void OperationStats::set_max_ns(uint64_t value) {
+  _internal_set_max_ns(value);
+  // @@protoc_insertion_point(field_set:chirp.OperationStats.max_ns)
+}
+
+// -------------------------------------------------------------------
+
+// StatsReply
+
+// repeated .chirp.OperationStats operations = 1;
+inline int StatsReply::_internal_operations_size() const {
+  return _impl_.operations_.size();
+}
+inline int StatsReply::operations_size() const {
+  return _internal_operations_size();
+}
+inline void StatsReply::clear_operations() {
+  _impl_.operations_.Clear();
+}
+inline ::chirp::OperationStats* StatsReply::mutable_operations(int index) {
+  // @@protoc_insertion_point(field_mutable:chirp.StatsReply.operations)
+  return _impl_.operations_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::chirp::OperationStats >*
+StatsReply::mutable_operations() {
+  // @@protoc_insertion_point(field_mutable_list:chirp.StatsReply.operations)
+  return &_impl_.operations_;
+}
+inline const ::chirp::OperationStats& StatsReply::_internal_operations(int index) const {
+  return _impl_.operations_.Get(index);
+}
+inline const ::chirp::OperationStats& StatsReply::operations(int index) const {
+  // @@protoc_insertion_point(field_get:chirp.StatsReply.operations)
+  return _internal_operations(index);
+}
+inline ::chirp::OperationStats* StatsReply::_internal_add_operations() {
+  return _impl_.operations_.Add();
+}
+inline ::chirp::OperationStats* StatsReply::add_operations() {
+  ::chirp::OperationStats* _add = _internal_add_operations();
+  // @@protoc_insertion_point(field_add:chirp.StatsReply.operations)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::chirp::OperationStats >&
+StatsReply::operations() const {
+  // @@protoc_insertion_point(field_list:chirp.StatsReply.operations)
+  return _impl_.operations_;
+}
+
+// uint64 lock_contentions = 2;
+inline void StatsReply::clear_lock_contentions() {
+  _impl_.lock_contentions_ = uint64_t{0u};
+}
+inline uint64_t StatsReply::_internal_lock_contentions() const {
+  return _impl_.lock_contentions_;
+}
+inline uint64_t StatsReply::lock_contentions() const {
+  // @@protoc_insertion_point(field_get:chirp.StatsReply.lock_contentions)
+  return _internal_lock_contentions();
+}
+inline void StatsReply::_internal_set_lock_contentions(uint64_t value) {
+  
+  _impl_.lock_contentions_ = value;
+}
+inline void StatsReply::set_lock_contentions(uint64_t value) {
+  _internal_set_lock_contentions(value);
+  // @@protoc_insertion_point(field_set:chirp.StatsReply.lock_contentions)
+}
+
+// uint64 lock_wait_ns = 3;
+inline void StatsReply::clear_lock_wait_ns() {
+  _impl_.lock_wait_ns_ = uint64_t{0u};
+}
+inline uint64_t StatsReply::_internal_lock_wait_ns() const {
+  return _impl_.lock_wait_ns_;
+}
+inline uint64_t StatsReply::lock_wait_ns() const {
+  // @@protoc_insertion_point(field_get:chirp.StatsReply.lock_wait_ns)
+  return _internal_lock_wait_ns();
+}
+inline void StatsReply::_internal_set_lock_wait_ns(uint64_t value) {
+  
+  _impl_.lock_wait_ns_ = value;
+}
+inline void StatsReply::set_lock_wait_ns(uint64_t value) {
+  _internal_set_lock_wait_ns(value);
+  // @@protoc_insertion_point(field_set:chirp.StatsReply.lock_wait_ns)
+}
+
+// uint64 bytes_used = 4;
+inline void StatsReply::clear_bytes_used() {
+  _impl_.bytes_used_ = uint64_t{0u};
+}
+inline uint64_t StatsReply::_internal_bytes_used() const {
+  return _impl_.bytes_used_;
+}
+inline uint64_t StatsReply::bytes_used() const {
+  // @@protoc_insertion_point(field_get:chirp.StatsReply.bytes_used)
+  return _internal_bytes_used();
+}
+inline void StatsReply::_internal_set_bytes_used(uint64_t value) {
+  
+  _impl_.bytes_used_ = value;
+}
+inline void StatsReply::set_bytes_used(uint64_t value) {
+  _internal_set_bytes_used(value);
+  // @@protoc_insertion_point(field_set:chirp.StatsReply.bytes_used)
+}
+
+// repeated .chirp.PrefixUsage prefixes = 5;
+inline int StatsReply::_internal_prefixes_size() const {
+  return _impl_.prefixes_.size();
+}
+inline int StatsReply::prefixes_size() const {
+  return _internal_prefixes_size();
+}
+inline void StatsReply::clear_prefixes() {
+  _impl_.prefixes_.Clear();
+}
+inline ::chirp::PrefixUsage* StatsReply::mutable_prefixes(int index) {
+  // @@protoc_insertion_point(field_mutable:chirp.StatsReply.prefixes)
+  return _impl_.prefixes_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::chirp::PrefixUsage >*
+StatsReply::mutable_prefixes() {
+  // @@protoc_insertion_point(field_mutable_list:chirp.StatsReply.prefixes)
+  return &_impl_.prefixes_;
+}
+inline const ::chirp::PrefixUsage& StatsReply::_internal_prefixes(int index) const {
+  return _impl_.prefixes_.Get(index);
+}
+inline const ::chirp::PrefixUsage& StatsReply::prefixes(int index) const {
+  // @@protoc_insertion_point(field_get:chirp.StatsReply.prefixes)
+  return _internal_prefixes(index);
+}
+inline ::chirp::PrefixUsage* StatsReply::_internal_add_prefixes() {
+  return _impl_.prefixes_.Add();
+}
+inline ::chirp::PrefixUsage* StatsReply::add_prefixes() {
+  ::chirp::PrefixUsage* _add = _internal_add_prefixes();
+  // @@protoc_insertion_point(field_add:chirp.StatsReply.prefixes)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::chirp::PrefixUsage >&
+StatsReply::prefixes() const {
+  // @@protoc_insertion_point(field_list:chirp.StatsReply.prefixes)
+  return _impl_.prefixes_;
+}
+
+// uint64 num_of_backups = 6;
+inline void StatsReply::clear_num_of_backups() {
+  _impl_.num_of_backups_ = uint64_t{0u};
+}
+inline uint64_t StatsReply::_internal_num_of_backups() const {
+  return _impl_.num_of_backups_;
+}
+inline uint64_t StatsReply::num_of_backups() const {
+  // @@protoc_insertion_point(field_get:chirp.StatsReply.num_of_backups)
+  return _internal_num_of_backups();
+}
+inline void StatsReply::_internal_set_num_of_backups(uint64_t value) {
+  
+  _impl_.num_of_backups_ = value;
+}
+inline void StatsReply::set_num_of_backups(uint64_t value) {
+  _internal_set_num_of_backups(value);
+  // @@protoc_insertion_point(field_set:chirp.StatsReply.num_of_backups)
+}
+
+// uint64 num_of_backups_in_sync = 7;
+inline void StatsReply::clear_num_of_backups_in_sync() {
+  _impl_.num_of_backups_in_sync_ = uint64_t{0u};
+}
+inline uint64_t StatsReply::_internal_num_of_backups_in_sync() const {
+  return _impl_.num_of_backups_in_sync_;
+}
+inline uint64_t StatsReply::num_of_backups_in_sync() const {
+  // @@protoc_insertion_point(field_get:chirp.StatsReply.num_of_backups_in_sync)
+  return _internal_num_of_backups_in_sync();
+}
+inline void StatsReply::_internal_set_num_of_backups_in_sync(uint64_t value) {
+  
+  _impl_.num_of_backups_in_sync_ = value;
+}
+inline void StatsReply::set_num_of_backups_in_sync(uint64_t value) {
+  _internal_set_num_of_backups_in_sync(value);
+  // @@protoc_insertion_point(field_set:chirp.StatsReply.num_of_backups_in_sync)
+}
+
+// uint64 num_of_sync_timeouts = 8;
+inline void StatsReply::clear_num_of_sync_timeouts() {
+  _impl_.num_of_sync_timeouts_ = uint64_t{0u};
+}
+inline uint64_t StatsReply::_internal_num_of_sync_timeouts() const {
+  return _impl_.num_of_sync_timeouts_;
+}
+inline uint64_t StatsReply::num_of_sync_timeouts() const {
+  // @@protoc_insertion_point(field_get:chirp.StatsReply.num_of_sync_timeouts)
+  return _internal_num_of_sync_timeouts();
+}
+inline void StatsReply::_internal_set_num_of_sync_timeouts(uint64_t value) {
+  
+  _impl_.num_of_sync_timeouts_ = value;
+}
+inline void StatsReply::set_num_of_sync_timeouts(uint64_t value) {
+  _internal_set_num_of_sync_timeouts(value);
+  // @@protoc_insertion_point(field_set:chirp.StatsReply.num_of_sync_timeouts)
+}
+
+// -------------------------------------------------------------------
+
+// ExistsRequest
+
+// repeated bytes keys = 1;
+inline int ExistsRequest::_internal_keys_size() const {
+  return _impl_.keys_.size();
+}
+inline int ExistsRequest::keys_size() const {
+  return _internal_keys_size();
+}
+inline void ExistsRequest::clear_keys() {
+  _impl_.keys_.Clear();
+}
+inline std::string* ExistsRequest::add_keys() {
+  std::string* _s = _internal_add_keys();
+  // @@protoc_insertion_point(field_add_mutable:chirp.ExistsRequest.keys)
+  return _s;
+}
+inline const std::string& ExistsRequest::_internal_keys(int index) const {
+  return _impl_.keys_.Get(index);
+}
+inline const std::string& ExistsRequest::keys(int index) const {
+  // @@protoc_insertion_point(field_get:chirp.ExistsRequest.keys)
+  return _internal_keys(index);
+}
+inline std::string* ExistsRequest::mutable_keys(int index) {
+  // @@protoc_insertion_point(field_mutable:chirp.ExistsRequest.keys)
+  return _impl_.keys_.Mutable(index);
+}
+inline void ExistsRequest::set_keys(int index, const std::string& value) {
+  _impl_.keys_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set:chirp.ExistsRequest.keys)
+}
+inline void ExistsRequest::set_keys(int index, std::string&& value) {
+  _impl_.keys_.Mutable(index)->assign(std::move(value));
+  // @@protoc_insertion_point(field_set:chirp.ExistsRequest.keys)
+}
+inline void ExistsRequest::set_keys(int index, const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.keys_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set_char:chirp.ExistsRequest.keys)
+}
+inline void ExistsRequest::set_keys(int index, const void* value, size_t size) {
+  _impl_.keys_.Mutable(index)->assign(
+    reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_set_pointer:chirp.ExistsRequest.keys)
+}
+inline std::string* ExistsRequest::_internal_add_keys() {
+  return _impl_.keys_.Add();
+}
+inline void ExistsRequest::add_keys(const std::string& value) {
+  _impl_.keys_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add:chirp.ExistsRequest.keys)
+}
+inline void ExistsRequest::add_keys(std::string&& value) {
+  _impl_.keys_.Add(std::move(value));
+  // @@protoc_insertion_point(field_add:chirp.ExistsRequest.keys)
+}
+inline void ExistsRequest::add_keys(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.keys_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add_char:chirp.ExistsRequest.keys)
+}
+inline void ExistsRequest::add_keys(const void* value, size_t size) {
+  _impl_.keys_.Add()->assign(reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_add_pointer:chirp.ExistsRequest.keys)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>&
+ExistsRequest::keys() const {
+  // @@protoc_insertion_point(field_list:chirp.ExistsRequest.keys)
+  return _impl_.keys_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>*
+ExistsRequest::mutable_keys() {
+  // @@protoc_insertion_point(field_mutable_list:chirp.ExistsRequest.keys)
+  return &_impl_.keys_;
+}
+
+// -------------------------------------------------------------------
+
+// ExistsReply
+
+// repeated bool exists = 1;
+inline int ExistsReply::_internal_exists_size() const {
+  return _impl_.exists_.size();
+}
+inline int ExistsReply::exists_size() const {
+  return _internal_exists_size();
+}
+inline void ExistsReply::clear_exists() {
+  _impl_.exists_.Clear();
+}
+inline bool ExistsReply::_internal_exists(int index) const {
+  return _impl_.exists_.Get(index);
+}
+inline bool ExistsReply::exists(int index) const {
+  // @@protoc_insertion_point(field_get:chirp.ExistsReply.exists)
+  return _internal_exists(index);
+}
+inline void ExistsReply::set_exists(int index, bool value) {
+  _impl_.exists_.Set(index, value);
+  // @@protoc_insertion_point(field_set:chirp.ExistsReply.exists)
+}
+inline void ExistsReply::_internal_add_exists(bool value) {
+  _impl_.exists_.Add(value);
+}
+inline void ExistsReply::add_exists(bool value) {
+  _internal_add_exists(value);
+  // @@protoc_insertion_point(field_add:chirp.ExistsReply.exists)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< bool >&
+ExistsReply::_internal_exists() const {
+  return _impl_.exists_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< bool >&
+ExistsReply::exists() const {
+  // @@protoc_insertion_point(field_list:chirp.ExistsReply.exists)
+  return _internal_exists();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< bool >*
+ExistsReply::_internal_mutable_exists() {
+  return &_impl_.exists_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< bool >*
+ExistsReply::mutable_exists() {
+  // @@protoc_insertion_point(field_mutable_list:chirp.ExistsReply.exists)
+  return _internal_mutable_exists();
+}
+
+// -------------------------------------------------------------------
+
+// CreateSnapshotRequest
+
+// uint64 lease_ms = 1;
+inline void CreateSnapshotRequest::clear_lease_ms() {
+  _impl_.lease_ms_ = uint64_t{0u};
+}
+inline uint64_t CreateSnapshotRequest::_internal_lease_ms() const {
+  return _impl_.lease_ms_;
+}
+inline uint64_t CreateSnapshotRequest::lease_ms() const {
+  // @@protoc_insertion_point(field_get:chirp.CreateSnapshotRequest.lease_ms)
+  return _internal_lease_ms();
+}
+inline void CreateSnapshotRequest::_internal_set_lease_ms(uint64_t value) {
+  
+  _impl_.lease_ms_ = value;
+}
+inline void CreateSnapshotRequest::set_lease_ms(uint64_t value) {
+  _internal_set_lease_ms(value);
+  // @@protoc_insertion_point(field_set:chirp.CreateSnapshotRequest.lease_ms)
+}
+
+// -------------------------------------------------------------------
+
+// CreateSnapshotReply
+
+// uint64 snapshot = 1;
+inline void CreateSnapshotReply::clear_snapshot() {
+  _impl_.snapshot_ = uint64_t{0u};
+}
+inline uint64_t CreateSnapshotReply::_internal_snapshot() const {
+  return _impl_.snapshot_;
+}
+inline uint64_t CreateSnapshotReply::snapshot() const {
+  // @@protoc_insertion_point(field_get:chirp.CreateSnapshotReply.snapshot)
+  return _internal_snapshot();
+}
+inline void CreateSnapshotReply::_internal_set_snapshot(uint64_t value) {
+  
+  _impl_.snapshot_ = value;
+}
+inline void CreateSnapshotReply::set_snapshot(uint64_t value) {
+  _internal_set_snapshot(value);
+  // @@protoc_insertion_point(field_set:chirp.CreateSnapshotReply.snapshot)
+}
+
+// -------------------------------------------------------------------
+
+// ReleaseSnapshotRequest
+
+// uint64 snapshot = 1;
+inline void ReleaseSnapshotRequest::clear_snapshot() {
+  _impl_.snapshot_ = uint64_t{0u};
+}
+inline uint64_t ReleaseSnapshotRequest::_internal_snapshot() const {
+  return _impl_.snapshot_;
+}
+inline uint64_t ReleaseSnapshotRequest::snapshot() const {
+  // @@protoc_insertion_point(field_get:chirp.ReleaseSnapshotRequest.snapshot)
+  return _internal_snapshot();
+}
+inline void ReleaseSnapshotRequest::_internal_set_snapshot(uint64_t value) {
+  
+  _impl_.snapshot_ = value;
+}
+inline void ReleaseSnapshotRequest::set_snapshot(uint64_t value) {
+  _internal_set_snapshot(value);
+  // @@protoc_insertion_point(field_set:chirp.ReleaseSnapshotRequest.snapshot)
+}
+
+// -------------------------------------------------------------------
+
+// ReleaseSnapshotReply
+
+// -------------------------------------------------------------------
+
+// ChangesRequest
+
+// uint64 from_seq = 1;
+inline void ChangesRequest::clear_from_seq() {
+  _impl_.from_seq_ = uint64_t{0u};
+}
+inline uint64_t ChangesRequest::_internal_from_seq() const {
+  return _impl_.from_seq_;
+}
+inline uint64_t ChangesRequest::from_seq() const {
+  // @@protoc_insertion_point(field_get:chirp.ChangesRequest.from_seq)
+  return _internal_from_seq();
+}
+inline void ChangesRequest::_internal_set_from_seq(uint64_t value) {
+  
+  _impl_.from_seq_ = value;
+}
+inline void ChangesRequest::set_from_seq(uint64_t value) {
+  _internal_set_from_seq(value);
+  // @@protoc_insertion_point(field_set:chirp.ChangesRequest.from_seq)
+}
+
+// bytes prefix_filter = 2;
+inline void ChangesRequest::clear_prefix_filter() {
+  _impl_.prefix_filter_.ClearToEmpty();
+}
+inline const std::string& ChangesRequest::prefix_filter() const {
+  // @@protoc_insertion_point(field_get:chirp.ChangesRequest.prefix_filter)
+  return _internal_prefix_filter();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void ChangesRequest::set_prefix_filter(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.prefix_filter_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:chirp.ChangesRequest.prefix_filter)
+}
+inline std::string* ChangesRequest::mutable_prefix_filter() {
+  std::string* _s = _internal_mutable_prefix_filter();
+  // @@protoc_insertion_point(field_mutable:chirp.ChangesRequest.prefix_filter)
+  return _s;
+}
+inline const std::string& ChangesRequest::_internal_prefix_filter() const {
+  return _impl_.prefix_filter_.Get();
+}
+inline void ChangesRequest::_internal_set_prefix_filter(const std::string& value) {
+  
+  _impl_.prefix_filter_.Set(value, GetArenaForAllocation());
+}
+inline std::string* ChangesRequest::_internal_mutable_prefix_filter() {
+  
+  return _impl_.prefix_filter_.Mutable(GetArenaForAllocation());
+}
+inline std::string* ChangesRequest::release_prefix_filter() {
+  // @@protoc_insertion_point(field_release:chirp.ChangesRequest.prefix_filter)
+  return _impl_.prefix_filter_.Release();
+}
+inline void ChangesRequest::set_allocated_prefix_filter(std::string* prefix_filter) {
+  if (prefix_filter != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.prefix_filter_.SetAllocated(prefix_filter, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.prefix_filter_.IsDefault()) {
+    _impl_.prefix_filter_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:chirp.ChangesRequest.prefix_filter)
+}
+
+// -------------------------------------------------------------------
+
+// Change
+
+// uint64 seq = 1;
+inline void Change::clear_seq() {
+  _impl_.seq_ = uint64_t{0u};
+}
+inline uint64_t Change::_internal_seq() const {
+  return _impl_.seq_;
+}
+inline uint64_t Change::seq() const {
+  // @@protoc_insertion_point(field_get:chirp.Change.seq)
+  return _internal_seq();
+}
+inline void Change::_internal_set_seq(uint64_t value) {
+  
+  _impl_.seq_ = value;
+}
+inline void Change::set_seq(uint64_t value) {
+  _internal_set_seq(value);
+  // @@protoc_insertion_point(field_set:chirp.Change.seq)
+}
+
+// bool deleted = 2;
+inline void Change::clear_deleted() {
+  _impl_.deleted_ = false;
+}
+inline bool Change::_internal_deleted() const {
+  return _impl_.deleted_;
+}
+inline bool Change::deleted() const {
+  // @@protoc_insertion_point(field_get:chirp.Change.deleted)
+  return _internal_deleted();
+}
+inline void Change::_internal_set_deleted(bool value) {
+  
+  _impl_.deleted_ = value;
+}
+inline void Change::set_deleted(bool value) {
+  _internal_set_deleted(value);
+  // @@protoc_insertion_point(field_set:chirp.Change.deleted)
+}
+
+// bytes key = 3;
+inline void Change::clear_key() {
+  _impl_.key_.ClearToEmpty();
+}
+inline const std::string& Change::key() const {
+  // @@protoc_insertion_point(field_get:chirp.Change.key)
+  return _internal_key();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void Change::set_key(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.key_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:chirp.Change.key)
+}
+inline std::string* Change::mutable_key() {
+  std::string* _s = _internal_mutable_key();
+  // @@protoc_insertion_point(field_mutable:chirp.Change.key)
+  return _s;
+}
+inline const std::string& Change::_internal_key() const {
+  return _impl_.key_.Get();
+}
+inline void Change::_internal_set_key(const std::string& value) {
+  
+  _impl_.key_.Set(value, GetArenaForAllocation());
+}
+inline std::string* Change::_internal_mutable_key() {
+  
+  return _impl_.key_.Mutable(GetArenaForAllocation());
+}
+inline std::string* Change::release_key() {
+  // @@protoc_insertion_point(field_release:chirp.Change.key)
+  return _impl_.key_.Release();
+}
+inline void Change::set_allocated_key(std::string* key) {
+  if (key != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.key_.SetAllocated(key, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.key_.IsDefault()) {
+    _impl_.key_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:chirp.Change.key)
+}
+
+// bytes value = 4;
+inline void Change::clear_value() {
+  _impl_.value_.ClearToEmpty();
+}
+inline const std::string& Change::value() const {
+  // @@protoc_insertion_point(field_get:chirp.Change.value)
+  return _internal_value();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void Change::set_value(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.value_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:chirp.Change.value)
+}
+inline std::string* Change::mutable_value() {
+  std::string* _s = _internal_mutable_value();
+  // @@protoc_insertion_point(field_mutable:chirp.Change.value)
+  return _s;
+}
+inline const std::string& Change::_internal_value() const {
+  return _impl_.value_.Get();
+}
+inline void Change::_internal_set_value(const std::string& value) {
+  
+  _impl_.value_.Set(value, GetArenaForAllocation());
+}
+inline std::string* Change::_internal_mutable_value() {
+  
+  return _impl_.value_.Mutable(GetArenaForAllocation());
+}
+inline std::string* Change::release_value() {
+  // @@protoc_insertion_point(field_release:chirp.Change.value)
+  return _impl_.value_.Release();
+}
+inline void Change::set_allocated_value(std::string* value) {
+  if (value != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.value_.SetAllocated(value, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.value_.IsDefault()) {
+    _impl_.value_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:chirp.Change.value)
+}
+
+// -------------------------------------------------------------------
+
+// ChangesReply
+
+// repeated .chirp.Change changes = 1;
+inline int ChangesReply::_internal_changes_size() const {
+  return _impl_.changes_.size();
+}
+inline int ChangesReply::changes_size() const {
+  return _internal_changes_size();
+}
+inline void ChangesReply::clear_changes() {
+  _impl_.changes_.Clear();
+}
+inline ::chirp::Change* ChangesReply::mutable_changes(int index) {
+  // @@protoc_insertion_point(field_mutable:chirp.ChangesReply.changes)
+  return _impl_.changes_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::chirp::Change >*
+ChangesReply::mutable_changes() {
+  // @@protoc_insertion_point(field_mutable_list:chirp.ChangesReply.changes)
+  return &_impl_.changes_;
+}
+inline const ::chirp::Change& ChangesReply::_internal_changes(int index) const {
+  return _impl_.changes_.Get(index);
+}
+inline const ::chirp::Change& ChangesReply::changes(int index) const {
+  // @@protoc_insertion_point(field_get:chirp.ChangesReply.changes)
+  return _internal_changes(index);
+}
+inline ::chirp::Change* ChangesReply::_internal_add_changes() {
+  return _impl_.changes_.Add();
+}
+inline ::chirp::Change* ChangesReply::add_changes() {
+  ::chirp::Change* _add = _internal_add_changes();
+  // @@protoc_insertion_point(field_add:chirp.ChangesReply.changes)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::chirp::Change >&
+ChangesReply::changes() const {
+  // @@protoc_insertion_point(field_list:chirp.ChangesReply.changes)
+  return _impl_.changes_;
+}
+
+// uint64 next_seq = 2;
+inline void ChangesReply::clear_next_seq() {
+  _impl_.next_seq_ = uint64_t{0u};
+}
+inline uint64_t ChangesReply::_internal_next_seq() const {
+  return _impl_.next_seq_;
+}
+inline uint64_t ChangesReply::next_seq() const {
+  // @@protoc_insertion_point(field_get:chirp.ChangesReply.next_seq)
+  return _internal_next_seq();
+}
+inline void ChangesReply::_internal_set_next_seq(uint64_t value) {
+  
+  _impl_.next_seq_ = value;
+}
+inline void ChangesReply::set_next_seq(uint64_t value) {
+  _internal_set_next_seq(value);
+  // @@protoc_insertion_point(field_set:chirp.ChangesReply.next_seq)
+}
+
+// -------------------------------------------------------------------
+
+// WatchRequest
+
+// repeated bytes prefixes = 1;
+inline int WatchRequest::_internal_prefixes_size() const {
+  return _impl_.prefixes_.size();
+}
+inline int WatchRequest::prefixes_size() const {
+  return _internal_prefixes_size();
+}
+inline void WatchRequest::clear_prefixes() {
+  _impl_.prefixes_.Clear();
+}
+inline std::string* WatchRequest::add_prefixes() {
+  std::string* _s = _internal_add_prefixes();
+  // @@protoc_insertion_point(field_add_mutable:chirp.WatchRequest.prefixes)
+  return _s;
+}
+inline const std::string& WatchRequest::_internal_prefixes(int index) const {
+  return _impl_.prefixes_.Get(index);
+}
+inline const std::string& WatchRequest::prefixes(int index) const {
+  // @@protoc_insertion_point(field_get:chirp.WatchRequest.prefixes)
+  return _internal_prefixes(index);
+}
+inline std::string* WatchRequest::mutable_prefixes(int index) {
+  // @@protoc_insertion_point(field_mutable:chirp.WatchRequest.prefixes)
+  return _impl_.prefixes_.Mutable(index);
+}
+inline void WatchRequest::set_prefixes(int index, const std::string& value) {
+  _impl_.prefixes_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set:chirp.WatchRequest.prefixes)
+}
+inline void WatchRequest::set_prefixes(int index, std::string&& value) {
+  _impl_.prefixes_.Mutable(index)->assign(std::move(value));
+  // @@protoc_insertion_point(field_set:chirp.WatchRequest.prefixes)
+}
+inline void WatchRequest::set_prefixes(int index, const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.prefixes_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set_char:chirp.WatchRequest.prefixes)
+}
+inline void WatchRequest::set_prefixes(int index, const void* value, size_t size) {
+  _impl_.prefixes_.Mutable(index)->assign(
+    reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_set_pointer:chirp.WatchRequest.prefixes)
+}
+inline std::string* WatchRequest::_internal_add_prefixes() {
+  return _impl_.prefixes_.Add();
+}
+inline void WatchRequest::add_prefixes(const std::string& value) {
+  _impl_.prefixes_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add:chirp.WatchRequest.prefixes)
+}
+inline void WatchRequest::add_prefixes(std::string&& value) {
+  _impl_.prefixes_.Add(std::move(value));
+  // @@protoc_insertion_point(field_add:chirp.WatchRequest.prefixes)
+}
+inline void WatchRequest::add_prefixes(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.prefixes_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add_char:chirp.WatchRequest.prefixes)
+}
+inline void WatchRequest::add_prefixes(const void* value, size_t size) {
+  _impl_.prefixes_.Add()->assign(reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_add_pointer:chirp.WatchRequest.prefixes)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>&
+WatchRequest::prefixes() const {
+  // @@protoc_insertion_point(field_list:chirp.WatchRequest.prefixes)
+  return _impl_.prefixes_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>*
+WatchRequest::mutable_prefixes() {
+  // @@protoc_insertion_point(field_mutable_list:chirp.WatchRequest.prefixes)
+  return &_impl_.prefixes_;
+}
+
+// bool with_values = 2;
+inline void WatchRequest::clear_with_values() {
+  _impl_.with_values_ = false;
+}
+inline bool WatchRequest::_internal_with_values() const {
+  return _impl_.with_values_;
+}
+inline bool WatchRequest::with_values() const {
+  // @@protoc_insertion_point(field_get:chirp.WatchRequest.with_values)
+  return _internal_with_values();
+}
+inline void WatchRequest::_internal_set_with_values(bool value) {
+  
+  _impl_.with_values_ = value;
+}
+inline void WatchRequest::set_with_values(bool value) {
+  _internal_set_with_values(value);
+  // @@protoc_insertion_point(field_set:chirp.WatchRequest.with_values)
+}
+
+// -------------------------------------------------------------------
+
+// WatchEvent
+
+// bytes key = 1;
+inline void WatchEvent::clear_key() {
+  _impl_.key_.ClearToEmpty();
+}
+inline const std::string& WatchEvent::key() const {
+  // @@protoc_insertion_point(field_get:chirp.WatchEvent.key)
+  return _internal_key();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void WatchEvent::set_key(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.key_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:chirp.WatchEvent.key)
+}
+inline std::string* WatchEvent::mutable_key() {
+  std::string* _s = _internal_mutable_key();
+  // @@protoc_insertion_point(field_mutable:chirp.WatchEvent.key)
+  return _s;
+}
+inline const std::string& WatchEvent::_internal_key() const {
+  return _impl_.key_.Get();
+}
+inline void WatchEvent::_internal_set_key(const std::string& value) {
+  
+  _impl_.key_.Set(value, GetArenaForAllocation());
+}
+inline std::string* WatchEvent::_internal_mutable_key() {
+  
+  return _impl_.key_.Mutable(GetArenaForAllocation());
+}
+inline std::string* WatchEvent::release_key() {
+  // @@protoc_insertion_point(field_release:chirp.WatchEvent.key)
+  return _impl_.key_.Release();
+}
+inline void WatchEvent::set_allocated_key(std::string* key) {
+  if (key != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.key_.SetAllocated(key, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.key_.IsDefault()) {
+    _impl_.key_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:chirp.WatchEvent.key)
+}
+
+// bool deleted = 2;
+inline void WatchEvent::clear_deleted() {
+  _impl_.deleted_ = false;
+}
+inline bool WatchEvent::_internal_deleted() const {
+  return _impl_.deleted_;
+}
+inline bool WatchEvent::deleted() const {
+  // @@protoc_insertion_point(field_get:chirp.WatchEvent.deleted)
+  return _internal_deleted();
+}
+inline void WatchEvent::_internal_set_deleted(bool value) {
+  
+  _impl_.deleted_ = value;
+}
+inline void WatchEvent::set_deleted(bool value) {
+  _internal_set_deleted(value);
+  // @@protoc_insertion_point(field_set:chirp.WatchEvent.deleted)
+}
+
+// bytes value = 3;
+inline void WatchEvent::clear_value() {
+  _impl_.value_.ClearToEmpty();
+}
+inline const std::string& WatchEvent::value() const {
+  // @@protoc_insertion_point(field_get:chirp.WatchEvent.value)
+  return _internal_value();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void WatchEvent::set_value(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.value_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:chirp.WatchEvent.value)
+}
+inline std::string* WatchEvent::mutable_value() {
+  std::string* _s = _internal_mutable_value();
+  // @@protoc_insertion_point(field_mutable:chirp.WatchEvent.value)
+  return _s;
+}
+inline const std::string& WatchEvent::_internal_value() const {
+  return _impl_.value_.Get();
+}
+inline void WatchEvent::_internal_set_value(const std::string& value) {
+  
+  _impl_.value_.Set(value, GetArenaForAllocation());
+}
+inline std::string* WatchEvent::_internal_mutable_value() {
+  
+  return _impl_.value_.Mutable(GetArenaForAllocation());
+}
+inline std::string* WatchEvent::release_value() {
+  // @@protoc_insertion_point(field_release:chirp.WatchEvent.value)
+  return _impl_.value_.Release();
+}
+inline void WatchEvent::set_allocated_value(std::string* value) {
+  if (value != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.value_.SetAllocated(value, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.value_.IsDefault()) {
+    _impl_.value_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:chirp.WatchEvent.value)
+}
+
+// -------------------------------------------------------------------
+
+// WatchReply
+
+// repeated .chirp.WatchEvent events = 1;
+inline int WatchReply::_internal_events_size() const {
+  return _impl_.events_.size();
+}
+inline int WatchReply::events_size() const {
+  return _internal_events_size();
+}
+inline void WatchReply::clear_events() {
+  _impl_.events_.Clear();
+}
+inline ::chirp::WatchEvent* WatchReply::mutable_events(int index) {
+  // @@protoc_insertion_point(field_mutable:chirp.WatchReply.events)
+  return _impl_.events_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::chirp::WatchEvent >*
+WatchReply::mutable_events() {
+  // @@protoc_insertion_point(field_mutable_list:chirp.WatchReply.events)
+  return &_impl_.events_;
+}
+inline const ::chirp::WatchEvent& WatchReply::_internal_events(int index) const {
+  return _impl_.events_.Get(index);
+}
+inline const ::chirp::WatchEvent& WatchReply::events(int index) const {
+  // @@protoc_insertion_point(field_get:chirp.WatchReply.events)
+  return _internal_events(index);
+}
+inline ::chirp::WatchEvent* WatchReply::_internal_add_events() {
+  return _impl_.events_.Add();
+}
+inline ::chirp::WatchEvent* WatchReply::add_events() {
+  ::chirp::WatchEvent* _add = _internal_add_events();
+  // @@protoc_insertion_point(field_add:chirp.WatchReply.events)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::chirp::WatchEvent >&
+WatchReply::events() const {
+  // @@protoc_insertion_point(field_list:chirp.WatchReply.events)
+  return _impl_.events_;
+}
+
+// bool overflowed = 2;
+inline void WatchReply::clear_overflowed() {
+  _impl_.overflowed_ = false;
+}
+inline bool WatchReply::_internal_overflowed() const {
+  return _impl_.overflowed_;
+}
+inline bool WatchReply::overflowed() const {
+  // @@protoc_insertion_point(field_get:chirp.WatchReply.overflowed)
+  return _internal_overflowed();
+}
+inline void WatchReply::_internal_set_overflowed(bool value) {
+  
+  _impl_.overflowed_ = value;
+}
+inline void WatchReply::set_overflowed(bool value) {
+  _internal_set_overflowed(value);
+  // @@protoc_insertion_point(field_set:chirp.WatchReply.overflowed)
+}
+
+// -------------------------------------------------------------------
+
+// BatchCondition
+
+// bytes key = 1;
+inline void BatchCondition::clear_key() {
+  _impl_.key_.ClearToEmpty();
+}
+inline const std::string& BatchCondition::key() const {
+  // @@protoc_insertion_point(field_get:chirp.BatchCondition.key)
+  return _internal_key();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void BatchCondition::set_key(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.key_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:chirp.BatchCondition.key)
+}
+inline std::string* BatchCondition::mutable_key() {
+  std::string* _s = _internal_mutable_key();
+  // @@protoc_insertion_point(field_mutable:chirp.BatchCondition.key)
+  return _s;
+}
+inline const std::string& BatchCondition::_internal_key() const {
+  return _impl_.key_.Get();
+}
+inline void BatchCondition::_internal_set_key(const std::string& value) {
+  
+  _impl_.key_.Set(value, GetArenaForAllocation());
+}
+inline std::string* BatchCondition::_internal_mutable_key() {
+  
+  return _impl_.key_.Mutable(GetArenaForAllocation());
+}
+inline std::string* BatchCondition::release_key() {
+  // @@protoc_insertion_point(field_release:chirp.BatchCondition.key)
+  return _impl_.key_.Release();
+}
+inline void BatchCondition::set_allocated_key(std::string* key) {
+  if (key != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.key_.SetAllocated(key, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.key_.IsDefault()) {
+    _impl_.key_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:chirp.BatchCondition.key)
+}
+
+// bytes expected = 2;
+inline void BatchCondition::clear_expected() {
+  _impl_.expected_.ClearToEmpty();
+}
+inline const std::string& BatchCondition::expected() const {
+  // @@protoc_insertion_point(field_get:chirp.BatchCondition.expected)
+  return _internal_expected();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void BatchCondition::set_expected(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.expected_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:chirp.BatchCondition.expected)
+}
+inline std::string* BatchCondition::mutable_expected() {
+  std::string* _s = _internal_mutable_expected();
+  // @@protoc_insertion_point(field_mutable:chirp.BatchCondition.expected)
+  return _s;
+}
+inline const std::string& BatchCondition::_internal_expected() const {
+  return _impl_.expected_.Get();
+}
+inline void BatchCondition::_internal_set_expected(const std::string& value) {
+  
+  _impl_.expected_.Set(value, GetArenaForAllocation());
+}
+inline std::string* BatchCondition::_internal_mutable_expected() {
+  
+  return _impl_.expected_.Mutable(GetArenaForAllocation());
+}
+inline std::string* BatchCondition::release_expected() {
+  // @@protoc_insertion_point(field_release:chirp.BatchCondition.expected)
+  return _impl_.expected_.Release();
+}
+inline void BatchCondition::set_allocated_expected(std::string* expected) {
+  if (expected != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.expected_.SetAllocated(expected, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.expected_.IsDefault()) {
+    _impl_.expected_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:chirp.BatchCondition.expected)
+}
+
+// bool exists = 3;
+inline void BatchCondition::clear_exists() {
+  _impl_.exists_ = false;
+}
+inline bool BatchCondition::_internal_exists() const {
+  return _impl_.exists_;
+}
+inline bool BatchCondition::exists() const {
+  // @@protoc_insertion_point(field_get:chirp.BatchCondition.exists)
+  return _internal_exists();
+}
+inline void BatchCondition::_internal_set_exists(bool value) {
+  
+  _impl_.exists_ = value;
+}
+inline void BatchCondition::set_exists(bool value) {
+  _internal_set_exists(value);
+  // @@protoc_insertion_point(field_set:chirp.BatchCondition.exists)
+}
+
+// -------------------------------------------------------------------
+
+// BatchWrite
+
+// .chirp.PutRequest put = 1;
+inline bool BatchWrite::_internal_has_put() const {
+  return write_case() == kPut;
+}
+inline bool BatchWrite::has_put() const {
+  return _internal_has_put();
+}
+inline void BatchWrite::set_has_put() {
+  _impl_._oneof_case_[0] = kPut;
+}
+inline void BatchWrite::clear_put() {
+  if (_internal_has_put()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.write_.put_;
+    }
+    clear_has_write();
+  }
+}
+inline ::chirp::PutRequest* BatchWrite::release_put() {
+  // @@protoc_insertion_point(field_release:chirp.BatchWrite.put)
+  if (_internal_has_put()) {
+    clear_has_write();
+    ::chirp::PutRequest* temp = _impl_.write_.put_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.write_.put_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const ::chirp::PutRequest& BatchWrite::_internal_put() const {
+  return _internal_has_put()
+      ? *_impl_.write_.put_
+      : reinterpret_cast< ::chirp::PutRequest&>(::chirp::_PutRequest_default_instance_);
+}
+inline const ::chirp::PutRequest& BatchWrite::put() const {
+  // @@protoc_insertion_point(field_get:chirp.BatchWrite.put)
+  return _internal_put();
+}
+inline ::chirp::PutRequest* BatchWrite::unsafe_arena_release_put() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:chirp.BatchWrite.put)
+  if (_internal_has_put()) {
+    clear_has_write();
+    ::chirp::PutRequest* temp = _impl_.write_.put_;
+    _impl_.write_.put_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void BatchWrite::unsafe_arena_set_allocated_put(::chirp::PutRequest* put) {
+  clear_write();
+  if (put) {
+    set_has_put();
+    _impl_.write_.put_ = put;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:chirp.BatchWrite.put)
+}
+inline ::chirp::PutRequest* BatchWrite::_internal_mutable_put() {
+  if (!_internal_has_put()) {
+    clear_write();
+    set_has_put();
+    _impl_.write_.put_ = CreateMaybeMessage< ::chirp::PutRequest >(GetArenaForAllocation());
+  }
+  return _impl_.write_.put_;
+}
+inline ::chirp::PutRequest* BatchWrite::mutable_put() {
+  ::chirp::PutRequest* _msg = _internal_mutable_put();
+  // @@protoc_insertion_point(field_mutable:chirp.BatchWrite.put)
+  return _msg;
+}
+
+// .chirp.DeleteRequest delete_key = 2;
+inline bool BatchWrite::_internal_has_delete_key() const {
+  return write_case() == kDeleteKey;
+}
+inline bool BatchWrite::has_delete_key() const {
+  return _internal_has_delete_key();
+}
+inline void BatchWrite::set_has_delete_key() {
+  _impl_._oneof_case_[0] = kDeleteKey;
+}
+inline void BatchWrite::clear_delete_key() {
+  if (_internal_has_delete_key()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.write_.delete_key_;
+    }
+    clear_has_write();
+  }
+}
+inline ::chirp::DeleteRequest* BatchWrite::release_delete_key() {
+  // @@protoc_insertion_point(field_release:chirp.BatchWrite.delete_key)
+  if (_internal_has_delete_key()) {
+    clear_has_write();
+    ::chirp::DeleteRequest* temp = _impl_.write_.delete_key_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.write_.delete_key_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const ::chirp::DeleteRequest& BatchWrite::_internal_delete_key() const {
+  return _internal_has_delete_key()
+      ? *_impl_.write_.delete_key_
+      : reinterpret_cast< ::chirp::DeleteRequest&>(::chirp::_DeleteRequest_default_instance_);
+}
+inline const ::chirp::DeleteRequest& BatchWrite::delete_key() const {
+  // @@protoc_insertion_point(field_get:chirp.BatchWrite.delete_key)
+  return _internal_delete_key();
+}
+inline ::chirp::DeleteRequest* BatchWrite::unsafe_arena_release_delete_key() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:chirp.BatchWrite.delete_key)
+  if (_internal_has_delete_key()) {
+    clear_has_write();
+    ::chirp::DeleteRequest* temp = _impl_.write_.delete_key_;
+    _impl_.write_.delete_key_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void BatchWrite::unsafe_arena_set_allocated_delete_key(::chirp::DeleteRequest* delete_key) {
+  clear_write();
+  if (delete_key) {
+    set_has_delete_key();
+    _impl_.write_.delete_key_ = delete_key;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:chirp.BatchWrite.delete_key)
+}
+inline ::chirp::DeleteRequest* BatchWrite::_internal_mutable_delete_key() {
+  if (!_internal_has_delete_key()) {
+    clear_write();
+    set_has_delete_key();
+    _impl_.write_.delete_key_ = CreateMaybeMessage< ::chirp::DeleteRequest >(GetArenaForAllocation());
+  }
+  return _impl_.write_.delete_key_;
+}
+inline ::chirp::DeleteRequest* BatchWrite::mutable_delete_key() {
+  ::chirp::DeleteRequest* _msg = _internal_mutable_delete_key();
+  // @@protoc_insertion_point(field_mutable:chirp.BatchWrite.delete_key)
+  return _msg;
+}
+
+// .chirp.ListElementRequest list_append = 3;
+inline bool BatchWrite::_internal_has_list_append() const {
+  return write_case() == kListAppend;
+}
+inline bool BatchWrite::has_list_append() const {
+  return _internal_has_list_append();
+}
+inline void BatchWrite::set_has_list_append() {
+  _impl_._oneof_case_[0] = kListAppend;
+}
+inline void BatchWrite::clear_list_append() {
+  if (_internal_has_list_append()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.write_.list_append_;
+    }
+    clear_has_write();
+  }
+}
+inline ::chirp::ListElementRequest* BatchWrite::release_list_append() {
+  // @@protoc_insertion_point(field_release:chirp.BatchWrite.list_append)
+  if (_internal_has_list_append()) {
+    clear_has_write();
+    ::chirp::ListElementRequest* temp = _impl_.write_.list_append_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.write_.list_append_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const ::chirp::ListElementRequest& BatchWrite::_internal_list_append() const {
+  return _internal_has_list_append()
+      ? *_impl_.write_.list_append_
+      : reinterpret_cast< ::chirp::ListElementRequest&>(::chirp::_ListElementRequest_default_instance_);
+}
+inline const ::chirp::ListElementRequest& BatchWrite::list_append() const {
+  // @@protoc_insertion_point(field_get:chirp.BatchWrite.list_append)
+  return _internal_list_append();
+}
+inline ::chirp::ListElementRequest* BatchWrite::unsafe_arena_release_list_append() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:chirp.BatchWrite.list_append)
+  if (_internal_has_list_append()) {
+    clear_has_write();
+    ::chirp::ListElementRequest* temp = _impl_.write_.list_append_;
+    _impl_.write_.list_append_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void BatchWrite::unsafe_arena_set_allocated_list_append(::chirp::ListElementRequest* list_append) {
+  clear_write();
+  if (list_append) {
+    set_has_list_append();
+    _impl_.write_.list_append_ = list_append;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:chirp.BatchWrite.list_append)
+}
+inline ::chirp::ListElementRequest* BatchWrite::_internal_mutable_list_append() {
+  if (!_internal_has_list_append()) {
+    clear_write();
+    set_has_list_append();
+    _impl_.write_.list_append_ = CreateMaybeMessage< ::chirp::ListElementRequest >(GetArenaForAllocation());
+  }
+  return _impl_.write_.list_append_;
+}
+inline ::chirp::ListElementRequest* BatchWrite::mutable_list_append() {
+  ::chirp::ListElementRequest* _msg = _internal_mutable_list_append();
+  // @@protoc_insertion_point(field_mutable:chirp.BatchWrite.list_append)
+  return _msg;
+}
+
+// .chirp.ListElementRequest list_remove = 4;
+inline bool BatchWrite::_internal_has_list_remove() const {
+  return write_case() == kListRemove;
+}
+inline bool BatchWrite::has_list_remove() const {
+  return _internal_has_list_remove();
+}
+inline void BatchWrite::set_has_list_remove() {
+  _impl_._oneof_case_[0] = kListRemove;
+}
+inline void BatchWrite::clear_list_remove() {
+  if (_internal_has_list_remove()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.write_.list_remove_;
+    }
+    clear_has_write();
+  }
+}
+inline ::chirp::ListElementRequest* BatchWrite::release_list_remove() {
+  // @@protoc_insertion_point(field_release:chirp.BatchWrite.list_remove)
+  if (_internal_has_list_remove()) {
+    clear_has_write();
+    ::chirp::ListElementRequest* temp = _impl_.write_.list_remove_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.write_.list_remove_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const ::chirp::ListElementRequest& BatchWrite::_internal_list_remove() const {
+  return _internal_has_list_remove()
+      ? *_impl_.write_.list_remove_
+      : reinterpret_cast< ::chirp::ListElementRequest&>(::chirp::_ListElementRequest_default_instance_);
+}
+inline const ::chirp::ListElementRequest& BatchWrite::list_remove() const {
+  // @@protoc_insertion_point(field_get:chirp.BatchWrite.list_remove)
+  return _internal_list_remove();
+}
+inline ::chirp::ListElementRequest* BatchWrite::unsafe_arena_release_list_remove() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:chirp.BatchWrite.list_remove)
+  if (_internal_has_list_remove()) {
+    clear_has_write();
+    ::chirp::ListElementRequest* temp = _impl_.write_.list_remove_;
+    _impl_.write_.list_remove_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void BatchWrite::unsafe_arena_set_allocated_list_remove(::chirp::ListElementRequest* list_remove) {
+  clear_write();
+  if (list_remove) {
+    set_has_list_remove();
+    _impl_.write_.list_remove_ = list_remove;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:chirp.BatchWrite.list_remove)
+}
+inline ::chirp::ListElementRequest* BatchWrite::_internal_mutable_list_remove() {
+  if (!_internal_has_list_remove()) {
+    clear_write();
+    set_has_list_remove();
+    _impl_.write_.list_remove_ = CreateMaybeMessage< ::chirp::ListElementRequest >(GetArenaForAllocation());
+  }
+  return _impl_.write_.list_remove_;
+}
+inline ::chirp::ListElementRequest* BatchWrite::mutable_list_remove() {
+  ::chirp::ListElementRequest* _msg = _internal_mutable_list_remove();
+  // @@protoc_insertion_point(field_mutable:chirp.BatchWrite.list_remove)
+  return _msg;
+}
+
+inline bool BatchWrite::has_write() const {
+  return write_case() != WRITE_NOT_SET;
+}
+inline void BatchWrite::clear_has_write() {
+  _impl_._oneof_case_[0] = WRITE_NOT_SET;
+}
+inline BatchWrite::WriteCase BatchWrite::write_case() const {
+  return BatchWrite::WriteCase(_impl_._oneof_case_[0]);
+}
+// -------------------------------------------------------------------
+
+// WriteBatchRequest
+
+// repeated .chirp.BatchCondition conditions = 1;
+inline int WriteBatchRequest::_internal_conditions_size() const {
+  return _impl_.conditions_.size();
+}
+inline int WriteBatchRequest::conditions_size() const {
+  return _internal_conditions_size();
+}
+inline void WriteBatchRequest::clear_conditions() {
+  _impl_.conditions_.Clear();
+}
+inline ::chirp::BatchCondition* WriteBatchRequest::mutable_conditions(int index) {
+  // @@protoc_insertion_point(field_mutable:chirp.WriteBatchRequest.conditions)
+  return _impl_.conditions_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::chirp::BatchCondition >*
+WriteBatchRequest::mutable_conditions() {
+  // @@protoc_insertion_point(field_mutable_list:chirp.WriteBatchRequest.conditions)
+  return &_impl_.conditions_;
+}
+inline const ::chirp::BatchCondition& WriteBatchRequest::_internal_conditions(int index) const {
+  return _impl_.conditions_.Get(index);
+}
+inline const ::chirp::BatchCondition& WriteBatchRequest::conditions(int index) const {
+  // @@protoc_insertion_point(field_get:chirp.WriteBatchRequest.conditions)
+  return _internal_conditions(index);
+}
+inline ::chirp::BatchCondition* WriteBatchRequest::_internal_add_conditions() {
+  return _impl_.conditions_.Add();
+}
+inline ::chirp::BatchCondition* WriteBatchRequest::add_conditions() {
+  ::chirp::BatchCondition* _add = _internal_add_conditions();
+  // @@protoc_insertion_point(field_add:chirp.WriteBatchRequest.conditions)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::chirp::BatchCondition >&
+WriteBatchRequest::conditions() const {
+  // @@protoc_insertion_point(field_list:chirp.WriteBatchRequest.conditions)
+  return _impl_.conditions_;
+}
+
+// repeated .chirp.BatchWrite writes = 2;
+inline int WriteBatchRequest::_internal_writes_size() const {
+  return _impl_.writes_.size();
+}
+inline int WriteBatchRequest::writes_size() const {
+  return _internal_writes_size();
+}
+inline void WriteBatchRequest::clear_writes() {
+  _impl_.writes_.Clear();
+}
+inline ::chirp::BatchWrite* WriteBatchRequest::mutable_writes(int index) {
+  // @@protoc_insertion_point(field_mutable:chirp.WriteBatchRequest.writes)
+  return _impl_.writes_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::chirp::BatchWrite >*
+WriteBatchRequest::mutable_writes() {
+  // @@protoc_insertion_point(field_mutable_list:chirp.WriteBatchRequest.writes)
+  return &_impl_.writes_;
+}
+inline const ::chirp::BatchWrite& WriteBatchRequest::_internal_writes(int index) const {
+  return _impl_.writes_.Get(index);
+}
+inline const ::chirp::BatchWrite& WriteBatchRequest::writes(int index) const {
+  // @@protoc_insertion_point(field_get:chirp.WriteBatchRequest.writes)
+  return _internal_writes(index);
+}
+inline ::chirp::BatchWrite* WriteBatchRequest::_internal_add_writes() {
+  return _impl_.writes_.Add();
+}
+inline ::chirp::BatchWrite* WriteBatchRequest::add_writes() {
+  ::chirp::BatchWrite* _add = _internal_add_writes();
+  // @@protoc_insertion_point(field_add:chirp.WriteBatchRequest.writes)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::chirp::BatchWrite >&
+WriteBatchRequest::writes() const {
+  // @@protoc_insertion_point(field_list:chirp.WriteBatchRequest.writes)
+  return _impl_.writes_;
+}
+
+// -------------------------------------------------------------------
+
+// WriteBatchReply
+
+// bool applied = 1;
+inline void WriteBatchReply::clear_applied() {
+  _impl_.applied_ = false;
+}
+inline bool WriteBatchReply::_internal_applied() const {
+  return _impl_.applied_;
+}
+inline bool WriteBatchReply::applied() const {
+  // @@protoc_insertion_point(field_get:chirp.WriteBatchReply.applied)
+  return _internal_applied();
+}
+inline void WriteBatchReply::_internal_set_applied(bool value) {
+  
+  _impl_.applied_ = value;
+}
+inline void WriteBatchReply::set_applied(bool value) {
+  _internal_set_applied(value);
+  // @@protoc_insertion_point(field_set:chirp.WriteBatchReply.applied)
+}
+
+// uint32 failed_condition = 2;
+inline void WriteBatchReply::clear_failed_condition() {
+  _impl_.failed_condition_ = 0u;
+}
+inline uint32_t WriteBatchReply::_internal_failed_condition() const {
+  return _impl_.failed_condition_;
+}
+inline uint32_t WriteBatchReply::failed_condition() const {
+  // @@protoc_insertion_point(field_get:chirp.WriteBatchReply.failed_condition)
+  return _internal_failed_condition();
+}
+inline void WriteBatchReply::_internal_set_failed_condition(uint32_t value) {
+  
+  _impl_.failed_condition_ = value;
+}
+inline void WriteBatchReply::set_failed_condition(uint32_t value) {
+  _internal_set_failed_condition(value);
+  // @@protoc_insertion_point(field_set:chirp.WriteBatchReply.failed_condition)
+}
+
+// bytes actual = 3;
+inline void WriteBatchReply::clear_actual() {
+  _impl_.actual_.ClearToEmpty();
+}
+inline const std::string& WriteBatchReply::actual() const {
+  // @@protoc_insertion_point(field_get:chirp.WriteBatchReply.actual)
+  return _internal_actual();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void WriteBatchReply::set_actual(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.actual_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:chirp.WriteBatchReply.actual)
+}
+inline std::string* WriteBatchReply::mutable_actual() {
+  std::string* _s = _internal_mutable_actual();
+  // @@protoc_insertion_point(field_mutable:chirp.WriteBatchReply.actual)
+  return _s;
+}
+inline const std::string& WriteBatchReply::_internal_actual() const {
+  return _impl_.actual_.Get();
+}
+inline void WriteBatchReply::_internal_set_actual(const std::string& value) {
+  
+  _impl_.actual_.Set(value, GetArenaForAllocation());
+}
+inline std::string* WriteBatchReply::_internal_mutable_actual() {
+  
+  return _impl_.actual_.Mutable(GetArenaForAllocation());
+}
+inline std::string* WriteBatchReply::release_actual() {
+  // @@protoc_insertion_point(field_release:chirp.WriteBatchReply.actual)
+  return _impl_.actual_.Release();
+}
+inline void WriteBatchReply::set_allocated_actual(std::string* actual) {
+  if (actual != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.actual_.SetAllocated(actual, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.actual_.IsDefault()) {
+    _impl_.actual_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:chirp.WriteBatchReply.actual)
+}
+
+// -------------------------------------------------------------------
+
+// ReplicationRecord
+
+// uint64 lsn = 1;
+inline void ReplicationRecord::clear_lsn() {
+  _impl_.lsn_ = uint64_t{0u};
+}
+inline uint64_t ReplicationRecord::_internal_lsn() const {
+  return _impl_.lsn_;
+}
+inline uint64_t ReplicationRecord::lsn() const {
+  // @@protoc_insertion_point(field_get:chirp.ReplicationRecord.lsn)
+  return _internal_lsn();
+}
+inline void ReplicationRecord::_internal_set_lsn(uint64_t value) {
+  
+  _impl_.lsn_ = value;
+}
+inline void ReplicationRecord::set_lsn(uint64_t value) {
+  _internal_set_lsn(value);
+  // @@protoc_insertion_point(field_set:chirp.ReplicationRecord.lsn)
+}
+
+// uint32 operation = 2;
+inline void ReplicationRecord::clear_operation() {
+  _impl_.operation_ = 0u;
+}
+inline uint32_t ReplicationRecord::_internal_operation() const {
+  return _impl_.operation_;
+}
+inline uint32_t ReplicationRecord::operation() const {
+  // @@protoc_insertion_point(field_get:chirp.ReplicationRecord.operation)
+  return _internal_operation();
+}
+inline void ReplicationRecord::_internal_set_operation(uint32_t value) {
+  
+  _impl_.operation_ = value;
+}
+inline void ReplicationRecord::set_operation(uint32_t value) {
+  _internal_set_operation(value);
+  // @@protoc_insertion_point(field_set:chirp.ReplicationRecord.operation)
+}
+
+// bytes key = 3;
+inline void ReplicationRecord::clear_key() {
+  _impl_.key_.ClearToEmpty();
+}
+inline const std::string& ReplicationRecord::key() const {
+  // @@protoc_insertion_point(field_get:chirp.ReplicationRecord.key)
+  return _internal_key();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void ReplicationRecord::set_key(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.key_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:chirp.ReplicationRecord.key)
+}
+inline std::string* ReplicationRecord::mutable_key() {
+  std::string* _s = _internal_mutable_key();
+  // @@protoc_insertion_point(field_mutable:chirp.ReplicationRecord.key)
+  return _s;
+}
+inline const std::string& ReplicationRecord::_internal_key() const {
+  return _impl_.key_.Get();
+}
+inline void ReplicationRecord::_internal_set_key(const std::string& value) {
+  
+  _impl_.key_.Set(value, GetArenaForAllocation());
+}
+inline std::string* ReplicationRecord::_internal_mutable_key() {
+  
+  return _impl_.key_.Mutable(GetArenaForAllocation());
+}
+inline std::string* ReplicationRecord::release_key() {
+  // @@protoc_insertion_point(field_release:chirp.ReplicationRecord.key)
+  return _impl_.key_.Release();
+}
+inline void ReplicationRecord::set_allocated_key(std::string* key) {
+  if (key != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.key_.SetAllocated(key, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.key_.IsDefault()) {
+    _impl_.key_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:chirp.ReplicationRecord.key)
+}
+
+// bytes value = 4;
+inline void ReplicationRecord::clear_value() {
+  _impl_.value_.ClearToEmpty();
+}
+inline const std::string& ReplicationRecord::value() const {
+  // @@protoc_insertion_point(field_get:chirp.ReplicationRecord.value)
+  return _internal_value();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void ReplicationRecord::set_value(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.value_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:chirp.ReplicationRecord.value)
+}
+inline std::string* ReplicationRecord::mutable_value() {
+  std::string* _s = _internal_mutable_value();
+  // @@protoc_insertion_point(field_mutable:chirp.ReplicationRecord.value)
+  return _s;
+}
+inline const std::string& ReplicationRecord::_internal_value() const {
+  return _impl_.value_.Get();
+}
+inline void ReplicationRecord::_internal_set_value(const std::string& value) {
+  
+  _impl_.value_.Set(value, GetArenaForAllocation());
+}
+inline std::string* ReplicationRecord::_internal_mutable_value() {
+  
+  return _impl_.value_.Mutable(GetArenaForAllocation());
+}
+inline std::string* ReplicationRecord::release_value() {
+  // @@protoc_insertion_point(field_release:chirp.ReplicationRecord.value)
+  return _impl_.value_.Release();
+}
+inline void ReplicationRecord::set_allocated_value(std::string* value) {
+  if (value != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.value_.SetAllocated(value, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.value_.IsDefault()) {
+    _impl_.value_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:chirp.ReplicationRecord.value)
+}
+
+// -------------------------------------------------------------------
+
+// ReplicationBatch
+
+// bool reset = 1;
+inline void ReplicationBatch::clear_reset() {
+  _impl_.reset_ = false;
+}
+inline bool ReplicationBatch::_internal_reset() const {
+  return _impl_.reset_;
+}
+inline bool ReplicationBatch::reset() const {
+  // @@protoc_insertion_point(field_get:chirp.ReplicationBatch.reset)
+  return _internal_reset();
+}
+inline void ReplicationBatch::_internal_set_reset(bool value) {
+  
+  _impl_.reset_ = value;
+}
+inline void ReplicationBatch::set_reset(bool value) {
+  _internal_set_reset(value);
+  // @@protoc_insertion_point(field_set:chirp.ReplicationBatch.reset)
+}
+
+// repeated .chirp.PutRequest pairs = 2;
+inline int ReplicationBatch::_internal_pairs_size() const {
+  return _impl_.pairs_.size();
+}
+inline int ReplicationBatch::pairs_size() const {
+  return _internal_pairs_size();
+}
+inline void ReplicationBatch::clear_pairs() {
+  _impl_.pairs_.Clear();
+}
+inline ::chirp::PutRequest* ReplicationBatch::mutable_pairs(int index) {
+  // @@protoc_insertion_point(field_mutable:chirp.ReplicationBatch.pairs)
+  return _impl_.pairs_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::chirp::PutRequest >*
+ReplicationBatch::mutable_pairs() {
+  // @@protoc_insertion_point(field_mutable_list:chirp.ReplicationBatch.pairs)
+  return &_impl_.pairs_;
+}
+inline const ::chirp::PutRequest& ReplicationBatch::_internal_pairs(int index) const {
+  return _impl_.pairs_.Get(index);
+}
+inline const ::chirp::PutRequest& ReplicationBatch::pairs(int index) const {
+  // @@protoc_insertion_point(field_get:chirp.ReplicationBatch.pairs)
+  return _internal_pairs(index);
+}
+inline ::chirp::PutRequest* ReplicationBatch::_internal_add_pairs() {
+  return _impl_.pairs_.Add();
+}
+inline ::chirp::PutRequest* ReplicationBatch::add_pairs() {
+  ::chirp::PutRequest* _add = _internal_add_pairs();
+  // @@protoc_insertion_point(field_add:chirp.ReplicationBatch.pairs)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::chirp::PutRequest >&
+ReplicationBatch::pairs() const {
+  // @@protoc_insertion_point(field_list:chirp.ReplicationBatch.pairs)
+  return _impl_.pairs_;
+}
+
+// repeated .chirp.ReplicationRecord records = 3;
+inline int ReplicationBatch::_internal_records_size() const {
+  return _impl_.records_.size();
+}
+inline int ReplicationBatch::records_size() const {
+  return _internal_records_size();
+}
+inline void ReplicationBatch::clear_records() {
+  _impl_.records_.Clear();
+}
+inline ::chirp::ReplicationRecord* ReplicationBatch::mutable_records(int index) {
+  // @@protoc_insertion_point(field_mutable:chirp.ReplicationBatch.records)
+  return _impl_.records_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::chirp::ReplicationRecord >*
+ReplicationBatch::mutable_records() {
+  // @@protoc_insertion_point(field_mutable_list:chirp.ReplicationBatch.records)
+  return &_impl_.records_;
+}
+inline const ::chirp::ReplicationRecord& ReplicationBatch::_internal_records(int index) const {
+  return _impl_.records_.Get(index);
+}
+inline const ::chirp::ReplicationRecord& ReplicationBatch::records(int index) const {
+  // @@protoc_insertion_point(field_get:chirp.ReplicationBatch.records)
+  return _internal_records(index);
+}
+inline ::chirp::ReplicationRecord* ReplicationBatch::_internal_add_records() {
+  return _impl_.records_.Add();
+}
+inline ::chirp::ReplicationRecord* ReplicationBatch::add_records() {
+  ::chirp::ReplicationRecord* _add = _internal_add_records();
+  // @@protoc_insertion_point(field_add:chirp.ReplicationBatch.records)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::chirp::ReplicationRecord >&
+ReplicationBatch::records() const {
+  // @@protoc_insertion_point(field_list:chirp.ReplicationBatch.records)
+  return _impl_.records_;
+}
+
+// uint64 lsn = 4;
+inline void ReplicationBatch::clear_lsn() {
+  _impl_.lsn_ = uint64_t{0u};
+}
+inline uint64_t ReplicationBatch::_internal_lsn() const {
+  return _impl_.lsn_;
+}
+inline uint64_t ReplicationBatch::lsn() const {
+  // @@protoc_insertion_point(field_get:chirp.ReplicationBatch.lsn)
+  return _internal_lsn();
+}
+inline void ReplicationBatch::_internal_set_lsn(uint64_t value) {
+  
+  _impl_.lsn_ = value;
+}
+inline void ReplicationBatch::set_lsn(uint64_t value) {
+  _internal_set_lsn(value);
+  // @@protoc_insertion_point(field_set:chirp.ReplicationBatch.lsn)
+}
+
+// -------------------------------------------------------------------
+
+// ReplicationAck
+
+// uint64 applied_lsn = 1;
+inline void ReplicationAck::clear_applied_lsn() {
+  _impl_.applied_lsn_ = uint64_t{0u};
+}
+inline uint64_t ReplicationAck::_internal_applied_lsn() const {
+  return _impl_.applied_lsn_;
+}
+inline uint64_t ReplicationAck::applied_lsn() const {
+  // @@protoc_insertion_point(field_get:chirp.ReplicationAck.applied_lsn)
+  return _internal_applied_lsn();
+}
+inline void ReplicationAck::_internal_set_applied_lsn(uint64_t value) {
+  
+  _impl_.applied_lsn_ = value;
+}
+inline void ReplicationAck::set_applied_lsn(uint64_t value) {
+  _internal_set_applied_lsn(value);
+  // @@protoc_insertion_point(field_set:chirp.ReplicationAck.applied_lsn)
+}
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic pop
+#endif  // __GNUC__
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+
+// @@protoc_insertion_point(namespace_scope)
+
+}  // namespace chirp
+
+// @@protoc_insertion_point(global_scope)
+
+#include <google/protobuf/port_undef.inc>
+#endif  // GOOGLE_PROTOBUF_INCLUDED_GOOGLE_PROTOBUF_INCLUDED_key_5fvalue_2eproto
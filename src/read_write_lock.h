@@ -0,0 +1,98 @@
+#ifndef CHIRP_SRC_READ_WRITE_LOCK_H_
+#define CHIRP_SRC_READ_WRITE_LOCK_H_
+
+#include <pthread.h>
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+
+// A reader/writer lock
+// Multiple readers can hold this lock at the same time while a writer holds it
+// exclusively. This wraps `pthread_rwlock_t` since `std::shared_mutex` is not
+// available in C++11.
+// The lock is first tried without blocking. Only when that fails is the wait
+// timed and counted, so an uncontended lock costs the same as before.
+class ReadWriteLock {
+ public:
+  ReadWriteLock() : num_of_contended_(0), wait_nanoseconds_(0) {
+    pthread_rwlock_init(&lock_, nullptr);
+  }
+  ~ReadWriteLock() { pthread_rwlock_destroy(&lock_); }
+
+  // This lock can be neither copied nor moved
+  ReadWriteLock(const ReadWriteLock &) = delete;
+  ReadWriteLock &operator=(const ReadWriteLock &) = delete;
+
+  inline void ReadLock() {
+    if (pthread_rwlock_tryrdlock(&lock_) != 0) {
+      Wait(pthread_rwlock_rdlock);
+    }
+  }
+  inline void WriteLock() {
+    if (pthread_rwlock_trywrlock(&lock_) != 0) {
+      Wait(pthread_rwlock_wrlock);
+    }
+  }
+  inline void Unlock() { pthread_rwlock_unlock(&lock_); }
+
+  // returns the number of times the lock was taken by someone else when it
+  // was asked for
+  inline uint64_t get_num_of_contended() const {
+    return num_of_contended_.load(std::memory_order_relaxed);
+  }
+
+  // returns the time spent waiting for the lock in those times
+  inline uint64_t get_wait_nanoseconds() const {
+    return wait_nanoseconds_.load(std::memory_order_relaxed);
+  }
+
+ private:
+  // Takes the lock with `lock`, which blocks, and counts the wait
+  void Wait(int (*lock)(pthread_rwlock_t *)) {
+    auto begin = std::chrono::steady_clock::now();
+    lock(&lock_);
+    num_of_contended_.fetch_add(1, std::memory_order_relaxed);
+    wait_nanoseconds_.fetch_add(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now() - begin)
+            .count(),
+        std::memory_order_relaxed);
+  }
+
+  pthread_rwlock_t lock_;
+  std::atomic<uint64_t> num_of_contended_;
+  std::atomic<uint64_t> wait_nanoseconds_;
+};
+
+// Holds a `ReadWriteLock` as a reader in this scope
+class ReaderLockGuard {
+ public:
+  explicit ReaderLockGuard(ReadWriteLock *lock) : lock_(lock) {
+    lock_->ReadLock();
+  }
+  ~ReaderLockGuard() { lock_->Unlock(); }
+
+  ReaderLockGuard(const ReaderLockGuard &) = delete;
+  ReaderLockGuard &operator=(const ReaderLockGuard &) = delete;
+
+ private:
+  ReadWriteLock *lock_;
+};
+
+// Holds a `ReadWriteLock` as a writer in this scope
+class WriterLockGuard {
+ public:
+  explicit WriterLockGuard(ReadWriteLock *lock) : lock_(lock) {
+    lock_->WriteLock();
+  }
+  ~WriterLockGuard() { lock_->Unlock(); }
+
+  WriterLockGuard(const WriterLockGuard &) = delete;
+  WriterLockGuard &operator=(const WriterLockGuard &) = delete;
+
+ private:
+  ReadWriteLock *lock_;
+};
+
+#endif /* CHIRP_SRC_READ_WRITE_LOCK_H_ */
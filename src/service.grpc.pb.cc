@@ -0,0 +1,247 @@
+// Generated by the gRPC C++ plugin.
+// If you make any local change, they will be lost.
+// source: service.proto
+
+#include "service.pb.h"
+#include "service.grpc.pb.h"
+
+#include <functional>
+#include <grpcpp/support/async_stream.h>
+#include <grpcpp/support/async_unary_call.h>
+#include <grpcpp/impl/channel_interface.h>
+#include <grpcpp/impl/client_unary_call.h>
+#include <grpcpp/support/client_callback.h>
+#include <grpcpp/support/message_allocator.h>
+#include <grpcpp/support/method_handler.h>
+#include <grpcpp/impl/rpc_service_method.h>
+#include <grpcpp/support/server_callback.h>
+#include <grpcpp/impl/codegen/server_callback_handlers.h>
+#include <grpcpp/server_context.h>
+#include <grpcpp/impl/service_type.h>
+#include <grpcpp/support/sync_stream.h>
+namespace chirp {
+
+static const char* ServiceLayer_method_names[] = {
+  "/chirp.ServiceLayer/registeruser",
+  "/chirp.ServiceLayer/chirp",
+  "/chirp.ServiceLayer/follow",
+  "/chirp.ServiceLayer/read",
+  "/chirp.ServiceLayer/monitor",
+};
+
+std::unique_ptr< ServiceLayer::Stub> ServiceLayer::NewStub(const std::shared_ptr< ::grpc::ChannelInterface>& channel, const ::grpc::StubOptions& options) {
+  (void)options;
+  std::unique_ptr< ServiceLayer::Stub> stub(new ServiceLayer::Stub(channel, options));
+  return stub;
+}
+
+ServiceLayer::Stub::Stub(const std::shared_ptr< ::grpc::ChannelInterface>& channel, const ::grpc::StubOptions& options)
+  : channel_(channel), rpcmethod_registeruser_(ServiceLayer_method_names[0], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
+  , rpcmethod_chirp_(ServiceLayer_method_names[1], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
+  , rpcmethod_follow_(ServiceLayer_method_names[2], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
+  , rpcmethod_read_(ServiceLayer_method_names[3], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
+  , rpcmethod_monitor_(ServiceLayer_method_names[4], options.suffix_for_stats(),::grpc::internal::RpcMethod::SERVER_STREAMING, channel)
+  {}
+
+::grpc::Status ServiceLayer::Stub::registeruser(::grpc::ClientContext* context, const ::chirp::RegisterRequest& request, ::chirp::RegisterReply* response) {
+  return ::grpc::internal::BlockingUnaryCall< ::chirp::RegisterRequest, ::chirp::RegisterReply, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), rpcmethod_registeruser_, context, request, response);
+}
+
+void ServiceLayer::Stub::async::registeruser(::grpc::ClientContext* context, const ::chirp::RegisterRequest* request, ::chirp::RegisterReply* response, std::function<void(::grpc::Status)> f) {
+  ::grpc::internal::CallbackUnaryCall< ::chirp::RegisterRequest, ::chirp::RegisterReply, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_registeruser_, context, request, response, std::move(f));
+}
+
+void ServiceLayer::Stub::async::registeruser(::grpc::ClientContext* context, const ::chirp::RegisterRequest* request, ::chirp::RegisterReply* response, ::grpc::ClientUnaryReactor* reactor) {
+  ::grpc::internal::ClientCallbackUnaryFactory::Create< ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_registeruser_, context, request, response, reactor);
+}
+
+::grpc::ClientAsyncResponseReader< ::chirp::RegisterReply>* ServiceLayer::Stub::PrepareAsyncregisteruserRaw(::grpc::ClientContext* context, const ::chirp::RegisterRequest& request, ::grpc::CompletionQueue* cq) {
+  return ::grpc::internal::ClientAsyncResponseReaderHelper::Create< ::chirp::RegisterReply, ::chirp::RegisterRequest, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), cq, rpcmethod_registeruser_, context, request);
+}
+
+::grpc::ClientAsyncResponseReader< ::chirp::RegisterReply>* ServiceLayer::Stub::AsyncregisteruserRaw(::grpc::ClientContext* context, const ::chirp::RegisterRequest& request, ::grpc::CompletionQueue* cq) {
+  auto* result =
+    this->PrepareAsyncregisteruserRaw(context, request, cq);
+  result->StartCall();
+  return result;
+}
+
+::grpc::Status ServiceLayer::Stub::chirp(::grpc::ClientContext* context, const ::chirp::ChirpRequest& request, ::chirp::ChirpReply* response) {
+  return ::grpc::internal::BlockingUnaryCall< ::chirp::ChirpRequest, ::chirp::ChirpReply, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), rpcmethod_chirp_, context, request, response);
+}
+
+void ServiceLayer::Stub::async::chirp(::grpc::ClientContext* context, const ::chirp::ChirpRequest* request, ::chirp::ChirpReply* response, std::function<void(::grpc::Status)> f) {
+  ::grpc::internal::CallbackUnaryCall< ::chirp::ChirpRequest, ::chirp::ChirpReply, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_chirp_, context, request, response, std::move(f));
+}
+
+void ServiceLayer::Stub::async::chirp(::grpc::ClientContext* context, const ::chirp::ChirpRequest* request, ::chirp::ChirpReply* response, ::grpc::ClientUnaryReactor* reactor) {
+  ::grpc::internal::ClientCallbackUnaryFactory::Create< ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_chirp_, context, request, response, reactor);
+}
+
+::grpc::ClientAsyncResponseReader< ::chirp::ChirpReply>* ServiceLayer::Stub::PrepareAsyncchirpRaw(::grpc::ClientContext* context, const ::chirp::ChirpRequest& request, ::grpc::CompletionQueue* cq) {
+  return ::grpc::internal::ClientAsyncResponseReaderHelper::Create< ::chirp::ChirpReply, ::chirp::ChirpRequest, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), cq, rpcmethod_chirp_, context, request);
+}
+
+::grpc::ClientAsyncResponseReader< ::chirp::ChirpReply>* ServiceLayer::Stub::AsyncchirpRaw(::grpc::ClientContext* context, const ::chirp::ChirpRequest& request, ::grpc::CompletionQueue* cq) {
+  auto* result =
+    this->PrepareAsyncchirpRaw(context, request, cq);
+  result->StartCall();
+  return result;
+}
+
+::grpc::Status ServiceLayer::Stub::follow(::grpc::ClientContext* context, const ::chirp::FollowRequest& request, ::chirp::FollowReply* response) {
+  return ::grpc::internal::BlockingUnaryCall< ::chirp::FollowRequest, ::chirp::FollowReply, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), rpcmethod_follow_, context, request, response);
+}
+
+void ServiceLayer::Stub::async::follow(::grpc::ClientContext* context, const ::chirp::FollowRequest* request, ::chirp::FollowReply* response, std::function<void(::grpc::Status)> f) {
+  ::grpc::internal::CallbackUnaryCall< ::chirp::FollowRequest, ::chirp::FollowReply, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_follow_, context, request, response, std::move(f));
+}
+
+void ServiceLayer::Stub::async::follow(::grpc::ClientContext* context, const ::chirp::FollowRequest* request, ::chirp::FollowReply* response, ::grpc::ClientUnaryReactor* reactor) {
+  ::grpc::internal::ClientCallbackUnaryFactory::Create< ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_follow_, context, request, response, reactor);
+}
+
+::grpc::ClientAsyncResponseReader< ::chirp::FollowReply>* ServiceLayer::Stub::PrepareAsyncfollowRaw(::grpc::ClientContext* context, const ::chirp::FollowRequest& request, ::grpc::CompletionQueue* cq) {
+  return ::grpc::internal::ClientAsyncResponseReaderHelper::Create< ::chirp::FollowReply, ::chirp::FollowRequest, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), cq, rpcmethod_follow_, context, request);
+}
+
+::grpc::ClientAsyncResponseReader< ::chirp::FollowReply>* ServiceLayer::Stub::AsyncfollowRaw(::grpc::ClientContext* context, const ::chirp::FollowRequest& request, ::grpc::CompletionQueue* cq) {
+  auto* result =
+    this->PrepareAsyncfollowRaw(context, request, cq);
+  result->StartCall();
+  return result;
+}
+
+::grpc::Status ServiceLayer::Stub::read(::grpc::ClientContext* context, const ::chirp::ReadRequest& request, ::chirp::ReadReply* response) {
+  return ::grpc::internal::BlockingUnaryCall< ::chirp::ReadRequest, ::chirp::ReadReply, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), rpcmethod_read_, context, request, response);
+}
+
+void ServiceLayer::Stub::async::read(::grpc::ClientContext* context, const ::chirp::ReadRequest* request, ::chirp::ReadReply* response, std::function<void(::grpc::Status)> f) {
+  ::grpc::internal::CallbackUnaryCall< ::chirp::ReadRequest, ::chirp::ReadReply, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_read_, context, request, response, std::move(f));
+}
+
+void ServiceLayer::Stub::async::read(::grpc::ClientContext* context, const ::chirp::ReadRequest* request, ::chirp::ReadReply* response, ::grpc::ClientUnaryReactor* reactor) {
+  ::grpc::internal::ClientCallbackUnaryFactory::Create< ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_read_, context, request, response, reactor);
+}
+
+::grpc::ClientAsyncResponseReader< ::chirp::ReadReply>* ServiceLayer::Stub::PrepareAsyncreadRaw(::grpc::ClientContext* context, const ::chirp::ReadRequest& request, ::grpc::CompletionQueue* cq) {
+  return ::grpc::internal::ClientAsyncResponseReaderHelper::Create< ::chirp::ReadReply, ::chirp::ReadRequest, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), cq, rpcmethod_read_, context, request);
+}
+
+::grpc::ClientAsyncResponseReader< ::chirp::ReadReply>* ServiceLayer::Stub::AsyncreadRaw(::grpc::ClientContext* context, const ::chirp::ReadRequest& request, ::grpc::CompletionQueue* cq) {
+  auto* result =
+    this->PrepareAsyncreadRaw(context, request, cq);
+  result->StartCall();
+  return result;
+}
+
+::grpc::ClientReader< ::chirp::MonitorReply>* ServiceLayer::Stub::monitorRaw(::grpc::ClientContext* context, const ::chirp::MonitorRequest& request) {
+  return ::grpc::internal::ClientReaderFactory< ::chirp::MonitorReply>::Create(channel_.get(), rpcmethod_monitor_, context, request);
+}
+
+void ServiceLayer::Stub::async::monitor(::grpc::ClientContext* context, const ::chirp::MonitorRequest* request, ::grpc::ClientReadReactor< ::chirp::MonitorReply>* reactor) {
+  ::grpc::internal::ClientCallbackReaderFactory< ::chirp::MonitorReply>::Create(stub_->channel_.get(), stub_->rpcmethod_monitor_, context, request, reactor);
+}
+
+::grpc::ClientAsyncReader< ::chirp::MonitorReply>* ServiceLayer::Stub::AsyncmonitorRaw(::grpc::ClientContext* context, const ::chirp::MonitorRequest& request, ::grpc::CompletionQueue* cq, void* tag) {
+  return ::grpc::internal::ClientAsyncReaderFactory< ::chirp::MonitorReply>::Create(channel_.get(), cq, rpcmethod_monitor_, context, request, true, tag);
+}
+
+::grpc::ClientAsyncReader< ::chirp::MonitorReply>* ServiceLayer::Stub::PrepareAsyncmonitorRaw(::grpc::ClientContext* context, const ::chirp::MonitorRequest& request, ::grpc::CompletionQueue* cq) {
+  return ::grpc::internal::ClientAsyncReaderFactory< ::chirp::MonitorReply>::Create(channel_.get(), cq, rpcmethod_monitor_, context, request, false, nullptr);
+}
+
+ServiceLayer::Service::Service() {
+  AddMethod(new ::grpc::internal::RpcServiceMethod(
+      ServiceLayer_method_names[0],
+      ::grpc::internal::RpcMethod::NORMAL_RPC,
+      new ::grpc::internal::RpcMethodHandler< ServiceLayer::Service, ::chirp::RegisterRequest, ::chirp::RegisterReply, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(
+          [](ServiceLayer::Service* service,
+             ::grpc::ServerContext* ctx,
+             const ::chirp::RegisterRequest* req,
+             ::chirp::RegisterReply* resp) {
+               return service->registeruser(ctx, req, resp);
+             }, this)));
+  AddMethod(new ::grpc::internal::RpcServiceMethod(
+      ServiceLayer_method_names[1],
+      ::grpc::internal::RpcMethod::NORMAL_RPC,
+      new ::grpc::internal::RpcMethodHandler< ServiceLayer::Service, ::chirp::ChirpRequest, ::chirp::ChirpReply, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(
+          [](ServiceLayer::Service* service,
+             ::grpc::ServerContext* ctx,
+             const ::chirp::ChirpRequest* req,
+             ::chirp::ChirpReply* resp) {
+               return service->chirp(ctx, req, resp);
+             }, this)));
+  AddMethod(new ::grpc::internal::RpcServiceMethod(
+      ServiceLayer_method_names[2],
+      ::grpc::internal::RpcMethod::NORMAL_RPC,
+      new ::grpc::internal::RpcMethodHandler< ServiceLayer::Service, ::chirp::FollowRequest, ::chirp::FollowReply, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(
+          [](ServiceLayer::Service* service,
+             ::grpc::ServerContext* ctx,
+             const ::chirp::FollowRequest* req,
+             ::chirp::FollowReply* resp) {
+               return service->follow(ctx, req, resp);
+             }, this)));
+  AddMethod(new ::grpc::internal::RpcServiceMethod(
+      ServiceLayer_method_names[3],
+      ::grpc::internal::RpcMethod::NORMAL_RPC,
+      new ::grpc::internal::RpcMethodHandler< ServiceLayer::Service, ::chirp::ReadRequest, ::chirp::ReadReply, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(
+          [](ServiceLayer::Service* service,
+             ::grpc::ServerContext* ctx,
+             const ::chirp::ReadRequest* req,
+             ::chirp::ReadReply* resp) {
+               return service->read(ctx, req, resp);
+             }, this)));
+  AddMethod(new ::grpc::internal::RpcServiceMethod(
+      ServiceLayer_method_names[4],
+      ::grpc::internal::RpcMethod::SERVER_STREAMING,
+      new ::grpc::internal::ServerStreamingHandler< ServiceLayer::Service, ::chirp::MonitorRequest, ::chirp::MonitorReply>(
+          [](ServiceLayer::Service* service,
+             ::grpc::ServerContext* ctx,
+             const ::chirp::MonitorRequest* req,
+             ::grpc::ServerWriter<::chirp::MonitorReply>* writer) {
+               return service->monitor(ctx, req, writer);
+             }, this)));
+}
+
+ServiceLayer::Service::~Service() {
+}
+
+::grpc::Status ServiceLayer::Service::registeruser(::grpc::ServerContext* context, const ::chirp::RegisterRequest* request, ::chirp::RegisterReply* response) {
+  (void) context;
+  (void) request;
+  (void) response;
+  return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+}
+
+::grpc::Status ServiceLayer::Service::chirp(::grpc::ServerContext* context, const ::chirp::ChirpRequest* request, ::chirp::ChirpReply* response) {
+  (void) context;
+  (void) request;
+  (void) response;
+  return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+}
+
+::grpc::Status ServiceLayer::Service::follow(::grpc::ServerContext* context, const ::chirp::FollowRequest* request, ::chirp::FollowReply* response) {
+  (void) context;
+  (void) request;
+  (void) response;
+  return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+}
+
+::grpc::Status ServiceLayer::Service::read(::grpc::ServerContext* context, const ::chirp::ReadRequest* request, ::chirp::ReadReply* response) {
+  (void) context;
+  (void) request;
+  (void) response;
+  return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+}
+
+::grpc::Status ServiceLayer::Service::monitor(::grpc::ServerContext* context, const ::chirp::MonitorRequest* request, ::grpc::ServerWriter< ::chirp::MonitorReply>* writer) {
+  (void) context;
+  (void) request;
+  (void) writer;
+  return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+}
+
+
+}  // namespace chirp
+
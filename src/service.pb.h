@@ -0,0 +1,3040 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: service.proto
+
+#ifndef GOOGLE_PROTOBUF_INCLUDED_service_2eproto
+#define GOOGLE_PROTOBUF_INCLUDED_service_2eproto
+
+#include <limits>
+#include <string>
+
+#include <google/protobuf/port_def.inc>
+#if PROTOBUF_VERSION < 3021000
+#error This file was generated by a newer version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please update
+#error your headers.
+#endif
+#if 3021012 < PROTOBUF_MIN_PROTOC_VERSION
+#error This file was generated by an older version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please
+#error regenerate this file with a newer version of protoc.
+#endif
+
+#include <google/protobuf/port_undef.inc>
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/arena.h>
+#include <google/protobuf/arenastring.h>
+#include <google/protobuf/generated_message_bases.h>
+#include <google/protobuf/generated_message_util.h>
+#include <google/protobuf/metadata_lite.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/message.h>
+#include <google/protobuf/repeated_field.h>  // IWYU pragma: export
+#include <google/protobuf/extension_set.h>  // IWYU pragma: export
+#include <google/protobuf/unknown_field_set.h>
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+#define PROTOBUF_INTERNAL_EXPORT_service_2eproto
+PROTOBUF_NAMESPACE_OPEN
+namespace internal {
+class AnyMetadata;
+}  // namespace internal
+PROTOBUF_NAMESPACE_CLOSE
+
+// Internal implementation detail -- do not use these members.
+struct TableStruct_service_2eproto {
+  static const uint32_t offsets[];
+};
+extern const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_service_2eproto;
+namespace chirp {
+class Chirp;
+struct ChirpDefaultTypeInternal;
+extern ChirpDefaultTypeInternal _Chirp_default_instance_;
+class ChirpReply;
+struct ChirpReplyDefaultTypeInternal;
+extern ChirpReplyDefaultTypeInternal _ChirpReply_default_instance_;
+class ChirpRequest;
+struct ChirpRequestDefaultTypeInternal;
+extern ChirpRequestDefaultTypeInternal _ChirpRequest_default_instance_;
+class FollowReply;
+struct FollowReplyDefaultTypeInternal;
+extern FollowReplyDefaultTypeInternal _FollowReply_default_instance_;
+class FollowRequest;
+struct FollowRequestDefaultTypeInternal;
+extern FollowRequestDefaultTypeInternal _FollowRequest_default_instance_;
+class MonitorReply;
+struct MonitorReplyDefaultTypeInternal;
+extern MonitorReplyDefaultTypeInternal _MonitorReply_default_instance_;
+class MonitorRequest;
+struct MonitorRequestDefaultTypeInternal;
+extern MonitorRequestDefaultTypeInternal _MonitorRequest_default_instance_;
+class ReadReply;
+struct ReadReplyDefaultTypeInternal;
+extern ReadReplyDefaultTypeInternal _ReadReply_default_instance_;
+class ReadRequest;
+struct ReadRequestDefaultTypeInternal;
+extern ReadRequestDefaultTypeInternal _ReadRequest_default_instance_;
+class RegisterReply;
+struct RegisterReplyDefaultTypeInternal;
+extern RegisterReplyDefaultTypeInternal _RegisterReply_default_instance_;
+class RegisterRequest;
+struct RegisterRequestDefaultTypeInternal;
+extern RegisterRequestDefaultTypeInternal _RegisterRequest_default_instance_;
+class Timestamp;
+struct TimestampDefaultTypeInternal;
+extern TimestampDefaultTypeInternal _Timestamp_default_instance_;
+}  // namespace chirp
+PROTOBUF_NAMESPACE_OPEN
+template<> ::chirp::Chirp* Arena::CreateMaybeMessage<::chirp::Chirp>(Arena*);
+template<> ::chirp::ChirpReply* Arena::CreateMaybeMessage<::chirp::ChirpReply>(Arena*);
+template<> ::chirp::ChirpRequest* Arena::CreateMaybeMessage<::chirp::ChirpRequest>(Arena*);
+template<> ::chirp::FollowReply* Arena::CreateMaybeMessage<::chirp::FollowReply>(Arena*);
+template<> ::chirp::FollowRequest* Arena::CreateMaybeMessage<::chirp::FollowRequest>(Arena*);
+template<> ::chirp::MonitorReply* Arena::CreateMaybeMessage<::chirp::MonitorReply>(Arena*);
+template<> ::chirp::MonitorRequest* Arena::CreateMaybeMessage<::chirp::MonitorRequest>(Arena*);
+template<> ::chirp::ReadReply* Arena::CreateMaybeMessage<::chirp::ReadReply>(Arena*);
+template<> ::chirp::ReadRequest* Arena::CreateMaybeMessage<::chirp::ReadRequest>(Arena*);
+template<> ::chirp::RegisterReply* Arena::CreateMaybeMessage<::chirp::RegisterReply>(Arena*);
+template<> ::chirp::RegisterRequest* Arena::CreateMaybeMessage<::chirp::RegisterRequest>(Arena*);
+template<> ::chirp::Timestamp* Arena::CreateMaybeMessage<::chirp::Timestamp>(Arena*);
+PROTOBUF_NAMESPACE_CLOSE
+namespace chirp {
+
+// ===================================================================
+
+class Timestamp final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:chirp.Timestamp) */ {
+ public:
+  inline Timestamp() : Timestamp(nullptr) {}
+  ~Timestamp() override;
+  explicit PROTOBUF_CONSTEXPR Timestamp(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  Timestamp(const Timestamp& from);
+  Timestamp(Timestamp&& from) noexcept
+    : Timestamp() {
+    *this = ::std::move(from);
+  }
+
+  inline Timestamp& operator=(const Timestamp& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline Timestamp& operator=(Timestamp&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const Timestamp& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const Timestamp* internal_default_instance() {
+    return reinterpret_cast<const Timestamp*>(
+               &_Timestamp_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    0;
+
+  friend void swap(Timestamp& a, Timestamp& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(Timestamp* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(Timestamp* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  Timestamp* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<Timestamp>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const Timestamp& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const Timestamp& from) {
+    Timestamp::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(Timestamp* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "chirp.Timestamp";
+  }
+  protected:
+  explicit Timestamp(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kSecondsFieldNumber = 1,
+    kUsecondsFieldNumber = 2,
+  };
+  // int64 seconds = 1;
+  void clear_seconds();
+  int64_t seconds() const;
+  void set_seconds(int64_t value);
+  private:
+  int64_t _internal_seconds() const;
+  void _internal_set_seconds(int64_t value);
+  public:
+
+  // int64 useconds = 2;
+  void clear_useconds();
+  int64_t useconds() const;
+  void set_useconds(int64_t value);
+  private:
+  int64_t _internal_useconds() const;
+  void _internal_set_useconds(int64_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:chirp.Timestamp)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    int64_t seconds_;
+    int64_t useconds_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_service_2eproto;
+};
+// -------------------------------------------------------------------
+
+class Chirp final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:chirp.Chirp) */ {
+ public:
+  inline Chirp() : Chirp(nullptr) {}
+  ~Chirp() override;
+  explicit PROTOBUF_CONSTEXPR Chirp(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  Chirp(const Chirp& from);
+  Chirp(Chirp&& from) noexcept
+    : Chirp() {
+    *this = ::std::move(from);
+  }
+
+  inline Chirp& operator=(const Chirp& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline Chirp& operator=(Chirp&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const Chirp& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const Chirp* internal_default_instance() {
+    return reinterpret_cast<const Chirp*>(
+               &_Chirp_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    1;
+
+  friend void swap(Chirp& a, Chirp& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(Chirp* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(Chirp* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  Chirp* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<Chirp>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const Chirp& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const Chirp& from) {
+    Chirp::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(Chirp* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "chirp.Chirp";
+  }
+  protected:
+  explicit Chirp(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kUsernameFieldNumber = 1,
+    kTextFieldNumber = 2,
+    kIdFieldNumber = 3,
+    kParentIdFieldNumber = 4,
+    kTimestampFieldNumber = 5,
+  };
+  // string username = 1;
+  void clear_username();
+  const std::string& username() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_username(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_username();
+  PROTOBUF_NODISCARD std::string* release_username();
+  void set_allocated_username(std::string* username);
+  private:
+  const std::string& _internal_username() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_username(const std::string& value);
+  std::string* _internal_mutable_username();
+  public:
+
+  // string text = 2;
+  void clear_text();
+  const std::string& text() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_text(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_text();
+  PROTOBUF_NODISCARD std::string* release_text();
+  void set_allocated_text(std::string* text);
+  private:
+  const std::string& _internal_text() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_text(const std::string& value);
+  std::string* _internal_mutable_text();
+  public:
+
+  // bytes id = 3;
+  void clear_id();
+  const std::string& id() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_id(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_id();
+  PROTOBUF_NODISCARD std::string* release_id();
+  void set_allocated_id(std::string* id);
+  private:
+  const std::string& _internal_id() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_id(const std::string& value);
+  std::string* _internal_mutable_id();
+  public:
+
+  // bytes parent_id = 4;
+  void clear_parent_id();
+  const std::string& parent_id() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_parent_id(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_parent_id();
+  PROTOBUF_NODISCARD std::string* release_parent_id();
+  void set_allocated_parent_id(std::string* parent_id);
+  private:
+  const std::string& _internal_parent_id() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_parent_id(const std::string& value);
+  std::string* _internal_mutable_parent_id();
+  public:
+
+  // .chirp.Timestamp timestamp = 5;
+  bool has_timestamp() const;
+  private:
+  bool _internal_has_timestamp() const;
+  public:
+  void clear_timestamp();
+  const ::chirp::Timestamp& timestamp() const;
+  PROTOBUF_NODISCARD ::chirp::Timestamp* release_timestamp();
+  ::chirp::Timestamp* mutable_timestamp();
+  void set_allocated_timestamp(::chirp::Timestamp* timestamp);
+  private:
+  const ::chirp::Timestamp& _internal_timestamp() const;
+  ::chirp::Timestamp* _internal_mutable_timestamp();
+  public:
+  void unsafe_arena_set_allocated_timestamp(
+      ::chirp::Timestamp* timestamp);
+  ::chirp::Timestamp* unsafe_arena_release_timestamp();
+
+  // @@protoc_insertion_point(class_scope:chirp.Chirp)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr username_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr text_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr id_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr parent_id_;
+    ::chirp::Timestamp* timestamp_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_service_2eproto;
+};
+// -------------------------------------------------------------------
+
+class RegisterRequest final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:chirp.RegisterRequest) */ {
+ public:
+  inline RegisterRequest() : RegisterRequest(nullptr) {}
+  ~RegisterRequest() override;
+  explicit PROTOBUF_CONSTEXPR RegisterRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  RegisterRequest(const RegisterRequest& from);
+  RegisterRequest(RegisterRequest&& from) noexcept
+    : RegisterRequest() {
+    *this = ::std::move(from);
+  }
+
+  inline RegisterRequest& operator=(const RegisterRequest& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline RegisterRequest& operator=(RegisterRequest&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const RegisterRequest& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const RegisterRequest* internal_default_instance() {
+    return reinterpret_cast<const RegisterRequest*>(
+               &_RegisterRequest_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    2;
+
+  friend void swap(RegisterRequest& a, RegisterRequest& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(RegisterRequest* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(RegisterRequest* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  RegisterRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<RegisterRequest>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const RegisterRequest& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const RegisterRequest& from) {
+    RegisterRequest::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(RegisterRequest* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "chirp.RegisterRequest";
+  }
+  protected:
+  explicit RegisterRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kUsernameFieldNumber = 1,
+  };
+  // string username = 1;
+  void clear_username();
+  const std::string& username() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_username(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_username();
+  PROTOBUF_NODISCARD std::string* release_username();
+  void set_allocated_username(std::string* username);
+  private:
+  const std::string& _internal_username() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_username(const std::string& value);
+  std::string* _internal_mutable_username();
+  public:
+
+  // @@protoc_insertion_point(class_scope:chirp.RegisterRequest)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr username_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_service_2eproto;
+};
+// -------------------------------------------------------------------
+
+class RegisterReply final :
+    public ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase /* @@protoc_insertion_point(class_definition:chirp.RegisterReply) */ {
+ public:
+  inline RegisterReply() : RegisterReply(nullptr) {}
+  explicit PROTOBUF_CONSTEXPR RegisterReply(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  RegisterReply(const RegisterReply& from);
+  RegisterReply(RegisterReply&& from) noexcept
+    : RegisterReply() {
+    *this = ::std::move(from);
+  }
+
+  inline RegisterReply& operator=(const RegisterReply& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline RegisterReply& operator=(RegisterReply&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const RegisterReply& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const RegisterReply* internal_default_instance() {
+    return reinterpret_cast<const RegisterReply*>(
+               &_RegisterReply_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    3;
+
+  friend void swap(RegisterReply& a, RegisterReply& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(RegisterReply* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(RegisterReply* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  RegisterReply* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<RegisterReply>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::CopyFrom;
+  inline void CopyFrom(const RegisterReply& from) {
+    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::CopyImpl(*this, from);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::MergeFrom;
+  void MergeFrom(const RegisterReply& from) {
+    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::MergeImpl(*this, from);
+  }
+  public:
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "chirp.RegisterReply";
+  }
+  protected:
+  explicit RegisterReply(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  // @@protoc_insertion_point(class_scope:chirp.RegisterReply)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+  };
+  friend struct ::TableStruct_service_2eproto;
+};
+// -------------------------------------------------------------------
+
+class ChirpRequest final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:chirp.ChirpRequest) */ {
+ public:
+  inline ChirpRequest() : ChirpRequest(nullptr) {}
+  ~ChirpRequest() override;
+  explicit PROTOBUF_CONSTEXPR ChirpRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  ChirpRequest(const ChirpRequest& from);
+  ChirpRequest(ChirpRequest&& from) noexcept
+    : ChirpRequest() {
+    *this = ::std::move(from);
+  }
+
+  inline ChirpRequest& operator=(const ChirpRequest& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline ChirpRequest& operator=(ChirpRequest&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ChirpRequest& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const ChirpRequest* internal_default_instance() {
+    return reinterpret_cast<const ChirpRequest*>(
+               &_ChirpRequest_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    4;
+
+  friend void swap(ChirpRequest& a, ChirpRequest& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(ChirpRequest* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ChirpRequest* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  ChirpRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ChirpRequest>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const ChirpRequest& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const ChirpRequest& from) {
+    ChirpRequest::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(ChirpRequest* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "chirp.ChirpRequest";
+  }
+  protected:
+  explicit ChirpRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kUsernameFieldNumber = 1,
+    kTextFieldNumber = 2,
+    kParentIdFieldNumber = 3,
+  };
+  // string username = 1;
+  void clear_username();
+  const std::string& username() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_username(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_username();
+  PROTOBUF_NODISCARD std::string* release_username();
+  void set_allocated_username(std::string* username);
+  private:
+  const std::string& _internal_username() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_username(const std::string& value);
+  std::string* _internal_mutable_username();
+  public:
+
+  // string text = 2;
+  void clear_text();
+  const std::string& text() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_text(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_text();
+  PROTOBUF_NODISCARD std::string* release_text();
+  void set_allocated_text(std::string* text);
+  private:
+  const std::string& _internal_text() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_text(const std::string& value);
+  std::string* _internal_mutable_text();
+  public:
+
+  // bytes parent_id = 3;
+  void clear_parent_id();
+  const std::string& parent_id() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_parent_id(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_parent_id();
+  PROTOBUF_NODISCARD std::string* release_parent_id();
+  void set_allocated_parent_id(std::string* parent_id);
+  private:
+  const std::string& _internal_parent_id() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_parent_id(const std::string& value);
+  std::string* _internal_mutable_parent_id();
+  public:
+
+  // @@protoc_insertion_point(class_scope:chirp.ChirpRequest)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr username_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr text_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr parent_id_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_service_2eproto;
+};
+// -------------------------------------------------------------------
+
+class ChirpReply final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:chirp.ChirpReply) */ {
+ public:
+  inline ChirpReply() : ChirpReply(nullptr) {}
+  ~ChirpReply() override;
+  explicit PROTOBUF_CONSTEXPR ChirpReply(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  ChirpReply(const ChirpReply& from);
+  ChirpReply(ChirpReply&& from) noexcept
+    : ChirpReply() {
+    *this = ::std::move(from);
+  }
+
+  inline ChirpReply& operator=(const ChirpReply& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline ChirpReply& operator=(ChirpReply&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ChirpReply& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const ChirpReply* internal_default_instance() {
+    return reinterpret_cast<const ChirpReply*>(
+               &_ChirpReply_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    5;
+
+  friend void swap(ChirpReply& a, ChirpReply& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(ChirpReply* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ChirpReply* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  ChirpReply* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ChirpReply>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const ChirpReply& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const ChirpReply& from) {
+    ChirpReply::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(ChirpReply* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "chirp.ChirpReply";
+  }
+  protected:
+  explicit ChirpReply(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kChirpFieldNumber = 1,
+  };
+  // .chirp.Chirp chirp = 1;
+  bool has_chirp() const;
+  private:
+  bool _internal_has_chirp() const;
+  public:
+  void clear_chirp();
+  const ::chirp::Chirp& chirp() const;
+  PROTOBUF_NODISCARD ::chirp::Chirp* release_chirp();
+  ::chirp::Chirp* mutable_chirp();
+  void set_allocated_chirp(::chirp::Chirp* chirp);
+  private:
+  const ::chirp::Chirp& _internal_chirp() const;
+  ::chirp::Chirp* _internal_mutable_chirp();
+  public:
+  void unsafe_arena_set_allocated_chirp(
+      ::chirp::Chirp* chirp);
+  ::chirp::Chirp* unsafe_arena_release_chirp();
+
+  // @@protoc_insertion_point(class_scope:chirp.ChirpReply)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::chirp::Chirp* chirp_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_service_2eproto;
+};
+// -------------------------------------------------------------------
+
+class FollowRequest final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:chirp.FollowRequest) */ {
+ public:
+  inline FollowRequest() : FollowRequest(nullptr) {}
+  ~FollowRequest() override;
+  explicit PROTOBUF_CONSTEXPR FollowRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  FollowRequest(const FollowRequest& from);
+  FollowRequest(FollowRequest&& from) noexcept
+    : FollowRequest() {
+    *this = ::std::move(from);
+  }
+
+  inline FollowRequest& operator=(const FollowRequest& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline FollowRequest& operator=(FollowRequest&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const FollowRequest& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const FollowRequest* internal_default_instance() {
+    return reinterpret_cast<const FollowRequest*>(
+               &_FollowRequest_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    6;
+
+  friend void swap(FollowRequest& a, FollowRequest& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(FollowRequest* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(FollowRequest* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  FollowRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<FollowRequest>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const FollowRequest& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const FollowRequest& from) {
+    FollowRequest::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(FollowRequest* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "chirp.FollowRequest";
+  }
+  protected:
+  explicit FollowRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kUsernameFieldNumber = 1,
+    kToFollowFieldNumber = 2,
+  };
+  // string username = 1;
+  void clear_username();
+  const std::string& username() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_username(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_username();
+  PROTOBUF_NODISCARD std::string* release_username();
+  void set_allocated_username(std::string* username);
+  private:
+  const std::string& _internal_username() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_username(const std::string& value);
+  std::string* _internal_mutable_username();
+  public:
+
+  // string to_follow = 2;
+  void clear_to_follow();
+  const std::string& to_follow() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_to_follow(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_to_follow();
+  PROTOBUF_NODISCARD std::string* release_to_follow();
+  void set_allocated_to_follow(std::string* to_follow);
+  private:
+  const std::string& _internal_to_follow() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_to_follow(const std::string& value);
+  std::string* _internal_mutable_to_follow();
+  public:
+
+  // @@protoc_insertion_point(class_scope:chirp.FollowRequest)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr username_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr to_follow_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_service_2eproto;
+};
+// -------------------------------------------------------------------
+
+class FollowReply final :
+    public ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase /* @@protoc_insertion_point(class_definition:chirp.FollowReply) */ {
+ public:
+  inline FollowReply() : FollowReply(nullptr) {}
+  explicit PROTOBUF_CONSTEXPR FollowReply(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  FollowReply(const FollowReply& from);
+  FollowReply(FollowReply&& from) noexcept
+    : FollowReply() {
+    *this = ::std::move(from);
+  }
+
+  inline FollowReply& operator=(const FollowReply& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline FollowReply& operator=(FollowReply&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const FollowReply& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const FollowReply* internal_default_instance() {
+    return reinterpret_cast<const FollowReply*>(
+               &_FollowReply_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    7;
+
+  friend void swap(FollowReply& a, FollowReply& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(FollowReply* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(FollowReply* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  FollowReply* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<FollowReply>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::CopyFrom;
+  inline void CopyFrom(const FollowReply& from) {
+    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::CopyImpl(*this, from);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::MergeFrom;
+  void MergeFrom(const FollowReply& from) {
+    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::MergeImpl(*this, from);
+  }
+  public:
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "chirp.FollowReply";
+  }
+  protected:
+  explicit FollowReply(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  // @@protoc_insertion_point(class_scope:chirp.FollowReply)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+  };
+  friend struct ::TableStruct_service_2eproto;
+};
+// -------------------------------------------------------------------
+
+class ReadRequest final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:chirp.ReadRequest) */ {
+ public:
+  inline ReadRequest() : ReadRequest(nullptr) {}
+  ~ReadRequest() override;
+  explicit PROTOBUF_CONSTEXPR ReadRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  ReadRequest(const ReadRequest& from);
+  ReadRequest(ReadRequest&& from) noexcept
+    : ReadRequest() {
+    *this = ::std::move(from);
+  }
+
+  inline ReadRequest& operator=(const ReadRequest& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline ReadRequest& operator=(ReadRequest&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ReadRequest& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const ReadRequest* internal_default_instance() {
+    return reinterpret_cast<const ReadRequest*>(
+               &_ReadRequest_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    8;
+
+  friend void swap(ReadRequest& a, ReadRequest& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(ReadRequest* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ReadRequest* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  ReadRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ReadRequest>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const ReadRequest& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const ReadRequest& from) {
+    ReadRequest::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(ReadRequest* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "chirp.ReadRequest";
+  }
+  protected:
+  explicit ReadRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kChirpIdFieldNumber = 1,
+  };
+  // bytes chirp_id = 1;
+  void clear_chirp_id();
+  const std::string& chirp_id() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_chirp_id(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_chirp_id();
+  PROTOBUF_NODISCARD std::string* release_chirp_id();
+  void set_allocated_chirp_id(std::string* chirp_id);
+  private:
+  const std::string& _internal_chirp_id() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_chirp_id(const std::string& value);
+  std::string* _internal_mutable_chirp_id();
+  public:
+
+  // @@protoc_insertion_point(class_scope:chirp.ReadRequest)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr chirp_id_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_service_2eproto;
+};
+// -------------------------------------------------------------------
+
+class ReadReply final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:chirp.ReadReply) */ {
+ public:
+  inline ReadReply() : ReadReply(nullptr) {}
+  ~ReadReply() override;
+  explicit PROTOBUF_CONSTEXPR ReadReply(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  ReadReply(const ReadReply& from);
+  ReadReply(ReadReply&& from) noexcept
+    : ReadReply() {
+    *this = ::std::move(from);
+  }
+
+  inline ReadReply& operator=(const ReadReply& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline ReadReply& operator=(ReadReply&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ReadReply& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const ReadReply* internal_default_instance() {
+    return reinterpret_cast<const ReadReply*>(
+               &_ReadReply_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    9;
+
+  friend void swap(ReadReply& a, ReadReply& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(ReadReply* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ReadReply* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  ReadReply* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ReadReply>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const ReadReply& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const ReadReply& from) {
+    ReadReply::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(ReadReply* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "chirp.ReadReply";
+  }
+  protected:
+  explicit ReadReply(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kChirpsFieldNumber = 1,
+  };
+  // repeated .chirp.Chirp chirps = 1;
+  int chirps_size() const;
+  private:
+  int _internal_chirps_size() const;
+  public:
+  void clear_chirps();
+  ::chirp::Chirp* mutable_chirps(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::chirp::Chirp >*
+      mutable_chirps();
+  private:
+  const ::chirp::Chirp& _internal_chirps(int index) const;
+  ::chirp::Chirp* _internal_add_chirps();
+  public:
+  const ::chirp::Chirp& chirps(int index) const;
+  ::chirp::Chirp* add_chirps();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::chirp::Chirp >&
+      chirps() const;
+
+  // @@protoc_insertion_point(class_scope:chirp.ReadReply)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::chirp::Chirp > chirps_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_service_2eproto;
+};
+// -------------------------------------------------------------------
+
+class MonitorRequest final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:chirp.MonitorRequest) */ {
+ public:
+  inline MonitorRequest() : MonitorRequest(nullptr) {}
+  ~MonitorRequest() override;
+  explicit PROTOBUF_CONSTEXPR MonitorRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  MonitorRequest(const MonitorRequest& from);
+  MonitorRequest(MonitorRequest&& from) noexcept
+    : MonitorRequest() {
+    *this = ::std::move(from);
+  }
+
+  inline MonitorRequest& operator=(const MonitorRequest& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline MonitorRequest& operator=(MonitorRequest&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const MonitorRequest& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const MonitorRequest* internal_default_instance() {
+    return reinterpret_cast<const MonitorRequest*>(
+               &_MonitorRequest_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    10;
+
+  friend void swap(MonitorRequest& a, MonitorRequest& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(MonitorRequest* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(MonitorRequest* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  MonitorRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<MonitorRequest>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const MonitorRequest& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const MonitorRequest& from) {
+    MonitorRequest::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(MonitorRequest* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "chirp.MonitorRequest";
+  }
+  protected:
+  explicit MonitorRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kUsernameFieldNumber = 1,
+  };
+  // string username = 1;
+  void clear_username();
+  const std::string& username() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_username(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_username();
+  PROTOBUF_NODISCARD std::string* release_username();
+  void set_allocated_username(std::string* username);
+  private:
+  const std::string& _internal_username() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_username(const std::string& value);
+  std::string* _internal_mutable_username();
+  public:
+
+  // @@protoc_insertion_point(class_scope:chirp.MonitorRequest)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr username_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_service_2eproto;
+};
+// -------------------------------------------------------------------
+
+class MonitorReply final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:chirp.MonitorReply) */ {
+ public:
+  inline MonitorReply() : MonitorReply(nullptr) {}
+  ~MonitorReply() override;
+  explicit PROTOBUF_CONSTEXPR MonitorReply(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  MonitorReply(const MonitorReply& from);
+  MonitorReply(MonitorReply&& from) noexcept
+    : MonitorReply() {
+    *this = ::std::move(from);
+  }
+
+  inline MonitorReply& operator=(const MonitorReply& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline MonitorReply& operator=(MonitorReply&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const MonitorReply& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const MonitorReply* internal_default_instance() {
+    return reinterpret_cast<const MonitorReply*>(
+               &_MonitorReply_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    11;
+
+  friend void swap(MonitorReply& a, MonitorReply& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(MonitorReply* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(MonitorReply* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  MonitorReply* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<MonitorReply>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const MonitorReply& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const MonitorReply& from) {
+    MonitorReply::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(MonitorReply* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "chirp.MonitorReply";
+  }
+  protected:
+  explicit MonitorReply(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kChirpFieldNumber = 1,
+  };
+  // .chirp.Chirp chirp = 1;
+  bool has_chirp() const;
+  private:
+  bool _internal_has_chirp() const;
+  public:
+  void clear_chirp();
+  const ::chirp::Chirp& chirp() const;
+  PROTOBUF_NODISCARD ::chirp::Chirp* release_chirp();
+  ::chirp::Chirp* mutable_chirp();
+  void set_allocated_chirp(::chirp::Chirp* chirp);
+  private:
+  const ::chirp::Chirp& _internal_chirp() const;
+  ::chirp::Chirp* _internal_mutable_chirp();
+  public:
+  void unsafe_arena_set_allocated_chirp(
+      ::chirp::Chirp* chirp);
+  ::chirp::Chirp* unsafe_arena_release_chirp();
+
+  // @@protoc_insertion_point(class_scope:chirp.MonitorReply)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::chirp::Chirp* chirp_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_service_2eproto;
+};
+// ===================================================================
+
+
+// ===================================================================
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic push
+  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
+#endif  // __GNUC__
+// Timestamp
+
+// int64 seconds = 1;
+inline void Timestamp::clear_seconds() {
+  _impl_.seconds_ = int64_t{0};
+}
+inline int64_t Timestamp::_internal_seconds() const {
+  return _impl_.seconds_;
+}
+inline int64_t Timestamp::seconds() const {
+  // @@protoc_insertion_point(field_get:chirp.Timestamp.seconds)
+  return _internal_seconds();
+}
+inline void Timestamp::_internal_set_seconds(int64_t value) {
+  
+  _impl_.seconds_ = value;
+}
+inline void Timestamp::set_seconds(int64_t value) {
+  _internal_set_seconds(value);
+  // @@protoc_insertion_point(field_set:chirp.Timestamp.seconds)
+}
+
+// int64 useconds = 2;
+inline void Timestamp::clear_useconds() {
+  _impl_.useconds_ = int64_t{0};
+}
+inline int64_t Timestamp::_internal_useconds() const {
+  return _impl_.useconds_;
+}
+inline int64_t Timestamp::useconds() const {
+  // @@protoc_insertion_point(field_get:chirp.Timestamp.useconds)
+  return _internal_useconds();
+}
+inline void Timestamp::_internal_set_useconds(int64_t value) {
+  
+  _impl_.useconds_ = value;
+}
+inline void Timestamp::set_useconds(int64_t value) {
+  _internal_set_useconds(value);
+  // @@protoc_insertion_point(field_set:chirp.Timestamp.useconds)
+}
+
+// -------------------------------------------------------------------
+
+// Chirp
+
+// string username = 1;
+inline void Chirp::clear_username() {
+  _impl_.username_.ClearToEmpty();
+}
+inline const std::string& Chirp::username() const {
+  // @@protoc_insertion_point(field_get:chirp.Chirp.username)
+  return _internal_username();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void Chirp::set_username(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.username_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:chirp.Chirp.username)
+}
+inline std::string* Chirp::mutable_username() {
+  std::string* _s = _internal_mutable_username();
+  // @@protoc_insertion_point(field_mutable:chirp.Chirp.username)
+  return _s;
+}
+inline const std::string& Chirp::_internal_username() const {
+  return _impl_.username_.Get();
+}
+inline void Chirp::_internal_set_username(const std::string& value) {
+  
+  _impl_.username_.Set(value, GetArenaForAllocation());
+}
+inline std::string* Chirp::_internal_mutable_username() {
+  
+  return _impl_.username_.Mutable(GetArenaForAllocation());
+}
+inline std::string* Chirp::release_username() {
+  // @@protoc_insertion_point(field_release:chirp.Chirp.username)
+  return _impl_.username_.Release();
+}
+inline void Chirp::set_allocated_username(std::string* username) {
+  if (username != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.username_.SetAllocated(username, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.username_.IsDefault()) {
+    _impl_.username_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:chirp.Chirp.username)
+}
+
+// string text = 2;
+inline void Chirp::clear_text() {
+  _impl_.text_.ClearToEmpty();
+}
+inline const std::string& Chirp::text() const {
+  // @@protoc_insertion_point(field_get:chirp.Chirp.text)
+  return _internal_text();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void Chirp::set_text(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.text_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:chirp.Chirp.text)
+}
+inline std::string* Chirp::mutable_text() {
+  std::string* _s = _internal_mutable_text();
+  // @@protoc_insertion_point(field_mutable:chirp.Chirp.text)
+  return _s;
+}
+inline const std::string& Chirp::_internal_text() const {
+  return _impl_.text_.Get();
+}
+inline void Chirp::_internal_set_text(const std::string& value) {
+  
+  _impl_.text_.Set(value, GetArenaForAllocation());
+}
+inline std::string* Chirp::_internal_mutable_text() {
+  
+  return _impl_.text_.Mutable(GetArenaForAllocation());
+}
+inline std::string* Chirp::release_text() {
+  // @@protoc_insertion_point(field_release:chirp.Chirp.text)
+  return _impl_.text_.Release();
+}
+inline void Chirp::set_allocated_text(std::string* text) {
+  if (text != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.text_.SetAllocated(text, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.text_.IsDefault()) {
+    _impl_.text_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:chirp.Chirp.text)
+}
+
+// bytes id = 3;
+inline void Chirp::clear_id() {
+  _impl_.id_.ClearToEmpty();
+}
+inline const std::string& Chirp::id() const {
+  // @@protoc_insertion_point(field_get:chirp.Chirp.id)
+  return _internal_id();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void Chirp::set_id(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.id_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:chirp.Chirp.id)
+}
+inline std::string* Chirp::mutable_id() {
+  std::string* _s = _internal_mutable_id();
+  // @@protoc_insertion_point(field_mutable:chirp.Chirp.id)
+  return _s;
+}
+inline const std::string& Chirp::_internal_id() const {
+  return _impl_.id_.Get();
+}
+inline void Chirp::_internal_set_id(const std::string& value) {
+  
+  _impl_.id_.Set(value, GetArenaForAllocation());
+}
+inline std::string* Chirp::_internal_mutable_id() {
+  
+  return _impl_.id_.Mutable(GetArenaForAllocation());
+}
+inline std::string* Chirp::release_id() {
+  // @@protoc_insertion_point(field_release:chirp.Chirp.id)
+  return _impl_.id_.Release();
+}
+inline void Chirp::set_allocated_id(std::string* id) {
+  if (id != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.id_.SetAllocated(id, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.id_.IsDefault()) {
+    _impl_.id_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:chirp.Chirp.id)
+}
+
+// bytes parent_id = 4;
+inline void Chirp::clear_parent_id() {
+  _impl_.parent_id_.ClearToEmpty();
+}
+inline const std::string& Chirp::parent_id() const {
+  // @@protoc_insertion_point(field_get:chirp.Chirp.parent_id)
+  return _internal_parent_id();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void Chirp::set_parent_id(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.parent_id_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:chirp.Chirp.parent_id)
+}
+inline std::string* Chirp::mutable_parent_id() {
+  std::string* _s = _internal_mutable_parent_id();
+  // @@protoc_insertion_point(field_mutable:chirp.Chirp.parent_id)
+  return _s;
+}
+inline const std::string& Chirp::_internal_parent_id() const {
+  return _impl_.parent_id_.Get();
+}
+inline void Chirp::_internal_set_parent_id(const std::string& value) {
+  
+  _impl_.parent_id_.Set(value, GetArenaForAllocation());
+}
+inline std::string* Chirp::_internal_mutable_parent_id() {
+  
+  return _impl_.parent_id_.Mutable(GetArenaForAllocation());
+}
+inline std::string* Chirp::release_parent_id() {
+  // @@protoc_insertion_point(field_release:chirp.Chirp.parent_id)
+  return _impl_.parent_id_.Release();
+}
+inline void Chirp::set_allocated_parent_id(std::string* parent_id) {
+  if (parent_id != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.parent_id_.SetAllocated(parent_id, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.parent_id_.IsDefault()) {
+    _impl_.parent_id_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:chirp.Chirp.parent_id)
+}
+
+// .chirp.Timestamp timestamp = 5;
+inline bool Chirp::_internal_has_timestamp() const {
+  return this != internal_default_instance() && _impl_.timestamp_ != nullptr;
+}
+inline bool Chirp::has_timestamp() const {
+  return _internal_has_timestamp();
+}
+inline void Chirp::clear_timestamp() {
+  if (GetArenaForAllocation() == nullptr && _impl_.timestamp_ != nullptr) {
+    delete _impl_.timestamp_;
+  }
+  _impl_.timestamp_ = nullptr;
+}
+inline const ::chirp::Timestamp& Chirp::_internal_timestamp() const {
+  const ::chirp::Timestamp* p = _impl_.timestamp_;
+  return p != nullptr ? *p : reinterpret_cast<const ::chirp::Timestamp&>(
+      ::chirp::_Timestamp_default_instance_);
+}
+inline const ::chirp::Timestamp& Chirp::timestamp() const {
+  // @@protoc_insertion_point(field_get:chirp.Chirp.timestamp)
+  return _internal_timestamp();
+}
+inline void Chirp::unsafe_arena_set_allocated_timestamp(
+    ::chirp::Timestamp* timestamp) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.timestamp_);
+  }
+  _impl_.timestamp_ = timestamp;
+  if (timestamp) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:chirp.Chirp.timestamp)
+}
+inline ::chirp::Timestamp* Chirp::release_timestamp() {
+  
+  ::chirp::Timestamp* temp = _impl_.timestamp_;
+  _impl_.timestamp_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::chirp::Timestamp* Chirp::unsafe_arena_release_timestamp() {
+  // @@protoc_insertion_point(field_release:chirp.Chirp.timestamp)
+  
+  ::chirp::Timestamp* temp = _impl_.timestamp_;
+  _impl_.timestamp_ = nullptr;
+  return temp;
+}
+inline ::chirp::Timestamp* Chirp::_internal_mutable_timestamp() {
+  
+  if (_impl_.timestamp_ == nullptr) {
+    auto* p = CreateMaybeMessage<::chirp::Timestamp>(GetArenaForAllocation());
+    _impl_.timestamp_ = p;
+  }
+  return _impl_.timestamp_;
+}
+inline ::chirp::Timestamp* Chirp::mutable_timestamp() {
+  ::chirp::Timestamp* _msg = _internal_mutable_timestamp();
+  // @@protoc_insertion_point(field_mutable:chirp.Chirp.timestamp)
+  return _msg;
+}
+inline void Chirp::set_allocated_timestamp(::chirp::Timestamp* timestamp) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.timestamp_;
+  }
+  if (timestamp) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(timestamp);
+    if (message_arena != submessage_arena) {
+      timestamp = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, timestamp, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  _impl_.timestamp_ = timestamp;
+  // @@protoc_insertion_point(field_set_allocated:chirp.Chirp.timestamp)
+}
+
+// -------------------------------------------------------------------
+
+// RegisterRequest
+
+// string username = 1;
+inline void RegisterRequest::clear_username() {
+  _impl_.username_.ClearToEmpty();
+}
+inline const std::string& RegisterRequest::username() const {
+  // @@protoc_insertion_point(field_get:chirp.RegisterRequest.username)
+  return _internal_username();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void RegisterRequest::set_username(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.username_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:chirp.RegisterRequest.username)
+}
+inline std::string* RegisterRequest::mutable_username() {
+  std::string* _s = _internal_mutable_username();
+  // @@protoc_insertion_point(field_mutable:chirp.RegisterRequest.username)
+  return _s;
+}
+inline const std::string& RegisterRequest::_internal_username() const {
+  return _impl_.username_.Get();
+}
+inline void RegisterRequest::_internal_set_username(const std::string& value) {
+  
+  _impl_.username_.Set(value, GetArenaForAllocation());
+}
+inline std::string* RegisterRequest::_internal_mutable_username() {
+  
+  return _impl_.username_.Mutable(GetArenaForAllocation());
+}
+inline std::string* RegisterRequest::release_username() {
+  // @@protoc_insertion_point(field_release:chirp.RegisterRequest.username)
+  return _impl_.username_.Release();
+}
+inline void RegisterRequest::set_allocated_username(std::string* username) {
+  if (username != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.username_.SetAllocated(username, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.username_.IsDefault()) {
+    _impl_.username_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:chirp.RegisterRequest.username)
+}
+
+// -------------------------------------------------------------------
+
+// RegisterReply
+
+// -------------------------------------------------------------------
+
+// ChirpRequest
+
+// string username = 1;
+inline void ChirpRequest::clear_username() {
+  _impl_.username_.ClearToEmpty();
+}
+inline const std::string& ChirpRequest::username() const {
+  // @@protoc_insertion_point(field_get:chirp.ChirpRequest.username)
+  return _internal_username();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void ChirpRequest::set_username(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.username_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:chirp.ChirpRequest.username)
+}
+inline std::string* ChirpRequest::mutable_username() {
+  std::string* _s = _internal_mutable_username();
+  // @@protoc_insertion_point(field_mutable:chirp.ChirpRequest.username)
+  return _s;
+}
+inline const std::string& ChirpRequest::_internal_username() const {
+  return _impl_.username_.Get();
+}
+inline void ChirpRequest::_internal_set_username(const std::string& value) {
+  
+  _impl_.username_.Set(value, GetArenaForAllocation());
+}
+inline std::string* ChirpRequest::_internal_mutable_username() {
+  
+  return _impl_.username_.Mutable(GetArenaForAllocation());
+}
+inline std::string* ChirpRequest::release_username() {
+  // @@protoc_insertion_point(field_release:chirp.ChirpRequest.username)
+  return _impl_.username_.Release();
+}
+inline void ChirpRequest::set_allocated_username(std::string* username) {
+  if (username != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.username_.SetAllocated(username, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.username_.IsDefault()) {
+    _impl_.username_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:chirp.ChirpRequest.username)
+}
+
+// string text = 2;
+inline void ChirpRequest::clear_text() {
+  _impl_.text_.ClearToEmpty();
+}
+inline const std::string& ChirpRequest::text() const {
+  // @@protoc_insertion_point(field_get:chirp.ChirpRequest.text)
+  return _internal_text();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void ChirpRequest::set_text(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.text_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:chirp.ChirpRequest.text)
+}
+inline std::string* ChirpRequest::mutable_text() {
+  std::string* _s = _internal_mutable_text();
+  // @@protoc_insertion_point(field_mutable:chirp.ChirpRequest.text)
+  return _s;
+}
+inline const std::string& ChirpRequest::_internal_text() const {
+  return _impl_.text_.Get();
+}
+inline void ChirpRequest::_internal_set_text(const std::string& value) {
+  
+  _impl_.text_.Set(value, GetArenaForAllocation());
+}
+inline std::string* ChirpRequest::_internal_mutable_text() {
+  
+  return _impl_.text_.Mutable(GetArenaForAllocation());
+}
+inline std::string* ChirpRequest::release_text() {
+  // @@protoc_insertion_point(field_release:chirp.ChirpRequest.text)
+  return _impl_.text_.Release();
+}
+inline void ChirpRequest::set_allocated_text(std::string* text) {
+  if (text != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.text_.SetAllocated(text, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.text_.IsDefault()) {
+    _impl_.text_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:chirp.ChirpRequest.text)
+}
+
+// bytes parent_id = 3;
+inline void ChirpRequest::clear_parent_id() {
+  _impl_.parent_id_.ClearToEmpty();
+}
+inline const std::string& ChirpRequest::parent_id() const {
+  // @@protoc_insertion_point(field_get:chirp.ChirpRequest.parent_id)
+  return _internal_parent_id();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void ChirpRequest::set_parent_id(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.parent_id_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:chirp.ChirpRequest.parent_id)
+}
+inline std::string* ChirpRequest::mutable_parent_id() {
+  std::string* _s = _internal_mutable_parent_id();
+  // @@protoc_insertion_point(field_mutable:chirp.ChirpRequest.parent_id)
+  return _s;
+}
+inline const std::string& ChirpRequest::_internal_parent_id() const {
+  return _impl_.parent_id_.Get();
+}
+inline void ChirpRequest::_internal_set_parent_id(const std::string& value) {
+  
+  _impl_.parent_id_.Set(value, GetArenaForAllocation());
+}
+inline std::string* ChirpRequest::_internal_mutable_parent_id() {
+  
+  return _impl_.parent_id_.Mutable(GetArenaForAllocation());
+}
+inline std::string* ChirpRequest::release_parent_id() {
+  // @@protoc_insertion_point(field_release:chirp.ChirpRequest.parent_id)
+  return _impl_.parent_id_.Release();
+}
+inline void ChirpRequest::set_allocated_parent_id(std::string* parent_id) {
+  if (parent_id != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.parent_id_.SetAllocated(parent_id, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.parent_id_.IsDefault()) {
+    _impl_.parent_id_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:chirp.ChirpRequest.parent_id)
+}
+
+// -------------------------------------------------------------------
+
+// ChirpReply
+
+// .chirp.Chirp chirp = 1;
+inline bool ChirpReply::_internal_has_chirp() const {
+  return this != internal_default_instance() && _impl_.chirp_ != nullptr;
+}
+inline bool ChirpReply::has_chirp() const {
+  return _internal_has_chirp();
+}
+inline void ChirpReply::clear_chirp() {
+  if (GetArenaForAllocation() == nullptr && _impl_.chirp_ != nullptr) {
+    delete _impl_.chirp_;
+  }
+  _impl_.chirp_ = nullptr;
+}
+inline const ::chirp::Chirp& ChirpReply::_internal_chirp() const {
+  const ::chirp::Chirp* p = _impl_.chirp_;
+  return p != nullptr ? *p : reinterpret_cast<const ::chirp::Chirp&>(
+      ::chirp::_Chirp_default_instance_);
+}
+inline const ::chirp::Chirp& ChirpReply::chirp() const {
+  // @@protoc_insertion_point(field_get:chirp.ChirpReply.chirp)
+  return _internal_chirp();
+}
+inline void ChirpReply::unsafe_arena_set_allocated_chirp(
+    ::chirp::Chirp* chirp) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.chirp_);
+  }
+  _impl_.chirp_ = chirp;
+  if (chirp) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:chirp.ChirpReply.chirp)
+}
+inline ::chirp::Chirp* ChirpReply::release_chirp() {
+  
+  ::chirp::Chirp* temp = _impl_.chirp_;
+  _impl_.chirp_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::chirp::Chirp* ChirpReply::unsafe_arena_release_chirp() {
+  // @@protoc_insertion_point(field_release:chirp.ChirpReply.chirp)
+  
+  ::chirp::Chirp* temp = _impl_.chirp_;
+  _impl_.chirp_ = nullptr;
+  return temp;
+}
+inline ::chirp::Chirp* ChirpReply::_internal_mutable_chirp() {
+  
+  if (_impl_.chirp_ == nullptr) {
+    auto* p = CreateMaybeMessage<::chirp::Chirp>(GetArenaForAllocation());
+    _impl_.chirp_ = p;
+  }
+  return _impl_.chirp_;
+}
+inline ::chirp::Chirp* ChirpReply::mutable_chirp() {
+  ::chirp::Chirp* _msg = _internal_mutable_chirp();
+  // @@protoc_insertion_point(field_mutable:chirp.ChirpReply.chirp)
+  return _msg;
+}
+inline void ChirpReply::set_allocated_chirp(::chirp::Chirp* chirp) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.chirp_;
+  }
+  if (chirp) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(chirp);
+    if (message_arena != submessage_arena) {
+      chirp = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, chirp, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  _impl_.chirp_ = chirp;
+  // @@protoc_insertion_point(field_set_allocated:chirp.ChirpReply.chirp)
+}
+
+// -------------------------------------------------------------------
+
+// FollowRequest
+
+// string username = 1;
+inline void FollowRequest::clear_username() {
+  _impl_.username_.ClearToEmpty();
+}
+inline const std::string& FollowRequest::username() const {
+  // @@protoc_insertion_point(field_get:chirp.FollowRequest.username)
+  return _internal_username();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void FollowRequest::set_username(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.username_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:chirp.FollowRequest.username)
+}
+inline std::string* FollowRequest::mutable_username() {
+  std::string* _s = _internal_mutable_username();
+  // @@protoc_insertion_point(field_mutable:chirp.FollowRequest.username)
+  return _s;
+}
+inline const std::string& FollowRequest::_internal_username() const {
+  return _impl_.username_.Get();
+}
+inline void FollowRequest::_internal_set_username(const std::string& value) {
+  
+  _impl_.username_.Set(value, GetArenaForAllocation());
+}
+inline std::string* FollowRequest::_internal_mutable_username() {
+  
+  return _impl_.username_.Mutable(GetArenaForAllocation());
+}
+inline std::string* FollowRequest::release_username() {
+  // @@protoc_insertion_point(field_release:chirp.FollowRequest.username)
+  return _impl_.username_.Release();
+}
+inline void FollowRequest::set_allocated_username(std::string* username) {
+  if (username != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.username_.SetAllocated(username, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.username_.IsDefault()) {
+    _impl_.username_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:chirp.FollowRequest.username)
+}
+
+// string to_follow = 2;
+inline void FollowRequest::clear_to_follow() {
+  _impl_.to_follow_.ClearToEmpty();
+}
+inline const std::string& FollowRequest::to_follow() const {
+  // @@protoc_insertion_point(field_get:chirp.FollowRequest.to_follow)
+  return _internal_to_follow();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void FollowRequest::set_to_follow(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.to_follow_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:chirp.FollowRequest.to_follow)
+}
+inline std::string* FollowRequest::mutable_to_follow() {
+  std::string* _s = _internal_mutable_to_follow();
+  // @@protoc_insertion_point(field_mutable:chirp.FollowRequest.to_follow)
+  return _s;
+}
+inline const std::string& FollowRequest::_internal_to_follow() const {
+  return _impl_.to_follow_.Get();
+}
+inline void FollowRequest::_internal_set_to_follow(const std::string& value) {
+  
+  _impl_.to_follow_.Set(value, GetArenaForAllocation());
+}
+inline std::string* FollowRequest::_internal_mutable_to_follow() {
+  
+  return _impl_.to_follow_.Mutable(GetArenaForAllocation());
+}
+inline std::string* FollowRequest::release_to_follow() {
+  // @@protoc_insertion_point(field_release:chirp.FollowRequest.to_follow)
+  return _impl_.to_follow_.Release();
+}
+inline void FollowRequest::set_allocated_to_follow(std::string* to_follow) {
+  if (to_follow != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.to_follow_.SetAllocated(to_follow, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.to_follow_.IsDefault()) {
+    _impl_.to_follow_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:chirp.FollowRequest.to_follow)
+}
+
+// -------------------------------------------------------------------
+
+// FollowReply
+
+// -------------------------------------------------------------------
+
+// ReadRequest
+
+// bytes chirp_id = 1;
+inline void ReadRequest::clear_chirp_id() {
+  _impl_.chirp_id_.ClearToEmpty();
+}
+inline const std::string& ReadRequest::chirp_id() const {
+  // @@protoc_insertion_point(field_get:chirp.ReadRequest.chirp_id)
+  return _internal_chirp_id();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void ReadRequest::set_chirp_id(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.chirp_id_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:chirp.ReadRequest.chirp_id)
+}
+inline std::string* ReadRequest::mutable_chirp_id() {
+  std::string* _s = _internal_mutable_chirp_id();
+  // @@protoc_insertion_point(field_mutable:chirp.ReadRequest.chirp_id)
+  return _s;
+}
+inline const std::string& ReadRequest::_internal_chirp_id() const {
+  return _impl_.chirp_id_.Get();
+}
+inline void ReadRequest::_internal_set_chirp_id(const std::string& value) {
+  
+  _impl_.chirp_id_.Set(value, GetArenaForAllocation());
+}
+inline std::string* ReadRequest::_internal_mutable_chirp_id() {
+  
+  return _impl_.chirp_id_.Mutable(GetArenaForAllocation());
+}
+inline std::string* ReadRequest::release_chirp_id() {
+  // @@protoc_insertion_point(field_release:chirp.ReadRequest.chirp_id)
+  return _impl_.chirp_id_.Release();
+}
+inline void ReadRequest::set_allocated_chirp_id(std::string* chirp_id) {
+  if (chirp_id != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.chirp_id_.SetAllocated(chirp_id, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.chirp_id_.IsDefault()) {
+    _impl_.chirp_id_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:chirp.ReadRequest.chirp_id)
+}
+
+// -------------------------------------------------------------------
+
+// ReadReply
+
+// repeated .chirp.Chirp chirps = 1;
+inline int ReadReply::_internal_chirps_size() const {
+  return _impl_.chirps_.size();
+}
+inline int ReadReply::chirps_size() const {
+  return _internal_chirps_size();
+}
+inline void ReadReply::clear_chirps() {
+  _impl_.chirps_.Clear();
+}
+inline ::chirp::Chirp* ReadReply::mutable_chirps(int index) {
+  // @@protoc_insertion_point(field_mutable:chirp.ReadReply.chirps)
+  return _impl_.chirps_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::chirp::Chirp >*
+ReadReply::mutable_chirps() {
+  // @@protoc_insertion_point(field_mutable_list:chirp.ReadReply.chirps)
+  return &_impl_.chirps_;
+}
+inline const ::chirp::Chirp& ReadReply::_internal_chirps(int index) const {
+  return _impl_.chirps_.Get(index);
+}
+inline const ::chirp::Chirp& ReadReply::chirps(int index) const {
+  // @@protoc_insertion_point(field_get:chirp.ReadReply.chirps)
+  return _internal_chirps(index);
+}
+inline ::chirp::Chirp* ReadReply::_internal_add_chirps() {
+  return _impl_.chirps_.Add();
+}
+inline ::chirp::Chirp* ReadReply::add_chirps() {
+  ::chirp::Chirp* _add = _internal_add_chirps();
+  // @@protoc_insertion_point(field_add:chirp.ReadReply.chirps)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::chirp::Chirp >&
+ReadReply::chirps() const {
+  // @@protoc_insertion_point(field_list:chirp.ReadReply.chirps)
+  return _impl_.chirps_;
+}
+
+// -------------------------------------------------------------------
+
+// MonitorRequest
+
+// string username = 1;
+inline void MonitorRequest::clear_username() {
+  _impl_.username_.ClearToEmpty();
+}
+inline const std::string& MonitorRequest::username() const {
+  // @@protoc_insertion_point(field_get:chirp.MonitorRequest.username)
+  return _internal_username();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void MonitorRequest::set_username(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.username_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:chirp.MonitorRequest.username)
+}
+inline std::string* MonitorRequest::mutable_username() {
+  std::string* _s = _internal_mutable_username();
+  // @@protoc_insertion_point(field_mutable:chirp.MonitorRequest.username)
+  return _s;
+}
+inline const std::string& MonitorRequest::_internal_username() const {
+  return _impl_.username_.Get();
+}
+inline void MonitorRequest::_internal_set_username(const std::string& value) {
+  
+  _impl_.username_.Set(value, GetArenaForAllocation());
+}
+inline std::string* MonitorRequest::_internal_mutable_username() {
+  
+  return _impl_.username_.Mutable(GetArenaForAllocation());
+}
+inline std::string* MonitorRequest::release_username() {
+  // @@protoc_insertion_point(field_release:chirp.MonitorRequest.username)
+  return _impl_.username_.Release();
+}
+inline void MonitorRequest::set_allocated_username(std::string* username) {
+  if (username != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.username_.SetAllocated(username, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.username_.IsDefault()) {
+    _impl_.username_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:chirp.MonitorRequest.username)
+}
+
+// -------------------------------------------------------------------
+
+// MonitorReply
+
+// .chirp.Chirp chirp = 1;
+inline bool MonitorReply::_internal_has_chirp() const {
+  return this != internal_default_instance() && _impl_.chirp_ != nullptr;
+}
+inline bool MonitorReply::has_chirp() const {
+  return _internal_has_chirp();
+}
+inline void MonitorReply::clear_chirp() {
+  if (GetArenaForAllocation() == nullptr && _impl_.chirp_ != nullptr) {
+    delete _impl_.chirp_;
+  }
+  _impl_.chirp_ = nullptr;
+}
+inline const ::chirp::Chirp& MonitorReply::_internal_chirp() const {
+  const ::chirp::Chirp* p = _impl_.chirp_;
+  return p != nullptr ? *p : reinterpret_cast<const ::chirp::Chirp&>(
+      ::chirp::_Chirp_default_instance_);
+}
+inline const ::chirp::Chirp& MonitorReply::chirp() const {
+  // @@protoc_insertion_point(field_get:chirp.MonitorReply.chirp)
+  return _internal_chirp();
+}
+inline void MonitorReply::unsafe_arena_set_allocated_chirp(
+    ::chirp::Chirp* chirp) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.chirp_);
+  }
+  _impl_.chirp_ = chirp;
+  if (chirp) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:chirp.MonitorReply.chirp)
+}
+inline ::chirp::Chirp* MonitorReply::release_chirp() {
+  
+  ::chirp::Chirp* temp = _impl_.chirp_;
+  _impl_.chirp_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::chirp::Chirp* MonitorReply::unsafe_arena_release_chirp() {
+  // @@protoc_insertion_point(field_release:chirp.MonitorReply.chirp)
+  
+  ::chirp::Chirp* temp = _impl_.chirp_;
+  _impl_.chirp_ = nullptr;
+  return temp;
+}
+inline ::chirp::Chirp* MonitorReply::_internal_mutable_chirp() {
+  
+  if (_impl_.chirp_ == nullptr) {
+    auto* p = CreateMaybeMessage<::chirp::Chirp>(GetArenaForAllocation());
+    _impl_.chirp_ = p;
+  }
+  return _impl_.chirp_;
+}
+inline ::chirp::Chirp* MonitorReply::mutable_chirp() {
+  ::chirp::Chirp* _msg = _internal_mutable_chirp();
+  // @@protoc_insertion_point(field_mutable:chirp.MonitorReply.chirp)
+  return _msg;
+}
+inline void MonitorReply::set_allocated_chirp(::chirp::Chirp* chirp) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.chirp_;
+  }
+  if (chirp) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(chirp);
+    if (message_arena != submessage_arena) {
+      chirp = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, chirp, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  _impl_.chirp_ = chirp;
+  // @@protoc_insertion_point(field_set_allocated:chirp.MonitorReply.chirp)
+}
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic pop
+#endif  // __GNUC__
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+
+// @@protoc_insertion_point(namespace_scope)
+
+}  // namespace chirp
+
+// @@protoc_insertion_point(global_scope)
+
+#include <google/protobuf/port_undef.inc>
+#endif  // GOOGLE_PROTOBUF_INCLUDED_GOOGLE_PROTOBUF_INCLUDED_service_2eproto
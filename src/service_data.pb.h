@@ -0,0 +1,1769 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: service_data.proto
+
+#ifndef GOOGLE_PROTOBUF_INCLUDED_service_5fdata_2eproto
+#define GOOGLE_PROTOBUF_INCLUDED_service_5fdata_2eproto
+
+#include <limits>
+#include <string>
+
+#include <google/protobuf/port_def.inc>
+#if PROTOBUF_VERSION < 3021000
+#error This file was generated by a newer version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please update
+#error your headers.
+#endif
+#if 3021012 < PROTOBUF_MIN_PROTOC_VERSION
+#error This file was generated by an older version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please
+#error regenerate this file with a newer version of protoc.
+#endif
+
+#include <google/protobuf/port_undef.inc>
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/arena.h>
+#include <google/protobuf/arenastring.h>
+#include <google/protobuf/generated_message_util.h>
+#include <google/protobuf/metadata_lite.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/message.h>
+#include <google/protobuf/repeated_field.h>  // IWYU pragma: export
+#include <google/protobuf/extension_set.h>  // IWYU pragma: export
+#include <google/protobuf/unknown_field_set.h>
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+#define PROTOBUF_INTERNAL_EXPORT_service_5fdata_2eproto
+PROTOBUF_NAMESPACE_OPEN
+namespace internal {
+class AnyMetadata;
+}  // namespace internal
+PROTOBUF_NAMESPACE_CLOSE
+
+// Internal implementation detail -- do not use these members.
+struct TableStruct_service_5fdata_2eproto {
+  static const uint32_t offsets[];
+};
+extern const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_service_5fdata_2eproto;
+namespace ServiceData {
+class Chirp;
+struct ChirpDefaultTypeInternal;
+extern ChirpDefaultTypeInternal _Chirp_default_instance_;
+class NowChirpId;
+struct NowChirpIdDefaultTypeInternal;
+extern NowChirpIdDefaultTypeInternal _NowChirpId_default_instance_;
+class Timestamp;
+struct TimestampDefaultTypeInternal;
+extern TimestampDefaultTypeInternal _Timestamp_default_instance_;
+class User;
+struct UserDefaultTypeInternal;
+extern UserDefaultTypeInternal _User_default_instance_;
+class UserChirpList;
+struct UserChirpListDefaultTypeInternal;
+extern UserChirpListDefaultTypeInternal _UserChirpList_default_instance_;
+class UserFollowingList;
+struct UserFollowingListDefaultTypeInternal;
+extern UserFollowingListDefaultTypeInternal _UserFollowingList_default_instance_;
+}  // namespace ServiceData
+PROTOBUF_NAMESPACE_OPEN
+template<> ::ServiceData::Chirp* Arena::CreateMaybeMessage<::ServiceData::Chirp>(Arena*);
+template<> ::ServiceData::NowChirpId* Arena::CreateMaybeMessage<::ServiceData::NowChirpId>(Arena*);
+template<> ::ServiceData::Timestamp* Arena::CreateMaybeMessage<::ServiceData::Timestamp>(Arena*);
+template<> ::ServiceData::User* Arena::CreateMaybeMessage<::ServiceData::User>(Arena*);
+template<> ::ServiceData::UserChirpList* Arena::CreateMaybeMessage<::ServiceData::UserChirpList>(Arena*);
+template<> ::ServiceData::UserFollowingList* Arena::CreateMaybeMessage<::ServiceData::UserFollowingList>(Arena*);
+PROTOBUF_NAMESPACE_CLOSE
+namespace ServiceData {
+
+// ===================================================================
+
+class Timestamp final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:ServiceData.Timestamp) */ {
+ public:
+  inline Timestamp() : Timestamp(nullptr) {}
+  ~Timestamp() override;
+  explicit PROTOBUF_CONSTEXPR Timestamp(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  Timestamp(const Timestamp& from);
+  Timestamp(Timestamp&& from) noexcept
+    : Timestamp() {
+    *this = ::std::move(from);
+  }
+
+  inline Timestamp& operator=(const Timestamp& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline Timestamp& operator=(Timestamp&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const Timestamp& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const Timestamp* internal_default_instance() {
+    return reinterpret_cast<const Timestamp*>(
+               &_Timestamp_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    0;
+
+  friend void swap(Timestamp& a, Timestamp& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(Timestamp* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(Timestamp* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  Timestamp* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<Timestamp>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const Timestamp& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const Timestamp& from) {
+    Timestamp::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(Timestamp* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "ServiceData.Timestamp";
+  }
+  protected:
+  explicit Timestamp(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kSecondsFieldNumber = 1,
+    kUsecondsFieldNumber = 2,
+  };
+  // int64 seconds = 1;
+  void clear_seconds();
+  int64_t seconds() const;
+  void set_seconds(int64_t value);
+  private:
+  int64_t _internal_seconds() const;
+  void _internal_set_seconds(int64_t value);
+  public:
+
+  // int64 useconds = 2;
+  void clear_useconds();
+  int64_t useconds() const;
+  void set_useconds(int64_t value);
+  private:
+  int64_t _internal_useconds() const;
+  void _internal_set_useconds(int64_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:ServiceData.Timestamp)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    int64_t seconds_;
+    int64_t useconds_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_service_5fdata_2eproto;
+};
+// -------------------------------------------------------------------
+
+class User final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:ServiceData.User) */ {
+ public:
+  inline User() : User(nullptr) {}
+  ~User() override;
+  explicit PROTOBUF_CONSTEXPR User(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  User(const User& from);
+  User(User&& from) noexcept
+    : User() {
+    *this = ::std::move(from);
+  }
+
+  inline User& operator=(const User& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline User& operator=(User&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const User& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const User* internal_default_instance() {
+    return reinterpret_cast<const User*>(
+               &_User_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    1;
+
+  friend void swap(User& a, User& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(User* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(User* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  User* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<User>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const User& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const User& from) {
+    User::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(User* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "ServiceData.User";
+  }
+  protected:
+  explicit User(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kUsernameFieldNumber = 1,
+    kLastUpdateFieldNumber = 2,
+  };
+  // string username = 1;
+  void clear_username();
+  const std::string& username() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_username(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_username();
+  PROTOBUF_NODISCARD std::string* release_username();
+  void set_allocated_username(std::string* username);
+  private:
+  const std::string& _internal_username() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_username(const std::string& value);
+  std::string* _internal_mutable_username();
+  public:
+
+  // .ServiceData.Timestamp last_update = 2;
+  bool has_last_update() const;
+  private:
+  bool _internal_has_last_update() const;
+  public:
+  void clear_last_update();
+  const ::ServiceData::Timestamp& last_update() const;
+  PROTOBUF_NODISCARD ::ServiceData::Timestamp* release_last_update();
+  ::ServiceData::Timestamp* mutable_last_update();
+  void set_allocated_last_update(::ServiceData::Timestamp* last_update);
+  private:
+  const ::ServiceData::Timestamp& _internal_last_update() const;
+  ::ServiceData::Timestamp* _internal_mutable_last_update();
+  public:
+  void unsafe_arena_set_allocated_last_update(
+      ::ServiceData::Timestamp* last_update);
+  ::ServiceData::Timestamp* unsafe_arena_release_last_update();
+
+  // @@protoc_insertion_point(class_scope:ServiceData.User)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr username_;
+    ::ServiceData::Timestamp* last_update_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_service_5fdata_2eproto;
+};
+// -------------------------------------------------------------------
+
+class UserFollowingList final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:ServiceData.UserFollowingList) */ {
+ public:
+  inline UserFollowingList() : UserFollowingList(nullptr) {}
+  ~UserFollowingList() override;
+  explicit PROTOBUF_CONSTEXPR UserFollowingList(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  UserFollowingList(const UserFollowingList& from);
+  UserFollowingList(UserFollowingList&& from) noexcept
+    : UserFollowingList() {
+    *this = ::std::move(from);
+  }
+
+  inline UserFollowingList& operator=(const UserFollowingList& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline UserFollowingList& operator=(UserFollowingList&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const UserFollowingList& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const UserFollowingList* internal_default_instance() {
+    return reinterpret_cast<const UserFollowingList*>(
+               &_UserFollowingList_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    2;
+
+  friend void swap(UserFollowingList& a, UserFollowingList& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(UserFollowingList* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(UserFollowingList* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  UserFollowingList* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<UserFollowingList>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const UserFollowingList& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const UserFollowingList& from) {
+    UserFollowingList::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(UserFollowingList* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "ServiceData.UserFollowingList";
+  }
+  protected:
+  explicit UserFollowingList(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kUsernameFieldNumber = 1,
+  };
+  // repeated string username = 1;
+  int username_size() const;
+  private:
+  int _internal_username_size() const;
+  public:
+  void clear_username();
+  const std::string& username(int index) const;
+  std::string* mutable_username(int index);
+  void set_username(int index, const std::string& value);
+  void set_username(int index, std::string&& value);
+  void set_username(int index, const char* value);
+  void set_username(int index, const char* value, size_t size);
+  std::string* add_username();
+  void add_username(const std::string& value);
+  void add_username(std::string&& value);
+  void add_username(const char* value);
+  void add_username(const char* value, size_t size);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>& username() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>* mutable_username();
+  private:
+  const std::string& _internal_username(int index) const;
+  std::string* _internal_add_username();
+  public:
+
+  // @@protoc_insertion_point(class_scope:ServiceData.UserFollowingList)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string> username_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_service_5fdata_2eproto;
+};
+// -------------------------------------------------------------------
+
+class UserChirpList final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:ServiceData.UserChirpList) */ {
+ public:
+  inline UserChirpList() : UserChirpList(nullptr) {}
+  ~UserChirpList() override;
+  explicit PROTOBUF_CONSTEXPR UserChirpList(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  UserChirpList(const UserChirpList& from);
+  UserChirpList(UserChirpList&& from) noexcept
+    : UserChirpList() {
+    *this = ::std::move(from);
+  }
+
+  inline UserChirpList& operator=(const UserChirpList& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline UserChirpList& operator=(UserChirpList&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const UserChirpList& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const UserChirpList* internal_default_instance() {
+    return reinterpret_cast<const UserChirpList*>(
+               &_UserChirpList_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    3;
+
+  friend void swap(UserChirpList& a, UserChirpList& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(UserChirpList* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(UserChirpList* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  UserChirpList* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<UserChirpList>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const UserChirpList& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const UserChirpList& from) {
+    UserChirpList::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(UserChirpList* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "ServiceData.UserChirpList";
+  }
+  protected:
+  explicit UserChirpList(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kChirpIdFieldNumber = 1,
+  };
+  // repeated uint64 chirp_id = 1;
+  int chirp_id_size() const;
+  private:
+  int _internal_chirp_id_size() const;
+  public:
+  void clear_chirp_id();
+  private:
+  uint64_t _internal_chirp_id(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >&
+      _internal_chirp_id() const;
+  void _internal_add_chirp_id(uint64_t value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >*
+      _internal_mutable_chirp_id();
+  public:
+  uint64_t chirp_id(int index) const;
+  void set_chirp_id(int index, uint64_t value);
+  void add_chirp_id(uint64_t value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >&
+      chirp_id() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >*
+      mutable_chirp_id();
+
+  // @@protoc_insertion_point(class_scope:ServiceData.UserChirpList)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t > chirp_id_;
+    mutable std::atomic<int> _chirp_id_cached_byte_size_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_service_5fdata_2eproto;
+};
+// -------------------------------------------------------------------
+
+class Chirp final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:ServiceData.Chirp) */ {
+ public:
+  inline Chirp() : Chirp(nullptr) {}
+  ~Chirp() override;
+  explicit PROTOBUF_CONSTEXPR Chirp(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  Chirp(const Chirp& from);
+  Chirp(Chirp&& from) noexcept
+    : Chirp() {
+    *this = ::std::move(from);
+  }
+
+  inline Chirp& operator=(const Chirp& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline Chirp& operator=(Chirp&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const Chirp& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const Chirp* internal_default_instance() {
+    return reinterpret_cast<const Chirp*>(
+               &_Chirp_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    4;
+
+  friend void swap(Chirp& a, Chirp& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(Chirp* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(Chirp* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  Chirp* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<Chirp>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const Chirp& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const Chirp& from) {
+    Chirp::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(Chirp* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "ServiceData.Chirp";
+  }
+  protected:
+  explicit Chirp(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kChildrenIdsFieldNumber = 6,
+    kUsernameFieldNumber = 2,
+    kTextFieldNumber = 4,
+    kTimeFieldNumber = 5,
+    kIdFieldNumber = 1,
+    kParentIdFieldNumber = 3,
+  };
+  // repeated uint64 children_ids = 6;
+  int children_ids_size() const;
+  private:
+  int _internal_children_ids_size() const;
+  public:
+  void clear_children_ids();
+  private:
+  uint64_t _internal_children_ids(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >&
+      _internal_children_ids() const;
+  void _internal_add_children_ids(uint64_t value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >*
+      _internal_mutable_children_ids();
+  public:
+  uint64_t children_ids(int index) const;
+  void set_children_ids(int index, uint64_t value);
+  void add_children_ids(uint64_t value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >&
+      children_ids() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >*
+      mutable_children_ids();
+
+  // string username = 2;
+  void clear_username();
+  const std::string& username() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_username(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_username();
+  PROTOBUF_NODISCARD std::string* release_username();
+  void set_allocated_username(std::string* username);
+  private:
+  const std::string& _internal_username() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_username(const std::string& value);
+  std::string* _internal_mutable_username();
+  public:
+
+  // string text = 4;
+  void clear_text();
+  const std::string& text() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_text(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_text();
+  PROTOBUF_NODISCARD std::string* release_text();
+  void set_allocated_text(std::string* text);
+  private:
+  const std::string& _internal_text() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_text(const std::string& value);
+  std::string* _internal_mutable_text();
+  public:
+
+  // .ServiceData.Timestamp time = 5;
+  bool has_time() const;
+  private:
+  bool _internal_has_time() const;
+  public:
+  void clear_time();
+  const ::ServiceData::Timestamp& time() const;
+  PROTOBUF_NODISCARD ::ServiceData::Timestamp* release_time();
+  ::ServiceData::Timestamp* mutable_time();
+  void set_allocated_time(::ServiceData::Timestamp* time);
+  private:
+  const ::ServiceData::Timestamp& _internal_time() const;
+  ::ServiceData::Timestamp* _internal_mutable_time();
+  public:
+  void unsafe_arena_set_allocated_time(
+      ::ServiceData::Timestamp* time);
+  ::ServiceData::Timestamp* unsafe_arena_release_time();
+
+  // uint64 id = 1;
+  void clear_id();
+  uint64_t id() const;
+  void set_id(uint64_t value);
+  private:
+  uint64_t _internal_id() const;
+  void _internal_set_id(uint64_t value);
+  public:
+
+  // uint64 parent_id = 3;
+  void clear_parent_id();
+  uint64_t parent_id() const;
+  void set_parent_id(uint64_t value);
+  private:
+  uint64_t _internal_parent_id() const;
+  void _internal_set_parent_id(uint64_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:ServiceData.Chirp)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t > children_ids_;
+    mutable std::atomic<int> _children_ids_cached_byte_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr username_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr text_;
+    ::ServiceData::Timestamp* time_;
+    uint64_t id_;
+    uint64_t parent_id_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_service_5fdata_2eproto;
+};
+// -------------------------------------------------------------------
+
+class NowChirpId final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:ServiceData.NowChirpId) */ {
+ public:
+  inline NowChirpId() : NowChirpId(nullptr) {}
+  ~NowChirpId() override;
+  explicit PROTOBUF_CONSTEXPR NowChirpId(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  NowChirpId(const NowChirpId& from);
+  NowChirpId(NowChirpId&& from) noexcept
+    : NowChirpId() {
+    *this = ::std::move(from);
+  }
+
+  inline NowChirpId& operator=(const NowChirpId& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline NowChirpId& operator=(NowChirpId&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const NowChirpId& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const NowChirpId* internal_default_instance() {
+    return reinterpret_cast<const NowChirpId*>(
+               &_NowChirpId_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    5;
+
+  friend void swap(NowChirpId& a, NowChirpId& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(NowChirpId* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(NowChirpId* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  NowChirpId* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<NowChirpId>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const NowChirpId& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const NowChirpId& from) {
+    NowChirpId::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(NowChirpId* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "ServiceData.NowChirpId";
+  }
+  protected:
+  explicit NowChirpId(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kNowIdFieldNumber = 1,
+  };
+  // uint64 now_id = 1;
+  void clear_now_id();
+  uint64_t now_id() const;
+  void set_now_id(uint64_t value);
+  private:
+  uint64_t _internal_now_id() const;
+  void _internal_set_now_id(uint64_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:ServiceData.NowChirpId)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    uint64_t now_id_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_service_5fdata_2eproto;
+};
+// ===================================================================
+
+
+// ===================================================================
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic push
+  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
+#endif  // __GNUC__
+// Timestamp
+
+// int64 seconds = 1;
+inline void Timestamp::clear_seconds() {
+  _impl_.seconds_ = int64_t{0};
+}
+inline int64_t Timestamp::_internal_seconds() const {
+  return _impl_.seconds_;
+}
+inline int64_t Timestamp::seconds() const {
+  // @@protoc_insertion_point(field_get:ServiceData.Timestamp.seconds)
+  return _internal_seconds();
+}
+inline void Timestamp::_internal_set_seconds(int64_t value) {
+  
+  _impl_.seconds_ = value;
+}
+inline void Timestamp::set_seconds(int64_t value) {
+  _internal_set_seconds(value);
+  // @@protoc_insertion_point(field_set:ServiceData.Timestamp.seconds)
+}
+
+// int64 useconds = 2;
+inline void Timestamp::clear_useconds() {
+  _impl_.useconds_ = int64_t{0};
+}
+inline int64_t Timestamp::_internal_useconds() const {
+  return _impl_.useconds_;
+}
+inline int64_t Timestamp::useconds() const {
+  // @@protoc_insertion_point(field_get:ServiceData.Timestamp.useconds)
+  return _internal_useconds();
+}
+inline void Timestamp::_internal_set_useconds(int64_t value) {
+  
+  _impl_.useconds_ = value;
+}
+inline void Timestamp::set_useconds(int64_t value) {
+  _internal_set_useconds(value);
+  // @@protoc_insertion_point(field_set:ServiceData.Timestamp.useconds)
+}
+
+// -------------------------------------------------------------------
+
+// User
+
+// string username = 1;
+inline void User::clear_username() {
+  _impl_.username_.ClearToEmpty();
+}
+inline const std::string& User::username() const {
+  // @@protoc_insertion_point(field_get:ServiceData.User.username)
+  return _internal_username();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void User::set_username(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.username_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:ServiceData.User.username)
+}
+inline std::string* User::mutable_username() {
+  std::string* _s = _internal_mutable_username();
+  // @@protoc_insertion_point(field_mutable:ServiceData.User.username)
+  return _s;
+}
+inline const std::string& User::_internal_username() const {
+  return _impl_.username_.Get();
+}
+inline void User::_internal_set_username(const std::string& value) {
+  
+  _impl_.username_.Set(value, GetArenaForAllocation());
+}
+inline std::string* User::_internal_mutable_username() {
+  
+  return _impl_.username_.Mutable(GetArenaForAllocation());
+}
+inline std::string* User::release_username() {
+  // @@protoc_insertion_point(field_release:ServiceData.User.username)
+  return _impl_.username_.Release();
+}
+inline void User::set_allocated_username(std::string* username) {
+  if (username != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.username_.SetAllocated(username, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.username_.IsDefault()) {
+    _impl_.username_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:ServiceData.User.username)
+}
+
+// .ServiceData.Timestamp last_update = 2;
+inline bool User::_internal_has_last_update() const {
+  return this != internal_default_instance() && _impl_.last_update_ != nullptr;
+}
+inline bool User::has_last_update() const {
+  return _internal_has_last_update();
+}
+inline void User::clear_last_update() {
+  if (GetArenaForAllocation() == nullptr && _impl_.last_update_ != nullptr) {
+    delete _impl_.last_update_;
+  }
+  _impl_.last_update_ = nullptr;
+}
+inline const ::ServiceData::Timestamp& User::_internal_last_update() const {
+  const ::ServiceData::Timestamp* p = _impl_.last_update_;
+  return p != nullptr ? *p : reinterpret_cast<const ::ServiceData::Timestamp&>(
+      ::ServiceData::_Timestamp_default_instance_);
+}
+inline const ::ServiceData::Timestamp& User::last_update() const {
+  // @@protoc_insertion_point(field_get:ServiceData.User.last_update)
+  return _internal_last_update();
+}
+inline void User::unsafe_arena_set_allocated_last_update(
+    ::ServiceData::Timestamp* last_update) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.last_update_);
+  }
+  _impl_.last_update_ = last_update;
+  if (last_update) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:ServiceData.User.last_update)
+}
+inline ::ServiceData::Timestamp* User::release_last_update() {
+  
+  ::ServiceData::Timestamp* temp = _impl_.last_update_;
+  _impl_.last_update_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::ServiceData::Timestamp* User::unsafe_arena_release_last_update() {
+  // @@protoc_insertion_point(field_release:ServiceData.User.last_update)
+  
+  ::ServiceData::Timestamp* temp = _impl_.last_update_;
+  _impl_.last_update_ = nullptr;
+  return temp;
+}
+inline ::ServiceData::Timestamp* User::_internal_mutable_last_update() {
+  
+  if (_impl_.last_update_ == nullptr) {
+    auto* p = CreateMaybeMessage<::ServiceData::Timestamp>(GetArenaForAllocation());
+    _impl_.last_update_ = p;
+  }
+  return _impl_.last_update_;
+}
+inline ::ServiceData::Timestamp* User::mutable_last_update() {
+  ::ServiceData::Timestamp* _msg = _internal_mutable_last_update();
+  // @@protoc_insertion_point(field_mutable:ServiceData.User.last_update)
+  return _msg;
+}
+inline void User::set_allocated_last_update(::ServiceData::Timestamp* last_update) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.last_update_;
+  }
+  if (last_update) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(last_update);
+    if (message_arena != submessage_arena) {
+      last_update = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, last_update, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  _impl_.last_update_ = last_update;
+  // @@protoc_insertion_point(field_set_allocated:ServiceData.User.last_update)
+}
+
+// -------------------------------------------------------------------
+
+// UserFollowingList
+
+// repeated string username = 1;
+inline int UserFollowingList::_internal_username_size() const {
+  return _impl_.username_.size();
+}
+inline int UserFollowingList::username_size() const {
+  return _internal_username_size();
+}
+inline void UserFollowingList::clear_username() {
+  _impl_.username_.Clear();
+}
+inline std::string* UserFollowingList::add_username() {
+  std::string* _s = _internal_add_username();
+  // @@protoc_insertion_point(field_add_mutable:ServiceData.UserFollowingList.username)
+  return _s;
+}
+inline const std::string& UserFollowingList::_internal_username(int index) const {
+  return _impl_.username_.Get(index);
+}
+inline const std::string& UserFollowingList::username(int index) const {
+  // @@protoc_insertion_point(field_get:ServiceData.UserFollowingList.username)
+  return _internal_username(index);
+}
+inline std::string* UserFollowingList::mutable_username(int index) {
+  // @@protoc_insertion_point(field_mutable:ServiceData.UserFollowingList.username)
+  return _impl_.username_.Mutable(index);
+}
+inline void UserFollowingList::set_username(int index, const std::string& value) {
+  _impl_.username_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set:ServiceData.UserFollowingList.username)
+}
+inline void UserFollowingList::set_username(int index, std::string&& value) {
+  _impl_.username_.Mutable(index)->assign(std::move(value));
+  // @@protoc_insertion_point(field_set:ServiceData.UserFollowingList.username)
+}
+inline void UserFollowingList::set_username(int index, const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.username_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set_char:ServiceData.UserFollowingList.username)
+}
+inline void UserFollowingList::set_username(int index, const char* value, size_t size) {
+  _impl_.username_.Mutable(index)->assign(
+    reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_set_pointer:ServiceData.UserFollowingList.username)
+}
+inline std::string* UserFollowingList::_internal_add_username() {
+  return _impl_.username_.Add();
+}
+inline void UserFollowingList::add_username(const std::string& value) {
+  _impl_.username_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add:ServiceData.UserFollowingList.username)
+}
+inline void UserFollowingList::add_username(std::string&& value) {
+  _impl_.username_.Add(std::move(value));
+  // @@protoc_insertion_point(field_add:ServiceData.UserFollowingList.username)
+}
+inline void UserFollowingList::add_username(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.username_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add_char:ServiceData.UserFollowingList.username)
+}
+inline void UserFollowingList::add_username(const char* value, size_t size) {
+  _impl_.username_.Add()->assign(reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_add_pointer:ServiceData.UserFollowingList.username)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>&
+UserFollowingList::username() const {
+  // @@protoc_insertion_point(field_list:ServiceData.UserFollowingList.username)
+  return _impl_.username_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>*
+UserFollowingList::mutable_username() {
+  // @@protoc_insertion_point(field_mutable_list:ServiceData.UserFollowingList.username)
+  return &_impl_.username_;
+}
+
+// -------------------------------------------------------------------
+
+// UserChirpList
+
+// repeated uint64 chirp_id = 1;
+inline int UserChirpList::_internal_chirp_id_size() const {
+  return _impl_.chirp_id_.size();
+}
+inline int UserChirpList::chirp_id_size() const {
+  return _internal_chirp_id_size();
+}
+inline void UserChirpList::clear_chirp_id() {
+  _impl_.chirp_id_.Clear();
+}
+inline uint64_t UserChirpList::_internal_chirp_id(int index) const {
+  return _impl_.chirp_id_.Get(index);
+}
+inline uint64_t UserChirpList::chirp_id(int index) const {
+  // @@protoc_insertion_point(field_get:ServiceData.UserChirpList.chirp_id)
+  return _internal_chirp_id(index);
+}
+inline void UserChirpList::set_chirp_id(int index, uint64_t value) {
+  _impl_.chirp_id_.Set(index, value);
+  // @@protoc_insertion_point(field_set:ServiceData.UserChirpList.chirp_id)
+}
+inline void UserChirpList::_internal_add_chirp_id(uint64_t value) {
+  _impl_.chirp_id_.Add(value);
+}
+inline void UserChirpList::add_chirp_id(uint64_t value) {
+  _internal_add_chirp_id(value);
+  // @@protoc_insertion_point(field_add:ServiceData.UserChirpList.chirp_id)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >&
+UserChirpList::_internal_chirp_id() const {
+  return _impl_.chirp_id_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >&
+UserChirpList::chirp_id() const {
+  // @@protoc_insertion_point(field_list:ServiceData.UserChirpList.chirp_id)
+  return _internal_chirp_id();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >*
+UserChirpList::_internal_mutable_chirp_id() {
+  return &_impl_.chirp_id_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >*
+UserChirpList::mutable_chirp_id() {
+  // @@protoc_insertion_point(field_mutable_list:ServiceData.UserChirpList.chirp_id)
+  return _internal_mutable_chirp_id();
+}
+
+// -------------------------------------------------------------------
+
+// Chirp
+
+// uint64 id = 1;
+inline void Chirp::clear_id() {
+  _impl_.id_ = uint64_t{0u};
+}
+inline uint64_t Chirp::_internal_id() const {
+  return _impl_.id_;
+}
+inline uint64_t Chirp::id() const {
+  // @@protoc_insertion_point(field_get:ServiceData.Chirp.id)
+  return _internal_id();
+}
+inline void Chirp::_internal_set_id(uint64_t value) {
+  
+  _impl_.id_ = value;
+}
+inline void Chirp::set_id(uint64_t value) {
+  _internal_set_id(value);
+  // @@protoc_insertion_point(field_set:ServiceData.Chirp.id)
+}
+
+// string username = 2;
+inline void Chirp::clear_username() {
+  _impl_.username_.ClearToEmpty();
+}
+inline const std::string& Chirp::username() const {
+  // @@protoc_insertion_point(field_get:ServiceData.Chirp.username)
+  return _internal_username();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void Chirp::set_username(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.username_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:ServiceData.Chirp.username)
+}
+inline std::string* Chirp::mutable_username() {
+  std::string* _s = _internal_mutable_username();
+  // @@protoc_insertion_point(field_mutable:ServiceData.Chirp.username)
+  return _s;
+}
+inline const std::string& Chirp::_internal_username() const {
+  return _impl_.username_.Get();
+}
+inline void Chirp::_internal_set_username(const std::string& value) {
+  
+  _impl_.username_.Set(value, GetArenaForAllocation());
+}
+inline std::string* Chirp::_internal_mutable_username() {
+  
+  return _impl_.username_.Mutable(GetArenaForAllocation());
+}
+inline std::string* Chirp::release_username() {
+  // @@protoc_insertion_point(field_release:ServiceData.Chirp.username)
+  return _impl_.username_.Release();
+}
+inline void Chirp::set_allocated_username(std::string* username) {
+  if (username != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.username_.SetAllocated(username, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.username_.IsDefault()) {
+    _impl_.username_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:ServiceData.Chirp.username)
+}
+
+// uint64 parent_id = 3;
+inline void Chirp::clear_parent_id() {
+  _impl_.parent_id_ = uint64_t{0u};
+}
+inline uint64_t Chirp::_internal_parent_id() const {
+  return _impl_.parent_id_;
+}
+inline uint64_t Chirp::parent_id() const {
+  // @@protoc_insertion_point(field_get:ServiceData.Chirp.parent_id)
+  return _internal_parent_id();
+}
+inline void Chirp::_internal_set_parent_id(uint64_t value) {
+  
+  _impl_.parent_id_ = value;
+}
+inline void Chirp::set_parent_id(uint64_t value) {
+  _internal_set_parent_id(value);
+  // @@protoc_insertion_point(field_set:ServiceData.Chirp.parent_id)
+}
+
+// string text = 4;
+inline void Chirp::clear_text() {
+  _impl_.text_.ClearToEmpty();
+}
+inline const std::string& Chirp::text() const {
+  // @@protoc_insertion_point(field_get:ServiceData.Chirp.text)
+  return _internal_text();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void Chirp::set_text(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.text_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:ServiceData.Chirp.text)
+}
+inline std::string* Chirp::mutable_text() {
+  std::string* _s = _internal_mutable_text();
+  // @@protoc_insertion_point(field_mutable:ServiceData.Chirp.text)
+  return _s;
+}
+inline const std::string& Chirp::_internal_text() const {
+  return _impl_.text_.Get();
+}
+inline void Chirp::_internal_set_text(const std::string& value) {
+  
+  _impl_.text_.Set(value, GetArenaForAllocation());
+}
+inline std::string* Chirp::_internal_mutable_text() {
+  
+  return _impl_.text_.Mutable(GetArenaForAllocation());
+}
+inline std::string* Chirp::release_text() {
+  // @@protoc_insertion_point(field_release:ServiceData.Chirp.text)
+  return _impl_.text_.Release();
+}
+inline void Chirp::set_allocated_text(std::string* text) {
+  if (text != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.text_.SetAllocated(text, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.text_.IsDefault()) {
+    _impl_.text_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:ServiceData.Chirp.text)
+}
+
+// .ServiceData.Timestamp time = 5;
+inline bool Chirp::_internal_has_time() const {
+  return this != internal_default_instance() && _impl_.time_ != nullptr;
+}
+inline bool Chirp::has_time() const {
+  return _internal_has_time();
+}
+inline void Chirp::clear_time() {
+  if (GetArenaForAllocation() == nullptr && _impl_.time_ != nullptr) {
+    delete _impl_.time_;
+  }
+  _impl_.time_ = nullptr;
+}
+inline const ::ServiceData::Timestamp& Chirp::_internal_time() const {
+  const ::ServiceData::Timestamp* p = _impl_.time_;
+  return p != nullptr ? *p : reinterpret_cast<const ::ServiceData::Timestamp&>(
+      ::ServiceData::_Timestamp_default_instance_);
+}
+inline const ::ServiceData::Timestamp& Chirp::time() const {
+  // @@protoc_insertion_point(field_get:ServiceData.Chirp.time)
+  return _internal_time();
+}
+inline void Chirp::unsafe_arena_set_allocated_time(
+    ::ServiceData::Timestamp* time) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.time_);
+  }
+  _impl_.time_ = time;
+  if (time) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:ServiceData.Chirp.time)
+}
+inline ::ServiceData::Timestamp* Chirp::release_time() {
+  
+  ::ServiceData::Timestamp* temp = _impl_.time_;
+  _impl_.time_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::ServiceData::Timestamp* Chirp::unsafe_arena_release_time() {
+  // @@protoc_insertion_point(field_release:ServiceData.Chirp.time)
+  
+  ::ServiceData::Timestamp* temp = _impl_.time_;
+  _impl_.time_ = nullptr;
+  return temp;
+}
+inline ::ServiceData::Timestamp* Chirp::_internal_mutable_time() {
+  
+  if (_impl_.time_ == nullptr) {
+    auto* p = CreateMaybeMessage<::ServiceData::Timestamp>(GetArenaForAllocation());
+    _impl_.time_ = p;
+  }
+  return _impl_.time_;
+}
+inline ::ServiceData::Timestamp* Chirp::mutable_time() {
+  ::ServiceData::Timestamp* _msg = _internal_mutable_time();
+  // @@protoc_insertion_point(field_mutable:ServiceData.Chirp.time)
+  return _msg;
+}
+inline void Chirp::set_allocated_time(::ServiceData::Timestamp* time) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.time_;
+  }
+  if (time) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(time);
+    if (message_arena != submessage_arena) {
+      time = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, time, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  _impl_.time_ = time;
+  // @@protoc_insertion_point(field_set_allocated:ServiceData.Chirp.time)
+}
+
+// repeated uint64 children_ids = 6;
+inline int Chirp::_internal_children_ids_size() const {
+  return _impl_.children_ids_.size();
+}
+inline int Chirp::children_ids_size() const {
+  return _internal_children_ids_size();
+}
+inline void Chirp::clear_children_ids() {
+  _impl_.children_ids_.Clear();
+}
+inline uint64_t Chirp::_internal_children_ids(int index) const {
+  return _impl_.children_ids_.Get(index);
+}
+inline uint64_t Chirp::children_ids(int index) const {
+  // @@protoc_insertion_point(field_get:ServiceData.Chirp.children_ids)
+  return _internal_children_ids(index);
+}
+inline void Chirp::set_children_ids(int index, uint64_t value) {
+  _impl_.children_ids_.Set(index, value);
+  // @@protoc_insertion_point(field_set:ServiceData.Chirp.children_ids)
+}
+inline void Chirp::_internal_add_children_ids(uint64_t value) {
+  _impl_.children_ids_.Add(value);
+}
+inline void Chirp::add_children_ids(uint64_t value) {
+  _internal_add_children_ids(value);
+  // @@protoc_insertion_point(field_add:ServiceData.Chirp.children_ids)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >&
+Chirp::_internal_children_ids() const {
+  return _impl_.children_ids_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >&
+Chirp::children_ids() const {
+  // @@protoc_insertion_point(field_list:ServiceData.Chirp.children_ids)
+  return _internal_children_ids();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >*
+Chirp::_internal_mutable_children_ids() {
+  return &_impl_.children_ids_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >*
+Chirp::mutable_children_ids() {
+  // @@protoc_insertion_point(field_mutable_list:ServiceData.Chirp.children_ids)
+  return _internal_mutable_children_ids();
+}
+
+// -------------------------------------------------------------------
+
+// NowChirpId
+
+// uint64 now_id = 1;
+inline void NowChirpId::clear_now_id() {
+  _impl_.now_id_ = uint64_t{0u};
+}
+inline uint64_t NowChirpId::_internal_now_id() const {
+  return _impl_.now_id_;
+}
+inline uint64_t NowChirpId::now_id() const {
+  // @@protoc_insertion_point(field_get:ServiceData.NowChirpId.now_id)
+  return _internal_now_id();
+}
+inline void NowChirpId::_internal_set_now_id(uint64_t value) {
+  
+  _impl_.now_id_ = value;
+}
+inline void NowChirpId::set_now_id(uint64_t value) {
+  _internal_set_now_id(value);
+  // @@protoc_insertion_point(field_set:ServiceData.NowChirpId.now_id)
+}
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic pop
+#endif  // __GNUC__
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+
+// @@protoc_insertion_point(namespace_scope)
+
+}  // namespace ServiceData
+
+// @@protoc_insertion_point(global_scope)
+
+#include <google/protobuf/port_undef.inc>
+#endif  // GOOGLE_PROTOBUF_INCLUDED_GOOGLE_PROTOBUF_INCLUDED_service_5fdata_2eproto
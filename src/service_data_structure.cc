@@ -123,50 +123,39 @@ const std::string ServiceDataStructure::Chirp::ExportBinary() const {
   return ret;
 }
 
-ServiceDataStructure::UserSession::UserSession(const std::string &username) {
+const uint64_t ServiceDataStructure::UserSession::kMonitorLookbackMs;
+
+ServiceDataStructure::UserSession::UserSession(const std::string &username)
+    : monitoring_(false), monitored_chirps_() {
   bool ok = chirp_connect_backend::GetUser(username, &(this->user_));
   CHECK(ok) << "User `" << username << "` should exist.";
 }
 
 ServiceDataStructure::ReturnCodes ServiceDataStructure::UserSession::Follow(
     const std::string &username) {
-  UserFollowingList following_list;
-  bool ok = chirp_connect_backend::GetUserFollowingList(user_.get_username(),
-                                                        &following_list);
-  CHECK(ok) << "The user following list for user `" << username
-            << "` should exist.";
-
-  bool user_found = chirp_connect_backend::GetUser(username, nullptr);
-
-  if (!user_found) {
-    return FOLLOWEE_NOT_FOUND;
-  }
+  // The followee is checked by the same request that follows it
+  chirp_connect_backend::WriteBatch batch;
+  batch.ExpectUser(username);
+  batch.AddToUserFollowingList(user_.get_username(), username);
 
-  following_list.insert(username);
-  if (!chirp_connect_backend::SaveUserFollowingList(user_.get_username(),
-                                                    following_list)) {
-    // if saving fails
-    return INTERNAL_BACKEND_ERROR;
+  int failed_expectation;
+  if (!batch.Commit(&failed_expectation)) {
+    return failed_expectation < 0 ? INTERNAL_BACKEND_ERROR
+                                  : FOLLOWEE_NOT_FOUND;
   }
   return OK;
 }
 
 ServiceDataStructure::ReturnCodes ServiceDataStructure::UserSession::Unfollow(
     const std::string &username) {
-  UserFollowingList following_list;
-  bool ok = chirp_connect_backend::GetUserFollowingList(user_.get_username(),
-                                                        &following_list);
-  CHECK(ok) << "The user following list for user `" << username
-            << "` should exist.";
-
-  bool erased = following_list.erase(username);
-  if (!erased) {
-    // if erasing fails
-    return FOLLOWEE_NOT_FOUND;
-  } else if (!chirp_connect_backend::SaveUserFollowingList(user_.get_username(),
-                                                           following_list)) {
+  bool erased;
+  if (!chirp_connect_backend::RemoveFromUserFollowingList(
+          user_.get_username(), username, &erased)) {
     // if saving fails
     return INTERNAL_BACKEND_ERROR;
+  } else if (!erased) {
+    // if erasing fails
+    return FOLLOWEE_NOT_FOUND;
   }
 
   return OK;
@@ -176,51 +165,31 @@ ServiceDataStructure::ReturnCodes ServiceDataStructure::UserSession::PostChirp(
     const std::string &text, uint64_t *const chirp_id,
     const uint64_t &parent_id) {
   Chirp chirp(user_.get_username(), parent_id, text);
-
-  // If the `parent_id` is specified
-  if (parent_id > 0) {
-    Chirp parent_chirp;
-    bool parent_found =
-        chirp_connect_backend::GetChirp(parent_id, &parent_chirp);
-    if (!parent_found) {
-      return REPLY_ID_NOT_FOUND;
-    }
-
-    parent_chirp.insert_children_id(chirp.get_id());
-    bool ok =
-        chirp_connect_backend::SaveChirp(parent_chirp.get_id(), parent_chirp);
-    if (!ok) {
-      // if saving fails
-      return INTERNAL_BACKEND_ERROR;
-    }
-  }
-
-  bool ok = chirp_connect_backend::SaveChirp(chirp.get_id(), chirp);
-  if (!ok) {
-    // if saving fails
-    return INTERNAL_BACKEND_ERROR;
-  }
+  // The chirp, this user, the chirp list and the parent chirp are written
+  // together, so nobody sees the chirp in one of them but not another
+  chirp_connect_backend::WriteBatch batch;
+  batch.SaveChirp(chirp.get_id(), chirp);
 
   // Update the information of this user
-  user_.set_last_update(chirp.get_time());
-  ok = chirp_connect_backend::SaveUser(user_.get_username(), user_);
-  if (!ok) {
-    // if saving fails
-    return INTERNAL_BACKEND_ERROR;
+  User user(user_);
+  user.set_last_update(chirp.get_time());
+  batch.SaveUser(user.get_username(), user);
+
+  // Only the new id is sent to the lists, not the whole lists
+  batch.AddToUserChirpList(user.get_username(), chirp.get_id());
+  // If the `parent_id` is specified, it should still exist when the reply
+  // is added to it
+  if (parent_id > 0) {
+    batch.ExpectChirp(parent_id);
+    batch.AddChirpChild(parent_id, chirp.get_id());
   }
 
-  UserChirpList chirp_list;
-  ok = chirp_connect_backend::GetUserChirpList(user_.get_username(),
-                                               &chirp_list);
-  CHECK(ok) << "The user chirp list for user `" << user_.get_username()
-            << "` should exist.";
-  chirp_list.insert(chirp.get_id());
-  ok = chirp_connect_backend::SaveUserChirpList(user_.get_username(),
-                                                chirp_list);
-  if (!ok) {
-    // if saving fails
-    return INTERNAL_BACKEND_ERROR;
+  int failed_expectation;
+  if (!batch.Commit(&failed_expectation)) {
+    return failed_expectation < 0 ? INTERNAL_BACKEND_ERROR
+                                  : REPLY_ID_NOT_FOUND;
   }
+  user_ = user;
 
   if (chirp_id != nullptr) {
     *chirp_id = chirp.get_id();
@@ -260,37 +229,25 @@ ServiceDataStructure::UserSession::DeleteChirp(const uint64_t &id) {
     return PERMISSION_DENIED;
   }
 
-  // If the chirp is found and its posting user is the user in this session
-  UserChirpList chirp_list;
-  ok = chirp_connect_backend::GetUserChirpList(user_.get_username(),
-                                               &chirp_list);
-  CHECK(ok) << "The user chirp list for user `" << user_.get_username()
-            << "` should exist.";
-
-  // if parent id is specified
+  // If the chirp is found and its posting user is the user in this session,
+  // it is taken out of the lists and deleted together, unless it or its
+  // parent is deleted by someone else first. Only the id is sent to the
+  // lists, not the whole lists.
+  chirp_connect_backend::WriteBatch batch;
+  batch.ExpectChirp(id);
   if (chirp.get_parent_id() > 0) {
-    Chirp parent_chirp;
-    bool parent_found =
-        chirp_connect_backend::GetChirp(chirp.get_parent_id(), &parent_chirp);
-    if (!parent_found) {
-      return REPLY_ID_NOT_FOUND;
-    }
-    parent_chirp.erase_children_id(chirp.get_id());
-    ok = chirp_connect_backend::SaveChirp(parent_chirp.get_id(), parent_chirp);
-    if (!ok) {
-      // if saving fails
-      return INTERNAL_BACKEND_ERROR;
-    }
+    batch.ExpectChirp(chirp.get_parent_id());
+    batch.RemoveChirpChild(chirp.get_parent_id(), id);
   }
+  batch.RemoveFromUserChirpList(user_.get_username(), id);
+  batch.DeleteChirp(id);
 
-  chirp_list.erase(chirp.get_id());
-  ok = chirp_connect_backend::DeleteChirp(id);
-  ok &= chirp_connect_backend::SaveUserChirpList(user_.get_username(),
-                                                 chirp_list);
-
-  if (!ok) {
-    // if saving fails
-    return INTERNAL_BACKEND_ERROR;
+  int failed_expectation;
+  if (!batch.Commit(&failed_expectation)) {
+    if (failed_expectation < 0) {
+      return INTERNAL_BACKEND_ERROR;
+    }
+    return failed_expectation == 0 ? CHIRP_ID_NOT_FOUND : REPLY_ID_NOT_FOUND;
   }
   return OK;
 }
@@ -300,49 +257,112 @@ std::set<uint64_t> ServiceDataStructure::UserSession::MonitorFrom(
   struct timeval now;
   gettimeofday(&now, nullptr);
 
+  // A call continuing the monitor looks back for chirps that became visible
+  // late. Otherwise the monitor starts over at `from`.
+  struct timeval start = *from;
+  if (monitoring_ && !(*from != monitored_until_)) {
+    start = monitor_next_start_;
+  } else {
+    monitored_chirps_.clear();
+  }
+
   std::set<uint64_t> ret;
 
+  // Every list and chirp is read at the same snapshot, so a chirp posted or
+  // deleted meanwhile is either seen everywhere or nowhere
+  uint64_t snapshot = chirp_connect_backend::CreateSnapshot();
+
   UserFollowingList user_following_list;
-  bool ok = chirp_connect_backend::GetUserFollowingList(user_.get_username(),
-                                                        &user_following_list);
+  bool ok = chirp_connect_backend::GetUserFollowingList(
+      user_.get_username(), &user_following_list, snapshot);
   CHECK(ok) << "The user following list for user `" << user_.get_username()
             << "` should exist.";
 
   // TODO: may open threads to do the following things
   for (const auto &username : user_following_list) {
     User user;
-    ok = chirp_connect_backend::GetUser(username, &user);
+    ok = chirp_connect_backend::GetUser(username, &user, snapshot);
     CHECK(ok) << "User `" << username << "` should exist.";
 
     // to check if the `user.last_update_` is later or equal to the
-    // `from`
-    if (user.get_last_update() >= *from) {
+    // `start`
+    if (user.get_last_update() >= start) {
       // Do push_backs
       UserChirpList user_chirp_list;
-      ok = chirp_connect_backend::GetUserChirpList(user.get_username(),
-                                                   &user_chirp_list);
+      ok = chirp_connect_backend::GetUserChirpList(
+          user.get_username(), &user_chirp_list, snapshot);
       CHECK(ok) << "The user chirp list for user `" << user_.get_username()
                 << "` should exist.";
 
       for (const auto &chirp_id : user_chirp_list) {
         Chirp chirp;
-        ok = chirp_connect_backend::GetChirp(chirp_id, &chirp);
+        ok = chirp_connect_backend::GetChirp(chirp_id, &chirp, snapshot);
         CHECK(ok) << "The chirp with chirp_id `" << chirp_id
                   << "` should exist.";
 
-        // to check if the `chirp.time` is later or equal to the `from` and
-        // `chirp.time` is earlier than `now`
-        if (chirp.get_time() >= *from && chirp.get_time() < now) {
+        // to check if the `chirp.time` is later or equal to the `start`,
+        // `chirp.time` is earlier than `now` and the chirp is not returned
+        // yet
+        if (chirp.get_time() >= start && chirp.get_time() < now &&
+            monitored_chirps_.insert(std::make_pair(chirp_id, chirp.get_time()))
+                .second) {
           ret.insert(chirp_id);
         }
       }
     }
   }
 
+  chirp_connect_backend::ReleaseSnapshot(snapshot);
+
+  // The next call reads again from a bit before `now`, and only needs to
+  // remember the chirps from there on
+  struct timeval lookback = {
+      static_cast<time_t>(kMonitorLookbackMs / 1000),
+      static_cast<suseconds_t>(kMonitorLookbackMs % 1000 * 1000)};
+  timersub(&now, &lookback, &monitor_next_start_);
+  if (monitor_next_start_ < start) {
+    monitor_next_start_ = start;
+  }
+  for (auto it = monitored_chirps_.begin(); it != monitored_chirps_.end();) {
+    if (it->second < monitor_next_start_) {
+      it = monitored_chirps_.erase(it);
+    } else {
+      ++it;
+    }
+  }
+  monitoring_ = true;
+  monitored_until_ = now;
+
   *from = now;
   return ret;
 }
 
+bool ServiceDataStructure::UserSession::WatchFrom(
+    struct timeval *const from, std::chrono::milliseconds tick,
+    const std::function<bool(const std::set<uint64_t> &)> &on_chirps) {
+  bool monitoring = true;
+  while (monitoring) {
+    // The users followed are watched until the following list changes, and
+    // then the new ones are
+    bool following_changed = false;
+    bool ok = chirp_connect_backend::WatchUsers(
+        user_.get_username(), SessionGetUserFollowingList(), tick,
+        [&](bool changed, bool changed_following) {
+          std::set<uint64_t> chirps;
+          if (changed) {
+            chirps = MonitorFrom(from);
+          }
+          monitoring = on_chirps(chirps);
+          following_changed = changed_following;
+          return monitoring && !following_changed;
+        });
+    if (!ok) {
+      return false;
+    }
+  }
+  return true;
+}
+
 ServiceDataStructure::ReturnCodes ServiceDataStructure::UserRegister(
     const std::string &username) {
   // Invalid username
@@ -350,33 +370,27 @@ ServiceDataStructure::ReturnCodes ServiceDataStructure::UserRegister(
     return INVALID_ARGUMENT;
   }
 
-  bool user_found = chirp_connect_backend::GetUser(username, nullptr);
-  if (user_found) {
-    return USER_EXISTS;
-  }
-
-  // If the specified username has not been registered
+  // The user and its lists are saved together, and only if the username has
+  // not been registered, so nothing is left half registered
   User new_user(username);
   UserChirpList chirp_list;
   UserFollowingList following_list;
-  bool ok =
-      chirp_connect_backend::SaveUser(username, new_user) &&
-      chirp_connect_backend::SaveUserChirpList(username, chirp_list) &&
-      chirp_connect_backend::SaveUserFollowingList(username, following_list);
-  if (!ok) {
-    // if saving fails
-    chirp_connect_backend::DeleteUser(username);
-    chirp_connect_backend::DeleteUserChirpList(username);
-    chirp_connect_backend::DeleteUserFollowingList(username);
-    return INTERNAL_BACKEND_ERROR;
-  }
+  chirp_connect_backend::WriteBatch batch;
+  batch.ExpectNoUser(username);
+  batch.SaveUser(username, new_user);
+  batch.SaveUserChirpList(username, chirp_list);
+  batch.SaveUserFollowingList(username, following_list);
 
+  int failed_expectation;
+  if (!batch.Commit(&failed_expectation)) {
+    return failed_expectation < 0 ? INTERNAL_BACKEND_ERROR : USER_EXISTS;
+  }
   return OK;
 }
 
 std::unique_ptr<ServiceDataStructure::UserSession>
 ServiceDataStructure::UserLogin(const std::string &username) {
-  bool user_found = chirp_connect_backend::GetUser(username, nullptr);
+  bool user_found = chirp_connect_backend::UserExists(username);
 
   if (!user_found) {
     return nullptr;
@@ -393,60 +407,111 @@ const std::string kTypeUsernameToFollowingPrefix({0, 0, 0, char(3)});
 const std::string kTypeUsernameToChirpPrefix({0, 0, 0, char(4)});
 const std::string kTypeChirpidToChirpPrefix({0, 0, 0, char(5)});
 
+namespace {
+// Replaces a `NowChirpId` message stored at `kTypeNextChirpId` with a counter
+// holding the same id. A compare-and-swap is used so that an id taken by
+// another service server in the meantime is not lost.
+// returns true if the value is a counter afterwards
+// returns false otherwise
+bool ConvertNextChirpIdToCounter() {
+  std::vector<std::string> reply;
+  bool ok = chirp_connect_backend::backend_client_->SendGetRequest(
+      std::vector<std::string>({kTypeNextChirpId}), &reply);
+  if (!ok) {
+    return false;
+  }
+
+  std::string current = reply[0];
+  while (current.size() != sizeof(uint64_t)) {
+    ServiceData::NowChirpId tmp;
+    if (!tmp.ParseFromString(current)) {
+      return false;
+    }
+    if (chirp_connect_backend::backend_client_->SendCompareAndSwapRequest(
+            kTypeNextChirpId, current, Uint64ToBinary(tmp.now_id()),
+            &current)) {
+      break;
+    }
+  }
+  return true;
+}
+
+// Gets the value of `key` at `snapshot`, or the latest value if `snapshot`
+// is 0
+// returns true if this operation succeeds
+// returns false otherwise
+bool GetValue(const std::string &key, const uint64_t &snapshot,
+              std::string *const value) {
+  std::vector<std::string> reply;
+  bool ok = snapshot == 0
+                ? chirp_connect_backend::backend_client_->SendGetRequest(
+                      std::vector<std::string>(1, key), &reply)
+                : chirp_connect_backend::backend_client_
+                      ->SendGetAtSnapshotRequest(
+                          snapshot, std::vector<std::string>(1, key), &reply);
+  if (!ok || reply.size() != 1) {
+    return false;
+  }
+  value->swap(reply[0]);
+  return true;
+}
+}  // Anonymous namespace
+
 // Definition of `backend_client`
 // The default version for this will communicate through grpc
 std::unique_ptr<BackendClient> chirp_connect_backend::backend_client_(
     new BackendClientStandard());
 
+uint64_t chirp_connect_backend::snapshot_lease_ms_ =
+    chirp_connect_backend::kDefaultSnapshotLeaseMs;
+
 // Wrapper functions
 // Wrapper function to get `next_chirp_id`
+// The id is taken with one atomic fetch_add on the backend, so concurrent
+// service servers never hand out the same id.
 uint64_t chirp_connect_backend::GetNextChirpId() {
-  std::vector<std::string> reply;
-  bool ok = chirp_connect_backend::backend_client_->SendGetRequest(
-      std::vector<std::string>({kTypeNextChirpId}), &reply);
-  CHECK(ok) << "Get request should be successful.";
-
-  // Get the next chirp id from backend
-  uint64_t ret;
-  ServiceData::NowChirpId tmp;
-  if (!reply[0].empty()) {
-    tmp.ParseFromString(reply[0]);
-    ret = tmp.now_id();
-  } else {
-    // No previous chirps
-    ret = 0;
-  }
-
-  // update the next chirp id to the backend
-  ++ret;
-  tmp.set_now_id(ret);
-  std::string binary;
-  tmp.SerializeToString(&binary);
-  ok = chirp_connect_backend::backend_client_->SendPutRequest(kTypeNextChirpId,
-                                                              binary);
-  CHECK(ok) << "Put request should be successful.";
-  return ret;
+  uint64_t previous;
+  bool ok = chirp_connect_backend::backend_client_->SendFetchAddRequest(
+      kTypeNextChirpId, 1, &previous);
+  if (!ok) {
+    // The id may still be stored as a `NowChirpId` message by an older
+    // version. Convert it to a counter once and try again.
+    ok = ConvertNextChirpIdToCounter() &&
+         chirp_connect_backend::backend_client_->SendFetchAddRequest(
+             kTypeNextChirpId, 1, &previous);
+  }
+  CHECK(ok) << "Fetch-add request should be successful.";
+  return previous + 1;
 }
 
 // Wrapper function to get a specified user object
 bool chirp_connect_backend::GetUser(
-    const std::string &username,
-    ServiceDataStructure::User *const user) {
+    const std::string &username, ServiceDataStructure::User *const user,
+    const uint64_t &snapshot) {
   std::string key = kTypeUsernameToUserPrefix + username;
-  std::vector<std::string> reply;
-  bool ok = chirp_connect_backend::backend_client_->SendGetRequest(
-      std::vector<std::string>(1, key), &reply);
+  std::string value;
+  bool ok = GetValue(key, snapshot, &value);
   CHECK(ok) << "Get request should be successful.";
-  if (reply[0].empty()) {
+  if (value.empty()) {
     return false;
   }
 
   if (user != nullptr) {
-    user->ImportBinary(reply[0]);
+    user->ImportBinary(value);
   }
   return true;
 }
 
+// Wrapper function to check whether a specified user exists
+bool chirp_connect_backend::UserExists(const std::string &username) {
+  std::string key = kTypeUsernameToUserPrefix + username;
+  std::vector<bool> exists;
+  bool ok = chirp_connect_backend::backend_client_->SendExistsRequest(
+      std::vector<std::string>(1, key), &exists);
+  CHECK(ok) << "Exists request should be successful.";
+  return exists[0];
+}
+
 // Wrapper function to save a specified user object
 bool chirp_connect_backend::SaveUser(
     const std::string &username,
@@ -467,18 +532,18 @@ bool chirp_connect_backend::DeleteUser(const std::string &username) {
 // Wrapper function to get the following list of a specified user
 bool chirp_connect_backend::GetUserFollowingList(
     const std::string &username,
-    ServiceDataStructure::UserFollowingList *const following_list) {
+    ServiceDataStructure::UserFollowingList *const following_list,
+    const uint64_t &snapshot) {
   std::string key = kTypeUsernameToFollowingPrefix + username;
-  std::vector<std::string> reply;
-  bool ok = chirp_connect_backend::backend_client_->SendGetRequest(
-      std::vector<std::string>(1, key), &reply);
+  std::string value;
+  bool ok = GetValue(key, snapshot, &value);
 
   if (!ok) {
     return false;
   }
 
   if (following_list != nullptr) {
-    following_list->ImportBinary(reply[0]);
+    following_list->ImportBinary(value);
   }
   return true;
 }
@@ -504,17 +569,17 @@ bool chirp_connect_backend::DeleteUserFollowingList(
 // Wrapper function to get the chirp list of a specified user
 bool chirp_connect_backend::GetUserChirpList(
     const std::string &username,
-    ServiceDataStructure::UserChirpList *const chirp_list) {
+    ServiceDataStructure::UserChirpList *const chirp_list,
+    const uint64_t &snapshot) {
   std::string key = kTypeUsernameToChirpPrefix + username;
-  std::vector<std::string> reply;
-  bool ok = chirp_connect_backend::backend_client_->SendGetRequest(
-      std::vector<std::string>(1, key), &reply);
+  std::string value;
+  bool ok = GetValue(key, snapshot, &value);
   if (!ok) {
     return false;
   }
 
   if (chirp_list != nullptr) {
-    chirp_list->ImportBinary(reply[0]);
+    chirp_list->ImportBinary(value);
   }
   return true;
 }
@@ -537,23 +602,73 @@ bool chirp_connect_backend::DeleteUserChirpList(const std::string &username) {
 }
 
 // Wrapper function to get a chirp
-bool chirp_connect_backend::GetChirp(
-    const uint64_t &chirp_id, ServiceDataStructure::Chirp *const chirp) {
+bool chirp_connect_backend::GetChirp(const uint64_t &chirp_id,
+                                     ServiceDataStructure::Chirp *const chirp,
+                                     const uint64_t &snapshot) {
   std::string key = kTypeChirpidToChirpPrefix + Uint64ToBinary(chirp_id);
-  std::vector<std::string> reply;
-  bool ok = chirp_connect_backend::backend_client_->SendGetRequest(
-      std::vector<std::string>(1, key), &reply);
+  std::string value;
+  bool ok = GetValue(key, snapshot, &value);
   CHECK(ok) << "Get request should be successful.";
-  if (reply[0].empty()) {
+  if (value.empty()) {
     return false;
   }
 
   if (chirp != nullptr) {
-    chirp->ImportBinary(reply[0]);
+    chirp->ImportBinary(value);
   }
   return true;
 }
 
+// Wrapper function to open a snapshot of the backend
+uint64_t chirp_connect_backend::CreateSnapshot() {
+  uint64_t snapshot;
+  bool ok = chirp_connect_backend::backend_client_->SendCreateSnapshotRequest(
+      chirp_connect_backend::snapshot_lease_ms_, &snapshot);
+  return ok ? snapshot : 0;
+}
+
+// Wrapper function to release a snapshot of the backend
+void chirp_connect_backend::ReleaseSnapshot(const uint64_t &snapshot) {
+  if (snapshot != 0) {
+    chirp_connect_backend::backend_client_->SendReleaseSnapshotRequest(
+        snapshot);
+  }
+}
+
+// Wrapper function to watch some users and a following list
+// The user objects are watched as prefixes, so a user whose name starts with
+// a watched one makes a change that is not one.
+bool chirp_connect_backend::WatchUsers(
+    const std::string &follower,
+    const ServiceDataStructure::UserFollowingList &usernames,
+    std::chrono::milliseconds tick,
+    const std::function<bool(bool changed, bool following_changed)>
+        &on_change) {
+  const std::string following_key = kTypeUsernameToFollowingPrefix + follower;
+  std::vector<std::string> prefixes(1, following_key);
+  for (const auto &username : usernames) {
+    prefixes.push_back(kTypeUsernameToUserPrefix + username);
+    // A post writes the chirp list along with the user, but on a sharded
+    // backend it can become visible later than the user
+    prefixes.push_back(kTypeUsernameToChirpPrefix + username);
+  }
+
+  // Nothing is known to be monitored yet when the watch starts
+  bool first = true;
+  return chirp_connect_backend::backend_client_->SendWatchRequest(
+      prefixes, false, tick,
+      [&](const std::vector<BackendClient::WatchEvent> &events,
+          bool overflowed) {
+        bool following_changed = overflowed;
+        for (const auto &event : events) {
+          following_changed |= event.key == following_key;
+        }
+        bool changed = first || overflowed || !events.empty();
+        first = false;
+        return on_change(changed, following_changed);
+      });
+}
+
 // Wrapper function to save a chirp
 bool chirp_connect_backend::SaveChirp(
     const uint64_t &chirp_id, const ServiceDataStructure::Chirp &chirp) {
@@ -569,3 +684,253 @@ bool chirp_connect_backend::DeleteChirp(const uint64_t &chirp_id) {
   bool ok = chirp_connect_backend::backend_client_->SendDeleteKeyRequest(key);
   return ok;
 }
+
+// Wrapper function to add a chirp id to the chirp list of a specified user
+bool chirp_connect_backend::AddToUserChirpList(const std::string &username,
+                                               const uint64_t &chirp_id) {
+  std::string key = kTypeUsernameToChirpPrefix + username;
+  return chirp_connect_backend::backend_client_->SendListAppendRequest(
+      key, ServiceData::UserChirpList::kChirpIdFieldNumber, chirp_id, true,
+      false, nullptr);
+}
+
+// Wrapper function to remove a chirp id from the chirp list of a specified
+// user
+bool chirp_connect_backend::RemoveFromUserChirpList(
+    const std::string &username, const uint64_t &chirp_id) {
+  std::string key = kTypeUsernameToChirpPrefix + username;
+  return chirp_connect_backend::backend_client_->SendListRemoveRequest(
+      key, ServiceData::UserChirpList::kChirpIdFieldNumber, chirp_id, nullptr);
+}
+
+// Wrapper function to add a followee to the following list of a specified
+// user
+bool chirp_connect_backend::AddToUserFollowingList(
+    const std::string &username, const std::string &followee) {
+  std::string key = kTypeUsernameToFollowingPrefix + username;
+  return chirp_connect_backend::backend_client_->SendListAppendRequest(
+      key, ServiceData::UserFollowingList::kUsernameFieldNumber, followee, true,
+      false, nullptr);
+}
+
+// Wrapper function to remove a followee from the following list of a
+// specified user
+bool chirp_connect_backend::RemoveFromUserFollowingList(
+    const std::string &username, const std::string &followee,
+    bool *const removed) {
+  std::string key = kTypeUsernameToFollowingPrefix + username;
+  return chirp_connect_backend::backend_client_->SendListRemoveRequest(
+      key, ServiceData::UserFollowingList::kUsernameFieldNumber, followee,
+      removed);
+}
+
+// Wrapper function to add a child id to a chirp
+bool chirp_connect_backend::AddChirpChild(const uint64_t &parent_id,
+                                          const uint64_t &child_id) {
+  std::string key = kTypeChirpidToChirpPrefix + Uint64ToBinary(parent_id);
+  return chirp_connect_backend::backend_client_->SendListAppendRequest(
+      key, ServiceData::Chirp::kChildrenIdsFieldNumber, child_id, true,
+      true, nullptr);
+}
+
+// Wrapper function to remove a child id from a chirp
+bool chirp_connect_backend::RemoveChirpChild(const uint64_t &parent_id,
+                                             const uint64_t &child_id) {
+  std::string key = kTypeChirpidToChirpPrefix + Uint64ToBinary(parent_id);
+  return chirp_connect_backend::backend_client_->SendListRemoveRequest(
+      key, ServiceData::Chirp::kChildrenIdsFieldNumber, child_id, nullptr);
+}
+
+// Start of `WriteBatch` definitions
+namespace {
+// Adds a put of `key` to `request`
+void AddPut(chirp::WriteBatchRequest *request, const std::string &key,
+            const std::string &value) {
+  chirp::PutRequest *put = request->add_writes()->mutable_put();
+  put->set_key(key);
+  put->set_value(value);
+}
+
+// Adds a delete of `key` to `request`
+void AddDelete(chirp::WriteBatchRequest *request, const std::string &key) {
+  request->add_writes()->mutable_delete_key()->set_key(key);
+}
+
+// Adds a list write of `key` to `request`, an append if `append` is true and
+// a removal otherwise, and returns it so that the element can be set
+chirp::ListElementRequest *AddListWrite(chirp::WriteBatchRequest *request,
+                                        const std::string &key,
+                                        uint32_t field, bool append) {
+  chirp::BatchWrite *write = request->add_writes();
+  chirp::ListElementRequest *list =
+      append ? write->mutable_list_append() : write->mutable_list_remove();
+  list->set_key(key);
+  list->set_field(field);
+  // Appending an element twice leaves one copy, the same as
+  // `AddToUserChirpList()`
+  list->set_if_absent(append);
+  return list;
+}
+
+// Adds a condition on `key` to `request`
+void AddCondition(chirp::WriteBatchRequest *request, const std::string &key,
+                  bool exists) {
+  chirp::BatchCondition *condition = request->add_conditions();
+  condition->set_key(key);
+  // Otherwise the key is expected to be empty, which no stored object is,
+  // i.e. missing
+  condition->set_exists(exists);
+}
+}  // Anonymous namespace
+
+void chirp_connect_backend::WriteBatch::SaveUser(
+    const std::string &username, const ServiceDataStructure::User &user) {
+  AddPut(&request_, kTypeUsernameToUserPrefix + username, user.ExportBinary());
+}
+
+void chirp_connect_backend::WriteBatch::SaveUserFollowingList(
+    const std::string &username,
+    const ServiceDataStructure::UserFollowingList &following_list) {
+  AddPut(&request_, kTypeUsernameToFollowingPrefix + username,
+         following_list.ExportBinary());
+}
+
+void chirp_connect_backend::WriteBatch::SaveUserChirpList(
+    const std::string &username,
+    const ServiceDataStructure::UserChirpList &chirp_list) {
+  AddPut(&request_, kTypeUsernameToChirpPrefix + username,
+         chirp_list.ExportBinary());
+}
+
+void chirp_connect_backend::WriteBatch::SaveChirp(
+    const uint64_t &chirp_id, const ServiceDataStructure::Chirp &chirp) {
+  AddPut(&request_, kTypeChirpidToChirpPrefix + Uint64ToBinary(chirp_id),
+         chirp.ExportBinary());
+}
+
+void chirp_connect_backend::WriteBatch::DeleteUser(
+    const std::string &username) {
+  AddDelete(&request_, kTypeUsernameToUserPrefix + username);
+}
+
+void chirp_connect_backend::WriteBatch::DeleteUserFollowingList(
+    const std::string &username) {
+  AddDelete(&request_, kTypeUsernameToFollowingPrefix + username);
+}
+
+void chirp_connect_backend::WriteBatch::DeleteUserChirpList(
+    const std::string &username) {
+  AddDelete(&request_, kTypeUsernameToChirpPrefix + username);
+}
+
+void chirp_connect_backend::WriteBatch::DeleteChirp(const uint64_t &chirp_id) {
+  AddDelete(&request_, kTypeChirpidToChirpPrefix + Uint64ToBinary(chirp_id));
+}
+
+void chirp_connect_backend::WriteBatch::AddToUserChirpList(
+    const std::string &username, const uint64_t &chirp_id) {
+  AddListWrite(&request_, kTypeUsernameToChirpPrefix + username,
+               ServiceData::UserChirpList::kChirpIdFieldNumber, true)
+      ->set_uint64_element(chirp_id);
+}
+
+void chirp_connect_backend::WriteBatch::RemoveFromUserChirpList(
+    const std::string &username, const uint64_t &chirp_id) {
+  AddListWrite(&request_, kTypeUsernameToChirpPrefix + username,
+               ServiceData::UserChirpList::kChirpIdFieldNumber, false)
+      ->set_uint64_element(chirp_id);
+}
+
+void chirp_connect_backend::WriteBatch::AddToUserFollowingList(
+    const std::string &username, const std::string &followee) {
+  AddListWrite(&request_, kTypeUsernameToFollowingPrefix + username,
+               ServiceData::UserFollowingList::kUsernameFieldNumber, true)
+      ->set_string_element(followee);
+}
+
+void chirp_connect_backend::WriteBatch::RemoveFromUserFollowingList(
+    const std::string &username, const std::string &followee) {
+  AddListWrite(&request_, kTypeUsernameToFollowingPrefix + username,
+               ServiceData::UserFollowingList::kUsernameFieldNumber, false)
+      ->set_string_element(followee);
+}
+
+void chirp_connect_backend::WriteBatch::AddChirpChild(
+    const uint64_t &parent_id, const uint64_t &child_id) {
+  AddListWrite(&request_, kTypeChirpidToChirpPrefix + Uint64ToBinary(parent_id),
+               ServiceData::Chirp::kChildrenIdsFieldNumber, true)
+      ->set_uint64_element(child_id);
+}
+
+void chirp_connect_backend::WriteBatch::RemoveChirpChild(
+    const uint64_t &parent_id, const uint64_t &child_id) {
+  AddListWrite(&request_, kTypeChirpidToChirpPrefix + Uint64ToBinary(parent_id),
+               ServiceData::Chirp::kChildrenIdsFieldNumber, false)
+      ->set_uint64_element(child_id);
+}
+
+void chirp_connect_backend::WriteBatch::ExpectUser(
+    const std::string &username) {
+  AddCondition(&request_, kTypeUsernameToUserPrefix + username, true);
+}
+
+void chirp_connect_backend::WriteBatch::ExpectNoUser(
+    const std::string &username) {
+  AddCondition(&request_, kTypeUsernameToUserPrefix + username, false);
+}
+
+void chirp_connect_backend::WriteBatch::ExpectChirp(const uint64_t &chirp_id) {
+  AddCondition(&request_,
+               kTypeChirpidToChirpPrefix + Uint64ToBinary(chirp_id), true);
+}
+
+bool chirp_connect_backend::WriteBatch::Commit(int *const failed_expectation) {
+  if (request_.conditions_size() > 0 &&
+      !chirp_connect_backend::backend_client_->IsOnOneServer(request_)) {
+    return CommitChecked(failed_expectation);
+  }
+
+  bool applied = false;
+  size_t failed_condition = 0;
+  bool ok = chirp_connect_backend::backend_client_->SendWriteBatchRequest(
+      request_, &applied, &failed_condition);
+  if (failed_expectation != nullptr) {
+    *failed_expectation = ok && !applied ? failed_condition : -1;
+  }
+  return ok && applied;
+}
+
+bool chirp_connect_backend::WriteBatch::CommitChecked(
+    int *const failed_expectation) {
+  if (failed_expectation != nullptr) {
+    *failed_expectation = -1;
+  }
+
+  // Every expectation only asks whether its key exists
+  std::vector<std::string> keys;
+  for (const auto &condition : request_.conditions()) {
+    keys.push_back(condition.key());
+  }
+  std::vector<bool> exists;
+  bool ok =
+      chirp_connect_backend::backend_client_->SendExistsRequest(keys, &exists);
+  if (!ok || exists.size() != keys.size()) {
+    return false;
+  }
+  for (size_t i = 0; i < keys.size(); ++i) {
+    if (exists[i] != request_.conditions(i).exists()) {
+      if (failed_expectation != nullptr) {
+        *failed_expectation = i;
+      }
+      return false;
+    }
+  }
+
+  chirp::WriteBatchRequest writes;
+  *writes.mutable_writes() = request_.writes();
+  bool applied = false;
+  ok = chirp_connect_backend::backend_client_->SendWriteBatchRequest(
+      writes, &applied, nullptr);
+  return ok && applied;
+}
+// End of `WriteBatch` definitions
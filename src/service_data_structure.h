@@ -2,8 +2,10 @@
 #define CHIRP_SRC_SERVICE_DATA_STRUCTURE_H_
 
 #include <sys/time.h>
+#include <chrono>
 #include <climits>
 #include <cstdint>
+#include <functional>
 #include <map>
 #include <memory>
 #include <set>
@@ -140,6 +142,12 @@ class ServiceDataStructure {
   // This means it can only be created by `ServiceDataStructure`
   class UserSession {
    public:
+    // A post takes its time before its writes are visible, so a chirp can
+    // show up after a monitor has read past its time. The next call that
+    // continues a monitor reads again from this far before where the last
+    // one stopped, and skips the chirps it has already returned.
+    static const uint64_t kMonitorLookbackMs = 2000;
+
     // Follow a specified user
     // returns OK if this operation succeeds
     // returns other return codes otherwise
@@ -172,8 +180,21 @@ class ServiceDataStructure {
     // Monitor from a specified time to now
     // returns a set containing chirp ids
     // the `struct timeval` passing in will be changed to the current time
+    // A call given the time the previous call set looks back
+    // `kMonitorLookbackMs` before it, never before where the monitor began.
     std::set<uint64_t> MonitorFrom(struct timeval *const from);
 
+    // Monitor from a specified time on, calling `on_chirps` with what
+    // `MonitorFrom()` returns whenever the backend reports that a followed
+    // user, their chirp list or the following list changed, and with no
+    // chirps about once a `tick` otherwise, until `on_chirps` returns false
+    // returns true if `on_chirps` ends the monitor
+    // returns false if the backend cannot watch keys, in which case it
+    // should be polled with `MonitorFrom()` from `*from` on
+    bool WatchFrom(
+        struct timeval *const from, std::chrono::milliseconds tick,
+        const std::function<bool(const std::set<uint64_t> &)> &on_chirps);
+
     // This returns the username
     inline const std::string &SessionGetUsername() {
       return this->user_.get_username();
@@ -196,6 +217,15 @@ class ServiceDataStructure {
 
     // The `User` that logs in in this session
     User user_;
+
+    // The time the last `MonitorFrom()` set, and where a call continuing
+    // from it starts reading
+    bool monitoring_;
+    struct timeval monitored_until_;
+    struct timeval monitor_next_start_;
+    // The chirps `MonitorFrom()` returned that a continuing call may read
+    // again, and their times
+    std::map<uint64_t, struct timeval> monitored_chirps_;
   };
 
   // User register operation
@@ -209,9 +239,11 @@ class ServiceDataStructure {
   std::unique_ptr<UserSession> UserLogin(const std::string &username);
 
   // Chirp read operation
+  // The chirp is read at `snapshot` of the backend unless it is 0.
   // returns OK if this operation succeeds
   // returns other return codes otherwise
-  ReturnCodes ReadChirp(const uint64_t &id, Chirp *const chirp);
+  ReturnCodes ReadChirp(const uint64_t &id, Chirp *const chirp,
+                        const uint64_t &snapshot = 0);
 };
 
 namespace chirp_connect_backend {
@@ -221,9 +253,51 @@ extern std::unique_ptr<BackendClient> backend_client_;
 // Wrapper function to get `next_chirp_id`
 uint64_t GetNextChirpId();
 
+// The lease of the snapshots `CreateSnapshot()` opens, in milliseconds
+const uint64_t kDefaultSnapshotLeaseMs = 5000;
+
+// The lease `CreateSnapshot()` asks for
+// A snapshot is read for one pass over a few lists, so a short lease bounds
+// how long the backend keeps old versions for a reader that went away.
+extern uint64_t snapshot_lease_ms_;
+
+// Wrapper function to open a snapshot of the backend
+// Gets given the snapshot read every key as it was when the snapshot was
+// opened. The snapshot should be released with `ReleaseSnapshot()`, or it is
+// released by the backend once `snapshot_lease_ms_` runs out.
+// returns the handle of the snapshot
+// returns 0 if it cannot be opened, which the gets take as the latest values
+uint64_t CreateSnapshot();
+
+// Wrapper function to release a snapshot of the backend
+// A `snapshot` of 0 is ignored.
+void ReleaseSnapshot(const uint64_t &snapshot);
+
+// Wrapper function to watch the user objects and chirp lists of `usernames`
+// and the following list of `follower`
+// `on_change` is called once they are watched, then whenever any of them is
+// written, and about once a `tick` otherwise. `changed` tells whether
+// anything may have changed since the last call, and `following_changed`
+// whether the following list did. The watch ends once `on_change` returns
+// false.
+// returns true if `on_change` ends the watch
+// returns false if the backend cannot watch keys
+bool WatchUsers(const std::string &follower,
+                const ServiceDataStructure::UserFollowingList &usernames,
+                std::chrono::milliseconds tick,
+                const std::function<bool(bool changed, bool following_changed)>
+                    &on_change);
+
 // Wrapper function to get a specified user object
+// The user is read at `snapshot` unless it is 0, and so are the lists and
+// chirps of the getters below.
 bool GetUser(const std::string &username,
-             ServiceDataStructure::User *const user);
+             ServiceDataStructure::User *const user,
+             const uint64_t &snapshot = 0);
+
+// Wrapper function to check whether a specified user exists
+// This sends no user object back, so it is cheaper than `GetUser()`.
+bool UserExists(const std::string &username);
 
 // Wrapper function to save a specified user object
 bool SaveUser(const std::string &username,
@@ -235,7 +309,8 @@ bool DeleteUser(const std::string &username);
 // Wrapper function to get the following list of a specified user
 bool GetUserFollowingList(
     const std::string &username,
-    ServiceDataStructure::UserFollowingList *const following_list);
+    ServiceDataStructure::UserFollowingList *const following_list,
+    const uint64_t &snapshot = 0);
 
 // Wrapper function to save the following list of a specified user
 bool SaveUserFollowingList(
@@ -247,7 +322,8 @@ bool DeleteUserFollowingList(const std::string &username);
 
 // Wrapper function to get the chirp list of a specified user
 bool GetUserChirpList(const std::string &username,
-                      ServiceDataStructure::UserChirpList *const chirp_list);
+                      ServiceDataStructure::UserChirpList *const chirp_list,
+                      const uint64_t &snapshot = 0);
 
 // Wrapper function to save the chirp list of a specified user
 bool SaveUserChirpList(const std::string &username,
@@ -258,7 +334,8 @@ bool DeleteUserChirpList(const std::string &username);
 
 // Wrapper function to get a chirp
 bool GetChirp(const uint64_t &chirp_id,
-              ServiceDataStructure::Chirp *const chirp);
+              ServiceDataStructure::Chirp *const chirp,
+              const uint64_t &snapshot = 0);
 
 // Wrapper function to save a chirp
 bool SaveChirp(const uint64_t &chirp_id,
@@ -266,6 +343,126 @@ bool SaveChirp(const uint64_t &chirp_id,
 
 // Wrapper function to delete a chirp
 bool DeleteChirp(const uint64_t &chirp_id);
+
+// Wrapper function to add a chirp id to the chirp list of a specified user
+// Only the id is sent; the list is modified on the backend.
+bool AddToUserChirpList(const std::string &username, const uint64_t &chirp_id);
+
+// Wrapper function to remove a chirp id from the chirp list of a specified
+// user
+bool RemoveFromUserChirpList(const std::string &username,
+                             const uint64_t &chirp_id);
+
+// Wrapper function to add a followee to the following list of a specified
+// user
+bool AddToUserFollowingList(const std::string &username,
+                            const std::string &followee);
+
+// Wrapper function to remove a followee from the following list of a
+// specified user
+// `removed` tells whether the followee was in the list.
+bool RemoveFromUserFollowingList(const std::string &username,
+                                 const std::string &followee,
+                                 bool *const removed);
+
+// Wrapper function to add a child id to a chirp
+// A deleted parent is not brought back; the request fails instead.
+bool AddChirpChild(const uint64_t &parent_id, const uint64_t &child_id);
+
+// Wrapper function to remove a child id from a chirp
+bool RemoveChirpChild(const uint64_t &parent_id, const uint64_t &child_id);
+
+// Writes to several keys that are applied by the backend together
+// Everything added is sent as one write batch request, so the writes become
+// visible all at once, and only if every expectation added holds when they
+// are applied. Writes to the same key are applied in the order they are
+// added.
+// If the backend spreads the keys of a batch over several servers, an
+// expectation on one server cannot hold back the writes on another. The
+// expectations are then checked just before the writes are sent, which
+// misses whatever changes in between, and each server applies its own
+// writes.
+class WriteBatch {
+ public:
+  // Adds a save of a specified user object
+  void SaveUser(const std::string &username,
+                const ServiceDataStructure::User &user);
+
+  // Adds a save of the following list of a specified user
+  void SaveUserFollowingList(
+      const std::string &username,
+      const ServiceDataStructure::UserFollowingList &following_list);
+
+  // Adds a save of the chirp list of a specified user
+  void SaveUserChirpList(const std::string &username,
+                         const ServiceDataStructure::UserChirpList &chirp_list);
+
+  // Adds a save of a chirp
+  void SaveChirp(const uint64_t &chirp_id,
+                 const ServiceDataStructure::Chirp &chirp);
+
+  // Adds a delete of a specified user object
+  void DeleteUser(const std::string &username);
+
+  // Adds a delete of the following list of a specified user
+  void DeleteUserFollowingList(const std::string &username);
+
+  // Adds a delete of the chirp list of a specified user
+  void DeleteUserChirpList(const std::string &username);
+
+  // Adds a delete of a chirp
+  void DeleteChirp(const uint64_t &chirp_id);
+
+  // Adds a chirp id to the chirp list of a specified user
+  // Only the id is sent; the list is modified on the backend.
+  void AddToUserChirpList(const std::string &username,
+                          const uint64_t &chirp_id);
+
+  // Adds a removal of a chirp id from the chirp list of a specified user
+  void RemoveFromUserChirpList(const std::string &username,
+                               const uint64_t &chirp_id);
+
+  // Adds a followee to the following list of a specified user
+  void AddToUserFollowingList(const std::string &username,
+                              const std::string &followee);
+
+  // Adds a removal of a followee from the following list of a specified
+  // user
+  void RemoveFromUserFollowingList(const std::string &username,
+                                   const std::string &followee);
+
+  // Adds a child id to a chirp
+  // The batch should also expect the parent, or a deleted parent comes back
+  // as a chirp with only children.
+  void AddChirpChild(const uint64_t &parent_id, const uint64_t &child_id);
+
+  // Adds a removal of a child id from a chirp
+  void RemoveChirpChild(const uint64_t &parent_id, const uint64_t &child_id);
+
+  // Expects a specified user to exist
+  void ExpectUser(const std::string &username);
+
+  // Expects a specified user not to exist
+  void ExpectNoUser(const std::string &username);
+
+  // Expects a chirp to exist
+  void ExpectChirp(const uint64_t &chirp_id);
+
+  // Sends everything added so far as one write batch
+  // If an expectation does not hold, its index in the order they are added
+  // is stored in `failed_expectation`, or -1 otherwise, unless it is
+  // nullptr.
+  // returns true if the writes are applied
+  // returns false otherwise
+  bool Commit(int *const failed_expectation = nullptr);
+
+ private:
+  // Same as `Commit`, but checks the expectations with an exists request and
+  // then sends the writes without them
+  bool CommitChecked(int *const failed_expectation);
+
+  chirp::WriteBatchRequest request_;
+};
 } /* namespace chirp_connect_backend */
 
 inline const ServiceDataStructure::UserFollowingList
@@ -288,8 +485,9 @@ ServiceDataStructure::UserSession::SessionGetUserChirpList() {
 }
 
 inline ServiceDataStructure::ReturnCodes ServiceDataStructure::ReadChirp(
-    const uint64_t &id, ServiceDataStructure::Chirp *const chirp) {
-  bool ok = chirp_connect_backend::GetChirp(id, chirp);
+    const uint64_t &id, ServiceDataStructure::Chirp *const chirp,
+    const uint64_t &snapshot) {
+  bool ok = chirp_connect_backend::GetChirp(id, chirp, snapshot);
   if (!ok) {
     return ServiceDataStructure::CHIRP_ID_NOT_FOUND;
   }
@@ -9,8 +9,14 @@
 #include <thread>
 #include <vector>
 
+#include <gflags/gflags.h>
+
 #include "utility.h"
 
+DEFINE_uint64(snapshot_lease_ms, chirp_connect_backend::kDefaultSnapshotLeaseMs,
+              "How long a snapshot the service opens on the backend is kept "
+              "if the service does not release it, in milliseconds.");
+
 ServiceImpl::ServiceImpl() : service_data_structure_() {}
 
 grpc::Status ServiceImpl::registeruser(grpc::ServerContext *context,
@@ -90,8 +96,13 @@ grpc::Status ServiceImpl::read(grpc::ServerContext *context,
         "`ServerContext`, `RegisterRequest`, or `reply` is nullptr.");
   }
 
+  // The whole thread is read at one snapshot, so a reply posted or deleted
+  // meanwhile is either seen with its parent's link to it or not at all
+  uint64_t snapshot = chirp_connect_backend::CreateSnapshot();
   // ServiceDataStructure::ReturnCodes
-  auto ret = DfsScanChirps(reply, BinaryToUint64(request->chirp_id()));
+  auto ret =
+      DfsScanChirps(reply, BinaryToUint64(request->chirp_id()), snapshot);
+  chirp_connect_backend::ReleaseSnapshot(snapshot);
   return ReturnCodesToGrpcStatus(ret);
 }
 
@@ -106,6 +117,9 @@ grpc::Status ServiceImpl::monitor(
 
   const int mseconds_per_wait = 50;
   const int times_count = INT_MAX;
+  // How often a monitor that is told about nothing checks whether its
+  // client is gone
+  const std::chrono::milliseconds mseconds_per_check(1000);
 
   struct timeval start_time;
   gettimeofday(&start_time, nullptr);
@@ -115,11 +129,44 @@ grpc::Status ServiceImpl::monitor(
     return grpc::Status(grpc::NOT_FOUND, "Failed to login.");
   }
 
+  // returns false once the stream is off
+  auto send_chirps = [&](const std::set<uint64_t> &chirps_collector) {
+    if (context->IsCancelled()) {
+      return false;
+    }
+    for (const auto &chirp_id : chirps_collector) {
+      ServiceDataStructure::Chirp internal_chirp;
+      // ServiceDataStructure::ReturnCodes
+      auto ret = service_data_structure_.ReadChirp(chirp_id, &internal_chirp);
+      // ignore errors here
+      if (ret != ServiceDataStructure::OK) {
+        continue;
+      }
+
+      chirp::MonitorReply reply;
+      chirp::Chirp *grpc_chirp = new chirp::Chirp();
+      InternalChirpToGrpcChirp(internal_chirp, grpc_chirp);
+      reply.set_allocated_chirp(grpc_chirp);
+
+      if (!writer->Write(reply)) {
+        return false;
+      }
+    }
+    return true;
+  };
+
+  // The backend tells the session when the users it follows change, so the
+  // chirps are sent without polling
+  if (user_session->WatchFrom(&start_time, mseconds_per_check, send_chirps)) {
+    return grpc::Status::OK;
+  }
+
+  // The backend cannot watch keys, so it is polled
   // This indicates that the stream is still on
   int cnt = 0;
   bool flag = true;
 
-  while (flag && cnt < times_count) {
+  while (flag && cnt < times_count && !context->IsCancelled()) {
     // sleep a while to avoid busy polling
     std::this_thread::sleep_for(std::chrono::milliseconds(mseconds_per_wait));
 
@@ -127,28 +174,8 @@ grpc::Status ServiceImpl::monitor(
     std::set<uint64_t> chirps_collector =
         user_session->MonitorFrom(&start_time);
 
-    // May use a thread to do the following things
     if (chirps_collector.size() > 0) {
-      for (const auto &chirp_id : chirps_collector) {
-        ServiceDataStructure::Chirp internal_chirp;
-        // ServiceDataStructure::ReturnCodes
-        auto ret = service_data_structure_.ReadChirp(chirp_id, &internal_chirp);
-        // ignore errors here
-        if (ret != ServiceDataStructure::OK) {
-          continue;
-        }
-
-        chirp::MonitorReply reply;
-        chirp::Chirp *grpc_chirp = new chirp::Chirp();
-        InternalChirpToGrpcChirp(internal_chirp, grpc_chirp);
-        reply.set_allocated_chirp(grpc_chirp);
-
-        if (!writer->Write(reply)) {
-          flag = false;
-          break;
-        }
-      }
-
+      flag = send_chirps(chirps_collector);
       cnt = 0;
     } else {
       ++cnt;
@@ -177,10 +204,12 @@ void ServiceImpl::InternalChirpToGrpcChirp(
 }
 
 ServiceDataStructure::ReturnCodes ServiceImpl::DfsScanChirps(
-    chirp::ReadReply *const reply, const uint64_t &chirp_id) {
+    chirp::ReadReply *const reply, const uint64_t &chirp_id,
+    const uint64_t &snapshot) {
   ServiceDataStructure::Chirp internal_chirp;
   // ServiceDataStructure::ReturnCodes
-  auto ret = service_data_structure_.ReadChirp(chirp_id, &internal_chirp);
+  auto ret =
+      service_data_structure_.ReadChirp(chirp_id, &internal_chirp, snapshot);
   if (ret != ServiceDataStructure::OK) {
     return ServiceDataStructure::CHIRP_ID_NOT_FOUND;
   }
@@ -190,7 +219,7 @@ ServiceDataStructure::ReturnCodes ServiceImpl::DfsScanChirps(
 
   for (const auto &id : internal_chirp.get_children_ids()) {
     // ServiceDataStructure::ReturnCodes
-    auto ret = DfsScanChirps(reply, id);
+    auto ret = DfsScanChirps(reply, id, snapshot);
     if (ret != ServiceDataStructure::OK) {
       return ret;
     }
@@ -237,6 +266,8 @@ void run_server() {
 }
 
 int main(int argc, char **argv) {
+  gflags::ParseCommandLineFlags(&argc, &argv, true);
+  chirp_connect_backend::snapshot_lease_ms_ = FLAGS_snapshot_lease_ms;
   run_server();
 
   return 0;
@@ -61,8 +61,10 @@ class ServiceImpl final : public chirp::ServiceLayer::Service {
 
   // This is a helper function that helps traverse all children chirps within a
   // chirp in a DFS manner.
+  // Every chirp is read at `snapshot` of the backend unless it is 0.
   ServiceDataStructure::ReturnCodes DfsScanChirps(chirp::ReadReply *const reply,
-                                                  const uint64_t &chirp_id);
+                                                  const uint64_t &chirp_id,
+                                                  const uint64_t &snapshot);
 
   // This is a helper function that helps translate `ReturnCodes` to
   // `grpc::Status`
@@ -0,0 +1,90 @@
+#ifndef CHIRP_SRC_SPSC_QUEUE_H_
+#define CHIRP_SRC_SPSC_QUEUE_H_
+
+#include <atomic>
+#include <cstddef>
+#include <vector>
+
+// A bounded lock-free queue with a single producer and a single consumer
+// The producer only writes `tail_` and the consumer only writes `head_`, each
+// on its own cache line. Both keep a copy of the other's index and only read
+// the shared one when the copy says the queue is full or empty, so a queue
+// that is neither costs no cache-line transfer per item beyond the item
+// itself.
+// `Push()` may only be called by one thread at a time, and so may `Pop()`.
+template <typename T>
+class SpscQueue {
+ public:
+  // Constructor that takes the number of items the queue holds, rounded up
+  // to a power of 2
+  explicit SpscQueue(size_t capacity)
+      : items_(), mask_(0), head_(0), cached_tail_(0), tail_(0),
+        cached_head_(0) {
+    size_t size = 1;
+    while (size < capacity) {
+      size *= 2;
+    }
+    items_.resize(size);
+    mask_ = size - 1;
+  }
+
+  SpscQueue(const SpscQueue &) = delete;
+  SpscQueue &operator=(const SpscQueue &) = delete;
+
+  // Adds `item` at the tail
+  // returns true if this operation succeeds
+  // returns false if the queue is full
+  bool Push(const T &item) {
+    size_t tail = tail_.load(std::memory_order_relaxed);
+    if (tail - cached_head_ == items_.size()) {
+      cached_head_ = head_.load(std::memory_order_acquire);
+      if (tail - cached_head_ == items_.size()) {
+        return false;
+      }
+    }
+    items_[tail & mask_] = item;
+    tail_.store(tail + 1, std::memory_order_release);
+    return true;
+  }
+
+  // Moves the item at the head to `item`
+  // returns true if this operation succeeds
+  // returns false if the queue is empty
+  bool Pop(T *item) {
+    size_t head = head_.load(std::memory_order_relaxed);
+    if (head == cached_tail_) {
+      cached_tail_ = tail_.load(std::memory_order_acquire);
+      if (head == cached_tail_) {
+        return false;
+      }
+    }
+    *item = items_[head & mask_];
+    head_.store(head + 1, std::memory_order_release);
+    return true;
+  }
+
+  // returns true if there is no item
+  // This can be called from any thread, but the answer may be stale unless
+  // both sides have stopped.
+  bool Empty() const {
+    return head_.load(std::memory_order_acquire) ==
+           tail_.load(std::memory_order_acquire);
+  }
+
+ private:
+  std::vector<T> items_;
+  size_t mask_;
+  char padding0_[64];
+
+  // Written by the consumer
+  std::atomic<size_t> head_;
+  size_t cached_tail_;
+  char padding1_[64];
+
+  // Written by the producer
+  std::atomic<size_t> tail_;
+  size_t cached_head_;
+  char padding2_[64];
+};
+
+#endif /* CHIRP_SRC_SPSC_QUEUE_H_ */
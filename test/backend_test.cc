@@ -1,15 +1,144 @@
 
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <future>
 #include <iostream>
+#include <limits>
+#include <map>
+#include <memory>
 #include <string>
+#include <thread>
+#include <vector>
 
+#include <dirent.h>
+#include <malloc.h>
+#include <signal.h>
+#include <sys/resource.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <grpcpp/create_channel.h>
+#include <grpcpp/security/credentials.h>
+#include <grpcpp/security/server_credentials.h>
+#include <grpcpp/server.h>
+#include <grpcpp/server_builder.h>
+#include <grpcpp/support/byte_buffer.h>
 #include "gtest/gtest.h"
 
+#include "backend_async_server.h"
+#include "backend_change_log.h"
 #include "backend_client_lib.h"
+#include "backend_latency_histogram.h"
+#include "backend_list_value.h"
+#include "backend_lsm_storage.h"
+#include "backend_read_index.h"
+#include "backend_replication_log.h"
 #include "backend_server.h"
+#include "backend_snapshot.h"
+#include "backend_value_buffer.h"
+#include "backend_watch_table.h"
+#include "consistent_hash_ring.h"
+#include "hash.h"
+#include "spsc_queue.h"
 
 namespace {
 
 const int kNumOfPairs = 20;
+const int kNumOfThreads = 8;
+const int kNumOfPairsPerThread = 1000;
+// The backend server started inside the test process listens on this port so
+// that it does not collide with a standalone `backend_server`
+const char* kInProcessHost = "localhost";
+const char* kInProcessPort = "50100";
+const char* kInProcessAsyncPort = "50101";
+const char* kInProcessSharedNothingPort = "50102";
+const char* kPrimaryPort = "50103";
+const char* kBackupPorts[] = {"50104", "50105"};
+const char* kShardPorts[] = {"50106", "50107", "50108"};
+// How long a request may take before it is considered to be blocked
+const std::chrono::seconds kBlockedTimeout(5);
+// The write-ahead log used by the tests
+const char* kWriteAheadLogPath = "/tmp/chirp_backend_test.wal";
+const char* kOldWriteAheadLogPath = "/tmp/chirp_backend_test.wal.old";
+const char* kSnapshotPath = "/tmp/chirp_backend_test.snapshot";
+const char* kLsmDirectory = "/tmp/chirp_backend_test_lsm";
+const char* kPrimaryWriteAheadLogPath = "/tmp/chirp_backend_test_primary.wal";
+const size_t kNumOfRecoveryThreads = 4;
+
+// Removes `directory` and the files in it
+void RemoveDirectory(const std::string& directory) {
+  DIR* dir = opendir(directory.c_str());
+  if (dir == nullptr) {
+    return;
+  }
+  while (struct dirent* entry = readdir(dir)) {
+    std::remove((directory + "/" + entry->d_name).c_str());
+  }
+  closedir(dir);
+  rmdir(directory.c_str());
+}
+
+// returns true if `data` points into one of the slices of `buffer`, which
+// means the bytes there are sent, or were received, where they are
+bool PointsInto(const grpc::ByteBuffer& buffer, const char* data) {
+  std::vector<grpc::Slice> slices;
+  EXPECT_TRUE(buffer.Dump(&slices).ok());
+  for (const grpc::Slice& slice : slices) {
+    const char* begin = reinterpret_cast<const char*>(slice.begin());
+    if (data >= begin && data < begin + slice.size()) {
+      return true;
+    }
+  }
+  return false;
+}
+
+// Sends many batches of two keys on each of several get streams at once,
+// through the server on `port`, and checks every reply
+// A reply that only leaves the server once something else flushes the stream
+// stalls its batch, so every stream has to be done within `kBlockedTimeout`.
+void GetOnConcurrentStreams(const char* port) {
+  const int kNumOfStreams = 4;
+  const int kNumOfBatches = 50;
+  BackendClientStandard client(kInProcessHost, port);
+  ASSERT_TRUE(client.SendPutRequest("first", "1"));
+  ASSERT_TRUE(client.SendPutRequest("second", "2"));
+
+  // Every stream has its own connection, so no other stream flushes it
+  std::vector<std::future<bool>> streams;
+  for (int i = 0; i < kNumOfStreams; ++i) {
+    streams.push_back(std::async(std::launch::async, [port]() {
+      grpc::ChannelArguments arguments;
+      arguments.SetInt(GRPC_ARG_USE_LOCAL_SUBCHANNEL_POOL, 1);
+      auto stub = chirp::KeyValueStore::NewStub(grpc::CreateCustomChannel(
+          std::string(kInProcessHost) + ":" + port,
+          grpc::InsecureChannelCredentials(), arguments));
+      // A stalled stream fails instead of blocking the test
+      grpc::ClientContext context;
+      context.set_deadline(std::chrono::system_clock::now() + kBlockedTimeout);
+      auto stream = stub->get(&context);
+      chirp::GetRequest request;
+      request.add_keys("first");
+      request.add_keys("second");
+      chirp::GetReply first_reply;
+      chirp::GetReply second_reply;
+      bool ok = true;
+      for (int j = 0; ok && j < kNumOfBatches; ++j) {
+        ok = stream->Write(request) && stream->Read(&first_reply) &&
+             stream->Read(&second_reply) && first_reply.value() == "1" &&
+             second_reply.value() == "2";
+      }
+      stream->WritesDone();
+      return stream->Finish().ok() && ok;
+    }));
+  }
+
+  for (std::future<bool>& stream : streams) {
+    EXPECT_TRUE(stream.get());
+  }
+}
 
 // Setup the same data for multiple tests
 // This setup generates 20 keys and its corresponding correct values
@@ -116,6 +245,3679 @@ TEST_F(BackendTest, DataStructurPutGetAndDelete) {
   }
 }
 
+// The following test is on the backend data structure with different numbers
+// of shards. Every number of shards should behave the same.
+TEST_F(BackendTest, DataStructureNumOfShards) {
+  for (size_t num_of_shards : {size_t(0), size_t(1), size_t(3), size_t(64)}) {
+    BackendDataStructure sharded(num_of_shards);
+    // 0 shard falls back to 1 shard
+    EXPECT_LT(0, sharded.get_num_of_shards());
+
+    for (int i = 0; i < kNumOfPairs; ++i) {
+      EXPECT_TRUE(sharded.Put(keys[i], correct_values_full[i]));
+    }
+    for (const std::string& key : keys_to_be_deleted) {
+      EXPECT_TRUE(sharded.DeleteKey(key));
+    }
+    for (int i = 0; i < kNumOfPairs; ++i) {
+      std::string from_data_structure;
+      bool ok = sharded.Get(keys[i], &from_data_structure);
+      EXPECT_EQ(i % 2 == 0, ok);
+      EXPECT_EQ(correct_values_after_delete[i], from_data_structure);
+    }
+  }
+}
+
+// The following test runs put, get and delete operations from multiple
+// threads at the same time without any outer lock. Each thread owns its keys,
+// so every thread should see exactly its own writes.
+TEST_F(BackendTest, DataStructureConcurrentOperations) {
+  std::vector<std::thread> threads;
+  std::vector<int> num_of_errors(kNumOfThreads, 0);
+
+  for (int t = 0; t < kNumOfThreads; ++t) {
+    threads.emplace_back([this, t, &num_of_errors]() {
+      for (int i = 0; i < kNumOfPairsPerThread; ++i) {
+        std::string key = std::to_string(t) + "-" + std::to_string(i);
+        std::string value;
+        if (!backend_data_structure.Put(key, key) ||
+            !backend_data_structure.Get(key, &value) || value != key) {
+          ++num_of_errors[t];
+        }
+        // Delete every other key
+        if (i % 2 == 1 && !backend_data_structure.DeleteKey(key)) {
+          ++num_of_errors[t];
+        }
+      }
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+
+  for (int t = 0; t < kNumOfThreads; ++t) {
+    EXPECT_EQ(0, num_of_errors[t]);
+    for (int i = 0; i < kNumOfPairsPerThread; ++i) {
+      std::string key = std::to_string(t) + "-" + std::to_string(i);
+      EXPECT_EQ(i % 2 == 0, backend_data_structure.Get(key, nullptr));
+    }
+  }
+}
+
+// The following test is on the multi-key get of the backend data structure.
+// Values should come back in the order of the keys, with empty strings for
+// keys that are not found.
+TEST_F(BackendTest, DataStructureMultiGet) {
+  for (int i = 0; i < kNumOfPairs; ++i) {
+    EXPECT_TRUE(backend_data_structure.Put(keys[i], correct_values_full[i]));
+  }
+
+  std::vector<std::string> output_values;
+  EXPECT_TRUE(backend_data_structure.MultiGet(keys, &output_values));
+  EXPECT_EQ(correct_values_full, output_values);
+
+  for (const std::string& key : keys_to_be_deleted) {
+    EXPECT_TRUE(backend_data_structure.DeleteKey(key));
+  }
+
+  output_values.clear();
+  // Some keys are missing now
+  EXPECT_FALSE(backend_data_structure.MultiGet(keys, &output_values));
+  EXPECT_EQ(correct_values_after_delete, output_values);
+}
+
+// The following test puts and deletes the keys in batches. A key given twice
+// in one batch gets its last value, and missing keys are skipped by deletes.
+TEST_F(BackendTest, DataStructureMultiPutAndMultiDelete) {
+  std::vector<std::string> batch_keys(keys);
+  std::vector<std::string> batch_values(kNumOfPairs, std::string("stale"));
+  batch_keys.insert(batch_keys.end(), keys.begin(), keys.end());
+  batch_values.insert(batch_values.end(), correct_values_full.begin(),
+                      correct_values_full.end());
+  EXPECT_TRUE(backend_data_structure.MultiPut(batch_keys, batch_values));
+  // Mismatched sizes are rejected
+  EXPECT_FALSE(backend_data_structure.MultiPut(keys, batch_values));
+
+  std::vector<std::string> output_values;
+  EXPECT_TRUE(backend_data_structure.MultiGet(keys, &output_values));
+  EXPECT_EQ(correct_values_full, output_values);
+
+  std::vector<std::string> delete_keys(keys_to_be_deleted);
+  delete_keys.push_back("missing");
+  size_t num_of_deleted = 0;
+  EXPECT_TRUE(backend_data_structure.MultiDelete(delete_keys, &num_of_deleted));
+  EXPECT_EQ(keys_to_be_deleted.size(), num_of_deleted);
+
+  output_values.clear();
+  EXPECT_FALSE(backend_data_structure.MultiGet(keys, &output_values));
+  EXPECT_EQ(correct_values_after_delete, output_values);
+}
+
+// The following test takes ids from one counter on several threads at once.
+// Every id should be handed out exactly once.
+TEST_F(BackendTest, DataStructureConcurrentFetchAdd) {
+  const std::string counter_key("counter");
+  std::vector<std::vector<uint64_t>> taken(kNumOfThreads);
+  std::vector<std::thread> threads;
+  for (int t = 0; t < kNumOfThreads; ++t) {
+    threads.emplace_back([this, t, &counter_key, &taken]() {
+      for (int i = 0; i < kNumOfPairsPerThread; ++i) {
+        uint64_t previous;
+        EXPECT_TRUE(backend_data_structure.FetchAdd(counter_key, 1, &previous));
+        taken[t].push_back(previous);
+      }
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+
+  std::vector<uint64_t> all_taken;
+  for (const auto& ids : taken) {
+    all_taken.insert(all_taken.end(), ids.begin(), ids.end());
+  }
+  std::sort(all_taken.begin(), all_taken.end());
+  for (size_t i = 0; i < all_taken.size(); ++i) {
+    EXPECT_EQ(i, all_taken[i]);
+  }
+
+  // Values that are not 8 bytes long are not counters
+  uint64_t previous;
+  EXPECT_TRUE(backend_data_structure.Put(keys[1], "not a counter"));
+  EXPECT_FALSE(backend_data_structure.FetchAdd(keys[1], 1, &previous));
+}
+
+// The following test swaps a value only when it matches the expected one.
+// A missing key matches an empty value.
+TEST_F(BackendTest, DataStructureCompareAndSwap) {
+  bool swapped;
+  std::string actual;
+  EXPECT_TRUE(backend_data_structure.CompareAndSwap(
+      keys[1], "", correct_values_full[0], &swapped, &actual));
+  EXPECT_TRUE(swapped);
+
+  EXPECT_TRUE(backend_data_structure.CompareAndSwap(
+      keys[1], "", correct_values_full[1], &swapped, &actual));
+  EXPECT_FALSE(swapped);
+  EXPECT_EQ(correct_values_full[0], actual);
+
+  EXPECT_TRUE(backend_data_structure.CompareAndSwap(
+      keys[1], correct_values_full[0], correct_values_full[1], &swapped,
+      &actual));
+  EXPECT_TRUE(swapped);
+
+  std::string value;
+  EXPECT_TRUE(backend_data_structure.Get(keys[1], &value));
+  EXPECT_EQ(correct_values_full[1], value);
+}
+
+// The following test applies write batches to keys of several shards. A
+// batch whose condition does not hold, or whose update is invalid, writes
+// nothing. A snapshot sees all the writes of a batch or none of them.
+TEST_F(BackendTest, DataStructureApplyBatch) {
+  typedef BackendDataStructure::BatchWrite BatchWrite;
+  BackendDataStructure data(4);
+  EXPECT_TRUE(data.MultiPut(keys, correct_values_full));
+  BackendDataStructure::Updater append = [](std::string* value) {
+    value->append("+");
+    return BackendDataStructure::CHANGED;
+  };
+  BackendDataStructure::Updater invalid = [](std::string* value) {
+    return BackendDataStructure::INVALID;
+  };
+  std::vector<BatchWrite> writes = {
+      BatchWrite{BatchWrite::PUT, keys[0], "new", nullptr},
+      BatchWrite{BatchWrite::DELETE, keys[1], "", nullptr},
+      BatchWrite{BatchWrite::UPDATE, keys[2], "", append},
+      BatchWrite{BatchWrite::UPDATE, keys[0], "", append},
+      BatchWrite{BatchWrite::UPDATE, "added", "", append}};
+
+  bool applied;
+  size_t failed_condition = 0;
+  std::string actual;
+  EXPECT_TRUE(data.ApplyBatch(
+      {{keys[3], correct_values_full[3], false}, {keys[4], "", false}},
+      writes, &applied, &failed_condition, &actual));
+  EXPECT_FALSE(applied);
+  EXPECT_EQ(1, failed_condition);
+  EXPECT_EQ(correct_values_full[4], actual);
+
+  std::vector<BatchWrite> invalid_writes(writes);
+  invalid_writes.push_back(BatchWrite{BatchWrite::UPDATE, keys[5], "", invalid});
+  EXPECT_FALSE(data.ApplyBatch({}, invalid_writes, &applied, nullptr, nullptr));
+  EXPECT_FALSE(applied);
+  std::vector<std::string> output_values;
+  data.MultiGet(keys, &output_values);
+  EXPECT_EQ(correct_values_full, output_values);
+
+  uint64_t snapshot = data.CreateSnapshot();
+  EXPECT_TRUE(data.ApplyBatch(
+      {{keys[3], correct_values_full[3], false}, {keys[4], "", true}}, writes,
+      &applied, nullptr, nullptr));
+  EXPECT_TRUE(applied);
+  uint64_t later_snapshot = data.CreateSnapshot();
+
+  std::vector<std::string> probes = {keys[0], keys[1], keys[2], "added"};
+  std::vector<std::string> expected = {"new+", "",
+                                       correct_values_full[2] + "+", "+"};
+  output_values.clear();
+  data.MultiGet(probes, &output_values);
+  EXPECT_EQ(expected, output_values);
+  output_values.clear();
+  EXPECT_TRUE(data.MultiGetAtSnapshot(later_snapshot, probes, &output_values));
+  EXPECT_EQ(expected, output_values);
+  output_values.clear();
+  EXPECT_TRUE(data.MultiGetAtSnapshot(snapshot, probes, &output_values));
+  EXPECT_EQ(std::vector<std::string>({correct_values_full[0],
+                                      correct_values_full[1],
+                                      correct_values_full[2], ""}),
+            output_values);
+}
+
+// The following test collects the keys of ranges in ascending order
+TEST_F(BackendTest, DataStructureScanKeys) {
+  std::vector<std::string> sorted_keys;
+  for (int i = 0; i < kNumOfPairsPerThread; ++i) {
+    sorted_keys.push_back(std::to_string(i));
+    EXPECT_TRUE(backend_data_structure.Put(sorted_keys.back(), "value"));
+  }
+  std::sort(sorted_keys.begin(), sorted_keys.end());
+
+  std::vector<std::string> output_keys;
+  backend_data_structure.ScanKeys("", "", 0, &output_keys);
+  EXPECT_EQ(sorted_keys, output_keys);
+
+  // The keys starting with "5", at most 20 of them
+  output_keys.clear();
+  backend_data_structure.ScanKeys("5", "6", 20, &output_keys);
+  auto begin = std::lower_bound(sorted_keys.begin(), sorted_keys.end(), "5");
+  EXPECT_EQ(std::vector<std::string>(begin, begin + 20), output_keys);
+}
+
+// The following test edits the string list of a `GetRequest` in its
+// serialized form. The message should still parse, with the other field left
+// alone.
+TEST_F(BackendTest, ListValueStringElements) {
+  chirp::GetRequest request;
+  request.set_key("key");
+  request.add_keys(keys[0]);
+  request.add_keys(keys[1]);
+  std::string message;
+  request.SerializeToString(&message);
+  const uint32_t field = chirp::GetRequest::kKeysFieldNumber;
+
+  bool changed;
+  EXPECT_TRUE(ListValue::Append(&message, field, keys[1], true, &changed));
+  EXPECT_FALSE(changed);
+  EXPECT_TRUE(ListValue::Append(&message, field, keys[2], true, &changed));
+  EXPECT_TRUE(changed);
+  EXPECT_TRUE(ListValue::Remove(&message, field, keys[0], &changed));
+  EXPECT_TRUE(changed);
+  EXPECT_TRUE(ListValue::Remove(&message, field, keys[0], &changed));
+  EXPECT_FALSE(changed);
+
+  ASSERT_TRUE(request.ParseFromString(message));
+  EXPECT_EQ("key", request.key());
+  ASSERT_EQ(2, request.keys_size());
+  EXPECT_EQ(keys[1], request.keys(0));
+  EXPECT_EQ(keys[2], request.keys(1));
+
+  std::string invalid("\xff");
+  EXPECT_FALSE(ListValue::Append(&invalid, field, keys[0], false, &changed));
+}
+
+// The following test edits a packed uint64 list, the encoding protobuf uses
+// for `repeated uint64`, and checks the elements that are left
+TEST_F(BackendTest, ListValueUint64Elements) {
+  // Field 1 packed with 1, 300, 1
+  std::string message("\x0a\x04\x01\xac\x02\x01", 6);
+  bool changed;
+  EXPECT_TRUE(ListValue::Append(&message, 1, 300, true, &changed));
+  EXPECT_FALSE(changed);
+  EXPECT_TRUE(ListValue::Append(&message, 1, 7, true, &changed));
+  EXPECT_TRUE(changed);
+  EXPECT_TRUE(ListValue::Remove(&message, 1, 1, &changed));
+  EXPECT_TRUE(changed);
+  // Field 1 packed with 300, then field 1 unpacked with 7
+  EXPECT_EQ(std::string("\x0a\x02\xac\x02\x08\x07", 6), message);
+
+  EXPECT_TRUE(ListValue::Remove(&message, 1, 300, &changed));
+  EXPECT_TRUE(ListValue::Remove(&message, 1, 7, &changed));
+  EXPECT_EQ(std::string(), message);
+}
+
+// The following test runs the same puts, overwrites and deletes on both
+// storage modes and on a `std::map`. Values of many sizes move records
+// between size classes, and the deletes move records back in the index.
+TEST_F(BackendTest, DataStructureStorageModes) {
+  for (ShardStorage::Modes mode : {ShardStorage::HEAP, ShardStorage::ARENA}) {
+    BackendDataStructure data(3, mode);
+    EXPECT_EQ(mode, data.get_storage_mode());
+    std::map<std::string, std::string> expected;
+    for (int i = 0; i < kNumOfPairsPerThread; ++i) {
+      std::string key = std::to_string(i * 7919 % kNumOfPairsPerThread);
+      std::string value(i % 3000, char(i));
+      EXPECT_TRUE(data.Put(key, value));
+      expected[key] = value;
+      if (i % 3 == 0) {
+        std::string victim = std::to_string(i / 2);
+        EXPECT_EQ(expected.erase(victim) == 1, data.DeleteKey(victim));
+      }
+    }
+
+    for (const auto& pair : expected) {
+      std::string value;
+      EXPECT_TRUE(data.Get(pair.first, &value));
+      EXPECT_EQ(pair.second, value);
+    }
+
+    std::vector<std::pair<std::string, std::string>> copied;
+    for (size_t i = 0; i < data.get_num_of_shards(); ++i) {
+      data.CopyShard(i, &copied);
+    }
+    EXPECT_EQ(expected.size(), copied.size());
+    std::map<std::string, std::string> copied_map(copied.begin(),
+                                                  copied.end());
+    EXPECT_EQ(expected, copied_map);
+  }
+}
+
+// The following test checks the memory accounted per key prefix. In the
+// arena mode a pair takes its record, rounded up to 16 bytes, and one index
+// slot.
+TEST_F(BackendTest, DataStructureMemoryUsage) {
+  BackendDataStructure data(4, ShardStorage::ARENA);
+  for (int i = 0; i < kNumOfPairs; ++i) {
+    // 8-byte keys and 7-byte values make 23-byte records
+    EXPECT_TRUE(data.Put("user" + std::to_string(1000 + i), "chirps!"));
+    EXPECT_TRUE(data.Put("chrp" + std::to_string(1000 + i), "chirps!"));
+  }
+  // Overwriting a value moves its pair to a larger class
+  EXPECT_TRUE(data.Put("user1000", std::string(40, 'x')));
+
+  std::map<std::string, BackendDataStructure::PrefixUsage> usage;
+  data.GetMemoryUsage(&usage);
+  ASSERT_EQ(2, usage.size());
+  EXPECT_EQ(kNumOfPairs, usage["chrp"].num_of_keys);
+  EXPECT_EQ(kNumOfPairs * (32 + 16), usage["chrp"].bytes);
+  EXPECT_EQ(kNumOfPairs, usage["user"].num_of_keys);
+  EXPECT_EQ((kNumOfPairs - 1) * (32 + 16) + (64 + 16), usage["user"].bytes);
+  EXPECT_EQ(usage["chrp"].bytes + usage["user"].bytes, data.get_bytes_used());
+
+  // Deleting every pair gives all of it back
+  for (int i = 0; i < kNumOfPairs; ++i) {
+    EXPECT_TRUE(data.DeleteKey("user" + std::to_string(1000 + i)));
+    EXPECT_TRUE(data.DeleteKey("chrp" + std::to_string(1000 + i)));
+  }
+  usage.clear();
+  data.GetMemoryUsage(&usage);
+  EXPECT_TRUE(usage.empty());
+  EXPECT_EQ(0, data.get_bytes_used());
+}
+
+// The following test fills the data structure up to its memory limit.
+// Writes fail from then on, but deletes go through and make room again.
+TEST_F(BackendTest, DataStructureMemoryLimit) {
+  BackendDataStructure data(4, ShardStorage::ARENA);
+  // Each of these pairs takes a 16-byte record and a 16-byte slot
+  data.set_memory_limit(kNumOfPairs * 32);
+
+  int num_of_put = 0;
+  while (data.Put(std::to_string(num_of_put), "value")) {
+    ++num_of_put;
+  }
+  EXPECT_EQ(kNumOfPairs, num_of_put);
+  EXPECT_TRUE(data.IsOverMemoryLimit());
+
+  uint64_t previous;
+  bool changed;
+  EXPECT_FALSE(data.MultiPut(keys, correct_values_full));
+  EXPECT_FALSE(data.FetchAdd("counter", 1, &previous));
+  EXPECT_FALSE(data.Update(
+      "list", [](std::string* value) {
+        value->append("element");
+        return BackendDataStructure::CHANGED;
+      },
+      &changed));
+
+  EXPECT_TRUE(data.DeleteKey("0"));
+  EXPECT_FALSE(data.IsOverMemoryLimit());
+  EXPECT_TRUE(data.Put("0", "value"));
+}
+
+// The following test measures the heap memory taken by the same pairs in
+// both storage modes. The arena mode should take less per pair.
+TEST_F(BackendTest, DataStructureArenaBytesPerEntry) {
+  const int num_of_entries = 100000;
+  size_t bytes_per_entry[2];
+  for (ShardStorage::Modes mode : {ShardStorage::HEAP, ShardStorage::ARENA}) {
+    struct mallinfo2 before = mallinfo2();
+    std::unique_ptr<BackendDataStructure> data(
+        new BackendDataStructure(BackendDataStructure::kDefaultNumOfShards,
+                                 mode));
+    for (int i = 0; i < num_of_entries; ++i) {
+      // Keys and values in the shape of the service's ids and counters
+      std::string key = "chrp" + std::to_string(10000000 + i);
+      EXPECT_TRUE(data->Put(key, key.substr(4)));
+    }
+    struct mallinfo2 after = mallinfo2();
+    bytes_per_entry[mode] = (after.uordblks + after.hblkhd - before.uordblks -
+                             before.hblkhd) /
+                            num_of_entries;
+  }
+
+  std::cout << "Bytes per entry: heap " << bytes_per_entry[ShardStorage::HEAP]
+            << ", arena " << bytes_per_entry[ShardStorage::ARENA]
+            << std::endl;
+  EXPECT_LT(bytes_per_entry[ShardStorage::ARENA] * 4,
+            bytes_per_entry[ShardStorage::HEAP] * 3);
+}
+
+// The following test puts and erases keys of both sides of the inline key
+// size many times over, so the swiss table is rebuilt both to grow and to drop
+// its tombstones
+TEST_F(BackendTest, SwissStorageChurn) {
+  SwissShardStorage storage;
+  std::string long_prefix(SwissShardStorage::kMaxInlineKeySize, 'k');
+  auto key_of = [&](int i) {
+    return (i % 2 == 0 ? "k" : long_prefix) + std::to_string(i);
+  };
+  const int num_of_keys = 1000;
+  for (int round = 0; round < 20; ++round) {
+    for (int i = 0; i < num_of_keys; ++i) {
+      EXPECT_EQ(0, storage.Put(key_of(i), std::to_string(round)));
+    }
+    EXPECT_EQ(num_of_keys, storage.size());
+    std::string value;
+    for (int i = 0; i < num_of_keys; ++i) {
+      EXPECT_TRUE(storage.Get(key_of(i), &value));
+      EXPECT_EQ(std::to_string(round), value);
+      EXPECT_FALSE(storage.Get("missing" + key_of(i), nullptr));
+    }
+    for (int i = 0; i < num_of_keys; ++i) {
+      EXPECT_LT(0, storage.Erase(key_of(i)));
+    }
+    EXPECT_EQ(0, storage.size());
+    EXPECT_EQ(0, storage.Erase(key_of(0)));
+  }
+
+  size_t num_of_visited = 0;
+  EXPECT_EQ(0, storage.Put(long_prefix + "a", "value"));
+  EXPECT_EQ(0, storage.Put("a", "value"));
+  storage.ForEach([&](const char *key, size_t key_size, const char *value,
+                      size_t value_size) {
+    EXPECT_TRUE(storage.Get(std::string(key, key_size), nullptr));
+    EXPECT_EQ("value", std::string(value, value_size));
+    ++num_of_visited;
+  });
+  EXPECT_EQ(2, num_of_visited);
+}
+
+// The following microbenchmark measures point lookups of the storages alone,
+// without the shards and their locks, on the keys of one shard in the shape
+// of the service's keys. Half of the lookups miss.
+TEST_F(BackendTest, SwissStorageLookupBenchmark) {
+  const int num_of_keys = 100000;
+  const int num_of_lookups = 1000000;
+  std::vector<std::string> lookup_keys;
+  for (int i = 0; i < num_of_lookups; ++i) {
+    int number = static_cast<int>((i * 7919ULL) % (2 * num_of_keys));
+    lookup_keys.push_back("chrp" + std::to_string(10000000 + number));
+  }
+
+  for (ShardStorage::Modes mode : {ShardStorage::HEAP, ShardStorage::ORDERED,
+                                   ShardStorage::SWISS}) {
+    std::unique_ptr<ShardStorage> storage = ShardStorage::Create(mode, 0);
+    for (int i = 0; i < num_of_keys; ++i) {
+      std::string key = "chrp" + std::to_string(10000000 + i);
+      storage->Put(key, key.substr(4));
+    }
+
+    auto begin = std::chrono::steady_clock::now();
+    int num_of_found = 0;
+    for (const std::string& key : lookup_keys) {
+      num_of_found += storage->Get(key, nullptr);
+    }
+    std::chrono::duration<double> elapsed =
+        std::chrono::steady_clock::now() - begin;
+    EXPECT_EQ(num_of_lookups / 2, num_of_found);
+    std::cout << ShardStorage::ModeName(mode) << ": "
+              << static_cast<uint64_t>(num_of_lookups / elapsed.count())
+              << " lookups/s" << std::endl;
+  }
+}
+
+// The following benchmark counts the copies of a value made by a get and by
+// a put between the storage and the bytes grpc sends or receives, through
+// protobuf messages as the synchronous server does, and through shared
+// buffers as the asynchronous server does. A step that leaves the value
+// somewhere other than where it found it is a copy.
+TEST_F(BackendTest, ZeroCopyValuesBenchmark) {
+  const int num_of_requests = 2000;
+  std::vector<std::string> get_keys(1, "key");
+  // Reports one way of serving requests and returns its copies
+  auto report = [&](const char* name, size_t value_size, size_t copies,
+                    std::chrono::steady_clock::time_point begin) {
+    std::chrono::duration<double, std::nano> elapsed =
+        std::chrono::steady_clock::now() - begin;
+    std::cout << name << ", " << value_size << "-byte values: "
+              << static_cast<double>(copies) / num_of_requests
+              << " copies and "
+              << copies * value_size / num_of_requests
+              << " bytes moved per request, "
+              << static_cast<uint64_t>(elapsed.count() / num_of_requests)
+              << " ns per request" << std::endl;
+    return copies;
+  };
+
+  for (size_t value_size : {static_cast<size_t>(100),
+                            static_cast<size_t>(4096),
+                            static_cast<size_t>(65536)}) {
+    KeyValueStoreImpl service;
+    BackendDataStructure* data = service.get_backend_data();
+    ASSERT_TRUE(data->Put("key", std::string(value_size, 'v')));
+    std::vector<ValueBuffer> stored;
+    data->MultiGetShared(get_keys, &stored);
+
+    size_t copies = 0;
+    auto begin = std::chrono::steady_clock::now();
+    for (int i = 0; i < num_of_requests; ++i) {
+      std::vector<std::string> values;
+      data->MultiGet(get_keys, &values);
+      copies += values[0].data() != stored[0].data();
+      chirp::GetReply reply;
+      reply.mutable_value()->swap(values[0]);
+      grpc::ByteBuffer buffer;
+      bool own_buffer;
+      grpc::SerializationTraits<chirp::GetReply>::Serialize(reply, &buffer,
+                                                            &own_buffer);
+      copies += !PointsInto(buffer, reply.value().data());
+    }
+    size_t protobuf_copies =
+        report("get, protobuf", value_size, copies, begin);
+
+    copies = 0;
+    begin = std::chrono::steady_clock::now();
+    for (int i = 0; i < num_of_requests; ++i) {
+      std::vector<ValueBuffer> values;
+      data->MultiGetShared(get_keys, &values);
+      copies += values[0].data() != stored[0].data();
+      grpc::ByteBuffer buffer;
+      KeyValueStoreImpl::EncodeGetReply(values[0], &buffer);
+      copies += !PointsInto(buffer, values[0].data());
+    }
+    size_t shared_copies = report("get, shared", value_size, copies, begin);
+    // Small values are copied into the reply on purpose
+    EXPECT_EQ(value_size < KeyValueStoreImpl::kMinSharedReplySize
+                  ? num_of_requests
+                  : 0,
+              shared_copies);
+    EXPECT_LT(shared_copies, protobuf_copies);
+
+    // A put request arrives as bytes, which are always parsed once
+    chirp::PutRequest request;
+    request.set_key("key");
+    request.set_value(std::string(value_size, 'p'));
+    grpc::ByteBuffer request_buffer;
+    bool own_buffer;
+    grpc::SerializationTraits<chirp::PutRequest>::Serialize(
+        request, &request_buffer, &own_buffer);
+
+    copies = 0;
+    begin = std::chrono::steady_clock::now();
+    for (int i = 0; i < num_of_requests; ++i) {
+      grpc::ByteBuffer received(request_buffer);
+      chirp::PutRequest parsed;
+      EXPECT_TRUE(grpc::SerializationTraits<chirp::PutRequest>::Deserialize(
+                      &received, &parsed)
+                      .ok());
+      copies += !PointsInto(request_buffer, parsed.value().data());
+      grpc::ServerContext context;
+      chirp::PutReply reply;
+      EXPECT_TRUE(service.put(&context, &parsed, &reply).ok());
+      stored.clear();
+      data->MultiGetShared(get_keys, &stored);
+      copies += stored[0].data() != parsed.value().data();
+    }
+    protobuf_copies = report("put, protobuf", value_size, copies, begin);
+
+    copies = 0;
+    begin = std::chrono::steady_clock::now();
+    for (int i = 0; i < num_of_requests; ++i) {
+      grpc::ByteBuffer received(request_buffer);
+      chirp::PutRequest parsed;
+      EXPECT_TRUE(grpc::SerializationTraits<chirp::PutRequest>::Deserialize(
+                      &received, &parsed)
+                      .ok());
+      const char* parsed_value = parsed.value().data();
+      copies += !PointsInto(request_buffer, parsed_value);
+      EXPECT_TRUE(service.PutTakingValue(&parsed).ok());
+      stored.clear();
+      data->MultiGetShared(get_keys, &stored);
+      copies += stored[0].data() != parsed_value;
+    }
+    shared_copies = report("put, shared", value_size, copies, begin);
+    EXPECT_EQ(num_of_requests, shared_copies);
+    EXPECT_LT(shared_copies, protobuf_copies);
+    EXPECT_EQ(request.value(), stored[0].str());
+  }
+}
+
+// The following test checks the bucket bounds of the latency histogram and
+// that its percentiles come within one bucket of the exact ones
+TEST_F(BackendTest, LatencyHistogram) {
+  std::vector<uint64_t> values = {0, 1, 31, 32, 33, 63, 64, 1000, 123456789,
+                                  std::numeric_limits<uint64_t>::max()};
+  for (uint64_t value : values) {
+    size_t bucket = LatencyHistogram::BucketOf(value);
+    ASSERT_LT(bucket, LatencyHistogram::kNumOfBuckets);
+    EXPECT_LE(LatencyHistogram::LowestOf(bucket), value);
+    EXPECT_GE(LatencyHistogram::HighestOf(bucket), value);
+    EXPECT_LE(LatencyHistogram::HighestOf(bucket) -
+                  LatencyHistogram::LowestOf(bucket),
+              value / LatencyHistogram::kNumOfSubBuckets);
+  }
+
+  LatencyHistogram histogram;
+  LatencyHistogram::Counts counts;
+  histogram.Read(&counts);
+  EXPECT_EQ(0, LatencyHistogram::Summarize(counts).count);
+
+  for (uint64_t value = 1; value <= 10000; ++value) {
+    histogram.Record(value);
+  }
+  histogram.Read(&counts);
+  LatencyHistogram::Summary summary = LatencyHistogram::Summarize(counts);
+  EXPECT_EQ(10000, summary.count);
+  EXPECT_NEAR(5000, summary.mean, 5000 / 32);
+  EXPECT_GE(summary.p50, 5000);
+  EXPECT_LE(summary.p50, 5000 + 5000 / 32);
+  EXPECT_GE(summary.p90, 9000);
+  EXPECT_LE(summary.p90, 9000 + 9000 / 32);
+  EXPECT_GE(summary.p99, 9900);
+  EXPECT_LE(summary.p99, 9900 + 9900 / 32);
+  EXPECT_GE(summary.p999, 9990);
+  EXPECT_GE(summary.max, 10000);
+  EXPECT_LE(summary.max, 10000 + 10000 / 32);
+
+  // Records from many threads all add up
+  LatencyHistogram shared;
+  std::vector<std::thread> threads;
+  for (int i = 0; i < kNumOfThreads; ++i) {
+    threads.push_back(std::thread([&shared, i]() {
+      for (int j = 0; j < kNumOfPairsPerThread; ++j) {
+        shared.Record(i * kNumOfPairsPerThread + j);
+      }
+    }));
+  }
+  for (std::thread &thread : threads) {
+    thread.join();
+  }
+  shared.Read(&counts);
+  EXPECT_EQ(kNumOfThreads * kNumOfPairsPerThread,
+            LatencyHistogram::Summarize(counts).count);
+}
+
+// The following test blocks a reader behind a writer. Only the blocked lock
+// should count as contended, along with the time it waited.
+TEST_F(BackendTest, ReadWriteLockContention) {
+  ReadWriteLock lock;
+  lock.ReadLock();
+  lock.Unlock();
+  EXPECT_EQ(0, lock.get_num_of_contended());
+  EXPECT_EQ(0, lock.get_wait_nanoseconds());
+
+  lock.WriteLock();
+  std::thread reader([&lock]() {
+    lock.ReadLock();
+    lock.Unlock();
+  });
+  std::this_thread::sleep_for(std::chrono::milliseconds(50));
+  lock.Unlock();
+  reader.join();
+  EXPECT_EQ(1, lock.get_num_of_contended());
+  EXPECT_GE(lock.get_wait_nanoseconds(), 10 * 1000 * 1000);
+
+  BackendDataStructure data;
+  data.Put("key", "value");
+  BackendDataStructure::LockContention contention = data.GetLockContention();
+  EXPECT_EQ(0, contention.num_of_contended);
+  EXPECT_EQ(0, contention.wait_nanoseconds);
+}
+
+// The following test walks the expiry wheel across ticks and turns. Keys
+// are only collected once their deadlines pass, and a collection stops at
+// its limit.
+TEST_F(BackendTest, ExpiryWheelCollect) {
+  const uint64_t tick = ExpiryWheel::kTickMilliseconds;
+  const uint64_t turn = ExpiryWheel::kNumOfSlots * tick;
+  const uint64_t start = 1000 * turn;
+  ExpiryWheel wheel;
+  std::vector<std::string> due;
+  wheel.Collect(start, 10, &due);
+  EXPECT_TRUE(due.empty());
+
+  wheel.Add("soon", start + tick);
+  // The same slot one turn later
+  wheel.Add("next turn", start + tick + turn);
+  for (int i = 0; i < kNumOfPairs; ++i) {
+    wheel.Add(keys[i], start + 5 * tick);
+  }
+  EXPECT_EQ(kNumOfPairs + 2, wheel.size());
+
+  wheel.Collect(start + tick - 1, 10, &due);
+  EXPECT_TRUE(due.empty());
+  wheel.Collect(start + tick, 10, &due);
+  EXPECT_EQ(std::vector<std::string>({"soon"}), due);
+
+  // The batch is collected over two calls
+  due.clear();
+  wheel.Collect(start + 5 * tick, kNumOfPairs / 2, &due);
+  EXPECT_EQ(kNumOfPairs / 2, due.size());
+  wheel.Collect(start + 6 * tick, kNumOfPairs, &due);
+  std::sort(due.begin(), due.end());
+  std::vector<std::string> sorted_keys(keys);
+  std::sort(sorted_keys.begin(), sorted_keys.end());
+  EXPECT_EQ(sorted_keys, due);
+
+  // A deadline already passed is collected by the next call
+  due.clear();
+  wheel.Add("late", start);
+  wheel.Collect(start + 7 * tick, 10, &due);
+  EXPECT_EQ(std::vector<std::string>({"late"}), due);
+
+  due.clear();
+  wheel.Collect(start + turn, 10, &due);
+  EXPECT_TRUE(due.empty());
+  wheel.Collect(start + 3 * turn, 10, &due);
+  EXPECT_EQ(std::vector<std::string>({"next turn"}), due);
+  EXPECT_EQ(0, wheel.size());
+}
+
+// The following test fills a cuckoo filter to 90%. It has no false
+// negatives, few false positives, and forgets the keys erased from it.
+TEST_F(BackendTest, CuckooFilterInsertAndErase) {
+  const int num_of_keys = 100000;
+  CuckooFilter filter(num_of_keys / 2);
+  int num_of_inserted = 0;
+  while (num_of_inserted * 10 < int(filter.get_capacity() * 9)) {
+    ASSERT_TRUE(filter.Insert("user" + std::to_string(num_of_inserted)));
+    ++num_of_inserted;
+  }
+  EXPECT_EQ(num_of_inserted, filter.size());
+  for (int i = 0; i < num_of_inserted; ++i) {
+    EXPECT_TRUE(filter.MayContain("user" + std::to_string(i)));
+  }
+
+  int num_of_false_positives = 0;
+  for (int i = 0; i < num_of_keys; ++i) {
+    num_of_false_positives += filter.MayContain("nobody" + std::to_string(i));
+  }
+  std::cout << "False positives: " << num_of_false_positives << " of "
+            << num_of_keys << std::endl;
+  EXPECT_GT(num_of_keys / 1000, num_of_false_positives);
+
+  for (int i = 0; i < num_of_inserted; i += 2) {
+    filter.Erase("user" + std::to_string(i));
+  }
+  EXPECT_EQ(num_of_inserted / 2, filter.size());
+  int num_of_erased_found = 0;
+  for (int i = 0; i < num_of_inserted; ++i) {
+    if (i % 2 == 1) {
+      EXPECT_TRUE(filter.MayContain("user" + std::to_string(i)));
+    } else {
+      num_of_erased_found += filter.MayContain("user" + std::to_string(i));
+    }
+  }
+  EXPECT_GT(num_of_inserted / 1000, num_of_erased_found);
+}
+
+// The following test checks keys that exist, were deleted, or never existed,
+// in every storage mode. The filters are rebuilt many times as the shards
+// grow.
+TEST_F(BackendTest, DataStructureExists) {
+  for (ShardStorage::Modes mode :
+       {ShardStorage::HEAP, ShardStorage::ARENA, ShardStorage::ORDERED,
+        ShardStorage::SWISS}) {
+    BackendDataStructure data(4, mode);
+    std::vector<std::string> probes;
+    std::vector<bool> expected;
+    for (int i = 0; i < kNumOfPairsPerThread; ++i) {
+      std::string key = std::to_string(i);
+      EXPECT_TRUE(data.Put(key, "value"));
+      if (i % 3 == 0) {
+        EXPECT_TRUE(data.DeleteKey(key));
+      }
+      probes.push_back(key);
+      expected.push_back(i % 3 != 0);
+      probes.push_back("missing" + key);
+      expected.push_back(false);
+    }
+    EXPECT_TRUE(data.Put("expiring", "value", 1));
+    std::this_thread::sleep_for(std::chrono::milliseconds(5));
+    probes.push_back("expiring");
+    expected.push_back(false);
+
+    std::vector<bool> output;
+    data.Exists(probes, &output);
+    EXPECT_EQ(expected, output);
+  }
+}
+
+// The following test puts pairs with a time to live. They disappear from
+// every read once they expire, and `ExpireKeys()` gives their memory back.
+TEST_F(BackendTest, DataStructureTimeToLive) {
+  BackendDataStructure data(4);
+  EXPECT_TRUE(data.Put("permanent", "value"));
+  uint64_t permanent_bytes = data.get_bytes_used();
+  for (int i = 0; i < kNumOfPairs; ++i) {
+    EXPECT_TRUE(data.Put(keys[i], correct_values_full[i], 100));
+  }
+  // A put without a time to live makes the key permanent again
+  EXPECT_TRUE(data.Put(keys[0], correct_values_full[0]));
+  uint64_t previous;
+  EXPECT_TRUE(data.FetchAdd("counter", 1, &previous));
+  EXPECT_TRUE(data.Put("counter", std::string(8, '\0'), 100));
+  // Modifying the counter keeps its deadline
+  EXPECT_TRUE(data.FetchAdd("counter", 1, &previous));
+  EXPECT_EQ(kNumOfPairs, data.get_num_of_expiring_keys());
+
+  std::vector<std::string> output_values;
+  EXPECT_TRUE(data.MultiGet(keys, &output_values));
+  EXPECT_EQ(correct_values_full, output_values);
+  EXPECT_EQ(0, data.ExpireKeys());
+
+  std::this_thread::sleep_for(std::chrono::milliseconds(150));
+  // Nothing is removed yet, but nothing expired is returned
+  std::string value;
+  EXPECT_FALSE(data.Get(keys[1], &value));
+  EXPECT_FALSE(data.Get("counter", &value));
+  EXPECT_TRUE(data.Get(keys[0], &value));
+  std::vector<std::string> scanned;
+  data.ScanKeys("", "", 0, &scanned);
+  EXPECT_EQ(std::vector<std::string>({keys[0], "permanent"}), scanned);
+  EXPECT_FALSE(data.DeleteKey(keys[1]));
+  bool swapped;
+  EXPECT_TRUE(data.CompareAndSwap(keys[2], "", "new", &swapped, nullptr));
+  EXPECT_TRUE(swapped);
+
+  // keys[1] is deleted and keys[2] is put again, so the other 17 keys and
+  // the counter are left to expire
+  EXPECT_EQ(kNumOfPairs - 2, data.ExpireKeys());
+  EXPECT_EQ(0, data.get_num_of_expiring_keys());
+  EXPECT_TRUE(data.Get(keys[2], &value));
+  EXPECT_TRUE(data.DeleteKey(keys[0]));
+  EXPECT_TRUE(data.DeleteKey(keys[2]));
+  EXPECT_EQ(permanent_bytes, data.get_bytes_used());
+}
+
+// The following test reads at snapshots while the keys are overwritten,
+// deleted and added. A snapshot keeps seeing the values it was created with
+// until its versions are collected, which only happens once it is released
+// or its lease runs out.
+TEST_F(BackendTest, DataStructureSnapshotReads) {
+  BackendDataStructure data(4);
+  EXPECT_TRUE(data.MultiPut(keys, correct_values_full));
+  // No versions are kept while there are no snapshots
+  EXPECT_TRUE(data.Put(keys[0], correct_values_full[0]));
+  EXPECT_EQ(0, data.get_num_of_versions());
+
+  uint64_t snapshot = data.CreateSnapshot();
+  EXPECT_EQ(1, data.get_num_of_snapshots());
+  EXPECT_TRUE(data.MultiDelete(keys_to_be_deleted, nullptr));
+  EXPECT_TRUE(data.Put(keys[0], "new"));
+  EXPECT_TRUE(data.Put(keys[0], "newer"));
+  EXPECT_TRUE(data.Put("added", "value"));
+  uint64_t previous;
+  EXPECT_TRUE(data.FetchAdd("counter", 1, &previous));
+
+  std::vector<std::string> probes(keys);
+  probes.push_back("added");
+  probes.push_back("counter");
+  std::vector<std::string> expected(correct_values_full);
+  expected.resize(kNumOfPairs + 2);
+  std::vector<std::string> output_values;
+  EXPECT_TRUE(data.MultiGetAtSnapshot(snapshot, probes, &output_values));
+  EXPECT_EQ(expected, output_values);
+
+  // A later snapshot sees the writes before it, and collecting keeps what
+  // the first one needs
+  uint64_t later_snapshot = data.CreateSnapshot();
+  EXPECT_TRUE(data.Put(keys[0], "newest"));
+  EXPECT_EQ(0, data.CollectVersions());
+  output_values.clear();
+  EXPECT_TRUE(data.MultiGetAtSnapshot(snapshot, probes, &output_values));
+  EXPECT_EQ(expected, output_values);
+  output_values.clear();
+  EXPECT_TRUE(data.MultiGetAtSnapshot(later_snapshot, {keys[0], keys[1]},
+                                      &output_values));
+  EXPECT_EQ(std::vector<std::string>({"newer", ""}), output_values);
+
+  // Releasing the first snapshot drops the versions only it needs
+  EXPECT_TRUE(data.ReleaseSnapshot(snapshot));
+  EXPECT_FALSE(data.ReleaseSnapshot(snapshot));
+  size_t num_of_versions = data.get_num_of_versions();
+  EXPECT_EQ(num_of_versions - 1, data.CollectVersions());
+  EXPECT_FALSE(data.MultiGetAtSnapshot(snapshot, probes, &output_values));
+  output_values.clear();
+  EXPECT_TRUE(
+      data.MultiGetAtSnapshot(later_snapshot, {keys[0]}, &output_values));
+  EXPECT_EQ(std::vector<std::string>({"newer"}), output_values);
+
+  // A snapshot whose lease runs out is released by the collection
+  uint64_t leased_snapshot = data.CreateSnapshot(1);
+  EXPECT_TRUE(data.ReleaseSnapshot(later_snapshot));
+  std::this_thread::sleep_for(std::chrono::milliseconds(5));
+  EXPECT_EQ(1, data.CollectVersions());
+  EXPECT_EQ(0, data.get_num_of_snapshots());
+  EXPECT_EQ(0, data.get_num_of_versions());
+  EXPECT_FALSE(
+      data.MultiGetAtSnapshot(leased_snapshot, {keys[0]}, &output_values));
+  // Handles that were never given out cannot be read either
+  EXPECT_FALSE(data.MultiGetAtSnapshot(leased_snapshot + 1000, {keys[0]},
+                                       &output_values));
+  EXPECT_FALSE(data.MultiGetAtSnapshot(1, {keys[0]}, &output_values));
+}
+
+// The following test follows the changes of a data structure through its
+// change log, filters them by prefix, and resumes from a kept offset but not
+// from a dropped one
+TEST_F(BackendTest, ChangeLogReadFilterAndResume) {
+  ChangeLog log(4, 100);
+  BackendDataStructure data(4);
+  data.SetChangeLog(&log);
+  size_t num_of_wakeups = 0;
+  size_t id = log.AddListener([&num_of_wakeups]() { ++num_of_wakeups; });
+
+  EXPECT_TRUE(data.Put("a/1", "x"));
+  EXPECT_TRUE(data.Put("b/1", "y"));
+  EXPECT_TRUE(data.DeleteKey("a/1"));
+  // Deleting a missing key changes nothing
+  EXPECT_FALSE(data.DeleteKey("a/1"));
+  EXPECT_EQ(3U, num_of_wakeups);
+  EXPECT_EQ(103U, log.get_next_seq());
+
+  uint64_t from_seq = 100;
+  std::vector<ChangeLog::Change> changes;
+  ASSERT_TRUE(log.Read(&from_seq, "a/", 10, std::chrono::milliseconds(0),
+                       &changes));
+  ASSERT_EQ(2U, changes.size());
+  EXPECT_EQ(100U, changes[0].seq);
+  EXPECT_EQ(ChangeLog::PUT, changes[0].operation);
+  EXPECT_EQ("x", changes[0].value);
+  EXPECT_EQ(102U, changes[1].seq);
+  EXPECT_EQ(ChangeLog::DELETE, changes[1].operation);
+  // The offset moves past the filtered change too
+  EXPECT_EQ(103U, from_seq);
+
+  // A reader that waits gets the next change as soon as it is appended
+  changes.clear();
+  std::thread writer([&data]() {
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    data.Put("a/2", "z");
+  });
+  ASSERT_TRUE(
+      log.Read(&from_seq, "", 10, std::chrono::milliseconds(5000), &changes));
+  writer.join();
+  ASSERT_EQ(1U, changes.size());
+  EXPECT_EQ("a/2", changes[0].key);
+  EXPECT_EQ(104U, from_seq);
+
+  // Only the last 4 changes are kept
+  log.RemoveListener(id);
+  EXPECT_TRUE(data.Put("c/1", "w"));
+  EXPECT_EQ(4U, num_of_wakeups);
+  uint64_t dropped_seq = 100;
+  EXPECT_FALSE(log.Read(&dropped_seq, "", 10, std::chrono::milliseconds(0),
+                        &changes));
+  uint64_t kept_seq = 101;
+  changes.clear();
+  ASSERT_TRUE(
+      log.Read(&kept_seq, "", 2, std::chrono::milliseconds(0), &changes));
+  ASSERT_EQ(2U, changes.size());
+  EXPECT_EQ("b/1", changes[0].key);
+  EXPECT_EQ(103U, kept_seq);
+  // Offsets that were never reached cannot be read either
+  uint64_t future_seq = 1000;
+  EXPECT_FALSE(log.Read(&future_seq, "", 10, std::chrono::milliseconds(0),
+                        &changes));
+}
+
+// The following test watches overlapping prefixes of a data structure's keys.
+// A write reaches the watchers of its prefixes only, each of them once, and
+// a watcher that is not read in time reports the events it dropped.
+TEST_F(BackendTest, WatchTablePrefixDispatch) {
+  BackendDataStructure data(4);
+  WatchTable *table = data.get_watch_table();
+  size_t num_of_wakeups = 0;
+  WatchTable::Watcher user_watcher(
+      8, true, [&num_of_wakeups]() { ++num_of_wakeups; });
+  WatchTable::Watcher all_watcher(2, false, nullptr);
+  // "user/1" starts with "user/", so it adds nothing
+  table->Add({"user/1", "user/", "chirp/7"}, &user_watcher);
+  table->Add({""}, &all_watcher);
+  EXPECT_EQ(2U, table->get_num_of_watchers());
+
+  EXPECT_TRUE(data.Put("user/1", "alice"));
+  EXPECT_TRUE(data.Put("use", "nobody"));
+  EXPECT_TRUE(data.Put("chirp/7", "hello"));
+  EXPECT_TRUE(data.DeleteKey("user/1"));
+  EXPECT_EQ(3U, num_of_wakeups);
+
+  std::vector<WatchTable::Event> events;
+  EXPECT_TRUE(user_watcher.Take(std::chrono::milliseconds(0), &events));
+  ASSERT_EQ(3U, events.size());
+  EXPECT_EQ("user/1", events[0].key);
+  EXPECT_FALSE(events[0].deleted);
+  EXPECT_EQ("alice", events[0].value);
+  EXPECT_EQ("chirp/7", events[1].key);
+  EXPECT_TRUE(events[2].deleted);
+
+  // Only the last 2 of the 4 writes are kept, without their values
+  events.clear();
+  EXPECT_FALSE(all_watcher.Take(std::chrono::milliseconds(0), &events));
+  ASSERT_EQ(2U, events.size());
+  EXPECT_EQ("", events[0].value);
+  EXPECT_EQ("user/1", events[1].key);
+  events.clear();
+  EXPECT_TRUE(all_watcher.Take(std::chrono::milliseconds(0), &events));
+  EXPECT_TRUE(events.empty());
+
+  // A reader that waits gets the next write as soon as it is applied
+  std::thread writer([&data]() {
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    data.Put("user/2", "bob");
+  });
+  EXPECT_TRUE(user_watcher.Take(std::chrono::milliseconds(5000), &events));
+  writer.join();
+  ASSERT_EQ(1U, events.size());
+  EXPECT_EQ("bob", events[0].value);
+
+  // A removed watcher hears nothing more, and its nodes are pruned
+  table->Remove(&user_watcher);
+  table->Remove(&all_watcher);
+  EXPECT_EQ(0U, table->get_num_of_watchers());
+  EXPECT_TRUE(data.Put("user/3", "carol"));
+  events.clear();
+  EXPECT_TRUE(user_watcher.Take(std::chrono::milliseconds(0), &events));
+  EXPECT_TRUE(events.empty());
+  EXPECT_EQ(4U, num_of_wakeups);
+}
+
+// This fixture starts no client or server, so that the threads
+// ThreadSanitizer sees in `backend_test_tsan` are only the ones of the test
+class BackendLockFreeTest : public ::testing::Test {};
+
+// The clock of the read index tests, in milliseconds
+uint64_t read_index_test_now = 0;
+uint64_t ReadIndexTestClock() { return read_index_test_now; }
+
+// The following test replaces, erases and expires pairs of a read index
+// while it grows from one table to the next
+TEST_F(BackendLockFreeTest, ReadIndexVersions) {
+  EpochManager epochs;
+  ReadIndex index(&epochs);
+  const int num_of_keys = 10000;
+  for (int i = 0; i < num_of_keys; ++i) {
+    index.Put(std::to_string(i), "first", 0);
+    index.Put(std::to_string(i), "second", i % 2 == 0 ? 0 : 100);
+  }
+  EXPECT_EQ(num_of_keys, index.size());
+
+  std::string value;
+  read_index_test_now = 50;
+  for (int i = 0; i < num_of_keys; ++i) {
+    EXPECT_TRUE(index.Get(std::to_string(i), ReadIndexTestClock, &value));
+    EXPECT_EQ("second", value);
+  }
+  // Only the keys with a deadline expire
+  read_index_test_now = 100;
+  for (int i = 0; i < num_of_keys; ++i) {
+    EXPECT_EQ(i % 2 == 0,
+              index.Get(std::to_string(i), ReadIndexTestClock, nullptr));
+  }
+
+  for (int i = 0; i < num_of_keys; i += 3) {
+    index.Erase(std::to_string(i));
+  }
+  index.Erase("missing");
+  EXPECT_EQ(num_of_keys - (num_of_keys + 2) / 3, index.size());
+  for (int i = 0; i < num_of_keys; i += 2) {
+    EXPECT_EQ(i % 3 != 0,
+              index.Get(std::to_string(i), ReadIndexTestClock, nullptr));
+  }
+}
+
+// The following test runs the operations that write a pair with reads that
+// take no lock, and checks the reads see every write
+TEST_F(BackendLockFreeTest, DataStructureLockFreeReads) {
+  std::vector<std::string> keys;
+  std::vector<std::string> correct_values_full;
+  for (int i = 0; i < kNumOfPairs; ++i) {
+    keys.push_back("key" + std::to_string(i));
+    correct_values_full.push_back("value" + std::to_string(i));
+  }
+  BackendDataStructure data(4);
+  data.EnableLockFreeReads();
+  EXPECT_TRUE(data.has_lock_free_reads());
+  EXPECT_TRUE(data.OpenStorage());
+  EXPECT_TRUE(data.MultiPut(keys, correct_values_full));
+
+  std::vector<std::string> output_values;
+  EXPECT_TRUE(data.MultiGet(keys, &output_values));
+  EXPECT_EQ(correct_values_full, output_values);
+  EXPECT_TRUE(data.DeleteKey(keys[0]));
+  std::vector<std::pair<std::string, std::string>> found;
+  data.MultiGetFound(keys, &found);
+  EXPECT_EQ(kNumOfPairs - 1, found.size());
+  std::string value;
+  EXPECT_FALSE(data.Get(keys[0], &value));
+
+  uint64_t previous;
+  EXPECT_TRUE(data.FetchAdd("counter", 2, &previous));
+  EXPECT_TRUE(data.Get("counter", &value));
+  EXPECT_EQ(std::string("\x02\0\0\0\0\0\0\0", 8), value);
+  bool swapped;
+  EXPECT_TRUE(data.CompareAndSwap(keys[1], correct_values_full[1], "swapped",
+                                  &swapped, nullptr));
+  EXPECT_TRUE(data.Get(keys[1], &value));
+  EXPECT_EQ("swapped", value);
+
+  EXPECT_TRUE(data.Put(keys[2], "expiring", 50));
+  EXPECT_TRUE(data.Get(keys[2], &value));
+  std::this_thread::sleep_for(std::chrono::milliseconds(100));
+  EXPECT_FALSE(data.Get(keys[2], &value));
+  EXPECT_EQ(1, data.ExpireKeys());
+  EXPECT_FALSE(data.Get(keys[2], &value));
+}
+
+// The following test checks that the copy of the pairs in the read index
+// counts toward the memory used
+TEST_F(BackendLockFreeTest, DataStructureCountsReadIndex) {
+  BackendDataStructure plain(4);
+  BackendDataStructure lock_free(4);
+  lock_free.EnableLockFreeReads();
+  uint64_t index_bytes = 0;
+  for (int i = 0; i < kNumOfPairs; ++i) {
+    std::string key = "key" + std::to_string(i);
+    std::string value(i, 'v');
+    EXPECT_TRUE(plain.Put(key, "old"));
+    EXPECT_TRUE(lock_free.Put(key, "old"));
+    EXPECT_TRUE(plain.Put(key, value));
+    EXPECT_TRUE(lock_free.Put(key, value));
+    index_bytes += ReadIndex::BytesOf(key.size(), value.size());
+  }
+  EXPECT_EQ(plain.get_bytes_used() + index_bytes, lock_free.get_bytes_used());
+
+  for (int i = 0; i < kNumOfPairs; ++i) {
+    EXPECT_TRUE(lock_free.DeleteKey("key" + std::to_string(i)));
+  }
+  EXPECT_EQ(0, lock_free.get_bytes_used());
+}
+
+// The following test has a writer put rounds of values to keys spread over
+// every shard, one key after another, while readers read them all at
+// snapshots. A snapshot should see one cut of the writes: the keys before
+// some point have one round and the keys after it the round before, and a
+// second read at the same snapshot should see the same values.
+TEST_F(BackendLockFreeTest, DataStructureSnapshotReadsStress) {
+  const int num_of_keys = 64;
+  const int num_of_rounds = 500;
+  BackendDataStructure data(8);
+  data.EnableLockFreeReads();
+  std::vector<std::string> round_keys;
+  for (int i = 0; i < num_of_keys; ++i) {
+    round_keys.push_back("round" + std::to_string(i));
+    EXPECT_TRUE(data.Put(round_keys.back(), "0"));
+  }
+
+  std::atomic<bool> writing(true);
+  std::thread writer([&]() {
+    for (int round = 1; round <= num_of_rounds; ++round) {
+      for (const std::string& key : round_keys) {
+        EXPECT_TRUE(data.Put(key, std::to_string(round)));
+      }
+    }
+    writing = false;
+  });
+  std::thread collector([&]() {
+    while (writing) {
+      data.CollectVersions();
+      std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+  });
+
+  std::atomic<uint64_t> num_of_reads(0);
+  std::vector<std::thread> readers;
+  for (int t = 0; t < kNumOfThreads / 2; ++t) {
+    readers.emplace_back([&]() {
+      while (writing) {
+        uint64_t snapshot = data.CreateSnapshot();
+        std::vector<std::string> values;
+        std::vector<std::string> again;
+        EXPECT_TRUE(data.MultiGetAtSnapshot(snapshot, round_keys, &values));
+        EXPECT_TRUE(data.MultiGetAtSnapshot(snapshot, round_keys, &again));
+        EXPECT_EQ(values, again);
+        int first_round = std::stoi(values.front());
+        int last_round = std::stoi(values.back());
+        EXPECT_TRUE(first_round == last_round ||
+                    first_round == last_round + 1)
+            << first_round << " " << last_round;
+        for (int i = 1; i < num_of_keys; ++i) {
+          EXPECT_LE(std::stoi(values[i]), std::stoi(values[i - 1]));
+        }
+        EXPECT_TRUE(data.ReleaseSnapshot(snapshot));
+        ++num_of_reads;
+      }
+    });
+  }
+
+  writer.join();
+  collector.join();
+  for (auto& reader : readers) {
+    reader.join();
+  }
+  EXPECT_LT(0, num_of_reads);
+  data.CollectVersions();
+  EXPECT_EQ(0, data.get_num_of_versions());
+}
+
+// The following test overwrites, deletes and adds keys from many threads
+// while others read them without locks. Every value names its key and its
+// length, so a read of a freed or half-written value is caught. This is
+// meant to be run under ThreadSanitizer too, see `backend_test_tsan`.
+TEST_F(BackendLockFreeTest, DataStructureLockFreeReadsStress) {
+  const int num_of_hot_keys = 64;
+  const int num_of_writes = 20000;
+  const int num_of_writers = 4;
+  BackendDataStructure data(4);
+  data.EnableLockFreeReads();
+  auto value_of = [](const std::string& key, int version) {
+    std::string length = std::to_string(version % 100);
+    return key + "|" + length + "|" + std::string(version % 100, 'v');
+  };
+  auto is_well_formed = [](const std::string& key, const std::string& value) {
+    size_t separator = value.find('|', key.size() + 1);
+    return value.compare(0, key.size() + 1, key + "|") == 0 &&
+           separator != std::string::npos &&
+           value.size() - separator - 1 ==
+               std::stoul(value.substr(key.size() + 1,
+                                       separator - key.size() - 1));
+  };
+
+  std::atomic<bool> writing(true);
+  std::vector<std::thread> writers;
+  for (int t = 0; t < num_of_writers; ++t) {
+    writers.emplace_back([&, t]() {
+      for (int i = 0; i < num_of_writes; ++i) {
+        std::string key = "hot" + std::to_string(i % num_of_hot_keys);
+        if (i % 10 == 0) {
+          data.DeleteKey(key);
+        } else {
+          EXPECT_TRUE(data.Put(key, value_of(key, i)));
+        }
+        // New keys make the read indexes grow under the readers
+        if (i % 4 == 0) {
+          std::string new_key = "new" + std::to_string(t) + "_" +
+                                std::to_string(i);
+          EXPECT_TRUE(data.Put(new_key, value_of(new_key, i)));
+        }
+      }
+    });
+  }
+
+  std::atomic<uint64_t> num_of_found(0);
+  std::vector<std::thread> readers;
+  for (int t = 0; t < kNumOfThreads; ++t) {
+    readers.emplace_back([&, t]() {
+      std::vector<std::string> hot_keys;
+      for (int i = 0; i < num_of_hot_keys; ++i) {
+        hot_keys.push_back("hot" + std::to_string(i));
+      }
+      std::string value;
+      std::vector<std::string> values;
+      uint64_t found = 0;
+      while (writing) {
+        for (const std::string& key : hot_keys) {
+          if (data.Get(key, &value)) {
+            EXPECT_TRUE(is_well_formed(key, value)) << value;
+            ++found;
+          }
+        }
+        // The batched reads take the same path
+        values.clear();
+        data.MultiGet(hot_keys, &values);
+        for (int i = 0; i < num_of_hot_keys; ++i) {
+          EXPECT_TRUE(values[i].empty() ||
+                      is_well_formed(hot_keys[i], values[i]))
+              << hot_keys[i] << " " << values[i];
+        }
+      }
+      num_of_found += found;
+    });
+  }
+
+  for (auto& writer : writers) {
+    writer.join();
+  }
+  writing = false;
+  for (auto& reader : readers) {
+    reader.join();
+  }
+  EXPECT_LT(0, num_of_found);
+
+  // The copies the readers see are the pairs of the storage
+  std::string value;
+  std::vector<std::pair<std::string, std::string>> pairs;
+  for (size_t i = 0; i < data.get_num_of_shards(); ++i) {
+    data.CopyShard(i, &pairs);
+  }
+  for (const auto& pair : pairs) {
+    EXPECT_TRUE(data.Get(pair.first, &value));
+    EXPECT_EQ(pair.second, value);
+  }
+}
+
+// The following test measures gets per second from 1, 2, 4 and 8 threads
+// while one thread keeps overwriting the keys, with and without locks
+TEST_F(BackendLockFreeTest, DataStructureLockFreeReadsBenchmark) {
+  const int num_of_keys = 1000;
+  const int num_of_gets_per_thread = 200000;
+  for (bool lock_free : {false, true}) {
+    BackendDataStructure data(BackendDataStructure::kDefaultNumOfShards);
+    if (lock_free) {
+      data.EnableLockFreeReads();
+    }
+    std::vector<std::string> bench_keys;
+    for (int i = 0; i < num_of_keys; ++i) {
+      bench_keys.push_back("chrp" + std::to_string(10000000 + i));
+      EXPECT_TRUE(data.Put(bench_keys.back(), bench_keys.back()));
+    }
+
+    std::atomic<bool> writing(true);
+    std::thread writer([&]() {
+      for (int i = 0; writing; i = (i + 1) % num_of_keys) {
+        data.Put(bench_keys[i], bench_keys[(i + 1) % num_of_keys]);
+      }
+    });
+
+    std::cout << (lock_free ? "lock-free" : "locked") << " gets/s:";
+    for (int num_of_readers : {1, 2, 4, 8}) {
+      auto begin = std::chrono::steady_clock::now();
+      std::vector<std::thread> readers;
+      for (int t = 0; t < num_of_readers; ++t) {
+        readers.emplace_back([&, t]() {
+          std::string value;
+          for (int i = 0; i < num_of_gets_per_thread; ++i) {
+            EXPECT_TRUE(data.Get(bench_keys[(i * 7919 + t) % num_of_keys],
+                                 &value));
+          }
+        });
+      }
+      for (auto& reader : readers) {
+        reader.join();
+      }
+      std::chrono::duration<double> elapsed =
+          std::chrono::steady_clock::now() - begin;
+      std::cout << " " << num_of_readers << " threads "
+                << static_cast<uint64_t>(num_of_readers *
+                                         num_of_gets_per_thread /
+                                         elapsed.count());
+    }
+    std::cout << std::endl;
+    writing = false;
+    writer.join();
+  }
+}
+
+// The following test fills a queue, then empties it in the same order
+TEST_F(BackendLockFreeTest, SpscQueueOrder) {
+  // The capacity is rounded up to 8
+  SpscQueue<int> queue(5);
+  EXPECT_TRUE(queue.Empty());
+  int item;
+  EXPECT_FALSE(queue.Pop(&item));
+  for (int round = 0; round < 3; ++round) {
+    for (int i = 0; i < 8; ++i) {
+      EXPECT_TRUE(queue.Push(round * 8 + i));
+    }
+    EXPECT_FALSE(queue.Push(-1));
+    EXPECT_FALSE(queue.Empty());
+    for (int i = 0; i < 8; ++i) {
+      EXPECT_TRUE(queue.Pop(&item));
+      EXPECT_EQ(round * 8 + i, item);
+    }
+    EXPECT_FALSE(queue.Pop(&item));
+    EXPECT_TRUE(queue.Empty());
+  }
+}
+
+// The following test passes items from one thread to another through a
+// small queue, so that both sides keep finding it full or empty
+TEST_F(BackendLockFreeTest, SpscQueueTwoThreads) {
+  const uint64_t num_of_items = 200000;
+  SpscQueue<uint64_t> queue(16);
+  std::thread producer([&]() {
+    for (uint64_t i = 1; i <= num_of_items; ++i) {
+      while (!queue.Push(i)) {
+        std::this_thread::yield();
+      }
+    }
+  });
+
+  uint64_t expected = 1;
+  uint64_t item;
+  while (expected <= num_of_items) {
+    if (!queue.Pop(&item)) {
+      std::this_thread::yield();
+      continue;
+    }
+    ASSERT_EQ(expected, item);
+    ++expected;
+  }
+  producer.join();
+  EXPECT_TRUE(queue.Empty());
+}
+
+// This fixture runs every test against each storage engine, so an engine
+// is only added once it behaves like the others
+class StorageEngineTest
+    : public BackendTest,
+      public ::testing::WithParamInterface<ShardStorage::Modes> {
+ protected:
+  void SetUp() override {
+    BackendTest::SetUp();
+    RemoveDirectory(kLsmDirectory);
+    ShardStorage::Options options(GetParam());
+    options.directory = kLsmDirectory;
+    // Small enough for the LSM storage to flush and compact during a test
+    options.memtable_size = 16 << 10;
+    data.reset(new BackendDataStructure(4, options));
+    ASSERT_TRUE(data->OpenStorage());
+  }
+
+  void TearDown() override {
+    data.reset();
+    RemoveDirectory(kLsmDirectory);
+  }
+
+  std::unique_ptr<BackendDataStructure> data;
+};
+
+// The following test runs puts, overwrites and deletes against a
+// `std::map` and compares single-key lookups
+TEST_P(StorageEngineTest, PointOperations) {
+  EXPECT_EQ(GetParam(), data->get_storage_mode());
+  std::map<std::string, std::string> expected;
+  for (int i = 0; i < kNumOfPairsPerThread; ++i) {
+    std::string key = std::to_string(i * 7919 % kNumOfPairsPerThread);
+    std::string value(i % 300, char(i));
+    EXPECT_TRUE(data->Put(key, value));
+    expected[key] = value;
+    if (i % 3 == 0) {
+      std::string victim = std::to_string(i / 2);
+      EXPECT_EQ(expected.erase(victim) == 1, data->DeleteKey(victim));
+    }
+  }
+
+  for (int i = 0; i < kNumOfPairsPerThread; ++i) {
+    std::string key = std::to_string(i), value;
+    auto it = expected.find(key);
+    EXPECT_EQ(it != expected.end(), data->Get(key, &value));
+    if (it != expected.end()) {
+      EXPECT_EQ(it->second, value);
+    }
+  }
+  EXPECT_FALSE(data->Get("missing", nullptr));
+  EXPECT_FALSE(data->DeleteKey("missing"));
+}
+
+// The following test puts, gets and deletes the keys in batches
+TEST_P(StorageEngineTest, Batches) {
+  EXPECT_TRUE(data->MultiPut(keys, correct_values_full));
+  std::vector<std::string> output_values;
+  EXPECT_TRUE(data->MultiGet(keys, &output_values));
+  EXPECT_EQ(correct_values_full, output_values);
+
+  size_t num_of_deleted;
+  EXPECT_TRUE(data->MultiDelete(keys_to_be_deleted, &num_of_deleted));
+  EXPECT_EQ(keys_to_be_deleted.size(), num_of_deleted);
+  EXPECT_TRUE(data->MultiDelete(keys_to_be_deleted, &num_of_deleted));
+  EXPECT_EQ(0, num_of_deleted);
+
+  output_values.clear();
+  EXPECT_FALSE(data->MultiGet(keys, &output_values));
+  EXPECT_EQ(correct_values_after_delete, output_values);
+
+  std::vector<std::pair<std::string, std::string>> found;
+  data->MultiGetFound(keys, &found);
+  EXPECT_EQ(keys.size() - keys_to_be_deleted.size(), found.size());
+  for (const auto& pair : found) {
+    auto it = std::find(keys.begin(), keys.end(), pair.first);
+    ASSERT_NE(keys.end(), it);
+    EXPECT_EQ(correct_values_full[it - keys.begin()], pair.second);
+  }
+}
+
+// The following test scans ranges with and without limits, with deleted
+// keys in them
+TEST_P(StorageEngineTest, Scans) {
+  std::vector<std::string> sorted_keys;
+  for (int i = 0; i < kNumOfPairsPerThread; ++i) {
+    std::string key = std::to_string(i);
+    EXPECT_TRUE(data->Put(key, "value"));
+    if (i % 4 == 0) {
+      EXPECT_TRUE(data->DeleteKey(key));
+    } else {
+      sorted_keys.push_back(key);
+    }
+  }
+  std::sort(sorted_keys.begin(), sorted_keys.end());
+
+  std::vector<std::string> output_keys;
+  data->ScanKeys("", "", 0, &output_keys);
+  EXPECT_EQ(sorted_keys, output_keys);
+
+  const std::vector<std::pair<std::string, std::string>> ranges = {
+      {"", "2"}, {"5", "6"}, {"55", ""}, {"7", "7"}, {"a", ""}};
+  for (const auto& range : ranges) {
+    for (size_t limit : {0, 1, 20}) {
+      auto begin = std::lower_bound(sorted_keys.begin(), sorted_keys.end(),
+                                    range.first);
+      auto end = range.second.empty()
+                     ? sorted_keys.end()
+                     : std::lower_bound(begin, sorted_keys.end(),
+                                        std::max(range.first, range.second));
+      if (limit > 0 && end - begin > static_cast<ptrdiff_t>(limit)) {
+        end = begin + limit;
+      }
+      output_keys.clear();
+      data->ScanKeys(range.first, range.second, limit, &output_keys);
+      EXPECT_EQ(std::vector<std::string>(begin, end), output_keys)
+          << "[" << range.first << ", " << range.second << ") limit "
+          << limit;
+    }
+  }
+}
+
+// The following test runs the read-modify-write operations
+TEST_P(StorageEngineTest, AtomicOperations) {
+  uint64_t previous;
+  EXPECT_TRUE(data->FetchAdd("counter", 5, &previous));
+  EXPECT_EQ(0, previous);
+  EXPECT_TRUE(data->FetchAdd("counter", 1, &previous));
+  EXPECT_EQ(5, previous);
+
+  bool swapped;
+  std::string actual;
+  EXPECT_TRUE(data->CompareAndSwap("cas", "", "first", &swapped, &actual));
+  EXPECT_TRUE(swapped);
+  EXPECT_TRUE(data->CompareAndSwap("cas", "", "second", &swapped, &actual));
+  EXPECT_FALSE(swapped);
+  EXPECT_EQ("first", actual);
+
+  bool changed;
+  EXPECT_TRUE(data->Update("cas",
+                           [](std::string* value) {
+                             value->append("!");
+                             return BackendDataStructure::CHANGED;
+                           },
+                           &changed));
+  EXPECT_TRUE(changed);
+  std::string value;
+  EXPECT_TRUE(data->Get("cas", &value));
+  EXPECT_EQ("first!", value);
+}
+
+// The following test checks that the memory accounted per prefix adds up to
+// the bytes used, and that deleting every pair gives all of it back
+TEST_P(StorageEngineTest, Stats) {
+  for (int i = 0; i < kNumOfPairsPerThread; ++i) {
+    std::string suffix = std::to_string(i);
+    EXPECT_TRUE(data->Put("user" + suffix, suffix));
+    EXPECT_TRUE(data->Put("chrp" + suffix, std::string(i % 100, 'x')));
+  }
+  std::map<std::string, BackendDataStructure::PrefixUsage> usage;
+  data->GetMemoryUsage(&usage);
+  ASSERT_EQ(2, usage.size());
+  EXPECT_EQ(kNumOfPairsPerThread, usage["user"].num_of_keys);
+  EXPECT_EQ(kNumOfPairsPerThread, usage["chrp"].num_of_keys);
+  EXPECT_EQ(usage["user"].bytes + usage["chrp"].bytes, data->get_bytes_used());
+
+  for (int i = 0; i < kNumOfPairsPerThread; ++i) {
+    std::string suffix = std::to_string(i);
+    EXPECT_TRUE(data->DeleteKey("user" + suffix));
+    EXPECT_TRUE(data->DeleteKey("chrp" + suffix));
+  }
+  usage.clear();
+  data->GetMemoryUsage(&usage);
+  EXPECT_TRUE(usage.empty());
+  EXPECT_EQ(0, data->get_bytes_used());
+}
+
+// The following test measures the throughput of every engine on the same
+// puts, gets and scans, in the shape of the service's keys
+TEST_P(StorageEngineTest, Benchmark) {
+  const int num_of_operations = 50000;
+  const int num_of_scans = 100;
+  std::vector<std::string> bench_keys;
+  for (int i = 0; i < num_of_operations; ++i) {
+    bench_keys.push_back("chrp" + std::to_string(10000000 + i * 7919 %
+                                                              num_of_operations));
+  }
+  auto ops_per_second = [](int num_of_ops,
+                           std::chrono::steady_clock::time_point begin) {
+    std::chrono::duration<double> elapsed =
+        std::chrono::steady_clock::now() - begin;
+    return static_cast<uint64_t>(num_of_ops / elapsed.count());
+  };
+
+  auto begin = std::chrono::steady_clock::now();
+  for (const std::string& key : bench_keys) {
+    EXPECT_TRUE(data->Put(key, key));
+  }
+  uint64_t puts = ops_per_second(num_of_operations, begin);
+
+  begin = std::chrono::steady_clock::now();
+  std::string value;
+  for (const std::string& key : bench_keys) {
+    EXPECT_TRUE(data->Get(key, &value));
+  }
+  uint64_t gets = ops_per_second(num_of_operations, begin);
+
+  begin = std::chrono::steady_clock::now();
+  std::vector<std::string> output_keys;
+  for (int i = 0; i < num_of_scans; ++i) {
+    output_keys.clear();
+    data->ScanKeys("chrp" + std::to_string(10000000 + i * 100), "", 100,
+                   &output_keys);
+    EXPECT_EQ(100, output_keys.size());
+  }
+  uint64_t scans = ops_per_second(num_of_scans, begin);
+
+  std::cout << ShardStorage::ModeName(GetParam()) << ": " << puts
+            << " puts/s, " << gets << " gets/s, " << scans
+            << " scans of 100 keys/s, " << data->get_bytes_used()
+            << " bytes used" << std::endl;
+}
+
+INSTANTIATE_TEST_SUITE_P(
+    EveryEngine, StorageEngineTest,
+    ::testing::Values(ShardStorage::HEAP, ShardStorage::ARENA,
+                      ShardStorage::LSM, ShardStorage::ORDERED,
+                      ShardStorage::SWISS),
+    [](const ::testing::TestParamInfo<ShardStorage::Modes>& info) {
+      return std::string(ShardStorage::ModeName(info.param));
+    });
+
+// This fixture starts every test with no write-ahead log on disk
+class BackendWriteAheadLogTest : public BackendTest {
+ protected:
+  void SetUp() override {
+    BackendTest::SetUp();
+    TearDown();
+  }
+
+  void TearDown() override {
+    std::remove(kWriteAheadLogPath);
+    std::remove(kOldWriteAheadLogPath);
+    std::remove(kSnapshotPath);
+    RemoveDirectory(kLsmDirectory);
+  }
+
+  // returns LSM storage options with memtables small enough to be flushed
+  // and compacted many times by a test
+  ShardStorage::Options LsmOptions() {
+    ShardStorage::Options options(ShardStorage::LSM);
+    options.directory = kLsmDirectory;
+    options.memtable_size = 4 << 10;
+    return options;
+  }
+
+  // Reads the whole log and replays it into `output`
+  // returns the number of records read
+  size_t Recover(BackendDataStructure* output) {
+    std::vector<WriteAheadLog::Record> records;
+    uint64_t valid_length;
+    EXPECT_TRUE(WriteAheadLog::ReadRecords(
+        kWriteAheadLogPath, kNumOfRecoveryThreads, &records, &valid_length));
+    output->Replay(records, kNumOfRecoveryThreads);
+    return records.size();
+  }
+};
+
+// The following test writes through the log in every durability mode, then
+// replays the log into a new data structure. Both should hold the same data.
+TEST_F(BackendWriteAheadLogTest, ReplayEveryDurabilityMode) {
+  for (auto mode : {WriteAheadLog::NONE, WriteAheadLog::BATCH,
+                    WriteAheadLog::SYNC}) {
+    std::remove(kWriteAheadLogPath);
+    {
+      WriteAheadLog log(kWriteAheadLogPath, mode);
+      ASSERT_TRUE(log.Open(0, 0));
+      BackendDataStructure logged;
+      logged.SetWriteAheadLog(&log);
+
+      // Overwrite every key once so that the order of the records matters
+      for (int i = 0; i < kNumOfPairs; ++i) {
+        EXPECT_TRUE(logged.Put(keys[i], correct_values_after_delete[i]));
+        EXPECT_TRUE(logged.Put(keys[i], correct_values_full[i]));
+      }
+      for (const std::string& key : keys_to_be_deleted) {
+        EXPECT_TRUE(logged.DeleteKey(key));
+        // Failed deletes are not logged
+        EXPECT_FALSE(logged.DeleteKey(key));
+      }
+      EXPECT_EQ(uint64_t(2 * kNumOfPairs + keys_to_be_deleted.size()),
+                log.get_last_lsn());
+    }
+
+    BackendDataStructure recovered;
+    EXPECT_EQ(2 * kNumOfPairs + keys_to_be_deleted.size(),
+              Recover(&recovered));
+    std::vector<std::string> output_values;
+    recovered.MultiGet(keys, &output_values);
+    EXPECT_EQ(correct_values_after_delete, output_values);
+  }
+}
+
+// The following test makes the log file unable to grow, so the next write
+// fails to be logged. That write is still seen, but every write after it is
+// turned down.
+TEST_F(BackendWriteAheadLogTest, FailedLogTurnsDownWrites) {
+  std::remove(kWriteAheadLogPath);
+  WriteAheadLog log(kWriteAheadLogPath, WriteAheadLog::SYNC);
+  ASSERT_TRUE(log.Open(0, 0));
+  BackendDataStructure logged;
+  logged.SetWriteAheadLog(&log);
+  EXPECT_TRUE(logged.Put(keys[0], correct_values_full[0]));
+  EXPECT_FALSE(logged.IsReadOnly());
+
+  // Writes past the current size of the file fail with EFBIG
+  struct stat file;
+  ASSERT_EQ(0, stat(kWriteAheadLogPath, &file));
+  struct rlimit old_limit;
+  ASSERT_EQ(0, getrlimit(RLIMIT_FSIZE, &old_limit));
+  struct rlimit limit = old_limit;
+  limit.rlim_cur = file.st_size;
+  signal(SIGXFSZ, SIG_IGN);
+  ASSERT_EQ(0, setrlimit(RLIMIT_FSIZE, &limit));
+
+  EXPECT_FALSE(logged.Put(keys[1], correct_values_full[1]));
+  ASSERT_EQ(0, setrlimit(RLIMIT_FSIZE, &old_limit));
+  signal(SIGXFSZ, SIG_DFL);
+  EXPECT_TRUE(log.has_failed());
+  EXPECT_TRUE(logged.IsReadOnly());
+
+  // The value was applied before the log failed, and is lost on a restart
+  std::string value;
+  EXPECT_TRUE(logged.Get(keys[1], &value));
+  EXPECT_EQ(correct_values_full[1], value);
+
+  uint64_t previous;
+  bool swapped;
+  bool changed;
+  bool applied;
+  size_t num_of_deleted;
+  EXPECT_FALSE(logged.Put(keys[2], correct_values_full[2]));
+  EXPECT_FALSE(logged.DeleteKey(keys[0]));
+  EXPECT_FALSE(logged.MultiPut({keys[2]}, {correct_values_full[2]}));
+  EXPECT_FALSE(logged.MultiDelete({keys[0]}, &num_of_deleted));
+  EXPECT_FALSE(logged.FetchAdd(keys[3], 1, &previous));
+  EXPECT_FALSE(logged.CompareAndSwap(keys[0], correct_values_full[0],
+                                     correct_values_full[2], &swapped,
+                                     nullptr));
+  EXPECT_FALSE(swapped);
+  EXPECT_FALSE(logged.Update(
+      keys[0],
+      [](std::string* value) {
+        value->append("x");
+        return BackendDataStructure::CHANGED;
+      },
+      &changed));
+  EXPECT_FALSE(logged.ApplyBatch(
+      {}, {BackendDataStructure::BatchWrite{
+              BackendDataStructure::BatchWrite::DELETE, keys[0]}},
+      &applied, nullptr, nullptr));
+  EXPECT_FALSE(applied);
+
+  EXPECT_TRUE(logged.Get(keys[0], &value));
+  EXPECT_EQ(correct_values_full[0], value);
+  EXPECT_FALSE(logged.Get(keys[2], &value));
+  EXPECT_FALSE(logged.Get(keys[3], &value));
+}
+
+// The following test appends garbage to the log as a crash in the middle of
+// a write would. Reading stops at the garbage, and reopening the log cuts it
+// off so that the records appended afterwards can be read again.
+TEST_F(BackendWriteAheadLogTest, TornTail) {
+  {
+    WriteAheadLog log(kWriteAheadLogPath, WriteAheadLog::SYNC);
+    ASSERT_TRUE(log.Open(0, 0));
+    BackendDataStructure logged;
+    logged.SetWriteAheadLog(&log);
+    for (int i = 0; i < kNumOfPairs; ++i) {
+      EXPECT_TRUE(logged.Put(keys[i], correct_values_full[i]));
+    }
+  }
+  {
+    std::ofstream file(kWriteAheadLogPath, std::ios::app | std::ios::binary);
+    file << "torn record";
+  }
+
+  std::vector<WriteAheadLog::Record> records;
+  uint64_t valid_length;
+  ASSERT_TRUE(WriteAheadLog::ReadRecords(
+      kWriteAheadLogPath, kNumOfRecoveryThreads, &records, &valid_length));
+  ASSERT_EQ(size_t(kNumOfPairs), records.size());
+
+  {
+    WriteAheadLog log(kWriteAheadLogPath, WriteAheadLog::SYNC);
+    ASSERT_TRUE(log.Open(valid_length, records.back().lsn));
+    BackendDataStructure logged;
+    logged.SetWriteAheadLog(&log);
+    for (const std::string& key : keys_to_be_deleted) {
+      EXPECT_TRUE(logged.Put(key, std::string()));
+    }
+  }
+
+  records.clear();
+  ASSERT_TRUE(WriteAheadLog::ReadRecords(
+      kWriteAheadLogPath, kNumOfRecoveryThreads, &records, &valid_length));
+  ASSERT_EQ(kNumOfPairs + keys_to_be_deleted.size(), records.size());
+  // LSNs keep increasing across reopening
+  for (size_t i = 0; i < records.size(); ++i) {
+    EXPECT_EQ(uint64_t(i + 1), records[i].lsn);
+  }
+}
+
+// The following test cuts the last record of a write batch off the log, as a
+// crash in the middle of writing it would. The whole batch is dropped.
+TEST_F(BackendWriteAheadLogTest, BatchCutShort) {
+  typedef BackendDataStructure::BatchWrite BatchWrite;
+  uint64_t length_before_batch;
+  {
+    WriteAheadLog log(kWriteAheadLogPath, WriteAheadLog::SYNC);
+    ASSERT_TRUE(log.Open(0, 0));
+    BackendDataStructure logged(4);
+    logged.SetWriteAheadLog(&log);
+    EXPECT_TRUE(logged.Put(keys[0], correct_values_full[0]));
+    struct stat file_stat;
+    ASSERT_EQ(0, stat(kWriteAheadLogPath, &file_stat));
+    length_before_batch = file_stat.st_size;
+
+    bool applied;
+    EXPECT_TRUE(logged.ApplyBatch(
+        {}, {BatchWrite{BatchWrite::DELETE, keys[0], "", nullptr},
+             BatchWrite{BatchWrite::PUT, keys[1], correct_values_full[1],
+                        nullptr},
+             BatchWrite{BatchWrite::PUT, keys[2], correct_values_full[2],
+                        nullptr}},
+        &applied, nullptr, nullptr));
+    EXPECT_TRUE(applied);
+  }
+
+  std::vector<WriteAheadLog::Record> records;
+  uint64_t valid_length;
+  ASSERT_TRUE(WriteAheadLog::ReadRecords(
+      kWriteAheadLogPath, kNumOfRecoveryThreads, &records, &valid_length));
+  ASSERT_EQ(4, records.size());
+  EXPECT_EQ(WriteAheadLog::DELETE_KEY, records[1].operation);
+  EXPECT_EQ(WriteAheadLog::PUT, records[3].operation);
+
+  ASSERT_EQ(0, truncate(kWriteAheadLogPath, valid_length - 1));
+  records.clear();
+  ASSERT_TRUE(WriteAheadLog::ReadRecords(
+      kWriteAheadLogPath, kNumOfRecoveryThreads, &records, &valid_length));
+  ASSERT_EQ(1, records.size());
+  EXPECT_EQ(length_before_batch, valid_length);
+  BackendDataStructure recovered;
+  recovered.Replay(records, 1);
+  std::vector<std::string> output_values;
+  recovered.MultiGet({keys[0], keys[1]}, &output_values);
+  EXPECT_EQ(std::vector<std::string>({correct_values_full[0], ""}),
+            output_values);
+}
+
+// The following test puts from multiple threads with batched fsyncs.
+// Every acknowledged put should be in the log.
+TEST_F(BackendWriteAheadLogTest, ConcurrentGroupCommit) {
+  {
+    WriteAheadLog log(kWriteAheadLogPath, WriteAheadLog::BATCH);
+    ASSERT_TRUE(log.Open(0, 0));
+    BackendDataStructure logged;
+    logged.SetWriteAheadLog(&log);
+
+    std::vector<std::thread> threads;
+    for (int t = 0; t < kNumOfThreads; ++t) {
+      threads.emplace_back([&logged, t]() {
+        for (int i = 0; i < kNumOfPairs; ++i) {
+          std::string key = std::to_string(t) + "-" + std::to_string(i);
+          EXPECT_TRUE(logged.Put(key, key));
+        }
+      });
+    }
+    for (auto& thread : threads) {
+      thread.join();
+    }
+  }
+
+  BackendDataStructure recovered;
+  EXPECT_EQ(size_t(kNumOfThreads * kNumOfPairs), Recover(&recovered));
+  for (int t = 0; t < kNumOfThreads; ++t) {
+    for (int i = 0; i < kNumOfPairs; ++i) {
+      std::string key = std::to_string(t) + "-" + std::to_string(i);
+      std::string value;
+      EXPECT_TRUE(recovered.Get(key, &value));
+      EXPECT_EQ(key, value);
+    }
+  }
+}
+
+// The following test defers the wait for the log of a few writes. They are
+// applied at once, and the LSN they leave covers all of their records.
+TEST_F(BackendWriteAheadLogTest, DeferredDurability) {
+  WriteAheadLog log(kWriteAheadLogPath, WriteAheadLog::BATCH);
+  ASSERT_TRUE(log.Open(0, 0));
+  BackendDataStructure logged;
+  logged.SetWriteAheadLog(&log);
+
+  uint64_t lsn;
+  {
+    BackendDataStructure::DeferredDurability deferred;
+    EXPECT_EQ(0, deferred.get_lsn());
+    EXPECT_TRUE(logged.Put(keys[0], correct_values_full[0]));
+    EXPECT_TRUE(logged.MultiPut({keys[1], keys[2]},
+                                {correct_values_full[1], correct_values_full[2]}));
+    EXPECT_TRUE(logged.DeleteKey(keys[0]));
+    lsn = deferred.get_lsn();
+  }
+  EXPECT_EQ(4, lsn);
+  std::string value;
+  EXPECT_FALSE(logged.Get(keys[0], &value));
+  EXPECT_TRUE(logged.Get(keys[2], &value));
+  EXPECT_TRUE(log.WaitForDurable(lsn));
+
+  // Out of the scope, a write waits for its own record again
+  EXPECT_TRUE(logged.Put(keys[3], correct_values_full[3]));
+  std::vector<WriteAheadLog::Record> records;
+  uint64_t valid_length;
+  EXPECT_TRUE(WriteAheadLog::ReadRecords(kWriteAheadLogPath, 1, &records,
+                                         &valid_length));
+  EXPECT_EQ(5U, records.size());
+}
+
+// The following test writes from several clients at once to the asynchronous
+// server with a log. Its poller does not wait for the log, yet every write
+// should be in the log file by the time its reply comes back.
+TEST_F(BackendWriteAheadLogTest, AsyncServerRepliesOnceDurable) {
+  KeyValueStoreImpl service;
+  ASSERT_TRUE(service.EnableWriteAheadLog(
+      kWriteAheadLogPath, WriteAheadLog::BATCH, kNumOfRecoveryThreads));
+  AsyncKeyValueStoreServer server(&service, 1);
+  ASSERT_TRUE(server.Start(std::string("0.0.0.0:") + kInProcessAsyncPort));
+
+  std::vector<std::thread> threads;
+  for (int t = 0; t < kNumOfThreads; ++t) {
+    threads.emplace_back([t]() {
+      BackendClientStandard client(kInProcessHost, kInProcessAsyncPort);
+      for (int i = 0; i < kNumOfPairs; ++i) {
+        std::string key = std::to_string(t) + "-" + std::to_string(i);
+        EXPECT_TRUE(client.SendPutRequest(key, key));
+        uint64_t previous;
+        EXPECT_TRUE(client.SendFetchAddRequest("counter", 1, &previous));
+      }
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+
+  std::vector<WriteAheadLog::Record> records;
+  uint64_t valid_length;
+  EXPECT_TRUE(WriteAheadLog::ReadRecords(kWriteAheadLogPath, 1, &records,
+                                         &valid_length));
+  EXPECT_EQ(size_t(2 * kNumOfThreads * kNumOfPairs), records.size());
+  server.Shutdown();
+}
+
+// The following test writes a snapshot and loads it back with several
+// threads. A missing snapshot is loaded as an empty one.
+TEST_F(BackendWriteAheadLogTest, SnapshotWriteAndLoad) {
+  const uint64_t lsn = 42;
+  BackendDataStructure loaded;
+  uint64_t loaded_lsn = lsn;
+  EXPECT_TRUE(BackendSnapshot::Load(kSnapshotPath, kNumOfRecoveryThreads,
+                                    &loaded, &loaded_lsn));
+  EXPECT_EQ(uint64_t(0), loaded_lsn);
+
+  for (int i = 0; i < kNumOfPairs; ++i) {
+    EXPECT_TRUE(backend_data_structure.Put(keys[i], correct_values_full[i]));
+  }
+  ASSERT_TRUE(
+      BackendSnapshot::Write(kSnapshotPath, lsn, &backend_data_structure));
+
+  EXPECT_TRUE(BackendSnapshot::Load(kSnapshotPath, kNumOfRecoveryThreads,
+                                    &loaded, &loaded_lsn));
+  EXPECT_EQ(lsn, loaded_lsn);
+  std::vector<std::string> output_values;
+  EXPECT_TRUE(loaded.MultiGet(keys, &output_values));
+  EXPECT_EQ(correct_values_full, output_values);
+}
+
+// The following test takes a snapshot in the middle of the writes, then
+// restarts. The snapshot plus the log records after it should give back the
+// latest data, and the records covered by the snapshot should be dropped.
+TEST_F(BackendWriteAheadLogTest, RestartFromSnapshotAndLogTail) {
+  {
+    KeyValueStoreImpl service;
+    ASSERT_TRUE(service.EnableWriteAheadLog(
+        kWriteAheadLogPath, WriteAheadLog::BATCH, kNumOfRecoveryThreads,
+        kSnapshotPath));
+    BackendDataStructure* data = service.get_backend_data();
+    for (int i = 0; i < kNumOfPairs; ++i) {
+      EXPECT_TRUE(data->Put(keys[i], correct_values_after_delete[i]));
+    }
+
+    // Keep writing while the snapshot is taken
+    std::thread writer([data, this]() {
+      for (int i = 0; i < kNumOfPairs; ++i) {
+        EXPECT_TRUE(data->Put(keys[i], correct_values_full[i]));
+      }
+    });
+    EXPECT_TRUE(service.TakeSnapshot());
+    writer.join();
+
+    for (const std::string& key : keys_to_be_deleted) {
+      EXPECT_TRUE(data->DeleteKey(key));
+    }
+  }
+
+  // The records before the snapshot are gone from the log
+  std::vector<WriteAheadLog::Record> records;
+  uint64_t valid_length;
+  ASSERT_TRUE(WriteAheadLog::ReadRecords(
+      kWriteAheadLogPath, kNumOfRecoveryThreads, &records, &valid_length));
+  EXPECT_GE(size_t(kNumOfPairs + keys_to_be_deleted.size()), records.size());
+  EXPECT_LE(keys_to_be_deleted.size(), records.size());
+  EXPECT_EQ(0, access(kSnapshotPath, F_OK));
+  EXPECT_NE(0, access(kOldWriteAheadLogPath, F_OK));
+
+  KeyValueStoreImpl restarted;
+  ASSERT_TRUE(restarted.EnableWriteAheadLog(
+      kWriteAheadLogPath, WriteAheadLog::BATCH, kNumOfRecoveryThreads,
+      kSnapshotPath));
+  std::vector<std::string> output_values;
+  restarted.get_backend_data()->MultiGet(keys, &output_values);
+  EXPECT_EQ(correct_values_after_delete, output_values);
+
+  // New records continue after the old LSNs
+  EXPECT_TRUE(restarted.get_backend_data()->Put(keys[0], keys[0]));
+}
+
+// The following test restarts from a snapshot with pairs put with a time to
+// live. The deadlines are logged again after the snapshot, so they still
+// hold after the restart.
+TEST_F(BackendWriteAheadLogTest, TimeToLiveAcrossRestart) {
+  {
+    KeyValueStoreImpl service;
+    ASSERT_TRUE(service.EnableWriteAheadLog(
+        kWriteAheadLogPath, WriteAheadLog::BATCH, kNumOfRecoveryThreads,
+        kSnapshotPath));
+    BackendDataStructure* data = service.get_backend_data();
+    EXPECT_TRUE(data->Put("short", "value", 100));
+    EXPECT_TRUE(data->Put("long", "value", 3600 * 1000));
+    EXPECT_TRUE(data->Put("permanent", "value"));
+    EXPECT_TRUE(service.TakeSnapshot());
+  }
+
+  KeyValueStoreImpl restarted;
+  ASSERT_TRUE(restarted.EnableWriteAheadLog(
+      kWriteAheadLogPath, WriteAheadLog::BATCH, kNumOfRecoveryThreads,
+      kSnapshotPath));
+  BackendDataStructure* data = restarted.get_backend_data();
+  EXPECT_EQ(2, data->get_num_of_expiring_keys());
+
+  restarted.StartExpiringKeys(std::chrono::milliseconds(10));
+  std::this_thread::sleep_for(std::chrono::milliseconds(150));
+  std::string value;
+  EXPECT_FALSE(data->Get("short", &value));
+  EXPECT_TRUE(data->Get("long", &value));
+  EXPECT_TRUE(data->Get("permanent", &value));
+  auto deadline = std::chrono::steady_clock::now() + kBlockedTimeout;
+  while (data->get_num_of_expiring_keys() > 1 &&
+         std::chrono::steady_clock::now() < deadline) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+  }
+  EXPECT_EQ(1, data->get_num_of_expiring_keys());
+}
+
+// The following test writes enough to one LSM shard to flush many runs.
+// Compactions should keep the number of runs bounded and drop the deleted
+// pairs.
+TEST_F(BackendWriteAheadLogTest, LsmFlushAndCompaction) {
+  LsmShardStorage storage(kLsmDirectory, 0, 1 << 10);
+  ASSERT_TRUE(storage.Open());
+  std::map<std::string, std::string> expected;
+  for (int i = 0; i < kNumOfPairsPerThread; ++i) {
+    std::string key = std::to_string(i % 300);
+    if (i % 5 == 4) {
+      EXPECT_EQ(expected.erase(key) == 1, storage.Erase(key) > 0);
+    } else {
+      std::string value(i % 50, char('a' + i % 26));
+      EXPECT_EQ(expected.count(key) == 1, storage.Put(key, value) > 0);
+      expected[key] = value;
+    }
+  }
+  EXPECT_EQ(expected.size(), storage.size());
+
+  storage.SealMemtable();
+  EXPECT_TRUE(storage.WaitForFlushes());
+  // Compactions run in the background
+  auto deadline = std::chrono::steady_clock::now() + kBlockedTimeout;
+  while (storage.get_num_of_runs() > LsmShardStorage::kMaxRunsPerShard &&
+         std::chrono::steady_clock::now() < deadline) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+  }
+  EXPECT_GE(LsmShardStorage::kMaxRunsPerShard, storage.get_num_of_runs());
+
+  std::map<std::string, std::string> found;
+  storage.ForEach([&found](const char* key, size_t key_size,
+                           const char* value, size_t value_size) {
+    EXPECT_TRUE(found.emplace(std::string(key, key_size),
+                              std::string(value, value_size))
+                    .second);
+  });
+  EXPECT_EQ(expected, found);
+  for (int i = 0; i < 300; ++i) {
+    std::string key = std::to_string(i), value;
+    EXPECT_EQ(expected.count(key) == 1, storage.Get(key, &value));
+    EXPECT_EQ(expected[key], value);
+  }
+}
+
+// The following test runs the data structure on the LSM storage, then
+// opens the same files again. The pairs and their accounting should come
+// back from the runs alone.
+TEST_F(BackendWriteAheadLogTest, LsmReopen) {
+  uint64_t bytes_used;
+  {
+    BackendDataStructure data(2, LsmOptions());
+    ASSERT_TRUE(data.OpenStorage());
+    EXPECT_TRUE(data.is_storage_persistent());
+    for (int i = 0; i < kNumOfPairsPerThread; ++i) {
+      EXPECT_TRUE(data.Put(std::to_string(i), std::string(100, char(i))));
+    }
+    EXPECT_TRUE(data.MultiPut(keys, correct_values_full));
+    size_t num_of_deleted;
+    EXPECT_TRUE(data.MultiDelete(keys_to_be_deleted, &num_of_deleted));
+    EXPECT_EQ(keys_to_be_deleted.size(), num_of_deleted);
+    EXPECT_TRUE(data.FlushStorage());
+    bytes_used = data.get_bytes_used();
+  }
+
+  BackendDataStructure reopened(2, LsmOptions());
+  ASSERT_TRUE(reopened.OpenStorage());
+  EXPECT_EQ(bytes_used, reopened.get_bytes_used());
+  std::vector<std::string> output_values;
+  reopened.MultiGet(keys, &output_values);
+  EXPECT_EQ(correct_values_after_delete, output_values);
+
+  std::vector<std::string> scanned;
+  reopened.ScanKeys("", "", 0, &scanned);
+  EXPECT_EQ(kNumOfPairsPerThread + kNumOfPairs - keys_to_be_deleted.size(),
+            scanned.size());
+  EXPECT_TRUE(std::is_sorted(scanned.begin(), scanned.end()));
+}
+
+// The following test checkpoints an LSM-backed service instead of taking a
+// snapshot, then restarts it from the runs and the log tail
+TEST_F(BackendWriteAheadLogTest, LsmRestartFromRunsAndLogTail) {
+  {
+    KeyValueStoreImpl service(BackendDataStructure::kDefaultNumOfShards,
+                              LsmOptions());
+    ASSERT_TRUE(service.get_backend_data()->OpenStorage());
+    ASSERT_TRUE(service.EnableWriteAheadLog(
+        kWriteAheadLogPath, WriteAheadLog::BATCH, kNumOfRecoveryThreads));
+    BackendDataStructure* data = service.get_backend_data();
+    for (int i = 0; i < kNumOfPairs; ++i) {
+      EXPECT_TRUE(data->Put(keys[i], correct_values_full[i]));
+    }
+    EXPECT_TRUE(service.TakeSnapshot());
+    for (const std::string& key : keys_to_be_deleted) {
+      EXPECT_TRUE(data->DeleteKey(key));
+    }
+  }
+
+  // Only the deletes after the checkpoint are left in the log
+  std::vector<WriteAheadLog::Record> records;
+  uint64_t valid_length;
+  ASSERT_TRUE(WriteAheadLog::ReadRecords(
+      kWriteAheadLogPath, kNumOfRecoveryThreads, &records, &valid_length));
+  EXPECT_EQ(keys_to_be_deleted.size(), records.size());
+  EXPECT_NE(0, access(kSnapshotPath, F_OK));
+
+  KeyValueStoreImpl restarted(BackendDataStructure::kDefaultNumOfShards,
+                              LsmOptions());
+  ASSERT_TRUE(restarted.get_backend_data()->OpenStorage());
+  ASSERT_TRUE(restarted.EnableWriteAheadLog(
+      kWriteAheadLogPath, WriteAheadLog::BATCH, kNumOfRecoveryThreads));
+  std::vector<std::string> output_values;
+  restarted.get_backend_data()->MultiGet(keys, &output_values);
+  EXPECT_EQ(correct_values_after_delete, output_values);
+}
+
+// This fixture runs a `KeyValueStoreImpl` inside the test process, so the
+// following tests do not need a standalone backend server.
+class BackendServerTest : public BackendTest {
+ protected:
+  void SetUp() override {
+    BackendTest::SetUp();
+
+    grpc::ServerBuilder builder;
+    builder.AddListeningPort(std::string("0.0.0.0:") + kInProcessPort,
+                             grpc::InsecureServerCredentials());
+    builder.RegisterService(&service);
+    server = builder.BuildAndStart();
+    ASSERT_NE(nullptr, server);
+
+    in_process_client.reset(
+        new BackendClientStandard(kInProcessHost, kInProcessPort));
+  }
+
+  void TearDown() override { server->Shutdown(); }
+
+  KeyValueStoreImpl service;
+  std::unique_ptr<grpc::Server> server;
+  std::unique_ptr<BackendClientStandard> in_process_client;
+};
+
+// The following test sends more keys than fit in one get request, so the
+// client splits them into batches. Values should still come back in order.
+TEST_F(BackendServerTest, ServerBatchedGet) {
+  std::vector<std::string> many_keys;
+  for (int i = 0; i < 3 * BackendClientStandard::kMaxKeysPerGetRequest + 1;
+       ++i) {
+    many_keys.push_back(std::to_string(i));
+    // Only even keys exist
+    if (i % 2 == 0) {
+      EXPECT_TRUE(in_process_client->SendPutRequest(many_keys.back(),
+                                                    many_keys.back()));
+    }
+  }
+
+  std::vector<std::string> output_values;
+  EXPECT_TRUE(in_process_client->SendGetRequest(many_keys, &output_values));
+  ASSERT_EQ(many_keys.size(), output_values.size());
+  for (size_t i = 0; i < many_keys.size(); ++i) {
+    EXPECT_EQ(i % 2 == 0 ? many_keys[i] : std::string(), output_values[i]);
+  }
+}
+
+// The following test sends small batches on several get streams at once.
+// Each reply should be sent as soon as it is written.
+TEST_F(BackendServerTest, ServerConcurrentBatchedGetStreams) {
+  GetOnConcurrentStreams(kInProcessPort);
+}
+
+// The following test gets keys at a snapshot while they are overwritten,
+// then fails to once the snapshot is released and its versions collected
+TEST_F(BackendServerTest, ServerSnapshotGet) {
+  EXPECT_TRUE(in_process_client->SendMultiPutRequest(keys, correct_values_full));
+  uint64_t snapshot;
+  EXPECT_TRUE(in_process_client->SendCreateSnapshotRequest(0, &snapshot));
+  EXPECT_TRUE(in_process_client->SendMultiDeleteRequest(keys_to_be_deleted));
+  EXPECT_TRUE(in_process_client->SendPutRequest(keys[0], "new"));
+
+  std::vector<std::string> output_values;
+  EXPECT_TRUE(
+      in_process_client->SendGetAtSnapshotRequest(snapshot, keys,
+                                                  &output_values));
+  EXPECT_EQ(correct_values_full, output_values);
+  output_values.clear();
+  EXPECT_TRUE(in_process_client->SendGetRequest(keys, &output_values));
+  EXPECT_EQ("new", output_values[0]);
+  EXPECT_EQ(correct_values_after_delete[1], output_values[1]);
+
+  EXPECT_TRUE(in_process_client->SendReleaseSnapshotRequest(snapshot));
+  EXPECT_FALSE(in_process_client->SendReleaseSnapshotRequest(snapshot));
+  service.get_backend_data()->CollectVersions();
+  EXPECT_EQ(0, service.get_backend_data()->get_num_of_versions());
+
+  // The server turns down a handle it no longer has
+  grpc::ClientContext context;
+  std::unique_ptr<chirp::KeyValueStore::Stub> stub =
+      chirp::KeyValueStore::NewStub(grpc::CreateChannel(
+          std::string(kInProcessHost) + ":" + kInProcessPort,
+          grpc::InsecureChannelCredentials()));
+  auto stream = stub->get(&context);
+  chirp::GetRequest request;
+  request.set_key(keys[0]);
+  request.set_snapshot(snapshot);
+  EXPECT_TRUE(stream->Write(request));
+  EXPECT_TRUE(stream->WritesDone());
+  chirp::GetReply reply;
+  EXPECT_FALSE(stream->Read(&reply));
+  EXPECT_EQ(grpc::FAILED_PRECONDITION, stream->Finish().error_code());
+}
+
+// The following test checks which keys exist with one exists request
+TEST_F(BackendServerTest, ServerExists) {
+  EXPECT_TRUE(in_process_client->SendMultiPutRequest(keys, correct_values_full));
+  EXPECT_TRUE(in_process_client->SendMultiDeleteRequest(keys_to_be_deleted));
+
+  std::vector<std::string> probes(keys);
+  probes.push_back("missing");
+  std::vector<bool> exists;
+  EXPECT_TRUE(in_process_client->SendExistsRequest(probes, &exists));
+  ASSERT_EQ(probes.size(), exists.size());
+  for (int i = 0; i < kNumOfPairs; ++i) {
+    EXPECT_EQ(i % 2 == 0, exists[i]);
+  }
+  EXPECT_FALSE(exists.back());
+}
+
+// The following test reports the memory per key prefix, then turns down a
+// put with RESOURCE_EXHAUSTED once the memory limit is reached
+TEST_F(BackendServerTest, ServerMemoryUsageAndLimit) {
+  EXPECT_TRUE(in_process_client->SendPutRequest("user0001", "value"));
+  EXPECT_TRUE(in_process_client->SendPutRequest("user0002", "value"));
+  EXPECT_TRUE(in_process_client->SendPutRequest("chrp0001", "value"));
+
+  grpc::ServerContext context;
+  chirp::MemoryUsageRequest usage_request;
+  chirp::MemoryUsageReply usage_reply;
+  ASSERT_TRUE(
+      service.memory_usage(&context, &usage_request, &usage_reply).ok());
+  ASSERT_EQ(2, usage_reply.prefixes_size());
+  EXPECT_EQ("chrp", usage_reply.prefixes(0).prefix());
+  EXPECT_EQ(1, usage_reply.prefixes(0).num_of_keys());
+  EXPECT_EQ("user", usage_reply.prefixes(1).prefix());
+  EXPECT_EQ(2, usage_reply.prefixes(1).num_of_keys());
+  EXPECT_EQ(usage_reply.prefixes(0).bytes() + usage_reply.prefixes(1).bytes(),
+            usage_reply.bytes_used());
+  EXPECT_EQ(0, usage_reply.memory_limit());
+  EXPECT_EQ("heap", usage_reply.storage());
+
+  service.get_backend_data()->set_memory_limit(usage_reply.bytes_used());
+  chirp::PutRequest put_request;
+  put_request.set_key("user0003");
+  chirp::PutReply put_reply;
+  EXPECT_EQ(grpc::RESOURCE_EXHAUSTED,
+            service.put(&context, &put_request, &put_reply).error_code());
+  EXPECT_FALSE(in_process_client->SendPutRequest("user0003", "value"));
+
+  // A delete makes room for the put
+  EXPECT_TRUE(in_process_client->SendDeleteKeyRequest("user0001"));
+  EXPECT_TRUE(in_process_client->SendPutRequest("user0003", "value"));
+}
+
+// The following test counts the requests of each operation in the stats, then
+// dumps the stats to a file on a timer
+TEST_F(BackendServerTest, ServerStats) {
+  const int kNumOfPuts = 10;
+  for (int i = 0; i < kNumOfPuts; ++i) {
+    EXPECT_TRUE(in_process_client->SendPutRequest("user000" + std::to_string(i),
+                                                  "value"));
+  }
+  std::vector<std::string> output_values;
+  EXPECT_TRUE(in_process_client->SendGetRequest({"user0001"}, &output_values));
+  EXPECT_TRUE(in_process_client->SendDeleteKeyRequest("user0001"));
+
+  grpc::ServerContext context;
+  chirp::StatsRequest stats_request;
+  chirp::StatsReply stats_reply;
+  ASSERT_TRUE(service.stats(&context, &stats_request, &stats_reply).ok());
+  std::map<std::string, chirp::OperationStats> operations;
+  for (const chirp::OperationStats &operation : stats_reply.operations()) {
+    operations[operation.operation()] = operation;
+  }
+  // Every operation is reported, even without any request
+  ASSERT_EQ(KeyValueStoreImpl::NUM_OF_OPERATIONS, operations.size());
+  EXPECT_EQ(kNumOfPuts, operations["put"].count());
+  EXPECT_EQ(1, operations["get"].count());
+  EXPECT_EQ(1, operations["deletekey"].count());
+  EXPECT_EQ(0, operations["scan"].count());
+  EXPECT_EQ(0, operations["scan"].max_ns());
+  for (const std::string &name : {"put", "get", "deletekey"}) {
+    const chirp::OperationStats &operation = operations[name];
+    EXPECT_LE(operation.p50_ns(), operation.p99_ns());
+    EXPECT_LE(operation.p99_ns(), operation.max_ns());
+    EXPECT_GT(operation.max_ns(), 0);
+  }
+  ASSERT_EQ(1, stats_reply.prefixes_size());
+  EXPECT_EQ("user", stats_reply.prefixes(0).prefix());
+  EXPECT_EQ(kNumOfPuts - 1, stats_reply.prefixes(0).num_of_keys());
+  EXPECT_EQ(stats_reply.prefixes(0).bytes(), stats_reply.bytes_used());
+
+  const std::string kStatsPath = "./backend_test_stats.log";
+  std::remove(kStatsPath.c_str());
+  ASSERT_TRUE(
+      service.StartDumpingStats(kStatsPath, std::chrono::milliseconds(10)));
+  EXPECT_TRUE(in_process_client->SendPutRequest("user0001", "value"));
+  std::string dumped;
+  auto deadline = std::chrono::steady_clock::now() + kBlockedTimeout;
+  while (dumped.find("put: ") == std::string::npos &&
+         std::chrono::steady_clock::now() < deadline) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    std::ifstream file(kStatsPath);
+    dumped.assign(std::istreambuf_iterator<char>(file),
+                  std::istreambuf_iterator<char>());
+  }
+  EXPECT_NE(std::string::npos, dumped.find("put: "));
+  EXPECT_NE(std::string::npos, dumped.find("shard locks:"));
+  EXPECT_NE(std::string::npos, dumped.find("prefix \"user\""));
+  std::remove(kStatsPath.c_str());
+}
+
+// The following test writes and deletes through the batched RPCs
+TEST_F(BackendServerTest, ServerMultiPutAndMultiDelete) {
+  EXPECT_TRUE(in_process_client->SendMultiPutRequest(keys, correct_values_full));
+  EXPECT_TRUE(in_process_client->SendMultiDeleteRequest(keys_to_be_deleted));
+  // Deleting the same keys again finds none of them
+  EXPECT_FALSE(in_process_client->SendMultiDeleteRequest(keys_to_be_deleted));
+
+  std::vector<std::string> output_values;
+  EXPECT_TRUE(in_process_client->SendGetRequest(keys, &output_values));
+  EXPECT_EQ(correct_values_after_delete, output_values);
+}
+
+// The following test puts pairs with a ttl through the standard client and
+// the debug client. Both hide a pair once it expires, and a put without a ttl
+// keeps a pair for good.
+TEST_F(BackendServerTest, ServerPutWithTtl) {
+  BackendClientDebug debug_client;
+  for (BackendClient* client :
+       std::vector<BackendClient*>{in_process_client.get(), &debug_client}) {
+    EXPECT_TRUE(client->SendPutRequest(keys[0], correct_values_full[0], 50));
+    EXPECT_TRUE(client->SendPutRequest(keys[1], correct_values_full[1], 50));
+    EXPECT_TRUE(client->SendPutRequest(keys[1], correct_values_full[1], 0));
+    std::vector<std::string> output_values;
+    EXPECT_TRUE(client->SendGetRequest({keys[0], keys[1]}, &output_values));
+    EXPECT_EQ(std::vector<std::string>(
+                  {correct_values_full[0], correct_values_full[1]}),
+              output_values);
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    output_values.clear();
+    EXPECT_TRUE(client->SendGetRequest({keys[0], keys[1]}, &output_values));
+    EXPECT_EQ(std::vector<std::string>({"", correct_values_full[1]}),
+              output_values);
+    std::vector<bool> exists;
+    EXPECT_TRUE(client->SendExistsRequest({keys[0]}, &exists));
+    EXPECT_EQ(std::vector<bool>({false}), exists);
+  }
+}
+
+// The following test takes ids from one counter with several clients at once
+// through the fetch_add RPC, then moves the counter with compare_and_swap
+TEST_F(BackendServerTest, ServerFetchAddAndCompareAndSwap) {
+  const std::string counter_key("counter");
+  std::vector<std::future<std::vector<uint64_t>>> clients;
+  for (int t = 0; t < kNumOfThreads; ++t) {
+    clients.push_back(std::async(std::launch::async, [&counter_key]() {
+      BackendClientStandard client(kInProcessHost, kInProcessPort);
+      std::vector<uint64_t> taken;
+      for (int i = 0; i < kNumOfPairs; ++i) {
+        uint64_t previous;
+        if (client.SendFetchAddRequest(counter_key, 1, &previous)) {
+          taken.push_back(previous);
+        }
+      }
+      return taken;
+    }));
+  }
+
+  std::vector<uint64_t> all_taken;
+  for (auto& client : clients) {
+    std::vector<uint64_t> taken = client.get();
+    all_taken.insert(all_taken.end(), taken.begin(), taken.end());
+  }
+  std::sort(all_taken.begin(), all_taken.end());
+  ASSERT_EQ(size_t(kNumOfThreads * kNumOfPairs), all_taken.size());
+  for (size_t i = 0; i < all_taken.size(); ++i) {
+    EXPECT_EQ(i, all_taken[i]);
+  }
+
+  std::string actual;
+  EXPECT_FALSE(in_process_client->SendCompareAndSwapRequest(
+      counter_key, "", "reset", &actual));
+  uint64_t counter = all_taken.size();
+  EXPECT_EQ(std::string(reinterpret_cast<const char*>(&counter),
+                        sizeof(counter)),
+            actual);
+  EXPECT_TRUE(in_process_client->SendCompareAndSwapRequest(counter_key, actual,
+                                                           "reset", nullptr));
+  // The value is no longer a counter
+  EXPECT_FALSE(in_process_client->SendFetchAddRequest(counter_key, 1, nullptr));
+}
+
+// The following test scans a range that takes several chunks, then a prefix
+// with a limit
+TEST_F(BackendServerTest, ServerScan) {
+  std::vector<std::string> scan_keys;
+  std::vector<std::string> scan_values;
+  for (size_t i = 0; i < 3 * KeyValueStoreImpl::kMaxPairsPerScanChunk; ++i) {
+    scan_keys.push_back(std::string("a") + std::to_string(i));
+    scan_values.push_back(std::to_string(i));
+  }
+  EXPECT_TRUE(in_process_client->SendMultiPutRequest(scan_keys, scan_values));
+  EXPECT_TRUE(in_process_client->SendPutRequest("b", "outside"));
+
+  std::vector<std::pair<std::string, std::string>> expected;
+  for (size_t i = 0; i < scan_keys.size(); ++i) {
+    expected.emplace_back(scan_keys[i], scan_values[i]);
+  }
+  std::sort(expected.begin(), expected.end());
+
+  std::vector<std::pair<std::string, std::string>> pairs;
+  EXPECT_TRUE(in_process_client->SendScanRequest(
+      "a", BackendClient::PrefixEnd("a"), 0, &pairs));
+  EXPECT_EQ(expected, pairs);
+
+  pairs.clear();
+  EXPECT_TRUE(in_process_client->SendScanRequest(
+      "a1", BackendClient::PrefixEnd("a1"), 5, &pairs));
+  ASSERT_EQ(size_t(5), pairs.size());
+  EXPECT_EQ("a1", pairs[0].first);
+  EXPECT_EQ("a10", pairs[1].first);
+
+  EXPECT_EQ("b", BackendClient::PrefixEnd(std::string("a\xff\xff")));
+  EXPECT_EQ("", BackendClient::PrefixEnd(std::string("\xff")));
+}
+
+// The following test scans a range of several key batches, and checks that a
+// scan never holds more than one batch of keys
+TEST_F(BackendTest, ScanCollectsKeysInBatches) {
+  KeyValueStoreImpl service;
+  const size_t kNumOfKeys = 2 * KeyValueStoreImpl::kMaxKeysPerScanBatch + 7;
+  std::vector<std::string> expected;
+  for (size_t i = 0; i < kNumOfKeys; ++i) {
+    std::string key = std::to_string(i);
+    EXPECT_TRUE(service.get_backend_data()->Put(key, key));
+    expected.push_back(key);
+  }
+  std::sort(expected.begin(), expected.end());
+
+  for (uint64_t limit : {uint64_t(0), uint64_t(kNumOfKeys - 3)}) {
+    chirp::ScanRequest request;
+    request.set_limit(limit);
+    KeyValueStoreImpl::ScanCursor cursor;
+    service.StartScan(request, &cursor);
+
+    std::vector<std::string> scanned;
+    chirp::ScanReply reply;
+    while (service.NextScanChunk(&cursor, &reply)) {
+      EXPECT_GE(KeyValueStoreImpl::kMaxKeysPerScanBatch, cursor.keys.size());
+      for (const chirp::PutRequest& pair : reply.pairs()) {
+        EXPECT_EQ(pair.key(), pair.value());
+        scanned.push_back(pair.key());
+      }
+    }
+    size_t num_of_keys = limit > 0 ? limit : kNumOfKeys;
+    EXPECT_EQ(std::vector<std::string>(expected.begin(),
+                                       expected.begin() + num_of_keys),
+              scanned)
+        << "limit " << limit;
+  }
+}
+
+// The following test appends to and removes from a list-valued key through
+// the RPCs, with concurrent appends from several clients
+TEST_F(BackendServerTest, ServerListAppendAndRemove) {
+  const std::string list_key("list");
+  const uint32_t field = chirp::MultiDeleteRequest::kKeysFieldNumber;
+  std::vector<std::future<bool>> clients;
+  for (int t = 0; t < kNumOfThreads; ++t) {
+    clients.push_back(std::async(std::launch::async, [&, t]() {
+      BackendClientStandard client(kInProcessHost, kInProcessPort);
+      bool ok = true;
+      for (int i = t; i < kNumOfPairs; i += kNumOfThreads) {
+        bool changed = false;
+        ok &= client.SendListAppendRequest(list_key, field, keys[i], true,
+                                           false, &changed) &&
+              changed;
+      }
+      return ok;
+    }));
+  }
+  for (auto& client : clients) {
+    EXPECT_TRUE(client.get());
+  }
+
+  for (const std::string& key : keys_to_be_deleted) {
+    bool changed = false;
+    EXPECT_TRUE(
+        in_process_client->SendListRemoveRequest(list_key, field, key, &changed));
+    EXPECT_TRUE(changed);
+  }
+
+  std::vector<std::string> values;
+  EXPECT_TRUE(
+      in_process_client->SendGetRequest(std::vector<std::string>(1, list_key),
+                                        &values));
+  chirp::MultiDeleteRequest list;
+  ASSERT_TRUE(list.ParseFromString(values[0]));
+  std::vector<std::string> left(list.keys().begin(), list.keys().end());
+  std::vector<std::string> expected;
+  for (int i = 0; i < kNumOfPairs; i += 2) {
+    expected.push_back(keys[i]);
+  }
+  std::sort(left.begin(), left.end());
+  std::sort(expected.begin(), expected.end());
+  EXPECT_EQ(expected, left);
+
+  // A value that is not a protobuf message is rejected
+  EXPECT_TRUE(in_process_client->SendPutRequest("not a list", "\xff"));
+  EXPECT_FALSE(in_process_client->SendListAppendRequest(
+      "not a list", field, uint64_t(1), false, false, nullptr));
+
+  // A missing key is not made up when it has to exist
+  EXPECT_FALSE(in_process_client->SendListAppendRequest(
+      "missing list", field, uint64_t(1), false, true, nullptr));
+  std::vector<bool> exists;
+  EXPECT_TRUE(in_process_client->SendExistsRequest({"missing list"}, &exists));
+  EXPECT_EQ(std::vector<bool>{false}, exists);
+  bool changed = false;
+  EXPECT_TRUE(in_process_client->SendListAppendRequest(
+      list_key, field, uint64_t(1), true, true, &changed));
+  EXPECT_TRUE(changed);
+  EXPECT_TRUE(in_process_client->SendListAppendRequest(
+      list_key, field, uint64_t(1), true, true, &changed));
+  EXPECT_FALSE(changed);
+}
+
+// The following test sends write batches mixing puts, deletes and list
+// writes, with conditions on the values and on the existence of keys
+TEST_F(BackendServerTest, ServerWriteBatch) {
+  const uint32_t field = chirp::MultiDeleteRequest::kKeysFieldNumber;
+  EXPECT_TRUE(in_process_client->SendMultiPutRequest(keys, correct_values_full));
+
+  chirp::WriteBatchRequest batch;
+  chirp::BatchCondition* condition = batch.add_conditions();
+  condition->set_key(keys[0]);
+  condition->set_expected(correct_values_full[0]);
+  condition = batch.add_conditions();
+  condition->set_key("list");
+  condition->set_exists(true);
+  chirp::PutRequest* put = batch.add_writes()->mutable_put();
+  put->set_key(keys[0]);
+  put->set_value("new");
+  batch.add_writes()->mutable_delete_key()->set_key(keys[1]);
+  chirp::ListElementRequest* list = batch.add_writes()->mutable_list_append();
+  list->set_key("list");
+  list->set_field(field);
+  list->set_string_element(keys[2]);
+
+  // The list does not exist yet
+  bool applied;
+  size_t failed_condition = 0;
+  EXPECT_TRUE(in_process_client->SendWriteBatchRequest(batch, &applied,
+                                                       &failed_condition));
+  EXPECT_FALSE(applied);
+  EXPECT_EQ(1, failed_condition);
+
+  EXPECT_TRUE(in_process_client->SendPutRequest("list", ""));
+  EXPECT_TRUE(in_process_client->SendWriteBatchRequest(batch, &applied,
+                                                       &failed_condition));
+  EXPECT_TRUE(applied);
+  std::vector<std::string> output_values;
+  EXPECT_TRUE(in_process_client->SendGetRequest({keys[0], keys[1], "list"},
+                                                &output_values));
+  EXPECT_EQ("new", output_values[0]);
+  EXPECT_EQ("", output_values[1]);
+  chirp::MultiDeleteRequest list_value;
+  ASSERT_TRUE(list_value.ParseFromString(output_values[2]));
+  ASSERT_EQ(1, list_value.keys_size());
+  EXPECT_EQ(keys[2], list_value.keys(0));
+
+  // The first condition no longer holds
+  EXPECT_TRUE(in_process_client->SendWriteBatchRequest(batch, &applied,
+                                                       &failed_condition));
+  EXPECT_FALSE(applied);
+  EXPECT_EQ(0, failed_condition);
+
+  // A list write to a value that is not a protobuf message fails the batch
+  EXPECT_TRUE(in_process_client->SendPutRequest("not a list", "\xff"));
+  chirp::WriteBatchRequest invalid;
+  invalid.add_writes()->mutable_delete_key()->set_key(keys[2]);
+  list = invalid.add_writes()->mutable_list_remove();
+  list->set_key("not a list");
+  list->set_field(field);
+  list->set_uint64_element(1);
+  EXPECT_FALSE(in_process_client->SendWriteBatchRequest(invalid, &applied,
+                                                        nullptr));
+  std::vector<bool> exists;
+  EXPECT_TRUE(in_process_client->SendExistsRequest({keys[2]}, &exists));
+  EXPECT_TRUE(exists[0]);
+}
+
+// The following test keeps a get stream open, as a slow client would, and
+// checks that put and delete requests from another client still complete.
+// The open stream should see the new values as well.
+TEST_F(BackendServerTest, ServerWritersProgressDuringOpenGetStream) {
+  auto channel = grpc::CreateChannel(
+      std::string(kInProcessHost) + ":" + kInProcessPort,
+      grpc::InsecureChannelCredentials());
+  std::unique_ptr<chirp::KeyValueStore::Stub> stub(
+      chirp::KeyValueStore::NewStub(channel));
+  grpc::ClientContext context;
+  auto stream = stub->get(&context);
+
+  // The stream is open and has served one request
+  chirp::GetRequest request;
+  chirp::GetReply reply;
+  request.set_key(keys[0]);
+  ASSERT_TRUE(stream->Write(request));
+  ASSERT_TRUE(stream->Read(&reply));
+  EXPECT_EQ(std::string(), reply.value());
+
+  // Writers should not wait for the stream to finish
+  auto writers = std::async(std::launch::async, [this]() {
+    bool ok = true;
+    for (int i = 0; i < kNumOfPairs; ++i) {
+      ok &= in_process_client->SendPutRequest(keys[i], correct_values_full[i]);
+    }
+    for (const std::string& key : keys_to_be_deleted) {
+      ok &= in_process_client->SendDeleteKeyRequest(key);
+    }
+    return ok;
+  });
+  ASSERT_EQ(std::future_status::ready, writers.wait_for(kBlockedTimeout));
+  EXPECT_TRUE(writers.get());
+
+  // The same stream is still usable and sees the writes
+  for (int i = 0; i < kNumOfPairs; ++i) {
+    request.set_key(keys[i]);
+    ASSERT_TRUE(stream->Write(request));
+    ASSERT_TRUE(stream->Read(&reply));
+    EXPECT_EQ(correct_values_after_delete[i], reply.value());
+  }
+
+  stream->WritesDone();
+  EXPECT_TRUE(stream->Finish().ok());
+}
+
+// This fixture runs the asynchronous server inside the test process with a
+// single completion queue, so that every call is driven by one thread
+class BackendAsyncServerTest : public BackendTest {
+ protected:
+  void SetUp() override {
+    BackendTest::SetUp();
+
+    server.reset(new AsyncKeyValueStoreServer(&service, 1));
+    ASSERT_TRUE(server->Start(std::string("0.0.0.0:") + kInProcessAsyncPort));
+
+    in_process_client.reset(
+        new BackendClientStandard(kInProcessHost, kInProcessAsyncPort));
+  }
+
+  void TearDown() override { server->Shutdown(); }
+
+  KeyValueStoreImpl service;
+  std::unique_ptr<AsyncKeyValueStoreServer> server;
+  std::unique_ptr<BackendClientStandard> in_process_client;
+};
+
+// The following test does puts, batched gets and deletes through the
+// asynchronous server, the same way `ServerBatchedGet` does on the
+// synchronous one
+TEST_F(BackendAsyncServerTest, AsyncServerPutGetAndDelete) {
+  std::vector<std::string> many_keys;
+  for (int i = 0; i < 3 * BackendClientStandard::kMaxKeysPerGetRequest + 1;
+       ++i) {
+    many_keys.push_back(std::to_string(i));
+    EXPECT_TRUE(
+        in_process_client->SendPutRequest(many_keys.back(), many_keys.back()));
+  }
+  // Only even keys are left
+  for (size_t i = 1; i < many_keys.size(); i += 2) {
+    EXPECT_TRUE(in_process_client->SendDeleteKeyRequest(many_keys[i]));
+  }
+  // Deleting a missing key fails
+  EXPECT_FALSE(in_process_client->SendDeleteKeyRequest(many_keys[1]));
+
+  std::vector<std::string> output_values;
+  EXPECT_TRUE(in_process_client->SendGetRequest(many_keys, &output_values));
+  ASSERT_EQ(many_keys.size(), output_values.size());
+  for (size_t i = 0; i < many_keys.size(); ++i) {
+    EXPECT_EQ(i % 2 == 0 ? many_keys[i] : std::string(), output_values[i]);
+  }
+}
+
+// The following test sends small batches on several get streams at once to
+// the asynchronous server, whose one poller writes every reply
+TEST_F(BackendAsyncServerTest, AsyncServerConcurrentBatchedGetStreams) {
+  GetOnConcurrentStreams(kInProcessAsyncPort);
+}
+
+// The following test scans the whole keyspace through the asynchronous server
+TEST_F(BackendAsyncServerTest, AsyncServerScan) {
+  std::vector<std::string> scan_keys;
+  for (size_t i = 0; i < 2 * KeyValueStoreImpl::kMaxPairsPerScanChunk + 1;
+       ++i) {
+    scan_keys.push_back(std::to_string(i));
+  }
+  EXPECT_TRUE(in_process_client->SendMultiPutRequest(scan_keys, scan_keys));
+  std::sort(scan_keys.begin(), scan_keys.end());
+
+  std::vector<std::pair<std::string, std::string>> pairs;
+  EXPECT_TRUE(in_process_client->SendScanRequest("", "", 0, &pairs));
+  ASSERT_EQ(scan_keys.size(), pairs.size());
+  for (size_t i = 0; i < scan_keys.size(); ++i) {
+    EXPECT_EQ(scan_keys[i], pairs[i].first);
+    EXPECT_EQ(scan_keys[i], pairs[i].second);
+  }
+}
+
+// The following test keeps many get streams open at the same time. The server
+// has a single poller thread, so it can only serve them all if no call holds
+// on to a thread while its stream is open.
+TEST_F(BackendAsyncServerTest, AsyncServerManyOpenStreamsOnOneThread) {
+  const int kNumOfStreams = 32;
+  for (int i = 0; i < kNumOfPairs; ++i) {
+    EXPECT_TRUE(
+        in_process_client->SendPutRequest(keys[i], correct_values_full[i]));
+  }
+
+  auto channel = grpc::CreateChannel(
+      std::string(kInProcessHost) + ":" + kInProcessAsyncPort,
+      grpc::InsecureChannelCredentials());
+  std::unique_ptr<chirp::KeyValueStore::Stub> stub(
+      chirp::KeyValueStore::NewStub(channel));
+
+  auto readers = std::async(std::launch::async, [&]() {
+    std::vector<std::unique_ptr<grpc::ClientContext>> contexts;
+    std::vector<std::unique_ptr<
+        grpc::ClientReaderWriter<chirp::GetRequest, chirp::GetReply>>>
+        streams;
+    for (int i = 0; i < kNumOfStreams; ++i) {
+      contexts.emplace_back(new grpc::ClientContext());
+      streams.push_back(stub->get(contexts.back().get()));
+    }
+
+    // Every stream is open before any of them gets a reply
+    bool ok = true;
+    for (int round = 0; round < 2; ++round) {
+      for (int i = 0; i < kNumOfStreams; ++i) {
+        chirp::GetRequest request;
+        request.set_key(keys[i % kNumOfPairs]);
+        ok &= streams[i]->Write(request);
+      }
+      for (int i = 0; i < kNumOfStreams; ++i) {
+        chirp::GetReply reply;
+        ok &= streams[i]->Read(&reply) &&
+              reply.value() == correct_values_full[i % kNumOfPairs];
+      }
+    }
+
+    for (auto& stream : streams) {
+      stream->WritesDone();
+      ok &= stream->Finish().ok();
+    }
+    return ok;
+  });
+  ASSERT_EQ(std::future_status::ready, readers.wait_for(kBlockedTimeout));
+  EXPECT_TRUE(readers.get());
+}
+
+// The following test puts and gets values of both sides of the size from
+// which the asynchronous server shares them with its replies instead of
+// copying them, and overwrites them while their replies may still be sent
+TEST_F(BackendAsyncServerTest, AsyncServerSharedValues) {
+  const size_t shared_size = KeyValueStoreImpl::kMinSharedReplySize;
+  std::vector<std::string> value_keys;
+  std::vector<std::string> values;
+  for (size_t size : {static_cast<size_t>(0), static_cast<size_t>(1),
+                      shared_size - 1, shared_size, static_cast<size_t>(127),
+                      static_cast<size_t>(128), static_cast<size_t>(1 << 20)}) {
+    value_keys.push_back("value" + std::to_string(value_keys.size()));
+    values.push_back(std::string(size, static_cast<char>('a' + size % 26)));
+    EXPECT_TRUE(
+        in_process_client->SendPutRequest(value_keys.back(), values.back()));
+  }
+
+  for (int round = 0; round < 2; ++round) {
+    std::vector<std::string> output_values;
+    EXPECT_TRUE(in_process_client->SendGetRequest(value_keys, &output_values));
+    EXPECT_EQ(values, output_values);
+    for (size_t i = 0; i < value_keys.size(); ++i) {
+      values[i] += "!";
+      EXPECT_TRUE(in_process_client->SendPutRequest(value_keys[i], values[i]));
+    }
+  }
+}
+
+// This fixture runs the asynchronous server in shared-nothing mode with
+// several completion queues, so that most calls arrive on a queue that does
+// not own their key
+class BackendSharedNothingTest : public BackendTest {
+ protected:
+  static const size_t kNumOfQueues = 4;
+
+  void SetUp() override {
+    BackendTest::SetUp();
+
+    server.reset(new AsyncKeyValueStoreServer(&service, kNumOfQueues, true));
+    ASSERT_TRUE(
+        server->Start(std::string("0.0.0.0:") + kInProcessSharedNothingPort));
+  }
+
+  void TearDown() override { server->Shutdown(); }
+
+  KeyValueStoreImpl service;
+  std::unique_ptr<AsyncKeyValueStoreServer> server;
+};
+
+const size_t BackendSharedNothingTest::kNumOfQueues;
+
+// The following test runs every single-key operation from several clients at
+// once, and checks the results against the data structure
+TEST_F(BackendSharedNothingTest, SharedNothingServerOperations) {
+  const int kNumOfClients = 4;
+  const int kNumOfKeysPerClient = 200;
+  auto run_client = [&](int c) {
+    BackendClientStandard client(kInProcessHost, kInProcessSharedNothingPort);
+    auto stub = chirp::KeyValueStore::NewStub(grpc::CreateChannel(
+        std::string(kInProcessHost) + ":" + kInProcessSharedNothingPort,
+        grpc::InsecureChannelCredentials()));
+    grpc::ClientContext context;
+    auto stream = stub->get(&context);
+
+    bool ok = true;
+    for (int i = 0; i < kNumOfKeysPerClient; ++i) {
+      std::string key = std::to_string(c) + "-" + std::to_string(i);
+      ok &= client.SendPutRequest(key, key);
+      uint64_t previous;
+      ok &= client.SendFetchAddRequest("counter-" + std::to_string(i % 8), 1,
+                                       &previous);
+      std::string actual;
+      ok &= client.SendCompareAndSwapRequest(key, key, key + "!", &actual);
+
+      // A single key in a get stream is looked up by its owner
+      chirp::GetRequest request;
+      request.set_key(key);
+      chirp::GetReply reply;
+      ok &= stream->Write(request) && stream->Read(&reply) &&
+            reply.value() == key + "!";
+      if (i % 2 == 1) {
+        ok &= client.SendDeleteKeyRequest(key);
+      }
+    }
+    stream->WritesDone();
+    ok &= stream->Finish().ok();
+    return ok;
+  };
+
+  std::vector<std::future<bool>> clients;
+  for (int c = 0; c < kNumOfClients; ++c) {
+    clients.push_back(std::async(std::launch::async, run_client, c));
+  }
+  for (auto& client : clients) {
+    EXPECT_TRUE(client.get());
+  }
+
+  BackendDataStructure* data = service.get_backend_data();
+  std::string value;
+  for (int c = 0; c < kNumOfClients; ++c) {
+    for (int i = 0; i < kNumOfKeysPerClient; ++i) {
+      std::string key = std::to_string(c) + "-" + std::to_string(i);
+      if (i % 2 == 1) {
+        EXPECT_FALSE(data->Get(key, &value));
+      } else {
+        ASSERT_TRUE(data->Get(key, &value));
+        EXPECT_EQ(key + "!", value);
+      }
+    }
+  }
+  uint64_t total = 0;
+  for (int i = 0; i < 8; ++i) {
+    uint64_t counter;
+    ASSERT_TRUE(data->FetchAdd("counter-" + std::to_string(i), 0, &counter));
+    total += counter;
+  }
+  EXPECT_EQ(static_cast<uint64_t>(kNumOfClients * kNumOfKeysPerClient), total);
+
+  // Calls on several keys are served where they arrive
+  std::vector<std::string> batch_keys = {"0-0", "0-1", "0-2"};
+  std::vector<std::string> output_values;
+  BackendClientStandard client(kInProcessHost, kInProcessSharedNothingPort);
+  EXPECT_TRUE(client.SendGetRequest(batch_keys, &output_values));
+  EXPECT_EQ(std::vector<std::string>({"0-0!", "", "0-2!"}), output_values);
+}
+
+// This fixture serves one store that keeps its changes through both the
+// synchronous and the asynchronous server
+class BackendChangesTest : public BackendTest {
+ protected:
+  static const size_t kChangeLogSize = 64;
+
+  void SetUp() override {
+    BackendTest::SetUp();
+    service.EnableChangeLog(kChangeLogSize);
+
+    grpc::ServerBuilder builder;
+    builder.AddListeningPort(std::string("0.0.0.0:") + kInProcessPort,
+                             grpc::InsecureServerCredentials());
+    builder.RegisterService(&service);
+    server = builder.BuildAndStart();
+    ASSERT_NE(nullptr, server);
+
+    async_server.reset(new AsyncKeyValueStoreServer(&service, 2));
+    ASSERT_TRUE(
+        async_server->Start(std::string("0.0.0.0:") + kInProcessAsyncPort));
+  }
+
+  void TearDown() override {
+    if (async_server != nullptr) {
+      async_server->Shutdown();
+    }
+    server->Shutdown();
+  }
+
+  // Follows the changes of the keys starting with "user/" through the server
+  // on `port`, as a consumer that reconnects would
+  void FollowChanges(const char* port) {
+    BackendClientStandard client(kInProcessHost, port);
+    auto stub = chirp::KeyValueStore::NewStub(
+        grpc::CreateChannel(std::string(kInProcessHost) + ":" + port,
+                            grpc::InsecureChannelCredentials()));
+
+    // The first reply of a stream that starts from now tells its offset
+    uint64_t next_seq;
+    {
+      grpc::ClientContext context;
+      chirp::ChangesRequest request;
+      request.set_prefix_filter("user/");
+      auto reader = stub->changes(&context, request);
+      chirp::ChangesReply reply;
+      ASSERT_TRUE(reader->Read(&reply));
+      EXPECT_EQ(0, reply.changes_size());
+      next_seq = reply.next_seq();
+
+      EXPECT_TRUE(client.SendPutRequest("other/1", "ignored"));
+      EXPECT_TRUE(client.SendPutRequest("user/1", "alice"));
+      EXPECT_TRUE(client.SendDeleteKeyRequest("user/1"));
+      std::vector<chirp::Change> changes;
+      auto start = std::chrono::steady_clock::now();
+      while (changes.size() < 2 &&
+             std::chrono::steady_clock::now() - start < kBlockedTimeout &&
+             reader->Read(&reply)) {
+        changes.insert(changes.end(), reply.changes().begin(),
+                       reply.changes().end());
+        next_seq = reply.next_seq();
+      }
+      ASSERT_EQ(2U, changes.size());
+      EXPECT_EQ("user/1", changes[0].key());
+      EXPECT_FALSE(changes[0].deleted());
+      EXPECT_EQ("alice", changes[0].value());
+      EXPECT_TRUE(changes[1].deleted());
+      EXPECT_GT(changes[1].seq(), changes[0].seq());
+      EXPECT_EQ(changes[1].seq() + 1, next_seq);
+
+      context.TryCancel();
+      reader->Finish();
+    }
+
+    // Changes made while disconnected are sent on reconnecting
+    EXPECT_TRUE(client.SendPutRequest("user/2", "bob"));
+    {
+      grpc::ClientContext context;
+      chirp::ChangesRequest request;
+      request.set_from_seq(next_seq);
+      request.set_prefix_filter("user/");
+      auto reader = stub->changes(&context, request);
+      chirp::ChangesReply reply;
+      ASSERT_TRUE(reader->Read(&reply));
+      ASSERT_EQ(1, reply.changes_size());
+      EXPECT_EQ("bob", reply.changes(0).value());
+      context.TryCancel();
+      reader->Finish();
+    }
+
+    // Offsets out of the kept range are refused, so the consumer rescans
+    {
+      grpc::ClientContext context;
+      chirp::ChangesRequest request;
+      request.set_from_seq(next_seq + 1000);
+      auto reader = stub->changes(&context, request);
+      chirp::ChangesReply reply;
+      EXPECT_FALSE(reader->Read(&reply));
+      EXPECT_EQ(grpc::StatusCode::OUT_OF_RANGE, reader->Finish().error_code());
+    }
+  }
+
+  KeyValueStoreImpl service;
+  std::unique_ptr<grpc::Server> server;
+  std::unique_ptr<AsyncKeyValueStoreServer> async_server;
+};
+
+const size_t BackendChangesTest::kChangeLogSize;
+
+// The following tests follow, resume and refuse changes streams
+TEST_F(BackendChangesTest, ServerChanges) { FollowChanges(kInProcessPort); }
+
+TEST_F(BackendChangesTest, AsyncServerChanges) {
+  FollowChanges(kInProcessAsyncPort);
+}
+
+// The following test keeps many streams waiting for changes on the
+// asynchronous server. Every one of them gets the change as soon as it is
+// made, and the server shuts down with some of them still open.
+TEST_F(BackendChangesTest, AsyncServerManyWaitingStreams) {
+  const int kNumOfStreams = 16;
+  auto stub = chirp::KeyValueStore::NewStub(grpc::CreateChannel(
+      std::string(kInProcessHost) + ":" + kInProcessAsyncPort,
+      grpc::InsecureChannelCredentials()));
+  std::vector<std::unique_ptr<grpc::ClientContext>> contexts;
+  std::vector<std::unique_ptr<grpc::ClientReader<chirp::ChangesReply>>>
+      readers;
+  for (int i = 0; i < kNumOfStreams; ++i) {
+    contexts.emplace_back(new grpc::ClientContext());
+    chirp::ChangesRequest request;
+    readers.push_back(stub->changes(contexts.back().get(), request));
+    chirp::ChangesReply reply;
+    ASSERT_TRUE(readers.back()->Read(&reply));
+  }
+
+  auto start = std::chrono::steady_clock::now();
+  service.get_backend_data()->Put("key", "value");
+  for (int i = 0; i < kNumOfStreams; ++i) {
+    chirp::ChangesReply reply;
+    ASSERT_TRUE(readers[i]->Read(&reply));
+    ASSERT_EQ(1, reply.changes_size());
+    EXPECT_EQ("key", reply.changes(0).key());
+  }
+  // Well before the heartbeat, so no stream waited for it
+  EXPECT_LT(std::chrono::steady_clock::now() - start,
+            std::chrono::milliseconds(KeyValueStoreImpl::kChangesHeartbeatMs));
+
+  for (int i = 0; i < kNumOfStreams / 2; ++i) {
+    contexts[i]->TryCancel();
+    readers[i]->Finish();
+  }
+  async_server->Shutdown();
+  async_server.reset();
+  for (int i = kNumOfStreams / 2; i < kNumOfStreams; ++i) {
+    readers[i]->Finish();
+  }
+}
+
+// This fixture watches keys through both servers of `BackendChangesTest`
+class BackendWatchTest : public BackendChangesTest {
+ protected:
+  // Watches the keys starting with "user/" through the server on `port`
+  // while another client writes them
+  void WatchKeys(const char* port) {
+    BackendClientStandard client(kInProcessHost, port);
+    BackendClientStandard writer(kInProcessHost, port);
+    std::vector<BackendClient::WatchEvent> events;
+    std::chrono::steady_clock::time_point put_time;
+    std::chrono::steady_clock::duration latency{};
+    bool first = true;
+    EXPECT_TRUE(client.SendWatchRequest(
+        {"user/"}, true, std::chrono::milliseconds(10000),
+        [&](const std::vector<BackendClient::WatchEvent>& new_events,
+            bool overflowed) {
+          EXPECT_FALSE(overflowed);
+          if (first) {
+            // Every write from now on is reported
+            EXPECT_TRUE(new_events.empty());
+            first = false;
+            put_time = std::chrono::steady_clock::now();
+            EXPECT_TRUE(writer.SendPutRequest("user/1", "alice"));
+            EXPECT_TRUE(writer.SendPutRequest("other/1", "ignored"));
+            EXPECT_TRUE(writer.SendDeleteKeyRequest("user/1"));
+            return true;
+          }
+          if (events.empty() && !new_events.empty()) {
+            latency = std::chrono::steady_clock::now() - put_time;
+          }
+          events.insert(events.end(), new_events.begin(), new_events.end());
+          return events.size() < 2;
+        }));
+    ASSERT_EQ(2U, events.size());
+    EXPECT_EQ("user/1", events[0].key);
+    EXPECT_FALSE(events[0].deleted);
+    EXPECT_EQ("alice", events[0].value);
+    EXPECT_TRUE(events[1].deleted);
+    // Far below the tick, so the write was pushed rather than found
+    EXPECT_LT(latency, std::chrono::milliseconds(500));
+
+    // Without writes, the watch only ticks
+    int num_of_ticks = 0;
+    EXPECT_TRUE(client.SendWatchRequest(
+        {"user/"}, false, std::chrono::milliseconds(20),
+        [&](const std::vector<BackendClient::WatchEvent>& new_events,
+            bool overflowed) {
+          EXPECT_TRUE(new_events.empty());
+          return ++num_of_ticks < 3;
+        }));
+
+    // A watch of nothing is refused
+    EXPECT_FALSE(client.SendWatchRequest(
+        {}, false, std::chrono::milliseconds(20),
+        [](const std::vector<BackendClient::WatchEvent>& new_events,
+           bool overflowed) { return true; }));
+  }
+
+  // returns true once the server has removed every watcher
+  bool NoWatchersLeft() {
+    WatchTable* table = service.get_backend_data()->get_watch_table();
+    auto start = std::chrono::steady_clock::now();
+    while (table->get_num_of_watchers() > 0 &&
+           std::chrono::steady_clock::now() - start < kBlockedTimeout) {
+      std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+    return table->get_num_of_watchers() == 0;
+  }
+};
+
+// The following tests watch keys, and wait for the watchers to be removed
+// once their streams are cancelled
+TEST_F(BackendWatchTest, ServerWatch) {
+  WatchKeys(kInProcessPort);
+  EXPECT_TRUE(NoWatchersLeft());
+}
+
+TEST_F(BackendWatchTest, AsyncServerWatch) {
+  WatchKeys(kInProcessAsyncPort);
+  EXPECT_TRUE(NoWatchersLeft());
+
+  // A watch still open when the server shuts down is ended by it
+  auto stub = chirp::KeyValueStore::NewStub(grpc::CreateChannel(
+      std::string(kInProcessHost) + ":" + kInProcessAsyncPort,
+      grpc::InsecureChannelCredentials()));
+  grpc::ClientContext context;
+  chirp::WatchRequest request;
+  request.add_prefixes("user/");
+  auto reader = stub->watch(&context, request);
+  chirp::WatchReply reply;
+  ASSERT_TRUE(reader->Read(&reply));
+  async_server->Shutdown();
+  async_server.reset();
+  EXPECT_FALSE(reader->Read(&reply));
+  reader->Finish();
+  EXPECT_TRUE(NoWatchersLeft());
+}
+
+// The following test reads records back from a replication log that drops
+// the oldest ones, and waits for a backup in sync mode
+TEST_F(BackendTest, ReplicationLogReadAndWaitForBackups) {
+  ReplicationLog log(4, ReplicationLog::SYNC, 1);
+  std::vector<WriteAheadLog::Record> records;
+  EXPECT_TRUE(log.Read(1, 10, std::chrono::milliseconds(0), &records));
+  EXPECT_TRUE(records.empty());
+  EXPECT_FALSE(log.Read(2, 10, std::chrono::milliseconds(0), &records));
+
+  for (uint64_t lsn = 1; lsn <= 6; ++lsn) {
+    log.Append(lsn, WriteAheadLog::PUT, std::to_string(lsn), "value");
+  }
+  // Only the last 4 records are kept
+  EXPECT_FALSE(log.Read(2, 10, std::chrono::milliseconds(0), &records));
+  ASSERT_TRUE(log.Read(3, 2, std::chrono::milliseconds(0), &records));
+  ASSERT_EQ(2U, records.size());
+  EXPECT_EQ(3U, records[0].lsn);
+  EXPECT_EQ("4", records[1].key);
+
+  // A backup is waited for once it has caught up
+  size_t id = log.AddBackup();
+  EXPECT_EQ(0U, log.get_num_of_backups_in_sync());
+  log.Acknowledge(id, 6);
+  EXPECT_EQ(1U, log.get_num_of_backups_in_sync());
+  log.Append(7, WriteAheadLog::DELETE_KEY, "7", "");
+  std::thread backup([&log, id]() {
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    log.Acknowledge(id, 7);
+  });
+  log.WaitForBackups(7);
+  backup.join();
+  EXPECT_EQ(1U, log.get_num_of_backups_in_sync());
+
+  // A backup that does not answer is dropped after the timeout
+  log.Append(8, WriteAheadLog::PUT, "8", "value");
+  auto start = std::chrono::steady_clock::now();
+  log.WaitForBackups(8);
+  EXPECT_GE(std::chrono::steady_clock::now() - start,
+            std::chrono::milliseconds(ReplicationLog::kSyncAckTimeoutMs));
+  EXPECT_EQ(0U, log.get_num_of_backups_in_sync());
+  EXPECT_EQ(1U, log.get_num_of_sync_timeouts());
+
+  // It is in sync again once it has applied the records appended by the
+  // time it was dropped, however many came after
+  log.Append(9, WriteAheadLog::PUT, "9", "value");
+  log.Acknowledge(id, 7);
+  EXPECT_EQ(0U, log.get_num_of_backups_in_sync());
+  log.Acknowledge(id, 8);
+  EXPECT_EQ(1U, log.get_num_of_backups_in_sync());
+  log.RemoveBackup(id);
+  EXPECT_EQ(0U, log.get_num_of_backups());
+}
+
+// Runs a primary and its backups in this process, each on its own port
+class BackendReplicationTest : public BackendTest {
+ protected:
+  static const size_t kNumOfBackups = 2;
+  // Small enough for a backup that starts late to be sent a copy
+  static const size_t kReplicationLogSize = 16;
+
+  void SetUp() override {
+    BackendTest::SetUp();
+    std::remove(kPrimaryWriteAheadLogPath);
+
+    ASSERT_TRUE(primary.EnableWriteAheadLog(kPrimaryWriteAheadLogPath,
+                                            WriteAheadLog::NONE, 1));
+    ASSERT_TRUE(
+        primary.EnableReplication(ReplicationLog::SYNC, kReplicationLogSize));
+    primary_server = StartServer(&primary, kPrimaryPort);
+    ASSERT_NE(nullptr, primary_server);
+  }
+
+  void TearDown() override {
+    // The backups go first, which closes their streams to the primary
+    for (size_t i = 0; i < kNumOfBackups; ++i) {
+      if (backup_servers[i] != nullptr) {
+        backup_servers[i]->Shutdown();
+      }
+      backups[i].reset();
+    }
+    primary_server->Shutdown(std::chrono::system_clock::now() +
+                             std::chrono::milliseconds(500));
+    std::remove(kPrimaryWriteAheadLogPath);
+  }
+
+  // returns a server serving `service` on `port`
+  std::unique_ptr<grpc::Server> StartServer(KeyValueStoreImpl* service,
+                                            const char* port) {
+    grpc::ServerBuilder builder;
+    builder.AddListeningPort(std::string("0.0.0.0:") + port,
+                             grpc::InsecureServerCredentials());
+    builder.RegisterService(service);
+    if (service->get_replication_service() != nullptr) {
+      builder.RegisterService(service->get_replication_service());
+    }
+    return builder.BuildAndStart();
+  }
+
+  // Starts backup `i`, which follows the primary
+  void StartBackup(size_t i) {
+    backups[i].reset(new KeyValueStoreImpl());
+    backups[i]->FollowPrimary(std::string(kInProcessHost) + ":" +
+                              kPrimaryPort);
+    backup_servers[i] = StartServer(backups[i].get(), kBackupPorts[i]);
+    ASSERT_NE(nullptr, backup_servers[i]);
+  }
+
+  // returns true once `n` backups are in sync with the primary
+  // returns false if that takes longer than `kBlockedTimeout`
+  bool WaitForBackupsInSync(size_t n) {
+    auto deadline = std::chrono::steady_clock::now() + kBlockedTimeout;
+    while (primary.get_replication_log()->get_num_of_backups_in_sync() < n) {
+      if (std::chrono::steady_clock::now() > deadline) {
+        return false;
+      }
+      std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+    return true;
+  }
+
+  KeyValueStoreImpl primary;
+  std::unique_ptr<grpc::Server> primary_server;
+  std::unique_ptr<KeyValueStoreImpl> backups[kNumOfBackups];
+  std::unique_ptr<grpc::Server> backup_servers[kNumOfBackups];
+};
+
+const size_t BackendReplicationTest::kNumOfBackups;
+const size_t BackendReplicationTest::kReplicationLogSize;
+
+// The following test writes to a primary in sync mode. Every write should be
+// on the backups by the time it returns, and the backups should turn down
+// writes.
+TEST_F(BackendReplicationTest, ReplicationSyncWrites) {
+  for (size_t i = 0; i < kNumOfBackups; ++i) {
+    StartBackup(i);
+  }
+  ASSERT_TRUE(WaitForBackupsInSync(kNumOfBackups));
+  chirp::StatsReply stats;
+  primary.GetStats(&stats);
+  EXPECT_EQ(kNumOfBackups, stats.num_of_backups());
+  EXPECT_EQ(kNumOfBackups, stats.num_of_backups_in_sync());
+
+  BackendClientStandard client(kInProcessHost, kPrimaryPort);
+  std::string value;
+  for (int i = 0; i < kNumOfPairs; ++i) {
+    ASSERT_TRUE(client.SendPutRequest(keys[i], correct_values_full[i]));
+    for (size_t b = 0; b < kNumOfBackups; ++b) {
+      ASSERT_TRUE(backups[b]->get_backend_data()->Get(keys[i], &value));
+      EXPECT_EQ(correct_values_full[i], value);
+    }
+  }
+  ASSERT_TRUE(client.SendDeleteKeyRequest(keys[0]));
+  uint64_t previous;
+  ASSERT_TRUE(client.SendFetchAddRequest("counter", 5, &previous));
+  for (size_t b = 0; b < kNumOfBackups; ++b) {
+    BackendDataStructure* data = backups[b]->get_backend_data();
+    EXPECT_FALSE(data->Get(keys[0], &value));
+    uint64_t counter;
+    ASSERT_TRUE(data->FetchAdd("counter", 0, &counter));
+    EXPECT_EQ(5U, counter);
+  }
+
+  BackendClientStandard backup_client(kInProcessHost, kBackupPorts[0]);
+  EXPECT_FALSE(backup_client.SendPutRequest("key", "value"));
+  EXPECT_FALSE(backup_client.SendDeleteKeyRequest(keys[1]));
+  EXPECT_FALSE(backups[0]->get_backend_data()->Get("key", &value));
+}
+
+// The following test starts a backup after more writes than the primary
+// keeps records of, so the backup is sent a copy of the pairs first
+TEST_F(BackendReplicationTest, ReplicationLateBackupGetsCopy) {
+  const int kNumOfWrites = 10 * kReplicationLogSize;
+  BackendClientStandard client(kInProcessHost, kPrimaryPort);
+  for (int i = 0; i < kNumOfWrites; ++i) {
+    ASSERT_TRUE(client.SendPutRequest(std::to_string(i), std::to_string(i)));
+  }
+  ASSERT_TRUE(client.SendDeleteKeyRequest("0"));
+
+  StartBackup(0);
+  ASSERT_TRUE(WaitForBackupsInSync(1));
+  ASSERT_TRUE(client.SendPutRequest("last", "write"));
+
+  BackendDataStructure* data = backups[0]->get_backend_data();
+  std::string value;
+  EXPECT_FALSE(data->Get("0", &value));
+  for (int i = 1; i < kNumOfWrites; ++i) {
+    ASSERT_TRUE(data->Get(std::to_string(i), &value));
+    EXPECT_EQ(std::to_string(i), value);
+  }
+  ASSERT_TRUE(data->Get("last", &value));
+  EXPECT_EQ("write", value);
+}
+
+// The following test spreads the reads of a client over the primary and its
+// backups. Each read should see every write.
+TEST_F(BackendReplicationTest, ReplicationReadReplicas) {
+  for (size_t i = 0; i < kNumOfBackups; ++i) {
+    StartBackup(i);
+  }
+  ASSERT_TRUE(WaitForBackupsInSync(kNumOfBackups));
+
+  BackendClientStandard client(kInProcessHost, kPrimaryPort);
+  for (size_t i = 0; i < kNumOfBackups; ++i) {
+    client.AddReadReplica(kInProcessHost, kBackupPorts[i]);
+  }
+  ASSERT_TRUE(client.SendMultiPutRequest(keys, correct_values_full));
+
+  // Each round goes to the next server
+  for (size_t round = 0; round < 2 * (kNumOfBackups + 1); ++round) {
+    std::vector<std::string> output_values;
+    ASSERT_TRUE(client.SendGetRequest(keys, &output_values));
+    EXPECT_EQ(correct_values_full, output_values);
+
+    std::vector<std::pair<std::string, std::string>> pairs;
+    ASSERT_TRUE(client.SendScanRequest("", "", 0, &pairs));
+    EXPECT_EQ(keys.size(), pairs.size());
+
+    std::vector<bool> exists;
+    ASSERT_TRUE(client.SendExistsRequest({keys[0], "missing"}, &exists));
+    EXPECT_EQ(std::vector<bool>({true, false}), exists);
+  }
+}
+
+// The following test pins the shared hashes, which the bloom filters on disk
+// and the clients of a sharded store rely on
+TEST_F(BackendTest, HashesStayTheSame) {
+  EXPECT_EQ(0xEFD01F60BA992926ULL, HashBytes("", 0));
+  EXPECT_EQ(0x164B63CCBE449B9BULL, HashBytes("chirp", 5));
+  EXPECT_EQ(HashBytes("chirp", 5), ConsistentHashRing::Hash("chirp"));
+  EXPECT_EQ(0U, MixHash(0));
+}
+
+// The following test spreads keys over a ring of nodes, then adds a node.
+// Every node should get close to an even share, and only the keys taken by
+// the new node should move.
+TEST_F(BackendTest, ConsistentHashRingBalanceAndMoves) {
+  const int kNumOfKeys = 20000;
+  const size_t kNumOfNodes = 4;
+  ConsistentHashRing ring;
+  for (size_t i = 0; i < kNumOfNodes; ++i) {
+    EXPECT_EQ(i, ring.AddNode("node-" + std::to_string(i)));
+  }
+
+  std::vector<size_t> owners(kNumOfKeys);
+  std::vector<int> counts(kNumOfNodes, 0);
+  for (int i = 0; i < kNumOfKeys; ++i) {
+    owners[i] = ring.NodeOf("key-" + std::to_string(i));
+    ++counts[owners[i]];
+  }
+  for (int count : counts) {
+    EXPECT_GT(count, kNumOfKeys / kNumOfNodes * 3 / 4);
+    EXPECT_LT(count, kNumOfKeys / kNumOfNodes * 5 / 4);
+  }
+
+  size_t new_node = ring.AddNode("node-" + std::to_string(kNumOfNodes));
+  int num_of_moved = 0;
+  for (int i = 0; i < kNumOfKeys; ++i) {
+    size_t owner = ring.NodeOf("key-" + std::to_string(i));
+    if (owner != owners[i]) {
+      EXPECT_EQ(new_node, owner);
+      ++num_of_moved;
+    }
+  }
+  EXPECT_GT(num_of_moved, kNumOfKeys / (kNumOfNodes + 1) * 3 / 4);
+  EXPECT_LT(num_of_moved, kNumOfKeys / (kNumOfNodes + 1) * 5 / 4);
+
+  // The owners only depend on the names of the nodes
+  ConsistentHashRing reversed;
+  for (size_t i = kNumOfNodes + 1; i-- > 0;) {
+    reversed.AddNode("node-" + std::to_string(i));
+  }
+  for (int i = 0; i < 100; ++i) {
+    std::string key = "key-" + std::to_string(i);
+    EXPECT_EQ(kNumOfNodes - ring.NodeOf(key), reversed.NodeOf(key));
+  }
+}
+
+// Runs several backend servers in this process, each on its own port
+class BackendShardedClientTest : public BackendTest {
+ protected:
+  static const size_t kNumOfServers = 3;
+
+  void SetUp() override {
+    BackendTest::SetUp();
+
+    std::vector<std::string> endpoints;
+    for (size_t i = 0; i < kNumOfServers; ++i) {
+      grpc::ServerBuilder builder;
+      builder.AddListeningPort(std::string("0.0.0.0:") + kShardPorts[i],
+                               grpc::InsecureServerCredentials());
+      builder.RegisterService(&services[i]);
+      servers[i] = builder.BuildAndStart();
+      ASSERT_NE(nullptr, servers[i]);
+      endpoints.push_back(std::string(kInProcessHost) + ":" + kShardPorts[i]);
+    }
+    sharded_client.reset(new BackendClientStandard(endpoints));
+  }
+
+  void TearDown() override {
+    for (size_t i = 0; i < kNumOfServers; ++i) {
+      servers[i]->Shutdown();
+    }
+  }
+
+  KeyValueStoreImpl services[kNumOfServers];
+  std::unique_ptr<grpc::Server> servers[kNumOfServers];
+  std::unique_ptr<BackendClientStandard> sharded_client;
+};
+
+const size_t BackendShardedClientTest::kNumOfServers;
+
+// The following test writes through a client spread over several servers.
+// Every key should be on the server the client picks for it, and reads on
+// many keys should come back in the order of the keys.
+TEST_F(BackendShardedClientTest, ShardedClientOperations) {
+  ASSERT_EQ(kNumOfServers, sharded_client->get_num_of_servers());
+  ASSERT_TRUE(sharded_client->SendMultiPutRequest(keys, correct_values_full));
+
+  std::vector<size_t> num_of_keys(kNumOfServers, 0);
+  std::string value;
+  for (int i = 0; i < kNumOfPairs; ++i) {
+    size_t server = sharded_client->ServerOf(keys[i]);
+    ++num_of_keys[server];
+    for (size_t j = 0; j < kNumOfServers; ++j) {
+      EXPECT_EQ(j == server,
+                services[j].get_backend_data()->Get(keys[i], &value));
+    }
+  }
+  for (size_t count : num_of_keys) {
+    EXPECT_GT(count, 0U);
+  }
+
+  std::vector<std::string> output_values;
+  ASSERT_TRUE(sharded_client->SendGetRequest(keys, &output_values));
+  EXPECT_EQ(correct_values_full, output_values);
+
+  std::vector<bool> exists;
+  std::vector<std::string> exists_keys = {keys[3], "missing", keys[7]};
+  ASSERT_TRUE(sharded_client->SendExistsRequest(exists_keys, &exists));
+  EXPECT_EQ(std::vector<bool>({true, false, true}), exists);
+
+  // The scans of every server are merged in key order
+  std::vector<std::pair<std::string, std::string>> expected;
+  for (int i = 0; i < kNumOfPairs; ++i) {
+    expected.emplace_back(keys[i], correct_values_full[i]);
+  }
+  std::sort(expected.begin(), expected.end());
+  std::vector<std::pair<std::string, std::string>> pairs;
+  ASSERT_TRUE(sharded_client->SendScanRequest("", "", 0, &pairs));
+  EXPECT_EQ(expected, pairs);
+  pairs.clear();
+  ASSERT_TRUE(sharded_client->SendScanRequest("", "", 5, &pairs));
+  expected.resize(5);
+  EXPECT_EQ(expected, pairs);
+
+  ASSERT_TRUE(sharded_client->SendMultiDeleteRequest(keys_to_be_deleted));
+  output_values.clear();
+  ASSERT_TRUE(sharded_client->SendGetRequest(keys, &output_values));
+  EXPECT_EQ(correct_values_after_delete, output_values);
+
+  uint64_t previous;
+  ASSERT_TRUE(sharded_client->SendFetchAddRequest("counter", 2, &previous));
+  ASSERT_TRUE(sharded_client->SendFetchAddRequest("counter", 3, &previous));
+  EXPECT_EQ(2U, previous);
+}
+
+// The following test sends write batches through a client spread over
+// several servers. A batch with conditions is only sent if all its keys are
+// on one server, since a condition on one server cannot stop the writes on
+// another.
+TEST_F(BackendShardedClientTest, ShardedClientWriteBatch) {
+  ASSERT_TRUE(sharded_client->SendMultiPutRequest(keys, correct_values_full));
+  int other = 1;
+  while (other < kNumOfPairs && sharded_client->ServerOf(keys[other]) ==
+                                    sharded_client->ServerOf(keys[0])) {
+    ++other;
+  }
+  ASSERT_LT(other, kNumOfPairs);
+
+  // The condition on `keys[0]` does not hold, and `keys[other]` is elsewhere
+  chirp::WriteBatchRequest batch;
+  chirp::BatchCondition* condition = batch.add_conditions();
+  condition->set_key(keys[0]);
+  condition->set_expected("stale");
+  chirp::PutRequest* put = batch.add_writes()->mutable_put();
+  put->set_key(keys[other]);
+  put->set_value("new");
+  bool applied;
+  EXPECT_FALSE(sharded_client->SendWriteBatchRequest(batch, &applied, nullptr));
+  std::vector<std::string> output_values;
+  ASSERT_TRUE(sharded_client->SendGetRequest({keys[other]}, &output_values));
+  EXPECT_EQ(correct_values_full[other], output_values[0]);
+
+  // Keys on one server keep their conditions
+  put->set_key(keys[0]);
+  size_t failed_condition = 1;
+  EXPECT_TRUE(sharded_client->SendWriteBatchRequest(batch, &applied,
+                                                    &failed_condition));
+  EXPECT_FALSE(applied);
+  EXPECT_EQ(0U, failed_condition);
+  condition->set_expected(correct_values_full[0]);
+  EXPECT_TRUE(sharded_client->SendWriteBatchRequest(batch, &applied, nullptr));
+  EXPECT_TRUE(applied);
+
+  // A batch without conditions is split by server
+  batch.clear_conditions();
+  put = batch.add_writes()->mutable_put();
+  put->set_key(keys[other]);
+  put->set_value("new");
+  EXPECT_TRUE(sharded_client->SendWriteBatchRequest(batch, &applied, nullptr));
+  EXPECT_TRUE(applied);
+  output_values.clear();
+  ASSERT_TRUE(
+      sharded_client->SendGetRequest({keys[0], keys[other]}, &output_values));
+  EXPECT_EQ(std::vector<std::string>({"new", "new"}), output_values);
+}
+
 // TODO: Since the follwing tests require a running backend server, I made them
 // disabled for now This test is similar to the DataStructurePutAndGet above.
 // The difference is this tests use grpc to communicate with the backend server.
@@ -2,13 +2,18 @@
 #include <chrono>
 #include <iostream>
 #include <memory>
+#include <set>
 #include <string>
 #include <thread>
 #include <vector>
 
 #include <glog/logging.h>
+#include <grpcpp/security/server_credentials.h>
+#include <grpcpp/server.h>
+#include <grpcpp/server_builder.h>
 #include "gtest/gtest.h"
 
+#include "backend_server.h"
 #include "service_client_lib.h"
 #include "service_data_structure.h"
 
@@ -26,6 +31,8 @@ const char *kLongText =
     "longlonglonglonglonglonglonglonglonglonglonglonglonglonglonglonglonglonglo"
     "nglonglonglonglonglonglonglonglonglonglonglonglonglonglonglonglonglonglong"
     "longlonglonglonglong";
+// The ports of the backend servers run in this process
+const char *kShardPorts[] = {"50116", "50117", "50118"};
 
 // This test cases on the `ServiceDataStructure` to check whether their
 // interfaces work correctly.
@@ -172,6 +179,21 @@ TEST_F(ServiceTestDataStructure, ChirpPost) {
   }
 }
 
+// This tests that chirp ids keep counting up from an id stored as a
+// `NowChirpId` message by an older version
+TEST_F(ServiceTestDataStructure, NextChirpIdFromOldFormat) {
+  const std::string next_chirp_id_key({0, 0, 0, char(1)});
+  ServiceData::NowChirpId old_format;
+  old_format.set_now_id(41);
+  std::string binary;
+  old_format.SerializeToString(&binary);
+  ASSERT_TRUE(chirp_connect_backend::backend_client_->SendPutRequest(
+      next_chirp_id_key, binary));
+
+  EXPECT_EQ(uint64_t(42), chirp_connect_backend::GetNextChirpId());
+  EXPECT_EQ(uint64_t(43), chirp_connect_backend::GetNextChirpId());
+}
+
 // This tests on the `EditChirp()`
 TEST_F(ServiceTestDataStructure, ChirpEdit) {
   // Tests for every user
@@ -352,6 +374,128 @@ TEST_F(ServiceTestDataStructure, Monitor) {
   }
 }
 
+// A chirp whose writes become visible after a monitor has read past its time
+// should still be returned by the next call, and only once
+TEST_F(ServiceTestDataStructure, MonitorLateChirp) {
+  auto session = service_data_structure_.UserLogin(user_list_[0]);
+  ASSERT_NE(nullptr, session);
+  ASSERT_EQ(ServiceDataStructure::OK, session->Follow(user_list_[1]));
+
+  struct timeval from;
+  gettimeofday(&from, nullptr);
+  // The chirp takes its time now, but is written after the first call
+  ServiceDataStructure::Chirp late(user_list_[1], 0, kShortText);
+  std::this_thread::sleep_for(std::chrono::milliseconds(1));
+  EXPECT_TRUE(session->MonitorFrom(&from).empty());
+
+  ServiceDataStructure::User user;
+  ASSERT_TRUE(chirp_connect_backend::GetUser(user_list_[1], &user));
+  user.set_last_update(late.get_time());
+  chirp_connect_backend::WriteBatch batch;
+  batch.SaveChirp(late.get_id(), late);
+  batch.SaveUser(user_list_[1], user);
+  batch.AddToUserChirpList(user_list_[1], late.get_id());
+  ASSERT_TRUE(batch.Commit(nullptr));
+
+  EXPECT_EQ(std::set<uint64_t>({late.get_id()}), session->MonitorFrom(&from));
+  EXPECT_TRUE(session->MonitorFrom(&from).empty());
+}
+
+// This test cases on the `ServiceDataStructure` with its keys spread over
+// several backend servers run in this process
+class ServiceTestShardedBackend : public ::testing::Test {
+ protected:
+  static const size_t kNumOfServers = 3;
+
+  void SetUp() override {
+    std::vector<std::string> endpoints;
+    for (size_t i = 0; i < kNumOfServers; ++i) {
+      grpc::ServerBuilder builder;
+      builder.AddListeningPort(std::string("0.0.0.0:") + kShardPorts[i],
+                               grpc::InsecureServerCredentials());
+      builder.RegisterService(&services_[i]);
+      servers_[i] = builder.BuildAndStart();
+      ASSERT_NE(nullptr, servers_[i]);
+      endpoints.push_back(std::string("localhost:") + kShardPorts[i]);
+    }
+    chirp_connect_backend::backend_client_.reset(
+        new BackendClientStandard(endpoints));
+  }
+
+  void TearDown() override {
+    chirp_connect_backend::backend_client_.reset(new BackendClientDebug());
+    for (size_t i = 0; i < kNumOfServers; ++i) {
+      if (servers_[i] != nullptr) {
+        servers_[i]->Shutdown();
+      }
+    }
+  }
+
+  KeyValueStoreImpl services_[kNumOfServers];
+  std::unique_ptr<grpc::Server> servers_[kNumOfServers];
+
+  // The object that this test is going to test
+  ServiceDataStructure service_data_structure_;
+};
+
+const size_t ServiceTestShardedBackend::kNumOfServers;
+
+// This tests that registering, following, posting, replying and deleting
+// still check what they expect when their keys are on different servers
+TEST_F(ServiceTestShardedBackend, Operations) {
+  for (size_t i = 0; i < kNumOfUsersPreset; ++i) {
+    std::string username = std::string("user") + std::to_string(i);
+    ASSERT_EQ(ServiceDataStructure::OK,
+              service_data_structure_.UserRegister(username));
+    EXPECT_EQ(ServiceDataStructure::USER_EXISTS,
+              service_data_structure_.UserRegister(username));
+  }
+
+  auto session = service_data_structure_.UserLogin("user0");
+  ASSERT_NE(nullptr, session);
+  auto other = service_data_structure_.UserLogin("user1");
+  ASSERT_NE(nullptr, other);
+  for (size_t i = 1; i < kNumOfUsersPreset; ++i) {
+    EXPECT_EQ(ServiceDataStructure::OK,
+              session->Follow(std::string("user") + std::to_string(i)));
+  }
+  EXPECT_EQ(ServiceDataStructure::FOLLOWEE_NOT_FOUND,
+            session->Follow("non-existed"));
+  EXPECT_EQ(kNumOfUsersPreset - 1,
+            session->SessionGetUserFollowingList().size());
+
+  // Replies of one user to the chirps of another
+  uint64_t parent_id;
+  ASSERT_EQ(ServiceDataStructure::OK,
+            other->PostChirp(kShortText, &parent_id, 0));
+  std::vector<uint64_t> reply_ids;
+  for (size_t i = 0; i < kNumOfChirps; ++i) {
+    uint64_t reply_id;
+    ASSERT_EQ(ServiceDataStructure::OK,
+              session->PostChirp(kShortText, &reply_id, parent_id));
+    reply_ids.push_back(reply_id);
+  }
+  uint64_t reply_id;
+  EXPECT_EQ(ServiceDataStructure::REPLY_ID_NOT_FOUND,
+            session->PostChirp(kShortText, &reply_id, parent_id + 1000));
+
+  ServiceDataStructure::Chirp parent;
+  ASSERT_EQ(ServiceDataStructure::OK,
+            service_data_structure_.ReadChirp(parent_id, &parent));
+  EXPECT_EQ(kNumOfChirps, parent.get_children_ids().size());
+
+  for (const uint64_t &id : reply_ids) {
+    EXPECT_EQ(ServiceDataStructure::OK, session->DeleteChirp(id));
+    EXPECT_EQ(ServiceDataStructure::CHIRP_ID_NOT_FOUND,
+              session->DeleteChirp(id));
+  }
+  EXPECT_TRUE(session->SessionGetUserChirpList().empty());
+  ServiceDataStructure::Chirp parent_after_delete;
+  ASSERT_EQ(ServiceDataStructure::OK,
+            service_data_structure_.ReadChirp(parent_id, &parent_after_delete));
+  EXPECT_TRUE(parent_after_delete.get_children_ids().empty());
+}
+
 // TODO: Not sure whether I should keep the following tests, so make it disabled
 // for now This test cases on the Service Server to check whether their
 // interfaces work correctly.